@@ -28,7 +28,7 @@
 #include "main.h"
 
 /* USER CODE BEGIN Includes */
-
+#include <ILI9341.h>
 /* USER CODE END Includes */
 
 extern SRAM_HandleTypeDef hsram1;
@@ -42,7 +42,10 @@ void HAL_SRAM_MspInit(SRAM_HandleTypeDef* hsram);
 void HAL_SRAM_MspDeInit(SRAM_HandleTypeDef* hsram);
 
 /* USER CODE BEGIN Prototypes */
-
+void MX_FSMC_ApplyLCDTiming(const ILI9341Timing_s *timing);
+void MX_FSMC_LCDBulkWrite(const uint16_t *pixels, uint32_t pixelNum,
+                          volatile uint16_t *dataRegister);
+void MX_FSMC_LCDBulkFill(uint16_t color, uint32_t pixelNum, volatile uint16_t *dataRegister);
 /* USER CODE END Prototypes */
 
 #ifdef __cplusplus
@@ -22,7 +22,7 @@
 #include "fsmc.h"
 
 /* USER CODE BEGIN 0 */
-
+#include <ILI9341.h>
 /* USER CODE END 0 */
 
 SRAM_HandleTypeDef hsram1;
@@ -35,6 +35,7 @@ void MX_FSMC_Init(void)
   /* USER CODE END FSMC_Init 0 */
 
   FSMC_NORSRAM_TimingTypeDef Timing = {0};
+  FSMC_NORSRAM_TimingTypeDef ExtTiming = {0};
 
   /* USER CODE BEGIN FSMC_Init 1 */
 
@@ -55,7 +56,7 @@ void MX_FSMC_Init(void)
   hsram1.Init.WaitSignalActive = FSMC_WAIT_TIMING_BEFORE_WS;
   hsram1.Init.WriteOperation = FSMC_WRITE_OPERATION_ENABLE;
   hsram1.Init.WaitSignal = FSMC_WAIT_SIGNAL_DISABLE;
-  hsram1.Init.ExtendedMode = FSMC_EXTENDED_MODE_DISABLE;
+  hsram1.Init.ExtendedMode = FSMC_EXTENDED_MODE_ENABLE;
   hsram1.Init.AsynchronousWait = FSMC_ASYNCHRONOUS_WAIT_DISABLE;
   hsram1.Init.WriteBurst = FSMC_WRITE_BURST_DISABLE;
   hsram1.Init.PageSize = FSMC_PAGE_SIZE_NONE;
@@ -68,8 +69,15 @@ void MX_FSMC_Init(void)
   Timing.DataLatency = 17;
   Timing.AccessMode = FSMC_ACCESS_MODE_A;
   /* ExtTiming */
-
-  if (HAL_SRAM_Init(&hsram1, &Timing, NULL) != HAL_OK)
+  ExtTiming.AddressSetupTime = 2;
+  ExtTiming.AddressHoldTime = 15;
+  ExtTiming.DataSetupTime = 16;
+  ExtTiming.BusTurnAroundDuration = 2;
+  ExtTiming.CLKDivision = 16;
+  ExtTiming.DataLatency = 17;
+  ExtTiming.AccessMode = FSMC_ACCESS_MODE_A;
+
+  if (HAL_SRAM_Init(&hsram1, &Timing, &ExtTiming) != HAL_OK)
   {
     Error_Handler( );
   }
@@ -79,6 +87,139 @@ void MX_FSMC_Init(void)
   /* USER CODE END FSMC_Init 2 */
 }
 
+/* USER CODE BEGIN 1 */
+/**
+  * @brief  Program the LCD bank with a timing found by ILI9341CalibrateTiming.
+  *         Timing (BTR) is used for reads and ExtTiming (BWTR) for writes
+  *         because the bank runs in extended mode.
+  * @param  timing address/data setup times in HCLK cycles
+  * @retval None
+  */
+void MX_FSMC_ApplyLCDTiming(const ILI9341Timing_s *timing)
+{
+  FSMC_NORSRAM_TimingTypeDef Timing = {0};
+  FSMC_NORSRAM_TimingTypeDef ExtTiming = {0};
+
+  Timing.AddressSetupTime = timing->readAddressSetup;
+  Timing.AddressHoldTime = 15;
+  Timing.DataSetupTime = timing->readDataSetup;
+  Timing.BusTurnAroundDuration = 2;
+  Timing.CLKDivision = 16;
+  Timing.DataLatency = 17;
+  Timing.AccessMode = FSMC_ACCESS_MODE_A;
+
+  ExtTiming.AddressSetupTime = timing->writeAddressSetup;
+  ExtTiming.AddressHoldTime = 15;
+  ExtTiming.DataSetupTime = timing->writeDataSetup;
+  ExtTiming.BusTurnAroundDuration = 0;
+  ExtTiming.CLKDivision = 16;
+  ExtTiming.DataLatency = 17;
+  ExtTiming.AccessMode = FSMC_ACCESS_MODE_A;
+
+  FSMC_NORSRAM_Timing_Init(hsram1.Instance, &Timing, hsram1.Init.NSBank);
+  FSMC_NORSRAM_Extended_Timing_Init(hsram1.Extended, &ExtTiming,
+                                    hsram1.Init.NSBank, hsram1.Init.ExtendedMode);
+}
+
+static DMA_HandleTypeDef hdma_lcd;
+
+/**
+  * @brief  Set up DMA2 Stream0 for memory-to-memory transfers into the LCD
+  *         data register, only when the configuration changes
+  * @param  alignment DMA_PDATAALIGN_WORD or DMA_PDATAALIGN_HALFWORD
+  * @param  sourceInc DMA_PINC_ENABLE to copy pixels, DMA_PINC_DISABLE to fill
+  * @retval None
+  */
+static void MX_FSMC_LCDConfigureDMA(uint32_t alignment, uint32_t sourceInc)
+{
+  if (hdma_lcd.Instance != NULL && hdma_lcd.Init.PeriphDataAlignment == alignment &&
+      hdma_lcd.Init.PeriphInc == sourceInc)
+  {
+    return;
+  }
+  __HAL_RCC_DMA2_CLK_ENABLE();
+  hdma_lcd.Instance = DMA2_Stream0;
+  hdma_lcd.Init.Channel = DMA_CHANNEL_0;
+  hdma_lcd.Init.Direction = DMA_MEMORY_TO_MEMORY;
+  hdma_lcd.Init.PeriphInc = sourceInc;
+  hdma_lcd.Init.MemInc = DMA_MINC_DISABLE;
+  hdma_lcd.Init.PeriphDataAlignment = alignment;
+  hdma_lcd.Init.MemDataAlignment = alignment == DMA_PDATAALIGN_WORD ?
+                                   DMA_MDATAALIGN_WORD : DMA_MDATAALIGN_HALFWORD;
+  hdma_lcd.Init.Mode = DMA_NORMAL;
+  hdma_lcd.Init.Priority = DMA_PRIORITY_HIGH;
+  hdma_lcd.Init.FIFOMode = DMA_FIFOMODE_ENABLE;
+  hdma_lcd.Init.FIFOThreshold = DMA_FIFO_THRESHOLD_FULL;
+  hdma_lcd.Init.MemBurst = DMA_MBURST_SINGLE;
+  hdma_lcd.Init.PeriphBurst = DMA_PBURST_SINGLE;
+  if (HAL_DMA_Init(&hdma_lcd) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
+/**
+  * @brief  Copy pixels into the LCD data register with DMA2 Stream0 in
+  *         memory-to-memory mode, the source increments and the destination
+  *         stays on the data register. Word transfers are split into two
+  *         16-bit cycles by the FSMC, like the CPU pixel pump does.
+  *         Registered with ILI9341SetBulkWrite, blocks until done.
+  * @param  pixels pixels to write
+  * @param  pixelNum number of pixels
+  * @param  dataRegister LCD data register
+  * @retval None
+  */
+void MX_FSMC_LCDBulkWrite(const uint16_t *pixels, uint32_t pixelNum,
+                          volatile uint16_t *dataRegister)
+{
+  uint32_t alignment = ((uint32_t)pixels & 2) || (pixelNum & 1) ?
+                       DMA_PDATAALIGN_HALFWORD : DMA_PDATAALIGN_WORD;
+  uint32_t itemSize = alignment == DMA_PDATAALIGN_WORD ? 4 : 2;
+  uint32_t items = pixelNum * 2 / itemSize;
+
+  MX_FSMC_LCDConfigureDMA(alignment, DMA_PINC_ENABLE);
+  while (items > 0)
+  {
+    /* NDTR holds at most 65535 items */
+    uint32_t chunk = items > 65535 ? 65535 : items;
+    HAL_DMA_Start(&hdma_lcd, (uint32_t)pixels, (uint32_t)dataRegister, chunk);
+    HAL_DMA_PollForTransfer(&hdma_lcd, HAL_DMA_FULL_TRANSFER, HAL_MAX_DELAY);
+    pixels += chunk * itemSize / 2;
+    items -= chunk;
+  }
+}
+
+/**
+  * @brief  Fill the LCD data register with one color, DMA2 Stream0 reads the
+  *         same word of two pixels over and over. An odd last pixel is
+  *         written by the CPU. Registered with ILI9341SetBulkFill, blocks
+  *         until done.
+  * @param  color color to write
+  * @param  pixelNum number of pixels
+  * @param  dataRegister LCD data register
+  * @retval None
+  */
+void MX_FSMC_LCDBulkFill(uint16_t color, uint32_t pixelNum, volatile uint16_t *dataRegister)
+{
+  static uint32_t pair;
+  uint32_t items = pixelNum / 2;
+
+  pair = color | (uint32_t)color << 16;
+  MX_FSMC_LCDConfigureDMA(DMA_PDATAALIGN_WORD, DMA_PINC_DISABLE);
+  while (items > 0)
+  {
+    uint32_t chunk = items > 65535 ? 65535 : items;
+    HAL_DMA_Start(&hdma_lcd, (uint32_t)&pair, (uint32_t)dataRegister, chunk);
+    HAL_DMA_PollForTransfer(&hdma_lcd, HAL_DMA_FULL_TRANSFER, HAL_MAX_DELAY);
+    items -= chunk;
+  }
+  if (pixelNum & 1)
+  {
+    *dataRegister = color;
+  }
+}
+/* USER CODE END 1 */
+
 static uint32_t FSMC_Initialized = 0;
 
 static void HAL_FSMC_MspInit(void){
@@ -88,7 +88,10 @@ int main(void)
   MX_GPIO_Init();
   MX_FSMC_Init();
   /* USER CODE BEGIN 2 */
-
+  ILI9341Initialize();
+  ILI9341CalibrateTiming(MX_FSMC_ApplyLCDTiming, NULL);
+  ILI9341SetBulkWrite(MX_FSMC_LCDBulkWrite);
+  ILI9341SetBulkFill(MX_FSMC_LCDBulkFill);
   /* USER CODE END 2 */
 
   /* Infinite loop */
@@ -1,871 +1,6253 @@
 #include "fonts.h"
 
-static const uint16_t FontData_07x10[] = {
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // sp
-    0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
-    0x1000, 0x0000, 0x1000, 0x0000, 0x0000, // !
-    0x2800, 0x2800, 0x2800, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // "
-    0x2400, 0x2400, 0x7C00, 0x2400, 0x4800,
-    0x7C00, 0x4800, 0x4800, 0x0000, 0x0000, // #
-    0x3800, 0x5400, 0x5000, 0x3800, 0x1400,
-    0x5400, 0x5400, 0x3800, 0x1000, 0x0000, // $
-    0x2000, 0x5400, 0x5800, 0x3000, 0x2800,
-    0x5400, 0x1400, 0x0800, 0x0000, 0x0000, // %
-    0x1000, 0x2800, 0x2800, 0x1000, 0x3400,
-    0x4800, 0x4800, 0x3400, 0x0000, 0x0000, // &
-    0x1000, 0x1000, 0x1000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // '
-    0x0800, 0x1000, 0x2000, 0x2000, 0x2000,
-    0x2000, 0x2000, 0x2000, 0x1000, 0x0800, // (
-    0x2000, 0x1000, 0x0800, 0x0800, 0x0800,
-    0x0800, 0x0800, 0x0800, 0x1000, 0x2000, // )
-    0x1000, 0x3800, 0x1000, 0x2800, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // *
-    0x0000, 0x0000, 0x1000, 0x1000, 0x7C00,
-    0x1000, 0x1000, 0x0000, 0x0000, 0x0000, // +
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x1000, 0x1000, 0x1000, // ,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x3800, 0x0000, 0x0000, 0x0000, 0x0000, // -
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x1000, 0x0000, 0x0000, // .
-    0x0800, 0x0800, 0x1000, 0x1000, 0x1000,
-    0x1000, 0x2000, 0x2000, 0x0000, 0x0000, // /
-    0x3800, 0x4400, 0x4400, 0x5400, 0x4400,
-    0x4400, 0x4400, 0x3800, 0x0000, 0x0000, // 0
-    0x1000, 0x3000, 0x5000, 0x1000, 0x1000,
-    0x1000, 0x1000, 0x1000, 0x0000, 0x0000, // 1
-    0x3800, 0x4400, 0x4400, 0x0400, 0x0800,
-    0x1000, 0x2000, 0x7C00, 0x0000, 0x0000, // 2
-    0x3800, 0x4400, 0x0400, 0x1800, 0x0400,
-    0x0400, 0x4400, 0x3800, 0x0000, 0x0000, // 3
-    0x0800, 0x1800, 0x2800, 0x2800, 0x4800,
-    0x7C00, 0x0800, 0x0800, 0x0000, 0x0000, // 4
-    0x7C00, 0x4000, 0x4000, 0x7800, 0x0400,
-    0x0400, 0x4400, 0x3800, 0x0000, 0x0000, // 5
-    0x3800, 0x4400, 0x4000, 0x7800, 0x4400,
-    0x4400, 0x4400, 0x3800, 0x0000, 0x0000, // 6
-    0x7C00, 0x0400, 0x0800, 0x1000, 0x1000,
-    0x2000, 0x2000, 0x2000, 0x0000, 0x0000, // 7
-    0x3800, 0x4400, 0x4400, 0x3800, 0x4400,
-    0x4400, 0x4400, 0x3800, 0x0000, 0x0000, // 8
-    0x3800, 0x4400, 0x4400, 0x4400, 0x3C00,
-    0x0400, 0x4400, 0x3800, 0x0000, 0x0000, // 9
-    0x0000, 0x0000, 0x1000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x1000, 0x0000, 0x0000, // :
-    0x0000, 0x0000, 0x0000, 0x1000, 0x0000,
-    0x0000, 0x0000, 0x1000, 0x1000, 0x1000, // ;
-    0x0000, 0x0000, 0x0C00, 0x3000, 0x4000,
-    0x3000, 0x0C00, 0x0000, 0x0000, 0x0000, // <
-    0x0000, 0x0000, 0x0000, 0x7C00, 0x0000,
-    0x7C00, 0x0000, 0x0000, 0x0000, 0x0000, // =
-    0x0000, 0x0000, 0x6000, 0x1800, 0x0400,
-    0x1800, 0x6000, 0x0000, 0x0000, 0x0000, // >
-    0x3800, 0x4400, 0x0400, 0x0800, 0x1000,
-    0x1000, 0x0000, 0x1000, 0x0000, 0x0000, // ?
-    0x3800, 0x4400, 0x4C00, 0x5400, 0x5C00,
-    0x4000, 0x4000, 0x3800, 0x0000, 0x0000, // @
-    0x1000, 0x2800, 0x2800, 0x2800, 0x2800,
-    0x7C00, 0x4400, 0x4400, 0x0000, 0x0000, // A
-    0x7800, 0x4400, 0x4400, 0x7800, 0x4400,
-    0x4400, 0x4400, 0x7800, 0x0000, 0x0000, // B
-    0x3800, 0x4400, 0x4000, 0x4000, 0x4000,
-    0x4000, 0x4400, 0x3800, 0x0000, 0x0000, // C
-    0x7000, 0x4800, 0x4400, 0x4400, 0x4400,
-    0x4400, 0x4800, 0x7000, 0x0000, 0x0000, // D
-    0x7C00, 0x4000, 0x4000, 0x7C00, 0x4000,
-    0x4000, 0x4000, 0x7C00, 0x0000, 0x0000, // E
-    0x7C00, 0x4000, 0x4000, 0x7800, 0x4000,
-    0x4000, 0x4000, 0x4000, 0x0000, 0x0000, // F
-    0x3800, 0x4400, 0x4000, 0x4000, 0x5C00,
-    0x4400, 0x4400, 0x3800, 0x0000, 0x0000, // G
-    0x4400, 0x4400, 0x4400, 0x7C00, 0x4400,
-    0x4400, 0x4400, 0x4400, 0x0000, 0x0000, // H
-    0x3800, 0x1000, 0x1000, 0x1000, 0x1000,
-    0x1000, 0x1000, 0x3800, 0x0000, 0x0000, // I
-    0x0400, 0x0400, 0x0400, 0x0400, 0x0400,
-    0x0400, 0x4400, 0x3800, 0x0000, 0x0000, // J
-    0x4400, 0x4800, 0x5000, 0x6000, 0x5000,
-    0x4800, 0x4800, 0x4400, 0x0000, 0x0000, // K
-    0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
-    0x4000, 0x4000, 0x7C00, 0x0000, 0x0000, // L
-    0x4400, 0x6C00, 0x6C00, 0x5400, 0x4400,
-    0x4400, 0x4400, 0x4400, 0x0000, 0x0000, // M
-    0x4400, 0x6400, 0x6400, 0x5400, 0x5400,
-    0x4C00, 0x4C00, 0x4400, 0x0000, 0x0000, // N
-    0x3800, 0x4400, 0x4400, 0x4400, 0x4400,
-    0x4400, 0x4400, 0x3800, 0x0000, 0x0000, // O
-    0x7800, 0x4400, 0x4400, 0x4400, 0x7800,
-    0x4000, 0x4000, 0x4000, 0x0000, 0x0000, // P
-    0x3800, 0x4400, 0x4400, 0x4400, 0x4400,
-    0x4400, 0x5400, 0x3800, 0x0400, 0x0000, // Q
-    0x7800, 0x4400, 0x4400, 0x4400, 0x7800,
-    0x4800, 0x4800, 0x4400, 0x0000, 0x0000, // R
-    0x3800, 0x4400, 0x4000, 0x3000, 0x0800,
-    0x0400, 0x4400, 0x3800, 0x0000, 0x0000, // S
-    0x7C00, 0x1000, 0x1000, 0x1000, 0x1000,
-    0x1000, 0x1000, 0x1000, 0x0000, 0x0000, // T
-    0x4400, 0x4400, 0x4400, 0x4400, 0x4400,
-    0x4400, 0x4400, 0x3800, 0x0000, 0x0000, // U
-    0x4400, 0x4400, 0x4400, 0x2800, 0x2800,
-    0x2800, 0x1000, 0x1000, 0x0000, 0x0000, // V
-    0x4400, 0x4400, 0x5400, 0x5400, 0x5400,
-    0x6C00, 0x2800, 0x2800, 0x0000, 0x0000, // W
-    0x4400, 0x2800, 0x2800, 0x1000, 0x1000,
-    0x2800, 0x2800, 0x4400, 0x0000, 0x0000, // X
-    0x4400, 0x4400, 0x2800, 0x2800, 0x1000,
-    0x1000, 0x1000, 0x1000, 0x0000, 0x0000, // Y
-    0x7C00, 0x0400, 0x0800, 0x1000, 0x1000,
-    0x2000, 0x4000, 0x7C00, 0x0000, 0x0000, // Z
-    0x1800, 0x1000, 0x1000, 0x1000, 0x1000,
-    0x1000, 0x1000, 0x1000, 0x1000, 0x1800, // [
-    0x2000, 0x2000, 0x1000, 0x1000, 0x1000,
-    0x1000, 0x0800, 0x0800, 0x0000, 0x0000, /* \ */
-    0x3000, 0x1000, 0x1000, 0x1000, 0x1000,
-    0x1000, 0x1000, 0x1000, 0x1000, 0x3000, // ]
-    0x1000, 0x2800, 0x2800, 0x4400, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // ^
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xFE00, // _
-    0x2000, 0x1000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // `
-    0x0000, 0x0000, 0x3800, 0x4400, 0x3C00,
-    0x4400, 0x4C00, 0x3400, 0x0000, 0x0000, // a
-    0x4000, 0x4000, 0x5800, 0x6400, 0x4400,
-    0x4400, 0x6400, 0x5800, 0x0000, 0x0000, // b
-    0x0000, 0x0000, 0x3800, 0x4400, 0x4000,
-    0x4000, 0x4400, 0x3800, 0x0000, 0x0000, // c
-    0x0400, 0x0400, 0x3400, 0x4C00, 0x4400,
-    0x4400, 0x4C00, 0x3400, 0x0000, 0x0000, // d
-    0x0000, 0x0000, 0x3800, 0x4400, 0x7C00,
-    0x4000, 0x4400, 0x3800, 0x0000, 0x0000, // e
-    0x0C00, 0x1000, 0x7C00, 0x1000, 0x1000,
-    0x1000, 0x1000, 0x1000, 0x0000, 0x0000, // f
-    0x0000, 0x0000, 0x3400, 0x4C00, 0x4400,
-    0x4400, 0x4C00, 0x3400, 0x0400, 0x7800, // g
-    0x4000, 0x4000, 0x5800, 0x6400, 0x4400,
-    0x4400, 0x4400, 0x4400, 0x0000, 0x0000, // h
-    0x1000, 0x0000, 0x7000, 0x1000, 0x1000,
-    0x1000, 0x1000, 0x1000, 0x0000, 0x0000, // i
-    0x1000, 0x0000, 0x7000, 0x1000, 0x1000,
-    0x1000, 0x1000, 0x1000, 0x1000, 0xE000, // j
-    0x4000, 0x4000, 0x4800, 0x5000, 0x6000,
-    0x5000, 0x4800, 0x4400, 0x0000, 0x0000, // k
-    0x7000, 0x1000, 0x1000, 0x1000, 0x1000,
-    0x1000, 0x1000, 0x1000, 0x0000, 0x0000, // l
-    0x0000, 0x0000, 0x7800, 0x5400, 0x5400,
-    0x5400, 0x5400, 0x5400, 0x0000, 0x0000, // m
-    0x0000, 0x0000, 0x5800, 0x6400, 0x4400,
-    0x4400, 0x4400, 0x4400, 0x0000, 0x0000, // n
-    0x0000, 0x0000, 0x3800, 0x4400, 0x4400,
-    0x4400, 0x4400, 0x3800, 0x0000, 0x0000, // o
-    0x0000, 0x0000, 0x5800, 0x6400, 0x4400,
-    0x4400, 0x6400, 0x5800, 0x4000, 0x4000, // p
-    0x0000, 0x0000, 0x3400, 0x4C00, 0x4400,
-    0x4400, 0x4C00, 0x3400, 0x0400, 0x0400, // q
-    0x0000, 0x0000, 0x5800, 0x6400, 0x4000,
-    0x4000, 0x4000, 0x4000, 0x0000, 0x0000, // r
-    0x0000, 0x0000, 0x3800, 0x4400, 0x3000,
-    0x0800, 0x4400, 0x3800, 0x0000, 0x0000, // s
-    0x2000, 0x2000, 0x7800, 0x2000, 0x2000,
-    0x2000, 0x2000, 0x1800, 0x0000, 0x0000, // t
-    0x0000, 0x0000, 0x4400, 0x4400, 0x4400,
-    0x4400, 0x4C00, 0x3400, 0x0000, 0x0000, // u
-    0x0000, 0x0000, 0x4400, 0x4400, 0x2800,
-    0x2800, 0x2800, 0x1000, 0x0000, 0x0000, // v
-    0x0000, 0x0000, 0x5400, 0x5400, 0x5400,
-    0x6C00, 0x2800, 0x2800, 0x0000, 0x0000, // w
-    0x0000, 0x0000, 0x4400, 0x2800, 0x1000,
-    0x1000, 0x2800, 0x4400, 0x0000, 0x0000, // x
-    0x0000, 0x0000, 0x4400, 0x4400, 0x2800,
-    0x2800, 0x1000, 0x1000, 0x1000, 0x6000, // y
-    0x0000, 0x0000, 0x7C00, 0x0800, 0x1000,
-    0x2000, 0x4000, 0x7C00, 0x0000, 0x0000, // z
-    0x1800, 0x1000, 0x1000, 0x1000, 0x2000,
-    0x2000, 0x1000, 0x1000, 0x1000, 0x1800, // {
-    0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
-    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, // |
-    0x3000, 0x1000, 0x1000, 0x1000, 0x0800,
-    0x0800, 0x1000, 0x1000, 0x1000, 0x3000, // }
-    0x0000, 0x0000, 0x0000, 0x7400, 0x4C00,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // ~
+static const uint8_t FontBitmap_07x10[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // sp
+    0x10, 0x20, 0x40, 0x81, 0x02, 0x00, 0x08, 0x00, 0x00, // !
+    0x28, 0x50, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // "
+    0x24, 0x49, 0xF1, 0x24, 0x8F, 0x92, 0x24, 0x00, 0x00, // #
+    0x38, 0xA9, 0x41, 0xC1, 0x4A, 0x95, 0x1C, 0x10, 0x00, // $
+    0x20, 0xA9, 0x61, 0x82, 0x8A, 0x85, 0x04, 0x00, 0x00, // %
+    0x10, 0x50, 0xA0, 0x83, 0x49, 0x12, 0x1A, 0x00, 0x00, // &
+    0x10, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '
+    0x08, 0x20, 0x81, 0x02, 0x04, 0x08, 0x10, 0x10, 0x10, // (
+    0x20, 0x20, 0x20, 0x40, 0x81, 0x02, 0x04, 0x10, 0x40, // )
+    0x10, 0x70, 0x41, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, // *
+    0x00, 0x00, 0x40, 0x87, 0xC2, 0x04, 0x00, 0x00, 0x00, // +
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x20, // ,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, // -
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, // .
+    0x08, 0x10, 0x40, 0x81, 0x02, 0x08, 0x10, 0x00, 0x00, // /
+    0x38, 0x89, 0x12, 0xA4, 0x48, 0x91, 0x1C, 0x00, 0x00, // 0
+    0x10, 0x61, 0x40, 0x81, 0x02, 0x04, 0x08, 0x00, 0x00, // 1
+    0x38, 0x89, 0x10, 0x20, 0x82, 0x08, 0x3E, 0x00, 0x00, // 2
+    0x38, 0x88, 0x10, 0xC0, 0x40, 0x91, 0x1C, 0x00, 0x00, // 3
+    0x08, 0x30, 0xA1, 0x44, 0x8F, 0x82, 0x04, 0x00, 0x00, // 4
+    0x7C, 0x81, 0x03, 0xC0, 0x40, 0x91, 0x1C, 0x00, 0x00, // 5
+    0x38, 0x89, 0x03, 0xC4, 0x48, 0x91, 0x1C, 0x00, 0x00, // 6
+    0x7C, 0x08, 0x20, 0x81, 0x04, 0x08, 0x10, 0x00, 0x00, // 7
+    0x38, 0x89, 0x11, 0xC4, 0x48, 0x91, 0x1C, 0x00, 0x00, // 8
+    0x38, 0x89, 0x12, 0x23, 0xC0, 0x91, 0x1C, 0x00, 0x00, // 9
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, // :
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x08, 0x10, 0x20, // ;
+    0x00, 0x00, 0x31, 0x84, 0x06, 0x03, 0x00, 0x00, 0x00, // <
+    0x00, 0x00, 0x03, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, // =
+    0x00, 0x01, 0x80, 0xC0, 0x43, 0x18, 0x00, 0x00, 0x00, // >
+    0x38, 0x88, 0x10, 0x41, 0x02, 0x00, 0x08, 0x00, 0x00, // ?
+    0x38, 0x89, 0x32, 0xA5, 0xC8, 0x10, 0x1C, 0x00, 0x00, // @
+    0x10, 0x50, 0xA1, 0x42, 0x8F, 0x91, 0x22, 0x00, 0x00, // A
+    0x78, 0x89, 0x13, 0xC4, 0x48, 0x91, 0x3C, 0x00, 0x00, // B
+    0x38, 0x89, 0x02, 0x04, 0x08, 0x11, 0x1C, 0x00, 0x00, // C
+    0x70, 0x91, 0x12, 0x24, 0x48, 0x92, 0x38, 0x00, 0x00, // D
+    0x7C, 0x81, 0x03, 0xE4, 0x08, 0x10, 0x3E, 0x00, 0x00, // E
+    0x7C, 0x81, 0x03, 0xC4, 0x08, 0x10, 0x20, 0x00, 0x00, // F
+    0x38, 0x89, 0x02, 0x05, 0xC8, 0x91, 0x1C, 0x00, 0x00, // G
+    0x44, 0x89, 0x13, 0xE4, 0x48, 0x91, 0x22, 0x00, 0x00, // H
+    0x38, 0x20, 0x40, 0x81, 0x02, 0x04, 0x1C, 0x00, 0x00, // I
+    0x04, 0x08, 0x10, 0x20, 0x40, 0x91, 0x1C, 0x00, 0x00, // J
+    0x44, 0x91, 0x43, 0x05, 0x09, 0x12, 0x22, 0x00, 0x00, // K
+    0x40, 0x81, 0x02, 0x04, 0x08, 0x10, 0x3E, 0x00, 0x00, // L
+    0x44, 0xD9, 0xB2, 0xA4, 0x48, 0x91, 0x22, 0x00, 0x00, // M
+    0x44, 0xC9, 0x92, 0xA5, 0x49, 0x93, 0x22, 0x00, 0x00, // N
+    0x38, 0x89, 0x12, 0x24, 0x48, 0x91, 0x1C, 0x00, 0x00, // O
+    0x78, 0x89, 0x12, 0x27, 0x88, 0x10, 0x20, 0x00, 0x00, // P
+    0x38, 0x89, 0x12, 0x24, 0x48, 0x95, 0x1C, 0x04, 0x00, // Q
+    0x78, 0x89, 0x12, 0x27, 0x89, 0x12, 0x22, 0x00, 0x00, // R
+    0x38, 0x89, 0x01, 0x80, 0x80, 0x91, 0x1C, 0x00, 0x00, // S
+    0x7C, 0x20, 0x40, 0x81, 0x02, 0x04, 0x08, 0x00, 0x00, // T
+    0x44, 0x89, 0x12, 0x24, 0x48, 0x91, 0x1C, 0x00, 0x00, // U
+    0x44, 0x89, 0x11, 0x42, 0x85, 0x04, 0x08, 0x00, 0x00, // V
+    0x44, 0x89, 0x52, 0xA5, 0x4D, 0x8A, 0x14, 0x00, 0x00, // W
+    0x44, 0x50, 0xA0, 0x81, 0x05, 0x0A, 0x22, 0x00, 0x00, // X
+    0x44, 0x88, 0xA1, 0x41, 0x02, 0x04, 0x08, 0x00, 0x00, // Y
+    0x7C, 0x08, 0x20, 0x81, 0x04, 0x10, 0x3E, 0x00, 0x00, // Z
+    0x18, 0x20, 0x40, 0x81, 0x02, 0x04, 0x08, 0x10, 0x30, // [
+    0x20, 0x40, 0x40, 0x81, 0x02, 0x02, 0x04, 0x00, 0x00, /* \ */
+    0x30, 0x20, 0x40, 0x81, 0x02, 0x04, 0x08, 0x10, 0x60, // ]
+    0x10, 0x50, 0xA2, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, // ^
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, // _
+    0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // `
+    0x00, 0x00, 0xE2, 0x23, 0xC8, 0x93, 0x1A, 0x00, 0x00, // a
+    0x40, 0x81, 0x63, 0x24, 0x48, 0x99, 0x2C, 0x00, 0x00, // b
+    0x00, 0x00, 0xE2, 0x24, 0x08, 0x11, 0x1C, 0x00, 0x00, // c
+    0x04, 0x08, 0xD2, 0x64, 0x48, 0x93, 0x1A, 0x00, 0x00, // d
+    0x00, 0x00, 0xE2, 0x27, 0xC8, 0x11, 0x1C, 0x00, 0x00, // e
+    0x0C, 0x21, 0xF0, 0x81, 0x02, 0x04, 0x08, 0x00, 0x00, // f
+    0x00, 0x00, 0xD2, 0x64, 0x48, 0x93, 0x1A, 0x04, 0xF0, // g
+    0x40, 0x81, 0x63, 0x24, 0x48, 0x91, 0x22, 0x00, 0x00, // h
+    0x10, 0x01, 0xC0, 0x81, 0x02, 0x04, 0x08, 0x00, 0x00, // i
+    0x10, 0x01, 0xC0, 0x81, 0x02, 0x04, 0x08, 0x11, 0xC0, // j
+    0x40, 0x81, 0x22, 0x86, 0x0A, 0x12, 0x22, 0x00, 0x00, // k
+    0x70, 0x20, 0x40, 0x81, 0x02, 0x04, 0x08, 0x00, 0x00, // l
+    0x00, 0x01, 0xE2, 0xA5, 0x4A, 0x95, 0x2A, 0x00, 0x00, // m
+    0x00, 0x01, 0x63, 0x24, 0x48, 0x91, 0x22, 0x00, 0x00, // n
+    0x00, 0x00, 0xE2, 0x24, 0x48, 0x91, 0x1C, 0x00, 0x00, // o
+    0x00, 0x01, 0x63, 0x24, 0x48, 0x99, 0x2C, 0x40, 0x80, // p
+    0x00, 0x00, 0xD2, 0x64, 0x48, 0x93, 0x1A, 0x04, 0x08, // q
+    0x00, 0x01, 0x63, 0x24, 0x08, 0x10, 0x20, 0x00, 0x00, // r
+    0x00, 0x00, 0xE2, 0x23, 0x01, 0x11, 0x1C, 0x00, 0x00, // s
+    0x20, 0x41, 0xE1, 0x02, 0x04, 0x08, 0x0C, 0x00, 0x00, // t
+    0x00, 0x01, 0x12, 0x24, 0x48, 0x93, 0x1A, 0x00, 0x00, // u
+    0x00, 0x01, 0x12, 0x22, 0x85, 0x0A, 0x08, 0x00, 0x00, // v
+    0x00, 0x01, 0x52, 0xA5, 0x4D, 0x8A, 0x14, 0x00, 0x00, // w
+    0x00, 0x01, 0x11, 0x41, 0x02, 0x0A, 0x22, 0x00, 0x00, // x
+    0x00, 0x01, 0x12, 0x22, 0x85, 0x04, 0x08, 0x10, 0xC0, // y
+    0x00, 0x01, 0xF0, 0x41, 0x04, 0x10, 0x3E, 0x00, 0x00, // z
+    0x18, 0x20, 0x40, 0x82, 0x04, 0x04, 0x08, 0x10, 0x30, // {
+    0x10, 0x20, 0x40, 0x81, 0x02, 0x04, 0x08, 0x10, 0x20, // |
+    0x30, 0x20, 0x40, 0x80, 0x81, 0x04, 0x08, 0x10, 0x60, // }
+    0x00, 0x00, 0x03, 0xA4, 0xC0, 0x00, 0x00, 0x00, 0x00, // ~
+    0x00, 0x00
 };
 
-static const uint16_t FontData_11x18[] = {
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // sp
-    0x0000, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00,
-    0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00,
-    0x0000, 0x0C00, 0x0C00, 0x0000, 0x0000, 0x0000, // !
-    0x0000, 0x1B00, 0x1B00, 0x1B00, 0x1B00, 0x1B00,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // "
-    0x0000, 0x1980, 0x1980, 0x1980, 0x1980, 0x7FC0,
-    0x7FC0, 0x1980, 0x3300, 0x7FC0, 0x7FC0, 0x3300,
-    0x3300, 0x3300, 0x3300, 0x0000, 0x0000, 0x0000, // #
-    0x0000, 0x1E00, 0x3F00, 0x7580, 0x6580, 0x7400,
-    0x3C00, 0x1E00, 0x0700, 0x0580, 0x6580, 0x6580,
-    0x7580, 0x3F00, 0x1E00, 0x0400, 0x0400, 0x0000, // $
-    0x0000, 0x7000, 0xD800, 0xD840, 0xD8C0, 0xD980,
-    0x7300, 0x0600, 0x0C00, 0x1B80, 0x36C0, 0x66C0,
-    0x46C0, 0x06C0, 0x0380, 0x0000, 0x0000, 0x0000, // %
-    0x0000, 0x1E00, 0x3F00, 0x3300, 0x3300, 0x3300,
-    0x1E00, 0x0C00, 0x3CC0, 0x66C0, 0x6380, 0x6180,
-    0x6380, 0x3EC0, 0x1C80, 0x0000, 0x0000, 0x0000, // &
-    0x0000, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // '
-    0x0080, 0x0100, 0x0300, 0x0600, 0x0600, 0x0400,
-    0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00,
-    0x0400, 0x0600, 0x0600, 0x0300, 0x0100, 0x0080, // (
-    0x2000, 0x1000, 0x1800, 0x0C00, 0x0C00, 0x0400,
-    0x0600, 0x0600, 0x0600, 0x0600, 0x0600, 0x0600,
-    0x0400, 0x0C00, 0x0C00, 0x1800, 0x1000, 0x2000, // )
-    0x0000, 0x0C00, 0x2D00, 0x3F00, 0x1E00, 0x3300,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // *
-    0x0000, 0x0000, 0x0000, 0x0C00, 0x0C00, 0x0C00,
-    0x0C00, 0xFFC0, 0xFFC0, 0x0C00, 0x0C00, 0x0C00,
-    0x0C00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // +
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0C00, 0x0C00, 0x0400, 0x0400, 0x0800, // ,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1E00, 0x1E00, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // -
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0C00, 0x0C00, 0x0000, 0x0000, 0x0000, // .
-    0x0000, 0x0300, 0x0300, 0x0300, 0x0600, 0x0600,
-    0x0600, 0x0600, 0x0C00, 0x0C00, 0x0C00, 0x0C00,
-    0x1800, 0x1800, 0x1800, 0x0000, 0x0000, 0x0000, // /
-    0x0000, 0x1E00, 0x3F00, 0x3300, 0x6180, 0x6180,
-    0x6180, 0x6D80, 0x6D80, 0x6180, 0x6180, 0x6180,
-    0x3300, 0x3F00, 0x1E00, 0x0000, 0x0000, 0x0000, // 0
-    0x0000, 0x0600, 0x0E00, 0x1E00, 0x3600, 0x2600,
-    0x0600, 0x0600, 0x0600, 0x0600, 0x0600, 0x0600,
-    0x0600, 0x0600, 0x0600, 0x0000, 0x0000, 0x0000, // 1
-    0x0000, 0x1E00, 0x3F00, 0x7380, 0x6180, 0x6180,
-    0x0180, 0x0300, 0x0600, 0x0C00, 0x1800, 0x3000,
-    0x6000, 0x7F80, 0x7F80, 0x0000, 0x0000, 0x0000, // 2
-    0x0000, 0x1C00, 0x3E00, 0x6300, 0x6300, 0x0300,
-    0x0E00, 0x0E00, 0x0300, 0x0180, 0x0180, 0x6180,
-    0x7380, 0x3F00, 0x1E00, 0x0000, 0x0000, 0x0000, // 3
-    0x0000, 0x0600, 0x0E00, 0x0E00, 0x1E00, 0x1E00,
-    0x1600, 0x3600, 0x3600, 0x6600, 0x7F80, 0x7F80,
-    0x0600, 0x0600, 0x0600, 0x0000, 0x0000, 0x0000, // 4
-    0x0000, 0x7F00, 0x7F00, 0x6000, 0x6000, 0x6000,
-    0x6E00, 0x7F00, 0x6380, 0x0180, 0x0180, 0x6180,
-    0x7380, 0x3F00, 0x1E00, 0x0000, 0x0000, 0x0000, // 5
-    0x0000, 0x1E00, 0x3F00, 0x3380, 0x6180, 0x6000,
-    0x6E00, 0x7F00, 0x7380, 0x6180, 0x6180, 0x6180,
-    0x3380, 0x3F00, 0x1E00, 0x0000, 0x0000, 0x0000, // 6
-    0x0000, 0x7F80, 0x7F80, 0x0180, 0x0300, 0x0300,
-    0x0600, 0x0600, 0x0C00, 0x0C00, 0x0C00, 0x0800,
-    0x1800, 0x1800, 0x1800, 0x0000, 0x0000, 0x0000, // 7
-    0x0000, 0x1E00, 0x3F00, 0x6380, 0x6180, 0x6180,
-    0x2100, 0x1E00, 0x3F00, 0x6180, 0x6180, 0x6180,
-    0x6180, 0x3F00, 0x1E00, 0x0000, 0x0000, 0x0000, // 8
-    0x0000, 0x1E00, 0x3F00, 0x7300, 0x6180, 0x6180,
-    0x6180, 0x7380, 0x3F80, 0x1D80, 0x0180, 0x6180,
-    0x7300, 0x3F00, 0x1E00, 0x0000, 0x0000, 0x0000, // 9
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0C00,
-    0x0C00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0C00, 0x0C00, 0x0000, 0x0000, 0x0000, // :
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0C00, 0x0C00, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0C00, 0x0C00, 0x0400, 0x0400, 0x0800, // ;
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x0380,
-    0x0E00, 0x3800, 0x6000, 0x3800, 0x0E00, 0x0380,
-    0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // <
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7F80,
-    0x7F80, 0x0000, 0x0000, 0x7F80, 0x7F80, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // =
-    0x0000, 0x0000, 0x0000, 0x0000, 0x4000, 0x7000,
-    0x1C00, 0x0700, 0x0180, 0x0700, 0x1C00, 0x7000,
-    0x4000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // >
-    0x0000, 0x1F00, 0x3F80, 0x71C0, 0x60C0, 0x00C0,
-    0x01C0, 0x0380, 0x0700, 0x0E00, 0x0C00, 0x0C00,
-    0x0000, 0x0C00, 0x0C00, 0x0000, 0x0000, 0x0000, // ?
-    0x0000, 0x1E00, 0x3F00, 0x3180, 0x7180, 0x6380,
-    0x6F80, 0x6D80, 0x6D80, 0x6F80, 0x6780, 0x6000,
-    0x3200, 0x3E00, 0x1C00, 0x0000, 0x0000, 0x0000, // @
-    0x0000, 0x0E00, 0x0E00, 0x1B00, 0x1B00, 0x1B00,
-    0x1B00, 0x3180, 0x3180, 0x3F80, 0x3F80, 0x3180,
-    0x60C0, 0x60C0, 0x60C0, 0x0000, 0x0000, 0x0000, // A
-    0x0000, 0x7C00, 0x7E00, 0x6300, 0x6300, 0x6300,
-    0x6300, 0x7E00, 0x7E00, 0x6300, 0x6180, 0x6180,
-    0x6380, 0x7F00, 0x7E00, 0x0000, 0x0000, 0x0000, // B
-    0x0000, 0x1E00, 0x3F00, 0x3180, 0x6180, 0x6000,
-    0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6180,
-    0x3180, 0x3F00, 0x1E00, 0x0000, 0x0000, 0x0000, // C
-    0x0000, 0x7C00, 0x7F00, 0x6300, 0x6380, 0x6180,
-    0x6180, 0x6180, 0x6180, 0x6180, 0x6180, 0x6300,
-    0x6300, 0x7E00, 0x7C00, 0x0000, 0x0000, 0x0000, // D
-    0x0000, 0x7F80, 0x7F80, 0x6000, 0x6000, 0x6000,
-    0x6000, 0x7F00, 0x7F00, 0x6000, 0x6000, 0x6000,
-    0x6000, 0x7F80, 0x7F80, 0x0000, 0x0000, 0x0000, // E
-    0x0000, 0x7F80, 0x7F80, 0x6000, 0x6000, 0x6000,
-    0x6000, 0x7F00, 0x7F00, 0x6000, 0x6000, 0x6000,
-    0x6000, 0x6000, 0x6000, 0x0000, 0x0000, 0x0000, // F
-    0x0000, 0x1E00, 0x3F00, 0x3180, 0x6180, 0x6000,
-    0x6000, 0x6000, 0x6380, 0x6380, 0x6180, 0x6180,
-    0x3180, 0x3F80, 0x1E00, 0x0000, 0x0000, 0x0000, // G
-    0x0000, 0x6180, 0x6180, 0x6180, 0x6180, 0x6180,
-    0x6180, 0x7F80, 0x7F80, 0x6180, 0x6180, 0x6180,
-    0x6180, 0x6180, 0x6180, 0x0000, 0x0000, 0x0000, // H
-    0x0000, 0x3F00, 0x3F00, 0x0C00, 0x0C00, 0x0C00,
-    0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00,
-    0x0C00, 0x3F00, 0x3F00, 0x0000, 0x0000, 0x0000, // I
-    0x0000, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
-    0x0180, 0x0180, 0x0180, 0x0180, 0x6180, 0x6180,
-    0x7380, 0x3F00, 0x1E00, 0x0000, 0x0000, 0x0000, // J
-    0x0000, 0x60C0, 0x6180, 0x6300, 0x6600, 0x6600,
-    0x6C00, 0x7800, 0x7C00, 0x6600, 0x6600, 0x6300,
-    0x6180, 0x6180, 0x60C0, 0x0000, 0x0000, 0x0000, // K
-    0x0000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000,
-    0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000,
-    0x6000, 0x7F80, 0x7F80, 0x0000, 0x0000, 0x0000, // L
-    0x0000, 0x71C0, 0x71C0, 0x7BC0, 0x7AC0, 0x6AC0,
-    0x6AC0, 0x6EC0, 0x64C0, 0x60C0, 0x60C0, 0x60C0,
-    0x60C0, 0x60C0, 0x60C0, 0x0000, 0x0000, 0x0000, // M
-    0x0000, 0x7180, 0x7180, 0x7980, 0x7980, 0x7980,
-    0x6D80, 0x6D80, 0x6D80, 0x6580, 0x6780, 0x6780,
-    0x6780, 0x6380, 0x6380, 0x0000, 0x0000, 0x0000, // N
-    0x0000, 0x1E00, 0x3F00, 0x3300, 0x6180, 0x6180,
-    0x6180, 0x6180, 0x6180, 0x6180, 0x6180, 0x6180,
-    0x3300, 0x3F00, 0x1E00, 0x0000, 0x0000, 0x0000, // O
-    0x0000, 0x7E00, 0x7F00, 0x6380, 0x6180, 0x6180,
-    0x6180, 0x6380, 0x7F00, 0x7E00, 0x6000, 0x6000,
-    0x6000, 0x6000, 0x6000, 0x0000, 0x0000, 0x0000, // P
-    0x0000, 0x1E00, 0x3F00, 0x3300, 0x6180, 0x6180,
-    0x6180, 0x6180, 0x6180, 0x6180, 0x6580, 0x6780,
-    0x3300, 0x3F80, 0x1E40, 0x0000, 0x0000, 0x0000, // Q
-    0x0000, 0x7E00, 0x7F00, 0x6380, 0x6180, 0x6180,
-    0x6380, 0x7F00, 0x7E00, 0x6600, 0x6300, 0x6300,
-    0x6180, 0x6180, 0x60C0, 0x0000, 0x0000, 0x0000, // R
-    0x0000, 0x0E00, 0x1F00, 0x3180, 0x3180, 0x3000,
-    0x3800, 0x1E00, 0x0700, 0x0380, 0x6180, 0x6180,
-    0x3180, 0x3F00, 0x1E00, 0x0000, 0x0000, 0x0000, // S
-    0x0000, 0xFFC0, 0xFFC0, 0x0C00, 0x0C00, 0x0C00,
-    0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00,
-    0x0C00, 0x0C00, 0x0C00, 0x0000, 0x0000, 0x0000, // T
-    0x0000, 0x6180, 0x6180, 0x6180, 0x6180, 0x6180,
-    0x6180, 0x6180, 0x6180, 0x6180, 0x6180, 0x6180,
-    0x7380, 0x3F00, 0x1E00, 0x0000, 0x0000, 0x0000, // U
-    0x0000, 0x60C0, 0x60C0, 0x60C0, 0x3180, 0x3180,
-    0x3180, 0x1B00, 0x1B00, 0x1B00, 0x1B00, 0x0E00,
-    0x0E00, 0x0E00, 0x0400, 0x0000, 0x0000, 0x0000, // V
-    0x0000, 0xC0C0, 0xC0C0, 0xC0C0, 0xC0C0, 0xC0C0,
-    0xCCC0, 0x4C80, 0x4C80, 0x5E80, 0x5280, 0x5280,
-    0x7380, 0x6180, 0x6180, 0x0000, 0x0000, 0x0000, // W
-    0x0000, 0xC0C0, 0x6080, 0x6180, 0x3300, 0x3B00,
-    0x1E00, 0x0C00, 0x0C00, 0x1E00, 0x1F00, 0x3B00,
-    0x7180, 0x6180, 0xC0C0, 0x0000, 0x0000, 0x0000, // X
-    0x0000, 0xC0C0, 0x6180, 0x6180, 0x3300, 0x3300,
-    0x1E00, 0x1E00, 0x0C00, 0x0C00, 0x0C00, 0x0C00,
-    0x0C00, 0x0C00, 0x0C00, 0x0000, 0x0000, 0x0000, // Y
-    0x0000, 0x3F80, 0x3F80, 0x0180, 0x0300, 0x0300,
-    0x0600, 0x0C00, 0x0C00, 0x1800, 0x1800, 0x3000,
-    0x6000, 0x7F80, 0x7F80, 0x0000, 0x0000, 0x0000, // Z
-    0x0F00, 0x0F00, 0x0C00, 0x0C00, 0x0C00, 0x0C00,
-    0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00,
-    0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0F00, 0x0F00, // [
-    0x0000, 0x1800, 0x1800, 0x1800, 0x0C00, 0x0C00,
-    0x0C00, 0x0C00, 0x0600, 0x0600, 0x0600, 0x0600,
-    0x0300, 0x0300, 0x0300, 0x0000, 0x0000, 0x0000, /* \ */
-    0x1E00, 0x1E00, 0x0600, 0x0600, 0x0600, 0x0600,
-    0x0600, 0x0600, 0x0600, 0x0600, 0x0600, 0x0600,
-    0x0600, 0x0600, 0x0600, 0x0600, 0x1E00, 0x1E00, // ]
-    0x0000, 0x0C00, 0x0C00, 0x1E00, 0x1200, 0x3300,
-    0x3300, 0x6180, 0x6180, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // ^
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0x0000, // _
-    0x0000, 0x3800, 0x1800, 0x0C00, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // `
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F00,
-    0x3F80, 0x6180, 0x0180, 0x1F80, 0x3F80, 0x6180,
-    0x6380, 0x7F80, 0x38C0, 0x0000, 0x0000, 0x0000, // a
-    0x0000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6E00,
-    0x7F00, 0x7380, 0x6180, 0x6180, 0x6180, 0x6180,
-    0x7380, 0x7F00, 0x6E00, 0x0000, 0x0000, 0x0000, // b
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1E00,
-    0x3F00, 0x7380, 0x6180, 0x6000, 0x6000, 0x6180,
-    0x7380, 0x3F00, 0x1E00, 0x0000, 0x0000, 0x0000, // c
-    0x0000, 0x0180, 0x0180, 0x0180, 0x0180, 0x1D80,
-    0x3F80, 0x7380, 0x6180, 0x6180, 0x6180, 0x6180,
-    0x7380, 0x3F80, 0x1D80, 0x0000, 0x0000, 0x0000, // d
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1E00,
-    0x3F00, 0x7300, 0x6180, 0x7F80, 0x7F80, 0x6000,
-    0x7180, 0x3F00, 0x1E00, 0x0000, 0x0000, 0x0000, // e
-    0x0000, 0x07C0, 0x0FC0, 0x0C00, 0x0C00, 0x7F80,
-    0x7F80, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00,
-    0x0C00, 0x0C00, 0x0C00, 0x0000, 0x0000, 0x0000, // f
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1D80, 0x3F80,
-    0x7380, 0x6180, 0x6180, 0x6180, 0x6180, 0x7380,
-    0x3F80, 0x1D80, 0x0180, 0x6380, 0x7F00, 0x3E00, // g
-    0x0000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6F00,
-    0x7F80, 0x7180, 0x6180, 0x6180, 0x6180, 0x6180,
-    0x6180, 0x6180, 0x6180, 0x0000, 0x0000, 0x0000, // h
-    0x0000, 0x0600, 0x0600, 0x0000, 0x0000, 0x3E00,
-    0x3E00, 0x0600, 0x0600, 0x0600, 0x0600, 0x0600,
-    0x0600, 0x0600, 0x0600, 0x0000, 0x0000, 0x0000, // i
-    0x0600, 0x0600, 0x0000, 0x0000, 0x3E00, 0x3E00,
-    0x0600, 0x0600, 0x0600, 0x0600, 0x0600, 0x0600,
-    0x0600, 0x0600, 0x0600, 0x4600, 0x7E00, 0x3C00, // j
-    0x0000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6180,
-    0x6300, 0x6600, 0x6C00, 0x7C00, 0x7600, 0x6300,
-    0x6300, 0x6180, 0x60C0, 0x0000, 0x0000, 0x0000, // k
-    0x0000, 0x3E00, 0x3E00, 0x0600, 0x0600, 0x0600,
-    0x0600, 0x0600, 0x0600, 0x0600, 0x0600, 0x0600,
-    0x0600, 0x0600, 0x0600, 0x0000, 0x0000, 0x0000, // l
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDD80,
-    0xFFC0, 0xCEC0, 0xCCC0, 0xCCC0, 0xCCC0, 0xCCC0,
-    0xCCC0, 0xCCC0, 0xCCC0, 0x0000, 0x0000, 0x0000, // m
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6F00,
-    0x7F80, 0x7180, 0x6180, 0x6180, 0x6180, 0x6180,
-    0x6180, 0x6180, 0x6180, 0x0000, 0x0000, 0x0000, // n
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1E00,
-    0x3F00, 0x7380, 0x6180, 0x6180, 0x6180, 0x6180,
-    0x7380, 0x3F00, 0x1E00, 0x0000, 0x0000, 0x0000, // o
-    0x0000, 0x0000, 0x0000, 0x0000, 0x6E00, 0x7F00,
-    0x7380, 0x6180, 0x6180, 0x6180, 0x6180, 0x7380,
-    0x7F00, 0x6E00, 0x6000, 0x6000, 0x6000, 0x6000, // p
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1D80, 0x3F80,
-    0x7380, 0x6180, 0x6180, 0x6180, 0x6180, 0x7380,
-    0x3F80, 0x1D80, 0x0180, 0x0180, 0x0180, 0x0180, // q
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6700,
-    0x3F80, 0x3900, 0x3000, 0x3000, 0x3000, 0x3000,
-    0x3000, 0x3000, 0x3000, 0x0000, 0x0000, 0x0000, // r
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1E00,
-    0x3F80, 0x6180, 0x6000, 0x7F00, 0x3F80, 0x0180,
-    0x6180, 0x7F00, 0x1E00, 0x0000, 0x0000, 0x0000, // s
-    0x0000, 0x0000, 0x0800, 0x1800, 0x1800, 0x7F00,
-    0x7F00, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,
-    0x1800, 0x1F80, 0x0F80, 0x0000, 0x0000, 0x0000, // t
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6180,
-    0x6180, 0x6180, 0x6180, 0x6180, 0x6180, 0x6180,
-    0x6380, 0x7F80, 0x3D80, 0x0000, 0x0000, 0x0000, // u
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x60C0,
-    0x3180, 0x3180, 0x3180, 0x1B00, 0x1B00, 0x1B00,
-    0x0E00, 0x0E00, 0x0600, 0x0000, 0x0000, 0x0000, // v
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDD80,
-    0xDD80, 0xDD80, 0x5500, 0x5500, 0x5500, 0x7700,
-    0x7700, 0x2200, 0x2200, 0x0000, 0x0000, 0x0000, // w
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6180,
-    0x3300, 0x3300, 0x1E00, 0x0C00, 0x0C00, 0x1E00,
-    0x3300, 0x3300, 0x6180, 0x0000, 0x0000, 0x0000, // x
-    0x0000, 0x0000, 0x0000, 0x0000, 0x6180, 0x6180,
-    0x3180, 0x3300, 0x3300, 0x1B00, 0x1B00, 0x1B00,
-    0x0E00, 0x0E00, 0x0E00, 0x1C00, 0x7C00, 0x7000, // y
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7FC0,
-    0x7FC0, 0x0180, 0x0300, 0x0600, 0x0C00, 0x1800,
-    0x3000, 0x7FC0, 0x7FC0, 0x0000, 0x0000, 0x0000, // z
-    0x0380, 0x0780, 0x0600, 0x0600, 0x0600, 0x0600,
-    0x0600, 0x0E00, 0x1C00, 0x1C00, 0x0E00, 0x0600,
-    0x0600, 0x0600, 0x0600, 0x0600, 0x0780, 0x0380, // {
-    0x0600, 0x0600, 0x0600, 0x0600, 0x0600, 0x0600,
-    0x0600, 0x0600, 0x0600, 0x0600, 0x0600, 0x0600,
-    0x0600, 0x0600, 0x0600, 0x0600, 0x0600, 0x0600, // |
-    0x3800, 0x3C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00,
-    0x0C00, 0x0E00, 0x0700, 0x0700, 0x0E00, 0x0C00,
-    0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x3C00, 0x3800, // }
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x3880, 0x7F80, 0x4700, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // ~
+static const uint16_t FontOffset_07x10[] = {
+    0, 9, 18, 27, 36, 45, 54, 63, 72, 81, 90, 99,
+    108, 117, 126, 135, 144, 153, 162, 171, 180, 189, 198, 207,
+    216, 225, 234, 243, 252, 261, 270, 279, 288, 297, 306, 315,
+    324, 333, 342, 351, 360, 369, 378, 387, 396, 405, 414, 423,
+    432, 441, 450, 459, 468, 477, 486, 495, 504, 513, 522, 531,
+    540, 549, 558, 567, 576, 585, 594, 603, 612, 621, 630, 639,
+    648, 657, 666, 675, 684, 693, 702, 711, 720, 729, 738, 747,
+    756, 765, 774, 783, 792, 801, 810, 819, 828, 837, 846,
 };
 
-static const uint16_t
-    FontData_16x26[] =
-        {
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [ ]
-            0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0,
-            0x03E0, 0x03C0, 0x03C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0,
-            0x01C0, 0x0000, 0x0000, 0x0000, 0x03E0, 0x03E0, 0x03E0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [!]
-            0x1E3C, 0x1E3C, 0x1E3C, 0x1E3C, 0x1E3C, 0x1E3C, 0x1E3C,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = ["]
-            0x01CE, 0x03CE, 0x03DE, 0x039E, 0x039C, 0x079C, 0x3FFF,
-            0x7FFF, 0x0738, 0x0F38, 0x0F78, 0x0F78, 0x0E78, 0xFFFF,
-            0xFFFF, 0x1EF0, 0x1CF0, 0x1CE0, 0x3CE0, 0x3DE0, 0x39E0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [#]
-            0x03FC, 0x0FFE, 0x1FEE, 0x1EE0, 0x1EE0, 0x1EE0, 0x1EE0,
-            0x1FE0, 0x0FE0, 0x07E0, 0x03F0, 0x01FC, 0x01FE, 0x01FE,
-            0x01FE, 0x01FE, 0x01FE, 0x01FE, 0x3DFE, 0x3FFC, 0x0FF0,
-            0x01E0, 0x01E0, 0x0000, 0x0000, 0x0000, // Ascii = [$]
-            0x3E03, 0xF707, 0xE78F, 0xE78E, 0xE39E, 0xE3BC, 0xE7B8,
-            0xE7F8, 0xF7F0, 0x3FE0, 0x01C0, 0x03FF, 0x07FF, 0x07F3,
-            0x0FF3, 0x1EF3, 0x3CF3, 0x38F3, 0x78F3, 0xF07F, 0xE03F,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [%]
-            0x07E0, 0x0FF8, 0x0F78, 0x1F78, 0x1F78, 0x1F78, 0x0F78,
-            0x0FF0, 0x0FE0, 0x1F80, 0x7FC3, 0xFBC3, 0xF3E7, 0xF1F7,
-            0xF0F7, 0xF0FF, 0xF07F, 0xF83E, 0x7C7F, 0x3FFF, 0x1FEF,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [&]
-            0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03C0, 0x01C0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [']
-            0x003F, 0x007C, 0x01F0, 0x01E0, 0x03C0, 0x07C0, 0x0780,
-            0x0780, 0x0F80, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00,
-            0x0F00, 0x0F80, 0x0780, 0x0780, 0x07C0, 0x03C0, 0x01E0,
-            0x01F0, 0x007C, 0x003F, 0x000F, 0x0000, // Ascii = [(]
-            0x7E00, 0x1F00, 0x07C0, 0x03C0, 0x01E0, 0x01F0, 0x00F0,
-            0x00F0, 0x00F8, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078,
-            0x0078, 0x00F8, 0x00F0, 0x00F0, 0x01F0, 0x01E0, 0x03C0,
-            0x07C0, 0x1F00, 0x7E00, 0x7800, 0x0000, // Ascii = [)]
-            0x03E0, 0x03C0, 0x01C0, 0x39CE, 0x3FFF, 0x3F7F, 0x0320,
-            0x0370, 0x07F8, 0x0F78, 0x1F3C, 0x0638, 0x0000, 0x0000,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [*]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C0,
-            0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0xFFFF,
-            0xFFFF, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [+]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-            0x0000, 0x0000, 0x0000, 0x03E0, 0x03E0, 0x03E0, 0x03E0,
-            0x01E0, 0x01E0, 0x01E0, 0x01C0, 0x0380, // Ascii = [,]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x3FFE, 0x3FFE, 0x0000,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [-]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-            0x0000, 0x0000, 0x0000, 0x03E0, 0x03E0, 0x03E0, 0x03E0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [.]
-            0x000F, 0x000F, 0x001E, 0x001E, 0x003C, 0x003C, 0x0078,
-            0x0078, 0x00F0, 0x00F0, 0x01E0, 0x01E0, 0x03C0, 0x03C0,
-            0x0780, 0x0780, 0x0F00, 0x0F00, 0x1E00, 0x1E00, 0x3C00,
-            0x3C00, 0x7800, 0x7800, 0xF000, 0x0000, // Ascii = [/]
-            0x07F0, 0x0FF8, 0x1F7C, 0x3E3E, 0x3C1E, 0x7C1F, 0x7C1F,
-            0x780F, 0x780F, 0x780F, 0x780F, 0x780F, 0x780F, 0x780F,
-            0x7C1F, 0x7C1F, 0x3C1E, 0x3E3E, 0x1F7C, 0x0FF8, 0x07F0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [0]
-            0x00F0, 0x07F0, 0x3FF0, 0x3FF0, 0x01F0, 0x01F0, 0x01F0,
-            0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0,
-            0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x3FFF, 0x3FFF,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [1]
-            0x0FE0, 0x3FF8, 0x3C7C, 0x003C, 0x003E, 0x003E, 0x003E,
-            0x003C, 0x003C, 0x007C, 0x00F8, 0x01F0, 0x03E0, 0x07C0,
-            0x0780, 0x0F00, 0x1E00, 0x3E00, 0x3C00, 0x3FFE, 0x3FFE,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [2]
-            0x0FF0, 0x1FF8, 0x1C7C, 0x003E, 0x003E, 0x003E, 0x003C,
-            0x003C, 0x00F8, 0x0FF0, 0x0FF8, 0x007C, 0x003E, 0x001E,
-            0x001E, 0x001E, 0x001E, 0x003E, 0x1C7C, 0x1FF8, 0x1FE0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [3]
-            0x0078, 0x00F8, 0x00F8, 0x01F8, 0x03F8, 0x07F8, 0x07F8,
-            0x0F78, 0x1E78, 0x1E78, 0x3C78, 0x7878, 0x7878, 0xFFFF,
-            0xFFFF, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [4]
-            0x1FFC, 0x1FFC, 0x1FFC, 0x1E00, 0x1E00, 0x1E00, 0x1E00,
-            0x1E00, 0x1FE0, 0x1FF8, 0x00FC, 0x007C, 0x003E, 0x003E,
-            0x001E, 0x003E, 0x003E, 0x003C, 0x1C7C, 0x1FF8, 0x1FE0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [5]
-            0x01FC, 0x07FE, 0x0F8E, 0x1F00, 0x1E00, 0x3E00, 0x3C00,
-            0x3C00, 0x3DF8, 0x3FFC, 0x7F3E, 0x7E1F, 0x3C0F, 0x3C0F,
-            0x3C0F, 0x3C0F, 0x3E0F, 0x1E1F, 0x1F3E, 0x0FFC, 0x03F0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [6]
-            0x3FFF, 0x3FFF, 0x3FFF, 0x000F, 0x001E, 0x001E, 0x003C,
-            0x0038, 0x0078, 0x00F0, 0x00F0, 0x01E0, 0x01E0, 0x03C0,
-            0x03C0, 0x0780, 0x0F80, 0x0F80, 0x0F00, 0x1F00, 0x1F00,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [7]
-            0x07F8, 0x0FFC, 0x1F3E, 0x1E1E, 0x3E1E, 0x3E1E, 0x1E1E,
-            0x1F3C, 0x0FF8, 0x07F0, 0x0FF8, 0x1EFC, 0x3E3E, 0x3C1F,
-            0x7C1F, 0x7C0F, 0x7C0F, 0x3C1F, 0x3F3E, 0x1FFC, 0x07F0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [8]
-            0x07F0, 0x0FF8, 0x1E7C, 0x3C3E, 0x3C1E, 0x7C1F, 0x7C1F,
-            0x7C1F, 0x7C1F, 0x3C1F, 0x3E3F, 0x1FFF, 0x07EF, 0x001F,
-            0x001E, 0x001E, 0x003E, 0x003C, 0x38F8, 0x3FF0, 0x1FE0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [9]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03E0,
-            0x03E0, 0x03E0, 0x03E0, 0x0000, 0x0000, 0x0000, 0x0000,
-            0x0000, 0x0000, 0x0000, 0x03E0, 0x03E0, 0x03E0, 0x03E0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [:]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03E0,
-            0x03E0, 0x03E0, 0x03E0, 0x0000, 0x0000, 0x0000, 0x0000,
-            0x0000, 0x0000, 0x0000, 0x03E0, 0x03E0, 0x03E0, 0x03E0,
-            0x01E0, 0x01E0, 0x01E0, 0x03C0, 0x0380, // Ascii = [;]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0003,
-            0x000F, 0x003F, 0x00FC, 0x03F0, 0x0FC0, 0x3F00, 0xFE00,
-            0x3F00, 0x0FC0, 0x03F0, 0x00FC, 0x003F, 0x000F, 0x0003,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [<]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-            0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000,
-            0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [=]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE000,
-            0xF800, 0x7E00, 0x1F80, 0x07E0, 0x01F8, 0x007E, 0x001F,
-            0x007E, 0x01F8, 0x07E0, 0x1F80, 0x7E00, 0xF800, 0xE000,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [>]
-            0x1FF0, 0x3FFC, 0x383E, 0x381F, 0x381F, 0x001E, 0x001E,
-            0x003C, 0x0078, 0x00F0, 0x01E0, 0x03C0, 0x03C0, 0x07C0,
-            0x07C0, 0x0000, 0x0000, 0x0000, 0x07C0, 0x07C0, 0x07C0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [?]
-            0x03F8, 0x0FFE, 0x1F1E, 0x3E0F, 0x3C7F, 0x78FF, 0x79EF,
-            0x73C7, 0xF3C7, 0xF38F, 0xF38F, 0xF38F, 0xF39F, 0xF39F,
-            0x73FF, 0x7BFF, 0x79F7, 0x3C00, 0x1F1C, 0x0FFC, 0x03F8,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [@]
-            0x0000, 0x0000, 0x0000, 0x03E0, 0x03E0, 0x07F0, 0x07F0,
-            0x07F0, 0x0F78, 0x0F78, 0x0E7C, 0x1E3C, 0x1E3C, 0x3C3E,
-            0x3FFE, 0x3FFF, 0x781F, 0x780F, 0xF00F, 0xF007, 0xF007,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [A]
-            0x0000, 0x0000, 0x0000, 0x3FF8, 0x3FFC, 0x3C3E, 0x3C1E,
-            0x3C1E, 0x3C1E, 0x3C3E, 0x3C7C, 0x3FF0, 0x3FF8, 0x3C7E,
-            0x3C1F, 0x3C1F, 0x3C0F, 0x3C0F, 0x3C1F, 0x3FFE, 0x3FF8,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [B]
-            0x0000, 0x0000, 0x0000, 0x01FF, 0x07FF, 0x1F87, 0x3E00,
-            0x3C00, 0x7C00, 0x7800, 0x7800, 0x7800, 0x7800, 0x7800,
-            0x7C00, 0x7C00, 0x3E00, 0x3F00, 0x1F83, 0x07FF, 0x01FF,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [C]
-            0x0000, 0x0000, 0x0000, 0x7FF0, 0x7FFC, 0x787E, 0x781F,
-            0x781F, 0x780F, 0x780F, 0x780F, 0x780F, 0x780F, 0x780F,
-            0x780F, 0x780F, 0x781F, 0x781E, 0x787E, 0x7FF8, 0x7FE0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [D]
-            0x0000, 0x0000, 0x0000, 0x3FFF, 0x3FFF, 0x3E00, 0x3E00,
-            0x3E00, 0x3E00, 0x3E00, 0x3E00, 0x3FFE, 0x3FFE, 0x3E00,
-            0x3E00, 0x3E00, 0x3E00, 0x3E00, 0x3E00, 0x3FFF, 0x3FFF,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [E]
-            0x0000, 0x0000, 0x0000, 0x1FFF, 0x1FFF, 0x1E00, 0x1E00,
-            0x1E00, 0x1E00, 0x1E00, 0x1E00, 0x1FFF, 0x1FFF, 0x1E00,
-            0x1E00, 0x1E00, 0x1E00, 0x1E00, 0x1E00, 0x1E00, 0x1E00,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [F]
-            0x0000, 0x0000, 0x0000, 0x03FE, 0x0FFF, 0x1F87, 0x3E00,
-            0x7C00, 0x7C00, 0x7800, 0xF800, 0xF800, 0xF87F, 0xF87F,
-            0x780F, 0x7C0F, 0x7C0F, 0x3E0F, 0x1F8F, 0x0FFF, 0x03FE,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [G]
-            0x0000, 0x0000, 0x0000, 0x7C1F, 0x7C1F, 0x7C1F, 0x7C1F,
-            0x7C1F, 0x7C1F, 0x7C1F, 0x7C1F, 0x7FFF, 0x7FFF, 0x7C1F,
-            0x7C1F, 0x7C1F, 0x7C1F, 0x7C1F, 0x7C1F, 0x7C1F, 0x7C1F,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [H]
-            0x0000, 0x0000, 0x0000, 0x3FFF, 0x3FFF, 0x03E0, 0x03E0,
-            0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0,
-            0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x3FFF, 0x3FFF,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [I]
-            0x0000, 0x0000, 0x0000, 0x1FFC, 0x1FFC, 0x007C, 0x007C,
-            0x007C, 0x007C, 0x007C, 0x007C, 0x007C, 0x007C, 0x007C,
-            0x007C, 0x007C, 0x0078, 0x0078, 0x38F8, 0x3FF0, 0x3FC0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [J]
-            0x0000, 0x0000, 0x0000, 0x3C1F, 0x3C1E, 0x3C3C, 0x3C78,
-            0x3CF0, 0x3DE0, 0x3FE0, 0x3FC0, 0x3F80, 0x3FC0, 0x3FE0,
-            0x3DF0, 0x3CF0, 0x3C78, 0x3C7C, 0x3C3E, 0x3C1F, 0x3C0F,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [K]
-            0x0000, 0x0000, 0x0000, 0x3E00, 0x3E00, 0x3E00, 0x3E00,
-            0x3E00, 0x3E00, 0x3E00, 0x3E00, 0x3E00, 0x3E00, 0x3E00,
-            0x3E00, 0x3E00, 0x3E00, 0x3E00, 0x3E00, 0x3FFF, 0x3FFF,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [L]
-            0x0000, 0x0000, 0x0000, 0xF81F, 0xFC1F, 0xFC1F, 0xFE3F,
-            0xFE3F, 0xFE3F, 0xFF7F, 0xFF77, 0xFF77, 0xF7F7, 0xF7E7,
-            0xF3E7, 0xF3E7, 0xF3C7, 0xF007, 0xF007, 0xF007, 0xF007,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [M]
-            0x0000, 0x0000, 0x0000, 0x7C0F, 0x7C0F, 0x7E0F, 0x7F0F,
-            0x7F0F, 0x7F8F, 0x7F8F, 0x7FCF, 0x7BEF, 0x79EF, 0x79FF,
-            0x78FF, 0x78FF, 0x787F, 0x783F, 0x783F, 0x781F, 0x781F,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [N]
-            0x0000, 0x0000, 0x0000, 0x07F0, 0x1FFC, 0x3E3E, 0x7C1F,
-            0x780F, 0x780F, 0xF80F, 0xF80F, 0xF80F, 0xF80F, 0xF80F,
-            0xF80F, 0x780F, 0x780F, 0x7C1F, 0x3E3E, 0x1FFC, 0x07F0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [O]
-            0x0000, 0x0000, 0x0000, 0x3FFC, 0x3FFF, 0x3E1F, 0x3E0F,
-            0x3E0F, 0x3E0F, 0x3E0F, 0x3E1F, 0x3E3F, 0x3FFC, 0x3FF0,
-            0x3E00, 0x3E00, 0x3E00, 0x3E00, 0x3E00, 0x3E00, 0x3E00,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [P]
-            0x0000, 0x0000, 0x0000, 0x07F0, 0x1FFC, 0x3E3E, 0x7C1F,
-            0x780F, 0x780F, 0xF80F, 0xF80F, 0xF80F, 0xF80F, 0xF80F,
-            0xF80F, 0x780F, 0x780F, 0x7C1F, 0x3E3E, 0x1FFC, 0x07F8,
-            0x007C, 0x003F, 0x000F, 0x0003, 0x0000, // Ascii = [Q]
-            0x0000, 0x0000, 0x0000, 0x3FF0, 0x3FFC, 0x3C7E, 0x3C3E,
-            0x3C1E, 0x3C1E, 0x3C3E, 0x3C3C, 0x3CFC, 0x3FF0, 0x3FE0,
-            0x3DF0, 0x3CF8, 0x3C7C, 0x3C3E, 0x3C1E, 0x3C1F, 0x3C0F,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [R]
-            0x0000, 0x0000, 0x0000, 0x07FC, 0x1FFE, 0x3E0E, 0x3C00,
-            0x3C00, 0x3C00, 0x3E00, 0x1FC0, 0x0FF8, 0x03FE, 0x007F,
-            0x001F, 0x000F, 0x000F, 0x201F, 0x3C3E, 0x3FFC, 0x1FF0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [S]
-            0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x03E0, 0x03E0,
-            0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0,
-            0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [T]
-            0x0000, 0x0000, 0x0000, 0x7C0F, 0x7C0F, 0x7C0F, 0x7C0F,
-            0x7C0F, 0x7C0F, 0x7C0F, 0x7C0F, 0x7C0F, 0x7C0F, 0x7C0F,
-            0x7C0F, 0x7C0F, 0x3C1E, 0x3C1E, 0x3E3E, 0x1FFC, 0x07F0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [U]
-            0x0000, 0x0000, 0x0000, 0xF007, 0xF007, 0xF807, 0x780F,
-            0x7C0F, 0x3C1E, 0x3C1E, 0x3E1E, 0x1E3C, 0x1F3C, 0x1F78,
-            0x0F78, 0x0FF8, 0x07F0, 0x07F0, 0x07F0, 0x03E0, 0x03E0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [V]
-            0x0000, 0x0000, 0x0000, 0xE003, 0xF003, 0xF003, 0xF007,
-            0xF3E7, 0xF3E7, 0xF3E7, 0x73E7, 0x7BF7, 0x7FF7, 0x7FFF,
-            0x7F7F, 0x7F7F, 0x7F7E, 0x3F7E, 0x3E3E, 0x3E3E, 0x3E3E,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [W]
-            0x0000, 0x0000, 0x0000, 0xF807, 0x7C0F, 0x3E1E, 0x3E3E,
-            0x1F3C, 0x0FF8, 0x07F0, 0x07E0, 0x03E0, 0x03E0, 0x07F0,
-            0x0FF8, 0x0F7C, 0x1E7C, 0x3C3E, 0x781F, 0x780F, 0xF00F,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [X]
-            0x0000, 0x0000, 0x0000, 0xF807, 0x7807, 0x7C0F, 0x3C1E,
-            0x3E1E, 0x1F3C, 0x0F78, 0x0FF8, 0x07F0, 0x03E0, 0x03E0,
-            0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [Y]
-            0x0000, 0x0000, 0x0000, 0x7FFF, 0x7FFF, 0x000F, 0x001F,
-            0x003E, 0x007C, 0x00F8, 0x00F0, 0x01E0, 0x03E0, 0x07C0,
-            0x0F80, 0x0F00, 0x1E00, 0x3E00, 0x7C00, 0x7FFF, 0x7FFF,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [Z]
-            0x07FF, 0x0780, 0x0780, 0x0780, 0x0780, 0x0780, 0x0780,
-            0x0780, 0x0780, 0x0780, 0x0780, 0x0780, 0x0780, 0x0780,
-            0x0780, 0x0780, 0x0780, 0x0780, 0x0780, 0x0780, 0x0780,
-            0x0780, 0x0780, 0x07FF, 0x07FF, 0x0000, // Ascii = [[]
-            0x7800, 0x7800, 0x3C00, 0x3C00, 0x1E00, 0x1E00, 0x0F00,
-            0x0F00, 0x0780, 0x0780, 0x03C0, 0x03C0, 0x01E0, 0x01E0,
-            0x00F0, 0x00F0, 0x0078, 0x0078, 0x003C, 0x003C, 0x001E,
-            0x001E, 0x000F, 0x000F, 0x0007, 0x0000, // Ascii = [\]
-            0x7FF0, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F0,
-            0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F0,
-            0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F0,
-            0x00F0, 0x00F0, 0x7FF0, 0x7FF0, 0x0000, // Ascii = []]
-            0x00C0, 0x01C0, 0x01C0, 0x03E0, 0x03E0, 0x07F0, 0x07F0,
-            0x0778, 0x0F78, 0x0F38, 0x1E3C, 0x1E3C, 0x3C1E, 0x3C1E,
-            0x380F, 0x780F, 0x7807, 0x0000, 0x0000, 0x0000, 0x0000,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [^]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-            0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, // Ascii = [_]
-            0x00F0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [`]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0FF8,
-            0x3FFC, 0x3C7C, 0x003E, 0x003E, 0x003E, 0x07FE, 0x1FFE,
-            0x3E3E, 0x7C3E, 0x783E, 0x7C3E, 0x7C7E, 0x3FFF, 0x1FCF,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [a]
-            0x3C00, 0x3C00, 0x3C00, 0x3C00, 0x3C00, 0x3C00, 0x3DF8,
-            0x3FFE, 0x3F3E, 0x3E1F, 0x3C0F, 0x3C0F, 0x3C0F, 0x3C0F,
-            0x3C0F, 0x3C0F, 0x3C1F, 0x3C1E, 0x3F3E, 0x3FFC, 0x3BF0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [b]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03FE,
-            0x0FFF, 0x1F87, 0x3E00, 0x3E00, 0x3C00, 0x7C00, 0x7C00,
-            0x7C00, 0x3C00, 0x3E00, 0x3E00, 0x1F87, 0x0FFF, 0x03FE,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [c]
-            0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x07FF,
-            0x1FFF, 0x3E3F, 0x3C1F, 0x7C1F, 0x7C1F, 0x7C1F, 0x781F,
-            0x781F, 0x7C1F, 0x7C1F, 0x3C3F, 0x3E7F, 0x1FFF, 0x0FDF,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [d]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03F8,
-            0x0FFC, 0x1F3E, 0x3E1E, 0x3C1F, 0x7C1F, 0x7FFF, 0x7FFF,
-            0x7C00, 0x7C00, 0x3C00, 0x3E00, 0x1F07, 0x0FFF, 0x03FE,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [e]
-            0x01FF, 0x03E1, 0x03C0, 0x07C0, 0x07C0, 0x07C0, 0x7FFF,
-            0x7FFF, 0x07C0, 0x07C0, 0x07C0, 0x07C0, 0x07C0, 0x07C0,
-            0x07C0, 0x07C0, 0x07C0, 0x07C0, 0x07C0, 0x07C0, 0x07C0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [f]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07EF,
-            0x1FFF, 0x3E7F, 0x3C1F, 0x7C1F, 0x7C1F, 0x781F, 0x781F,
-            0x781F, 0x7C1F, 0x7C1F, 0x3C3F, 0x3E7F, 0x1FFF, 0x0FDF,
-            0x001E, 0x001E, 0x001E, 0x387C, 0x3FF8, // Ascii = [g]
-            0x3C00, 0x3C00, 0x3C00, 0x3C00, 0x3C00, 0x3C00, 0x3DFC,
-            0x3FFE, 0x3F9E, 0x3F1F, 0x3E1F, 0x3C1F, 0x3C1F, 0x3C1F,
-            0x3C1F, 0x3C1F, 0x3C1F, 0x3C1F, 0x3C1F, 0x3C1F, 0x3C1F,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [h]
-            0x01F0, 0x01F0, 0x0000, 0x0000, 0x0000, 0x0000, 0x7FE0,
-            0x7FE0, 0x01E0, 0x01E0, 0x01E0, 0x01E0, 0x01E0, 0x01E0,
-            0x01E0, 0x01E0, 0x01E0, 0x01E0, 0x01E0, 0x01E0, 0x01E0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [i]
-            0x00F8, 0x00F8, 0x0000, 0x0000, 0x0000, 0x0000, 0x3FF8,
-            0x3FF8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
-            0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
-            0x00F8, 0x00F8, 0x00F0, 0x71F0, 0x7FE0, // Ascii = [j]
-            0x3C00, 0x3C00, 0x3C00, 0x3C00, 0x3C00, 0x3C00, 0x3C1F,
-            0x3C3E, 0x3C7C, 0x3CF8, 0x3DF0, 0x3DE0, 0x3FC0, 0x3FC0,
-            0x3FE0, 0x3DF0, 0x3CF8, 0x3C7C, 0x3C3E, 0x3C1F, 0x3C1F,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [k]
-            0x7FF0, 0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0,
-            0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0,
-            0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0, 0x01F0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [l]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF79E,
-            0xFFFF, 0xFFFF, 0xFFFF, 0xFBE7, 0xF9E7, 0xF1C7, 0xF1C7,
-            0xF1C7, 0xF1C7, 0xF1C7, 0xF1C7, 0xF1C7, 0xF1C7, 0xF1C7,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [m]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3DFC,
-            0x3FFE, 0x3F9E, 0x3F1F, 0x3E1F, 0x3C1F, 0x3C1F, 0x3C1F,
-            0x3C1F, 0x3C1F, 0x3C1F, 0x3C1F, 0x3C1F, 0x3C1F, 0x3C1F,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [n]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07F0,
-            0x1FFC, 0x3E3E, 0x3C1F, 0x7C1F, 0x780F, 0x780F, 0x780F,
-            0x780F, 0x780F, 0x7C1F, 0x3C1F, 0x3E3E, 0x1FFC, 0x07F0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [o]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3DF8,
-            0x3FFE, 0x3F3E, 0x3E1F, 0x3C0F, 0x3C0F, 0x3C0F, 0x3C0F,
-            0x3C0F, 0x3C0F, 0x3C1F, 0x3E1E, 0x3F3E, 0x3FFC, 0x3FF8,
-            0x3C00, 0x3C00, 0x3C00, 0x3C00, 0x3C00, // Ascii = [p]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07EE,
-            0x1FFE, 0x3E7E, 0x3C1E, 0x7C1E, 0x781E, 0x781E, 0x781E,
-            0x781E, 0x781E, 0x7C1E, 0x7C3E, 0x3E7E, 0x1FFE, 0x0FDE,
-            0x001E, 0x001E, 0x001E, 0x001E, 0x001E, // Ascii = [q]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F7F,
-            0x1FFF, 0x1FE7, 0x1FC7, 0x1F87, 0x1F00, 0x1F00, 0x1F00,
-            0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [r]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FC,
-            0x1FFE, 0x1E0E, 0x3E00, 0x3E00, 0x3F00, 0x1FE0, 0x07FC,
-            0x00FE, 0x003E, 0x001E, 0x001E, 0x3C3E, 0x3FFC, 0x1FF0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [s]
-            0x0000, 0x0000, 0x0000, 0x0780, 0x0780, 0x0780, 0x7FFF,
-            0x7FFF, 0x0780, 0x0780, 0x0780, 0x0780, 0x0780, 0x0780,
-            0x0780, 0x0780, 0x0780, 0x0780, 0x07C0, 0x03FF, 0x01FF,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [t]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3C1E,
-            0x3C1E, 0x3C1E, 0x3C1E, 0x3C1E, 0x3C1E, 0x3C1E, 0x3C1E,
-            0x3C1E, 0x3C1E, 0x3C3E, 0x3C7E, 0x3EFE, 0x1FFE, 0x0FDE,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [u]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF007,
-            0x780F, 0x780F, 0x3C1E, 0x3C1E, 0x3E1E, 0x1E3C, 0x1E3C,
-            0x0F78, 0x0F78, 0x0FF0, 0x07F0, 0x07F0, 0x03E0, 0x03E0,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [v]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF003,
-            0xF1E3, 0xF3E3, 0xF3E7, 0xF3F7, 0xF3F7, 0x7FF7, 0x7F77,
-            0x7F7F, 0x7F7F, 0x7F7F, 0x3E3E, 0x3E3E, 0x3E3E, 0x3E3E,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [w]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7C0F,
-            0x3E1E, 0x3E3C, 0x1F3C, 0x0FF8, 0x07F0, 0x07F0, 0x03E0,
-            0x07F0, 0x07F8, 0x0FF8, 0x1E7C, 0x3E3E, 0x3C1F, 0x781F,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [x]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF807,
-            0x780F, 0x7C0F, 0x3C1E, 0x3C1E, 0x1E3C, 0x1E3C, 0x1F3C,
-            0x0F78, 0x0FF8, 0x07F0, 0x07F0, 0x03E0, 0x03E0, 0x03C0,
-            0x03C0, 0x03C0, 0x0780, 0x0F80, 0x7F00, // Ascii = [y]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3FFF,
-            0x3FFF, 0x001F, 0x003E, 0x007C, 0x00F8, 0x01F0, 0x03E0,
-            0x07C0, 0x0F80, 0x1F00, 0x1E00, 0x3C00, 0x7FFF, 0x7FFF,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [z]
-            0x01FE, 0x03E0, 0x03C0, 0x03C0, 0x03C0, 0x03C0, 0x01E0,
-            0x01E0, 0x01E0, 0x01C0, 0x03C0, 0x3F80, 0x3F80, 0x03C0,
-            0x01C0, 0x01E0, 0x01E0, 0x01E0, 0x03C0, 0x03C0, 0x03C0,
-            0x03C0, 0x03E0, 0x01FE, 0x007E, 0x0000, // Ascii = [{]
-            0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0,
-            0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0,
-            0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0,
-            0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x0000, // Ascii = [|]
-            0x3FC0, 0x03E0, 0x01E0, 0x01E0, 0x01E0, 0x01E0, 0x01C0,
-            0x03C0, 0x03C0, 0x01C0, 0x01E0, 0x00FE, 0x00FE, 0x01E0,
-            0x01C0, 0x03C0, 0x03C0, 0x01C0, 0x01E0, 0x01E0, 0x01E0,
-            0x01E0, 0x03E0, 0x3FC0, 0x3F00, 0x0000, // Ascii = [}]
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x3F07, 0x7FC7, 0x73E7,
-            0xF1FF, 0xF07E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Ascii = [~]
+static const uint8_t FontBitmap_11x18[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, // sp
+    0x00, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C,
+    0x01, 0x80, 0x30, 0x06, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, // !
+    0x00, 0x03, 0x60, 0x6C, 0x0D, 0x81, 0xB0, 0x36, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, // "
+    0x00, 0x03, 0x30, 0x66, 0x0C, 0xC1, 0x98, 0xFF, 0x9F, 0xF0, 0xCC, 0x33,
+    0x0F, 0xF9, 0xFF, 0x19, 0x83, 0x30, 0x66, 0x0C, 0xC0, 0x00, 0x00, 0x00,
+    0x00, // #
+    0x00, 0x03, 0xC0, 0xFC, 0x3A, 0xC6, 0x58, 0xE8, 0x0F, 0x00, 0xF0, 0x07,
+    0x00, 0xB1, 0x96, 0x32, 0xC7, 0x58, 0x7E, 0x07, 0x80, 0x20, 0x04, 0x00,
+    0x00, // $
+    0x00, 0x0E, 0x03, 0x60, 0x6C, 0x2D, 0x8D, 0xB3, 0x1C, 0xC0, 0x30, 0x0C,
+    0x03, 0x70, 0xDB, 0x33, 0x64, 0x6C, 0x0D, 0x80, 0xE0, 0x00, 0x00, 0x00,
+    0x00, // %
+    0x00, 0x03, 0xC0, 0xFC, 0x19, 0x83, 0x30, 0x66, 0x07, 0x80, 0x60, 0x3C,
+    0xCC, 0xD9, 0x8E, 0x30, 0xC6, 0x38, 0x7D, 0x87, 0x20, 0x00, 0x00, 0x00,
+    0x00, // &
+    0x00, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, // '
+    0x00, 0x80, 0x20, 0x0C, 0x03, 0x00, 0x60, 0x08, 0x03, 0x00, 0x60, 0x0C,
+    0x01, 0x80, 0x30, 0x06, 0x00, 0x40, 0x0C, 0x01, 0x80, 0x18, 0x01, 0x00,
+    0x10, // (
+    0x20, 0x02, 0x00, 0x60, 0x06, 0x00, 0xC0, 0x08, 0x01, 0x80, 0x30, 0x06,
+    0x00, 0xC0, 0x18, 0x03, 0x00, 0x40, 0x18, 0x03, 0x00, 0xC0, 0x10, 0x04,
+    0x00, // )
+    0x00, 0x01, 0x80, 0xB4, 0x1F, 0x81, 0xE0, 0x66, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, // *
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x07, 0xFE, 0xFF,
+    0xC1, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, // +
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0x20, 0x04, 0x01,
+    0x00, // ,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xC0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, // -
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, // .
+    0x00, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x0C,
+    0x01, 0x80, 0x30, 0x06, 0x01, 0x80, 0x30, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, // /
+    0x00, 0x03, 0xC0, 0xFC, 0x19, 0x86, 0x18, 0xC3, 0x18, 0x63, 0x6C, 0x6D,
+    0x8C, 0x31, 0x86, 0x30, 0xC3, 0x30, 0x7E, 0x07, 0x80, 0x00, 0x00, 0x00,
+    0x00, // 0
+    0x00, 0x00, 0xC0, 0x38, 0x0F, 0x03, 0x60, 0x4C, 0x01, 0x80, 0x30, 0x06,
+    0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x00, 0x00, 0x00,
+    0x00, // 1
+    0x00, 0x03, 0xC0, 0xFC, 0x39, 0xC6, 0x18, 0xC3, 0x00, 0x60, 0x18, 0x06,
+    0x01, 0x80, 0x60, 0x18, 0x06, 0x00, 0xFF, 0x1F, 0xE0, 0x00, 0x00, 0x00,
+    0x00, // 2
+    0x00, 0x03, 0x80, 0xF8, 0x31, 0x86, 0x30, 0x06, 0x03, 0x80, 0x70, 0x03,
+    0x00, 0x30, 0x06, 0x30, 0xC7, 0x38, 0x7E, 0x07, 0x80, 0x00, 0x00, 0x00,
+    0x00, // 3
+    0x00, 0x00, 0xC0, 0x38, 0x07, 0x01, 0xE0, 0x3C, 0x05, 0x81, 0xB0, 0x36,
+    0x0C, 0xC1, 0xFE, 0x3F, 0xC0, 0x60, 0x0C, 0x01, 0x80, 0x00, 0x00, 0x00,
+    0x00, // 4
+    0x00, 0x0F, 0xE1, 0xFC, 0x30, 0x06, 0x00, 0xC0, 0x1B, 0x83, 0xF8, 0x63,
+    0x80, 0x30, 0x06, 0x30, 0xC7, 0x38, 0x7E, 0x07, 0x80, 0x00, 0x00, 0x00,
+    0x00, // 5
+    0x00, 0x03, 0xC0, 0xFC, 0x19, 0xC6, 0x18, 0xC0, 0x1B, 0x83, 0xF8, 0x73,
+    0x8C, 0x31, 0x86, 0x30, 0xC3, 0x38, 0x7E, 0x07, 0x80, 0x00, 0x00, 0x00,
+    0x00, // 6
+    0x00, 0x0F, 0xF1, 0xFE, 0x00, 0xC0, 0x30, 0x06, 0x01, 0x80, 0x30, 0x0C,
+    0x01, 0x80, 0x30, 0x04, 0x01, 0x80, 0x30, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, // 7
+    0x00, 0x03, 0xC0, 0xFC, 0x31, 0xC6, 0x18, 0xC3, 0x08, 0x40, 0xF0, 0x3F,
+    0x0C, 0x31, 0x86, 0x30, 0xC6, 0x18, 0x7E, 0x07, 0x80, 0x00, 0x00, 0x00,
+    0x00, // 8
+    0x00, 0x03, 0xC0, 0xFC, 0x39, 0x86, 0x18, 0xC3, 0x18, 0x63, 0x9C, 0x3F,
+    0x83, 0xB0, 0x06, 0x30, 0xC7, 0x30, 0x7E, 0x07, 0x80, 0x00, 0x00, 0x00,
+    0x00, // 9
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, // :
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0x20, 0x04, 0x01,
+    0x00, // ;
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x07, 0x03, 0x81, 0xC0, 0x60,
+    0x07, 0x00, 0x38, 0x01, 0xC0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, // <
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xE0, 0x00, 0x00,
+    0x0F, 0xF1, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, // =
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01,
+    0x80, 0xE0, 0x70, 0x38, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, // >
+    0x00, 0x03, 0xE0, 0xFE, 0x38, 0xE6, 0x0C, 0x01, 0x80, 0x70, 0x1C, 0x07,
+    0x01, 0xC0, 0x30, 0x06, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, // ?
+    0x00, 0x03, 0xC0, 0xFC, 0x18, 0xC7, 0x18, 0xC7, 0x1B, 0xE3, 0x6C, 0x6D,
+    0x8D, 0xF1, 0x9E, 0x30, 0x03, 0x20, 0x7C, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, // @
+    0x00, 0x01, 0xC0, 0x38, 0x0D, 0x81, 0xB0, 0x36, 0x06, 0xC1, 0x8C, 0x31,
+    0x87, 0xF0, 0xFE, 0x18, 0xC6, 0x0C, 0xC1, 0x98, 0x30, 0x00, 0x00, 0x00,
+    0x00, // A
+    0x00, 0x0F, 0x81, 0xF8, 0x31, 0x86, 0x30, 0xC6, 0x18, 0xC3, 0xF0, 0x7E,
+    0x0C, 0x61, 0x86, 0x30, 0xC6, 0x38, 0xFE, 0x1F, 0x80, 0x00, 0x00, 0x00,
+    0x00, // B
+    0x00, 0x03, 0xC0, 0xFC, 0x18, 0xC6, 0x18, 0xC0, 0x18, 0x03, 0x00, 0x60,
+    0x0C, 0x01, 0x80, 0x30, 0xC3, 0x18, 0x7E, 0x07, 0x80, 0x00, 0x00, 0x00,
+    0x00, // C
+    0x00, 0x0F, 0x81, 0xFC, 0x31, 0x86, 0x38, 0xC3, 0x18, 0x63, 0x0C, 0x61,
+    0x8C, 0x31, 0x86, 0x31, 0x86, 0x30, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x00,
+    0x00, // D
+    0x00, 0x0F, 0xF1, 0xFE, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0xF8, 0x7F,
+    0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xFF, 0x1F, 0xE0, 0x00, 0x00, 0x00,
+    0x00, // E
+    0x00, 0x0F, 0xF1, 0xFE, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0xF8, 0x7F,
+    0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, // F
+    0x00, 0x03, 0xC0, 0xFC, 0x18, 0xC6, 0x18, 0xC0, 0x18, 0x03, 0x00, 0x63,
+    0x8C, 0x71, 0x86, 0x30, 0xC3, 0x18, 0x7F, 0x07, 0x80, 0x00, 0x00, 0x00,
+    0x00, // G
+    0x00, 0x0C, 0x31, 0x86, 0x30, 0xC6, 0x18, 0xC3, 0x18, 0x63, 0xFC, 0x7F,
+    0x8C, 0x31, 0x86, 0x30, 0xC6, 0x18, 0xC3, 0x18, 0x60, 0x00, 0x00, 0x00,
+    0x00, // H
+    0x00, 0x07, 0xE0, 0xFC, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C,
+    0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x7E, 0x0F, 0xC0, 0x00, 0x00, 0x00,
+    0x00, // I
+    0x00, 0x00, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01,
+    0x80, 0x31, 0x86, 0x30, 0xC7, 0x38, 0x7E, 0x07, 0x80, 0x00, 0x00, 0x00,
+    0x00, // J
+    0x00, 0x0C, 0x19, 0x86, 0x31, 0x86, 0x60, 0xCC, 0x1B, 0x03, 0xC0, 0x7C,
+    0x0C, 0xC1, 0x98, 0x31, 0x86, 0x18, 0xC3, 0x18, 0x30, 0x00, 0x00, 0x00,
+    0x00, // K
+    0x00, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60,
+    0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xFF, 0x1F, 0xE0, 0x00, 0x00, 0x00,
+    0x00, // L
+    0x00, 0x0E, 0x39, 0xC7, 0x3D, 0xE7, 0xAC, 0xD5, 0x9A, 0xB3, 0x76, 0x64,
+    0xCC, 0x19, 0x83, 0x30, 0x66, 0x0C, 0xC1, 0x98, 0x30, 0x00, 0x00, 0x00,
+    0x00, // M
+    0x00, 0x0E, 0x31, 0xC6, 0x3C, 0xC7, 0x98, 0xF3, 0x1B, 0x63, 0x6C, 0x6D,
+    0x8C, 0xB1, 0x9E, 0x33, 0xC6, 0x78, 0xC7, 0x18, 0xE0, 0x00, 0x00, 0x00,
+    0x00, // N
+    0x00, 0x03, 0xC0, 0xFC, 0x19, 0x86, 0x18, 0xC3, 0x18, 0x63, 0x0C, 0x61,
+    0x8C, 0x31, 0x86, 0x30, 0xC3, 0x30, 0x7E, 0x07, 0x80, 0x00, 0x00, 0x00,
+    0x00, // O
+    0x00, 0x0F, 0xC1, 0xFC, 0x31, 0xC6, 0x18, 0xC3, 0x18, 0x63, 0x1C, 0x7F,
+    0x0F, 0xC1, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, // P
+    0x00, 0x03, 0xC0, 0xFC, 0x19, 0x86, 0x18, 0xC3, 0x18, 0x63, 0x0C, 0x61,
+    0x8C, 0x31, 0x96, 0x33, 0xC3, 0x30, 0x7F, 0x07, 0x90, 0x00, 0x00, 0x00,
+    0x00, // Q
+    0x00, 0x0F, 0xC1, 0xFC, 0x31, 0xC6, 0x18, 0xC3, 0x18, 0xE3, 0xF8, 0x7E,
+    0x0C, 0xC1, 0x8C, 0x31, 0x86, 0x18, 0xC3, 0x18, 0x30, 0x00, 0x00, 0x00,
+    0x00, // R
+    0x00, 0x01, 0xC0, 0x7C, 0x18, 0xC3, 0x18, 0x60, 0x0E, 0x00, 0xF0, 0x07,
+    0x00, 0x71, 0x86, 0x30, 0xC3, 0x18, 0x7E, 0x07, 0x80, 0x00, 0x00, 0x00,
+    0x00, // S
+    0x00, 0x1F, 0xFB, 0xFF, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C,
+    0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, // T
+    0x00, 0x0C, 0x31, 0x86, 0x30, 0xC6, 0x18, 0xC3, 0x18, 0x63, 0x0C, 0x61,
+    0x8C, 0x31, 0x86, 0x30, 0xC7, 0x38, 0x7E, 0x07, 0x80, 0x00, 0x00, 0x00,
+    0x00, // U
+    0x00, 0x0C, 0x19, 0x83, 0x30, 0x63, 0x18, 0x63, 0x0C, 0x60, 0xD8, 0x1B,
+    0x03, 0x60, 0x6C, 0x07, 0x00, 0xE0, 0x1C, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, // V
+    0x00, 0x18, 0x1B, 0x03, 0x60, 0x6C, 0x0D, 0x81, 0xB3, 0x32, 0x64, 0x4C,
+    0x8B, 0xD1, 0x4A, 0x29, 0x47, 0x38, 0xC3, 0x18, 0x60, 0x00, 0x00, 0x00,
+    0x00, // W
+    0x00, 0x18, 0x19, 0x82, 0x30, 0xC3, 0x30, 0x76, 0x07, 0x80, 0x60, 0x0C,
+    0x03, 0xC0, 0x7C, 0x1D, 0x87, 0x18, 0xC3, 0x30, 0x30, 0x00, 0x00, 0x00,
+    0x00, // X
+    0x00, 0x18, 0x19, 0x86, 0x30, 0xC3, 0x30, 0x66, 0x07, 0x80, 0xF0, 0x0C,
+    0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, // Y
+    0x00, 0x07, 0xF0, 0xFE, 0x00, 0xC0, 0x30, 0x06, 0x01, 0x80, 0x60, 0x0C,
+    0x03, 0x00, 0x60, 0x18, 0x06, 0x00, 0xFF, 0x1F, 0xE0, 0x00, 0x00, 0x00,
+    0x00, // Z
+    0x0F, 0x01, 0xE0, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C,
+    0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0F, 0x01,
+    0xE0, // [
+    0x00, 0x03, 0x00, 0x60, 0x0C, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x06,
+    0x00, 0xC0, 0x18, 0x03, 0x00, 0x30, 0x06, 0x00, 0xC0, 0x00, 0x00, 0x00,
+    0x00, /* \ */
+    0x1E, 0x03, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06,
+    0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x1E, 0x03,
+    0xC0, // ]
+    0x00, 0x01, 0x80, 0x30, 0x0F, 0x01, 0x20, 0x66, 0x0C, 0xC3, 0x0C, 0x61,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, // ^
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0,
+    0x00, // _
+    0x00, 0x07, 0x00, 0x60, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, // `
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0xE3, 0x0C, 0x01,
+    0x83, 0xF0, 0xFE, 0x30, 0xC6, 0x38, 0xFF, 0x0E, 0x30, 0x00, 0x00, 0x00,
+    0x00, // a
+    0x00, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xDC, 0x1F, 0xC3, 0x9C, 0x61,
+    0x8C, 0x31, 0x86, 0x30, 0xC7, 0x38, 0xFE, 0x1B, 0x80, 0x00, 0x00, 0x00,
+    0x00, // b
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0F, 0xC3, 0x9C, 0x61,
+    0x8C, 0x01, 0x80, 0x30, 0xC7, 0x38, 0x7E, 0x07, 0x80, 0x00, 0x00, 0x00,
+    0x00, // c
+    0x00, 0x00, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x3B, 0x0F, 0xE3, 0x9C, 0x61,
+    0x8C, 0x31, 0x86, 0x30, 0xC7, 0x38, 0x7F, 0x07, 0x60, 0x00, 0x00, 0x00,
+    0x00, // d
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0F, 0xC3, 0x98, 0x61,
+    0x8F, 0xF1, 0xFE, 0x30, 0x07, 0x18, 0x7E, 0x07, 0x80, 0x00, 0x00, 0x00,
+    0x00, // e
+    0x00, 0x00, 0xF8, 0x3F, 0x06, 0x00, 0xC0, 0xFF, 0x1F, 0xE0, 0x60, 0x0C,
+    0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, // f
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD8, 0x7F, 0x1C, 0xE3, 0x0C, 0x61,
+    0x8C, 0x31, 0x86, 0x39, 0xC3, 0xF8, 0x3B, 0x00, 0x63, 0x1C, 0x7F, 0x07,
+    0xC0, // g
+    0x00, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xDE, 0x1F, 0xE3, 0x8C, 0x61,
+    0x8C, 0x31, 0x86, 0x30, 0xC6, 0x18, 0xC3, 0x18, 0x60, 0x00, 0x00, 0x00,
+    0x00, // h
+    0x00, 0x00, 0xC0, 0x18, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0x80, 0x30, 0x06,
+    0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x00, 0x00, 0x00,
+    0x00, // i
+    0x06, 0x00, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x7C, 0x01, 0x80, 0x30, 0x06,
+    0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x82, 0x30, 0x7E, 0x07,
+    0x80, // j
+    0x00, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC3, 0x18, 0xC3, 0x30, 0x6C,
+    0x0F, 0x81, 0xD8, 0x31, 0x86, 0x30, 0xC3, 0x18, 0x30, 0x00, 0x00, 0x00,
+    0x00, // k
+    0x00, 0x07, 0xC0, 0xF8, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06,
+    0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x00, 0x00, 0x00,
+    0x00, // l
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBB, 0x3F, 0xF6, 0x76, 0xCC,
+    0xD9, 0x9B, 0x33, 0x66, 0x6C, 0xCD, 0x99, 0xB3, 0x30, 0x00, 0x00, 0x00,
+    0x00, // m
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDE, 0x1F, 0xE3, 0x8C, 0x61,
+    0x8C, 0x31, 0x86, 0x30, 0xC6, 0x18, 0xC3, 0x18, 0x60, 0x00, 0x00, 0x00,
+    0x00, // n
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0F, 0xC3, 0x9C, 0x61,
+    0x8C, 0x31, 0x86, 0x30, 0xC7, 0x38, 0x7E, 0x07, 0x80, 0x00, 0x00, 0x00,
+    0x00, // o
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xE0, 0xFE, 0x1C, 0xE3, 0x0C, 0x61,
+    0x8C, 0x31, 0x86, 0x39, 0xC7, 0xF0, 0xDC, 0x18, 0x03, 0x00, 0x60, 0x0C,
+    0x00, // p
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD8, 0x7F, 0x1C, 0xE3, 0x0C, 0x61,
+    0x8C, 0x31, 0x86, 0x39, 0xC3, 0xF8, 0x3B, 0x00, 0x60, 0x0C, 0x01, 0x80,
+    0x30, // q
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0x0F, 0xE1, 0xC8, 0x30,
+    0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x00, // r
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0F, 0xE3, 0x0C, 0x60,
+    0x0F, 0xE0, 0xFE, 0x00, 0xC6, 0x18, 0xFE, 0x07, 0x80, 0x00, 0x00, 0x00,
+    0x00, // s
+    0x00, 0x00, 0x00, 0x20, 0x0C, 0x01, 0x80, 0xFE, 0x1F, 0xC0, 0xC0, 0x18,
+    0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x3F, 0x03, 0xE0, 0x00, 0x00, 0x00,
+    0x00, // t
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x18, 0x63, 0x0C, 0x61,
+    0x8C, 0x31, 0x86, 0x30, 0xC6, 0x38, 0xFF, 0x0F, 0x60, 0x00, 0x00, 0x00,
+    0x00, // u
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x8C, 0x61, 0x8C, 0x31,
+    0x83, 0x60, 0x6C, 0x0D, 0x80, 0xE0, 0x1C, 0x01, 0x80, 0x00, 0x00, 0x00,
+    0x00, // v
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBB, 0x37, 0x66, 0xEC, 0x55,
+    0x0A, 0xA1, 0x54, 0x3B, 0x87, 0x70, 0x44, 0x08, 0x80, 0x00, 0x00, 0x00,
+    0x00, // w
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x0C, 0xC1, 0x98, 0x1E,
+    0x01, 0x80, 0x30, 0x0F, 0x03, 0x30, 0x66, 0x18, 0x60, 0x00, 0x00, 0x00,
+    0x00, // x
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x18, 0xC3, 0x0C, 0x61, 0x98, 0x33,
+    0x03, 0x60, 0x6C, 0x0D, 0x80, 0xE0, 0x1C, 0x03, 0x80, 0xE0, 0x7C, 0x0E,
+    0x00, // y
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x9F, 0xF0, 0x0C, 0x03,
+    0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xFF, 0x9F, 0xF0, 0x00, 0x00, 0x00,
+    0x00, // z
+    0x03, 0x80, 0xF0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x70, 0x1C,
+    0x03, 0x80, 0x38, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0x80,
+    0x70, // {
+    0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06,
+    0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00,
+    0xC0, // |
+    0x38, 0x07, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x70, 0x07,
+    0x00, 0xE0, 0x38, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x3C, 0x07,
+    0x00, // }
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC4, 0x7F,
+    0x88, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, // ~
+    0x00, 0x00
 };
 
-FontDef_s Font_07x10 = {10, 7, FontData_07x10};
-FontDef_s Font_11x18 = {18, 11, FontData_11x18};
-FontDef_s Font_16x26 = {26, 16, FontData_16x26};
\ No newline at end of file
+static const uint16_t FontOffset_11x18[] = {
+    0, 25, 50, 75, 100, 125, 150, 175, 200, 225, 250, 275,
+    300, 325, 350, 375, 400, 425, 450, 475, 500, 525, 550, 575,
+    600, 625, 650, 675, 700, 725, 750, 775, 800, 825, 850, 875,
+    900, 925, 950, 975, 1000, 1025, 1050, 1075, 1100, 1125, 1150, 1175,
+    1200, 1225, 1250, 1275, 1300, 1325, 1350, 1375, 1400, 1425, 1450, 1475,
+    1500, 1525, 1550, 1575, 1600, 1625, 1650, 1675, 1700, 1725, 1750, 1775,
+    1800, 1825, 1850, 1875, 1900, 1925, 1950, 1975, 2000, 2025, 2050, 2075,
+    2100, 2125, 2150, 2175, 2200, 2225, 2250, 2275, 2300, 2325, 2350,
+};
+
+static const uint8_t FontBitmap_16x26[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // sp
+    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0,
+    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x01, 0xC0, 0x01, 0xC0,
+    0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // !
+    0x1E, 0x3C, 0x1E, 0x3C, 0x1E, 0x3C, 0x1E, 0x3C, 0x1E, 0x3C, 0x1E, 0x3C,
+    0x1E, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // "
+    0x01, 0xCE, 0x03, 0xCE, 0x03, 0xDE, 0x03, 0x9E, 0x03, 0x9C, 0x07, 0x9C,
+    0x3F, 0xFF, 0x7F, 0xFF, 0x07, 0x38, 0x0F, 0x38, 0x0F, 0x78, 0x0F, 0x78,
+    0x0E, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0xF0, 0x1C, 0xF0, 0x1C, 0xE0,
+    0x3C, 0xE0, 0x3D, 0xE0, 0x39, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // #
+    0x03, 0xFC, 0x0F, 0xFE, 0x1F, 0xEE, 0x1E, 0xE0, 0x1E, 0xE0, 0x1E, 0xE0,
+    0x1E, 0xE0, 0x1F, 0xE0, 0x0F, 0xE0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xFC,
+    0x01, 0xFE, 0x01, 0xFE, 0x01, 0xFE, 0x01, 0xFE, 0x01, 0xFE, 0x01, 0xFE,
+    0x3D, 0xFE, 0x3F, 0xFC, 0x0F, 0xF0, 0x01, 0xE0, 0x01, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // $
+    0x3E, 0x03, 0xF7, 0x07, 0xE7, 0x8F, 0xE7, 0x8E, 0xE3, 0x9E, 0xE3, 0xBC,
+    0xE7, 0xB8, 0xE7, 0xF8, 0xF7, 0xF0, 0x3F, 0xE0, 0x01, 0xC0, 0x03, 0xFF,
+    0x07, 0xFF, 0x07, 0xF3, 0x0F, 0xF3, 0x1E, 0xF3, 0x3C, 0xF3, 0x38, 0xF3,
+    0x78, 0xF3, 0xF0, 0x7F, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // %
+    0x07, 0xE0, 0x0F, 0xF8, 0x0F, 0x78, 0x1F, 0x78, 0x1F, 0x78, 0x1F, 0x78,
+    0x0F, 0x78, 0x0F, 0xF0, 0x0F, 0xE0, 0x1F, 0x80, 0x7F, 0xC3, 0xFB, 0xC3,
+    0xF3, 0xE7, 0xF1, 0xF7, 0xF0, 0xF7, 0xF0, 0xFF, 0xF0, 0x7F, 0xF8, 0x3E,
+    0x7C, 0x7F, 0x3F, 0xFF, 0x1F, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // &
+    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xC0,
+    0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // '
+    0x00, 0x3F, 0x00, 0x7C, 0x01, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0xC0,
+    0x07, 0x80, 0x07, 0x80, 0x0F, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00,
+    0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x07, 0x80, 0x07, 0x80,
+    0x07, 0xC0, 0x03, 0xC0, 0x01, 0xE0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x3F,
+    0x00, 0x0F, 0x00, 0x00, // (
+    0x7E, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x03, 0xC0, 0x01, 0xE0, 0x01, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78,
+    0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0xF0,
+    0x01, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0xC0, 0x1F, 0x00, 0x7E, 0x00,
+    0x78, 0x00, 0x00, 0x00, // )
+    0x03, 0xE0, 0x03, 0xC0, 0x01, 0xC0, 0x39, 0xCE, 0x3F, 0xFF, 0x3F, 0x7F,
+    0x03, 0x20, 0x03, 0x70, 0x07, 0xF8, 0x0F, 0x78, 0x1F, 0x3C, 0x06, 0x38,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // *
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0,
+    0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0,
+    0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // +
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0,
+    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0,
+    0x01, 0xC0, 0x03, 0x80, // ,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE,
+    0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // -
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0,
+    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // .
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x3C,
+    0x00, 0x78, 0x00, 0x78, 0x00, 0xF0, 0x00, 0xF0, 0x01, 0xE0, 0x01, 0xE0,
+    0x03, 0xC0, 0x03, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x0F, 0x00, 0x0F, 0x00,
+    0x1E, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x78, 0x00,
+    0xF0, 0x00, 0x00, 0x00, // /
+    0x07, 0xF0, 0x0F, 0xF8, 0x1F, 0x7C, 0x3E, 0x3E, 0x3C, 0x1E, 0x7C, 0x1F,
+    0x7C, 0x1F, 0x78, 0x0F, 0x78, 0x0F, 0x78, 0x0F, 0x78, 0x0F, 0x78, 0x0F,
+    0x78, 0x0F, 0x78, 0x0F, 0x7C, 0x1F, 0x7C, 0x1F, 0x3C, 0x1E, 0x3E, 0x3E,
+    0x1F, 0x7C, 0x0F, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // 0
+    0x00, 0xF0, 0x07, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x01, 0xF0, 0x01, 0xF0,
+    0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0,
+    0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0,
+    0x01, 0xF0, 0x3F, 0xFF, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // 1
+    0x0F, 0xE0, 0x3F, 0xF8, 0x3C, 0x7C, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x3E,
+    0x00, 0x3E, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0,
+    0x03, 0xE0, 0x07, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3E, 0x00,
+    0x3C, 0x00, 0x3F, 0xFE, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // 2
+    0x0F, 0xF0, 0x1F, 0xF8, 0x1C, 0x7C, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E,
+    0x00, 0x3C, 0x00, 0x3C, 0x00, 0xF8, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x7C,
+    0x00, 0x3E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x3E,
+    0x1C, 0x7C, 0x1F, 0xF8, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // 3
+    0x00, 0x78, 0x00, 0xF8, 0x00, 0xF8, 0x01, 0xF8, 0x03, 0xF8, 0x07, 0xF8,
+    0x07, 0xF8, 0x0F, 0x78, 0x1E, 0x78, 0x1E, 0x78, 0x3C, 0x78, 0x78, 0x78,
+    0x78, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78,
+    0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // 4
+    0x1F, 0xFC, 0x1F, 0xFC, 0x1F, 0xFC, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
+    0x1E, 0x00, 0x1E, 0x00, 0x1F, 0xE0, 0x1F, 0xF8, 0x00, 0xFC, 0x00, 0x7C,
+    0x00, 0x3E, 0x00, 0x3E, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3C,
+    0x1C, 0x7C, 0x1F, 0xF8, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // 5
+    0x01, 0xFC, 0x07, 0xFE, 0x0F, 0x8E, 0x1F, 0x00, 0x1E, 0x00, 0x3E, 0x00,
+    0x3C, 0x00, 0x3C, 0x00, 0x3D, 0xF8, 0x3F, 0xFC, 0x7F, 0x3E, 0x7E, 0x1F,
+    0x3C, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F, 0x3E, 0x0F, 0x1E, 0x1F,
+    0x1F, 0x3E, 0x0F, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // 6
+    0x3F, 0xFF, 0x3F, 0xFF, 0x3F, 0xFF, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x1E,
+    0x00, 0x3C, 0x00, 0x38, 0x00, 0x78, 0x00, 0xF0, 0x00, 0xF0, 0x01, 0xE0,
+    0x01, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x80, 0x0F, 0x80,
+    0x0F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // 7
+    0x07, 0xF8, 0x0F, 0xFC, 0x1F, 0x3E, 0x1E, 0x1E, 0x3E, 0x1E, 0x3E, 0x1E,
+    0x1E, 0x1E, 0x1F, 0x3C, 0x0F, 0xF8, 0x07, 0xF0, 0x0F, 0xF8, 0x1E, 0xFC,
+    0x3E, 0x3E, 0x3C, 0x1F, 0x7C, 0x1F, 0x7C, 0x0F, 0x7C, 0x0F, 0x3C, 0x1F,
+    0x3F, 0x3E, 0x1F, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // 8
+    0x07, 0xF0, 0x0F, 0xF8, 0x1E, 0x7C, 0x3C, 0x3E, 0x3C, 0x1E, 0x7C, 0x1F,
+    0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x3C, 0x1F, 0x3E, 0x3F, 0x1F, 0xFF,
+    0x07, 0xEF, 0x00, 0x1F, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0x3C,
+    0x38, 0xF8, 0x3F, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // 9
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0,
+    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // :
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0,
+    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0,
+    0x03, 0xC0, 0x03, 0x80, // ;
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0,
+    0x3F, 0x00, 0xFE, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC,
+    0x00, 0x3F, 0x00, 0x0F, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // <
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // =
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8,
+    0x00, 0x7E, 0x00, 0x1F, 0x00, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80,
+    0x7E, 0x00, 0xF8, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // >
+    0x1F, 0xF0, 0x3F, 0xFC, 0x38, 0x3E, 0x38, 0x1F, 0x38, 0x1F, 0x00, 0x1E,
+    0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0,
+    0x03, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // ?
+    0x03, 0xF8, 0x0F, 0xFE, 0x1F, 0x1E, 0x3E, 0x0F, 0x3C, 0x7F, 0x78, 0xFF,
+    0x79, 0xEF, 0x73, 0xC7, 0xF3, 0xC7, 0xF3, 0x8F, 0xF3, 0x8F, 0xF3, 0x8F,
+    0xF3, 0x9F, 0xF3, 0x9F, 0x73, 0xFF, 0x7B, 0xFF, 0x79, 0xF7, 0x3C, 0x00,
+    0x1F, 0x1C, 0x0F, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // @
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x07, 0xF0,
+    0x07, 0xF0, 0x07, 0xF0, 0x0F, 0x78, 0x0F, 0x78, 0x0E, 0x7C, 0x1E, 0x3C,
+    0x1E, 0x3C, 0x3C, 0x3E, 0x3F, 0xFE, 0x3F, 0xFF, 0x78, 0x1F, 0x78, 0x0F,
+    0xF0, 0x0F, 0xF0, 0x07, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // A
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xFC, 0x3C, 0x3E,
+    0x3C, 0x1E, 0x3C, 0x1E, 0x3C, 0x1E, 0x3C, 0x3E, 0x3C, 0x7C, 0x3F, 0xF0,
+    0x3F, 0xF8, 0x3C, 0x7E, 0x3C, 0x1F, 0x3C, 0x1F, 0x3C, 0x0F, 0x3C, 0x0F,
+    0x3C, 0x1F, 0x3F, 0xFE, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // B
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x07, 0xFF, 0x1F, 0x87,
+    0x3E, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00,
+    0x78, 0x00, 0x78, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x3F, 0x00,
+    0x1F, 0x83, 0x07, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // C
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xFC, 0x78, 0x7E,
+    0x78, 0x1F, 0x78, 0x1F, 0x78, 0x0F, 0x78, 0x0F, 0x78, 0x0F, 0x78, 0x0F,
+    0x78, 0x0F, 0x78, 0x0F, 0x78, 0x0F, 0x78, 0x0F, 0x78, 0x1F, 0x78, 0x1E,
+    0x78, 0x7E, 0x7F, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // D
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x3F, 0xFF, 0x3E, 0x00,
+    0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3F, 0xFE,
+    0x3F, 0xFE, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00,
+    0x3E, 0x00, 0x3F, 0xFF, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // E
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x1F, 0xFF, 0x1E, 0x00,
+    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1F, 0xFF,
+    0x1F, 0xFF, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
+    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // F
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x0F, 0xFF, 0x1F, 0x87,
+    0x3E, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x78, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+    0xF8, 0x7F, 0xF8, 0x7F, 0x78, 0x0F, 0x7C, 0x0F, 0x7C, 0x0F, 0x3E, 0x0F,
+    0x1F, 0x8F, 0x0F, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // G
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F,
+    0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7F, 0xFF,
+    0x7F, 0xFF, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F,
+    0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // H
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x3F, 0xFF, 0x03, 0xE0,
+    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0,
+    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0,
+    0x03, 0xE0, 0x3F, 0xFF, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // I
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x1F, 0xFC, 0x00, 0x7C,
+    0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C,
+    0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x78, 0x00, 0x78,
+    0x38, 0xF8, 0x3F, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // J
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x1F, 0x3C, 0x1E, 0x3C, 0x3C,
+    0x3C, 0x78, 0x3C, 0xF0, 0x3D, 0xE0, 0x3F, 0xE0, 0x3F, 0xC0, 0x3F, 0x80,
+    0x3F, 0xC0, 0x3F, 0xE0, 0x3D, 0xF0, 0x3C, 0xF0, 0x3C, 0x78, 0x3C, 0x7C,
+    0x3C, 0x3E, 0x3C, 0x1F, 0x3C, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // K
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00,
+    0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00,
+    0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00,
+    0x3E, 0x00, 0x3F, 0xFF, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // L
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0xFC, 0x1F, 0xFC, 0x1F,
+    0xFE, 0x3F, 0xFE, 0x3F, 0xFE, 0x3F, 0xFF, 0x7F, 0xFF, 0x77, 0xFF, 0x77,
+    0xF7, 0xF7, 0xF7, 0xE7, 0xF3, 0xE7, 0xF3, 0xE7, 0xF3, 0xC7, 0xF0, 0x07,
+    0xF0, 0x07, 0xF0, 0x07, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // M
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0x7C, 0x0F, 0x7E, 0x0F,
+    0x7F, 0x0F, 0x7F, 0x0F, 0x7F, 0x8F, 0x7F, 0x8F, 0x7F, 0xCF, 0x7B, 0xEF,
+    0x79, 0xEF, 0x79, 0xFF, 0x78, 0xFF, 0x78, 0xFF, 0x78, 0x7F, 0x78, 0x3F,
+    0x78, 0x3F, 0x78, 0x1F, 0x78, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // N
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xFC, 0x3E, 0x3E,
+    0x7C, 0x1F, 0x78, 0x0F, 0x78, 0x0F, 0xF8, 0x0F, 0xF8, 0x0F, 0xF8, 0x0F,
+    0xF8, 0x0F, 0xF8, 0x0F, 0xF8, 0x0F, 0x78, 0x0F, 0x78, 0x0F, 0x7C, 0x1F,
+    0x3E, 0x3E, 0x1F, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // O
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xFF, 0x3E, 0x1F,
+    0x3E, 0x0F, 0x3E, 0x0F, 0x3E, 0x0F, 0x3E, 0x0F, 0x3E, 0x1F, 0x3E, 0x3F,
+    0x3F, 0xFC, 0x3F, 0xF0, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00,
+    0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // P
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xFC, 0x3E, 0x3E,
+    0x7C, 0x1F, 0x78, 0x0F, 0x78, 0x0F, 0xF8, 0x0F, 0xF8, 0x0F, 0xF8, 0x0F,
+    0xF8, 0x0F, 0xF8, 0x0F, 0xF8, 0x0F, 0x78, 0x0F, 0x78, 0x0F, 0x7C, 0x1F,
+    0x3E, 0x3E, 0x1F, 0xFC, 0x07, 0xF8, 0x00, 0x7C, 0x00, 0x3F, 0x00, 0x0F,
+    0x00, 0x03, 0x00, 0x00, // Q
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xFC, 0x3C, 0x7E,
+    0x3C, 0x3E, 0x3C, 0x1E, 0x3C, 0x1E, 0x3C, 0x3E, 0x3C, 0x3C, 0x3C, 0xFC,
+    0x3F, 0xF0, 0x3F, 0xE0, 0x3D, 0xF0, 0x3C, 0xF8, 0x3C, 0x7C, 0x3C, 0x3E,
+    0x3C, 0x1E, 0x3C, 0x1F, 0x3C, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // R
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x1F, 0xFE, 0x3E, 0x0E,
+    0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x1F, 0xC0, 0x0F, 0xF8,
+    0x03, 0xFE, 0x00, 0x7F, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x0F, 0x20, 0x1F,
+    0x3C, 0x3E, 0x3F, 0xFC, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // S
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xE0,
+    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0,
+    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0,
+    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // T
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0x7C, 0x0F, 0x7C, 0x0F,
+    0x7C, 0x0F, 0x7C, 0x0F, 0x7C, 0x0F, 0x7C, 0x0F, 0x7C, 0x0F, 0x7C, 0x0F,
+    0x7C, 0x0F, 0x7C, 0x0F, 0x7C, 0x0F, 0x7C, 0x0F, 0x3C, 0x1E, 0x3C, 0x1E,
+    0x3E, 0x3E, 0x1F, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // U
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0xF0, 0x07, 0xF8, 0x07,
+    0x78, 0x0F, 0x7C, 0x0F, 0x3C, 0x1E, 0x3C, 0x1E, 0x3E, 0x1E, 0x1E, 0x3C,
+    0x1F, 0x3C, 0x1F, 0x78, 0x0F, 0x78, 0x0F, 0xF8, 0x07, 0xF0, 0x07, 0xF0,
+    0x07, 0xF0, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // V
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0xF0, 0x03, 0xF0, 0x03,
+    0xF0, 0x07, 0xF3, 0xE7, 0xF3, 0xE7, 0xF3, 0xE7, 0x73, 0xE7, 0x7B, 0xF7,
+    0x7F, 0xF7, 0x7F, 0xFF, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x3F, 0x7E,
+    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // W
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x7C, 0x0F, 0x3E, 0x1E,
+    0x3E, 0x3E, 0x1F, 0x3C, 0x0F, 0xF8, 0x07, 0xF0, 0x07, 0xE0, 0x03, 0xE0,
+    0x03, 0xE0, 0x07, 0xF0, 0x0F, 0xF8, 0x0F, 0x7C, 0x1E, 0x7C, 0x3C, 0x3E,
+    0x78, 0x1F, 0x78, 0x0F, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // X
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x78, 0x07, 0x7C, 0x0F,
+    0x3C, 0x1E, 0x3E, 0x1E, 0x1F, 0x3C, 0x0F, 0x78, 0x0F, 0xF8, 0x07, 0xF0,
+    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0,
+    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // Y
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x7F, 0xFF, 0x00, 0x0F,
+    0x00, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0xF0, 0x01, 0xE0,
+    0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3E, 0x00,
+    0x7C, 0x00, 0x7F, 0xFF, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // Z
+    0x07, 0xFF, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80,
+    0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80,
+    0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80,
+    0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0xFF,
+    0x07, 0xFF, 0x00, 0x00, // [
+    0x78, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x1E, 0x00,
+    0x0F, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x07, 0x80, 0x03, 0xC0, 0x03, 0xC0,
+    0x01, 0xE0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x78,
+    0x00, 0x3C, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x0F,
+    0x00, 0x07, 0x00, 0x00, /* \ */
+    0x7F, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x7F, 0xF0,
+    0x7F, 0xF0, 0x00, 0x00, // ]
+    0x00, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x03, 0xE0, 0x03, 0xE0, 0x07, 0xF0,
+    0x07, 0xF0, 0x07, 0x78, 0x0F, 0x78, 0x0F, 0x38, 0x1E, 0x3C, 0x1E, 0x3C,
+    0x3C, 0x1E, 0x3C, 0x1E, 0x38, 0x0F, 0x78, 0x0F, 0x78, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // ^
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // _
+    0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // `
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xF8, 0x3F, 0xFC, 0x3C, 0x7C, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E,
+    0x07, 0xFE, 0x1F, 0xFE, 0x3E, 0x3E, 0x7C, 0x3E, 0x78, 0x3E, 0x7C, 0x3E,
+    0x7C, 0x7E, 0x3F, 0xFF, 0x1F, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // a
+    0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00,
+    0x3D, 0xF8, 0x3F, 0xFE, 0x3F, 0x3E, 0x3E, 0x1F, 0x3C, 0x0F, 0x3C, 0x0F,
+    0x3C, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F, 0x3C, 0x1F, 0x3C, 0x1E,
+    0x3F, 0x3E, 0x3F, 0xFC, 0x3B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // b
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFE, 0x0F, 0xFF, 0x1F, 0x87, 0x3E, 0x00, 0x3E, 0x00, 0x3C, 0x00,
+    0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x3E, 0x00,
+    0x1F, 0x87, 0x0F, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // c
+    0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F,
+    0x07, 0xFF, 0x1F, 0xFF, 0x3E, 0x3F, 0x3C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F,
+    0x7C, 0x1F, 0x78, 0x1F, 0x78, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x3C, 0x3F,
+    0x3E, 0x7F, 0x1F, 0xFF, 0x0F, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // d
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xF8, 0x0F, 0xFC, 0x1F, 0x3E, 0x3E, 0x1E, 0x3C, 0x1F, 0x7C, 0x1F,
+    0x7F, 0xFF, 0x7F, 0xFF, 0x7C, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x3E, 0x00,
+    0x1F, 0x07, 0x0F, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // e
+    0x01, 0xFF, 0x03, 0xE1, 0x03, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0,
+    0x7F, 0xFF, 0x7F, 0xFF, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0,
+    0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0,
+    0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // f
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xEF, 0x1F, 0xFF, 0x3E, 0x7F, 0x3C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F,
+    0x78, 0x1F, 0x78, 0x1F, 0x78, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x3C, 0x3F,
+    0x3E, 0x7F, 0x1F, 0xFF, 0x0F, 0xDF, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E,
+    0x38, 0x7C, 0x3F, 0xF8, // g
+    0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00,
+    0x3D, 0xFC, 0x3F, 0xFE, 0x3F, 0x9E, 0x3F, 0x1F, 0x3E, 0x1F, 0x3C, 0x1F,
+    0x3C, 0x1F, 0x3C, 0x1F, 0x3C, 0x1F, 0x3C, 0x1F, 0x3C, 0x1F, 0x3C, 0x1F,
+    0x3C, 0x1F, 0x3C, 0x1F, 0x3C, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // h
+    0x01, 0xF0, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xE0, 0x7F, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0,
+    0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0,
+    0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // i
+    0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+    0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+    0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF0,
+    0x71, 0xF0, 0x7F, 0xE0, // j
+    0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00,
+    0x3C, 0x1F, 0x3C, 0x3E, 0x3C, 0x7C, 0x3C, 0xF8, 0x3D, 0xF0, 0x3D, 0xE0,
+    0x3F, 0xC0, 0x3F, 0xC0, 0x3F, 0xE0, 0x3D, 0xF0, 0x3C, 0xF8, 0x3C, 0x7C,
+    0x3C, 0x3E, 0x3C, 0x1F, 0x3C, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // k
+    0x7F, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0,
+    0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0,
+    0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0,
+    0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // l
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF7, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xE7, 0xF9, 0xE7,
+    0xF1, 0xC7, 0xF1, 0xC7, 0xF1, 0xC7, 0xF1, 0xC7, 0xF1, 0xC7, 0xF1, 0xC7,
+    0xF1, 0xC7, 0xF1, 0xC7, 0xF1, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // m
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3D, 0xFC, 0x3F, 0xFE, 0x3F, 0x9E, 0x3F, 0x1F, 0x3E, 0x1F, 0x3C, 0x1F,
+    0x3C, 0x1F, 0x3C, 0x1F, 0x3C, 0x1F, 0x3C, 0x1F, 0x3C, 0x1F, 0x3C, 0x1F,
+    0x3C, 0x1F, 0x3C, 0x1F, 0x3C, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // n
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xF0, 0x1F, 0xFC, 0x3E, 0x3E, 0x3C, 0x1F, 0x7C, 0x1F, 0x78, 0x0F,
+    0x78, 0x0F, 0x78, 0x0F, 0x78, 0x0F, 0x78, 0x0F, 0x7C, 0x1F, 0x3C, 0x1F,
+    0x3E, 0x3E, 0x1F, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // o
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3D, 0xF8, 0x3F, 0xFE, 0x3F, 0x3E, 0x3E, 0x1F, 0x3C, 0x0F, 0x3C, 0x0F,
+    0x3C, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F, 0x3C, 0x1F, 0x3E, 0x1E,
+    0x3F, 0x3E, 0x3F, 0xFC, 0x3F, 0xF8, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00,
+    0x3C, 0x00, 0x3C, 0x00, // p
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xEE, 0x1F, 0xFE, 0x3E, 0x7E, 0x3C, 0x1E, 0x7C, 0x1E, 0x78, 0x1E,
+    0x78, 0x1E, 0x78, 0x1E, 0x78, 0x1E, 0x78, 0x1E, 0x7C, 0x1E, 0x7C, 0x3E,
+    0x3E, 0x7E, 0x1F, 0xFE, 0x0F, 0xDE, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E,
+    0x00, 0x1E, 0x00, 0x1E, // q
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x7F, 0x1F, 0xFF, 0x1F, 0xE7, 0x1F, 0xC7, 0x1F, 0x87, 0x1F, 0x00,
+    0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00,
+    0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // r
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFC, 0x1F, 0xFE, 0x1E, 0x0E, 0x3E, 0x00, 0x3E, 0x00, 0x3F, 0x00,
+    0x1F, 0xE0, 0x07, 0xFC, 0x00, 0xFE, 0x00, 0x3E, 0x00, 0x1E, 0x00, 0x1E,
+    0x3C, 0x3E, 0x3F, 0xFC, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // s
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80,
+    0x7F, 0xFF, 0x7F, 0xFF, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80,
+    0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80,
+    0x07, 0xC0, 0x03, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // t
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3C, 0x1E, 0x3C, 0x1E, 0x3C, 0x1E, 0x3C, 0x1E, 0x3C, 0x1E, 0x3C, 0x1E,
+    0x3C, 0x1E, 0x3C, 0x1E, 0x3C, 0x1E, 0x3C, 0x1E, 0x3C, 0x3E, 0x3C, 0x7E,
+    0x3E, 0xFE, 0x1F, 0xFE, 0x0F, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // u
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x07, 0x78, 0x0F, 0x78, 0x0F, 0x3C, 0x1E, 0x3C, 0x1E, 0x3E, 0x1E,
+    0x1E, 0x3C, 0x1E, 0x3C, 0x0F, 0x78, 0x0F, 0x78, 0x0F, 0xF0, 0x07, 0xF0,
+    0x07, 0xF0, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // v
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x03, 0xF1, 0xE3, 0xF3, 0xE3, 0xF3, 0xE7, 0xF3, 0xF7, 0xF3, 0xF7,
+    0x7F, 0xF7, 0x7F, 0x77, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3E, 0x3E,
+    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // w
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x0F, 0x3E, 0x1E, 0x3E, 0x3C, 0x1F, 0x3C, 0x0F, 0xF8, 0x07, 0xF0,
+    0x07, 0xF0, 0x03, 0xE0, 0x07, 0xF0, 0x07, 0xF8, 0x0F, 0xF8, 0x1E, 0x7C,
+    0x3E, 0x3E, 0x3C, 0x1F, 0x78, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // x
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x07, 0x78, 0x0F, 0x7C, 0x0F, 0x3C, 0x1E, 0x3C, 0x1E, 0x1E, 0x3C,
+    0x1E, 0x3C, 0x1F, 0x3C, 0x0F, 0x78, 0x0F, 0xF8, 0x07, 0xF0, 0x07, 0xF0,
+    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0x80,
+    0x0F, 0x80, 0x7F, 0x00, // y
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0x3F, 0xFF, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8,
+    0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x1E, 0x00,
+    0x3C, 0x00, 0x7F, 0xFF, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // z
+    0x01, 0xFE, 0x03, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+    0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xC0, 0x03, 0xC0, 0x3F, 0x80,
+    0x3F, 0x80, 0x03, 0xC0, 0x01, 0xC0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0,
+    0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x01, 0xFE,
+    0x00, 0x7E, 0x00, 0x00, // {
+    0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0,
+    0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0,
+    0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0,
+    0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0,
+    0x01, 0xC0, 0x00, 0x00, // |
+    0x3F, 0xC0, 0x03, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0,
+    0x01, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x01, 0xC0, 0x01, 0xE0, 0x00, 0xFE,
+    0x00, 0xFE, 0x01, 0xE0, 0x01, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x01, 0xC0,
+    0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x03, 0xE0, 0x3F, 0xC0,
+    0x3F, 0x00, 0x00, 0x00, // }
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x07,
+    0x7F, 0xC7, 0x73, 0xE7, 0xF1, 0xFF, 0xF0, 0x7E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // ~
+    0x00, 0x00
+};
+
+static const uint16_t FontOffset_16x26[] = {
+    0, 52, 104, 156, 208, 260, 312, 364, 416, 468, 520, 572,
+    624, 676, 728, 780, 832, 884, 936, 988, 1040, 1092, 1144, 1196,
+    1248, 1300, 1352, 1404, 1456, 1508, 1560, 1612, 1664, 1716, 1768, 1820,
+    1872, 1924, 1976, 2028, 2080, 2132, 2184, 2236, 2288, 2340, 2392, 2444,
+    2496, 2548, 2600, 2652, 2704, 2756, 2808, 2860, 2912, 2964, 3016, 3068,
+    3120, 3172, 3224, 3276, 3328, 3380, 3432, 3484, 3536, 3588, 3640, 3692,
+    3744, 3796, 3848, 3900, 3952, 4004, 4056, 4108, 4160, 4212, 4264, 4316,
+    4368, 4420, 4472, 4524, 4576, 4628, 4680, 4732, 4784, 4836, 4888,
+};
+
+static const uint8_t FontBitmap_07x10P[] = {
+    // sp
+    0xFD, // !
+    0xB6, 0x80, // "
+    0x4A, 0x7E, 0x99, 0x7E, 0x52, // #
+    0x75, 0x68, 0xE2, 0xD6, 0xAE, 0x20, // $
+    0x45, 0x6C, 0xC5, 0x54, 0xA2, // %
+    0x22, 0x94, 0x46, 0xCA, 0x4D, // &
+    0xE0, // '
+    0x2A, 0x49, 0x24, 0x44, // (
+    0x88, 0x92, 0x49, 0x50, // )
+    0x5D, 0x50, // *
+    0x21, 0x3E, 0x42, 0x00, // +
+    0xE0, // ,
+    0xE0, // -
+    0x80, // .
+    0x25, 0x24, 0xA4, // /
+    0x74, 0x63, 0x58, 0xC6, 0x2E, // 0
+    0x2E, 0x92, 0x49, // 1
+    0x74, 0x62, 0x11, 0x11, 0x1F, // 2
+    0x74, 0x42, 0x60, 0x86, 0x2E, // 3
+    0x11, 0x94, 0xA9, 0x7C, 0x42, // 4
+    0xFC, 0x21, 0xE0, 0x86, 0x2E, // 5
+    0x74, 0x61, 0xE8, 0xC6, 0x2E, // 6
+    0xF8, 0x44, 0x42, 0x21, 0x08, // 7
+    0x74, 0x62, 0xE8, 0xC6, 0x2E, // 8
+    0x74, 0x63, 0x17, 0x86, 0x2E, // 9
+    0x84, // :
+    0x8E, // ;
+    0x1B, 0x20, 0xC1, 0x80, // <
+    0xF8, 0x3E, // =
+    0xC1, 0x82, 0x6C, 0x00, // >
+    0x74, 0x42, 0x22, 0x10, 0x04, // ?
+    0x74, 0x67, 0x5B, 0xC2, 0x0E, // @
+    0x22, 0x94, 0xA5, 0x7E, 0x31, // A
+    0xF4, 0x63, 0xE8, 0xC6, 0x3E, // B
+    0x74, 0x61, 0x08, 0x42, 0x2E, // C
+    0xE4, 0xA3, 0x18, 0xC6, 0x5C, // D
+    0xFC, 0x21, 0xF8, 0x42, 0x1F, // E
+    0xFC, 0x21, 0xE8, 0x42, 0x10, // F
+    0x74, 0x61, 0x0B, 0xC6, 0x2E, // G
+    0x8C, 0x63, 0xF8, 0xC6, 0x31, // H
+    0xE9, 0x24, 0x97, // I
+    0x08, 0x42, 0x10, 0x86, 0x2E, // J
+    0x8C, 0xA9, 0x8A, 0x4A, 0x51, // K
+    0x84, 0x21, 0x08, 0x42, 0x1F, // L
+    0x8E, 0xF7, 0x58, 0xC6, 0x31, // M
+    0x8E, 0x73, 0x5A, 0xCE, 0x71, // N
+    0x74, 0x63, 0x18, 0xC6, 0x2E, // O
+    0xF4, 0x63, 0x1F, 0x42, 0x10, // P
+    0x74, 0x63, 0x18, 0xC6, 0xAE, 0x08, // Q
+    0xF4, 0x63, 0x1F, 0x4A, 0x51, // R
+    0x74, 0x60, 0xC1, 0x06, 0x2E, // S
+    0xF9, 0x08, 0x42, 0x10, 0x84, // T
+    0x8C, 0x63, 0x18, 0xC6, 0x2E, // U
+    0x8C, 0x62, 0xA5, 0x28, 0x84, // V
+    0x8C, 0x6B, 0x5A, 0xED, 0x4A, // W
+    0x8A, 0x94, 0x42, 0x29, 0x51, // X
+    0x8C, 0x54, 0xA2, 0x10, 0x84, // Y
+    0xF8, 0x44, 0x42, 0x22, 0x1F, // Z
+    0xEA, 0xAA, 0xB0, // [
+    0x91, 0x24, 0x89, /* \ */
+    0xD5, 0x55, 0x70, // ]
+    0x22, 0x95, 0x10, // ^
+    0xFE, // _
+    0x90, // `
+    0x74, 0x5F, 0x19, 0xB4, // a
+    0x84, 0x2D, 0x98, 0xC7, 0x36, // b
+    0x74, 0x61, 0x08, 0xB8, // c
+    0x08, 0x5B, 0x38, 0xC6, 0x6D, // d
+    0x74, 0x7F, 0x08, 0xB8, // e
+    0x19, 0x3E, 0x42, 0x10, 0x84, // f
+    0x6C, 0xE3, 0x19, 0xB4, 0x3E, // g
+    0x84, 0x2D, 0x98, 0xC6, 0x31, // h
+    0x23, 0x92, 0x49, // i
+    0x10, 0x71, 0x11, 0x11, 0x1E, // j
+    0x84, 0x25, 0x4C, 0x52, 0x51, // k
+    0xE4, 0x92, 0x49, // l
+    0xF5, 0x6B, 0x5A, 0xD4, // m
+    0xB6, 0x63, 0x18, 0xC4, // n
+    0x74, 0x63, 0x18, 0xB8, // o
+    0xB6, 0x63, 0x1C, 0xDA, 0x10, // p
+    0x6C, 0xE3, 0x19, 0xB4, 0x21, // q
+    0xB6, 0x61, 0x08, 0x40, // r
+    0x74, 0x58, 0x28, 0xB8, // s
+    0x44, 0xF4, 0x44, 0x43, // t
+    0x8C, 0x63, 0x19, 0xB4, // u
+    0x8C, 0x54, 0xA5, 0x10, // v
+    0xAD, 0x6B, 0xB5, 0x28, // w
+    0x8A, 0x88, 0x45, 0x44, // x
+    0x8C, 0x54, 0xA2, 0x10, 0x98, // y
+    0xF8, 0x88, 0x88, 0x7C, // z
+    0x69, 0x29, 0x12, 0x4C, // {
+    0xFF, 0xC0, // |
+    0xC9, 0x22, 0x52, 0x58, // }
+    0xEC, 0xC0, // ~
+    0x00, 0x00
+};
+
+static const uint16_t FontOffset_07x10P[] = {
+    0, 0, 1, 3, 8, 14, 19, 24, 25, 29, 33, 35,
+    39, 40, 41, 42, 45, 50, 53, 58, 63, 68, 73, 78,
+    83, 88, 93, 94, 95, 99, 101, 105, 110, 115, 120, 125,
+    130, 135, 140, 145, 150, 155, 158, 163, 168, 173, 178, 183,
+    188, 193, 199, 204, 209, 214, 219, 224, 229, 234, 239, 244,
+    247, 250, 253, 256, 257, 258, 262, 267, 271, 276, 280, 285,
+    290, 295, 298, 303, 308, 311, 315, 319, 323, 328, 333, 337,
+    341, 345, 349, 353, 357, 361, 366, 370, 374, 376, 380,
+};
+
+static const FontGlyph_s FontGlyphs_07x10P[] = {
+    {3, 0, 0, 0, 0}, // sp
+    {2, 0, 0, 1, 8}, // !
+    {4, 0, 0, 3, 3}, // "
+    {6, 0, 0, 5, 8}, // #
+    {6, 0, 0, 5, 9}, // $
+    {6, 0, 0, 5, 8}, // %
+    {6, 0, 0, 5, 8}, // &
+    {2, 0, 0, 1, 3}, // '
+    {4, 0, 0, 3, 10}, // (
+    {4, 0, 0, 3, 10}, // )
+    {4, 0, 0, 3, 4}, // *
+    {6, 0, 2, 5, 5}, // +
+    {2, 0, 7, 1, 3}, // ,
+    {4, 0, 5, 3, 1}, // -
+    {2, 0, 7, 1, 1}, // .
+    {4, 0, 0, 3, 8}, // /
+    {6, 0, 0, 5, 8}, // 0
+    {4, 0, 0, 3, 8}, // 1
+    {6, 0, 0, 5, 8}, // 2
+    {6, 0, 0, 5, 8}, // 3
+    {6, 0, 0, 5, 8}, // 4
+    {6, 0, 0, 5, 8}, // 5
+    {6, 0, 0, 5, 8}, // 6
+    {6, 0, 0, 5, 8}, // 7
+    {6, 0, 0, 5, 8}, // 8
+    {6, 0, 0, 5, 8}, // 9
+    {2, 0, 2, 1, 6}, // :
+    {2, 0, 3, 1, 7}, // ;
+    {6, 0, 2, 5, 5}, // <
+    {6, 0, 3, 5, 3}, // =
+    {6, 0, 2, 5, 5}, // >
+    {6, 0, 0, 5, 8}, // ?
+    {6, 0, 0, 5, 8}, // @
+    {6, 0, 0, 5, 8}, // A
+    {6, 0, 0, 5, 8}, // B
+    {6, 0, 0, 5, 8}, // C
+    {6, 0, 0, 5, 8}, // D
+    {6, 0, 0, 5, 8}, // E
+    {6, 0, 0, 5, 8}, // F
+    {6, 0, 0, 5, 8}, // G
+    {6, 0, 0, 5, 8}, // H
+    {4, 0, 0, 3, 8}, // I
+    {6, 0, 0, 5, 8}, // J
+    {6, 0, 0, 5, 8}, // K
+    {6, 0, 0, 5, 8}, // L
+    {6, 0, 0, 5, 8}, // M
+    {6, 0, 0, 5, 8}, // N
+    {6, 0, 0, 5, 8}, // O
+    {6, 0, 0, 5, 8}, // P
+    {6, 0, 0, 5, 9}, // Q
+    {6, 0, 0, 5, 8}, // R
+    {6, 0, 0, 5, 8}, // S
+    {6, 0, 0, 5, 8}, // T
+    {6, 0, 0, 5, 8}, // U
+    {6, 0, 0, 5, 8}, // V
+    {6, 0, 0, 5, 8}, // W
+    {6, 0, 0, 5, 8}, // X
+    {6, 0, 0, 5, 8}, // Y
+    {6, 0, 0, 5, 8}, // Z
+    {3, 0, 0, 2, 10}, // [
+    {4, 0, 0, 3, 8}, /* \ */
+    {3, 0, 0, 2, 10}, // ]
+    {6, 0, 0, 5, 4}, // ^
+    {8, 0, 9, 7, 1}, // _
+    {3, 0, 0, 2, 2}, // `
+    {6, 0, 2, 5, 6}, // a
+    {6, 0, 0, 5, 8}, // b
+    {6, 0, 2, 5, 6}, // c
+    {6, 0, 0, 5, 8}, // d
+    {6, 0, 2, 5, 6}, // e
+    {6, 0, 0, 5, 8}, // f
+    {6, 0, 2, 5, 8}, // g
+    {6, 0, 0, 5, 8}, // h
+    {4, 0, 0, 3, 8}, // i
+    {5, 0, 0, 4, 10}, // j
+    {6, 0, 0, 5, 8}, // k
+    {4, 0, 0, 3, 8}, // l
+    {6, 0, 2, 5, 6}, // m
+    {6, 0, 2, 5, 6}, // n
+    {6, 0, 2, 5, 6}, // o
+    {6, 0, 2, 5, 8}, // p
+    {6, 0, 2, 5, 8}, // q
+    {6, 0, 2, 5, 6}, // r
+    {6, 0, 2, 5, 6}, // s
+    {5, 0, 0, 4, 8}, // t
+    {6, 0, 2, 5, 6}, // u
+    {6, 0, 2, 5, 6}, // v
+    {6, 0, 2, 5, 6}, // w
+    {6, 0, 2, 5, 6}, // x
+    {6, 0, 2, 5, 8}, // y
+    {6, 0, 2, 5, 6}, // z
+    {4, 0, 0, 3, 10}, // {
+    {2, 0, 0, 1, 10}, // |
+    {4, 0, 0, 3, 10}, // }
+    {6, 0, 3, 5, 2}, // ~
+};
+
+static const uint8_t FontBitmap_11x18P[] = {
+    // sp
+    0xFF, 0xFF, 0xFC, 0xF0, // !
+    0xDE, 0xF7, 0xBD, 0x80, // "
+    0x33, 0x19, 0x8C, 0xC6, 0x6F, 0xFF, 0xFC, 0xCC, 0xCC, 0xFF, 0xFF, 0xD9,
+    0x8C, 0xC6, 0x63, 0x30, // #
+    0x3C, 0x7E, 0xEB, 0xCB, 0xE8, 0x78, 0x3C, 0x0E, 0x0B, 0xCB, 0xCB, 0xEB,
+    0x7E, 0x3C, 0x08, 0x08, // $
+    0x70, 0x36, 0x0D, 0x87, 0x63, 0xD9, 0x9C, 0xC0, 0x60, 0x30, 0x1B, 0x8D,
+    0xB6, 0x6D, 0x1B, 0x06, 0xC0, 0xE0, // %
+    0x3C, 0x3F, 0x19, 0x8C, 0xC6, 0x61, 0xE0, 0x60, 0xF3, 0xCD, 0xE3, 0xB0,
+    0xD8, 0xE7, 0xD9, 0xC8, // &
+    0xFF, 0xC0, // '
+    0x08, 0x8C, 0xC6, 0x23, 0x18, 0xC6, 0x31, 0x84, 0x31, 0x86, 0x10, 0x40, // (
+    0x82, 0x18, 0x63, 0x08, 0x63, 0x18, 0xC6, 0x31, 0x18, 0xCC, 0x44, 0x00, // )
+    0x32, 0xDF, 0xDE, 0xCC, // *
+    0x0C, 0x03, 0x00, 0xC0, 0x30, 0xFF, 0xFF, 0xF0, 0xC0, 0x30, 0x0C, 0x03,
+    0x00, // +
+    0xF5, 0x80, // ,
+    0xFF, // -
+    0xF0, // .
+    0x18, 0xC6, 0x63, 0x18, 0xCC, 0x63, 0x19, 0x8C, 0x60, // /
+    0x3C, 0x7E, 0x66, 0xC3, 0xC3, 0xC3, 0xDB, 0xDB, 0xC3, 0xC3, 0xC3, 0x66,
+    0x7E, 0x3C, // 0
+    0x19, 0xDF, 0xB9, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, // 1
+    0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0,
+    0xFF, 0xFF, // 2
+    0x38, 0x7C, 0xC6, 0xC6, 0x06, 0x1C, 0x1C, 0x06, 0x03, 0x03, 0xC3, 0xE7,
+    0x7E, 0x3C, // 3
+    0x0C, 0x1C, 0x1C, 0x3C, 0x3C, 0x2C, 0x6C, 0x6C, 0xCC, 0xFF, 0xFF, 0x0C,
+    0x0C, 0x0C, // 4
+    0xFE, 0xFE, 0xC0, 0xC0, 0xC0, 0xDC, 0xFE, 0xC7, 0x03, 0x03, 0xC3, 0xE7,
+    0x7E, 0x3C, // 5
+    0x3C, 0x7E, 0x67, 0xC3, 0xC0, 0xDC, 0xFE, 0xE7, 0xC3, 0xC3, 0xC3, 0x67,
+    0x7E, 0x3C, // 6
+    0xFF, 0xFF, 0x03, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x18, 0x18, 0x10, 0x30,
+    0x30, 0x30, // 7
+    0x3C, 0x7E, 0xC7, 0xC3, 0xC3, 0x42, 0x3C, 0x7E, 0xC3, 0xC3, 0xC3, 0xC3,
+    0x7E, 0x3C, // 8
+    0x3C, 0x7E, 0xE6, 0xC3, 0xC3, 0xC3, 0xE7, 0x7F, 0x3B, 0x03, 0xC3, 0xE6,
+    0x7E, 0x3C, // 9
+    0xF0, 0x00, 0xF0, // :
+    0xF0, 0x03, 0xD6, // ;
+    0x01, 0x07, 0x1C, 0x70, 0xC0, 0x70, 0x1C, 0x07, 0x01, // <
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, // =
+    0x80, 0xE0, 0x38, 0x0E, 0x03, 0x0E, 0x38, 0xE0, 0x80, // >
+    0x3E, 0x3F, 0xB8, 0xF8, 0x30, 0x18, 0x1C, 0x1C, 0x1C, 0x1C, 0x0C, 0x06,
+    0x00, 0x01, 0x80, 0xC0, // ?
+    0x3C, 0x7E, 0x63, 0xE3, 0xC7, 0xDF, 0xDB, 0xDB, 0xDF, 0xCF, 0xC0, 0x64,
+    0x7C, 0x38, // @
+    0x1C, 0x0E, 0x0D, 0x86, 0xC3, 0x61, 0xB1, 0x8C, 0xC6, 0x7F, 0x3F, 0x98,
+    0xD8, 0x3C, 0x1E, 0x0C, // A
+    0xF8, 0xFC, 0xC6, 0xC6, 0xC6, 0xC6, 0xFC, 0xFC, 0xC6, 0xC3, 0xC3, 0xC7,
+    0xFE, 0xFC, // B
+    0x3C, 0x7E, 0x63, 0xC3, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC3, 0x63,
+    0x7E, 0x3C, // C
+    0xF8, 0xFE, 0xC6, 0xC7, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC6, 0xC6,
+    0xFC, 0xF8, // D
+    0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xFE, 0xFE, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xFF, 0xFF, // E
+    0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xFE, 0xFE, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC0, // F
+    0x3C, 0x7E, 0x63, 0xC3, 0xC0, 0xC0, 0xC0, 0xC7, 0xC7, 0xC3, 0xC3, 0x63,
+    0x7F, 0x3C, // G
+    0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3,
+    0xC3, 0xC3, // H
+    0xFF, 0xF3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0xFF, 0xF0, // I
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xC3, 0xC3, 0xE7,
+    0x7E, 0x3C, // J
+    0xC1, 0xE1, 0xB1, 0x99, 0x8C, 0xC6, 0xC3, 0xC1, 0xF0, 0xCC, 0x66, 0x31,
+    0x98, 0x6C, 0x36, 0x0C, // K
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xFF, 0xFF, // L
+    0xE3, 0xF1, 0xFD, 0xFE, 0xBD, 0x5E, 0xAF, 0x77, 0x93, 0xC1, 0xE0, 0xF0,
+    0x78, 0x3C, 0x1E, 0x0C, // M
+    0xE3, 0xE3, 0xF3, 0xF3, 0xF3, 0xDB, 0xDB, 0xDB, 0xCB, 0xCF, 0xCF, 0xCF,
+    0xC7, 0xC7, // N
+    0x3C, 0x7E, 0x66, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x66,
+    0x7E, 0x3C, // O
+    0xFC, 0xFE, 0xC7, 0xC3, 0xC3, 0xC3, 0xC7, 0xFE, 0xFC, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC0, // P
+    0x3C, 0x3F, 0x19, 0x98, 0x6C, 0x36, 0x1B, 0x0D, 0x86, 0xC3, 0x65, 0xB3,
+    0xCC, 0xC7, 0xF1, 0xE4, // Q
+    0xFC, 0x7F, 0x31, 0xD8, 0x6C, 0x36, 0x3B, 0xF9, 0xF8, 0xCC, 0x63, 0x31,
+    0x98, 0x6C, 0x36, 0x0C, // R
+    0x1C, 0x3E, 0x63, 0x63, 0x60, 0x70, 0x3C, 0x0E, 0x07, 0xC3, 0xC3, 0x63,
+    0x7E, 0x3C, // S
+    0xFF, 0xFF, 0xF0, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03,
+    0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, // T
+    0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7,
+    0x7E, 0x3C, // U
+    0xC1, 0xE0, 0xF0, 0x6C, 0x66, 0x33, 0x18, 0xD8, 0x6C, 0x36, 0x1B, 0x07,
+    0x03, 0x81, 0xC0, 0x40, // V
+    0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF3, 0x34, 0xC9, 0x32, 0x5E, 0x94,
+    0xA5, 0x29, 0xCE, 0x61, 0x98, 0x60, // W
+    0xC0, 0xD8, 0x26, 0x18, 0xCC, 0x3B, 0x07, 0x80, 0xC0, 0x30, 0x1E, 0x07,
+    0xC3, 0xB1, 0xC6, 0x61, 0xB0, 0x30, // X
+    0xC0, 0xD8, 0x66, 0x18, 0xCC, 0x33, 0x07, 0x81, 0xE0, 0x30, 0x0C, 0x03,
+    0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, // Y
+    0x7F, 0x7F, 0x03, 0x06, 0x06, 0x0C, 0x18, 0x18, 0x30, 0x30, 0x60, 0xC0,
+    0xFF, 0xFF, // Z
+    0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFF, // [
+    0xC6, 0x30, 0xC6, 0x31, 0x86, 0x31, 0x8C, 0x31, 0x8C, /* \ */
+    0xFF, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xFF, // ]
+    0x18, 0x18, 0x3C, 0x24, 0x66, 0x66, 0xC3, 0xC3, // ^
+    0xFF, 0xE0, // _
+    0xE6, 0x30, // `
+    0x3E, 0x3F, 0xB0, 0xC0, 0x63, 0xF3, 0xFB, 0x0D, 0x8E, 0xFF, 0x38, 0xC0, // a
+    0xC0, 0xC0, 0xC0, 0xC0, 0xDC, 0xFE, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7,
+    0xFE, 0xDC, // b
+    0x3C, 0x7E, 0xE7, 0xC3, 0xC0, 0xC0, 0xC3, 0xE7, 0x7E, 0x3C, // c
+    0x03, 0x03, 0x03, 0x03, 0x3B, 0x7F, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7,
+    0x7F, 0x3B, // d
+    0x3C, 0x7E, 0xE6, 0xC3, 0xFF, 0xFF, 0xC0, 0xE3, 0x7E, 0x3C, // e
+    0x0F, 0x8F, 0xC6, 0x03, 0x0F, 0xF7, 0xF8, 0x60, 0x30, 0x18, 0x0C, 0x06,
+    0x03, 0x01, 0x80, 0xC0, // f
+    0x3B, 0x7F, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0x7F, 0x3B, 0x03, 0xC7,
+    0xFE, 0x7C, // g
+    0xC0, 0xC0, 0xC0, 0xC0, 0xDE, 0xFF, 0xE3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+    0xC3, 0xC3, // h
+    0x18, 0xC0, 0x0F, 0xFC, 0x63, 0x18, 0xC6, 0x31, 0x8C, // i
+    0x0C, 0x30, 0x00, 0x7D, 0xF0, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xE3,
+    0xFD, 0xE0, // j
+    0xC0, 0x60, 0x30, 0x18, 0x0C, 0x36, 0x33, 0x31, 0xB0, 0xF8, 0x76, 0x31,
+    0x98, 0xCC, 0x36, 0x0C, // k
+    0xFF, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, // l
+    0xDD, 0xBF, 0xFC, 0xEF, 0x33, 0xCC, 0xF3, 0x3C, 0xCF, 0x33, 0xCC, 0xF3,
+    0x30, // m
+    0xDE, 0xFF, 0xE3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, // n
+    0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0x7E, 0x3C, // o
+    0xDC, 0xFE, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0xFE, 0xDC, 0xC0, 0xC0,
+    0xC0, 0xC0, // p
+    0x3B, 0x7F, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0x7F, 0x3B, 0x03, 0x03,
+    0x03, 0x03, // q
+    0xCE, 0x7F, 0x72, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, // r
+    0x3C, 0x7F, 0xC3, 0xC0, 0xFE, 0x7F, 0x03, 0xC3, 0xFE, 0x3C, // s
+    0x10, 0x30, 0x30, 0xFE, 0xFE, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3F,
+    0x1F, // t
+    0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC7, 0xFF, 0x7B, // u
+    0xC1, 0xB1, 0x98, 0xCC, 0x63, 0x61, 0xB0, 0xD8, 0x38, 0x1C, 0x06, 0x00, // v
+    0xDD, 0xEE, 0xF7, 0x6A, 0xA5, 0x52, 0xA9, 0xDC, 0xEE, 0x22, 0x11, 0x00, // w
+    0xC3, 0x66, 0x66, 0x3C, 0x18, 0x18, 0x3C, 0x66, 0x66, 0xC3, // x
+    0xC3, 0xC3, 0x63, 0x66, 0x66, 0x36, 0x36, 0x36, 0x1C, 0x1C, 0x1C, 0x38,
+    0xF8, 0xE0, // y
+    0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, // z
+    0x1C, 0xF3, 0x0C, 0x30, 0xC3, 0x1C, 0xE3, 0x87, 0x0C, 0x30, 0xC3, 0x0C,
+    0x3C, 0x70, // {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, // |
+    0xE3, 0xC3, 0x0C, 0x30, 0xC3, 0x0E, 0x1C, 0x73, 0x8C, 0x30, 0xC3, 0x0C,
+    0xF3, 0x80, // }
+    0x71, 0xFF, 0x8E, // ~
+    0x00, 0x00
+};
+
+static const uint16_t FontOffset_11x18P[] = {
+    0, 0, 4, 8, 24, 40, 58, 74, 76, 88, 100, 104,
+    117, 119, 120, 121, 130, 144, 153, 167, 181, 195, 209, 223,
+    237, 251, 265, 268, 271, 280, 286, 295, 311, 325, 341, 355,
+    369, 383, 397, 411, 425, 439, 450, 464, 480, 494, 510, 524,
+    538, 552, 568, 584, 598, 616, 630, 646, 664, 682, 700, 714,
+    723, 732, 741, 749, 751, 753, 765, 779, 789, 803, 813, 829,
+    843, 857, 866, 880, 896, 905, 918, 928, 938, 952, 966, 976,
+    986, 999, 1009, 1021, 1033, 1043, 1057, 1069, 1083, 1088, 1102,
+};
+
+static const FontGlyph_s FontGlyphs_11x18P[] = {
+    {5, 0, 0, 0, 0}, // sp
+    {3, 0, 1, 2, 14}, // !
+    {6, 0, 1, 5, 5}, // "
+    {10, 0, 1, 9, 14}, // #
+    {9, 0, 1, 8, 16}, // $
+    {11, 0, 1, 10, 14}, // %
+    {10, 0, 1, 9, 14}, // &
+    {3, 0, 1, 2, 5}, // '
+    {6, 0, 0, 5, 18}, // (
+    {6, 0, 0, 5, 18}, // )
+    {7, 0, 1, 6, 5}, // *
+    {11, 0, 3, 10, 10}, // +
+    {3, 0, 13, 2, 5}, // ,
+    {5, 0, 9, 4, 2}, // -
+    {3, 0, 13, 2, 2}, // .
+    {6, 0, 1, 5, 14}, // /
+    {9, 0, 1, 8, 14}, // 0
+    {6, 0, 1, 5, 14}, // 1
+    {9, 0, 1, 8, 14}, // 2
+    {9, 0, 1, 8, 14}, // 3
+    {9, 0, 1, 8, 14}, // 4
+    {9, 0, 1, 8, 14}, // 5
+    {9, 0, 1, 8, 14}, // 6
+    {9, 0, 1, 8, 14}, // 7
+    {9, 0, 1, 8, 14}, // 8
+    {9, 0, 1, 8, 14}, // 9
+    {3, 0, 5, 2, 10}, // :
+    {3, 0, 6, 2, 12}, // ;
+    {9, 0, 4, 8, 9}, // <
+    {9, 0, 5, 8, 6}, // =
+    {9, 0, 4, 8, 9}, // >
+    {10, 0, 1, 9, 14}, // ?
+    {9, 0, 1, 8, 14}, // @
+    {10, 0, 1, 9, 14}, // A
+    {9, 0, 1, 8, 14}, // B
+    {9, 0, 1, 8, 14}, // C
+    {9, 0, 1, 8, 14}, // D
+    {9, 0, 1, 8, 14}, // E
+    {9, 0, 1, 8, 14}, // F
+    {9, 0, 1, 8, 14}, // G
+    {9, 0, 1, 8, 14}, // H
+    {7, 0, 1, 6, 14}, // I
+    {9, 0, 1, 8, 14}, // J
+    {10, 0, 1, 9, 14}, // K
+    {9, 0, 1, 8, 14}, // L
+    {10, 0, 1, 9, 14}, // M
+    {9, 0, 1, 8, 14}, // N
+    {9, 0, 1, 8, 14}, // O
+    {9, 0, 1, 8, 14}, // P
+    {10, 0, 1, 9, 14}, // Q
+    {10, 0, 1, 9, 14}, // R
+    {9, 0, 1, 8, 14}, // S
+    {11, 0, 1, 10, 14}, // T
+    {9, 0, 1, 8, 14}, // U
+    {10, 0, 1, 9, 14}, // V
+    {11, 0, 1, 10, 14}, // W
+    {11, 0, 1, 10, 14}, // X
+    {11, 0, 1, 10, 14}, // Y
+    {9, 0, 1, 8, 14}, // Z
+    {5, 0, 0, 4, 18}, // [
+    {6, 0, 1, 5, 14}, /* \ */
+    {5, 0, 0, 4, 18}, // ]
+    {9, 0, 1, 8, 8}, // ^
+    {12, 0, 16, 11, 1}, // _
+    {5, 0, 1, 4, 3}, // `
+    {10, 0, 5, 9, 10}, // a
+    {9, 0, 1, 8, 14}, // b
+    {9, 0, 5, 8, 10}, // c
+    {9, 0, 1, 8, 14}, // d
+    {9, 0, 5, 8, 10}, // e
+    {10, 0, 1, 9, 14}, // f
+    {9, 0, 4, 8, 14}, // g
+    {9, 0, 1, 8, 14}, // h
+    {6, 0, 1, 5, 14}, // i
+    {7, 0, 0, 6, 18}, // j
+    {10, 0, 1, 9, 14}, // k
+    {6, 0, 1, 5, 14}, // l
+    {11, 0, 5, 10, 10}, // m
+    {9, 0, 5, 8, 10}, // n
+    {9, 0, 5, 8, 10}, // o
+    {9, 0, 4, 8, 14}, // p
+    {9, 0, 4, 8, 14}, // q
+    {9, 0, 5, 8, 10}, // r
+    {9, 0, 5, 8, 10}, // s
+    {9, 0, 2, 8, 13}, // t
+    {9, 0, 5, 8, 10}, // u
+    {10, 0, 5, 9, 10}, // v
+    {10, 0, 5, 9, 10}, // w
+    {9, 0, 5, 8, 10}, // x
+    {9, 0, 4, 8, 14}, // y
+    {10, 0, 5, 9, 10}, // z
+    {7, 0, 0, 6, 18}, // {
+    {3, 0, 0, 2, 18}, // |
+    {7, 0, 0, 6, 18}, // }
+    {9, 0, 7, 8, 3}, // ~
+};
+
+static const FontKerning_s FontKerning_11x18P[] = {
+    {',', 'T', -2},
+    {',', 'V', -2},
+    {',', 'Y', -2},
+    {',', 'f', -2},
+    {',', 'i', -2},
+    {',', 'l', -2},
+    {',', 't', -2},
+    {',', 'v', -2},
+    {'.', 'T', -2},
+    {'.', 'V', -2},
+    {'.', 'Y', -2},
+    {'.', 'f', -2},
+    {'.', 'i', -2},
+    {'.', 'l', -2},
+    {'.', 't', -2},
+    {'.', 'v', -2},
+    {'.', 'y', -2},
+    {'A', 'T', -2},
+    {'A', 'V', -2},
+    {'A', 'Y', -2},
+    {'A', 'l', -2},
+    {'A', 'v', -2},
+    {'A', 'y', -2},
+    {'B', 'Y', -2},
+    {'B', 'j', -2},
+    {'E', 'v', -2},
+    {'E', 'y', -2},
+    {'F', ',', -2},
+    {'F', '.', -2},
+    {'F', 'A', -2},
+    {'F', 'J', -2},
+    {'F', 'j', -2},
+    {'F', 'r', -2},
+    {'F', 'v', -2},
+    {'F', 'x', -2},
+    {'F', 'y', -2},
+    {'I', 'f', -2},
+    {'I', 'i', -2},
+    {'I', 't', -2},
+    {'I', 'v', -2},
+    {'I', 'y', -2},
+    {'K', 'f', -2},
+    {'K', 'i', -2},
+    {'K', 't', -2},
+    {'K', 'v', -2},
+    {'K', 'w', -2},
+    {'K', 'y', -2},
+    {'L', 'T', -2},
+    {'L', 'V', -2},
+    {'L', 'Y', -2},
+    {'L', 'f', -2},
+    {'L', 'i', -2},
+    {'L', 'l', -2},
+    {'L', 't', -2},
+    {'L', 'v', -2},
+    {'L', 'y', -2},
+    {'P', ',', -2},
+    {'P', '.', -2},
+    {'P', 'J', -2},
+    {'Q', 'T', -2},
+    {'Q', 'Y', -2},
+    {'Q', 'l', -2},
+    {'R', 'Y', -2},
+    {'T', ',', -2},
+    {'T', '.', -2},
+    {'T', 'A', -2},
+    {'T', 'J', -2},
+    {'T', 'a', -2},
+    {'T', 'c', -2},
+    {'T', 'd', -2},
+    {'T', 'e', -2},
+    {'T', 'f', -2},
+    {'T', 'g', -2},
+    {'T', 'i', -2},
+    {'T', 'j', -2},
+    {'T', 'm', -2},
+    {'T', 'n', -2},
+    {'T', 'o', -2},
+    {'T', 'p', -2},
+    {'T', 'q', -2},
+    {'T', 'r', -2},
+    {'T', 's', -2},
+    {'T', 't', -2},
+    {'T', 'u', -2},
+    {'T', 'v', -2},
+    {'T', 'w', -2},
+    {'T', 'x', -2},
+    {'T', 'y', -2},
+    {'T', 'z', -2},
+    {'V', ',', -2},
+    {'V', '.', -2},
+    {'V', 'A', -2},
+    {'V', 'J', -2},
+    {'X', 'f', -2},
+    {'X', 'i', -2},
+    {'X', 't', -2},
+    {'X', 'v', -2},
+    {'X', 'w', -2},
+    {'Y', ',', -2},
+    {'Y', '.', -2},
+    {'Y', 'A', -2},
+    {'Y', 'J', -2},
+    {'Y', 'S', -2},
+    {'Y', 'a', -2},
+    {'Y', 'c', -2},
+    {'Y', 'd', -2},
+    {'Y', 'e', -2},
+    {'Y', 'f', -2},
+    {'Y', 'g', -2},
+    {'Y', 'i', -2},
+    {'Y', 'j', -2},
+    {'Y', 'm', -2},
+    {'Y', 'n', -2},
+    {'Y', 'o', -2},
+    {'Y', 'q', -2},
+    {'Y', 'r', -2},
+    {'Y', 's', -2},
+    {'Y', 't', -2},
+    {'Y', 'u', -2},
+    {'Y', 'v', -2},
+    {'Y', 'w', -2},
+    {'Y', 'x', -2},
+    {'Y', 'z', -2},
+    {'a', 'T', -2},
+    {'a', 'V', -2},
+    {'a', 'Y', -2},
+    {'a', 'l', -2},
+    {'b', 'T', -2},
+    {'b', 'Y', -2},
+    {'b', 'j', -2},
+    {'b', 'l', -2},
+    {'c', 'T', -2},
+    {'c', 'Y', -2},
+    {'c', 'j', -2},
+    {'c', 'l', -2},
+    {'e', 'T', -2},
+    {'e', 'V', -2},
+    {'e', 'Y', -2},
+    {'e', 'j', -2},
+    {'e', 'l', -2},
+    {'f', ',', -2},
+    {'f', '.', -2},
+    {'f', 'A', -2},
+    {'f', 'J', -2},
+    {'f', 'j', -2},
+    {'g', 'T', -2},
+    {'g', 'l', -2},
+    {'h', 'T', -2},
+    {'h', 'Y', -2},
+    {'h', 'l', -2},
+    {'k', 'T', -2},
+    {'k', 'V', -2},
+    {'k', 'Y', -2},
+    {'k', 'l', -2},
+    {'m', 'T', -2},
+    {'m', 'Y', -2},
+    {'m', 'l', -2},
+    {'n', 'T', -2},
+    {'n', 'Y', -2},
+    {'n', 'l', -2},
+    {'o', 'T', -2},
+    {'o', 'Y', -2},
+    {'o', 'j', -2},
+    {'o', 'l', -2},
+    {'p', 'T', -2},
+    {'p', 'Y', -2},
+    {'p', 'l', -2},
+    {'q', 'T', -2},
+    {'q', 'l', -2},
+    {'r', ',', -2},
+    {'r', '.', -2},
+    {'r', 'I', -2},
+    {'r', 'J', -2},
+    {'r', 'T', -2},
+    {'r', 'X', -2},
+    {'r', 'Y', -2},
+    {'r', 'Z', -2},
+    {'r', 'l', -2},
+    {'s', 'T', -2},
+    {'s', 'Y', -2},
+    {'s', 'l', -2},
+    {'t', 'T', -2},
+    {'t', 'V', -2},
+    {'t', 'Y', -2},
+    {'t', 'l', -2},
+    {'u', 'T', -2},
+    {'u', 'Y', -2},
+    {'u', 'l', -2},
+    {'v', ',', -2},
+    {'v', '.', -2},
+    {'v', 'A', -2},
+    {'v', 'I', -2},
+    {'v', 'J', -2},
+    {'v', 'T', -2},
+    {'v', 'X', -2},
+    {'v', 'Y', -2},
+    {'v', 'Z', -2},
+    {'v', 'l', -2},
+    {'w', 'T', -2},
+    {'w', 'X', -2},
+    {'w', 'Y', -2},
+    {'w', 'l', -2},
+    {'x', 'T', -2},
+    {'x', 'Y', -2},
+    {'x', 'l', -2},
+    {'y', ',', -2},
+    {'y', '.', -2},
+    {'y', 'I', -2},
+    {'y', 'T', -2},
+    {'y', 'l', -2},
+    {'z', 'T', -2},
+    {'z', 'Y', -2},
+    {'z', 'l', -2},
+};
+
+static const uint8_t FontBitmap_16x26P[] = {
+    // sp
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x9C, 0xE7, 0x39, 0xC0, 0x00, 0x3F,
+    0xFF, 0x80, // !
+    0xF1, 0xFE, 0x3F, 0xC7, 0xF8, 0xFF, 0x1F, 0xE3, 0xFC, 0x78, // "
+    0x01, 0xCE, 0x03, 0xCE, 0x03, 0xDE, 0x03, 0x9E, 0x03, 0x9C, 0x07, 0x9C,
+    0x3F, 0xFF, 0x7F, 0xFF, 0x07, 0x38, 0x0F, 0x38, 0x0F, 0x78, 0x0F, 0x78,
+    0x0E, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0xF0, 0x1C, 0xF0, 0x1C, 0xE0,
+    0x3C, 0xE0, 0x3D, 0xE0, 0x39, 0xE0, // #
+    0x0F, 0xF1, 0xFF, 0xDF, 0xEE, 0xF7, 0x07, 0xB8, 0x3D, 0xC1, 0xEE, 0x0F,
+    0xF0, 0x3F, 0x80, 0xFC, 0x03, 0xF0, 0x0F, 0xE0, 0x7F, 0x83, 0xFC, 0x1F,
+    0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xFD, 0xFF, 0xFF, 0xE3, 0xFC, 0x03, 0xC0,
+    0x1E, 0x00, // $
+    0x3E, 0x03, 0xF7, 0x07, 0xE7, 0x8F, 0xE7, 0x8E, 0xE3, 0x9E, 0xE3, 0xBC,
+    0xE7, 0xB8, 0xE7, 0xF8, 0xF7, 0xF0, 0x3F, 0xE0, 0x01, 0xC0, 0x03, 0xFF,
+    0x07, 0xFF, 0x07, 0xF3, 0x0F, 0xF3, 0x1E, 0xF3, 0x3C, 0xF3, 0x38, 0xF3,
+    0x78, 0xF3, 0xF0, 0x7F, 0xE0, 0x3F, // %
+    0x07, 0xE0, 0x0F, 0xF8, 0x0F, 0x78, 0x1F, 0x78, 0x1F, 0x78, 0x1F, 0x78,
+    0x0F, 0x78, 0x0F, 0xF0, 0x0F, 0xE0, 0x1F, 0x80, 0x7F, 0xC3, 0xFB, 0xC3,
+    0xF3, 0xE7, 0xF1, 0xF7, 0xF0, 0xF7, 0xF0, 0xFF, 0xF0, 0x7F, 0xF8, 0x3E,
+    0x7C, 0x7F, 0x3F, 0xFF, 0x1F, 0xEF, // &
+    0xFF, 0xFF, 0xFF, 0xF9, 0xC0, // '
+    0x03, 0xF0, 0x7C, 0x1F, 0x01, 0xE0, 0x3C, 0x07, 0xC0, 0x78, 0x07, 0x80,
+    0xF8, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x80,
+    0x78, 0x07, 0x80, 0x7C, 0x03, 0xC0, 0x1E, 0x01, 0xF0, 0x07, 0xC0, 0x3F,
+    0x00, 0xF0, // (
+    0xFC, 0x03, 0xE0, 0x0F, 0x80, 0x78, 0x03, 0xC0, 0x3E, 0x01, 0xE0, 0x1E,
+    0x01, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x1F,
+    0x01, 0xE0, 0x1E, 0x03, 0xE0, 0x3C, 0x07, 0x80, 0xF8, 0x3E, 0x0F, 0xC0,
+    0xF0, 0x00, // )
+    0x0F, 0x80, 0x3C, 0x00, 0x70, 0x39, 0xCE, 0xFF, 0xFF, 0xF7, 0xF0, 0xC8,
+    0x03, 0x70, 0x1F, 0xE0, 0xF7, 0x87, 0xCF, 0x06, 0x38, // *
+    0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0,
+    0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0,
+    0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, // +
+    0xFF, 0xFF, 0xF7, 0xBD, 0xEE, 0xE0, // ,
+    0xFF, 0xFF, 0xFF, 0xC0, // -
+    0xFF, 0xFF, 0xF0, // .
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x3C,
+    0x00, 0x78, 0x00, 0x78, 0x00, 0xF0, 0x00, 0xF0, 0x01, 0xE0, 0x01, 0xE0,
+    0x03, 0xC0, 0x03, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x0F, 0x00, 0x0F, 0x00,
+    0x1E, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x78, 0x00,
+    0xF0, 0x00, // /
+    0x0F, 0xE0, 0x3F, 0xE0, 0xFB, 0xE3, 0xE3, 0xE7, 0x83, 0xDF, 0x07, 0xFE,
+    0x0F, 0xF8, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F, 0xC0, 0x7F, 0x80, 0xFF, 0x01,
+    0xFE, 0x03, 0xFE, 0x0F, 0xFC, 0x1F, 0x78, 0x3C, 0xF8, 0xF8, 0xFB, 0xE0,
+    0xFF, 0x80, 0xFE, 0x00, // 0
+    0x03, 0xC0, 0x7F, 0x0F, 0xFC, 0x3F, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C,
+    0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F,
+    0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x3F, 0xFF, 0xFF,
+    0xFC, // 1
+    0x3F, 0x87, 0xFF, 0x3C, 0x7C, 0x01, 0xE0, 0x0F, 0x80, 0x7C, 0x03, 0xE0,
+    0x1E, 0x00, 0xF0, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0x78,
+    0x07, 0x80, 0x78, 0x07, 0xC0, 0x3C, 0x01, 0xFF, 0xFF, 0xFF, 0x80, // 2
+    0x7F, 0x8F, 0xFC, 0xE3, 0xE0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xE0, 0x1E,
+    0x07, 0xC7, 0xF8, 0x7F, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
+    0x00, 0xF0, 0x1F, 0xE3, 0xEF, 0xFC, 0xFF, 0x00, // 3
+    0x00, 0x78, 0x00, 0xF8, 0x00, 0xF8, 0x01, 0xF8, 0x03, 0xF8, 0x07, 0xF8,
+    0x07, 0xF8, 0x0F, 0x78, 0x1E, 0x78, 0x1E, 0x78, 0x3C, 0x78, 0x78, 0x78,
+    0x78, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78,
+    0x00, 0x78, 0x00, 0x78, 0x00, 0x78, // 4
+    0xFF, 0xEF, 0xFE, 0xFF, 0xEF, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00,
+    0xFF, 0x0F, 0xFC, 0x07, 0xE0, 0x3E, 0x01, 0xF0, 0x1F, 0x00, 0xF0, 0x1F,
+    0x01, 0xF0, 0x1E, 0xE3, 0xEF, 0xFC, 0xFF, 0x00, // 5
+    0x03, 0xF8, 0x1F, 0xF8, 0x7C, 0x71, 0xF0, 0x03, 0xC0, 0x0F, 0x80, 0x1E,
+    0x00, 0x3C, 0x00, 0x7B, 0xF0, 0xFF, 0xF3, 0xF9, 0xF7, 0xE1, 0xF7, 0x81,
+    0xEF, 0x03, 0xDE, 0x07, 0xBC, 0x0F, 0x7C, 0x1E, 0x78, 0x7C, 0xF9, 0xF0,
+    0xFF, 0xC0, 0x7E, 0x00, // 6
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0x00, 0x78, 0x01, 0xE0, 0x0F,
+    0x00, 0x38, 0x01, 0xE0, 0x0F, 0x00, 0x3C, 0x01, 0xE0, 0x07, 0x80, 0x3C,
+    0x00, 0xF0, 0x07, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xC0, 0x1F, 0x00, 0x7C,
+    0x00, // 7
+    0x0F, 0xF0, 0x3F, 0xF0, 0xF9, 0xF1, 0xE1, 0xE7, 0xC3, 0xCF, 0x87, 0x8F,
+    0x0F, 0x1F, 0x3C, 0x1F, 0xF0, 0x1F, 0xC0, 0x7F, 0xC1, 0xEF, 0xC7, 0xC7,
+    0xCF, 0x07, 0xFE, 0x0F, 0xFC, 0x0F, 0xF8, 0x1E, 0xF0, 0x7D, 0xF9, 0xF1,
+    0xFF, 0xC0, 0xFE, 0x00, // 8
+    0x0F, 0xE0, 0x3F, 0xE0, 0xF3, 0xE3, 0xC3, 0xE7, 0x83, 0xDF, 0x07, 0xFE,
+    0x0F, 0xFC, 0x1F, 0xF8, 0x3E, 0xF0, 0x7D, 0xF1, 0xF9, 0xFF, 0xF0, 0xFD,
+    0xE0, 0x07, 0xC0, 0x0F, 0x00, 0x1E, 0x00, 0x7C, 0x00, 0xF1, 0xC7, 0xC3,
+    0xFF, 0x03, 0xFC, 0x00, // 9
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, // :
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xEF, 0x7B, 0xFD,
+    0xC0, // ;
+    0x00, 0x03, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0,
+    0x3F, 0x00, 0xFE, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC,
+    0x00, 0x3F, 0x00, 0x0F, 0x00, 0x03, // <
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, // =
+    0xE0, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8,
+    0x00, 0x7E, 0x00, 0x1F, 0x00, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80,
+    0x7E, 0x00, 0xF8, 0x00, 0xE0, 0x00, // >
+    0x7F, 0xC3, 0xFF, 0xCE, 0x0F, 0xB8, 0x1F, 0xE0, 0x7C, 0x01, 0xE0, 0x07,
+    0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x0F, 0x00, 0x7C,
+    0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x07, 0xC0, 0x1F,
+    0x00, // ?
+    0x03, 0xF8, 0x0F, 0xFE, 0x1F, 0x1E, 0x3E, 0x0F, 0x3C, 0x7F, 0x78, 0xFF,
+    0x79, 0xEF, 0x73, 0xC7, 0xF3, 0xC7, 0xF3, 0x8F, 0xF3, 0x8F, 0xF3, 0x8F,
+    0xF3, 0x9F, 0xF3, 0x9F, 0x73, 0xFF, 0x7B, 0xFF, 0x79, 0xF7, 0x3C, 0x00,
+    0x1F, 0x1C, 0x0F, 0xFC, 0x03, 0xF8, // @
+    0x03, 0xE0, 0x03, 0xE0, 0x07, 0xF0, 0x07, 0xF0, 0x07, 0xF0, 0x0F, 0x78,
+    0x0F, 0x78, 0x0E, 0x7C, 0x1E, 0x3C, 0x1E, 0x3C, 0x3C, 0x3E, 0x3F, 0xFE,
+    0x3F, 0xFF, 0x78, 0x1F, 0x78, 0x0F, 0xF0, 0x0F, 0xF0, 0x07, 0xF0, 0x07, // A
+    0xFF, 0xE3, 0xFF, 0xCF, 0x0F, 0xBC, 0x1E, 0xF0, 0x7B, 0xC1, 0xEF, 0x0F,
+    0xBC, 0x7C, 0xFF, 0xC3, 0xFF, 0x8F, 0x1F, 0xBC, 0x1F, 0xF0, 0x7F, 0xC0,
+    0xFF, 0x03, 0xFC, 0x1F, 0xFF, 0xFB, 0xFF, 0x80, // B
+    0x03, 0xFE, 0x1F, 0xFC, 0xFC, 0x3B, 0xE0, 0x07, 0x80, 0x1F, 0x00, 0x3C,
+    0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0xC0, 0x0F, 0x80,
+    0x0F, 0x80, 0x1F, 0x80, 0x1F, 0x83, 0x0F, 0xFE, 0x07, 0xFC, // C
+    0xFF, 0xE1, 0xFF, 0xF3, 0xC3, 0xF7, 0x81, 0xFF, 0x03, 0xFE, 0x03, 0xFC,
+    0x07, 0xF8, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F, 0xC0, 0x7F, 0x80, 0xFF, 0x01,
+    0xFE, 0x07, 0xFC, 0x0F, 0x78, 0x7E, 0xFF, 0xF1, 0xFF, 0x80, // D
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80,
+    0x3E, 0x00, 0xFF, 0xFB, 0xFF, 0xEF, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0,
+    0x0F, 0x80, 0x3E, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, // E
+    0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0,
+    0x1E, 0x00, 0xF0, 0x07, 0x80, 0x00, // F
+    0x03, 0xFE, 0x0F, 0xFF, 0x1F, 0x87, 0x3E, 0x00, 0x7C, 0x00, 0x7C, 0x00,
+    0x78, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x7F, 0xF8, 0x7F, 0x78, 0x0F,
+    0x7C, 0x0F, 0x7C, 0x0F, 0x3E, 0x0F, 0x1F, 0x8F, 0x0F, 0xFF, 0x03, 0xFE, // G
+    0xF8, 0x3F, 0xF0, 0x7F, 0xE0, 0xFF, 0xC1, 0xFF, 0x83, 0xFF, 0x07, 0xFE,
+    0x0F, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xC1, 0xFF, 0x83,
+    0xFF, 0x07, 0xFE, 0x0F, 0xFC, 0x1F, 0xF8, 0x3F, 0xF0, 0x7C, // H
+    0xFF, 0xFF, 0xFF, 0xF0, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8,
+    0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E,
+    0x00, 0xF8, 0x03, 0xE0, 0xFF, 0xFF, 0xFF, 0xF0, // I
+    0x7F, 0xF7, 0xFF, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F,
+    0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1E, 0x01, 0xEE, 0x3E,
+    0xFF, 0xCF, 0xF0, // J
+    0xF0, 0x7F, 0xC1, 0xEF, 0x0F, 0x3C, 0x78, 0xF3, 0xC3, 0xDE, 0x0F, 0xF8,
+    0x3F, 0xC0, 0xFE, 0x03, 0xFC, 0x0F, 0xF8, 0x3D, 0xF0, 0xF3, 0xC3, 0xC7,
+    0x8F, 0x1F, 0x3C, 0x3E, 0xF0, 0x7F, 0xC0, 0xF0, // K
+    0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80,
+    0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0,
+    0x0F, 0x80, 0x3E, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, // L
+    0xF8, 0x1F, 0xFC, 0x1F, 0xFC, 0x1F, 0xFE, 0x3F, 0xFE, 0x3F, 0xFE, 0x3F,
+    0xFF, 0x7F, 0xFF, 0x77, 0xFF, 0x77, 0xF7, 0xF7, 0xF7, 0xE7, 0xF3, 0xE7,
+    0xF3, 0xE7, 0xF3, 0xC7, 0xF0, 0x07, 0xF0, 0x07, 0xF0, 0x07, 0xF0, 0x07, // M
+    0xF8, 0x1F, 0xF0, 0x3F, 0xF0, 0x7F, 0xF0, 0xFF, 0xE1, 0xFF, 0xE3, 0xFF,
+    0xC7, 0xFF, 0xCF, 0xF7, 0xDF, 0xE7, 0xBF, 0xCF, 0xFF, 0x8F, 0xFF, 0x1F,
+    0xFE, 0x1F, 0xFC, 0x1F, 0xF8, 0x3F, 0xF0, 0x3F, 0xE0, 0x7C, // N
+    0x07, 0xF0, 0x1F, 0xFC, 0x3E, 0x3E, 0x7C, 0x1F, 0x78, 0x0F, 0x78, 0x0F,
+    0xF8, 0x0F, 0xF8, 0x0F, 0xF8, 0x0F, 0xF8, 0x0F, 0xF8, 0x0F, 0xF8, 0x0F,
+    0x78, 0x0F, 0x78, 0x0F, 0x7C, 0x1F, 0x3E, 0x3E, 0x1F, 0xFC, 0x07, 0xF0, // O
+    0xFF, 0xF3, 0xFF, 0xFF, 0x87, 0xFE, 0x0F, 0xF8, 0x3F, 0xE0, 0xFF, 0x83,
+    0xFE, 0x1F, 0xF8, 0xFF, 0xFF, 0xCF, 0xFC, 0x3E, 0x00, 0xF8, 0x03, 0xE0,
+    0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x00, // P
+    0x07, 0xF0, 0x1F, 0xFC, 0x3E, 0x3E, 0x7C, 0x1F, 0x78, 0x0F, 0x78, 0x0F,
+    0xF8, 0x0F, 0xF8, 0x0F, 0xF8, 0x0F, 0xF8, 0x0F, 0xF8, 0x0F, 0xF8, 0x0F,
+    0x78, 0x0F, 0x78, 0x0F, 0x7C, 0x1F, 0x3E, 0x3E, 0x1F, 0xFC, 0x07, 0xF8,
+    0x00, 0x7C, 0x00, 0x3F, 0x00, 0x0F, 0x00, 0x03, // Q
+    0xFF, 0xC3, 0xFF, 0xCF, 0x1F, 0xBC, 0x3E, 0xF0, 0x7B, 0xC1, 0xEF, 0x0F,
+    0xBC, 0x3C, 0xF3, 0xF3, 0xFF, 0x0F, 0xF8, 0x3D, 0xF0, 0xF3, 0xE3, 0xC7,
+    0xCF, 0x0F, 0xBC, 0x1E, 0xF0, 0x7F, 0xC0, 0xF0, // R
+    0x1F, 0xF1, 0xFF, 0xEF, 0x83, 0xBC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x80,
+    0x1F, 0xC0, 0x3F, 0xE0, 0x3F, 0xE0, 0x1F, 0xC0, 0x1F, 0x00, 0x3C, 0x00,
+    0xF8, 0x07, 0xFC, 0x3E, 0xFF, 0xF1, 0xFF, 0x00, // S
+    0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0,
+    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0,
+    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, // T
+    0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE,
+    0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81,
+    0xEF, 0x07, 0x9E, 0x0F, 0x3E, 0x3E, 0x3F, 0xF8, 0x1F, 0xC0, // U
+    0xF0, 0x07, 0xF0, 0x07, 0xF8, 0x07, 0x78, 0x0F, 0x7C, 0x0F, 0x3C, 0x1E,
+    0x3C, 0x1E, 0x3E, 0x1E, 0x1E, 0x3C, 0x1F, 0x3C, 0x1F, 0x78, 0x0F, 0x78,
+    0x0F, 0xF8, 0x07, 0xF0, 0x07, 0xF0, 0x07, 0xF0, 0x03, 0xE0, 0x03, 0xE0, // V
+    0xE0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x07, 0xF3, 0xE7, 0xF3, 0xE7,
+    0xF3, 0xE7, 0x73, 0xE7, 0x7B, 0xF7, 0x7F, 0xF7, 0x7F, 0xFF, 0x7F, 0x7F,
+    0x7F, 0x7F, 0x7F, 0x7E, 0x3F, 0x7E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, // W
+    0xF8, 0x07, 0x7C, 0x0F, 0x3E, 0x1E, 0x3E, 0x3E, 0x1F, 0x3C, 0x0F, 0xF8,
+    0x07, 0xF0, 0x07, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x07, 0xF0, 0x0F, 0xF8,
+    0x0F, 0x7C, 0x1E, 0x7C, 0x3C, 0x3E, 0x78, 0x1F, 0x78, 0x0F, 0xF0, 0x0F, // X
+    0xF8, 0x07, 0x78, 0x07, 0x7C, 0x0F, 0x3C, 0x1E, 0x3E, 0x1E, 0x1F, 0x3C,
+    0x0F, 0x78, 0x0F, 0xF8, 0x07, 0xF0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0,
+    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, // Y
+    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x78, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00,
+    0x7C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x01, 0xE0,
+    0x07, 0x80, 0x1F, 0x00, 0x7C, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, // Z
+    0xFF, 0xFE, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0,
+    0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E,
+    0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0xFF, 0xFF, 0xE0, // [
+    0xF0, 0x01, 0xE0, 0x01, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0x80, 0x07,
+    0x80, 0x0F, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x3C,
+    0x00, 0x78, 0x00, 0x78, 0x00, 0xF0, 0x00, 0xF0, 0x01, 0xE0, 0x01, 0xE0,
+    0x03, 0xC0, 0x03, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x0F, 0x00, 0x0E, /* \ */
+    0xFF, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01,
+    0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0,
+    0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x7F, 0xFF, 0xFF, 0xE0, // ]
+    0x01, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x3E, 0x00, 0x7C, 0x01, 0xFC, 0x03,
+    0xF8, 0x07, 0x78, 0x1E, 0xF0, 0x3C, 0xE0, 0xF1, 0xE1, 0xE3, 0xC7, 0x83,
+    0xCF, 0x07, 0x9C, 0x07, 0xF8, 0x0F, 0xF0, 0x0E, // ^
+    0xFF, 0xFF, 0xFF, 0xFF, // _
+    0xF0, // `
+    0x1F, 0xF0, 0xFF, 0xF1, 0xE3, 0xE0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x83,
+    0xFF, 0x1F, 0xFE, 0x7C, 0x7D, 0xF0, 0xFB, 0xC1, 0xF7, 0xC3, 0xEF, 0x8F,
+    0xCF, 0xFF, 0xCF, 0xE7, 0x80, // a
+    0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x7E,
+    0x3F, 0xFE, 0xFC, 0xFB, 0xE1, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0,
+    0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x7F, 0xC1, 0xEF, 0xCF, 0xBF, 0xFC, 0xEF,
+    0xC0, // b
+    0x07, 0xFC, 0x3F, 0xFC, 0xFC, 0x3B, 0xE0, 0x07, 0xC0, 0x0F, 0x00, 0x3E,
+    0x00, 0x7C, 0x00, 0xF8, 0x00, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x03, 0xF0,
+    0xE3, 0xFF, 0xC1, 0xFF, 0x00, // c
+    0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC3,
+    0xFF, 0x9F, 0xFF, 0x7C, 0x7E, 0xF0, 0x7F, 0xE0, 0xFF, 0xC1, 0xFF, 0x83,
+    0xFE, 0x07, 0xFC, 0x0F, 0xFC, 0x1F, 0xF8, 0x3E, 0xF0, 0xFD, 0xF3, 0xF9,
+    0xFF, 0xF1, 0xFB, 0xE0, // d
+    0x07, 0xF0, 0x3F, 0xF0, 0xF9, 0xF3, 0xE1, 0xE7, 0x83, 0xFF, 0x07, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xF0, 0x01, 0xE0, 0x03, 0xE0, 0x03, 0xE0,
+    0xE3, 0xFF, 0xC1, 0xFF, 0x00, // e
+    0x03, 0xFE, 0x0F, 0x84, 0x1E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8,
+    0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00,
+    0x7C, 0x00, 0xF8, 0x00, // f
+    0x0F, 0xDE, 0x7F, 0xFD, 0xF3, 0xFB, 0xC1, 0xFF, 0x83, 0xFF, 0x07, 0xFC,
+    0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xF0, 0x7F, 0xE0, 0xFB, 0xC3, 0xF7, 0xCF,
+    0xE7, 0xFF, 0xC7, 0xEF, 0x80, 0x1E, 0x00, 0x3C, 0x00, 0x79, 0xC3, 0xE3,
+    0xFF, 0x80, // g
+    0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x7F,
+    0x3F, 0xFE, 0xFE, 0x7B, 0xF1, 0xFF, 0x87, 0xFC, 0x1F, 0xF0, 0x7F, 0xC1,
+    0xFF, 0x07, 0xFC, 0x1F, 0xF0, 0x7F, 0xC1, 0xFF, 0x07, 0xFC, 0x1F, 0xF0,
+    0x7C, // h
+    0x03, 0xE0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF7, 0xFE, 0x03,
+    0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0,
+    0x78, 0x0F, 0x01, 0xE0, 0x3C, // i
+    0x01, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF7, 0xFF,
+    0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F,
+    0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1E,
+    0xE3, 0xEF, 0xFC, // j
+    0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x07,
+    0xFC, 0x3E, 0xF1, 0xF3, 0xCF, 0x8F, 0x7C, 0x3D, 0xE0, 0xFF, 0x03, 0xFC,
+    0x0F, 0xF8, 0x3D, 0xF0, 0xF3, 0xE3, 0xC7, 0xCF, 0x0F, 0xBC, 0x1F, 0xF0,
+    0x7C, // k
+    0xFF, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0, 0xF8, 0x1F, 0x03,
+    0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0,
+    0x7C, 0x0F, 0x81, 0xF0, 0x3E, // l
+    0xF7, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xE7, 0xF9, 0xE7,
+    0xF1, 0xC7, 0xF1, 0xC7, 0xF1, 0xC7, 0xF1, 0xC7, 0xF1, 0xC7, 0xF1, 0xC7,
+    0xF1, 0xC7, 0xF1, 0xC7, 0xF1, 0xC7, // m
+    0xF7, 0xF3, 0xFF, 0xEF, 0xE7, 0xBF, 0x1F, 0xF8, 0x7F, 0xC1, 0xFF, 0x07,
+    0xFC, 0x1F, 0xF0, 0x7F, 0xC1, 0xFF, 0x07, 0xFC, 0x1F, 0xF0, 0x7F, 0xC1,
+    0xFF, 0x07, 0xC0, // n
+    0x0F, 0xE0, 0x7F, 0xF1, 0xF1, 0xF3, 0xC1, 0xFF, 0x83, 0xFE, 0x03, 0xFC,
+    0x07, 0xF8, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F, 0xE0, 0xFB, 0xC1, 0xF7, 0xC7,
+    0xC7, 0xFF, 0x03, 0xF8, 0x00, // o
+    0xF7, 0xE3, 0xFF, 0xEF, 0xCF, 0xBE, 0x1F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03,
+    0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x07, 0xFE, 0x1E, 0xFC, 0xFB, 0xFF,
+    0xCF, 0xFE, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, // p
+    0x0F, 0xDC, 0xFF, 0xF7, 0xCF, 0xDE, 0x0F, 0xF8, 0x3F, 0xC0, 0xFF, 0x03,
+    0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x83, 0xFE, 0x1F, 0x7C, 0xFC, 0xFF,
+    0xF1, 0xFB, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, // q
+    0xFB, 0xFF, 0xFF, 0xFF, 0xCF, 0xFC, 0x7F, 0xC3, 0xFC, 0x03, 0xE0, 0x1F,
+    0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0,
+    0x00, // r
+    0x1F, 0xF3, 0xFF, 0xDE, 0x0F, 0xF0, 0x0F, 0x80, 0x7E, 0x01, 0xFE, 0x03,
+    0xFE, 0x03, 0xF8, 0x07, 0xC0, 0x1E, 0x00, 0xFF, 0x0F, 0xFF, 0xF9, 0xFF,
+    0x00, // s
+    0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x07, 0xFF, 0xFF, 0xFF, 0xE1, 0xE0, 0x03,
+    0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF0,
+    0x01, 0xE0, 0x03, 0xC0, 0x07, 0xC0, 0x07, 0xFE, 0x07, 0xFC, // t
+    0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE,
+    0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x3F, 0xE3, 0xFF, 0xBF, 0xBF, 0xFC, 0xFD,
+    0xE0, // u
+    0xF0, 0x07, 0x78, 0x0F, 0x78, 0x0F, 0x3C, 0x1E, 0x3C, 0x1E, 0x3E, 0x1E,
+    0x1E, 0x3C, 0x1E, 0x3C, 0x0F, 0x78, 0x0F, 0x78, 0x0F, 0xF0, 0x07, 0xF0,
+    0x07, 0xF0, 0x03, 0xE0, 0x03, 0xE0, // v
+    0xF0, 0x03, 0xF1, 0xE3, 0xF3, 0xE3, 0xF3, 0xE7, 0xF3, 0xF7, 0xF3, 0xF7,
+    0x7F, 0xF7, 0x7F, 0x77, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3E, 0x3E,
+    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, // w
+    0xF8, 0x1E, 0xF8, 0x79, 0xF1, 0xE1, 0xF3, 0xC1, 0xFF, 0x01, 0xFC, 0x03,
+    0xF8, 0x03, 0xE0, 0x0F, 0xE0, 0x1F, 0xE0, 0x7F, 0xC1, 0xE7, 0xC7, 0xC7,
+    0xCF, 0x07, 0xFC, 0x0F, 0x80, // x
+    0xF8, 0x07, 0x78, 0x0F, 0x7C, 0x0F, 0x3C, 0x1E, 0x3C, 0x1E, 0x1E, 0x3C,
+    0x1E, 0x3C, 0x1F, 0x3C, 0x0F, 0x78, 0x0F, 0xF8, 0x07, 0xF0, 0x07, 0xF0,
+    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0x80,
+    0x0F, 0x80, 0x7F, 0x00, // y
+    0x7F, 0xFE, 0xFF, 0xFC, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00,
+    0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x01, 0xE0, 0x07, 0x80,
+    0x1F, 0xFF, 0xFF, 0xFF, 0x80, // z
+    0x07, 0xF8, 0x7C, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x1E, 0x00,
+    0xF0, 0x07, 0x80, 0x38, 0x03, 0xC1, 0xFC, 0x0F, 0xE0, 0x07, 0x80, 0x1C,
+    0x00, 0xF0, 0x07, 0x80, 0x3C, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80,
+    0x3E, 0x00, 0xFF, 0x01, 0xF8, // {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, // |
+    0xFF, 0x00, 0x7C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1C, 0x01,
+    0xE0, 0x0F, 0x00, 0x38, 0x01, 0xE0, 0x07, 0xF0, 0x3F, 0x83, 0xC0, 0x1C,
+    0x01, 0xE0, 0x0F, 0x00, 0x38, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0,
+    0x3E, 0x1F, 0xE0, 0xFC, 0x00, // }
+    0x3F, 0x07, 0x7F, 0xC7, 0x73, 0xE7, 0xF1, 0xFF, 0xF0, 0x7E, // ~
+    0x00, 0x00
+};
+
+static const uint16_t FontOffset_16x26P[] = {
+    0, 0, 14, 24, 66, 104, 146, 188, 193, 231, 269, 290,
+    320, 326, 330, 333, 383, 423, 460, 495, 527, 569, 601, 641,
+    678, 718, 758, 768, 781, 811, 825, 855, 892, 934, 970, 1002,
+    1036, 1070, 1102, 1132, 1168, 1202, 1234, 1261, 1293, 1325, 1361, 1395,
+    1431, 1463, 1507, 1539, 1571, 1607, 1641, 1677, 1713, 1749, 1785, 1819,
+    1854, 1901, 1936, 1968, 1972, 1973, 2002, 2039, 2068, 2108, 2137, 2177,
+    2215, 2252, 2281, 2320, 2357, 2386, 2416, 2443, 2472, 2507, 2542, 2567,
+    2592, 2626, 2651, 2681, 2711, 2740, 2780, 2809, 2850, 2860, 2901,
+};
+
+static const FontGlyph_s FontGlyphs_16x26P[] = {
+    {8, 0, 0, 0, 0}, // sp
+    {7, 0, 0, 5, 21}, // !
+    {13, 0, 0, 11, 7}, // "
+    {18, 0, 0, 16, 21}, // #
+    {15, 0, 0, 13, 23}, // $
+    {18, 0, 0, 16, 21}, // %
+    {18, 0, 0, 16, 21}, // &
+    {7, 0, 0, 5, 7}, // '
+    {14, 0, 0, 12, 25}, // (
+    {14, 0, 0, 12, 25}, // )
+    {16, 0, 0, 14, 12}, // *
+    {18, 0, 6, 16, 15}, // +
+    {7, 0, 17, 5, 9}, // ,
+    {15, 0, 11, 13, 2}, // -
+    {7, 0, 17, 5, 4}, // .
+    {18, 0, 0, 16, 25}, // /
+    {17, 0, 0, 15, 21}, // 0
+    {16, 0, 0, 14, 21}, // 1
+    {15, 0, 0, 13, 21}, // 2
+    {14, 0, 0, 12, 21}, // 3
+    {18, 0, 0, 16, 21}, // 4
+    {14, 0, 0, 12, 21}, // 5
+    {17, 0, 0, 15, 21}, // 6
+    {16, 0, 0, 14, 21}, // 7
+    {17, 0, 0, 15, 21}, // 8
+    {17, 0, 0, 15, 21}, // 9
+    {7, 0, 6, 5, 15}, // :
+    {7, 0, 6, 5, 20}, // ;
+    {18, 0, 6, 16, 15}, // <
+    {18, 0, 10, 16, 7}, // =
+    {18, 0, 6, 16, 15}, // >
+    {16, 0, 0, 14, 21}, // ?
+    {18, 0, 0, 16, 21}, // @
+    {18, 0, 3, 16, 18}, // A
+    {16, 0, 3, 14, 18}, // B
+    {17, 0, 3, 15, 18}, // C
+    {17, 0, 3, 15, 18}, // D
+    {16, 0, 3, 14, 18}, // E
+    {15, 0, 3, 13, 18}, // F
+    {18, 0, 3, 16, 18}, // G
+    {17, 0, 3, 15, 18}, // H
+    {16, 0, 3, 14, 18}, // I
+    {14, 0, 3, 12, 18}, // J
+    {16, 0, 3, 14, 18}, // K
+    {16, 0, 3, 14, 18}, // L
+    {18, 0, 3, 16, 18}, // M
+    {17, 0, 3, 15, 18}, // N
+    {18, 0, 3, 16, 18}, // O
+    {16, 0, 3, 14, 18}, // P
+    {18, 0, 3, 16, 22}, // Q
+    {16, 0, 3, 14, 18}, // R
+    {16, 0, 3, 14, 18}, // S
+    {18, 0, 3, 16, 18}, // T
+    {17, 0, 3, 15, 18}, // U
+    {18, 0, 3, 16, 18}, // V
+    {18, 0, 3, 16, 18}, // W
+    {18, 0, 3, 16, 18}, // X
+    {18, 0, 3, 16, 18}, // Y
+    {17, 0, 3, 15, 18}, // Z
+    {13, 0, 0, 11, 25}, // [
+    {17, 0, 0, 15, 25}, /* \ */
+    {13, 0, 0, 11, 25}, // ]
+    {17, 0, 0, 15, 17}, // ^
+    {18, 0, 21, 16, 2}, // _
+    {6, 0, 0, 4, 1}, // `
+    {17, 0, 6, 15, 15}, // a
+    {16, 0, 0, 14, 21}, // b
+    {17, 0, 6, 15, 15}, // c
+    {17, 0, 0, 15, 21}, // d
+    {17, 0, 6, 15, 15}, // e
+    {17, 0, 0, 15, 21}, // f
+    {17, 0, 6, 15, 20}, // g
+    {16, 0, 0, 14, 21}, // h
+    {13, 0, 0, 11, 21}, // i
+    {14, 0, 0, 12, 26}, // j
+    {16, 0, 0, 14, 21}, // k
+    {13, 0, 0, 11, 21}, // l
+    {18, 0, 6, 16, 15}, // m
+    {16, 0, 6, 14, 15}, // n
+    {17, 0, 6, 15, 15}, // o
+    {16, 0, 6, 14, 20}, // p
+    {16, 0, 6, 14, 20}, // q
+    {15, 0, 6, 13, 15}, // r
+    {15, 0, 6, 13, 15}, // s
+    {17, 0, 3, 15, 18}, // t
+    {15, 0, 6, 13, 15}, // u
+    {18, 0, 6, 16, 15}, // v
+    {18, 0, 6, 16, 15}, // w
+    {17, 0, 6, 15, 15}, // x
+    {18, 0, 6, 16, 20}, // y
+    {17, 0, 6, 15, 15}, // z
+    {15, 0, 0, 13, 25}, // {
+    {5, 0, 0, 3, 25}, // |
+    {15, 0, 0, 13, 25}, // }
+    {18, 0, 11, 16, 5}, // ~
+};
+
+static const FontKerning_s FontKerning_16x26P[] = {
+    {',', 'T', -4},
+    {',', 'V', -4},
+    {',', 'Y', -4},
+    {',', 'f', -4},
+    {',', 'i', -4},
+    {',', 'l', -4},
+    {',', 't', -4},
+    {',', 'v', -4},
+    {',', 'y', -2},
+    {'.', 'T', -4},
+    {'.', 'V', -4},
+    {'.', 'Y', -4},
+    {'.', 'f', -4},
+    {'.', 'i', -4},
+    {'.', 'j', -4},
+    {'.', 'l', -4},
+    {'.', 't', -4},
+    {'.', 'v', -4},
+    {'.', 'y', -4},
+    {'A', 'T', -4},
+    {'A', 'V', -4},
+    {'A', 'Y', -4},
+    {'A', 'f', -3},
+    {'A', 'i', -3},
+    {'A', 'j', -4},
+    {'A', 'l', -4},
+    {'A', 't', -3},
+    {'A', 'v', -4},
+    {'A', 'y', -4},
+    {'B', 'Y', -2},
+    {'B', 'j', -2},
+    {'B', 'l', -4},
+    {'C', 'G', -2},
+    {'C', 'l', -4},
+    {'D', 'X', -2},
+    {'D', 'l', -4},
+    {'E', 'f', -4},
+    {'E', 'i', -4},
+    {'E', 'j', -4},
+    {'E', 'l', -4},
+    {'E', 't', -4},
+    {'E', 'v', -3},
+    {'E', 'y', -3},
+    {'F', ',', -4},
+    {'F', '.', -4},
+    {'F', 'A', -2},
+    {'F', 'a', -2},
+    {'F', 'f', -4},
+    {'F', 'i', -4},
+    {'F', 'j', -4},
+    {'F', 'l', -4},
+    {'F', 't', -4},
+    {'F', 'v', -2},
+    {'F', 'x', -3},
+    {'F', 'y', -2},
+    {'F', 'z', -4},
+    {'G', 'l', -4},
+    {'H', 'l', -4},
+    {'I', 'C', -2},
+    {'I', 'G', -3},
+    {'I', 'O', -2},
+    {'I', 'Q', -2},
+    {'I', 'c', -2},
+    {'I', 'e', -2},
+    {'I', 'f', -4},
+    {'I', 'i', -4},
+    {'I', 'j', -4},
+    {'I', 'l', -4},
+    {'I', 't', -4},
+    {'I', 'v', -4},
+    {'I', 'w', -2},
+    {'I', 'y', -4},
+    {'J', 'l', -4},
+    {'K', 'C', -2},
+    {'K', 'G', -3},
+    {'K', 'O', -2},
+    {'K', 'Q', -2},
+    {'K', 'c', -2},
+    {'K', 'e', -2},
+    {'K', 'f', -2},
+    {'K', 'i', -2},
+    {'K', 'j', -3},
+    {'K', 'l', -4},
+    {'K', 't', -2},
+    {'K', 'v', -2},
+    {'K', 'w', -2},
+    {'K', 'y', -2},
+    {'L', 'C', -2},
+    {'L', 'G', -3},
+    {'L', 'O', -2},
+    {'L', 'Q', -2},
+    {'L', 'T', -4},
+    {'L', 'V', -4},
+    {'L', 'W', -2},
+    {'L', 'Y', -4},
+    {'L', 'c', -2},
+    {'L', 'e', -2},
+    {'L', 'f', -4},
+    {'L', 'i', -4},
+    {'L', 'j', -4},
+    {'L', 'l', -4},
+    {'L', 't', -4},
+    {'L', 'v', -4},
+    {'L', 'w', -2},
+    {'L', 'y', -4},
+    {'M', 'l', -4},
+    {'N', 'l', -4},
+    {'O', 'l', -4},
+    {'P', ',', -4},
+    {'P', '.', -4},
+    {'P', 'A', -3},
+    {'P', 'l', -4},
+    {'Q', 'l', -4},
+    {'R', 'Y', -2},
+    {'R', 'c', -2},
+    {'R', 'e', -2},
+    {'R', 'j', -2},
+    {'R', 'l', -4},
+    {'S', 'j', -2},
+    {'S', 'l', -4},
+    {'T', ',', -4},
+    {'T', '.', -4},
+    {'T', 'A', -4},
+    {'T', 'C', -2},
+    {'T', 'G', -3},
+    {'T', 'O', -2},
+    {'T', 'Q', -2},
+    {'T', 'a', -4},
+    {'T', 'c', -4},
+    {'T', 'd', -4},
+    {'T', 'e', -4},
+    {'T', 'f', -4},
+    {'T', 'g', -4},
+    {'T', 'i', -4},
+    {'T', 'j', -4},
+    {'T', 'l', -4},
+    {'T', 'm', -4},
+    {'T', 'n', -4},
+    {'T', 'o', -4},
+    {'T', 'p', -4},
+    {'T', 'q', -4},
+    {'T', 'r', -4},
+    {'T', 's', -4},
+    {'T', 't', -4},
+    {'T', 'u', -4},
+    {'T', 'v', -4},
+    {'T', 'w', -4},
+    {'T', 'x', -4},
+    {'T', 'y', -4},
+    {'T', 'z', -4},
+    {'U', 'l', -4},
+    {'V', ',', -4},
+    {'V', '.', -4},
+    {'V', 'A', -4},
+    {'V', 'c', -2},
+    {'V', 'l', -4},
+    {'W', 'l', -4},
+    {'X', 'G', -2},
+    {'X', 'j', -2},
+    {'X', 'l', -4},
+    {'Y', ',', -4},
+    {'Y', '.', -4},
+    {'Y', 'A', -4},
+    {'Y', 'G', -2},
+    {'Y', 'a', -2},
+    {'Y', 'c', -3},
+    {'Y', 'd', -2},
+    {'Y', 'e', -3},
+    {'Y', 'g', -2},
+    {'Y', 'l', -4},
+    {'Y', 'o', -2},
+    {'Y', 'q', -2},
+    {'Y', 's', -2},
+    {'Z', 'c', -2},
+    {'Z', 'e', -2},
+    {'Z', 'l', -4},
+    {'a', 'T', -4},
+    {'a', 'V', -3},
+    {'a', 'Y', -4},
+    {'a', 'f', -2},
+    {'a', 'i', -2},
+    {'a', 'j', -3},
+    {'a', 'l', -4},
+    {'a', 't', -2},
+    {'a', 'v', -2},
+    {'a', 'y', -2},
+    {'b', 'T', -4},
+    {'b', 'V', -2},
+    {'b', 'X', -2},
+    {'b', 'Y', -3},
+    {'b', 'j', -2},
+    {'b', 'l', -4},
+    {'c', 'T', -4},
+    {'c', 'Y', -2},
+    {'c', 'l', -4},
+    {'e', 'T', -4},
+    {'e', 'V', -2},
+    {'e', 'Y', -3},
+    {'e', 'j', -2},
+    {'e', 'l', -4},
+    {'e', 'v', -2},
+    {'e', 'y', -2},
+    {'f', ',', -4},
+    {'f', '.', -4},
+    {'f', 'A', -4},
+    {'f', 'I', -4},
+    {'f', 'J', -4},
+    {'f', 'T', -4},
+    {'f', 'X', -2},
+    {'f', 'Z', -4},
+    {'f', 'c', -2},
+    {'f', 'e', -2},
+    {'g', 'T', -4},
+    {'g', 'l', -4},
+    {'h', 'T', -4},
+    {'h', 'V', -2},
+    {'h', 'Y', -3},
+    {'h', 'j', -2},
+    {'h', 'l', -4},
+    {'i', 'T', -4},
+    {'i', 'Y', -2},
+    {'i', 'j', -2},
+    {'j', 'T', -4},
+    {'k', 'T', -4},
+    {'k', 'c', -2},
+    {'k', 'e', -2},
+    {'k', 'l', -4},
+    {'m', 'T', -4},
+    {'m', 'Y', -2},
+    {'m', 'l', -4},
+    {'n', 'T', -4},
+    {'n', 'V', -2},
+    {'n', 'Y', -3},
+    {'n', 'j', -2},
+    {'n', 'l', -4},
+    {'o', 'T', -4},
+    {'o', 'V', -2},
+    {'o', 'Y', -3},
+    {'o', 'j', -2},
+    {'o', 'l', -4},
+    {'p', 'T', -4},
+    {'p', 'V', -2},
+    {'p', 'X', -2},
+    {'p', 'Y', -3},
+    {'p', 'j', -2},
+    {'p', 'l', -4},
+    {'q', 'T', -4},
+    {'q', 'l', -4},
+    {'r', ',', -4},
+    {'r', '.', -4},
+    {'r', 'A', -3},
+    {'r', 'I', -4},
+    {'r', 'J', -4},
+    {'r', 'T', -4},
+    {'r', 'X', -2},
+    {'r', 'Z', -4},
+    {'r', 'l', -4},
+    {'s', 'T', -4},
+    {'s', 'Y', -2},
+    {'s', 'l', -4},
+    {'t', 'T', -4},
+    {'t', 'c', -2},
+    {'t', 'e', -2},
+    {'t', 'l', -4},
+    {'u', 'T', -4},
+    {'u', 'l', -4},
+    {'v', ',', -4},
+    {'v', '.', -4},
+    {'v', 'A', -4},
+    {'v', 'I', -4},
+    {'v', 'J', -4},
+    {'v', 'T', -4},
+    {'v', 'X', -2},
+    {'v', 'Z', -4},
+    {'v', 'l', -4},
+    {'w', 'T', -4},
+    {'w', 'l', -4},
+    {'x', 'T', -4},
+    {'x', 'c', -2},
+    {'x', 'e', -2},
+    {'x', 'l', -4},
+    {'y', ',', -4},
+    {'y', '.', -4},
+    {'y', 'A', -4},
+    {'y', 'I', -4},
+    {'y', 'J', -4},
+    {'y', 'T', -4},
+    {'y', 'X', -2},
+    {'y', 'Z', -4},
+    {'y', 'l', -4},
+    {'z', 'T', -4},
+    {'z', 'l', -4},
+};
+
+static const uint8_t FontBitmap_11x18A2[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // sp
+    0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+    0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+    0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x80, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // !
+    0x00, 0x00, 0x00, 0x0A, 0x28, 0x00, 0x3C, 0xF0, 0x00, 0xF3, 0xC0, 0x03,
+    0xCF, 0x00, 0x0A, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // "
+    0x00, 0x00, 0x00, 0x0A, 0x0A, 0x00, 0x3C, 0x3C, 0x00, 0xF0, 0xF0, 0x07,
+    0xD7, 0xD0, 0xBF, 0xFF, 0x82, 0xFF, 0xFE, 0x00, 0xE4, 0xE4, 0x1B, 0x1B,
+    0x00, 0xBF, 0xFF, 0x82, 0xFF, 0xFE, 0x07, 0xD7, 0xD0, 0x0F, 0x0F, 0x00,
+    0x3C, 0x3C, 0x00, 0xA0, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // #
+    0x00, 0x00, 0x00, 0x1B, 0xE4, 0x01, 0xBF, 0xE4, 0x0B, 0x8C, 0xE0, 0x3C,
+    0x32, 0x80, 0xB8, 0xC0, 0x01, 0xBF, 0x40, 0x01, 0xBE, 0x40, 0x00, 0x7E,
+    0x40, 0x00, 0xCE, 0x02, 0x83, 0x3C, 0x0F, 0x4C, 0xF0, 0x2E, 0x33, 0x80,
+    0x6F, 0xF9, 0x00, 0x6F, 0x90, 0x00, 0x1D, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, // $
+    0x00, 0x00, 0x01, 0xB9, 0x00, 0x0B, 0x38, 0x00, 0x3C, 0xF0, 0x1C, 0xF3,
+    0xC1, 0xA2, 0xCE, 0x1A, 0x46, 0xE5, 0xA4, 0x00, 0x1A, 0x40, 0x01, 0xA0,
+    0x00, 0x1A, 0x2E, 0x41, 0xA2, 0xCE, 0x0A, 0x4F, 0x3C, 0x34, 0x3C, 0xF0,
+    0x00, 0xB3, 0x80, 0x01, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // %
+    0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0xBF, 0xE0, 0x03, 0xD7, 0xC0, 0x0F,
+    0x0F, 0x00, 0x2D, 0x78, 0x00, 0x6F, 0x90, 0x00, 0x3D, 0x00, 0x1B, 0xF4,
+    0xA0, 0xB5, 0xA3, 0x83, 0xC1, 0xBD, 0x0F, 0x00, 0xF0, 0x2D, 0x1B, 0xD0,
+    0x6F, 0xE3, 0xC0, 0x6E, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // &
+    0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+    0xF0, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // '
+    0x00, 0x01, 0x80, 0x00, 0x1D, 0x00, 0x01, 0xA0, 0x00, 0x0B, 0x40, 0x00,
+    0x38, 0x00, 0x01, 0xD0, 0x00, 0x0B, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+    0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x74, 0x00,
+    0x00, 0xE0, 0x00, 0x02, 0xD0, 0x00, 0x06, 0x80, 0x00, 0x07, 0x40, 0x00,
+    0x06, 0x00, // (
+    0x09, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x29, 0x00, 0x00, 0x78, 0x00, 0x00,
+    0xB0, 0x00, 0x01, 0xD0, 0x00, 0x03, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x74, 0x00,
+    0x02, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xA4, 0x00, 0x07, 0x40, 0x00, 0x24,
+    0x00, 0x00, // )
+    0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0xCF, 0x30, 0x02, 0xFF, 0x80, 0x03,
+    0xFC, 0x00, 0x39, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // *
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
+    0xF0, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x40, 0x2F, 0xFF, 0xF8, 0xBF, 0xFF,
+    0xE0, 0x07, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xA0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // +
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x80, 0x00, 0x0B, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x70, 0x00, 0x02,
+    0x40, 0x00, // ,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // -
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x80, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // .
+    0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00,
+    0x2D, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xB4,
+    0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x02, 0xD0, 0x00,
+    0x0F, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // /
+    0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0xBF, 0xE0, 0x07, 0x96, 0xD0, 0x2D,
+    0x07, 0x80, 0xF0, 0x0F, 0x03, 0xC0, 0x3C, 0x0F, 0x28, 0xF0, 0x3C, 0xA3,
+    0xC0, 0xF0, 0x0F, 0x03, 0xC0, 0x3C, 0x0B, 0x41, 0xE0, 0x1E, 0x5B, 0x40,
+    0x2F, 0xF8, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // 0
+    0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x1B, 0xC0, 0x01, 0xBF, 0x00, 0x0A,
+    0x3C, 0x00, 0x34, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+    0x00, 0xF0, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // 1
+    0x00, 0x00, 0x00, 0x1B, 0xE4, 0x01, 0xBF, 0xE4, 0x0B, 0x96, 0xE0, 0x3D,
+    0x07, 0xC0, 0xA0, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x06, 0x90, 0x00, 0x69,
+    0x00, 0x06, 0x90, 0x00, 0x69, 0x00, 0x06, 0x90, 0x00, 0x2C, 0x00, 0x00,
+    0xFF, 0xFE, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // 2
+    0x00, 0x00, 0x00, 0x1B, 0x90, 0x01, 0xBF, 0x90, 0x0B, 0x47, 0x80, 0x28,
+    0x0F, 0x00, 0x00, 0x78, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0x1A,
+    0x40, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x0A, 0x41, 0xF0, 0x2E, 0x5B, 0x80,
+    0x6F, 0xF9, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // 3
+    0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x0B, 0xC0, 0x00, 0x7F, 0x00, 0x02,
+    0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x73, 0xC0, 0x02, 0xCF, 0x00, 0x1E, 0x3C,
+    0x00, 0xB1, 0xF4, 0x03, 0xFF, 0xF8, 0x0B, 0xFF, 0xE0, 0x00, 0x7D, 0x00,
+    0x00, 0xF0, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // 4
+    0x00, 0x00, 0x00, 0xBF, 0xF8, 0x03, 0xFF, 0xE0, 0x0F, 0x40, 0x00, 0x3C,
+    0x00, 0x00, 0xF0, 0x00, 0x03, 0xCB, 0x90, 0x0F, 0xFF, 0x90, 0x29, 0x1B,
+    0x80, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x0A, 0x41, 0xF0, 0x2E, 0x5B, 0x80,
+    0x6F, 0xF9, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // 5
+    0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0xBF, 0xE4, 0x07, 0x96, 0xE0, 0x2D,
+    0x06, 0x80, 0xF0, 0x00, 0x03, 0xCB, 0x90, 0x0F, 0xFF, 0x90, 0x3E, 0x5B,
+    0x80, 0xF4, 0x1F, 0x03, 0xC0, 0x3C, 0x0B, 0x41, 0xF0, 0x1E, 0x5B, 0x80,
+    0x2F, 0xF9, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // 6
+    0x00, 0x00, 0x00, 0xBF, 0xFE, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0xE0, 0x00,
+    0x0B, 0x40, 0x00, 0x78, 0x00, 0x02, 0xD0, 0x00, 0x1E, 0x00, 0x00, 0xB4,
+    0x00, 0x03, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x74, 0x00, 0x02, 0xC0, 0x00,
+    0x0F, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // 7
+    0x00, 0x00, 0x00, 0x1B, 0xE4, 0x01, 0xBF, 0xE4, 0x0B, 0x46, 0xE0, 0x3C,
+    0x07, 0xC0, 0xB0, 0x0E, 0x01, 0xD0, 0x74, 0x00, 0xBE, 0x00, 0x1B, 0xFE,
+    0x40, 0xB4, 0x1E, 0x03, 0xC0, 0x3C, 0x0F, 0x00, 0xF0, 0x2D, 0x07, 0x80,
+    0x6F, 0xF9, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // 8
+    0x00, 0x00, 0x00, 0x1B, 0xE4, 0x01, 0xBF, 0xE0, 0x0B, 0x96, 0xD0, 0x3D,
+    0x07, 0x80, 0xF0, 0x0F, 0x03, 0xD0, 0x7C, 0x0B, 0x96, 0xF0, 0x1B, 0xFF,
+    0xC0, 0x1B, 0x8F, 0x00, 0x00, 0x3C, 0x0A, 0x41, 0xE0, 0x2E, 0x5B, 0x40,
+    0x6F, 0xF8, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // 9
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x80, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // :
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x80, 0x00, 0x0B, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x70, 0x00, 0x02,
+    0x40, 0x00, // ;
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xC0, 0x00, 0x6E, 0x00, 0x1B, 0x90, 0x06, 0xE4, 0x00, 0x3C, 0x00,
+    0x00, 0x6E, 0x40, 0x00, 0x1B, 0x90, 0x00, 0x06, 0xE0, 0x00, 0x01, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // <
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0xFE, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xFE, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // =
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34,
+    0x00, 0x00, 0xB9, 0x00, 0x00, 0x6E, 0x40, 0x00, 0x1B, 0x90, 0x00, 0x03,
+    0xC0, 0x01, 0xB9, 0x00, 0x6E, 0x40, 0x0B, 0x90, 0x00, 0x34, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // >
+    0x00, 0x00, 0x00, 0x1B, 0xF9, 0x01, 0xBF, 0xF9, 0x0B, 0x91, 0xB8, 0x29,
+    0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x6E, 0x00, 0x06, 0xE4, 0x00, 0x6E,
+    0x40, 0x02, 0xE4, 0x00, 0x0F, 0x40, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x80, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // ?
+    0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0xBF, 0xE4, 0x07, 0xD1, 0xE0, 0x2E,
+    0x07, 0xC0, 0xF4, 0x6F, 0x03, 0xCB, 0xFC, 0x0F, 0x3C, 0xF0, 0x3C, 0xF3,
+    0xC0, 0xF2, 0xFF, 0x03, 0xC6, 0xF8, 0x0B, 0x40, 0x00, 0x1E, 0x5C, 0x00,
+    0x2F, 0xE0, 0x00, 0x6E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // @
+    0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0xB3, 0x80, 0x03,
+    0xCF, 0x00, 0x0F, 0x3C, 0x00, 0x78, 0xB4, 0x02, 0xD1, 0xE0, 0x0F, 0x47,
+    0xC0, 0x3F, 0xFF, 0x00, 0xFF, 0xFC, 0x07, 0x91, 0xB4, 0x2D, 0x01, 0xE0,
+    0xF0, 0x03, 0xC2, 0x80, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // A
+    0x00, 0x00, 0x00, 0xBF, 0x90, 0x03, 0xFF, 0x90, 0x0F, 0x47, 0x80, 0x3C,
+    0x0F, 0x00, 0xF0, 0x3C, 0x03, 0xD1, 0xE0, 0x0F, 0xFF, 0x40, 0x3F, 0xFD,
+    0x00, 0xF4, 0x69, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xF0, 0x3D, 0x1B, 0x80,
+    0xFF, 0xF9, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // B
+    0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0xBF, 0xE4, 0x07, 0x91, 0xE0, 0x2D,
+    0x02, 0x80, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+    0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x40, 0xA0, 0x1E, 0x47, 0x80,
+    0x2F, 0xF9, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // C
+    0x00, 0x00, 0x00, 0xBF, 0x90, 0x03, 0xFF, 0xE0, 0x0F, 0x47, 0xD0, 0x3C,
+    0x0B, 0x80, 0xF0, 0x1F, 0x03, 0xC0, 0x3C, 0x0F, 0x00, 0xF0, 0x3C, 0x03,
+    0xC0, 0xF0, 0x0F, 0x03, 0xC0, 0x78, 0x0F, 0x02, 0xD0, 0x3D, 0x1E, 0x00,
+    0xFF, 0xE4, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // D
+    0x00, 0x00, 0x00, 0xBF, 0xFE, 0x03, 0xFF, 0xF8, 0x0F, 0x40, 0x00, 0x3C,
+    0x00, 0x00, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0xFF, 0x80, 0x3F, 0xFE,
+    0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3D, 0x00, 0x00,
+    0xFF, 0xFE, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // E
+    0x00, 0x00, 0x00, 0xBF, 0xFE, 0x03, 0xFF, 0xF8, 0x0F, 0x40, 0x00, 0x3C,
+    0x00, 0x00, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0xFF, 0x80, 0x3F, 0xFE,
+    0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+    0xF0, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // F
+    0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0xBF, 0xE4, 0x07, 0x91, 0xE0, 0x2D,
+    0x02, 0x80, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x0B,
+    0x80, 0xF0, 0x2F, 0x03, 0xC0, 0x7C, 0x0B, 0x40, 0xF0, 0x1E, 0x47, 0xC0,
+    0x2F, 0xFE, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // G
+    0x00, 0x00, 0x00, 0xA0, 0x0A, 0x03, 0xC0, 0x3C, 0x0F, 0x00, 0xF0, 0x3C,
+    0x03, 0xC0, 0xF0, 0x0F, 0x03, 0xD0, 0x7C, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF,
+    0xC0, 0xF4, 0x1F, 0x03, 0xC0, 0x3C, 0x0F, 0x00, 0xF0, 0x3C, 0x03, 0xC0,
+    0xF0, 0x0F, 0x02, 0x80, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // H
+    0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0xBF, 0xE0, 0x00, 0x7D, 0x00, 0x00,
+    0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+    0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xF4, 0x00,
+    0x2F, 0xF8, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // I
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+    0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+    0xC0, 0x00, 0x0F, 0x02, 0x80, 0x3C, 0x0F, 0x41, 0xF0, 0x2E, 0x5B, 0x80,
+    0x6F, 0xF9, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // J
+    0x00, 0x00, 0x00, 0xA0, 0x06, 0xC3, 0xC0, 0x69, 0x0F, 0x06, 0x90, 0x3C,
+    0x2D, 0x00, 0xF1, 0xE0, 0x03, 0xCA, 0x40, 0x0F, 0xF0, 0x00, 0x3F, 0xE4,
+    0x00, 0xF5, 0xE0, 0x03, 0xC2, 0xD0, 0x0F, 0x06, 0x90, 0x3C, 0x07, 0x80,
+    0xF0, 0x0B, 0x42, 0x80, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // K
+    0x00, 0x00, 0x00, 0xA0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+    0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3D, 0x00, 0x00,
+    0xFF, 0xFE, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // L
+    0x00, 0x00, 0x00, 0xB8, 0x0B, 0x83, 0xF4, 0x7F, 0x0F, 0xE2, 0xFC, 0x3F,
+    0xCC, 0xF0, 0xF3, 0x33, 0xC3, 0xCC, 0xCF, 0x0F, 0x2E, 0x3C, 0x3C, 0x74,
+    0xF0, 0xF0, 0x03, 0xC3, 0xC0, 0x0F, 0x0F, 0x00, 0x3C, 0x3C, 0x00, 0xF0,
+    0xF0, 0x03, 0xC2, 0x80, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // M
+    0x00, 0x00, 0x00, 0xB8, 0x0A, 0x03, 0xF4, 0x3C, 0x0F, 0xE0, 0xF0, 0x3F,
+    0xC3, 0xC0, 0xFF, 0x4F, 0x03, 0xCE, 0x3C, 0x0F, 0x3C, 0xF0, 0x3C, 0xB3,
+    0xC0, 0xF1, 0xCF, 0x03, 0xC3, 0xFC, 0x0F, 0x0F, 0xF0, 0x3C, 0x2F, 0xC0,
+    0xF0, 0x7F, 0x02, 0x80, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // N
+    0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0xBF, 0xE0, 0x07, 0x96, 0xD0, 0x2D,
+    0x07, 0x80, 0xF0, 0x0F, 0x03, 0xC0, 0x3C, 0x0F, 0x00, 0xF0, 0x3C, 0x03,
+    0xC0, 0xF0, 0x0F, 0x03, 0xC0, 0x3C, 0x0B, 0x41, 0xE0, 0x1E, 0x5B, 0x40,
+    0x2F, 0xF8, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // O
+    0x00, 0x00, 0x00, 0xBF, 0xE4, 0x03, 0xFF, 0xE4, 0x0F, 0x46, 0xE0, 0x3C,
+    0x07, 0xC0, 0xF0, 0x0F, 0x03, 0xC0, 0x7C, 0x0F, 0x46, 0xE0, 0x3F, 0xFE,
+    0x40, 0xFF, 0xE4, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+    0xF0, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // P
+    0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0xBF, 0xE0, 0x07, 0x96, 0xD0, 0x2D,
+    0x07, 0x80, 0xF0, 0x0F, 0x03, 0xC0, 0x3C, 0x0F, 0x00, 0xF0, 0x3C, 0x03,
+    0xC0, 0xF0, 0x0F, 0x03, 0xC3, 0x3C, 0x0B, 0x4B, 0xE0, 0x1E, 0x4F, 0x00,
+    0x2F, 0xFF, 0x40, 0x6F, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // Q
+    0x00, 0x00, 0x00, 0xBF, 0xE4, 0x03, 0xFF, 0xE4, 0x0F, 0x46, 0xE0, 0x3C,
+    0x07, 0xC0, 0xF0, 0x1F, 0x03, 0xD1, 0xB8, 0x0F, 0xFF, 0x90, 0x3F, 0xFD,
+    0x00, 0xF5, 0xB4, 0x03, 0xC1, 0xE0, 0x0F, 0x02, 0xD0, 0x3C, 0x07, 0x80,
+    0xF0, 0x0B, 0x42, 0x80, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // R
+    0x00, 0x00, 0x00, 0x06, 0xE4, 0x00, 0x6F, 0xE4, 0x02, 0xD1, 0xE0, 0x0F,
+    0x02, 0x80, 0x3D, 0x00, 0x00, 0xB9, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x6E,
+    0x40, 0x00, 0x6E, 0x02, 0x80, 0x7C, 0x0B, 0x40, 0xF0, 0x1E, 0x47, 0x80,
+    0x2F, 0xF9, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // S
+    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x8B, 0xFF, 0xFE, 0x00, 0x7D, 0x00, 0x00,
+    0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+    0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+    0x03, 0xC0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // T
+    0x00, 0x00, 0x00, 0xA0, 0x0A, 0x03, 0xC0, 0x3C, 0x0F, 0x00, 0xF0, 0x3C,
+    0x03, 0xC0, 0xF0, 0x0F, 0x03, 0xC0, 0x3C, 0x0F, 0x00, 0xF0, 0x3C, 0x03,
+    0xC0, 0xF0, 0x0F, 0x03, 0xC0, 0x3C, 0x0F, 0x41, 0xF0, 0x2E, 0x5B, 0x80,
+    0x6F, 0xF9, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // U
+    0x00, 0x00, 0x00, 0xA0, 0x02, 0x83, 0xC0, 0x0F, 0x0B, 0x40, 0x78, 0x1E,
+    0x02, 0xD0, 0x3C, 0x0F, 0x00, 0xB4, 0x78, 0x01, 0xE2, 0xD0, 0x03, 0xCF,
+    0x00, 0x0F, 0x3C, 0x00, 0x2C, 0xE0, 0x00, 0x7F, 0x40, 0x00, 0xFC, 0x00,
+    0x02, 0xE0, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // V
+    0x00, 0x00, 0x02, 0x80, 0x02, 0x8F, 0x00, 0x0F, 0x3C, 0x00, 0x3C, 0xF0,
+    0x00, 0xF3, 0xC0, 0x03, 0xCB, 0x0A, 0x0E, 0x1C, 0x3C, 0x34, 0x31, 0xF4,
+    0xC0, 0xCB, 0xE3, 0x03, 0x35, 0xCC, 0x0C, 0xC3, 0x30, 0x3E, 0x0B, 0xC0,
+    0xF4, 0x1F, 0x02, 0x80, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // W
+    0x00, 0x00, 0x03, 0x90, 0x02, 0xC7, 0x80, 0x1D, 0x0B, 0x41, 0xA0, 0x1E,
+    0x4B, 0x40, 0x2E, 0x38, 0x00, 0x6F, 0x90, 0x00, 0x7D, 0x00, 0x01, 0xF4,
+    0x00, 0x0B, 0xE4, 0x00, 0x7F, 0xE0, 0x06, 0xE2, 0xD0, 0x2E, 0x47, 0x81,
+    0xE4, 0x0B, 0x4E, 0x40, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // X
+    0x00, 0x00, 0x03, 0x90, 0x06, 0xC7, 0x80, 0x2D, 0x0B, 0x41, 0xE0, 0x1E,
+    0x0B, 0x40, 0x2D, 0x78, 0x00, 0x7F, 0xD0, 0x00, 0xBE, 0x00, 0x01, 0xF4,
+    0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+    0x03, 0xC0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // Y
+    0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0xE0, 0x00,
+    0x0B, 0x40, 0x00, 0x78, 0x00, 0x06, 0x90, 0x00, 0x2D, 0x00, 0x01, 0xE0,
+    0x00, 0x0B, 0x40, 0x00, 0x78, 0x00, 0x06, 0x90, 0x00, 0x2C, 0x00, 0x00,
+    0xFF, 0xFE, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // Z
+    0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x00,
+    0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+    0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+    0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xFE, 0x00, 0x02,
+    0xF8, 0x00, // [
+    0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xB4, 0x00, 0x01,
+    0xE0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x78,
+    0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x40, 0x00, 0x1E, 0x00,
+    0x00, 0x3C, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, /* \ */
+    0x02, 0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+    0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+    0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x02, 0xFC, 0x00, 0x0B,
+    0xE0, 0x00, // ]
+    0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x1F, 0x40, 0x00, 0xBE, 0x00, 0x07,
+    0x5D, 0x00, 0x2C, 0x38, 0x01, 0xE0, 0xB4, 0x0B, 0x41, 0xE0, 0x28, 0x02,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // ^
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0x00, // _
+    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x6C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // `
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1B, 0xF9, 0x01, 0xBF, 0xF8, 0x0E, 0x41, 0xF0, 0x00, 0x07,
+    0xC0, 0x1B, 0xFF, 0x01, 0xBF, 0xFC, 0x0B, 0x40, 0xF0, 0x3D, 0x1B, 0xC0,
+    0xBF, 0xFF, 0x41, 0xB9, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // a
+    0x00, 0x00, 0x00, 0xA0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0xF2, 0xE4, 0x03, 0xFF, 0xE4, 0x0F, 0x96, 0xE0, 0x3D, 0x07,
+    0xC0, 0xF0, 0x0F, 0x03, 0xC0, 0x3C, 0x0F, 0x41, 0xF0, 0x3E, 0x5B, 0x80,
+    0xFF, 0xF9, 0x02, 0x8B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // b
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1B, 0xE4, 0x01, 0xBF, 0xE4, 0x0B, 0x96, 0xE0, 0x3D, 0x06,
+    0x80, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x41, 0xA0, 0x2E, 0x5B, 0x80,
+    0x6F, 0xF9, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // c
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+    0x03, 0xC0, 0x1B, 0x8F, 0x01, 0xBF, 0xFC, 0x0B, 0x96, 0xF0, 0x3D, 0x07,
+    0xC0, 0xF0, 0x0F, 0x03, 0xC0, 0x3C, 0x0F, 0x41, 0xF0, 0x2E, 0x5B, 0xC0,
+    0x6F, 0xFF, 0x00, 0x6E, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // d
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1B, 0xE4, 0x01, 0xBF, 0xE0, 0x0B, 0x96, 0xD0, 0x3C, 0x03,
+    0x80, 0xFF, 0xFF, 0x03, 0xFF, 0xF8, 0x0F, 0x00, 0x00, 0x2E, 0x46, 0xC0,
+    0x6F, 0xF9, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // e
+    0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x0B, 0xFE, 0x00, 0x3D, 0x00, 0x01,
+    0xF4, 0x00, 0xBF, 0xFE, 0x02, 0xFF, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0xF0,
+    0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+    0x03, 0xC0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // f
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xE2, 0x80, 0x6F, 0xFF, 0x02, 0xE5, 0xBC, 0x0F, 0x41, 0xF0, 0x3C, 0x03,
+    0xC0, 0xF0, 0x0F, 0x03, 0xD0, 0x7C, 0x0B, 0x96, 0xF0, 0x1B, 0xFF, 0xC0,
+    0x1B, 0x8F, 0x00, 0x00, 0x7C, 0x0A, 0x46, 0xE0, 0x2F, 0xFE, 0x40, 0x6F,
+    0xE4, 0x00, // g
+    0x00, 0x00, 0x00, 0xA0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0xF2, 0xF9, 0x03, 0xFF, 0xF8, 0x0F, 0x91, 0xF0, 0x3D, 0x03,
+    0xC0, 0xF0, 0x0F, 0x03, 0xC0, 0x3C, 0x0F, 0x00, 0xF0, 0x3C, 0x03, 0xC0,
+    0xF0, 0x0F, 0x02, 0x80, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // h
+    0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x2F, 0xE0, 0x00, 0xBF, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+    0x00, 0xF0, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // i
+    0x00, 0x28, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+    0xF8, 0x00, 0x2F, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+    0x00, 0xF0, 0x00, 0x03, 0xC0, 0x0D, 0x1F, 0x00, 0x2F, 0xF8, 0x00, 0x6F,
+    0x90, 0x00, // j
+    0x00, 0x00, 0x00, 0xA0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0xF0, 0x1B, 0x03, 0xC1, 0xA4, 0x0F, 0x1A, 0x40, 0x3C, 0xB4,
+    0x00, 0xFF, 0xD0, 0x03, 0xE2, 0x90, 0x0F, 0x47, 0x80, 0x3C, 0x0B, 0x40,
+    0xF0, 0x1A, 0x42, 0x80, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // k
+    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0xBF, 0xC0, 0x00, 0x1F, 0x00, 0x00,
+    0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+    0x00, 0xF0, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // l
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x8B, 0x8A, 0x4F, 0xFF, 0xFE, 0x3D, 0x7E, 0x3C, 0xF0, 0xF4,
+    0xF3, 0xC3, 0xC3, 0xCF, 0x0F, 0x0F, 0x3C, 0x3C, 0x3C, 0xF0, 0xF0, 0xF3,
+    0xC3, 0xC3, 0xCA, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // m
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xA2, 0xF9, 0x03, 0xFF, 0xF8, 0x0F, 0x91, 0xF0, 0x3D, 0x03,
+    0xC0, 0xF0, 0x0F, 0x03, 0xC0, 0x3C, 0x0F, 0x00, 0xF0, 0x3C, 0x03, 0xC0,
+    0xF0, 0x0F, 0x02, 0x80, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // n
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1B, 0xE4, 0x01, 0xBF, 0xE4, 0x0B, 0x96, 0xE0, 0x3D, 0x07,
+    0xC0, 0xF0, 0x0F, 0x03, 0xC0, 0x3C, 0x0F, 0x41, 0xF0, 0x2E, 0x5B, 0x80,
+    0x6F, 0xF9, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // o
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0xB9, 0x00, 0xFF, 0xF9, 0x03, 0xE5, 0xB8, 0x0F, 0x41, 0xF0, 0x3C, 0x03,
+    0xC0, 0xF0, 0x0F, 0x03, 0xD0, 0x7C, 0x0F, 0x96, 0xE0, 0x3F, 0xFE, 0x40,
+    0xF2, 0xE4, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xA0,
+    0x00, 0x00, // p
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xE2, 0x80, 0x6F, 0xFF, 0x02, 0xE5, 0xBC, 0x0F, 0x41, 0xF0, 0x3C, 0x03,
+    0xC0, 0xF0, 0x0F, 0x03, 0xD0, 0x7C, 0x0B, 0x96, 0xF0, 0x1B, 0xFF, 0xC0,
+    0x1B, 0x8F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+    0x0A, 0x00, // q
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE5, 0xB9, 0x01, 0xFF, 0xFC, 0x03, 0xE5, 0xD0, 0x0F, 0x40,
+    0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+    0x3C, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // r
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1B, 0xE4, 0x01, 0xBF, 0xF8, 0x0B, 0x41, 0xA0, 0x3D, 0x00,
+    0x00, 0xBF, 0xF9, 0x01, 0xBF, 0xF8, 0x00, 0x01, 0xF0, 0x29, 0x07, 0x80,
+    0xBF, 0xF9, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // s
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0xB0, 0x00, 0x07,
+    0xD0, 0x00, 0xBF, 0xF8, 0x02, 0xFF, 0xE0, 0x01, 0xF4, 0x00, 0x03, 0xC0,
+    0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xD0, 0x00,
+    0x0B, 0xFE, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // t
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xA0, 0x0A, 0x03, 0xC0, 0x3C, 0x0F, 0x00, 0xF0, 0x3C, 0x03,
+    0xC0, 0xF0, 0x0F, 0x03, 0xC0, 0x3C, 0x0F, 0x01, 0xF0, 0x3D, 0x1B, 0xC0,
+    0xBF, 0xFF, 0x01, 0xBE, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // u
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE4, 0x06, 0xC1, 0xE0, 0x2D, 0x03, 0xC0, 0xF0, 0x0B, 0x47,
+    0x80, 0x1E, 0x2D, 0x00, 0x3C, 0xF0, 0x00, 0xB3, 0x80, 0x01, 0xFD, 0x00,
+    0x02, 0xF0, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // v
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x8B, 0x8A, 0x0F, 0x3F, 0x3C, 0x2C, 0xFC, 0xE0, 0x73, 0x33,
+    0x40, 0xCC, 0xCC, 0x03, 0x33, 0x30, 0x0F, 0xCF, 0xC0, 0x2E, 0x2E, 0x00,
+    0x74, 0x74, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // w
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE4, 0x1B, 0x01, 0xE0, 0xB4, 0x02, 0xD7, 0x80, 0x06, 0xF9,
+    0x00, 0x07, 0xD0, 0x00, 0x1F, 0x40, 0x01, 0xBE, 0x40, 0x0B, 0x5E, 0x00,
+    0x78, 0x2D, 0x03, 0x90, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // x
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0x02, 0x80, 0xB4, 0x0F, 0x01, 0xE0, 0x78, 0x03, 0xC2, 0xD0, 0x0B, 0x4F,
+    0x00, 0x1E, 0x3C, 0x00, 0x3C, 0xF0, 0x00, 0xB3, 0x80, 0x01, 0xFD, 0x00,
+    0x03, 0xF0, 0x00, 0x1F, 0x80, 0x01, 0xBD, 0x00, 0x2F, 0xE0, 0x00, 0xB9,
+    0x00, 0x00, // y
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0xFF, 0x82, 0xFF, 0xFE, 0x00, 0x00, 0xE4, 0x00, 0x1A,
+    0x40, 0x01, 0xA4, 0x00, 0x1A, 0x40, 0x01, 0xA4, 0x00, 0x1B, 0x00, 0x00,
+    0xBF, 0xFF, 0x82, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // z
+    0x00, 0x1B, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00,
+    0x3C, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x6E, 0x00, 0x02, 0xF4,
+    0x00, 0x0B, 0xD0, 0x00, 0x1B, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x00,
+    0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x2F, 0x80, 0x00,
+    0x6E, 0x00, // {
+    0x00, 0x28, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+    0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+    0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+    0xA0, 0x00, // |
+    0x0B, 0x90, 0x00, 0x2F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+    0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x2E, 0x40, 0x00, 0x7E,
+    0x00, 0x01, 0xF8, 0x00, 0x0B, 0x90, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00,
+    0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x0B, 0xE0, 0x00, 0x2E,
+    0x40, 0x00, // }
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xE4, 0x70, 0x2F, 0xFF,
+    0x80, 0xD1, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, // ~
+    0x00, 0x00
+};
+
+static const uint16_t FontOffset_11x18A2[] = {
+    0, 50, 100, 150, 200, 250, 300, 350, 400, 450, 500, 550,
+    600, 650, 700, 750, 800, 850, 900, 950, 1000, 1050, 1100, 1150,
+    1200, 1250, 1300, 1350, 1400, 1450, 1500, 1550, 1600, 1650, 1700, 1750,
+    1800, 1850, 1900, 1950, 2000, 2050, 2100, 2150, 2200, 2250, 2300, 2350,
+    2400, 2450, 2500, 2550, 2600, 2650, 2700, 2750, 2800, 2850, 2900, 2950,
+    3000, 3050, 3100, 3150, 3200, 3250, 3300, 3350, 3400, 3450, 3500, 3550,
+    3600, 3650, 3700, 3750, 3800, 3850, 3900, 3950, 4000, 4050, 4100, 4150,
+    4200, 4250, 4300, 4350, 4400, 4450, 4500, 4550, 4600, 4650, 4700,
+};
+
+static const uint8_t FontBitmap_11x18A4[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // sp
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // !
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x0A, 0xA0, 0x00, 0x00,
+    0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
+    0xF0, 0xFF, 0x00, 0x00, 0x00, 0xAA, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // "
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0x00,
+    0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x5F,
+    0xF5, 0x5F, 0xF4, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xB0, 0x0A, 0xFF, 0xFF,
+    0xFF, 0xFB, 0x00, 0x02, 0xFB, 0x42, 0xFB, 0x30, 0x03, 0xBF, 0x24, 0xBF,
+    0x20, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xA0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFA,
+    0x00, 0x4F, 0xF5, 0x5F, 0xF5, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
+    0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // #
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFB, 0x30, 0x00, 0x03,
+    0xCF, 0xFF, 0xFC, 0x30, 0x00, 0xBF, 0xA2, 0xF2, 0xFB, 0x00, 0x0F, 0xF2,
+    0x0F, 0x0A, 0xA0, 0x00, 0xBF, 0xA2, 0xF0, 0x00, 0x00, 0x03, 0xCF, 0xFF,
+    0x40, 0x00, 0x00, 0x03, 0xBF, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x5F, 0xFC,
+    0x30, 0x00, 0x00, 0x00, 0xF2, 0xFB, 0x00, 0x0A, 0xA0, 0x0F, 0x0F, 0xF0,
+    0x00, 0xFF, 0x40, 0xF0, 0xFF, 0x00, 0x0B, 0xFB, 0x2F, 0x2F, 0xB0, 0x00,
+    0x3C, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x3B, 0xFF, 0xC3, 0x00, 0x00, 0x00,
+    0x05, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // $
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xB3, 0x00, 0x00, 0x00, 0xBF,
+    0x2F, 0xB0, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x04, 0xD0, 0xFF, 0x0F,
+    0xF0, 0x03, 0xCB, 0x0B, 0xF2, 0xFB, 0x03, 0xCC, 0x30, 0x3B, 0xFB, 0x33,
+    0xCC, 0x30, 0x00, 0x00, 0x03, 0xCB, 0x30, 0x00, 0x00, 0x03, 0xCA, 0x10,
+    0x00, 0x00, 0x03, 0xCA, 0x2A, 0xFB, 0x30, 0x03, 0xCB, 0x1A, 0xF2, 0xFB,
+    0x00, 0xBC, 0x30, 0xFF, 0x0F, 0xF0, 0x0D, 0x40, 0x0F, 0xF0, 0xFF, 0x00,
+    0x00, 0x00, 0xBF, 0x2F, 0xB0, 0x00, 0x00, 0x03, 0xBF, 0xB3, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // %
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFB, 0x30, 0x00, 0x00,
+    0xBF, 0xFF, 0xFB, 0x00, 0x00, 0x0F, 0xF5, 0x5F, 0xF0, 0x00, 0x00, 0xFF,
+    0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF5, 0x5F, 0xB0, 0x00, 0x00, 0x3B, 0xFF,
+    0xC3, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0x40,
+    0xAA, 0x00, 0xBF, 0x54, 0xCB, 0x2F, 0xB0, 0x0F, 0xF0, 0x03, 0xBF, 0xF4,
+    0x00, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x0B, 0xF5, 0x04, 0xBF, 0xF5, 0x00,
+    0x3C, 0xFF, 0xFB, 0x2F, 0xD0, 0x00, 0x3B, 0xFB, 0x30, 0xD5, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // &
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // '
+    0x00, 0x00, 0x00, 0x05, 0xC0, 0x00, 0x00, 0x00, 0x04, 0xE5, 0x00, 0x00,
+    0x00, 0x03, 0xCB, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
+    0x0F, 0xB0, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00,
+    0x00, 0x3C, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0x5C, 0x00, // (
+    0x00, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x05, 0xE4, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xB0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00,
+    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0xBC, 0x30, 0x00, 0x00, 0x00, 0x5E, 0x40, 0x00, 0x00, 0x00, 0x0C, 0x50,
+    0x00, 0x00, 0x00, // )
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00,
+    0xD2, 0xFF, 0x2D, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x2F,
+    0xFF, 0xF2, 0x00, 0x00, 0x0D, 0xB4, 0x4B, 0xD0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // *
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x05, 0xFF,
+    0x50, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xAF, 0xFF, 0xFF, 0xFF,
+    0xFA, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // +
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x0C,
+    0x50, 0x00, 0x00, // ,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // -
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // .
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00,
+    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xF0, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40,
+    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // /
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFB, 0x30, 0x00, 0x00,
+    0xBF, 0xFF, 0xFB, 0x00, 0x00, 0x4F, 0xC4, 0x4C, 0xF4, 0x00, 0x0B, 0xF4,
+    0x00, 0x4F, 0xB0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+    0x0F, 0xF0, 0x00, 0xFF, 0x0A, 0xA0, 0xFF, 0x00, 0x0F, 0xF0, 0xAA, 0x0F,
+    0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+    0x00, 0xBF, 0x40, 0x04, 0xFB, 0x00, 0x04, 0xFC, 0x44, 0xCF, 0x40, 0x00,
+    0x0B, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x3B, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // 0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBA, 0x00, 0x00, 0x00,
+    0x03, 0xCF, 0xF0, 0x00, 0x00, 0x03, 0xCF, 0xFF, 0x00, 0x00, 0x00, 0xBB,
+    0x2F, 0xF0, 0x00, 0x00, 0x0D, 0x40, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // 1
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFB, 0x30, 0x00, 0x03,
+    0xCF, 0xFF, 0xFC, 0x30, 0x00, 0xBF, 0xC4, 0x4C, 0xFB, 0x00, 0x0F, 0xF4,
+    0x00, 0x4F, 0xF0, 0x00, 0xAA, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xB0, 0x00, 0x00, 0x00, 0x3C, 0xC3, 0x00, 0x00, 0x00, 0x3C, 0xC3,
+    0x00, 0x00, 0x00, 0x3C, 0xC3, 0x00, 0x00, 0x00, 0x3C, 0xC3, 0x00, 0x00,
+    0x00, 0x3C, 0xB3, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // 2
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xB3, 0x00, 0x00, 0x03,
+    0xCF, 0xFF, 0xC3, 0x00, 0x00, 0xBF, 0x50, 0x5F, 0xB0, 0x00, 0x0A, 0xA0,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xB0, 0x00, 0x00, 0x00, 0xAF,
+    0xF4, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x04, 0xCC,
+    0x30, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x00, 0xAB, 0x30, 0x04, 0xFF, 0x00, 0x0B, 0xFC, 0x44, 0xCF, 0xB0, 0x00,
+    0x3C, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x3B, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // 3
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBA, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x00, 0x00, 0x00, 0x0B,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x4F, 0x2F,
+    0xF0, 0x00, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x00, 0x04, 0xFA, 0x0F, 0xF0,
+    0x00, 0x00, 0xBF, 0x25, 0xFF, 0x50, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xA0,
+    0x00, 0xAF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // 4
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xA0, 0x00, 0x0F,
+    0xFF, 0xFF, 0xFA, 0x00, 0x00, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0xAF,
+    0xB3, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC3, 0x00, 0x0A, 0xB4, 0x04, 0xCF,
+    0xB0, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x00, 0xAB, 0x30, 0x04, 0xFF, 0x00, 0x0B, 0xFC, 0x44, 0xCF, 0xB0, 0x00,
+    0x3C, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x3B, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // 5
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFB, 0x30, 0x00, 0x00,
+    0xBF, 0xFF, 0xFC, 0x30, 0x00, 0x4F, 0xC4, 0x4C, 0xFB, 0x00, 0x0B, 0xF4,
+    0x00, 0x3B, 0xA0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0xAF,
+    0xB3, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC3, 0x00, 0x0F, 0xFC, 0x44, 0xCF,
+    0xB0, 0x00, 0xFF, 0x40, 0x04, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+    0x00, 0xBF, 0x40, 0x04, 0xFF, 0x00, 0x04, 0xFC, 0x44, 0xCF, 0xB0, 0x00,
+    0x0B, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x3B, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // 6
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFA, 0x00, 0x0A,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x0B,
+    0xF4, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40,
+    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // 7
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFB, 0x30, 0x00, 0x03,
+    0xCF, 0xFF, 0xFC, 0x30, 0x00, 0xBF, 0x50, 0x4C, 0xFB, 0x00, 0x0F, 0xF0,
+    0x00, 0x4F, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0xFB, 0x00, 0x04, 0xE6, 0x00,
+    0x6E, 0x40, 0x00, 0x01, 0x9F, 0xF9, 0x10, 0x00, 0x03, 0xBF, 0xFF, 0xFB,
+    0x30, 0x00, 0xBF, 0x50, 0x05, 0xFB, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0xF5, 0x00, 0x5F, 0xB0, 0x00,
+    0x3C, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x3B, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // 8
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFB, 0x30, 0x00, 0x03,
+    0xCF, 0xFF, 0xFB, 0x00, 0x00, 0xBF, 0xC4, 0x4C, 0xF4, 0x00, 0x0F, 0xF4,
+    0x00, 0x4F, 0xB0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x00,
+    0x4F, 0xF0, 0x00, 0xBF, 0xC4, 0x4C, 0xFF, 0x00, 0x03, 0xCF, 0xFF, 0xFF,
+    0xF0, 0x00, 0x03, 0xBF, 0xA2, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x00, 0xAB, 0x30, 0x04, 0xFB, 0x00, 0x0B, 0xFC, 0x44, 0xCF, 0x40, 0x00,
+    0x3C, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x3B, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // 9
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // :
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x0C,
+    0x50, 0x00, 0x00, // ;
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0xD0, 0x00, 0x00, 0x00, 0x4B, 0xFA, 0x00, 0x00, 0x04, 0xBF,
+    0xB4, 0x00, 0x00, 0x4B, 0xFB, 0x40, 0x00, 0x00, 0x0D, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0x4B, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xB4, 0x00,
+    0x00, 0x00, 0x00, 0x4B, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x05, 0xD0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // <
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFA, 0x00, 0x0A, 0xFF, 0xFF,
+    0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFA, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // =
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFB,
+    0x40, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x2F,
+    0xD0, 0x00, 0x00, 0x04, 0xBF, 0xB4, 0x00, 0x00, 0x4B, 0xFB, 0x40, 0x00,
+    0x00, 0xAF, 0xB4, 0x00, 0x00, 0x00, 0x0D, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // >
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0xB3, 0x00, 0x03,
+    0xCF, 0xFF, 0xFF, 0xC3, 0x00, 0xBF, 0xC4, 0x04, 0xCF, 0xB0, 0x0A, 0xB3,
+    0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0x00, 0x00, 0x00,
+    0x3C, 0xFB, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0x30, 0x00, 0x00, 0x3C, 0xFC,
+    0x30, 0x00, 0x00, 0x0B, 0xFC, 0x30, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // ?
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFB, 0x30, 0x00, 0x00,
+    0xBF, 0xFF, 0xFC, 0x30, 0x00, 0x4F, 0xF5, 0x05, 0xFB, 0x00, 0x0B, 0xFB,
+    0x00, 0x4F, 0xF0, 0x00, 0xFF, 0x40, 0x4C, 0xFF, 0x00, 0x0F, 0xF0, 0xAF,
+    0xFF, 0xF0, 0x00, 0xFF, 0x0F, 0xF2, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x2F,
+    0xF0, 0x00, 0xFF, 0x0B, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x3B, 0xFF, 0xA0,
+    0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x04, 0xFC, 0x45, 0xD0, 0x00, 0x00,
+    0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x3B, 0xFB, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // @
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x00, 0x00,
+    0x04, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x2F, 0xB0, 0x00, 0x00, 0x0F,
+    0xF0, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x4F, 0xB0,
+    0xBF, 0x40, 0x00, 0x0B, 0xF4, 0x04, 0xFB, 0x00, 0x00, 0xFF, 0x50, 0x5F,
+    0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0,
+    0x00, 0x4F, 0xC4, 0x04, 0xCF, 0x40, 0x0B, 0xF4, 0x00, 0x04, 0xFB, 0x00,
+    0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x00, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // A
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB3, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0xC3, 0x00, 0x00, 0xFF, 0x50, 0x5F, 0xB0, 0x00, 0x0F, 0xF0,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF5, 0x05,
+    0xFB, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xF4,
+    0x00, 0x00, 0xFF, 0x50, 0x4C, 0xC3, 0x00, 0x0F, 0xF0, 0x00, 0x4F, 0xB0,
+    0x00, 0xFF, 0x00, 0x04, 0xFF, 0x00, 0x0F, 0xF5, 0x04, 0xCF, 0xB0, 0x00,
+    0xFF, 0xFF, 0xFF, 0xC3, 0x00, 0x0A, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // B
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFB, 0x30, 0x00, 0x00,
+    0xBF, 0xFF, 0xFC, 0x30, 0x00, 0x4F, 0xC4, 0x05, 0xFB, 0x00, 0x0B, 0xF4,
+    0x00, 0x0A, 0xA0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0x40, 0x00, 0xAA, 0x00, 0x04, 0xFC, 0x40, 0x5F, 0xB0, 0x00,
+    0x0B, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x3B, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // C
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB4, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0xFA, 0x00, 0x00, 0xFF, 0x50, 0x5F, 0xF4, 0x00, 0x0F, 0xF0,
+    0x00, 0xBF, 0xB0, 0x00, 0xFF, 0x00, 0x04, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+    0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+    0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x4F, 0xB0,
+    0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xF5, 0x05, 0xFB, 0x00, 0x00,
+    0xFF, 0xFF, 0xFC, 0x30, 0x00, 0x0A, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // D
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFA, 0x00, 0x0F,
+    0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF5, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x0F, 0xFF, 0xFF, 0xFA,
+    0x00, 0x00, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // E
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFA, 0x00, 0x0F,
+    0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF5, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x0F, 0xFF, 0xFF, 0xFA,
+    0x00, 0x00, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // F
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFB, 0x30, 0x00, 0x00,
+    0xBF, 0xFF, 0xFC, 0x30, 0x00, 0x4F, 0xC4, 0x05, 0xFB, 0x00, 0x0B, 0xF4,
+    0x00, 0x0A, 0xA0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xAF,
+    0xA0, 0x00, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x4F, 0xF0,
+    0x00, 0xBF, 0x40, 0x00, 0xFF, 0x00, 0x04, 0xFC, 0x40, 0x5F, 0xF0, 0x00,
+    0x0B, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x3B, 0xFF, 0xB4, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // G
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0xAA, 0x00, 0x0F,
+    0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
+    0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF5, 0x00,
+    0x5F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x00, 0xFF, 0x50, 0x05, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0A, 0xA0, 0x00, 0x0A, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // H
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xA0, 0x00, 0x00,
+    0xAF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00,
+    0x0A, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // I
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0A, 0xA0, 0x00, 0x0F, 0xF0,
+    0x00, 0xFF, 0x40, 0x04, 0xFF, 0x00, 0x0B, 0xFC, 0x44, 0xCF, 0xB0, 0x00,
+    0x3C, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x3B, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // J
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x3B, 0xD0, 0x0F,
+    0xF0, 0x00, 0x3C, 0xC4, 0x00, 0xFF, 0x00, 0x3C, 0xC3, 0x00, 0x0F, 0xF0,
+    0x0B, 0xF4, 0x00, 0x00, 0xFF, 0x04, 0xFB, 0x00, 0x00, 0x0F, 0xF2, 0xBB,
+    0x30, 0x00, 0x00, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0x30,
+    0x00, 0x00, 0xFF, 0x55, 0xFB, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xF4, 0x00,
+    0x00, 0xFF, 0x00, 0x3C, 0xC3, 0x00, 0x0F, 0xF0, 0x00, 0x4F, 0xB0, 0x00,
+    0xFF, 0x00, 0x00, 0xBF, 0x50, 0x0A, 0xA0, 0x00, 0x03, 0xBD, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // K
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // L
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xA0, 0x00, 0xAF, 0xA0, 0x0F,
+    0xFF, 0x40, 0x4F, 0xFF, 0x00, 0xFF, 0xFB, 0x0B, 0xFF, 0xF0, 0x0F, 0xFF,
+    0xF0, 0xF2, 0xFF, 0x00, 0xFF, 0x2F, 0x0F, 0x0F, 0xF0, 0x0F, 0xF0, 0xF2,
+    0xF0, 0xFF, 0x00, 0xFF, 0x0B, 0xFB, 0x0F, 0xF0, 0x0F, 0xF0, 0x4D, 0x40,
+    0xFF, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0xFF,
+    0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x00, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // M
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xA0, 0x00, 0xAA, 0x00, 0x0F,
+    0xFF, 0x40, 0x0F, 0xF0, 0x00, 0xFF, 0xFB, 0x00, 0xFF, 0x00, 0x0F, 0xFF,
+    0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0x40, 0xFF, 0x00, 0x0F, 0xF2, 0xFB,
+    0x0F, 0xF0, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0xBF, 0x0F,
+    0xF0, 0x00, 0xFF, 0x04, 0xF2, 0xFF, 0x00, 0x0F, 0xF0, 0x0F, 0xFF, 0xF0,
+    0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x0B, 0xFF, 0xF0, 0x00,
+    0xFF, 0x00, 0x4F, 0xFF, 0x00, 0x0A, 0xA0, 0x00, 0xAF, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // N
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFB, 0x30, 0x00, 0x00,
+    0xBF, 0xFF, 0xFB, 0x00, 0x00, 0x4F, 0xC4, 0x4C, 0xF4, 0x00, 0x0B, 0xF4,
+    0x00, 0x4F, 0xB0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+    0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+    0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+    0x00, 0xBF, 0x40, 0x04, 0xFB, 0x00, 0x04, 0xFC, 0x44, 0xCF, 0x40, 0x00,
+    0x0B, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x3B, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // O
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFB, 0x30, 0x00, 0x0F,
+    0xFF, 0xFF, 0xFC, 0x30, 0x00, 0xFF, 0x50, 0x4C, 0xFB, 0x00, 0x0F, 0xF0,
+    0x00, 0x4F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+    0x4F, 0xF0, 0x00, 0xFF, 0x50, 0x4C, 0xFB, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
+    0x30, 0x00, 0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x0F, 0xF5, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // P
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFB, 0x30, 0x00, 0x00,
+    0xBF, 0xFF, 0xFB, 0x00, 0x00, 0x4F, 0xC4, 0x4C, 0xF4, 0x00, 0x0B, 0xF4,
+    0x00, 0x4F, 0xB0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+    0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+    0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x0D, 0x2F, 0xF0,
+    0x00, 0xBF, 0x40, 0xAF, 0xFA, 0x00, 0x04, 0xFC, 0x42, 0xFF, 0x20, 0x00,
+    0x0B, 0xFF, 0xFF, 0xFE, 0x50, 0x00, 0x3B, 0xFF, 0xB4, 0x5C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // Q
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFB, 0x30, 0x00, 0x0F,
+    0xFF, 0xFF, 0xFC, 0x30, 0x00, 0xFF, 0x50, 0x4C, 0xFB, 0x00, 0x0F, 0xF0,
+    0x00, 0x4F, 0xF0, 0x00, 0xFF, 0x00, 0x04, 0xFF, 0x00, 0x0F, 0xF5, 0x04,
+    0xCF, 0xB0, 0x00, 0xFF, 0xFF, 0xFF, 0xC3, 0x00, 0x0F, 0xFF, 0xFF, 0xF4,
+    0x00, 0x00, 0xFF, 0x54, 0xCF, 0x40, 0x00, 0x0F, 0xF0, 0x04, 0xFB, 0x00,
+    0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x4F, 0xB0, 0x00,
+    0xFF, 0x00, 0x00, 0xBF, 0x50, 0x0A, 0xA0, 0x00, 0x03, 0xBD, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // R
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFB, 0x30, 0x00, 0x00,
+    0x3C, 0xFF, 0xFC, 0x30, 0x00, 0x0B, 0xF5, 0x05, 0xFB, 0x00, 0x00, 0xFF,
+    0x00, 0x0A, 0xA0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC4,
+    0x00, 0x00, 0x00, 0x03, 0xBF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x4C, 0xFC,
+    0x30, 0x00, 0x00, 0x00, 0x3C, 0xFB, 0x00, 0x0A, 0xA0, 0x00, 0x4F, 0xF0,
+    0x00, 0xBF, 0x40, 0x00, 0xFF, 0x00, 0x04, 0xFC, 0x40, 0x5F, 0xB0, 0x00,
+    0x0B, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x3B, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // S
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xAF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // T
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0xAA, 0x00, 0x0F,
+    0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
+    0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+    0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+    0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+    0x00, 0xFF, 0x40, 0x04, 0xFF, 0x00, 0x0B, 0xFC, 0x44, 0xCF, 0xB0, 0x00,
+    0x3C, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x3B, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // U
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x0A, 0xA0, 0x0F,
+    0xF0, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0x40, 0x00, 0x4F, 0xB0, 0x04, 0xFB,
+    0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40,
+    0x4F, 0xB0, 0x00, 0x04, 0xFB, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF2, 0xFB, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // V
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x00, 0xAA,
+    0x00, 0xFB, 0x04, 0xF0, 0x0F, 0xF0, 0x0F, 0x40, 0x0F, 0x04, 0xFF, 0x40,
+    0xF0, 0x00, 0xF0, 0xBF, 0xFB, 0x0F, 0x00, 0x0F, 0x0F, 0x55, 0xF0, 0xF0,
+    0x00, 0xF2, 0xF0, 0x0F, 0x2F, 0x00, 0x0F, 0xFB, 0x00, 0xBF, 0xF0, 0x00,
+    0xFF, 0x40, 0x04, 0xFF, 0x00, 0x0A, 0xA0, 0x00, 0x0A, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // W
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xB3, 0x00, 0x00, 0x0A, 0xD0, 0x5F,
+    0xB0, 0x00, 0x04, 0xF5, 0x00, 0xBF, 0x40, 0x03, 0xCB, 0x00, 0x04, 0xFC,
+    0x30, 0xBF, 0x40, 0x00, 0x0B, 0xFB, 0x2F, 0xB0, 0x00, 0x00, 0x3C, 0xFF,
+    0xC3, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0xBF, 0xFC, 0x30, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00,
+    0x00, 0x3C, 0xFB, 0x2B, 0xF4, 0x00, 0x0B, 0xFC, 0x30, 0x4F, 0xB0, 0x05,
+    0xFC, 0x30, 0x00, 0xBF, 0x50, 0xDB, 0x30, 0x00, 0x03, 0xBD, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // X
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xB3, 0x00, 0x00, 0x3B, 0xD0, 0x5F,
+    0xB0, 0x00, 0x0B, 0xF5, 0x00, 0xBF, 0x40, 0x04, 0xFB, 0x00, 0x04, 0xFB,
+    0x00, 0xBF, 0x40, 0x00, 0x0B, 0xF5, 0x5F, 0xB0, 0x00, 0x00, 0x4F, 0xFF,
+    0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // Y
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFA, 0x00, 0x00,
+    0xAF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x3C,
+    0xC3, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00,
+    0x00, 0x3C, 0xB3, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // Z
+    0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xA0, 0x00, 0x00,
+    0x00, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x0A,
+    0xFF, 0xA0, 0x00, // [
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x04,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, /* \ */
+    0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x5F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
+    0x05, 0xFF, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xAF,
+    0xFA, 0x00, 0x00, // ]
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00,
+    0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x00, 0x00, 0x00, 0x4F,
+    0x55, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xB0, 0x00, 0x04, 0xFB, 0x00,
+    0xBF, 0x40, 0x00, 0xBF, 0x40, 0x04, 0xFB, 0x00, 0x0A, 0xA0, 0x00, 0x0A,
+    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // ^
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
+    0x00, 0x00, 0x00, // _
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x4C, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xD0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // `
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0xB3, 0x00, 0x04, 0xCF, 0xFF,
+    0xFF, 0xB0, 0x00, 0xDB, 0x40, 0x05, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x5F,
+    0xF0, 0x00, 0x03, 0xBF, 0xFF, 0xFF, 0x00, 0x03, 0xCF, 0xFF, 0xFF, 0xF0,
+    0x00, 0xBF, 0x50, 0x02, 0xFF, 0x00, 0x0F, 0xF5, 0x04, 0xBF, 0xF0, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0x50, 0x03, 0xBF, 0xB4, 0x04, 0xBD, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // a
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x2A, 0xFB, 0x30, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFC, 0x30, 0x00, 0xFF, 0xC4, 0x4C, 0xFB, 0x00, 0x0F, 0xF4, 0x00, 0x4F,
+    0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+    0x00, 0xFF, 0x40, 0x04, 0xFF, 0x00, 0x0F, 0xFC, 0x44, 0xCF, 0xB0, 0x00,
+    0xFF, 0xFF, 0xFF, 0xC3, 0x00, 0x0A, 0xA2, 0xAF, 0xB3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // b
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFB, 0x30, 0x00, 0x03, 0xCF, 0xFF,
+    0xFC, 0x30, 0x00, 0xBF, 0xC4, 0x4C, 0xFB, 0x00, 0x0F, 0xF4, 0x00, 0x3B,
+    0xA0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x40, 0x03, 0xBA, 0x00, 0x0B, 0xFC, 0x44, 0xCF, 0xB0, 0x00,
+    0x3C, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x3B, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // c
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xF0, 0x00, 0x03, 0xBF, 0xA2, 0xFF, 0x00, 0x03, 0xCF, 0xFF,
+    0xFF, 0xF0, 0x00, 0xBF, 0xC4, 0x4C, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x4F,
+    0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+    0x00, 0xFF, 0x40, 0x04, 0xFF, 0x00, 0x0B, 0xFC, 0x44, 0xCF, 0xF0, 0x00,
+    0x3C, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3B, 0xFA, 0x2A, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // d
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFB, 0x30, 0x00, 0x03, 0xCF, 0xFF,
+    0xFB, 0x00, 0x00, 0xBF, 0xB4, 0x4B, 0xF4, 0x00, 0x0F, 0xF2, 0x00, 0x2F,
+    0xB0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xA0,
+    0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x40, 0x4B, 0xD0, 0x00,
+    0x3C, 0xFF, 0xFF, 0xC4, 0x00, 0x00, 0x3B, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // e
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0xA0, 0x00,
+    0x00, 0xBF, 0xFF, 0xFA, 0x00, 0x00, 0x0F, 0xF5, 0x00, 0x00, 0x00, 0x05,
+    0xFF, 0x50, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFA, 0x00, 0x0A, 0xFF, 0xFF,
+    0xFF, 0xA0, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // f
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B,
+    0xFA, 0x2A, 0xA0, 0x00, 0x3C, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFC, 0x44,
+    0xCF, 0xF0, 0x00, 0xFF, 0x40, 0x04, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+    0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x4F, 0xF0,
+    0x00, 0xBF, 0xC4, 0x4C, 0xFF, 0x00, 0x03, 0xCF, 0xFF, 0xFF, 0xF0, 0x00,
+    0x03, 0xBF, 0xA2, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0x00, 0xAB,
+    0x40, 0x4C, 0xFB, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x30, 0x00, 0x3B, 0xFF,
+    0xFB, 0x30, 0x00, // g
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x2A, 0xFF, 0xB3, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xB0, 0x00, 0xFF, 0xC4, 0x05, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x0F,
+    0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0A, 0xA0, 0x00, 0x0A, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // h
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0xAF, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // i
+    0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF,
+    0xFF, 0xA0, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x5F,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xD5,
+    0x05, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x3B, 0xFF,
+    0xB3, 0x00, 0x00, // j
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xBD, 0x00, 0x0F, 0xF0, 0x03,
+    0xCC, 0x40, 0x00, 0xFF, 0x03, 0xCC, 0x30, 0x00, 0x0F, 0xF2, 0xBF, 0x40,
+    0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFB, 0x2B, 0xC3, 0x00,
+    0x00, 0xFF, 0x40, 0x4F, 0xB0, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x40, 0x00,
+    0xFF, 0x00, 0x03, 0xCC, 0x40, 0x0A, 0xA0, 0x00, 0x03, 0xBD, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // k
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // l
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xA2, 0xAF, 0xA2, 0xAB, 0x30, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFB, 0x0F, 0xF5, 0x5F, 0xFB, 0x2F, 0xF0, 0xFF, 0x00, 0xFF, 0x40,
+    0xFF, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+    0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x0F,
+    0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // m
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xAA, 0x2A, 0xFF, 0xB3, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xB0, 0x00, 0xFF, 0xC4, 0x05, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x0F,
+    0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0A, 0xA0, 0x00, 0x0A, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // n
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFB, 0x30, 0x00, 0x03, 0xCF, 0xFF,
+    0xFC, 0x30, 0x00, 0xBF, 0xC4, 0x4C, 0xFB, 0x00, 0x0F, 0xF4, 0x00, 0x4F,
+    0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+    0x00, 0xFF, 0x40, 0x04, 0xFF, 0x00, 0x0B, 0xFC, 0x44, 0xCF, 0xB0, 0x00,
+    0x3C, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x3B, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // o
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA2,
+    0xAF, 0xB3, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC3, 0x00, 0x0F, 0xFC, 0x44,
+    0xCF, 0xB0, 0x00, 0xFF, 0x40, 0x04, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+    0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x4F, 0xF0,
+    0x00, 0xFF, 0xC4, 0x4C, 0xFB, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x30, 0x00,
+    0xFF, 0x2A, 0xFB, 0x30, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00,
+    0x00, 0x00, 0x00, // p
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B,
+    0xFA, 0x2A, 0xA0, 0x00, 0x3C, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFC, 0x44,
+    0xCF, 0xF0, 0x00, 0xFF, 0x40, 0x04, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+    0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x4F, 0xF0,
+    0x00, 0xBF, 0xC4, 0x4C, 0xFF, 0x00, 0x03, 0xCF, 0xFF, 0xFF, 0xF0, 0x00,
+    0x03, 0xBF, 0xA2, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0xAA, 0x00, // q
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xDB, 0x44, 0xBF, 0xB4, 0x00, 0x05, 0xFF, 0xFF,
+    0xFF, 0xD0, 0x00, 0x0F, 0xFC, 0x45, 0xD5, 0x00, 0x00, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // r
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFB, 0x40, 0x00, 0x03, 0xCF, 0xFF,
+    0xFF, 0xA0, 0x00, 0xBF, 0x50, 0x04, 0xBA, 0x00, 0x0F, 0xF5, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xB3, 0x00, 0x03, 0xBF, 0xFF, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x0A, 0xB4, 0x00, 0x5F, 0xB0, 0x00,
+    0xAF, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x4B, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // s
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x5F,
+    0xF5, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xA0, 0x00, 0x0A, 0xFF, 0xFF,
+    0xFA, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF5, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0xFA, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // t
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0xAA, 0x00, 0x0F, 0xF0, 0x00,
+    0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+    0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+    0x00, 0xFF, 0x00, 0x04, 0xFF, 0x00, 0x0F, 0xF5, 0x04, 0xCF, 0xF0, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xBF, 0xFA, 0x2A, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // u
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xDB, 0x30, 0x00, 0x3B, 0xD0, 0x05, 0xFB, 0x00,
+    0x0B, 0xF5, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x4F,
+    0xB0, 0x00, 0x04, 0xFB, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00,
+    0x00, 0x00, 0xBF, 0x2F, 0xB0, 0x00, 0x00, 0x04, 0xFF, 0xF4, 0x00, 0x00,
+    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xA0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // v
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xA0, 0xAF, 0xA0, 0xAA, 0x00, 0xFF, 0x0F, 0xFF,
+    0x0F, 0xF0, 0x0B, 0xF0, 0xFF, 0xF0, 0xFB, 0x00, 0x4F, 0x0F, 0x2F, 0x0F,
+    0x40, 0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0x00, 0x0F, 0x2F, 0x0F, 0x2F, 0x00,
+    0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x0B, 0xFB, 0x0B, 0xFB, 0x00, 0x00,
+    0x4F, 0x40, 0x4F, 0x40, 0x00, 0x00, 0xD0, 0x00, 0xD0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // w
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xDB, 0x30, 0x03, 0xBD, 0x00, 0x05, 0xFB, 0x00,
+    0xBF, 0x50, 0x00, 0x0B, 0xF5, 0x5F, 0xB0, 0x00, 0x00, 0x3C, 0xFF, 0xC3,
+    0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00,
+    0x00, 0x03, 0xCF, 0xFC, 0x30, 0x00, 0x00, 0xBF, 0x55, 0xFB, 0x00, 0x00,
+    0x5F, 0xB0, 0x0B, 0xF5, 0x00, 0x0D, 0xB3, 0x00, 0x3B, 0xD0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // x
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0,
+    0x00, 0x0A, 0xA0, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x00, 0x04, 0xFB, 0x00,
+    0x4F, 0xB0, 0x00, 0x0F, 0xF0, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0x40, 0xFF,
+    0x00, 0x00, 0x04, 0xFB, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00,
+    0x00, 0x00, 0xBF, 0x2F, 0xB0, 0x00, 0x00, 0x04, 0xFF, 0xF4, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x00, 0x04,
+    0xCF, 0xF4, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0xAF, 0xB4,
+    0x00, 0x00, 0x00, // y
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xA0, 0x0A, 0xFF, 0xFF,
+    0xFF, 0xFB, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x30, 0x00, 0x00, 0x03, 0xBC,
+    0x30, 0x00, 0x00, 0x03, 0xCC, 0x30, 0x00, 0x00, 0x03, 0xCC, 0x30, 0x00,
+    0x00, 0x03, 0xCB, 0x30, 0x00, 0x00, 0x03, 0xCF, 0x20, 0x00, 0x00, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xA0, 0x0A, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // z
+    0x00, 0x00, 0x03, 0xBF, 0xA0, 0x00, 0x00, 0x00, 0xBF, 0xFA, 0x00, 0x00,
+    0x00, 0x0F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xF0, 0x00, 0x00, 0x00, 0x3C, 0xFB, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xCF, 0xB0, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xA0, 0x00, 0x00, 0x00,
+    0x3B, 0xFA, 0x00, // {
+    0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0xAA, 0x00, 0x00, // |
+    0x00, 0xAF, 0xB3, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+    0x05, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x40, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x4F, 0xFB,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xBF, 0xC3, 0x00,
+    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x5F, 0xF0, 0x00, 0x00, 0x00, 0xAF, 0xFB, 0x00, 0x00, 0x00, 0x0A, 0xFB,
+    0x30, 0x00, 0x00, // }
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3B, 0xFB, 0x40, 0x5D, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
+    0xB0, 0x00, 0xD5, 0x04, 0xBF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // ~
+    0x00, 0x00
+};
+
+static const uint16_t FontOffset_11x18A4[] = {
+    0, 99, 198, 297, 396, 495, 594, 693, 792, 891, 990, 1089,
+    1188, 1287, 1386, 1485, 1584, 1683, 1782, 1881, 1980, 2079, 2178, 2277,
+    2376, 2475, 2574, 2673, 2772, 2871, 2970, 3069, 3168, 3267, 3366, 3465,
+    3564, 3663, 3762, 3861, 3960, 4059, 4158, 4257, 4356, 4455, 4554, 4653,
+    4752, 4851, 4950, 5049, 5148, 5247, 5346, 5445, 5544, 5643, 5742, 5841,
+    5940, 6039, 6138, 6237, 6336, 6435, 6534, 6633, 6732, 6831, 6930, 7029,
+    7128, 7227, 7326, 7425, 7524, 7623, 7722, 7821, 7920, 8019, 8118, 8217,
+    8316, 8415, 8514, 8613, 8712, 8811, 8910, 9009, 9108, 9207, 9306,
+};
+
+static const uint8_t FontBitmap_16x26A2[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // sp
+    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
+    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
+    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00,
+    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
+    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // !
+    0x02, 0xF8, 0x0B, 0xE0, 0x03, 0xFC, 0x0F, 0xF0, 0x03, 0xFC, 0x0F, 0xF0,
+    0x03, 0xFC, 0x0F, 0xF0, 0x03, 0xFC, 0x0F, 0xF0, 0x03, 0xFC, 0x0F, 0xF0,
+    0x02, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // "
+    0x00, 0x06, 0xE0, 0xB8, 0x00, 0x0B, 0xF1, 0xFC, 0x00, 0x0F, 0xE2, 0xFC,
+    0x00, 0x0F, 0xD3, 0xF8, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x6F, 0xD7, 0xF4,
+    0x1B, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0x5F, 0xD0,
+    0x00, 0xBF, 0x1F, 0xC0, 0x00, 0xFF, 0x2F, 0xC0, 0x00, 0xFE, 0x3F, 0xC0,
+    0x01, 0xFC, 0x7F, 0xD0, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE,
+    0x07, 0xF8, 0xFF, 0x40, 0x03, 0xF4, 0xFE, 0x00, 0x07, 0xF0, 0xFD, 0x00,
+    0x0B, 0xF1, 0xFC, 0x00, 0x0F, 0xE2, 0xFC, 0x00, 0x0B, 0x92, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // #
+    0x00, 0x1B, 0xFF, 0xE4, 0x01, 0xBF, 0xFF, 0xF8, 0x02, 0xFF, 0xFC, 0xB8,
+    0x03, 0xFC, 0xFC, 0x00, 0x03, 0xFC, 0xFC, 0x00, 0x03, 0xFC, 0xFC, 0x00,
+    0x03, 0xFC, 0xFC, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x01, 0xBF, 0xFC, 0x00,
+    0x00, 0x6F, 0xFD, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x07, 0xFF, 0xE4,
+    0x00, 0x03, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFC,
+    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFC,
+    0x0B, 0xE3, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xE4, 0x01, 0xBF, 0xFE, 0x40,
+    0x00, 0x07, 0xFD, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // $
+    0x1B, 0xF9, 0x00, 0x1A, 0xBE, 0x3E, 0x40, 0x6F, 0xFD, 0x3F, 0x80, 0xBE,
+    0xFC, 0x2F, 0xC1, 0xFD, 0xFC, 0x1F, 0xC6, 0xF8, 0xFC, 0x1F, 0xCB, 0xE4,
+    0xFC, 0x2F, 0xCF, 0xD0, 0xFD, 0x3F, 0xFF, 0x80, 0xBE, 0x3F, 0xFE, 0x40,
+    0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1B, 0xFF, 0xFE,
+    0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x5F, 0x01, 0xBF, 0xFF, 0x0F,
+    0x06, 0xF8, 0xFF, 0x0F, 0x0B, 0xE4, 0xFF, 0x0F, 0x1F, 0xD0, 0xFF, 0x0F,
+    0x6F, 0x80, 0xBF, 0x5F, 0xBE, 0x40, 0x6F, 0xFF, 0xB9, 0x00, 0x1B, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // %
+    0x00, 0x6F, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x01, 0xFF, 0x3F, 0xC0,
+    0x02, 0xFF, 0x3F, 0xC0, 0x03, 0xFF, 0x3F, 0xC0, 0x02, 0xFF, 0x3F, 0xC0,
+    0x01, 0xFF, 0x3F, 0x80, 0x00, 0xFF, 0xFE, 0x40, 0x01, 0xFF, 0xF9, 0x00,
+    0x06, 0xFF, 0xC0, 0x00, 0x6F, 0xFF, 0xE0, 0x0A, 0xBF, 0x8F, 0xF4, 0x1F,
+    0xFF, 0x4B, 0xF9, 0x2F, 0xFF, 0x06, 0xFE, 0x3F, 0xFF, 0x01, 0xFF, 0x3F,
+    0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x6F, 0xFE, 0xBF, 0x90, 0x0F, 0xFC,
+    0x6F, 0xE4, 0x6F, 0xFE, 0x1B, 0xFF, 0xFF, 0xFF, 0x06, 0xFF, 0xF8, 0xBE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // &
+    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
+    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xF4, 0x00,
+    0x00, 0x06, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '
+    0x00, 0x00, 0x1B, 0xFF, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x02, 0xFE, 0x40,
+    0x00, 0x07, 0xF9, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0x2F, 0xE0, 0x00,
+    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00,
+    0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
+    0x00, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00,
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0x07, 0xF9, 0x00,
+    0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x00, 0x1B, 0xFE,
+    0x00, 0x00, 0x01, 0xBE, 0x00, 0x00, 0x00, 0x00, // (
+    0x3F, 0xF9, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x00, 0x6F, 0xE0, 0x00,
+    0x00, 0x1B, 0xF4, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x00, 0x02, 0xFE, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x80,
+    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0,
+    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0,
+    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00,
+    0x00, 0x02, 0xFE, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x00, 0x1B, 0xF4, 0x00,
+    0x00, 0x6F, 0xE0, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x2F, 0xF9, 0x00, 0x00,
+    0x2F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // )
+    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00,
+    0x0B, 0x97, 0xF5, 0xB9, 0x0F, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0x2F, 0xFE,
+    0x00, 0x1F, 0x0C, 0x00, 0x00, 0x1F, 0x2E, 0x40, 0x00, 0x6F, 0xFF, 0x80,
+    0x01, 0xBF, 0x2F, 0xD0, 0x03, 0xFE, 0x1F, 0xF0, 0x00, 0x69, 0x0B, 0x90,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // *
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
+    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
+    0x00, 0x07, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE,
+    0x00, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
+    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // +
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
+    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00,
+    0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00,
+    0x00, 0x07, 0xE4, 0x00, 0x00, 0x0F, 0x90, 0x00, // ,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8,
+    0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // -
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
+    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .
+    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x02, 0xFD,
+    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xE0,
+    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0x40,
+    0x00, 0x01, 0xFE, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x07, 0xF8, 0x00,
+    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00,
+    0x00, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x01, 0xFE, 0x00, 0x00,
+    0x02, 0xFD, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
+    0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
+    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // /
+    0x00, 0x6F, 0xFE, 0x40, 0x01, 0xBF, 0xFF, 0x90, 0x06, 0xFE, 0x2F, 0xE4,
+    0x0B, 0xF9, 0x1B, 0xF8, 0x1F, 0xF4, 0x07, 0xFD, 0x2F, 0xF0, 0x03, 0xFE,
+    0x3F, 0xE0, 0x02, 0xFF, 0x3F, 0xD0, 0x01, 0xFF, 0x3F, 0xC0, 0x00, 0xFF,
+    0x3F, 0xC0, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0xFF,
+    0x3F, 0xC0, 0x00, 0xFF, 0x3F, 0xD0, 0x01, 0xFF, 0x3F, 0xE0, 0x02, 0xFF,
+    0x2F, 0xF0, 0x03, 0xFE, 0x1F, 0xF4, 0x07, 0xFD, 0x0B, 0xF9, 0x1B, 0xF8,
+    0x06, 0xFE, 0x2F, 0xE4, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x6F, 0xFE, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0
+    0x00, 0x01, 0xBE, 0x00, 0x00, 0x6F, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00,
+    0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00,
+    0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00,
+    0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00,
+    0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00,
+    0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00,
+    0x00, 0x07, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 1
+    0x01, 0xBF, 0xF9, 0x00, 0x0B, 0xFF, 0xFF, 0x90, 0x0B, 0xE4, 0x6F, 0xE0,
+    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xFC,
+    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0,
+    0x00, 0x00, 0x6F, 0xE0, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x06, 0xFE, 0x40,
+    0x00, 0x1B, 0xF9, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x7F, 0x90, 0x00,
+    0x01, 0xBE, 0x40, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
+    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 2
+    0x01, 0xBF, 0xFE, 0x40, 0x02, 0xFF, 0xFF, 0x90, 0x02, 0xE4, 0x6F, 0xE4,
+    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8,
+    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xBF, 0x90,
+    0x00, 0xBF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x6F, 0xE4,
+    0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFC,
+    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1B, 0xF8,
+    0x02, 0xE4, 0x6F, 0xE4, 0x03, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xF9, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 3
+    0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0xC0,
+    0x00, 0x06, 0xFF, 0xC0, 0x00, 0x1B, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xC0,
+    0x00, 0x7F, 0xFF, 0xC0, 0x01, 0xBE, 0x3F, 0xC0, 0x02, 0xFD, 0x3F, 0xC0,
+    0x07, 0xF8, 0x3F, 0xC0, 0x1B, 0xE4, 0x3F, 0xC0, 0x2F, 0xD0, 0x3F, 0xC0,
+    0x7F, 0xD0, 0x7F, 0xD0, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE,
+    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0,
+    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x2F, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 4
+    0x02, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xE0,
+    0x03, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
+    0x03, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xF9, 0x00,
+    0x02, 0xFF, 0xFF, 0x90, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x6F, 0xF4,
+    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFC,
+    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF4,
+    0x02, 0xE4, 0x6F, 0xE0, 0x03, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xF9, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 5
+    0x00, 0x06, 0xFF, 0xE4, 0x00, 0x6F, 0xFF, 0xF8, 0x01, 0xBF, 0x91, 0xB8,
+    0x02, 0xFE, 0x40, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
+    0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF2, 0xFF, 0x90,
+    0x1F, 0xFF, 0xFF, 0xE4, 0x2F, 0xFE, 0x5B, 0xF9, 0x2F, 0xF9, 0x06, 0xFE,
+    0x1F, 0xF4, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0xFF,
+    0x0F, 0xF4, 0x00, 0xFF, 0x0B, 0xF8, 0x01, 0xFF, 0x07, 0xFD, 0x06, 0xFE,
+    0x02, 0xFE, 0x5B, 0xF9, 0x01, 0xBF, 0xFF, 0xE4, 0x00, 0x1B, 0xFE, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 6
+    0x0B, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x07, 0xF8,
+    0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x6F, 0x80,
+    0x00, 0x00, 0xBF, 0x40, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x02, 0xFD, 0x00,
+    0x00, 0x07, 0xF8, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x00,
+    0x00, 0x6F, 0xD0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00,
+    0x01, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 7
+    0x00, 0x6F, 0xFF, 0x90, 0x01, 0xBF, 0xFF, 0xE4, 0x02, 0xFE, 0x5B, 0xF8,
+    0x07, 0xFD, 0x07, 0xFC, 0x0B, 0xFC, 0x03, 0xFC, 0x0B, 0xFC, 0x03, 0xFC,
+    0x07, 0xFD, 0x07, 0xF8, 0x02, 0xFE, 0x5B, 0xE4, 0x01, 0xBF, 0xFF, 0x90,
+    0x00, 0x3F, 0xFF, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x06, 0xFC, 0xBF, 0xE4,
+    0x0B, 0xF8, 0x1B, 0xF9, 0x1F, 0xF4, 0x07, 0xFE, 0x2F, 0xF0, 0x02, 0xFF,
+    0x3F, 0xF0, 0x01, 0xFF, 0x2F, 0xF0, 0x01, 0xFF, 0x1F, 0xF4, 0x06, 0xFE,
+    0x0B, 0xFE, 0x5B, 0xF9, 0x06, 0xFF, 0xFF, 0xE4, 0x00, 0x6F, 0xFE, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 8
+    0x00, 0x6F, 0xFE, 0x40, 0x01, 0xBF, 0xFF, 0x90, 0x06, 0xF9, 0x6F, 0xE4,
+    0x0B, 0xF4, 0x1B, 0xF8, 0x1F, 0xF0, 0x07, 0xFD, 0x2F, 0xF0, 0x03, 0xFE,
+    0x3F, 0xF0, 0x03, 0xFF, 0x3F, 0xF0, 0x03, 0xFF, 0x2F, 0xF0, 0x03, 0xFF,
+    0x1F, 0xF4, 0x07, 0xFF, 0x0B, 0xF9, 0x1B, 0xFF, 0x06, 0xFF, 0xFF, 0xFF,
+    0x00, 0x6F, 0xF9, 0xFF, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x03, 0xFD,
+    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x1F, 0xE4,
+    0x0B, 0x91, 0xBF, 0x90, 0x0B, 0xFF, 0xFE, 0x40, 0x06, 0xFF, 0xF9, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 9
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
+    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
+    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // :
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
+    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
+    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00,
+    0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00,
+    0x00, 0x0B, 0xE4, 0x00, 0x00, 0x0B, 0x90, 0x00, // ;
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x01, 0xBF, 0x00, 0x00, 0x1B, 0xFE,
+    0x00, 0x01, 0xBF, 0xE4, 0x00, 0x1B, 0xFE, 0x40, 0x01, 0xBF, 0xE4, 0x00,
+    0x1B, 0xFE, 0x40, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00,
+    0x01, 0xBF, 0xE4, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x01, 0xBF, 0xE4,
+    0x00, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x01, 0xBF, 0x00, 0x00, 0x00, 0x1A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // <
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // =
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xB9, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00,
+    0x06, 0xFF, 0x90, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x06, 0xFF, 0x90,
+    0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x6F, 0xF9,
+    0x00, 0x06, 0xFF, 0x90, 0x00, 0x6F, 0xF9, 0x00, 0x06, 0xFF, 0x90, 0x00,
+    0x6F, 0xF9, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // >
+    0x06, 0xFF, 0xFE, 0x40, 0x0B, 0xFF, 0xFF, 0xE4, 0x0F, 0xD0, 0x1B, 0xF9,
+    0x0F, 0xC0, 0x07, 0xFE, 0x0B, 0x80, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFD,
+    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x6F, 0x90,
+    0x00, 0x01, 0xBE, 0x40, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x0B, 0xF4, 0x00,
+    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ?
+    0x00, 0x1B, 0xFF, 0x90, 0x01, 0xBF, 0xFF, 0xF8, 0x06, 0xFE, 0x46, 0xFD,
+    0x0B, 0xF9, 0x00, 0xFE, 0x1F, 0xE4, 0x6F, 0xFF, 0x2F, 0xD1, 0xBF, 0xFF,
+    0x3F, 0x86, 0xF8, 0xBF, 0x7F, 0x4B, 0xF4, 0x7F, 0xBF, 0x0F, 0xE0, 0x7F,
+    0xFF, 0x0F, 0xD0, 0xBF, 0xFF, 0x0F, 0xC0, 0xFF, 0xFF, 0x0F, 0xC1, 0xFF,
+    0xFF, 0x0F, 0xC2, 0xFF, 0xBF, 0x0F, 0xD7, 0xFF, 0x7F, 0x4F, 0xFF, 0xFF,
+    0x3F, 0x8B, 0xFF, 0xFF, 0x2F, 0xD6, 0xFE, 0x2E, 0x1B, 0xE4, 0x00, 0x00,
+    0x06, 0xFE, 0x46, 0xE0, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x1B, 0xFF, 0x90,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // @
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x2F, 0xFE, 0x00,
+    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0xBF, 0x3F, 0x80,
+    0x00, 0xFE, 0x3F, 0xD0, 0x01, 0xFD, 0x2F, 0xE0, 0x02, 0xFC, 0x1F, 0xF0,
+    0x07, 0xF8, 0x0F, 0xF4, 0x0B, 0xF0, 0x1F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFD,
+    0x1F, 0xFF, 0xFF, 0xFE, 0x2F, 0xD0, 0x06, 0xFF, 0x7F, 0x80, 0x01, 0xFF,
+    0xBF, 0x40, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x2E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // A
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0xFF, 0x90, 0x0F, 0xFF, 0xFF, 0xE4, 0x0F, 0xF4, 0x1B, 0xF8,
+    0x0F, 0xF0, 0x07, 0xFC, 0x0F, 0xF0, 0x03, 0xFC, 0x0F, 0xF0, 0x07, 0xFC,
+    0x0F, 0xF0, 0x1B, 0xF8, 0x0F, 0xF4, 0x6F, 0xE4, 0x0F, 0xFF, 0xFF, 0x00,
+    0x0F, 0xFF, 0xFF, 0x90, 0x0F, 0xF4, 0x6F, 0xF9, 0x0F, 0xF0, 0x07, 0xFE,
+    0x0F, 0xF0, 0x02, 0xFF, 0x0F, 0xF0, 0x01, 0xFF, 0x0F, 0xF0, 0x01, 0xFF,
+    0x0F, 0xF4, 0x06, 0xFE, 0x0F, 0xFF, 0xFF, 0xF9, 0x0B, 0xFF, 0xFF, 0x90,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // B
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xFF, 0xFE, 0x00, 0x6F, 0xFF, 0xFF, 0x06, 0xFF, 0x90, 0x6E,
+    0x0B, 0xF9, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
+    0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
+    0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
+    0x2F, 0xF4, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00,
+    0x06, 0xFF, 0x90, 0x1A, 0x00, 0x6F, 0xFF, 0xFF, 0x00, 0x06, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // C
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2F, 0xFF, 0xFE, 0x40, 0x3F, 0xFF, 0xFF, 0xE4, 0x3F, 0xD0, 0x6F, 0xF9,
+    0x3F, 0xC0, 0x07, 0xFE, 0x3F, 0xC0, 0x02, 0xFF, 0x3F, 0xC0, 0x01, 0xFF,
+    0x3F, 0xC0, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0xFF,
+    0x3F, 0xC0, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0xFF,
+    0x3F, 0xC0, 0x01, 0xFF, 0x3F, 0xC0, 0x02, 0xFE, 0x3F, 0xC0, 0x07, 0xFD,
+    0x3F, 0xD0, 0x6F, 0xF8, 0x3F, 0xFF, 0xFF, 0x90, 0x2F, 0xFF, 0xF9, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // D
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFD, 0x00, 0x00,
+    0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
+    0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8,
+    0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
+    0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
+    0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // E
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFE, 0x03, 0xFD, 0x00, 0x00,
+    0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
+    0x03, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE,
+    0x03, 0xFF, 0xFF, 0xFE, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
+    0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
+    0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // F
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1B, 0xFF, 0xF9, 0x01, 0xBF, 0xFF, 0xFE, 0x06, 0xFF, 0x90, 0x6E,
+    0x1B, 0xF9, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
+    0x7F, 0xD0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
+    0xFF, 0xC0, 0x2F, 0xFE, 0xBF, 0xC0, 0x2F, 0xFF, 0x7F, 0xD0, 0x01, 0xFF,
+    0x3F, 0xE0, 0x00, 0xFF, 0x2F, 0xF4, 0x00, 0xFF, 0x1B, 0xF9, 0x00, 0xFF,
+    0x06, 0xFF, 0x91, 0xFF, 0x01, 0xBF, 0xFF, 0xFE, 0x00, 0x1B, 0xFF, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // G
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2F, 0xE0, 0x02, 0xFE, 0x3F, 0xF0, 0x03, 0xFF, 0x3F, 0xF0, 0x03, 0xFF,
+    0x3F, 0xF0, 0x03, 0xFF, 0x3F, 0xF0, 0x03, 0xFF, 0x3F, 0xF0, 0x03, 0xFF,
+    0x3F, 0xF0, 0x03, 0xFF, 0x3F, 0xF4, 0x07, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xF4, 0x07, 0xFF, 0x3F, 0xF0, 0x03, 0xFF,
+    0x3F, 0xF0, 0x03, 0xFF, 0x3F, 0xF0, 0x03, 0xFF, 0x3F, 0xF0, 0x03, 0xFF,
+    0x3F, 0xF0, 0x03, 0xFF, 0x3F, 0xF0, 0x03, 0xFF, 0x2F, 0xE0, 0x02, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // H
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFD, 0x00,
+    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
+    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
+    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
+    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
+    0x00, 0x1F, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // I
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF0,
+    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
+    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
+    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
+    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0,
+    0x0B, 0x91, 0xBF, 0x80, 0x0F, 0xFF, 0xFE, 0x40, 0x0B, 0xFF, 0xE4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // J
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xE0, 0x02, 0xFF, 0x0F, 0xF0, 0x07, 0xF9, 0x0F, 0xF0, 0x1B, 0xE4,
+    0x0F, 0xF0, 0x6F, 0x90, 0x0F, 0xF1, 0xBE, 0x40, 0x0F, 0xF2, 0xFD, 0x00,
+    0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xE4, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
+    0x0F, 0xFF, 0xE4, 0x00, 0x0F, 0xFF, 0xF9, 0x00, 0x0F, 0xF2, 0xFE, 0x00,
+    0x0F, 0xF1, 0xBF, 0x40, 0x0F, 0xF0, 0x7F, 0x90, 0x0F, 0xF0, 0x2F, 0xE4,
+    0x0F, 0xF0, 0x1B, 0xF9, 0x0F, 0xF0, 0x06, 0xFE, 0x0B, 0xE0, 0x01, 0xBE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // K
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
+    0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
+    0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
+    0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
+    0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
+    0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // L
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBF, 0x90, 0x02, 0xFE, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF4, 0x07, 0xFF,
+    0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF,
+    0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0xFF, 0xFF, 0x3F, 0x3F,
+    0xFF, 0x3F, 0xFE, 0x3F, 0xFF, 0x2F, 0xFD, 0x3F, 0xFF, 0x1F, 0xFC, 0x3F,
+    0xFF, 0x0F, 0xF8, 0x3F, 0xFF, 0x0B, 0xE4, 0x3F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F, 0xBE, 0x00, 0x00, 0x2E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // M
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2F, 0xE0, 0x00, 0xBE, 0x3F, 0xF4, 0x00, 0xFF, 0x3F, 0xF9, 0x00, 0xFF,
+    0x3F, 0xFE, 0x00, 0xFF, 0x3F, 0xFF, 0x40, 0xFF, 0x3F, 0xFF, 0x80, 0xFF,
+    0x3F, 0xFF, 0xD0, 0xFF, 0x3F, 0xFF, 0xE4, 0xFF, 0x3F, 0xCB, 0xF8, 0xFF,
+    0x3F, 0xC7, 0xFC, 0xFF, 0x3F, 0xC2, 0xFF, 0xFF, 0x3F, 0xC1, 0xFF, 0xFF,
+    0x3F, 0xC0, 0xBF, 0xFF, 0x3F, 0xC0, 0x6F, 0xFF, 0x3F, 0xC0, 0x1F, 0xFF,
+    0x3F, 0xC0, 0x0B, 0xFF, 0x3F, 0xC0, 0x07, 0xFF, 0x2F, 0x80, 0x02, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // N
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x6F, 0xFE, 0x40, 0x06, 0xFF, 0xFF, 0xE4, 0x1B, 0xF9, 0x1B, 0xF9,
+    0x2F, 0xE4, 0x06, 0xFE, 0x3F, 0xD0, 0x01, 0xFF, 0x7F, 0xC0, 0x00, 0xFF,
+    0xBF, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xBF, 0xC0, 0x00, 0xFF,
+    0x7F, 0xC0, 0x00, 0xFF, 0x3F, 0xD0, 0x01, 0xFF, 0x2F, 0xE4, 0x06, 0xFE,
+    0x1B, 0xF9, 0x1B, 0xF9, 0x06, 0xFF, 0xFF, 0xE4, 0x00, 0x6F, 0xFE, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // O
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0xFF, 0xE4, 0x0F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFD, 0x06, 0xFF,
+    0x0F, 0xFC, 0x01, 0xFF, 0x0F, 0xFC, 0x00, 0xFF, 0x0F, 0xFC, 0x00, 0xFF,
+    0x0F, 0xFC, 0x01, 0xFF, 0x0F, 0xFC, 0x06, 0xFF, 0x0F, 0xFD, 0x1B, 0xFE,
+    0x0F, 0xFF, 0xFF, 0xE4, 0x0F, 0xFF, 0xFE, 0x40, 0x0F, 0xFD, 0x00, 0x00,
+    0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
+    0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // P
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x6F, 0xFE, 0x40, 0x06, 0xFF, 0xFF, 0xE4, 0x1B, 0xF9, 0x1B, 0xF9,
+    0x2F, 0xE4, 0x06, 0xFE, 0x3F, 0xD0, 0x01, 0xFF, 0x7F, 0xC0, 0x00, 0xFF,
+    0xBF, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xBF, 0xC0, 0x00, 0xFF,
+    0x7F, 0xC0, 0x00, 0xFF, 0x3F, 0xD0, 0x01, 0xFF, 0x2F, 0xE4, 0x06, 0xFE,
+    0x1B, 0xF9, 0x1B, 0xF9, 0x06, 0xFF, 0xFF, 0xE4, 0x00, 0x6F, 0xFF, 0xC0,
+    0x00, 0x00, 0x6F, 0xE4, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x01, 0xBF,
+    0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, // Q
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0xFE, 0x40, 0x0F, 0xFF, 0xFF, 0xE4, 0x0F, 0xF4, 0x6F, 0xF8,
+    0x0F, 0xF0, 0x1B, 0xFC, 0x0F, 0xF0, 0x07, 0xFC, 0x0F, 0xF0, 0x07, 0xFC,
+    0x0F, 0xF0, 0x0B, 0xF8, 0x0F, 0xF0, 0x1F, 0xF4, 0x0F, 0xF5, 0xBF, 0xE0,
+    0x0F, 0xFF, 0xFE, 0x40, 0x0F, 0xFF, 0xFC, 0x00, 0x0F, 0xF2, 0xFE, 0x40,
+    0x0F, 0xF1, 0xBF, 0x90, 0x0F, 0xF0, 0x6F, 0xE4, 0x0F, 0xF0, 0x1B, 0xF8,
+    0x0F, 0xF0, 0x07, 0xFD, 0x0F, 0xF0, 0x02, 0xFE, 0x0B, 0xE0, 0x01, 0xBE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // R
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x6F, 0xFF, 0xE4, 0x06, 0xFF, 0xFF, 0xF8, 0x0B, 0xF9, 0x01, 0xB8,
+    0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
+    0x0B, 0xF9, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x01, 0xBF, 0xFF, 0x90,
+    0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x06, 0xFF,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x0D, 0x00, 0x06, 0xFE,
+    0x0F, 0xE4, 0x1B, 0xF9, 0x0B, 0xFF, 0xFF, 0xE4, 0x06, 0xFF, 0xFE, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // S
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFD, 0x00,
+    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
+    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
+    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
+    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
+    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // T
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2F, 0xE0, 0x00, 0xBE, 0x3F, 0xF0, 0x00, 0xFF, 0x3F, 0xF0, 0x00, 0xFF,
+    0x3F, 0xF0, 0x00, 0xFF, 0x3F, 0xF0, 0x00, 0xFF, 0x3F, 0xF0, 0x00, 0xFF,
+    0x3F, 0xF0, 0x00, 0xFF, 0x3F, 0xF0, 0x00, 0xFF, 0x3F, 0xF0, 0x00, 0xFF,
+    0x3F, 0xF0, 0x00, 0xFF, 0x3F, 0xF0, 0x00, 0xFF, 0x3F, 0xF0, 0x00, 0xFF,
+    0x2F, 0xF0, 0x01, 0xFE, 0x1F, 0xF0, 0x02, 0xFD, 0x0F, 0xF4, 0x07, 0xFC,
+    0x0B, 0xF9, 0x1B, 0xF8, 0x06, 0xFF, 0xFF, 0xE4, 0x00, 0x6F, 0xFE, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBE, 0x00, 0x00, 0x2E, 0xFF, 0x40, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x7F,
+    0x7F, 0xD0, 0x00, 0xBF, 0x2F, 0xE0, 0x01, 0xFE, 0x1F, 0xF0, 0x02, 0xFD,
+    0x0F, 0xF4, 0x03, 0xFC, 0x0B, 0xF8, 0x07, 0xF8, 0x07, 0xFD, 0x0B, 0xF4,
+    0x03, 0xFE, 0x1F, 0xE0, 0x02, 0xFF, 0x2F, 0xD0, 0x01, 0xFF, 0x3F, 0xC0,
+    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0x00,
+    0x00, 0x2F, 0xFE, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x0B, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // V
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xB9, 0x00, 0x00, 0x0A, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x1F,
+    0xFF, 0x00, 0x00, 0x2F, 0xFF, 0x0B, 0xF8, 0x3F, 0xFF, 0x0F, 0xFC, 0x3F,
+    0xBF, 0x0F, 0xFC, 0x3F, 0x7F, 0x4F, 0xFD, 0x3F, 0x3F, 0x8F, 0xFE, 0x3F,
+    0x3F, 0xFF, 0xFF, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0x3F, 0xFF,
+    0x3F, 0xFF, 0x3F, 0xFE, 0x2F, 0xFF, 0x3F, 0xFD, 0x1F, 0xFE, 0x2F, 0xFC,
+    0x0F, 0xFD, 0x1F, 0xFC, 0x0F, 0xFC, 0x0F, 0xFC, 0x0B, 0xF8, 0x0B, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // W
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x90, 0x00, 0x6E, 0x6F, 0xE4, 0x01, 0xBE, 0x1F, 0xF8, 0x06, 0xFD,
+    0x0B, 0xFD, 0x0B, 0xF8, 0x06, 0xFE, 0x5F, 0xE4, 0x01, 0xBF, 0xFF, 0x90,
+    0x00, 0x7F, 0xFE, 0x40, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x1F, 0xFC, 0x00,
+    0x00, 0x1F, 0xFD, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x90,
+    0x01, 0xFE, 0x3F, 0xE0, 0x06, 0xF9, 0x2F, 0xF4, 0x1B, 0xE4, 0x1B, 0xF9,
+    0x2F, 0xD0, 0x06, 0xFE, 0x7F, 0x80, 0x01, 0xFF, 0xFE, 0x40, 0x00, 0xBE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // X
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x80, 0x00, 0x2E, 0x7F, 0xD0, 0x00, 0x7F, 0x2F, 0xE0, 0x01, 0xBE,
+    0x1F, 0xF4, 0x02, 0xFD, 0x0B, 0xF9, 0x07, 0xF8, 0x06, 0xFE, 0x1B, 0xE4,
+    0x01, 0xFF, 0x2F, 0xD0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x6F, 0xFE, 0x40,
+    0x00, 0x1F, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
+    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
+    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // Y
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2F, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x6F, 0xE4,
+    0x00, 0x00, 0xBF, 0x90, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x06, 0xFD, 0x00,
+    0x00, 0x1B, 0xF8, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x00, 0xBF, 0x90, 0x00,
+    0x01, 0xFE, 0x40, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00,
+    0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // Z
+    0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
+    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
+    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
+    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
+    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
+    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
+    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
+    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFE,
+    0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, // [
+    0x2F, 0x80, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
+    0x0B, 0xF4, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
+    0x01, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0x80, 0x00,
+    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0x00,
+    0x00, 0x07, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x01, 0xFE, 0x00,
+    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x2F, 0xD0,
+    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x07, 0xF8,
+    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x00, /* \ */
+    0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0x00,
+    0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, // ]
+    0x00, 0x01, 0xA0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x00,
+    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x2F, 0xFE, 0x00,
+    0x00, 0x3F, 0xFF, 0x40, 0x00, 0x7F, 0x3F, 0x80, 0x00, 0xBF, 0x2F, 0xC0,
+    0x01, 0xFE, 0x1F, 0xD0, 0x02, 0xFD, 0x0F, 0xE0, 0x07, 0xF8, 0x0B, 0xF4,
+    0x0B, 0xF4, 0x07, 0xF8, 0x0F, 0xE0, 0x02, 0xFD, 0x1F, 0xD0, 0x01, 0xFE,
+    0x2F, 0xC0, 0x00, 0xBF, 0x2F, 0x80, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ^
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // _
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // `
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xBF, 0xFF, 0x90, 0x0B, 0xFF, 0xFF, 0xE0, 0x0B, 0xE4, 0x6F, 0xF4,
+    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xFC,
+    0x00, 0x6F, 0xFF, 0xFC, 0x06, 0xFF, 0xFF, 0xFC, 0x1B, 0xF9, 0x1F, 0xFC,
+    0x2F, 0xE4, 0x0F, 0xFC, 0x3F, 0xC0, 0x0F, 0xFC, 0x3F, 0xE0, 0x1F, 0xFC,
+    0x2F, 0xF4, 0x6F, 0xFD, 0x1B, 0xFF, 0xFF, 0xFE, 0x06, 0xFF, 0xE5, 0xBE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // a
+    0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x0F, 0xF2, 0xFF, 0x90, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFE, 0x5B, 0xFD,
+    0x0F, 0xF9, 0x06, 0xFE, 0x0F, 0xF4, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0xFF,
+    0x0F, 0xF0, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0xFF,
+    0x0F, 0xF0, 0x01, 0xFF, 0x0F, 0xF0, 0x02, 0xFE, 0x0F, 0xF4, 0x07, 0xFD,
+    0x0F, 0xFE, 0x5B, 0xF8, 0x0F, 0xFF, 0xFF, 0xE4, 0x0B, 0x8B, 0xFE, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // b
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1B, 0xFF, 0xF9, 0x01, 0xBF, 0xFF, 0xFE, 0x06, 0xFF, 0x90, 0x6E,
+    0x0B, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
+    0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
+    0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
+    0x06, 0xFF, 0x90, 0x6E, 0x01, 0xBF, 0xFF, 0xFE, 0x00, 0x1B, 0xFF, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // c
+    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF,
+    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFF,
+    0x00, 0x6F, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xFF, 0x0B, 0xF9, 0x1B, 0xFF,
+    0x1F, 0xF4, 0x07, 0xFF, 0x2F, 0xF0, 0x03, 0xFF, 0x3F, 0xF0, 0x03, 0xFF,
+    0x3F, 0xE0, 0x03, 0xFF, 0x3F, 0xD0, 0x03, 0xFF, 0x3F, 0xD0, 0x03, 0xFF,
+    0x3F, 0xE0, 0x03, 0xFF, 0x2F, 0xF0, 0x07, 0xFF, 0x1F, 0xF4, 0x1B, 0xFF,
+    0x0B, 0xF9, 0x6F, 0xFF, 0x06, 0xFF, 0xFF, 0xFF, 0x01, 0xBF, 0xE2, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // d
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1B, 0xFF, 0x90, 0x01, 0xBF, 0xFF, 0xE4, 0x06, 0xFE, 0x5B, 0xF8,
+    0x0B, 0xF9, 0x07, 0xFD, 0x1F, 0xF4, 0x03, 0xFE, 0x2F, 0xF4, 0x07, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xF4, 0x00, 0x00,
+    0x2F, 0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00,
+    0x06, 0xFE, 0x40, 0x6E, 0x01, 0xBF, 0xFF, 0xFE, 0x00, 0x1B, 0xFF, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // e
+    0x00, 0x06, 0xFF, 0xFE, 0x00, 0x0B, 0xF9, 0x07, 0x00, 0x1F, 0xF4, 0x00,
+    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF4, 0x00,
+    0x2F, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xF4, 0x00,
+    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
+    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
+    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
+    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // f
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x6F, 0xF8, 0xBE, 0x06, 0xFF, 0xFF, 0xFF, 0x0B, 0xF9, 0x6F, 0xFF,
+    0x1F, 0xF4, 0x07, 0xFF, 0x2F, 0xF0, 0x03, 0xFF, 0x3F, 0xE0, 0x03, 0xFF,
+    0x3F, 0xD0, 0x03, 0xFF, 0x3F, 0xC0, 0x03, 0xFF, 0x3F, 0xD0, 0x03, 0xFF,
+    0x3F, 0xE0, 0x03, 0xFF, 0x2F, 0xF0, 0x07, 0xFF, 0x1F, 0xF4, 0x1B, 0xFF,
+    0x0B, 0xF9, 0x6F, 0xFF, 0x06, 0xFF, 0xFF, 0xFF, 0x01, 0xBF, 0xE3, 0xFE,
+    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF8,
+    0x0B, 0x90, 0x6F, 0xE4, 0x0B, 0xFF, 0xFF, 0x90, // g
+    0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x0F, 0xF2, 0xFF, 0xE4, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0x97, 0xFD,
+    0x0F, 0xFE, 0x43, 0xFE, 0x0F, 0xF9, 0x03, 0xFF, 0x0F, 0xF4, 0x03, 0xFF,
+    0x0F, 0xF0, 0x03, 0xFF, 0x0F, 0xF0, 0x03, 0xFF, 0x0F, 0xF0, 0x03, 0xFF,
+    0x0F, 0xF0, 0x03, 0xFF, 0x0F, 0xF0, 0x03, 0xFF, 0x0F, 0xF0, 0x03, 0xFF,
+    0x0F, 0xF0, 0x03, 0xFF, 0x0F, 0xF0, 0x03, 0xFF, 0x0B, 0xE0, 0x02, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // h
+    0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2F, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00,
+    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00,
+    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00,
+    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00,
+    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // i
+    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC0,
+    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0,
+    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0,
+    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0,
+    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0,
+    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x40,
+    0x2E, 0x46, 0xFE, 0x00, 0x2F, 0xFF, 0xF9, 0x00, // j
+    0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x0F, 0xF0, 0x06, 0xFF, 0x0F, 0xF0, 0x1B, 0xF9, 0x0F, 0xF0, 0x6F, 0xE4,
+    0x0F, 0xF1, 0xBF, 0x90, 0x0F, 0xF2, 0xFE, 0x40, 0x0F, 0xF3, 0xF9, 0x00,
+    0x0F, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF9, 0x00,
+    0x0F, 0xF2, 0xFE, 0x40, 0x0F, 0xF1, 0xBF, 0x90, 0x0F, 0xF0, 0x6F, 0xE4,
+    0x0F, 0xF0, 0x1B, 0xF9, 0x0F, 0xF0, 0x07, 0xFE, 0x0B, 0xE0, 0x02, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // k
+    0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00,
+    0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00,
+    0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00,
+    0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00,
+    0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00,
+    0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00,
+    0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // l
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBE, 0x2F, 0x96, 0xF9, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFD, 0x7F, 0xFF, 0x87, 0xF8, 0x3F,
+    0xFF, 0x43, 0xF4, 0x3F, 0xFF, 0x03, 0xF0, 0x3F, 0xFF, 0x03, 0xF0, 0x3F,
+    0xFF, 0x03, 0xF0, 0x3F, 0xFF, 0x03, 0xF0, 0x3F, 0xFF, 0x03, 0xF0, 0x3F,
+    0xFF, 0x03, 0xF0, 0x3F, 0xFF, 0x03, 0xF0, 0x3F, 0xBE, 0x02, 0xE0, 0x2E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // m
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xE2, 0xFF, 0xE4, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0x97, 0xFD,
+    0x0F, 0xFE, 0x43, 0xFE, 0x0F, 0xF9, 0x03, 0xFF, 0x0F, 0xF4, 0x03, 0xFF,
+    0x0F, 0xF0, 0x03, 0xFF, 0x0F, 0xF0, 0x03, 0xFF, 0x0F, 0xF0, 0x03, 0xFF,
+    0x0F, 0xF0, 0x03, 0xFF, 0x0F, 0xF0, 0x03, 0xFF, 0x0F, 0xF0, 0x03, 0xFF,
+    0x0F, 0xF0, 0x03, 0xFF, 0x0F, 0xF0, 0x03, 0xFF, 0x0B, 0xE0, 0x02, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // n
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x6F, 0xFE, 0x40, 0x06, 0xFF, 0xFF, 0xE4, 0x0B, 0xF9, 0x1B, 0xF9,
+    0x1F, 0xF4, 0x07, 0xFE, 0x2F, 0xE0, 0x02, 0xFF, 0x3F, 0xD0, 0x01, 0xFF,
+    0x3F, 0xC0, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0xFF,
+    0x3F, 0xD0, 0x01, 0xFF, 0x2F, 0xE0, 0x02, 0xFF, 0x1F, 0xF4, 0x07, 0xFE,
+    0x0B, 0xF9, 0x1B, 0xF9, 0x06, 0xFF, 0xFF, 0xE4, 0x00, 0x6F, 0xFE, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // o
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xE2, 0xFF, 0x90, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFE, 0x5B, 0xFD,
+    0x0F, 0xF9, 0x06, 0xFE, 0x0F, 0xF4, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0xFF,
+    0x0F, 0xF0, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0xFF,
+    0x0F, 0xF0, 0x01, 0xFF, 0x0F, 0xF4, 0x02, 0xFE, 0x0F, 0xF9, 0x07, 0xFD,
+    0x0F, 0xFE, 0x5B, 0xF8, 0x0F, 0xFF, 0xFF, 0xE4, 0x0F, 0xFF, 0xFF, 0x90,
+    0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, // p
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x6F, 0xF8, 0xB8, 0x06, 0xFF, 0xFF, 0xFC, 0x0B, 0xF9, 0x6F, 0xFC,
+    0x1F, 0xF4, 0x07, 0xFC, 0x2F, 0xE0, 0x03, 0xFC, 0x3F, 0xD0, 0x03, 0xFC,
+    0x3F, 0xC0, 0x03, 0xFC, 0x3F, 0xC0, 0x03, 0xFC, 0x3F, 0xC0, 0x03, 0xFC,
+    0x3F, 0xD0, 0x03, 0xFC, 0x3F, 0xE0, 0x07, 0xFC, 0x2F, 0xF4, 0x1B, 0xFC,
+    0x1B, 0xF9, 0x6F, 0xFC, 0x06, 0xFF, 0xFF, 0xFC, 0x01, 0xBF, 0xE3, 0xFC,
+    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC,
+    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xF8, // q
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xFE, 0x2F, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xF9, 0x7F,
+    0x03, 0xFF, 0xE4, 0x3F, 0x03, 0xFF, 0x90, 0x2E, 0x03, 0xFF, 0x40, 0x00,
+    0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
+    0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
+    0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // r
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x6F, 0xFF, 0xE4, 0x02, 0xFF, 0xFF, 0xF8, 0x07, 0xFD, 0x01, 0xB8,
+    0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00,
+    0x06, 0xFF, 0xF9, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x01, 0xBF, 0xF8,
+    0x00, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC,
+    0x0B, 0xE4, 0x1B, 0xF8, 0x0B, 0xFF, 0xFF, 0xE4, 0x06, 0xFF, 0xFE, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // s
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x00,
+    0x2F, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xD0, 0x00,
+    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
+    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
+    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00,
+    0x00, 0x2F, 0xE4, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x06, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // t
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xE0, 0x02, 0xF8, 0x0F, 0xF0, 0x03, 0xFC, 0x0F, 0xF0, 0x03, 0xFC,
+    0x0F, 0xF0, 0x03, 0xFC, 0x0F, 0xF0, 0x03, 0xFC, 0x0F, 0xF0, 0x03, 0xFC,
+    0x0F, 0xF0, 0x03, 0xFC, 0x0F, 0xF0, 0x03, 0xFC, 0x0F, 0xF0, 0x03, 0xFC,
+    0x0F, 0xF0, 0x07, 0xFC, 0x0F, 0xF0, 0x1B, 0xFC, 0x0F, 0xF4, 0x6F, 0xFC,
+    0x0B, 0xF8, 0xBF, 0xFC, 0x06, 0xFF, 0xFF, 0xFC, 0x01, 0xBF, 0xE2, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // u
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x40, 0x00, 0x6E, 0x7F, 0x80, 0x00, 0xBF, 0x2F, 0xD0, 0x01, 0xFE,
+    0x1F, 0xE0, 0x02, 0xFD, 0x0F, 0xF4, 0x03, 0xFC, 0x0B, 0xF8, 0x07, 0xF8,
+    0x07, 0xFC, 0x0B, 0xF4, 0x02, 0xFD, 0x1F, 0xE0, 0x01, 0xFE, 0x2F, 0xD0,
+    0x00, 0xFF, 0x3F, 0x80, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0x00,
+    0x00, 0x2F, 0xFE, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x0B, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // v
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBE, 0x00, 0x00, 0x0A, 0xFF, 0x06, 0xF8, 0x0F, 0xFF, 0x0B, 0xFC, 0x1F,
+    0xFF, 0x0F, 0xFD, 0x2F, 0xFF, 0x0F, 0xFE, 0x3F, 0xBF, 0x5F, 0xFF, 0x3F,
+    0x7F, 0xFF, 0xFF, 0x3F, 0x3F, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0x3F, 0xFF,
+    0x3F, 0xFF, 0x3F, 0xFF, 0x2F, 0xFE, 0x2F, 0xFE, 0x1F, 0xFD, 0x1F, 0xFD,
+    0x0F, 0xFC, 0x0F, 0xFC, 0x0F, 0xFC, 0x0F, 0xFC, 0x0B, 0xF8, 0x0B, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // w
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xE4, 0x01, 0xBF, 0x1F, 0xF8, 0x06, 0xF9, 0x0B, 0xFD, 0x0B, 0xF4,
+    0x06, 0xFE, 0x5F, 0xE0, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x7F, 0xFF, 0x40,
+    0x00, 0x2F, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xFE, 0x40,
+    0x00, 0x7F, 0xFF, 0x80, 0x01, 0xBF, 0xFF, 0xD0, 0x06, 0xFD, 0x6F, 0xE4,
+    0x0B, 0xF8, 0x1B, 0xF9, 0x1F, 0xE4, 0x07, 0xFE, 0x3F, 0x90, 0x02, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // x
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x80, 0x00, 0x6E, 0x7F, 0xD0, 0x00, 0xBF, 0x2F, 0xE0, 0x01, 0xFE,
+    0x1F, 0xF0, 0x02, 0xFD, 0x0B, 0xF4, 0x07, 0xF8, 0x07, 0xF8, 0x0B, 0xF4,
+    0x03, 0xFD, 0x0F, 0xF0, 0x02, 0xFE, 0x1F, 0xE0, 0x01, 0xFF, 0x2F, 0xD0,
+    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x2F, 0xFE, 0x00,
+    0x00, 0x1F, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00,
+    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x6F, 0xD0, 0x00,
+    0x01, 0xBF, 0x80, 0x00, 0x3F, 0xFE, 0x40, 0x00, // y
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFE,
+    0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x01, 0xBF, 0x90,
+    0x00, 0x06, 0xFE, 0x40, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x6F, 0xE4, 0x00,
+    0x01, 0xBF, 0x90, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x07, 0xF9, 0x00, 0x00,
+    0x1B, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // z
+    0x00, 0x06, 0xFF, 0xFC, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x0F, 0xF4, 0x00,
+    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00,
+    0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00,
+    0x00, 0x07, 0xF4, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x0B, 0xFF, 0xD0, 0x00,
+    0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x00, 0x07, 0xF4, 0x00,
+    0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00,
+    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x06, 0xFF, 0xF8,
+    0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, // {
+    0x00, 0x02, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
+    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
+    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
+    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
+    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
+    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
+    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
+    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
+    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // |
+    0x0F, 0xFF, 0xE4, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00,
+    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00,
+    0x00, 0x07, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
+    0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x01, 0xFF, 0xF8,
+    0x00, 0x01, 0xFF, 0xF8, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x07, 0xF4, 0x00,
+    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x00,
+    0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00,
+    0x00, 0x07, 0xFC, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x0B, 0xFF, 0xE4, 0x00,
+    0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, // }
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x2E,
+    0x2F, 0xFF, 0xE4, 0x3F, 0x7F, 0x5B, 0xF9, 0x7F, 0xBF, 0x06, 0xFF, 0xFE,
+    0xBE, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ~
+    0x00, 0x00
+};
+
+static const uint16_t FontOffset_16x26A2[] = {
+    0, 104, 208, 312, 416, 520, 624, 728, 832, 936, 1040, 1144,
+    1248, 1352, 1456, 1560, 1664, 1768, 1872, 1976, 2080, 2184, 2288, 2392,
+    2496, 2600, 2704, 2808, 2912, 3016, 3120, 3224, 3328, 3432, 3536, 3640,
+    3744, 3848, 3952, 4056, 4160, 4264, 4368, 4472, 4576, 4680, 4784, 4888,
+    4992, 5096, 5200, 5304, 5408, 5512, 5616, 5720, 5824, 5928, 6032, 6136,
+    6240, 6344, 6448, 6552, 6656, 6760, 6864, 6968, 7072, 7176, 7280, 7384,
+    7488, 7592, 7696, 7800, 7904, 8008, 8112, 8216, 8320, 8424, 8528, 8632,
+    8736, 8840, 8944, 9048, 9152, 9256, 9360, 9464, 9568, 9672, 9776,
+};
+
+static const uint8_t FontBitmap_16x26A4[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // sp
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // !
+    0x00, 0x0A, 0xFF, 0xA0, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x0A, 0xFF, 0xA0, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // "
+    0x00, 0x00, 0x00, 0x3B, 0xFA, 0x00, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0xBF,
+    0xFF, 0x04, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x0B, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0xFF, 0xF4, 0x0F, 0xFF, 0xB0, 0x00, 0x00, 0x04, 0xFF,
+    0xF0, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x4C, 0xFF, 0xF5, 0x5F, 0xFF, 0x50,
+    0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x0D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x2F, 0xFF, 0x55, 0xFF, 0xF5, 0x00,
+    0x00, 0x00, 0xAF, 0xFF, 0x04, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFA, 0x0F, 0xFF, 0xF0, 0x00,
+    0x00, 0x05, 0xFF, 0xF2, 0x5F, 0xFF, 0xF5, 0x00, 0xAF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA,
+    0x00, 0x5F, 0xFF, 0xB2, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x0F, 0xFF, 0x40,
+    0xFF, 0xFB, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x00, 0xFF, 0xF4, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0x04, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x0B,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0xAF, 0xB3, 0x0A, 0xFF, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // #
+    0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x03, 0xBF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF2, 0xAF, 0xA0,
+    0x00, 0x0F, 0xFF, 0xF2, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xF2, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xCF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xCF,
+    0xFF, 0xFC, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFB, 0x30,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0,
+    0x00, 0xAF, 0xFA, 0x2F, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0xAF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0xFC, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // $
+    0x04, 0xBF, 0xFF, 0xB3, 0x00, 0x00, 0x03, 0xBA, 0xAF, 0xFB, 0x2F, 0xFC,
+    0x30, 0x00, 0x3C, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xB0, 0x00, 0xBF, 0xFB,
+    0xFF, 0xF0, 0x0B, 0xFF, 0xF0, 0x04, 0xFF, 0xF4, 0xFF, 0xF0, 0x04, 0xFF,
+    0xF0, 0x3C, 0xFF, 0xB0, 0xFF, 0xF0, 0x04, 0xFF, 0xF0, 0xBF, 0xFC, 0x30,
+    0xFF, 0xF0, 0x0B, 0xFF, 0xF2, 0xFF, 0xF4, 0x00, 0xFF, 0xF4, 0x0F, 0xFF,
+    0xFF, 0xFF, 0xB0, 0x00, 0xAF, 0xFB, 0x2F, 0xFF, 0xFF, 0xFC, 0x30, 0x00,
+    0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
+    0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0xFF, 0xFF, 0xFA,
+    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x4F, 0xFF,
+    0xFF, 0xFF, 0x55, 0xFF, 0x00, 0x03, 0xCF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
+    0x00, 0x3C, 0xFF, 0xB2, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xBF, 0xFC, 0x30,
+    0xFF, 0xFF, 0x00, 0xFF, 0x04, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+    0x3C, 0xFF, 0xB0, 0x00, 0xBF, 0xFF, 0x55, 0xFF, 0xBF, 0xFC, 0x30, 0x00,
+    0x3C, 0xFF, 0xFF, 0xFF, 0xAF, 0xB3, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // %
+    0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+    0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x2F, 0xFF, 0xF0, 0x00,
+    0x00, 0x0B, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0x2F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x30, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00,
+    0x00, 0x4C, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xFF,
+    0xFA, 0x00, 0x00, 0xAA, 0xBF, 0xFF, 0xB2, 0xFF, 0xFF, 0x40, 0x04, 0xFF,
+    0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xC3, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x3C,
+    0xFF, 0xFB, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x04, 0xFF, 0xFF, 0x2F, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
+    0x3B, 0xFF, 0xFF, 0xFA, 0xBF, 0xFF, 0xC3, 0x00, 0x02, 0xFF, 0xFF, 0xF2,
+    0x3C, 0xFF, 0xFC, 0x40, 0x4B, 0xFF, 0xFF, 0xFA, 0x03, 0xCF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0xA2, 0xAF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // &
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3B, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // '
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
+    0x4C, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFC, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x03, 0xCF,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xCF,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xC3, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFC, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4C, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // (
+    0x0D, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFC,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xCF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x03, 0xCF, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x4C, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFC,
+    0x40, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // )
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xB4, 0x5F, 0xFF, 0x54, 0xBF, 0xB3, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0xAF, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0xFA,
+    0x00, 0x00, 0x05, 0xFF, 0x02, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0x2A, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xFF, 0xB0, 0x00,
+    0x00, 0x04, 0xCF, 0xFF, 0x2B, 0xFF, 0xF5, 0x00, 0x00, 0x0D, 0xFF, 0xFB,
+    0x04, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x4B, 0xB3, 0x00, 0xAF, 0xB4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // *
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5F, 0xFF, 0x50, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x5F, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // +
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5F, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF,
+    0xB3, 0x00, 0x00, 0x00, // ,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0,
+    0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // -
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // .
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // /
+    0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x03, 0xCF, 0xFF,
+    0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x3C, 0xFF, 0xFB, 0x2B, 0xFF, 0xFC, 0x30,
+    0x00, 0xBF, 0xFF, 0xC3, 0x03, 0xCF, 0xFF, 0xB0, 0x04, 0xFF, 0xFF, 0x40,
+    0x00, 0x4F, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFB,
+    0x0F, 0xFF, 0xFB, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x0F, 0xFF, 0xF4, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xF4, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0x0F, 0xFF, 0xFB, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+    0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0x04, 0xFF, 0xFF, 0x40,
+    0x00, 0x4F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xC3, 0x03, 0xCF, 0xFF, 0xB0,
+    0x00, 0x3C, 0xFF, 0xFB, 0x2B, 0xFF, 0xFC, 0x30, 0x00, 0x03, 0xCF, 0xFF,
+    0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xFB, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // 0
+    0x00, 0x00, 0x00, 0x04, 0xBF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0xAF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // 1
+    0x00, 0x04, 0xBF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xB3, 0x00, 0x00, 0xAF, 0xFB, 0x40, 0x4C, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xCF, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFC, 0x30, 0x00,
+    0x00, 0x00, 0x03, 0xCF, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+    0xFC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xC3, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xCF, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // 2
+    0x00, 0x03, 0xBF, 0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x0A, 0xFB, 0x40, 0x4C, 0xFF, 0xFC, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xB3, 0x00,
+    0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xAF, 0xFF,
+    0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0xFC, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xCF, 0xFF, 0xB0,
+    0x00, 0x0A, 0xFB, 0x40, 0x4C, 0xFF, 0xFC, 0x30, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // 3
+    0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xCF,
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xCF, 0xFB,
+    0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x0F, 0xFF, 0xF0, 0x00,
+    0x00, 0x4F, 0xFF, 0xB0, 0x0F, 0xFF, 0xF0, 0x00, 0x03, 0xCF, 0xFC, 0x30,
+    0x0F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
+    0x4F, 0xFF, 0xF5, 0x00, 0x5F, 0xFF, 0xF5, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // 4
+    0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00,
+    0x00, 0x0F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00,
+    0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xCF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40,
+    0x00, 0x0A, 0xFB, 0x40, 0x4C, 0xFF, 0xFB, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // 5
+    0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x3B, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x03, 0xCF, 0xFF, 0xC4, 0x04, 0xBF, 0xA0,
+    0x00, 0x0B, 0xFF, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0xB3, 0x00,
+    0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x30, 0x0B, 0xFF, 0xFF, 0xFC,
+    0x44, 0xCF, 0xFF, 0xC3, 0x0B, 0xFF, 0xFF, 0xC3, 0x00, 0x3C, 0xFF, 0xFB,
+    0x04, 0xFF, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xB0,
+    0x00, 0x04, 0xFF, 0xFF, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x3C, 0xFF, 0xFB,
+    0x00, 0x0B, 0xFF, 0xFC, 0x44, 0xCF, 0xFF, 0xC3, 0x00, 0x03, 0xBF, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFB, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // 6
+    0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xB0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3C, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // 7
+    0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x03, 0xCF, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x30, 0x00, 0x0B, 0xFF, 0xFC, 0x44, 0xCF, 0xFF, 0xB0,
+    0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xF0,
+    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xF0,
+    0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x0B, 0xFF, 0xFC,
+    0x44, 0xCF, 0xFC, 0x30, 0x00, 0x03, 0xBF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00,
+    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x03, 0xBF, 0xFF,
+    0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x3C, 0xFF, 0xF2, 0xAF, 0xFF, 0xFC, 0x30,
+    0x00, 0xBF, 0xFF, 0xB0, 0x04, 0xCF, 0xFF, 0xC3, 0x04, 0xFF, 0xFF, 0x40,
+    0x00, 0x4F, 0xFF, 0xFB, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0x50, 0x00, 0x3C, 0xFF, 0xFB,
+    0x00, 0xBF, 0xFF, 0xFB, 0x44, 0xCF, 0xFF, 0xC3, 0x00, 0x3B, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFB, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // 8
+    0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x03, 0xCF, 0xFF,
+    0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x3C, 0xFF, 0xC4, 0x4C, 0xFF, 0xFC, 0x30,
+    0x00, 0xBF, 0xFF, 0x40, 0x03, 0xCF, 0xFF, 0xB0, 0x04, 0xFF, 0xFF, 0x00,
+    0x00, 0x4F, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFB,
+    0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0x04, 0xFF, 0xFF, 0x40, 0x00, 0x4F, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xC4,
+    0x04, 0xCF, 0xFF, 0xFF, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x4B, 0xFF, 0xFF, 0x93, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x69, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFC, 0x30,
+    0x00, 0xAF, 0xB4, 0x04, 0xBF, 0xFF, 0xC3, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x30, 0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // 9
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // :
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF,
+    0xB3, 0x00, 0x00, 0x00, // ;
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x04, 0xBF,
+    0xFF, 0xFB, 0x40, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFB, 0x40, 0x00, 0x00,
+    0x04, 0xBF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xF2,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xBF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF,
+    0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFB, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // <
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // =
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x4B, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF,
+    0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xB4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xB4,
+    0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x4B, 0xFF,
+    0xFF, 0xB4, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00,
+    0x3B, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // >
+    0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x30, 0x00, 0xFF, 0xF5, 0x00, 0x04, 0xCF, 0xFF, 0xC3,
+    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00, 0xAF, 0xA0, 0x00,
+    0x00, 0x0F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xCF, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xC3, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0xCF, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x3C,
+    0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // ?
+    0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x03, 0xBF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x3C, 0xFF, 0xFC, 0x40, 0x4B, 0xFF, 0xF4,
+    0x00, 0xBF, 0xFF, 0xC3, 0x00, 0x02, 0xFF, 0xFB, 0x04, 0xFF, 0xFC, 0x30,
+    0x3B, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xF4, 0x03, 0xCF, 0xFF, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xB0, 0x3C, 0xFF, 0xB2, 0xBF, 0xFF, 0x4F, 0xFF, 0x40, 0xBF,
+    0xFF, 0x40, 0x4F, 0xFF, 0xBF, 0xFF, 0x00, 0xFF, 0xFB, 0x00, 0x4F, 0xFF,
+    0xFF, 0xFF, 0x00, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
+    0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xF0, 0x04, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xBF, 0xFF, 0x00, 0xFF,
+    0xF5, 0x5F, 0xFF, 0xFF, 0x4F, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xB0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xF4, 0x3B,
+    0xFF, 0xFA, 0x2A, 0xFA, 0x03, 0xCF, 0xFC, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3C, 0xFF, 0xFB, 0x40, 0x4B, 0xFA, 0x00, 0x00, 0x03, 0xBF, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0xB3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // @
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x2F, 0xFF, 0xB0, 0x00,
+    0x00, 0x00, 0xFF, 0xFB, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x04, 0xFF, 0xF4,
+    0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x04, 0xFF, 0xFF, 0x00,
+    0x00, 0x4F, 0xFF, 0xA0, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0x20,
+    0x05, 0xFF, 0xFF, 0xB0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
+    0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x0B, 0xFF, 0xF5, 0x00,
+    0x00, 0x4C, 0xFF, 0xFF, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+    0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // A
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x30, 0x00, 0xFF, 0xFF, 0x50, 0x04, 0xCF, 0xFF, 0xB0,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x4F, 0xFF, 0xF0,
+    0x00, 0xFF, 0xFF, 0x00, 0x03, 0xCF, 0xFF, 0xB0, 0x00, 0xFF, 0xFF, 0x50,
+    0x4C, 0xFF, 0xFB, 0x30, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0xFF, 0xFF, 0x50,
+    0x4B, 0xFF, 0xFF, 0xB3, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x5F, 0xFF, 0xFB,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0x50, 0x00, 0x4C, 0xFF, 0xFB, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // B
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x4B, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3B, 0xFF, 0xFF, 0xB4, 0x00, 0x4B, 0xFA,
+    0x00, 0xBF, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xC3,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x3B, 0xFF, 0xFF, 0xC4, 0x00, 0x04, 0xBA, 0x00, 0x00, 0x4B, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // C
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x30, 0x0F, 0xFF, 0xF5, 0x00, 0x4B, 0xFF, 0xFF, 0xC3,
+    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x5F, 0xFF, 0xFB, 0x0F, 0xFF, 0xF0, 0x00,
+    0x00, 0x0B, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x00,
+    0x00, 0x0B, 0xFF, 0xFB, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x5F, 0xFF, 0xF4,
+    0x0F, 0xFF, 0xF5, 0x00, 0x4B, 0xFF, 0xFF, 0xA0, 0x0F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xB4, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // D
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0xFF, 0xFF, 0xF5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // E
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x0F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA,
+    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x0F, 0xFF, 0xF5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // F
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x03, 0xBF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x3C, 0xFF, 0xFF, 0xB4, 0x00, 0x4B, 0xFA,
+    0x03, 0xCF, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xF0, 0x00, 0x0A, 0xFF, 0xFF, 0xFA, 0xBF, 0xFF, 0xF0, 0x00,
+    0x0A, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x05, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0x40,
+    0x00, 0x00, 0xFF, 0xFF, 0x03, 0xCF, 0xFF, 0xC4, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x3C, 0xFF, 0xFF, 0xB4, 0x05, 0xFF, 0xFF, 0x00, 0x03, 0xBF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xB3,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // G
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xFF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x0F, 0xFF, 0xFF, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x50,
+    0x00, 0x5F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x50,
+    0x00, 0x5F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0x0A, 0xFF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // H
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0xAF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xF5, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // I
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x00,
+    0x00, 0xAF, 0xB4, 0x04, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFB, 0x30, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // J
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x4F, 0xFF, 0xC4, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xCF, 0xFC, 0x30,
+    0x00, 0xFF, 0xFF, 0x00, 0x3C, 0xFF, 0xC3, 0x00, 0x00, 0xFF, 0xFF, 0x03,
+    0xCF, 0xFC, 0x30, 0x00, 0x00, 0xFF, 0xFF, 0x2B, 0xFF, 0xF4, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFB, 0x30, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC3, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x2B, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x03, 0xCF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+    0x4F, 0xFF, 0xC3, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFC, 0x30,
+    0x00, 0xFF, 0xFF, 0x00, 0x03, 0xCF, 0xFF, 0xC3, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x3C, 0xFF, 0xFB, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x03, 0xBF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // K
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // L
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xB3, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0xFF, 0xFF, 0xFB, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x4F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x04, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFB, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0F, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0x0F, 0xFF,
+    0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFB, 0x0F, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF,
+    0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
+    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xB0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xAF,
+    0xFB, 0x30, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // M
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x0F, 0xFF, 0xFF, 0x40,
+    0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF,
+    0x40, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF,
+    0xFC, 0x30, 0xFF, 0xFF, 0x0F, 0xFF, 0xF2, 0xBF, 0xFF, 0xB0, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xF0, 0x4F, 0xFF, 0xF2, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x0B,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x04, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x00,
+    0x3C, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x00, 0x04, 0xFF, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x00,
+    0x00, 0x4F, 0xFF, 0xFF, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0x0A, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // N
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x3B, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x30, 0x03, 0xCF, 0xFF, 0xC4, 0x04, 0xCF, 0xFF, 0xC3,
+    0x0B, 0xFF, 0xFC, 0x30, 0x00, 0x3C, 0xFF, 0xFB, 0x0F, 0xFF, 0xF4, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xF4, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0x0B, 0xFF, 0xFC, 0x30, 0x00, 0x3C, 0xFF, 0xFB,
+    0x03, 0xCF, 0xFF, 0xC4, 0x04, 0xCF, 0xFF, 0xC3, 0x00, 0x3B, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFB, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // O
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0xFF, 0xFF, 0xF5, 0x00, 0x4C, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0,
+    0x00, 0x3C, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF5, 0x04, 0xCF, 0xFF, 0xFA,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFB, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // P
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x3B, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x30, 0x03, 0xCF, 0xFF, 0xC4, 0x04, 0xCF, 0xFF, 0xC3,
+    0x0B, 0xFF, 0xFC, 0x30, 0x00, 0x3C, 0xFF, 0xFB, 0x0F, 0xFF, 0xF4, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xF4, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0x0B, 0xFF, 0xFC, 0x30, 0x00, 0x3C, 0xFF, 0xFB,
+    0x03, 0xCF, 0xFF, 0xC4, 0x04, 0xCF, 0xFF, 0xC3, 0x00, 0x3B, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xF2, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xBF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // Q
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x30, 0x00, 0xFF, 0xFF, 0x50, 0x4C, 0xFF, 0xFF, 0xB0,
+    0x00, 0xFF, 0xFF, 0x00, 0x03, 0xCF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x4F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x4F, 0xFF, 0xF0,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x00, 0xFF, 0xFF, 0x00,
+    0x05, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x54, 0xBF, 0xFF, 0xFA, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF2, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x2B, 0xFF, 0xFB, 0x30, 0x00,
+    0x00, 0xFF, 0xFF, 0x03, 0xCF, 0xFF, 0xC3, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+    0x3C, 0xFF, 0xFC, 0x30, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xCF, 0xFF, 0xB0,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x0B, 0xFF, 0xFB, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x03, 0xBF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // R
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x3B, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0xBF, 0xFF, 0xC4, 0x00, 0x04, 0xBF, 0xA0,
+    0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFF,
+    0xFB, 0x40, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0xFF, 0xFF, 0xB4, 0x00,
+    0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+    0x4B, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0x00, 0xD5, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFB,
+    0x00, 0xFF, 0xFB, 0x40, 0x04, 0xCF, 0xFF, 0xC3, 0x00, 0xBF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // S
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xF5, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // T
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x0F, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x04, 0xFF, 0xFF, 0x00,
+    0x00, 0x0B, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x4F, 0xFF, 0xF0,
+    0x00, 0xBF, 0xFF, 0xC4, 0x04, 0xCF, 0xFF, 0xB0, 0x00, 0x3B, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFB, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // U
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFA, 0xFF, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x0B, 0xFF, 0xFB, 0x00,
+    0x00, 0x04, 0xFF, 0xFB, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xF4,
+    0x00, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xB0,
+    0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x40,
+    0x00, 0x0F, 0xFF, 0xFB, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+    0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x2F, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // V
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xAF,
+    0xFF, 0xA0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
+    0xBF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0x4F, 0xFF, 0x40, 0xFF,
+    0xFF, 0xF4, 0x0F, 0xFF, 0x0F, 0xFF, 0xB2, 0xFF, 0xFF, 0xFB, 0x0F, 0xFF,
+    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFB, 0x0B, 0xFF, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0xF4, 0x04, 0xFF, 0xFF, 0xFB, 0x0B, 0xFF, 0xFF, 0xF0,
+    0x00, 0xFF, 0xFF, 0xF4, 0x04, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0,
+    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0xAF, 0xFF, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // W
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x3B, 0xFA, 0x4C, 0xFF, 0xFC, 0x30,
+    0x00, 0x03, 0xCF, 0xFB, 0x04, 0xFF, 0xFF, 0xB0, 0x00, 0x3C, 0xFF, 0xF4,
+    0x00, 0xBF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xB0, 0x00, 0x3C, 0xFF, 0xFC,
+    0x45, 0xFF, 0xFC, 0x30, 0x00, 0x03, 0xCF, 0xFF, 0xFF, 0xFF, 0xC3, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF,
+    0xFF, 0xFC, 0x30, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC3, 0x00,
+    0x00, 0x04, 0xFF, 0xFB, 0x2F, 0xFF, 0xFB, 0x00, 0x00, 0x3C, 0xFF, 0xC3,
+    0x0B, 0xFF, 0xFF, 0x40, 0x03, 0xCF, 0xFC, 0x30, 0x03, 0xCF, 0xFF, 0xC3,
+    0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x3C, 0xFF, 0xFB, 0x5F, 0xFF, 0xB0, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0xDF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0xAF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // X
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x0A, 0xFA, 0x5F, 0xFF, 0xF4, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x03, 0xCF, 0xFB,
+    0x04, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xC3,
+    0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x3C, 0xFF, 0xFB, 0x03, 0xCF, 0xFC, 0x30,
+    0x00, 0x04, 0xFF, 0xFF, 0x2B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+    0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xFC, 0x30, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // Y
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x0A, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xCF, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFC, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xFF, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xF4, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF,
+    0xFC, 0x30, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC3, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xCF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // Z
+    0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF,
+    0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA,
+    0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // [
+    0x0A, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, /* \ */
+    0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0xFF, 0xFF, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // ]
+    0x00, 0x00, 0x00, 0x03, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0x2F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x0B, 0xFF, 0xF0, 0x00,
+    0x00, 0x04, 0xFF, 0xFB, 0x04, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xF4,
+    0x00, 0xFF, 0xFB, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0xBF, 0xFF, 0x40,
+    0x00, 0xBF, 0xFF, 0x40, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0xFF, 0xFB, 0x00,
+    0x00, 0x0B, 0xFF, 0xF4, 0x04, 0xFF, 0xF4, 0x00, 0x00, 0x04, 0xFF, 0xFB,
+    0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x0A, 0xFF, 0xA0, 0x00,
+    0x00, 0x00, 0x3B, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // ^
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // _
+    0x00, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // `
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0xAF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x00, 0x00, 0xAF, 0xFB, 0x40, 0x4C, 0xFF, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3B, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xCF, 0xFF, 0xC4, 0x05, 0xFF, 0xFF, 0xF0,
+    0x0B, 0xFF, 0xFB, 0x30, 0x00, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xF2, 0x00,
+    0x00, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFA, 0x00, 0x04, 0xFF, 0xFF, 0xF0,
+    0x0B, 0xFF, 0xFF, 0x50, 0x4C, 0xFF, 0xFF, 0xF4, 0x03, 0xCF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x3B, 0xFF, 0xFF, 0xFB, 0x44, 0xBF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // a
+    0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0xFF, 0xFF, 0xFC, 0x44, 0xCF, 0xFF, 0xF4,
+    0x00, 0xFF, 0xFF, 0xC3, 0x00, 0x3C, 0xFF, 0xFB, 0x00, 0xFF, 0xFF, 0x40,
+    0x00, 0x04, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x0B, 0xFF, 0xFB, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0x4F, 0xFF, 0xF4,
+    0x00, 0xFF, 0xFF, 0xFB, 0x44, 0xCF, 0xFF, 0xB0, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x30, 0x00, 0xAF, 0xA2, 0xAF, 0xFF, 0xFB, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // b
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x03, 0xBF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x3C, 0xFF, 0xFF, 0xB4, 0x00, 0x4B, 0xFA,
+    0x00, 0xBF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3C, 0xFF, 0xFF, 0xB4, 0x00, 0x4B, 0xFA, 0x00, 0x03, 0xBF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xB3,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // c
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF,
+    0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3B, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xC4, 0x04, 0xCF, 0xFF, 0xFF,
+    0x04, 0xFF, 0xFF, 0x40, 0x00, 0x4F, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFB, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xF4, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFB, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0x00,
+    0x00, 0x4F, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0x40, 0x03, 0xCF, 0xFF, 0xFF,
+    0x00, 0xBF, 0xFF, 0xC4, 0x4C, 0xFF, 0xFF, 0xFF, 0x00, 0x3C, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xBF, 0xFF, 0xFA, 0x2A, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // d
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x03, 0xBF, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x30, 0x00, 0x3C, 0xFF, 0xFC, 0x44, 0xCF, 0xFF, 0xB0,
+    0x00, 0xBF, 0xFF, 0xC3, 0x00, 0x4F, 0xFF, 0xF4, 0x04, 0xFF, 0xFF, 0x40,
+    0x00, 0x0F, 0xFF, 0xFB, 0x0B, 0xFF, 0xFF, 0x50, 0x00, 0x5F, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x0F, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3C, 0xFF, 0xFC, 0x40, 0x00, 0x4B, 0xFA, 0x00, 0x03, 0xBF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xB3,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // e
+    0x00, 0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0xBF,
+    0xFF, 0xC4, 0x00, 0x5D, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+    0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x0A, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // f
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xA2, 0xAF, 0xFA, 0x00, 0x3B, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xC4, 0x4B, 0xFF, 0xFF, 0xFF,
+    0x04, 0xFF, 0xFF, 0x40, 0x00, 0x5F, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFB, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFB, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0x00,
+    0x00, 0x4F, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0x40, 0x03, 0xCF, 0xFF, 0xFF,
+    0x00, 0xBF, 0xFF, 0xC4, 0x4C, 0xFF, 0xFF, 0xFF, 0x00, 0x3C, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xBF, 0xFF, 0xFA, 0x2F, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xB0,
+    0x00, 0xAF, 0xB4, 0x00, 0x4B, 0xFF, 0xFC, 0x30, 0x00, 0xAF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xB3, 0x00, // g
+    0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0xFB, 0x30, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0xFF, 0xFF, 0xFF, 0xC4, 0x5F, 0xFF, 0xF4,
+    0x00, 0xFF, 0xFF, 0xFC, 0x30, 0x0F, 0xFF, 0xFB, 0x00, 0xFF, 0xFF, 0xC3,
+    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // h
+    0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // i
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00,
+    0x0A, 0xFB, 0x40, 0x4C, 0xFF, 0xFB, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xB3, 0x00, 0x00, // j
+    0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3B, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0x00,
+    0x03, 0xCF, 0xFF, 0xC4, 0x00, 0xFF, 0xFF, 0x00, 0x3C, 0xFF, 0xFC, 0x30,
+    0x00, 0xFF, 0xFF, 0x03, 0xCF, 0xFF, 0xC3, 0x00, 0x00, 0xFF, 0xFF, 0x0B,
+    0xFF, 0xFC, 0x30, 0x00, 0x00, 0xFF, 0xFF, 0x2F, 0xFF, 0xC3, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x2B, 0xFF, 0xFC, 0x30, 0x00, 0x00, 0xFF, 0xFF, 0x03,
+    0xCF, 0xFF, 0xC3, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x3C, 0xFF, 0xFC, 0x30,
+    0x00, 0xFF, 0xFF, 0x00, 0x03, 0xCF, 0xFF, 0xC3, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x4F, 0xFF, 0xFB, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // k
+    0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // l
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xFA, 0x2A, 0xFF, 0xB4, 0x4B, 0xFF, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xBF,
+    0xFF, 0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x0F, 0xFF,
+    0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F,
+    0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF,
+    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F,
+    0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF,
+    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F,
+    0xFF, 0x00, 0x0F, 0xFF, 0xAF, 0xFA, 0x00, 0x0A, 0xFA, 0x00, 0x0A, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // m
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFA, 0x2A, 0xFF, 0xFF, 0xFB, 0x30, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0xFF, 0xFF, 0xFF, 0xC4, 0x5F, 0xFF, 0xF4,
+    0x00, 0xFF, 0xFF, 0xFC, 0x30, 0x0F, 0xFF, 0xFB, 0x00, 0xFF, 0xFF, 0xC3,
+    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // n
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x3B, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x30, 0x00, 0xBF, 0xFF, 0xC4, 0x04, 0xCF, 0xFF, 0xC3,
+    0x04, 0xFF, 0xFF, 0x40, 0x00, 0x4F, 0xFF, 0xFB, 0x0B, 0xFF, 0xFB, 0x00,
+    0x00, 0x0B, 0xFF, 0xFF, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x0B, 0xFF, 0xFB, 0x00,
+    0x00, 0x0B, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x4F, 0xFF, 0xFB,
+    0x00, 0xBF, 0xFF, 0xC4, 0x04, 0xCF, 0xFF, 0xC3, 0x00, 0x3B, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFB, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // o
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFA, 0x2A, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0xFF, 0xFF, 0xFC, 0x44, 0xCF, 0xFF, 0xF4,
+    0x00, 0xFF, 0xFF, 0xC3, 0x00, 0x3C, 0xFF, 0xFB, 0x00, 0xFF, 0xFF, 0x40,
+    0x00, 0x04, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x40,
+    0x00, 0x0B, 0xFF, 0xFB, 0x00, 0xFF, 0xFF, 0xC3, 0x00, 0x4F, 0xFF, 0xF4,
+    0x00, 0xFF, 0xFF, 0xFC, 0x44, 0xCF, 0xFF, 0xB0, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x30, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00,
+    0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00,
+    0x00, 0x00, 0x00, 0x00, // p
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xA2, 0xAF, 0xA0, 0x00, 0x3B, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xC4, 0x4B, 0xFF, 0xFF, 0xF0,
+    0x04, 0xFF, 0xFF, 0x40, 0x00, 0x5F, 0xFF, 0xF0, 0x0B, 0xFF, 0xFB, 0x00,
+    0x00, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
+    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x00,
+    0x00, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
+    0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFB, 0x00,
+    0x00, 0x4F, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0x40, 0x03, 0xCF, 0xFF, 0xF0,
+    0x03, 0xCF, 0xFF, 0xC4, 0x4C, 0xFF, 0xFF, 0xF0, 0x00, 0x3C, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xBF, 0xFF, 0xFA, 0x2F, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xFF, 0xA0, // q
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xFF, 0xFA, 0x2A, 0xFF, 0xFF, 0xFA, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC4, 0x5F, 0xFF,
+    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x30, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0xFF,
+    0xC3, 0x00, 0x0A, 0xFA, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // r
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x0A, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x04, 0xBF, 0xA0,
+    0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xCF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0,
+    0x00, 0xAF, 0xFB, 0x40, 0x04, 0xCF, 0xFF, 0xB0, 0x00, 0xBF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // s
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+    0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x0A, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x5F, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xCF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // t
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00,
+    0x03, 0xCF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x40, 0x3C, 0xFF, 0xFF, 0xF0,
+    0x00, 0xBF, 0xFF, 0xB2, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x3C, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xBF, 0xFF, 0xFA, 0x2A, 0xFF, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // u
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x3B, 0xFA, 0x5F, 0xFF, 0xB0, 0x00,
+    0x00, 0x00, 0xBF, 0xFF, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x04, 0xFF, 0xFB,
+    0x04, 0xFF, 0xFB, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x40,
+    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xB0, 0x00, 0x4F, 0xFF, 0xB0,
+    0x00, 0x4F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF4,
+    0x04, 0xFF, 0xFB, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x0B, 0xFF, 0xF4, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x2F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // v
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0xFF, 0x00, 0x3B,
+    0xFF, 0xA0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xF0, 0x04, 0xFF,
+    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
+    0xFF, 0xFB, 0x0F, 0xFF, 0xBF, 0xFF, 0x55, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF,
+    0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF,
+    0x2F, 0xFF, 0x2F, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFB,
+    0x0B, 0xFF, 0xFF, 0xFB, 0x04, 0xFF, 0xFF, 0xF4, 0x04, 0xFF, 0xFF, 0xF4,
+    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0,
+    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0xAF, 0xFF, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // w
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0D, 0xFF, 0xFB, 0x30, 0x00, 0x03, 0xBF, 0xFD, 0x05, 0xFF, 0xFF, 0xB0,
+    0x00, 0x3C, 0xFF, 0xC4, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x40,
+    0x00, 0x3C, 0xFF, 0xFC, 0x45, 0xFF, 0xFB, 0x00, 0x00, 0x03, 0xCF, 0xFF,
+    0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
+    0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFB, 0x30, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x03, 0xCF, 0xFF,
+    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3C, 0xFF, 0xF5, 0x4C, 0xFF, 0xFC, 0x30,
+    0x00, 0xBF, 0xFF, 0xB0, 0x03, 0xCF, 0xFF, 0xC3, 0x05, 0xFF, 0xFC, 0x30,
+    0x00, 0x4F, 0xFF, 0xFB, 0x0D, 0xFF, 0xB3, 0x00, 0x00, 0x0A, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // x
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x3B, 0xFA, 0x5F, 0xFF, 0xF4, 0x00,
+    0x00, 0x00, 0xBF, 0xFF, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x04, 0xFF, 0xFB,
+    0x04, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x40,
+    0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0xBF, 0xFF, 0x40,
+    0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFB,
+    0x04, 0xFF, 0xFB, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x2B, 0xFF, 0xF4, 0x00,
+    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFB,
+    0x30, 0x00, 0x00, 0x00, // y
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0xAF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00,
+    0x3C, 0xFF, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x03, 0xCF, 0xFF, 0xC3, 0x00,
+    0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x03, 0xCF,
+    0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFC, 0x30, 0x00, 0x00,
+    0x00, 0x03, 0xCF, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xCF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // z
+    0x00, 0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF,
+    0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xCF,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xCF,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // {
+    0x00, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // |
+    0x00, 0xDF, 0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x04, 0xCF,
+    0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+    0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xA0,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x0B,
+    0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xCF,
+    0xFF, 0xB0, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // }
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0xFB, 0x40, 0x00, 0x0A, 0xFA,
+    0x0B, 0xFF, 0xFF, 0xFF, 0xFB, 0x30, 0x0F, 0xFF, 0x4F, 0xFF, 0x54, 0xCF,
+    0xFF, 0xC4, 0x5F, 0xFF, 0xBF, 0xFF, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0xFB,
+    0xAF, 0xFA, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, // ~
+    0x00, 0x00
+};
+
+static const uint16_t FontOffset_16x26A4[] = {
+    0, 208, 416, 624, 832, 1040, 1248, 1456, 1664, 1872, 2080, 2288,
+    2496, 2704, 2912, 3120, 3328, 3536, 3744, 3952, 4160, 4368, 4576, 4784,
+    4992, 5200, 5408, 5616, 5824, 6032, 6240, 6448, 6656, 6864, 7072, 7280,
+    7488, 7696, 7904, 8112, 8320, 8528, 8736, 8944, 9152, 9360, 9568, 9776,
+    9984, 10192, 10400, 10608, 10816, 11024, 11232, 11440, 11648, 11856, 12064, 12272,
+    12480, 12688, 12896, 13104, 13312, 13520, 13728, 13936, 14144, 14352, 14560, 14768,
+    14976, 15184, 15392, 15600, 15808, 16016, 16224, 16432, 16640, 16848, 17056, 17264,
+    17472, 17680, 17888, 18096, 18304, 18512, 18720, 18928, 19136, 19344, 19552,
+};
+
+FontDef_s Font_07x10 = {10, 7, 0, FontBitmap_07x10, FontOffset_07x10, 32, 126};
+FontDef_s Font_11x18 = {18, 11, 0, FontBitmap_11x18, FontOffset_11x18, 32, 126};
+FontDef_s Font_16x26 = {26, 16, 0, FontBitmap_16x26, FontOffset_16x26, 32, 126};
+FontDef_s Font_07x10P = {10, 7, 0, FontBitmap_07x10P, FontOffset_07x10P, 32, 126,
+                      FontGlyphs_07x10P, 0, 0};
+FontDef_s Font_11x18P = {18, 11, 0, FontBitmap_11x18P, FontOffset_11x18P, 32, 126,
+                      FontGlyphs_11x18P, FontKerning_11x18P, 213};
+FontDef_s Font_16x26P = {26, 16, 0, FontBitmap_16x26P, FontOffset_16x26P, 32, 126,
+                      FontGlyphs_16x26P, FontKerning_16x26P, 292};
+FontDef_s Font_11x18A2 = {18, 11, 0, FontBitmap_11x18A2, FontOffset_11x18A2, 32, 126, 0, 0, 0, 2};
+FontDef_s Font_11x18A4 = {18, 11, 0, FontBitmap_11x18A4, FontOffset_11x18A4, 32, 126, 0, 0, 0, 4};
+FontDef_s Font_16x26A2 = {26, 16, 0, FontBitmap_16x26A2, FontOffset_16x26A2, 32, 126, 0, 0, 0, 2};
+FontDef_s Font_16x26A4 = {26, 16, 0, FontBitmap_16x26A4, FontOffset_16x26A4, 32, 126, 0, 0, 0, 4};
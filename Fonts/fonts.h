@@ -10,14 +10,89 @@
 
 #include <stdint.h>
 
+/**
+ * @brief Metrics of one glyph of a proportional font
+ */
+typedef struct {
+    uint8_t advance;    /* pen movement after the glyph */
+    int8_t offsetX;     /* ink box position inside the glyph cell */
+    uint8_t offsetY;
+    uint8_t boxWidth;   /* ink box size, zero for blank glyphs */
+    uint8_t boxHeight;
+} FontGlyph_s;
+/**
+ * @brief Kerning pair of a proportional font
+ */
+typedef struct {
+    uint8_t left;
+    uint8_t right;
+    int8_t adjust;      /* added to the advance of left when followed by right */
+} FontKerning_s;
+/**
+ * @brief Glyph encodings of monospace 1 bit per pixel fonts
+ * @details RLE: alternating background and foreground run lengths over the
+ * glyph in raster order, starting with background. Each run is a series of
+ * MSB-first nibbles, 15 meaning 15 pixels with more to follow, 0..14 ending
+ * the run. ROW_DELTA: a flag bit per row, 0 repeats the previous row (empty
+ * before the first one), 1 is followed by the width bits of a new row
+ */
+#define FONT_ENCODING_RAW 0
+#define FONT_ENCODING_RLE 1
+#define FONT_ENCODING_ROW_DELTA 2
+/**
+ * @brief Font description
+ * @details Packed fonts (the ones in fonts.c, generated by Tools/FontPack.py)
+ * store every glyph as a contiguous MSB-first bitstream of height * width
+ * bits, row after row, padded to a whole byte. glyphOffset holds the first
+ * byte of each glyph from firstChar to lastChar, and the bitmap ends with two
+ * padding bytes for the row decoder. Fonts in the older row table format set
+ * fontData to one uint16_t per row (MSB is the leftmost pixel) starting at
+ * character 32, and leave the packed fields zero.
+ * Proportional fonts additionally set glyphs, then the bitmap of a glyph only
+ * covers its ink box (boxWidth * boxHeight bits), and kerning lists pair
+ * adjustments sorted by (left, right). Anti-aliased fonts set bpp to 2 or 4,
+ * their bitstream holds one coverage level of bpp bits per pixel, 0 being
+ * background and the top level the font color.
+ * Unicode fonts (generated by Tools/FontCompiler.cpp) set codepoints to the
+ * sorted codepoints of their glyphNum glyphs instead of firstChar..lastChar,
+ * glyph 0 stands in for missing characters. Without glyphOffset every glyph
+ * fills its whole cell and they follow each other at a fixed size. Glyphs are
+ * at most 32 pixels wide.
+ * Compressed fonts set encoding and always index their glyphs, through
+ * glyphOffset32 when the bitmap outgrows the 64 KiB reach of glyphOffset
+ */
 typedef struct {
     uint8_t height;
-    const uint8_t width;
+    uint8_t width;
     const uint16_t *fontData;
+    const uint8_t *bitmap;
+    const uint16_t *glyphOffset;
+    uint8_t firstChar;
+    uint8_t lastChar;
+    const FontGlyph_s *glyphs;
+    const FontKerning_s *kerning;
+    uint16_t kerningNum;
+    uint8_t bpp;
+    const uint16_t *codepoints;
+    uint16_t glyphNum;
+    uint8_t encoding;
+    const uint32_t *glyphOffset32;
 } FontDef_s;
 
 extern FontDef_s Font_07x10;
 extern FontDef_s Font_11x18;
 extern FontDef_s Font_16x26;
+extern FontDef_s Font_07x10P;
+extern FontDef_s Font_11x18P;
+extern FontDef_s Font_16x26P;
+extern FontDef_s Font_11x18A2;
+extern FontDef_s Font_11x18A4;
+extern FontDef_s Font_16x26A2;
+extern FontDef_s Font_16x26A4;
+extern FontDef_s Font_Unicode14;
+extern FontDef_s Font_UnicodeMono16;
+extern FontDef_s Font_UnicodeMono16Bits;
+extern FontDef_s Font_UnicodeMono16Rle;
+extern FontDef_s Font_UnicodeMono16Delta;
 
-#endif
\ No newline at end of file
+#endif
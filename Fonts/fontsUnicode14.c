@@ -0,0 +1,334 @@
+/* Generated by ILI9341FontCompiler from DejaVuSans.ttf at 14 px, do not edit */
+#include "fonts.h"
+
+static const uint8_t FontBitmap_Unicode14[] = {
+    // U+0020  
+    0xFC, 0xC0, // U+0021 !
+    0xB6, 0xD0, // U+0022 "
+    0x09, 0x02, 0x40, 0x91, 0xFF, 0x12, 0x04, 0x8F, 0xF8, 0x98, 0x24, 0x09,
+    0x00, // U+0023 #
+    0x10, 0x21, 0xF4, 0x99, 0x1A, 0x1F, 0x0B, 0x13, 0x25, 0xF0, 0x81, 0x00, // U+0024 $
+    0x70, 0x88, 0x88, 0x89, 0x08, 0xB0, 0x8A, 0xE7, 0x51, 0x0D, 0x10, 0x91,
+    0x11, 0x11, 0x0E, // U+0025 %
+    0x38, 0x11, 0x04, 0x00, 0x80, 0x50, 0x22, 0x18, 0x46, 0x0A, 0x43, 0x0F,
+    0x30, // U+0026 &
+    0xF0, // U+0027 '
+    0x69, 0x49, 0x24, 0x89, 0x10, // U+0028 (
+    0x89, 0x12, 0x49, 0x29, 0x40, // U+0029 )
+    0x11, 0x25, 0xF1, 0xCD, 0x62, 0x00, // U+002A *
+    0x08, 0x04, 0x02, 0x01, 0x0F, 0xF8, 0x40, 0x20, 0x10, 0x08, 0x00, // U+002B +
+    0x58, // U+002C ,
+    0xF0, // U+002D -
+    0xC0, // U+002E .
+    0x08, 0xC4, 0x23, 0x10, 0x8C, 0x42, 0x31, 0x00, // U+002F /
+    0x38, 0x8A, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x44, 0x70, // U+0030 0
+    0x65, 0x08, 0x42, 0x10, 0x84, 0x27, 0xC0, // U+0031 1
+    0x7A, 0x30, 0x41, 0x0C, 0x21, 0x08, 0x43, 0xF0, // U+0032 2
+    0x7D, 0x0C, 0x08, 0x13, 0xC0, 0xC0, 0x81, 0x86, 0xF0, // U+0033 3
+    0x0C, 0x28, 0x91, 0x24, 0x50, 0xBF, 0x82, 0x04, 0x08, // U+0034 4
+    0xFD, 0x02, 0x07, 0xC8, 0x40, 0x40, 0x81, 0x84, 0xF0, // U+0035 5
+    0x3C, 0xC7, 0x04, 0x0B, 0xD8, 0xE0, 0xC1, 0x46, 0x78, // U+0036 6
+    0xFE, 0x08, 0x10, 0x40, 0x82, 0x04, 0x10, 0x20, 0x80, // U+0037 7
+    0x7D, 0x8E, 0x0E, 0x33, 0x98, 0xE0, 0xC1, 0xC6, 0xF8, // U+0038 8
+    0x79, 0x8A, 0x0C, 0x1C, 0x6F, 0x40, 0x83, 0x8C, 0xF0, // U+0039 9
+    0xC6, // U+003A :
+    0x50, 0x16, // U+003B ;
+    0x00, 0x83, 0x8E, 0x1C, 0x0E, 0x01, 0xC0, 0x1C, 0x01, // U+003C <
+    0xFF, 0x80, 0x00, 0x1F, 0xF0, // U+003D =
+    0x80, 0x38, 0x03, 0x80, 0x70, 0x38, 0x71, 0xC1, 0x00, // U+003E >
+    0x74, 0x42, 0x33, 0x10, 0x80, 0x21, 0x00, // U+003F ?
+    0x0F, 0x83, 0x04, 0x40, 0x24, 0xE9, 0x99, 0x99, 0x09, 0x90, 0x99, 0x9A,
+    0x4E, 0xC4, 0x00, 0x30, 0x40, 0xF8, // U+0040 @
+    0x08, 0x0A, 0x05, 0x04, 0x42, 0x21, 0x11, 0xFC, 0x82, 0x41, 0x40, 0x40, // U+0041 A
+    0xFE, 0x83, 0x81, 0x83, 0xFE, 0x83, 0x81, 0x81, 0x83, 0xFE, // U+0042 B
+    0x3E, 0x61, 0xC0, 0x80, 0x80, 0x80, 0x80, 0xC0, 0x61, 0x3E, // U+0043 C
+    0xFC, 0x41, 0xA0, 0x70, 0x18, 0x0C, 0x06, 0x03, 0x03, 0x83, 0x7E, 0x00, // U+0044 D
+    0xFF, 0x02, 0x04, 0x0F, 0xF0, 0x20, 0x40, 0x81, 0xFC, // U+0045 E
+    0xFE, 0x08, 0x20, 0xFE, 0x08, 0x20, 0x82, 0x00, // U+0046 F
+    0x1F, 0x30, 0x50, 0x10, 0x08, 0x04, 0x1E, 0x02, 0x81, 0x60, 0x8F, 0x80, // U+0047 G
+    0x81, 0x81, 0x81, 0x81, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, // U+0048 H
+    0xFF, 0xC0, // U+0049 I
+    0x24, 0x92, 0x49, 0x24, 0x9C, // U+004A J
+    0x83, 0x0A, 0x24, 0x8E, 0x14, 0x24, 0x44, 0x85, 0x04, // U+004B K
+    0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x83, 0xF0, // U+004C L
+    0xC0, 0xF0, 0x3A, 0x16, 0x85, 0x92, 0x64, 0x98, 0xC6, 0x31, 0x80, 0x60,
+    0x10, // U+004D M
+    0xC1, 0xC1, 0xA1, 0x91, 0x91, 0x89, 0x89, 0x85, 0x83, 0x83, // U+004E N
+    0x3E, 0x31, 0xB0, 0x70, 0x18, 0x0C, 0x06, 0x03, 0x83, 0x63, 0x1F, 0x00, // U+004F O
+    0xFD, 0x0E, 0x0C, 0x18, 0x7F, 0xA0, 0x40, 0x81, 0x00, // U+0050 P
+    0x3E, 0x31, 0xB0, 0x70, 0x18, 0x0C, 0x06, 0x03, 0x83, 0x63, 0x1F, 0x00,
+    0x80, 0x20, // U+0051 Q
+    0xFC, 0x86, 0x82, 0x82, 0x86, 0xFC, 0x86, 0x82, 0x82, 0x81, // U+0052 R
+    0x7D, 0x86, 0x04, 0x06, 0x03, 0x80, 0x81, 0x86, 0xF8, // U+0053 S
+    0xFF, 0x84, 0x02, 0x01, 0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x00, // U+0054 T
+    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3C, // U+0055 U
+    0x80, 0xA0, 0x90, 0x48, 0x22, 0x21, 0x10, 0x50, 0x28, 0x14, 0x04, 0x00, // U+0056 V
+    0x82, 0x0C, 0x28, 0x51, 0x44, 0x8A, 0x24, 0x51, 0x14, 0x50, 0xA2, 0x85,
+    0x14, 0x28, 0xA0, 0x82, 0x00, // U+0057 W
+    0xC1, 0xA0, 0x88, 0x82, 0x80, 0x80, 0xC0, 0x50, 0x44, 0x41, 0x60, 0xC0, // U+0058 X
+    0xC1, 0xA0, 0x88, 0x84, 0x41, 0x40, 0x40, 0x20, 0x10, 0x08, 0x04, 0x00, // U+0059 Y
+    0xFF, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0xFF, // U+005A Z
+    0xF2, 0x49, 0x24, 0x92, 0x70, // U+005B [
+    0x86, 0x10, 0x86, 0x10, 0x86, 0x10, 0x86, 0x10, // U+005C
+    0xE4, 0x92, 0x49, 0x24, 0xF0, // U+005D ]
+    0x1C, 0x1B, 0x18, 0xD8, 0x30, // U+005E ^
+    0xFE, // U+005F _
+    0xC8, 0x80, // U+0060 `
+    0x7A, 0x10, 0x5F, 0x86, 0x18, 0xDD, // U+0061 a
+    0x81, 0x02, 0x05, 0xCC, 0x50, 0x60, 0xC1, 0x83, 0x8A, 0xE0, // U+0062 b
+    0x39, 0x18, 0x20, 0x82, 0x04, 0x4E, // U+0063 c
+    0x02, 0x04, 0x09, 0xD4, 0x70, 0x60, 0xC1, 0x82, 0x8C, 0xE8, // U+0064 d
+    0x3C, 0x8E, 0x0F, 0xF8, 0x10, 0x10, 0x9E, // U+0065 e
+    0x34, 0x4F, 0x44, 0x44, 0x44, 0x40, // U+0066 f
+    0x3A, 0x8E, 0x0C, 0x18, 0x30, 0x51, 0x9D, 0x02, 0x8C, 0xF0, // U+0067 g
+    0x81, 0x02, 0x05, 0xEC, 0x70, 0x60, 0xC1, 0x83, 0x06, 0x08, // U+0068 h
+    0xDF, 0xE0, // U+0069 i
+    0x24, 0x12, 0x49, 0x24, 0x93, 0x80, // U+006A j
+    0x82, 0x08, 0x21, 0x8A, 0x4E, 0x28, 0x92, 0x28, 0x40, // U+006B k
+    0xFF, 0xE0, // U+006C l
+    0xB9, 0xD8, 0xC6, 0x10, 0xC2, 0x18, 0x43, 0x08, 0x61, 0x0C, 0x21, // U+006D m
+    0xBD, 0x8E, 0x0C, 0x18, 0x30, 0x60, 0xC1, // U+006E n
+    0x38, 0x8A, 0x0C, 0x18, 0x30, 0x51, 0x1C, // U+006F o
+    0xB9, 0x8A, 0x0C, 0x18, 0x30, 0x71, 0x5C, 0x81, 0x02, 0x00, // U+0070 p
+    0x3A, 0x8E, 0x0C, 0x18, 0x30, 0x51, 0x9D, 0x02, 0x04, 0x08, // U+0071 q
+    0xBC, 0x88, 0x88, 0x88, // U+0072 r
+    0x7A, 0x18, 0x38, 0x1C, 0x18, 0x5E, // U+0073 s
+    0x42, 0x3E, 0x84, 0x21, 0x08, 0x41, 0xC0, // U+0074 t
+    0x83, 0x06, 0x0C, 0x18, 0x30, 0x71, 0xBD, // U+0075 u
+    0x83, 0x05, 0x12, 0x24, 0x45, 0x0A, 0x08, // U+0076 v
+    0x88, 0xC4, 0x62, 0x2A, 0xA5, 0x52, 0xA8, 0x88, 0x44, // U+0077 w
+    0x82, 0x88, 0xA0, 0x81, 0x05, 0x11, 0x41, // U+0078 x
+    0x83, 0x05, 0x12, 0x22, 0x85, 0x04, 0x08, 0x10, 0x43, 0x00, // U+0079 y
+    0xFC, 0x10, 0x84, 0x21, 0x08, 0x3F, // U+007A z
+    0x19, 0x08, 0x42, 0x13, 0x04, 0x21, 0x08, 0x41, 0x80, // U+007B {
+    0xFF, 0xFC, // U+007C |
+    0xC1, 0x08, 0x42, 0x10, 0x64, 0x21, 0x08, 0x4C, 0x00, // U+007D }
+    0x78, 0xC7, 0x80, // U+007E ~
+    0x69, 0x96, // U+00B0 °
+    0x08, 0x04, 0x02, 0x1F, 0xF0, 0x80, 0x40, 0x20, 0x00, 0xFF, 0x80, // U+00B1 ±
+    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xC6, 0xFB, 0x80, 0x80, 0x80, // U+00B5 µ
+    0x14, 0x00, 0x02, 0x02, 0x81, 0x41, 0x10, 0x88, 0x44, 0x7F, 0x20, 0x90,
+    0x50, 0x10, // U+00C4 Ä
+    0x14, 0x00, 0x0F, 0x8C, 0x6C, 0x1C, 0x06, 0x03, 0x01, 0x80, 0xE0, 0xD8,
+    0xC7, 0xC0, // U+00D6 Ö
+    0x24, 0x00, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3C, // U+00DC Ü
+    0x79, 0x8A, 0x14, 0xC9, 0x12, 0x27, 0x43, 0x83, 0x06, 0xF0, // U+00DF ß
+    0x48, 0x00, 0x1E, 0x84, 0x17, 0xE1, 0x86, 0x37, 0x40, // U+00E4 ä
+    0x31, 0x24, 0x8C, 0x01, 0xE8, 0x41, 0x7E, 0x18, 0x63, 0x74, // U+00E5 å
+    0x39, 0x18, 0x20, 0x82, 0x04, 0x4E, 0x10, 0x23, 0x80, // U+00E7 ç
+    0x40, 0x40, 0x40, 0x03, 0xC8, 0xE0, 0xFF, 0x81, 0x01, 0x09, 0xE0, // U+00E8 è
+    0x0C, 0x10, 0x40, 0x03, 0xC8, 0xE0, 0xFF, 0x81, 0x01, 0x09, 0xE0, // U+00E9 é
+    0x10, 0x51, 0x10, 0x03, 0xC8, 0xE0, 0xFF, 0x81, 0x01, 0x09, 0xE0, // U+00EA ê
+    0x74, 0xB8, 0x05, 0xEC, 0x70, 0x60, 0xC1, 0x83, 0x06, 0x08, // U+00F1 ñ
+    0x28, 0x00, 0x01, 0xC4, 0x50, 0x60, 0xC1, 0x82, 0x88, 0xE0, // U+00F6 ö
+    0x3A, 0x8A, 0x2C, 0x99, 0x34, 0x51, 0x5C, // U+00F8 ø
+    0x28, 0x00, 0x04, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x8D, 0xE8, // U+00FC ü
+    0xFF, 0x06, 0x0C, 0x10, 0x42, 0x10, 0xC3, 0xF0, // U+03A3 Σ
+    0x3E, 0x31, 0xB0, 0x70, 0x18, 0x0C, 0x06, 0x02, 0x82, 0x22, 0x7B, 0xC0, // U+03A9 Ω
+    0x39, 0x4E, 0x86, 0x86, 0x84, 0x84, 0x4A, 0x7B, // U+03B1 α
+    0x79, 0x8A, 0x14, 0x28, 0xD7, 0x21, 0xC1, 0x83, 0x8F, 0xF4, 0x08, 0x10,
+    0x00, // U+03B2 β
+    0xC1, 0x42, 0x22, 0x22, 0x14, 0x14, 0x1C, 0x08, 0x08, 0x08, 0x08, // U+03B3 γ
+    0x3C, 0x81, 0x83, 0xE4, 0x50, 0x60, 0xC1, 0x82, 0x88, 0xE0, // U+03B4 δ
+    0x7E, 0x08, 0x1C, 0x82, 0x0C, 0x1F, // U+03B5 ε
+    0x60, 0x20, 0x40, 0x81, 0x85, 0x0A, 0x32, 0x44, 0x8A, 0x08, // U+03BB λ
+    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xC6, 0xFB, 0x80, 0x80, 0x80, // U+03BC μ
+    0xFE, 0x89, 0x12, 0x24, 0x48, 0x91, 0x23, // U+03C0 π
+    0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, // U+041F П
+    0xFA, 0x18, 0x7E, 0x86, 0x18, 0x7E, // U+0432 в
+    0x3C, 0x8E, 0x0F, 0xF8, 0x10, 0x10, 0x9E, // U+0435 е
+    0x87, 0x0E, 0x2C, 0x99, 0x34, 0x70, 0xE1, // U+0438 и
+    0xC3, 0xC3, 0xE7, 0xA5, 0xA5, 0x99, 0x99, 0x81, // U+043C м
+    0xB9, 0x8A, 0x0C, 0x18, 0x30, 0x71, 0x5C, 0x81, 0x02, 0x00, // U+0440 р
+    0xFE, 0x20, 0x40, 0x81, 0x02, 0x04, 0x08, // U+0442 т
+    0xFC, // U+2013 –
+    0x5A, 0xA0, // U+201C “
+    0x55, 0xA0, // U+201D ”
+    0x84, 0x30, 0x84, // U+2026 …
+    0x1E, 0x21, 0x40, 0xFC, 0x40, 0xF8, 0x40, 0x40, 0x21, 0x1E, // U+20AC €
+    0x20, 0x10, 0x0F, 0xFD, 0x00, 0x20, 0x00, // U+2190 ←
+    0x23, 0xAA, 0x42, 0x10, 0x84, 0x21, 0x00, // U+2191 ↑
+    0x01, 0x00, 0x2F, 0xFC, 0x02, 0x01, 0x00, // U+2192 →
+    0x21, 0x08, 0x42, 0x10, 0x95, 0x71, 0x00, // U+2193 ↓
+    0x00, 0x00, 0x00, 0x00
+};
+
+static const uint16_t FontOffset_Unicode14[] = {
+    0, 0, 2, 4, 17, 29, 44, 57, 58, 63, 68, 74,
+    85, 86, 87, 88, 96, 105, 112, 120, 129, 138, 147, 156,
+    165, 174, 183, 184, 186, 195, 200, 209, 216, 234, 246, 256,
+    266, 278, 287, 295, 307, 317, 319, 324, 333, 341, 354, 364,
+    376, 385, 399, 409, 418, 430, 440, 452, 469, 481, 493, 503,
+    508, 516, 521, 526, 527, 529, 535, 545, 551, 561, 568, 574,
+    584, 594, 596, 602, 611, 613, 624, 631, 638, 648, 658, 662,
+    668, 675, 682, 689, 698, 705, 715, 721, 730, 732, 741, 744,
+    746, 757, 768, 782, 796, 808, 818, 827, 837, 846, 857, 868,
+    879, 889, 899, 906, 916, 924, 936, 944, 957, 968, 978, 984,
+    994, 1005, 1012, 1022, 1028, 1035, 1042, 1050, 1060, 1067, 1068, 1070,
+    1072, 1075, 1085, 1092, 1099, 1106,
+};
+
+static const FontGlyph_s FontGlyphs_Unicode14[] = {
+    {4, 0, 0, 0, 0}, // U+0020  
+    {5, 2, 3, 1, 10}, // U+0021 !
+    {5, 1, 3, 3, 4}, // U+0022 "
+    {12, 1, 3, 10, 10}, // U+0023 #
+    {9, 1, 2, 7, 13}, // U+0024 $
+    {13, 0, 3, 12, 10}, // U+0025 %
+    {12, 1, 3, 10, 10}, // U+0026 &
+    {3, 1, 3, 1, 4}, // U+0027 '
+    {5, 1, 2, 3, 12}, // U+0028 (
+    {5, 1, 2, 3, 12}, // U+0029 )
+    {7, 0, 3, 7, 6}, // U+002A *
+    {12, 1, 4, 9, 9}, // U+002B +
+    {4, 1, 11, 2, 3}, // U+002C ,
+    {5, 1, 9, 4, 1}, // U+002D -
+    {4, 2, 11, 1, 2}, // U+002E .
+    {5, 0, 3, 5, 12}, // U+002F /
+    {9, 1, 3, 7, 10}, // U+0030 0
+    {9, 2, 3, 5, 10}, // U+0031 1
+    {9, 1, 3, 6, 10}, // U+0032 2
+    {9, 1, 3, 7, 10}, // U+0033 3
+    {9, 1, 3, 7, 10}, // U+0034 4
+    {9, 1, 3, 7, 10}, // U+0035 5
+    {9, 1, 3, 7, 10}, // U+0036 6
+    {9, 1, 3, 7, 10}, // U+0037 7
+    {9, 1, 3, 7, 10}, // U+0038 8
+    {9, 1, 3, 7, 10}, // U+0039 9
+    {5, 2, 6, 1, 7}, // U+003A :
+    {5, 1, 6, 2, 8}, // U+003B ;
+    {12, 1, 5, 9, 8}, // U+003C <
+    {12, 1, 6, 9, 4}, // U+003D =
+    {12, 1, 5, 9, 8}, // U+003E >
+    {7, 1, 3, 5, 10}, // U+003F ?
+    {14, 1, 3, 12, 12}, // U+0040 @
+    {9, 0, 3, 9, 10}, // U+0041 A
+    {10, 1, 3, 8, 10}, // U+0042 B
+    {10, 1, 3, 8, 10}, // U+0043 C
+    {11, 1, 3, 9, 10}, // U+0044 D
+    {9, 1, 3, 7, 10}, // U+0045 E
+    {8, 1, 3, 6, 10}, // U+0046 F
+    {11, 1, 3, 9, 10}, // U+0047 G
+    {10, 1, 3, 8, 10}, // U+0048 H
+    {3, 1, 3, 1, 10}, // U+0049 I
+    {3, -1, 3, 3, 13}, // U+004A J
+    {9, 1, 3, 7, 10}, // U+004B K
+    {7, 1, 3, 6, 10}, // U+004C L
+    {12, 1, 3, 10, 10}, // U+004D M
+    {10, 1, 3, 8, 10}, // U+004E N
+    {11, 1, 3, 9, 10}, // U+004F O
+    {9, 1, 3, 7, 10}, // U+0050 P
+    {11, 1, 3, 9, 12}, // U+0051 Q
+    {10, 1, 3, 8, 10}, // U+0052 R
+    {9, 1, 3, 7, 10}, // U+0053 S
+    {9, 0, 3, 9, 10}, // U+0054 T
+    {10, 1, 3, 8, 10}, // U+0055 U
+    {9, 0, 3, 9, 10}, // U+0056 V
+    {13, 0, 3, 13, 10}, // U+0057 W
+    {9, 0, 3, 9, 10}, // U+0058 X
+    {9, 0, 3, 9, 10}, // U+0059 Y
+    {10, 1, 3, 8, 10}, // U+005A Z
+    {5, 1, 2, 3, 12}, // U+005B [
+    {5, 0, 3, 5, 12}, // U+005C
+    {5, 1, 2, 3, 12}, // U+005D ]
+    {12, 1, 3, 9, 4}, // U+005E ^
+    {7, 0, 15, 7, 1}, // U+005F _
+    {7, 1, 1, 3, 3}, // U+0060 `
+    {8, 1, 5, 6, 8}, // U+0061 a
+    {9, 1, 2, 7, 11}, // U+0062 b
+    {8, 1, 5, 6, 8}, // U+0063 c
+    {9, 1, 2, 7, 11}, // U+0064 d
+    {9, 1, 5, 7, 8}, // U+0065 e
+    {4, 0, 2, 4, 11}, // U+0066 f
+    {9, 1, 5, 7, 11}, // U+0067 g
+    {9, 1, 2, 7, 11}, // U+0068 h
+    {3, 1, 2, 1, 11}, // U+0069 i
+    {3, -1, 2, 3, 14}, // U+006A j
+    {8, 1, 2, 6, 11}, // U+006B k
+    {3, 1, 2, 1, 11}, // U+006C l
+    {13, 1, 5, 11, 8}, // U+006D m
+    {9, 1, 5, 7, 8}, // U+006E n
+    {9, 1, 5, 7, 8}, // U+006F o
+    {9, 1, 5, 7, 11}, // U+0070 p
+    {9, 1, 5, 7, 11}, // U+0071 q
+    {5, 1, 5, 4, 8}, // U+0072 r
+    {8, 1, 5, 6, 8}, // U+0073 s
+    {5, 0, 3, 5, 10}, // U+0074 t
+    {9, 1, 5, 7, 8}, // U+0075 u
+    {7, 0, 5, 7, 8}, // U+0076 v
+    {11, 1, 5, 9, 8}, // U+0077 w
+    {7, 0, 5, 7, 8}, // U+0078 x
+    {7, 0, 5, 7, 11}, // U+0079 y
+    {8, 1, 5, 6, 8}, // U+007A z
+    {9, 2, 2, 5, 13}, // U+007B {
+    {5, 2, 2, 1, 14}, // U+007C |
+    {9, 3, 2, 5, 13}, // U+007D }
+    {12, 1, 8, 9, 2}, // U+007E ~
+    {7, 1, 3, 4, 4}, // U+00B0 °
+    {12, 1, 4, 9, 9}, // U+00B1 ±
+    {9, 1, 5, 8, 11}, // U+00B5 µ
+    {9, 0, 1, 9, 12}, // U+00C4 Ä
+    {11, 1, 1, 9, 12}, // U+00D6 Ö
+    {10, 1, 1, 8, 12}, // U+00DC Ü
+    {9, 1, 2, 7, 11}, // U+00DF ß
+    {8, 1, 2, 6, 11}, // U+00E4 ä
+    {8, 1, 0, 6, 13}, // U+00E5 å
+    {8, 1, 5, 6, 11}, // U+00E7 ç
+    {9, 1, 1, 7, 12}, // U+00E8 è
+    {9, 1, 1, 7, 12}, // U+00E9 é
+    {9, 1, 1, 7, 12}, // U+00EA ê
+    {9, 1, 2, 7, 11}, // U+00F1 ñ
+    {9, 1, 2, 7, 11}, // U+00F6 ö
+    {9, 1, 5, 7, 8}, // U+00F8 ø
+    {9, 1, 2, 7, 11}, // U+00FC ü
+    {8, 1, 3, 6, 10}, // U+03A3 Σ
+    {11, 1, 3, 9, 10}, // U+03A9 Ω
+    {10, 1, 5, 8, 8}, // U+03B1 α
+    {9, 1, 2, 7, 14}, // U+03B2 β
+    {8, 0, 5, 8, 11}, // U+03B3 γ
+    {9, 1, 2, 7, 11}, // U+03B4 δ
+    {8, 1, 5, 6, 8}, // U+03B5 ε
+    {7, 0, 2, 7, 11}, // U+03BB λ
+    {9, 1, 5, 8, 11}, // U+03BC μ
+    {8, 0, 5, 7, 8}, // U+03C0 π
+    {10, 1, 3, 8, 10}, // U+041F П
+    {8, 1, 5, 6, 8}, // U+0432 в
+    {9, 1, 5, 7, 8}, // U+0435 е
+    {9, 1, 5, 7, 8}, // U+0438 и
+    {10, 1, 5, 8, 8}, // U+043C м
+    {9, 1, 5, 7, 11}, // U+0440 р
+    {9, 1, 5, 7, 8}, // U+0442 т
+    {7, 1, 9, 6, 1}, // U+2013 –
+    {7, 1, 3, 4, 3}, // U+201C “
+    {7, 1, 3, 4, 3}, // U+201D ”
+    {14, 2, 11, 11, 2}, // U+2026 …
+    {9, 0, 3, 8, 10}, // U+20AC €
+    {12, 1, 6, 10, 5}, // U+2190 ←
+    {12, 3, 3, 5, 10}, // U+2191 ↑
+    {12, 1, 6, 10, 5}, // U+2192 →
+    {12, 3, 3, 5, 10}, // U+2193 ↓
+};
+
+static const uint16_t FontCodepoints_Unicode14[] = {
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+    0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+    0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+    0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+    0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+    0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x00B0,
+    0x00B1, 0x00B5, 0x00C4, 0x00D6, 0x00DC, 0x00DF, 0x00E4, 0x00E5,
+    0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00F1, 0x00F6, 0x00F8, 0x00FC,
+    0x03A3, 0x03A9, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03BB,
+    0x03BC, 0x03C0, 0x041F, 0x0432, 0x0435, 0x0438, 0x043C, 0x0440,
+    0x0442, 0x2013, 0x201C, 0x201D, 0x2026, 0x20AC, 0x2190, 0x2191,
+    0x2192, 0x2193,
+};
+
+FontDef_s Font_Unicode14 = {17, 14, 0, FontBitmap_Unicode14, FontOffset_Unicode14, 0, 0,
+                      FontGlyphs_Unicode14, 0, 0, 1, FontCodepoints_Unicode14, 138};
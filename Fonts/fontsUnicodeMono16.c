@@ -0,0 +1,1134 @@
+/* Generated by ILI9341FontCompiler from DejaVuSansMono.ttf at 16 px, do not edit */
+#include "fonts.h"
+
+static const uint8_t FontBitmap_UnicodeMono16[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0020  
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0x00, 0xD8,
+    0x00, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0021 !
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0x05, 0xF0, 0x00, 0x00, 0x5F, 0x05, 0xF0,
+    0x00, 0x00, 0x5F, 0x05, 0xF0, 0x00, 0x00, 0x5F, 0x05, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0022 "
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF3, 0x0D,
+    0x60, 0x00, 0x05, 0xE0, 0x2F, 0x20, 0x00, 0x09, 0xA0, 0x6D, 0x00, 0x1F,
+    0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x2F, 0x20, 0xE4, 0x00, 0x00, 0x5E, 0x02,
+    0xF1, 0x00, 0x00, 0x8B, 0x06, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0,
+    0x02, 0xF2, 0x0E, 0x50, 0x00, 0x06, 0xD0, 0x3F, 0x10, 0x00, 0x0A, 0x90,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0023 #
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00,
+    0x00, 0x00, 0x4B, 0xEE, 0xA4, 0x00, 0x03, 0xF7, 0x67, 0x4B, 0x00, 0x07,
+    0xE0, 0x66, 0x00, 0x00, 0x06, 0xF3, 0x66, 0x00, 0x00, 0x00, 0xBF, 0xDA,
+    0x40, 0x00, 0x00, 0x04, 0xAD, 0xFB, 0x10, 0x00, 0x00, 0x66, 0x2E, 0x80,
+    0x00, 0x00, 0x66, 0x0C, 0xA0, 0x07, 0x83, 0x67, 0x5F, 0x50, 0x01, 0x7C,
+    0xEE, 0xC5, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0024 $
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xEC, 0x40, 0x00, 0x00, 0x7B, 0x14, 0xE1, 0x00,
+    0x00, 0xA5, 0x00, 0xD3, 0x00, 0x00, 0x7B, 0x14, 0xE1, 0x00, 0x30, 0x09,
+    0xED, 0x40, 0x4B, 0xA0, 0x00, 0x00, 0x5C, 0x92, 0x00, 0x00, 0x5C, 0x92,
+    0x00, 0x00, 0x2C, 0x82, 0x08, 0xED, 0x50, 0x01, 0x00, 0x5C, 0x13, 0xE2,
+    0x00, 0x00, 0x87, 0x00, 0xB5, 0x00, 0x00, 0x5C, 0x13, 0xE2, 0x00, 0x00,
+    0x08, 0xED, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0025 %
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3C, 0xEF, 0xC0, 0x00, 0x00, 0xE9, 0x10, 0x00,
+    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0x30, 0x00, 0x00, 0x06, 0xFD, 0xD1, 0x00, 0x00, 0x2F, 0x62, 0xE9,
+    0x00, 0xD5, 0x7E, 0x00, 0x6F, 0x50, 0xE4, 0x8D, 0x00, 0x0A, 0xE4, 0xF1,
+    0x5F, 0x30, 0x01, 0xDE, 0xA0, 0x0C, 0xD4, 0x13, 0xBF, 0x70, 0x01, 0x9E,
+    0xFD, 0x78, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0026 &
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00,
+    0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0027 '
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xA0, 0x00, 0x00, 0x00, 0x3F, 0x20,
+    0x00, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x00, 0x01, 0xF6, 0x00, 0x00, 0x00,
+    0x05, 0xF2, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x09, 0xD0,
+    0x00, 0x00, 0x00, 0x0A, 0xD0, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00,
+    0x00, 0x05, 0xF2, 0x00, 0x00, 0x00, 0x01, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0xAB, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x00, 0x09, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0028 (
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1E, 0x40, 0x00, 0x00, 0x00, 0x08, 0xC0, 0x00,
+    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00,
+    0x00, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x30, 0x00, 0x00, 0x00, 0x4F,
+    0x40, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x5F, 0x30, 0x00,
+    0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x02,
+    0xF4, 0x00, 0x00, 0x00, 0x08, 0xC0, 0x00, 0x00, 0x00, 0x1E, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0029 )
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x94, 0x00,
+    0x00, 0x06, 0x92, 0x94, 0x4B, 0x20, 0x00, 0x4A, 0xDC, 0x82, 0x00, 0x00,
+    0x4A, 0xDC, 0x81, 0x00, 0x06, 0x92, 0x94, 0x4B, 0x20, 0x00, 0x00, 0x94,
+    0x00, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+002A *
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7,
+    0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xD7, 0x00, 0x00,
+    0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+002B +
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x01,
+    0xFD, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF1, 0x00,
+    0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+002C ,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+002D -
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+002E .
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x30, 0x00, 0x00, 0x00, 0xBB,
+    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
+    0x00, 0x3F, 0x50, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00, 0x02, 0xF5,
+    0x00, 0x00, 0x00, 0x09, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x60, 0x00, 0x00,
+    0x00, 0x8E, 0x10, 0x00, 0x00, 0x01, 0xE7, 0x00, 0x00, 0x00, 0x07, 0xE1,
+    0x00, 0x00, 0x00, 0x1E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+002F /
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2B, 0xEE, 0x80, 0x00, 0x01, 0xDA, 0x13, 0xE9,
+    0x00, 0x07, 0xF1, 0x00, 0x7F, 0x10, 0x0B, 0xC0, 0x00, 0x3F, 0x50, 0x0D,
+    0xA0, 0x00, 0x1F, 0x80, 0x0E, 0xA1, 0xD9, 0x0F, 0x90, 0x0E, 0xA1, 0xE9,
+    0x0F, 0x90, 0x0D, 0xA0, 0x00, 0x1F, 0x80, 0x0B, 0xC0, 0x00, 0x3F, 0x50,
+    0x07, 0xF1, 0x00, 0x7F, 0x10, 0x01, 0xDA, 0x13, 0xE9, 0x00, 0x00, 0x2B,
+    0xEE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0030 0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x39, 0xEF, 0x20, 0x00, 0x01, 0xC6, 0x7F, 0x20,
+    0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00,
+    0x00, 0x7F, 0x20, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x00, 0x7F,
+    0x20, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00,
+    0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0xDF,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0031 1
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x9D, 0xEC, 0x60, 0x00, 0x0B, 0xC4, 0x14, 0xE9,
+    0x00, 0x07, 0x10, 0x00, 0x8F, 0x10, 0x00, 0x00, 0x00, 0x7F, 0x30, 0x00,
+    0x00, 0x00, 0xAF, 0x10, 0x00, 0x00, 0x04, 0xF9, 0x00, 0x00, 0x00, 0x1D,
+    0xD1, 0x00, 0x00, 0x00, 0xBE, 0x20, 0x00, 0x00, 0x0A, 0xE3, 0x00, 0x00,
+    0x00, 0x8F, 0x50, 0x00, 0x00, 0x06, 0xF6, 0x00, 0x00, 0x00, 0x0C, 0xFF,
+    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0032 2
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x7C, 0xED, 0x71, 0x00, 0x07, 0x72, 0x14, 0xEA,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0x10, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x00,
+    0x00, 0x04, 0xEA, 0x00, 0x00, 0x0E, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x14,
+    0xEA, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x60,
+    0x00, 0x00, 0x00, 0x5F, 0x40, 0x0B, 0x52, 0x14, 0xDC, 0x00, 0x03, 0xAD,
+    0xED, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0033 3
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF5, 0x00, 0x00, 0x00, 0x7E, 0xF5,
+    0x00, 0x00, 0x02, 0xE7, 0xF5, 0x00, 0x00, 0x0B, 0x94, 0xF5, 0x00, 0x00,
+    0x5E, 0x14, 0xF5, 0x00, 0x01, 0xE7, 0x04, 0xF5, 0x00, 0x09, 0xD0, 0x04,
+    0xF5, 0x00, 0x2F, 0x50, 0x04, 0xF5, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0,
+    0x00, 0x00, 0x04, 0xF5, 0x00, 0x00, 0x00, 0x04, 0xF5, 0x00, 0x00, 0x00,
+    0x04, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0034 4
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xF1, 0x00, 0x00,
+    0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x06,
+    0xFE, 0xFD, 0x70, 0x00, 0x05, 0x71, 0x17, 0xF9, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0x20, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50,
+    0x00, 0x00, 0x00, 0x8F, 0x20, 0x0A, 0x51, 0x16, 0xF9, 0x00, 0x03, 0xBE,
+    0xFD, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0035 5
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0xDF, 0xB3, 0x00, 0x00, 0xBC, 0x30, 0x38,
+    0x00, 0x05, 0xF2, 0x00, 0x00, 0x00, 0x0A, 0xB0, 0x00, 0x00, 0x00, 0x0D,
+    0x98, 0xEE, 0xB2, 0x00, 0x0E, 0xEA, 0x12, 0xBD, 0x00, 0x0E, 0xE1, 0x00,
+    0x3F, 0x60, 0x0D, 0xC0, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0x0F, 0x80,
+    0x07, 0xE1, 0x00, 0x3F, 0x50, 0x01, 0xEA, 0x12, 0xBD, 0x00, 0x00, 0x3B,
+    0xEE, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0036 6
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x8F,
+    0x20, 0x00, 0x00, 0x00, 0xDC, 0x00, 0x00, 0x00, 0x04, 0xF6, 0x00, 0x00,
+    0x00, 0x09, 0xF1, 0x00, 0x00, 0x00, 0x1E, 0xA0, 0x00, 0x00, 0x00, 0x5F,
+    0x40, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
+    0x00, 0x07, 0xF3, 0x00, 0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x3F,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0037 7
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0xEE, 0xA2, 0x00, 0x04, 0xF8, 0x12, 0xCD,
+    0x10, 0x09, 0xE0, 0x00, 0x5F, 0x40, 0x09, 0xE0, 0x00, 0x5F, 0x40, 0x03,
+    0xE7, 0x12, 0xCB, 0x00, 0x00, 0x4E, 0xFF, 0xB1, 0x00, 0x04, 0xF7, 0x12,
+    0xBC, 0x10, 0x0C, 0xC0, 0x00, 0x2F, 0x60, 0x0E, 0xA0, 0x00, 0x0F, 0x90,
+    0x0C, 0xC0, 0x00, 0x2F, 0x70, 0x06, 0xF7, 0x12, 0xBE, 0x20, 0x00, 0x6C,
+    0xEE, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0038 8
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x6D, 0xFD, 0x80, 0x00, 0x05, 0xF6, 0x14, 0xE9,
+    0x00, 0x0C, 0xC0, 0x00, 0x7F, 0x10, 0x0E, 0x90, 0x00, 0x4F, 0x50, 0x0E,
+    0x90, 0x00, 0x4F, 0x70, 0x0C, 0xC0, 0x00, 0x7F, 0x80, 0x05, 0xF6, 0x14,
+    0xDF, 0x80, 0x00, 0x6D, 0xFD, 0x4E, 0x70, 0x00, 0x00, 0x00, 0x2F, 0x40,
+    0x00, 0x00, 0x00, 0x7E, 0x00, 0x02, 0x82, 0x16, 0xF5, 0x00, 0x00, 0x7D,
+    0xEC, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0039 9
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+003A :
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x01,
+    0xFD, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF1, 0x00,
+    0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+003B ;
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xC0, 0x00,
+    0x00, 0x39, 0xEE, 0x90, 0x01, 0x6C, 0xFC, 0x61, 0x00, 0x3E, 0xE8, 0x30,
+    0x00, 0x00, 0x3E, 0xE8, 0x20, 0x00, 0x00, 0x01, 0x6C, 0xFC, 0x61, 0x00,
+    0x00, 0x00, 0x39, 0xEE, 0x90, 0x00, 0x00, 0x00, 0x16, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+003C <
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+003D =
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x40, 0x00, 0x00, 0x00, 0x2C,
+    0xFD, 0x71, 0x00, 0x00, 0x00, 0x28, 0xEF, 0xA4, 0x00, 0x00, 0x00, 0x05,
+    0xAF, 0xC0, 0x00, 0x00, 0x04, 0xAF, 0xC0, 0x00, 0x28, 0xEF, 0xA4, 0x00,
+    0x2C, 0xFD, 0x71, 0x00, 0x00, 0x4A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+003E >
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4B, 0xEE, 0xA2, 0x00, 0x01, 0xA4, 0x13, 0xDC,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0x10, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
+    0x00, 0x09, 0xF5, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0xE9,
+    0x00, 0x00, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x00, 0x02, 0xF5, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF6, 0x00, 0x00, 0x00, 0x03,
+    0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+003F ?
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xDF, 0xD7,
+    0x00, 0x01, 0xDA, 0x30, 0x3C, 0x90, 0x0A, 0xA0, 0x00, 0x02, 0xF1, 0x3E,
+    0x10, 0x5D, 0xE8, 0xE3, 0x7A, 0x02, 0xF5, 0x1A, 0xF3, 0xA7, 0x08, 0xA0,
+    0x02, 0xF3, 0xB6, 0x0B, 0x70, 0x00, 0xE3, 0xB6, 0x0B, 0x70, 0x00, 0xE3,
+    0xA8, 0x08, 0xA0, 0x02, 0xF3, 0x7B, 0x02, 0xE5, 0x1A, 0xF3, 0x2F, 0x20,
+    0x5D, 0xE8, 0xE3, 0x08, 0xC1, 0x00, 0x00, 0x00, 0x00, 0xAC, 0x41, 0x00,
+    0x00, 0x00, 0x05, 0xBE, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0040 @
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFE, 0x00, 0x00, 0x00, 0x09, 0xEF, 0x30,
+    0x00, 0x00, 0x0D, 0x9E, 0x80, 0x00, 0x00, 0x3F, 0x5A, 0xC0, 0x00, 0x00,
+    0x7F, 0x16, 0xF2, 0x00, 0x00, 0xCC, 0x02, 0xF6, 0x00, 0x01, 0xF8, 0x00,
+    0xEB, 0x00, 0x06, 0xF4, 0x00, 0xAF, 0x10, 0x0A, 0xFF, 0xFF, 0xFF, 0x50,
+    0x0E, 0x90, 0x00, 0x1E, 0x90, 0x4F, 0x50, 0x00, 0x0B, 0xD0, 0x8F, 0x10,
+    0x00, 0x06, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0041 A
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0xB3, 0x00, 0x0B, 0xD0, 0x02, 0xAE,
+    0x20, 0x0B, 0xD0, 0x00, 0x3F, 0x60, 0x0B, 0xD0, 0x00, 0x3F, 0x60, 0x0B,
+    0xD0, 0x02, 0xBE, 0x20, 0x0B, 0xFF, 0xFF, 0xD4, 0x00, 0x0B, 0xD0, 0x02,
+    0x9E, 0x30, 0x0B, 0xD0, 0x00, 0x0D, 0xA0, 0x0B, 0xD0, 0x00, 0x0B, 0xD0,
+    0x0B, 0xD0, 0x00, 0x0D, 0xC0, 0x0B, 0xD0, 0x01, 0x8F, 0x60, 0x0B, 0xFF,
+    0xFE, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0042 B
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xCE, 0xD8, 0x10, 0x00, 0x8E, 0x51, 0x3C,
+    0x60, 0x03, 0xF6, 0x00, 0x01, 0x40, 0x09, 0xF1, 0x00, 0x00, 0x00, 0x0C,
+    0xC0, 0x00, 0x00, 0x00, 0x0D, 0xB0, 0x00, 0x00, 0x00, 0x0D, 0xB0, 0x00,
+    0x00, 0x00, 0x0C, 0xC0, 0x00, 0x00, 0x00, 0x09, 0xF1, 0x00, 0x00, 0x00,
+    0x03, 0xF6, 0x00, 0x01, 0x40, 0x00, 0x9E, 0x51, 0x3C, 0x60, 0x00, 0x06,
+    0xCF, 0xD8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0043 C
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0E, 0xFF, 0xEA, 0x40, 0x00, 0x0E, 0xA0, 0x28, 0xF5,
+    0x00, 0x0E, 0xA0, 0x00, 0x9E, 0x10, 0x0E, 0xA0, 0x00, 0x4F, 0x50, 0x0E,
+    0xA0, 0x00, 0x1F, 0x80, 0x0E, 0xA0, 0x00, 0x1F, 0x90, 0x0E, 0xA0, 0x00,
+    0x0F, 0x90, 0x0E, 0xA0, 0x00, 0x1F, 0x80, 0x0E, 0xA0, 0x00, 0x4F, 0x50,
+    0x0E, 0xA0, 0x00, 0x9E, 0x10, 0x0E, 0xA0, 0x28, 0xF5, 0x00, 0x0E, 0xFF,
+    0xEA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0044 D
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x70, 0x07, 0xF2, 0x00, 0x00,
+    0x00, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x07,
+    0xF2, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xF2, 0x00,
+    0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00,
+    0x07, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0045 E
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xA0, 0x03, 0xF6, 0x00, 0x00,
+    0x00, 0x03, 0xF6, 0x00, 0x00, 0x00, 0x03, 0xF6, 0x00, 0x00, 0x00, 0x03,
+    0xF6, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x30, 0x03, 0xF6, 0x00,
+    0x00, 0x00, 0x03, 0xF6, 0x00, 0x00, 0x00, 0x03, 0xF6, 0x00, 0x00, 0x00,
+    0x03, 0xF6, 0x00, 0x00, 0x00, 0x03, 0xF6, 0x00, 0x00, 0x00, 0x03, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0046 F
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0xDF, 0xC6, 0x00, 0x00, 0xCC, 0x30, 0x4D,
+    0x40, 0x07, 0xF2, 0x00, 0x02, 0x30, 0x0D, 0xB0, 0x00, 0x00, 0x00, 0x1F,
+    0x80, 0x00, 0x00, 0x00, 0x3F, 0x70, 0x00, 0x00, 0x00, 0x3F, 0x70, 0x09,
+    0xFF, 0x90, 0x1F, 0x80, 0x00, 0x0D, 0x90, 0x0D, 0xB0, 0x00, 0x0D, 0x90,
+    0x08, 0xF2, 0x00, 0x0D, 0x90, 0x01, 0xCC, 0x30, 0x3E, 0x90, 0x00, 0x18,
+    0xDF, 0xD9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0047 G
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0E, 0xA0, 0x00, 0x0F, 0x80, 0x0E, 0xA0, 0x00, 0x0F,
+    0x80, 0x0E, 0xA0, 0x00, 0x0F, 0x80, 0x0E, 0xA0, 0x00, 0x0F, 0x80, 0x0E,
+    0xA0, 0x00, 0x0F, 0x80, 0x0E, 0xFF, 0xFF, 0xFF, 0x80, 0x0E, 0xA0, 0x00,
+    0x0F, 0x80, 0x0E, 0xA0, 0x00, 0x0F, 0x80, 0x0E, 0xA0, 0x00, 0x0F, 0x80,
+    0x0E, 0xA0, 0x00, 0x0F, 0x80, 0x0E, 0xA0, 0x00, 0x0F, 0x80, 0x0E, 0xA0,
+    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0048 H
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0xF9, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x06, 0xFF,
+    0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0049 I
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x02, 0xF7,
+    0x00, 0x00, 0x00, 0x02, 0xF7, 0x00, 0x00, 0x00, 0x02, 0xF7, 0x00, 0x00,
+    0x00, 0x02, 0xF7, 0x00, 0x00, 0x00, 0x02, 0xF7, 0x00, 0x00, 0x00, 0x02,
+    0xF7, 0x00, 0x00, 0x00, 0x02, 0xF7, 0x00, 0x00, 0x00, 0x02, 0xF6, 0x00,
+    0x24, 0x00, 0x04, 0xF4, 0x00, 0x2F, 0x61, 0x2C, 0xD0, 0x00, 0x05, 0xBE,
+    0xEB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+004A J
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0E, 0xA0, 0x00, 0x1C, 0xD2, 0x0E, 0xA0, 0x01, 0xBE,
+    0x20, 0x0E, 0xA0, 0x0B, 0xE3, 0x00, 0x0E, 0xA0, 0xAE, 0x40, 0x00, 0x0E,
+    0xA8, 0xF4, 0x00, 0x00, 0x0E, 0xEF, 0xF4, 0x00, 0x00, 0x0E, 0xF6, 0xCD,
+    0x10, 0x00, 0x0E, 0xA0, 0x3F, 0x90, 0x00, 0x0E, 0xA0, 0x08, 0xF4, 0x00,
+    0x0E, 0xA0, 0x01, 0xDD, 0x10, 0x0E, 0xA0, 0x00, 0x4F, 0x90, 0x0E, 0xA0,
+    0x00, 0x0A, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+004B K
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00,
+    0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x05,
+    0xF4, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00,
+    0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00,
+    0x05, 0xF4, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x05, 0xFF,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+004C L
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5F, 0xE0, 0x00, 0x5F, 0xE0, 0x5F, 0xE4, 0x00, 0xAE,
+    0xE0, 0x5F, 0xA9, 0x00, 0xEA, 0xE0, 0x5F, 0x5D, 0x04, 0xD8, 0xE0, 0x5F,
+    0x2D, 0x39, 0x88, 0xE0, 0x5F, 0x29, 0x8E, 0x38, 0xE0, 0x5F, 0x24, 0xFD,
+    0x08, 0xE0, 0x5F, 0x20, 0xE8, 0x08, 0xE0, 0x5F, 0x20, 0x00, 0x08, 0xE0,
+    0x5F, 0x20, 0x00, 0x08, 0xE0, 0x5F, 0x20, 0x00, 0x08, 0xE0, 0x5F, 0x20,
+    0x00, 0x08, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+004D M
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0E, 0xF4, 0x00, 0x0F, 0x80, 0x0E, 0xFA, 0x00, 0x0F,
+    0x80, 0x0E, 0xDF, 0x20, 0x0F, 0x80, 0x0E, 0x9D, 0x70, 0x0F, 0x80, 0x0E,
+    0x97, 0xD0, 0x0F, 0x80, 0x0E, 0x91, 0xF4, 0x0F, 0x80, 0x0E, 0x90, 0xAA,
+    0x0F, 0x80, 0x0E, 0x90, 0x4F, 0x1F, 0x80, 0x0E, 0x90, 0x0D, 0x7F, 0x80,
+    0x0E, 0x90, 0x07, 0xDF, 0x80, 0x0E, 0x90, 0x01, 0xFF, 0x80, 0x0E, 0x90,
+    0x00, 0xAF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+004E N
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3C, 0xEE, 0x91, 0x00, 0x02, 0xE9, 0x12, 0xDB,
+    0x00, 0x09, 0xE0, 0x00, 0x5F, 0x30, 0x0D, 0xB0, 0x00, 0x1F, 0x70, 0x0F,
+    0x90, 0x00, 0x0F, 0xA0, 0x1F, 0x90, 0x00, 0x0E, 0xA0, 0x1F, 0x90, 0x00,
+    0x0E, 0xA0, 0x0F, 0x90, 0x00, 0x0F, 0xA0, 0x0D, 0xB0, 0x00, 0x1F, 0x70,
+    0x09, 0xE0, 0x00, 0x5F, 0x30, 0x02, 0xE9, 0x12, 0xDB, 0x00, 0x00, 0x3C,
+    0xFE, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+004F O
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0xC5, 0x00, 0x07, 0xF2, 0x01, 0x9F,
+    0x60, 0x07, 0xF2, 0x00, 0x0E, 0xC0, 0x07, 0xF2, 0x00, 0x0C, 0xD0, 0x07,
+    0xF2, 0x00, 0x0E, 0xB0, 0x07, 0xF2, 0x01, 0x9F, 0x50, 0x07, 0xFF, 0xFE,
+    0xC5, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00,
+    0x07, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xF2,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0050 P
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3C, 0xEE, 0x91, 0x00, 0x02, 0xE9, 0x12, 0xDB,
+    0x00, 0x09, 0xE0, 0x00, 0x5F, 0x30, 0x0D, 0xB0, 0x00, 0x1F, 0x70, 0x0F,
+    0x90, 0x00, 0x0F, 0x90, 0x1F, 0x90, 0x00, 0x0E, 0xA0, 0x1F, 0x90, 0x00,
+    0x0E, 0xA0, 0x0F, 0x90, 0x00, 0x0F, 0x90, 0x0D, 0xB0, 0x00, 0x1F, 0x70,
+    0x09, 0xE0, 0x00, 0x5F, 0x40, 0x02, 0xE9, 0x12, 0xDB, 0x00, 0x00, 0x3C,
+    0xFF, 0xD1, 0x00, 0x00, 0x00, 0x06, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x89,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0051 Q
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFD, 0x81, 0x00, 0x0D, 0xB0, 0x04, 0xEB,
+    0x00, 0x0D, 0xB0, 0x00, 0x8F, 0x30, 0x0D, 0xB0, 0x00, 0x5F, 0x50, 0x0D,
+    0xB0, 0x00, 0x7F, 0x30, 0x0D, 0xB0, 0x04, 0xEA, 0x00, 0x0D, 0xFF, 0xFF,
+    0x80, 0x00, 0x0D, 0xB0, 0x17, 0xF4, 0x00, 0x0D, 0xB0, 0x00, 0xBD, 0x00,
+    0x0D, 0xB0, 0x00, 0x3F, 0x60, 0x0D, 0xB0, 0x00, 0x0B, 0xD0, 0x0D, 0xB0,
+    0x00, 0x04, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0052 R
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4B, 0xEE, 0xA3, 0x00, 0x05, 0xF7, 0x11, 0x9E,
+    0x00, 0x0C, 0xB0, 0x00, 0x06, 0x00, 0x0D, 0xA0, 0x00, 0x00, 0x00, 0x0A,
+    0xE3, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xC8, 0x30, 0x00, 0x00, 0x04, 0x8C,
+    0xFA, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x50, 0x00, 0x00, 0x00, 0x0F, 0x80,
+    0x07, 0x00, 0x00, 0x1F, 0x70, 0x0C, 0xC4, 0x02, 0xBE, 0x20, 0x02, 0x9D,
+    0xFD, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0053 S
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xF9, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0054 T
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0D, 0xB0, 0x00, 0x1F, 0x70, 0x0D, 0xB0, 0x00, 0x1F,
+    0x70, 0x0D, 0xB0, 0x00, 0x1F, 0x70, 0x0D, 0xB0, 0x00, 0x1F, 0x70, 0x0D,
+    0xB0, 0x00, 0x1F, 0x70, 0x0D, 0xB0, 0x00, 0x1F, 0x70, 0x0D, 0xB0, 0x00,
+    0x1F, 0x70, 0x0D, 0xB0, 0x00, 0x1F, 0x70, 0x0C, 0xB0, 0x00, 0x1F, 0x70,
+    0x0A, 0xC0, 0x00, 0x3F, 0x50, 0x05, 0xF7, 0x12, 0xBE, 0x10, 0x00, 0x5C,
+    0xEE, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0055 U
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x09, 0xF1, 0x2F, 0x70, 0x00, 0x0C,
+    0xB0, 0x0D, 0xB0, 0x00, 0x1F, 0x70, 0x08, 0xE0, 0x00, 0x5F, 0x30, 0x04,
+    0xF3, 0x00, 0x9E, 0x00, 0x00, 0xE7, 0x00, 0xD9, 0x00, 0x00, 0xBB, 0x02,
+    0xF5, 0x00, 0x00, 0x6F, 0x06, 0xF1, 0x00, 0x00, 0x2F, 0x4A, 0xC0, 0x00,
+    0x00, 0x0D, 0x8D, 0x70, 0x00, 0x00, 0x09, 0xDF, 0x30, 0x00, 0x00, 0x04,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0056 V
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0xE8, 0xCB, 0x00, 0x00, 0x01,
+    0xF6, 0xAD, 0x00, 0x00, 0x03, 0xF4, 0x7E, 0x02, 0xFB, 0x05, 0xF2, 0x5F,
+    0x15, 0xFE, 0x06, 0xF0, 0x3F, 0x38, 0xAF, 0x28, 0xD0, 0x1F, 0x4B, 0x6C,
+    0x5A, 0xA0, 0x0E, 0x6E, 0x39, 0x8C, 0x80, 0x0B, 0x9E, 0x05, 0xBD, 0x60,
+    0x09, 0xEC, 0x02, 0xEF, 0x40, 0x07, 0xF8, 0x00, 0xEF, 0x20, 0x05, 0xF5,
+    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0057 W
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1E, 0xA0, 0x00, 0x0B, 0xD1, 0x06, 0xF3, 0x00, 0x5F,
+    0x50, 0x00, 0xCC, 0x00, 0xDA, 0x00, 0x00, 0x4F, 0x57, 0xE2, 0x00, 0x00,
+    0x0A, 0xDE, 0x70, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0x40, 0x00, 0x00, 0x2E, 0x8A, 0xC0, 0x00, 0x00, 0xBD, 0x12, 0xF6, 0x00,
+    0x05, 0xF5, 0x00, 0x9E, 0x10, 0x1D, 0xB0, 0x00, 0x1E, 0x90, 0x8F, 0x20,
+    0x00, 0x07, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0058 X
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x6F, 0x40, 0x00, 0x09, 0xE2, 0x0D, 0xC0, 0x00, 0x2F,
+    0x70, 0x04, 0xF5, 0x00, 0xAD, 0x10, 0x00, 0xBD, 0x03, 0xF5, 0x00, 0x00,
+    0x3F, 0x6B, 0xC0, 0x00, 0x00, 0x09, 0xEF, 0x40, 0x00, 0x00, 0x01, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0059 Y
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F,
+    0xC0, 0x00, 0x00, 0x00, 0xBF, 0x30, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00,
+    0x00, 0x1E, 0xD1, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x00, 0x00, 0x03, 0xFA,
+    0x00, 0x00, 0x00, 0x0C, 0xE2, 0x00, 0x00, 0x00, 0x6F, 0x70, 0x00, 0x00,
+    0x01, 0xEC, 0x00, 0x00, 0x00, 0x09, 0xF3, 0x00, 0x00, 0x00, 0x0C, 0xFF,
+    0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+005A Z
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x06, 0xF1, 0x00,
+    0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00,
+    0x06, 0xF1, 0x00, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x06, 0xF1,
+    0x00, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00,
+    0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x06,
+    0xF1, 0x00, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+005B [
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1E, 0x80, 0x00, 0x00, 0x00, 0x07, 0xE1, 0x00, 0x00,
+    0x00, 0x01, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x10, 0x00, 0x00, 0x00,
+    0x2F, 0x60, 0x00, 0x00, 0x00, 0x09, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF5,
+    0x00, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x50, 0x00,
+    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
+    0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+005C
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00,
+    0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00,
+    0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x6F,
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00,
+    0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00,
+    0x6F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+005D ]
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xFD, 0x10, 0x00, 0x00, 0x4F, 0x8C, 0xC1,
+    0x00, 0x03, 0xE7, 0x01, 0xCB, 0x00, 0x2D, 0x70, 0x00, 0x1C, 0x90, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+005E ^
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, // U+005F _
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E,
+    0x20, 0x00, 0x00, 0x00, 0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0060 `
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xEE, 0xA2, 0x00, 0x04,
+    0x93, 0x02, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x30, 0x00, 0x6C, 0xEF,
+    0xFF, 0x40, 0x07, 0xE5, 0x10, 0x3F, 0x40, 0x0D, 0x90, 0x00, 0x5F, 0x40,
+    0x0D, 0x80, 0x00, 0x9F, 0x40, 0x09, 0xE3, 0x16, 0xEF, 0x40, 0x01, 0x9E,
+    0xEB, 0x5F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0061 a
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
+    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xE5, 0xDF, 0xB3, 0x00, 0x07,
+    0xFC, 0x22, 0xBD, 0x00, 0x07, 0xF4, 0x00, 0x2F, 0x60, 0x07, 0xF1, 0x00,
+    0x0E, 0x90, 0x07, 0xF0, 0x00, 0x0D, 0xA0, 0x07, 0xF1, 0x00, 0x0E, 0x80,
+    0x07, 0xF4, 0x00, 0x2F, 0x60, 0x07, 0xFC, 0x22, 0xBD, 0x00, 0x07, 0xE6,
+    0xDF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0062 b
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xCF, 0xD8, 0x00, 0x00,
+    0x8E, 0x61, 0x26, 0x40, 0x02, 0xF7, 0x00, 0x00, 0x00, 0x06, 0xF2, 0x00,
+    0x00, 0x00, 0x07, 0xF1, 0x00, 0x00, 0x00, 0x06, 0xF3, 0x00, 0x00, 0x00,
+    0x02, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x61, 0x26, 0x40, 0x00, 0x06,
+    0xCF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0063 c
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x20, 0x00, 0x00, 0x00, 0x4F,
+    0x20, 0x00, 0x00, 0x00, 0x4F, 0x20, 0x00, 0x6D, 0xFC, 0x7F, 0x20, 0x04,
+    0xF7, 0x15, 0xEF, 0x20, 0x0B, 0xC0, 0x00, 0x9F, 0x20, 0x0E, 0x90, 0x00,
+    0x6F, 0x20, 0x0F, 0x80, 0x00, 0x5F, 0x20, 0x0E, 0x90, 0x00, 0x6F, 0x20,
+    0x0B, 0xC0, 0x00, 0x9F, 0x20, 0x04, 0xF6, 0x15, 0xEF, 0x20, 0x00, 0x6D,
+    0xFC, 0x7F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0064 d
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xEE, 0xB2, 0x00, 0x02,
+    0xEA, 0x21, 0xAD, 0x00, 0x0A, 0xD0, 0x00, 0x1E, 0x60, 0x0E, 0x90, 0x00,
+    0x0C, 0x90, 0x0F, 0xFF, 0xFF, 0xFF, 0xA0, 0x0E, 0x80, 0x00, 0x00, 0x00,
+    0x0A, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xE9, 0x21, 0x39, 0x50, 0x00, 0x3A,
+    0xEE, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0065 e
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF, 0x50, 0x00, 0x00, 0xE8, 0x00,
+    0x00, 0x00, 0x02, 0xF5, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x50, 0x00,
+    0x02, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF4,
+    0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
+    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x02,
+    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0066 f
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFC, 0x7F, 0x20, 0x04,
+    0xF7, 0x15, 0xEF, 0x20, 0x0B, 0xC0, 0x00, 0x9F, 0x20, 0x0E, 0x90, 0x00,
+    0x6F, 0x20, 0x0F, 0x80, 0x00, 0x5F, 0x20, 0x0E, 0x90, 0x00, 0x6F, 0x20,
+    0x0B, 0xC0, 0x00, 0x9F, 0x20, 0x04, 0xF7, 0x14, 0xEF, 0x20, 0x00, 0x6D,
+    0xFC, 0x7F, 0x20, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x01, 0xA3, 0x13, 0xD9,
+    0x00, 0x00, 0x5C, 0xED, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0067 g
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
+    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0xCF, 0xC3, 0x00, 0x07,
+    0xFB, 0x21, 0xCD, 0x00, 0x07, 0xF3, 0x00, 0x5F, 0x20, 0x07, 0xF0, 0x00,
+    0x4F, 0x30, 0x07, 0xF0, 0x00, 0x4F, 0x30, 0x07, 0xF0, 0x00, 0x4F, 0x30,
+    0x07, 0xF0, 0x00, 0x4F, 0x30, 0x07, 0xF0, 0x00, 0x4F, 0x30, 0x07, 0xF0,
+    0x00, 0x4F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0068 h
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+    0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, 0xBA,
+    0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00,
+    0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x09, 0xFF,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0069 i
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x00, 0x5F, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x20, 0x00, 0x00,
+    0x00, 0x5F, 0x20, 0x00, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x00, 0x5F,
+    0x20, 0x00, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x00, 0x5F, 0x20, 0x00,
+    0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x00,
+    0x5F, 0x20, 0x00, 0x00, 0x00, 0x6F, 0x10, 0x00, 0x00, 0x01, 0xBC, 0x00,
+    0x00, 0x08, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+006A j
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0xF5, 0x00, 0x00, 0x00, 0x02, 0xF5, 0x00, 0x00,
+    0x00, 0x02, 0xF5, 0x00, 0x00, 0x00, 0x02, 0xF5, 0x00, 0x6F, 0x50, 0x02,
+    0xF5, 0x06, 0xF5, 0x00, 0x02, 0xF5, 0x6F, 0x50, 0x00, 0x02, 0xFB, 0xF9,
+    0x00, 0x00, 0x02, 0xFF, 0xAF, 0x30, 0x00, 0x02, 0xF6, 0x0C, 0xD1, 0x00,
+    0x02, 0xF5, 0x02, 0xE9, 0x00, 0x02, 0xF5, 0x00, 0x6F, 0x50, 0x02, 0xF5,
+    0x00, 0x0B, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+006B k
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
+    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
+    0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0,
+    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
+    0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x02, 0xF7, 0x00, 0x00, 0x00, 0x00,
+    0x6D, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+006C l
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xAE, 0xC6, 0xED, 0x30, 0x2F,
+    0x72, 0xFC, 0x1A, 0xA0, 0x2F, 0x30, 0xD8, 0x07, 0xC0, 0x2F, 0x20, 0xC8,
+    0x07, 0xD0, 0x2F, 0x20, 0xC8, 0x07, 0xD0, 0x2F, 0x20, 0xC8, 0x07, 0xD0,
+    0x2F, 0x20, 0xC8, 0x07, 0xD0, 0x2F, 0x20, 0xC8, 0x07, 0xD0, 0x2F, 0x20,
+    0xC8, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+006D m
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0xCF, 0xC3, 0x00, 0x07,
+    0xFB, 0x21, 0xCD, 0x00, 0x07, 0xF3, 0x00, 0x5F, 0x20, 0x07, 0xF0, 0x00,
+    0x4F, 0x30, 0x07, 0xF0, 0x00, 0x4F, 0x30, 0x07, 0xF0, 0x00, 0x4F, 0x30,
+    0x07, 0xF0, 0x00, 0x4F, 0x30, 0x07, 0xF0, 0x00, 0x4F, 0x30, 0x07, 0xF0,
+    0x00, 0x4F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+006E n
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xFE, 0xA1, 0x00, 0x03,
+    0xF9, 0x13, 0xDC, 0x00, 0x0A, 0xE0, 0x00, 0x4F, 0x40, 0x0D, 0xA0, 0x00,
+    0x1F, 0x70, 0x0E, 0x90, 0x00, 0x0F, 0x80, 0x0D, 0xA0, 0x00, 0x1F, 0x70,
+    0x0A, 0xE0, 0x00, 0x4F, 0x40, 0x03, 0xF9, 0x13, 0xDC, 0x00, 0x00, 0x4C,
+    0xFE, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+006F o
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xE6, 0xDF, 0xB2, 0x00, 0x08,
+    0xFC, 0x22, 0xBD, 0x00, 0x08, 0xF4, 0x00, 0x2F, 0x50, 0x08, 0xF0, 0x00,
+    0x0E, 0x80, 0x08, 0xE0, 0x00, 0x0D, 0x90, 0x08, 0xF0, 0x00, 0x0E, 0x80,
+    0x08, 0xF4, 0x00, 0x2F, 0x50, 0x08, 0xFC, 0x22, 0xBD, 0x00, 0x08, 0xE7,
+    0xDF, 0xB2, 0x00, 0x08, 0xE0, 0x00, 0x00, 0x00, 0x08, 0xE0, 0x00, 0x00,
+    0x00, 0x08, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0070 p
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFC, 0x7F, 0x40, 0x02,
+    0xF8, 0x14, 0xEF, 0x40, 0x09, 0xD0, 0x00, 0x8F, 0x40, 0x0C, 0xA0, 0x00,
+    0x4F, 0x40, 0x0D, 0x90, 0x00, 0x3F, 0x40, 0x0C, 0xA0, 0x00, 0x4F, 0x40,
+    0x09, 0xD0, 0x00, 0x8F, 0x40, 0x03, 0xF8, 0x14, 0xEF, 0x40, 0x00, 0x5D,
+    0xFC, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F,
+    0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0071 q
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x48, 0xEE, 0x70, 0x00,
+    0x3F, 0xC8, 0x22, 0x80, 0x00, 0x3F, 0xB0, 0x00, 0x00, 0x00, 0x3F, 0x60,
+    0x00, 0x00, 0x00, 0x3F, 0x50, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
+    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0072 r
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xEE, 0x92, 0x00, 0x01,
+    0xE9, 0x11, 0x57, 0x00, 0x04, 0xF3, 0x00, 0x00, 0x00, 0x02, 0xFB, 0x41,
+    0x00, 0x00, 0x00, 0x4C, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x15, 0xDD, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x05, 0x93, 0x12, 0xCB, 0x00, 0x00, 0x6C,
+    0xED, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0073 s
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xC0, 0x00,
+    0x00, 0x00, 0x0A, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x10, 0x00,
+    0x0A, 0xC0, 0x00, 0x00, 0x00, 0x0A, 0xC0, 0x00, 0x00, 0x00, 0x0A, 0xC0,
+    0x00, 0x00, 0x00, 0x0A, 0xC0, 0x00, 0x00, 0x00, 0x0A, 0xC0, 0x00, 0x00,
+    0x00, 0x09, 0xD0, 0x00, 0x00, 0x00, 0x06, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x9E, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0074 t
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x4F, 0x30, 0x07,
+    0xF0, 0x00, 0x4F, 0x30, 0x07, 0xF0, 0x00, 0x4F, 0x30, 0x07, 0xF0, 0x00,
+    0x4F, 0x30, 0x07, 0xF0, 0x00, 0x4F, 0x30, 0x07, 0xF0, 0x00, 0x4F, 0x30,
+    0x06, 0xF1, 0x00, 0x7F, 0x30, 0x02, 0xF8, 0x13, 0xDF, 0x30, 0x00, 0x6D,
+    0xFB, 0x6F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0075 u
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x70, 0x00, 0x0C, 0xA0, 0x0B,
+    0xC0, 0x00, 0x2F, 0x50, 0x05, 0xF2, 0x00, 0x7E, 0x10, 0x01, 0xE7, 0x00,
+    0xCA, 0x00, 0x00, 0xAC, 0x02, 0xF5, 0x00, 0x00, 0x5F, 0x27, 0xE0, 0x00,
+    0x00, 0x0E, 0x7D, 0x90, 0x00, 0x00, 0x09, 0xEF, 0x40, 0x00, 0x00, 0x04,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0076 v
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0x00, 0x00, 0x00, 0xD8, 0xAB,
+    0x00, 0x00, 0x01, 0xF4, 0x7E, 0x00, 0x00, 0x05, 0xF1, 0x3F, 0x20, 0xE8,
+    0x08, 0xD0, 0x0E, 0x53, 0xDD, 0x0B, 0x90, 0x0B, 0x88, 0x7D, 0x2E, 0x60,
+    0x08, 0xCC, 0x38, 0x9F, 0x20, 0x04, 0xFD, 0x04, 0xFE, 0x00, 0x01, 0xF9,
+    0x00, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0077 w
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x4F, 0x60, 0x01,
+    0xE9, 0x01, 0xDA, 0x00, 0x00, 0x4F, 0x4A, 0xD1, 0x00, 0x00, 0x08, 0xEF,
+    0x30, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0C, 0xCE, 0x70, 0x00,
+    0x00, 0x9E, 0x26, 0xF3, 0x00, 0x05, 0xF5, 0x00, 0xAD, 0x10, 0x2E, 0x90,
+    0x00, 0x1E, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0078 x
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x80, 0x00, 0x0B, 0xC0, 0x09,
+    0xD0, 0x00, 0x1F, 0x70, 0x03, 0xF4, 0x00, 0x6F, 0x10, 0x00, 0xC9, 0x00,
+    0xCA, 0x00, 0x00, 0x7E, 0x12, 0xF4, 0x00, 0x00, 0x1F, 0x68, 0xD0, 0x00,
+    0x00, 0x0A, 0xBD, 0x80, 0x00, 0x00, 0x04, 0xFF, 0x20, 0x00, 0x00, 0x00,
+    0xEB, 0x00, 0x00, 0x00, 0x02, 0xF5, 0x00, 0x00, 0x00, 0x1A, 0xD0, 0x00,
+    0x00, 0x08, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0079 y
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x20, 0x00,
+    0x00, 0x00, 0xBE, 0x10, 0x00, 0x00, 0x08, 0xF4, 0x00, 0x00, 0x00, 0x4F,
+    0x80, 0x00, 0x00, 0x02, 0xEB, 0x00, 0x00, 0x00, 0x0C, 0xE1, 0x00, 0x00,
+    0x00, 0x9F, 0x40, 0x00, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x00, 0x06, 0xFF,
+    0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+007A z
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xEE, 0x00, 0x00, 0x00, 0xAD, 0x20,
+    0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x00, 0x00, 0x00,
+    0x00, 0xD9, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x16, 0xF5,
+    0x00, 0x00, 0x04, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x16, 0xF5, 0x00, 0x00,
+    0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x00, 0x00, 0x00, 0x00,
+    0xD9, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x00, 0x00, 0xAD, 0x20,
+    0x00, 0x00, 0x00, 0x3B, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+007B {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00,
+    0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00,
+    0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7,
+    0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00,
+    0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00,
+    0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00,
+    0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, // U+007C |
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xAD,
+    0x30, 0x00, 0x00, 0x00, 0x2D, 0xFE, 0x00, 0x00, 0x00, 0xAD, 0x20, 0x00,
+    0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00, 0x00,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00,
+    0x00, 0x04, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+007D }
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xDE, 0xA5,
+    0x13, 0xA0, 0x47, 0x21, 0x6B, 0xEC, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+007E ~
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xED, 0x40, 0x00, 0x00, 0x6B, 0x14, 0xE1,
+    0x00, 0x00, 0x96, 0x00, 0xB4, 0x00, 0x00, 0x6B, 0x14, 0xE1, 0x00, 0x00,
+    0x09, 0xED, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00B0 °
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00,
+    0x00, 0xD7, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xD7,
+    0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00B1 ±
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x4F, 0x30, 0x07,
+    0xF0, 0x00, 0x4F, 0x30, 0x07, 0xF0, 0x00, 0x4F, 0x30, 0x07, 0xF0, 0x00,
+    0x4F, 0x30, 0x07, 0xF0, 0x00, 0x4F, 0x30, 0x07, 0xF0, 0x00, 0x4F, 0x30,
+    0x07, 0xF1, 0x00, 0x6F, 0x30, 0x07, 0xF9, 0x13, 0xDF, 0x50, 0x07, 0xD9,
+    0xED, 0x6B, 0xE3, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
+    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00B5 µ
+    0x00, 0x8F, 0x17, 0xF2, 0x00, 0x00, 0x8F, 0x17, 0xF2, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFE, 0x00, 0x00, 0x00, 0x09, 0xEF, 0x30,
+    0x00, 0x00, 0x0D, 0x9E, 0x80, 0x00, 0x00, 0x3F, 0x5A, 0xC0, 0x00, 0x00,
+    0x7F, 0x16, 0xF2, 0x00, 0x00, 0xCC, 0x02, 0xF6, 0x00, 0x01, 0xF8, 0x00,
+    0xEB, 0x00, 0x06, 0xF4, 0x00, 0xAF, 0x10, 0x0A, 0xFF, 0xFF, 0xFF, 0x50,
+    0x0E, 0x90, 0x00, 0x1E, 0x90, 0x4F, 0x50, 0x00, 0x0B, 0xD0, 0x8F, 0x10,
+    0x00, 0x06, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00C4 Ä
+    0x00, 0x8F, 0x17, 0xF2, 0x00, 0x00, 0x8F, 0x17, 0xF2, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3C, 0xEE, 0x91, 0x00, 0x02, 0xE9, 0x12, 0xDB,
+    0x00, 0x09, 0xE0, 0x00, 0x5F, 0x30, 0x0D, 0xB0, 0x00, 0x1F, 0x70, 0x0F,
+    0x90, 0x00, 0x0F, 0xA0, 0x1F, 0x90, 0x00, 0x0E, 0xA0, 0x1F, 0x90, 0x00,
+    0x0E, 0xA0, 0x0F, 0x90, 0x00, 0x0F, 0xA0, 0x0D, 0xB0, 0x00, 0x1F, 0x70,
+    0x09, 0xE0, 0x00, 0x5F, 0x30, 0x02, 0xE9, 0x12, 0xDB, 0x00, 0x00, 0x3C,
+    0xFE, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00D6 Ö
+    0x00, 0x8F, 0x17, 0xF2, 0x00, 0x00, 0x8F, 0x17, 0xF2, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0D, 0xB0, 0x00, 0x1F, 0x70, 0x0D, 0xB0, 0x00, 0x1F,
+    0x70, 0x0D, 0xB0, 0x00, 0x1F, 0x70, 0x0D, 0xB0, 0x00, 0x1F, 0x70, 0x0D,
+    0xB0, 0x00, 0x1F, 0x70, 0x0D, 0xB0, 0x00, 0x1F, 0x70, 0x0D, 0xB0, 0x00,
+    0x1F, 0x70, 0x0D, 0xB0, 0x00, 0x1F, 0x70, 0x0C, 0xB0, 0x00, 0x1F, 0x70,
+    0x0A, 0xC0, 0x00, 0x3F, 0x50, 0x05, 0xF7, 0x12, 0xBE, 0x10, 0x00, 0x5C,
+    0xEE, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00DC Ü
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0xED, 0x91, 0x00, 0x02, 0xF8, 0x12, 0xD9,
+    0x00, 0x07, 0xF0, 0x00, 0x7E, 0x00, 0x08, 0xE0, 0x1B, 0xC7, 0x00, 0x08,
+    0xE0, 0x9C, 0x00, 0x00, 0x08, 0xE0, 0xD9, 0x00, 0x00, 0x08, 0xE0, 0x9F,
+    0x50, 0x00, 0x08, 0xE0, 0x1A, 0xFA, 0x10, 0x08, 0xE0, 0x00, 0x5E, 0xA0,
+    0x08, 0xE0, 0x00, 0x08, 0xE0, 0x08, 0xE0, 0x00, 0x2C, 0xB0, 0x08, 0xE6,
+    0xFF, 0xEA, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00DF ß
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0x17, 0xF2, 0x00, 0x00, 0x8F, 0x17, 0xF2,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xEE, 0xA2, 0x00, 0x04,
+    0x93, 0x02, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x30, 0x00, 0x6C, 0xEF,
+    0xFF, 0x40, 0x07, 0xE5, 0x10, 0x3F, 0x40, 0x0D, 0x90, 0x00, 0x5F, 0x40,
+    0x0D, 0x80, 0x00, 0x9F, 0x40, 0x09, 0xE3, 0x16, 0xEF, 0x40, 0x01, 0x9E,
+    0xEB, 0x5F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00E4 ä
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xED, 0x40, 0x00, 0x00, 0x3C,
+    0x14, 0xD0, 0x00, 0x00, 0x3C, 0x14, 0xD0, 0x00, 0x00, 0x08, 0xED, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xEE, 0xA2, 0x00, 0x04,
+    0x93, 0x02, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x30, 0x00, 0x6C, 0xEF,
+    0xFF, 0x40, 0x07, 0xE5, 0x10, 0x3F, 0x40, 0x0D, 0x90, 0x00, 0x5F, 0x40,
+    0x0D, 0x80, 0x00, 0x9F, 0x40, 0x09, 0xE3, 0x16, 0xEF, 0x40, 0x01, 0x9E,
+    0xEB, 0x5F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00E5 å
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xCF, 0xD8, 0x00, 0x00,
+    0x8E, 0x61, 0x26, 0x40, 0x02, 0xF7, 0x00, 0x00, 0x00, 0x06, 0xF2, 0x00,
+    0x00, 0x00, 0x07, 0xF1, 0x00, 0x00, 0x00, 0x06, 0xF3, 0x00, 0x00, 0x00,
+    0x02, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x61, 0x26, 0x40, 0x00, 0x06,
+    0xCF, 0xD8, 0x00, 0x00, 0x00, 0x05, 0xA0, 0x00, 0x00, 0x00, 0x02, 0xF1,
+    0x00, 0x00, 0x01, 0xEF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00E7 ç
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0x30, 0x00, 0x00, 0x00, 0x07, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x9A, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xEE, 0xB2, 0x00, 0x02,
+    0xEA, 0x21, 0xAD, 0x00, 0x0A, 0xD0, 0x00, 0x1E, 0x60, 0x0E, 0x90, 0x00,
+    0x0C, 0x90, 0x0F, 0xFF, 0xFF, 0xFF, 0xA0, 0x0E, 0x80, 0x00, 0x00, 0x00,
+    0x0A, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xE9, 0x21, 0x39, 0x50, 0x00, 0x3A,
+    0xEE, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00E8 è
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xE3, 0x00, 0x00, 0x00, 0x2E, 0x50, 0x00, 0x00, 0x00, 0xC7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xEE, 0xB2, 0x00, 0x02,
+    0xEA, 0x21, 0xAD, 0x00, 0x0A, 0xD0, 0x00, 0x1E, 0x60, 0x0E, 0x90, 0x00,
+    0x0C, 0x90, 0x0F, 0xFF, 0xFF, 0xFF, 0xA0, 0x0E, 0x80, 0x00, 0x00, 0x00,
+    0x0A, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xE9, 0x21, 0x39, 0x50, 0x00, 0x3A,
+    0xEE, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00E9 é
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xEC, 0x00, 0x00, 0x00, 0x09, 0x9B, 0x70, 0x00, 0x00, 0x4D, 0x12, 0xD2,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xEE, 0xB2, 0x00, 0x02,
+    0xEA, 0x21, 0xAD, 0x00, 0x0A, 0xD0, 0x00, 0x1E, 0x60, 0x0E, 0x90, 0x00,
+    0x0C, 0x90, 0x0F, 0xFF, 0xFF, 0xFF, 0xA0, 0x0E, 0x80, 0x00, 0x00, 0x00,
+    0x0A, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xE9, 0x21, 0x39, 0x50, 0x00, 0x3A,
+    0xEE, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00EA ê
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4E, 0xB1, 0xB5, 0x00, 0x00, 0xA5, 0x4D, 0xC1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0xCF, 0xC3, 0x00, 0x07,
+    0xFB, 0x21, 0xCD, 0x00, 0x07, 0xF3, 0x00, 0x5F, 0x20, 0x07, 0xF0, 0x00,
+    0x4F, 0x30, 0x07, 0xF0, 0x00, 0x4F, 0x30, 0x07, 0xF0, 0x00, 0x4F, 0x30,
+    0x07, 0xF0, 0x00, 0x4F, 0x30, 0x07, 0xF0, 0x00, 0x4F, 0x30, 0x07, 0xF0,
+    0x00, 0x4F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00F1 ñ
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0x17, 0xF2, 0x00, 0x00, 0x8F, 0x17, 0xF2,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xFE, 0xA1, 0x00, 0x03,
+    0xF9, 0x13, 0xDC, 0x00, 0x0A, 0xE0, 0x00, 0x4F, 0x40, 0x0D, 0xA0, 0x00,
+    0x1F, 0x70, 0x0E, 0x90, 0x00, 0x0F, 0x80, 0x0D, 0xA0, 0x00, 0x1F, 0x70,
+    0x0A, 0xE0, 0x00, 0x4F, 0x40, 0x03, 0xF9, 0x13, 0xDC, 0x00, 0x00, 0x4C,
+    0xFE, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00F6 ö
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x4C, 0xFE, 0xA8, 0xB0, 0x03,
+    0xF8, 0x13, 0xDF, 0x10, 0x09, 0xD0, 0x03, 0xEF, 0x50, 0x0D, 0xA0, 0x1D,
+    0x4F, 0x70, 0x0E, 0x90, 0xC6, 0x0F, 0x80, 0x0D, 0xA9, 0x90, 0x1F, 0x70,
+    0x0A, 0xEC, 0x00, 0x4F, 0x40, 0x07, 0xF9, 0x13, 0xDC, 0x00, 0x3D, 0x6C,
+    0xEE, 0xA1, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00F8 ø
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0x17, 0xF2, 0x00, 0x00, 0x8F, 0x17, 0xF2,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x4F, 0x30, 0x07,
+    0xF0, 0x00, 0x4F, 0x30, 0x07, 0xF0, 0x00, 0x4F, 0x30, 0x07, 0xF0, 0x00,
+    0x4F, 0x30, 0x07, 0xF0, 0x00, 0x4F, 0x30, 0x07, 0xF0, 0x00, 0x4F, 0x30,
+    0x06, 0xF1, 0x00, 0x7F, 0x30, 0x02, 0xF8, 0x13, 0xDF, 0x30, 0x00, 0x6D,
+    0xFB, 0x6F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00FC ü
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xD1, 0x00, 0x00,
+    0x00, 0x01, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x50, 0x00, 0x00, 0x00,
+    0x09, 0xE2, 0x00, 0x00, 0x00, 0x01, 0xDC, 0x00, 0x00, 0x00, 0x01, 0xDC,
+    0x00, 0x00, 0x00, 0x09, 0xE2, 0x00, 0x00, 0x00, 0x4F, 0x50, 0x00, 0x00,
+    0x01, 0xEA, 0x00, 0x00, 0x00, 0x0B, 0xD1, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+03A3 Σ
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xFE, 0x91,
+    0x00, 0x04, 0xF7, 0x12, 0xBC, 0x00, 0x0C, 0xB0, 0x00, 0x2F, 0x60, 0x2F,
+    0x60, 0x00, 0x0B, 0xB0, 0x4F, 0x40, 0x00, 0x09, 0xE0, 0x5F, 0x40, 0x00,
+    0x09, 0xE0, 0x3F, 0x50, 0x00, 0x0B, 0xD0, 0x0E, 0x90, 0x00, 0x0E, 0x90,
+    0x08, 0xE1, 0x00, 0x5F, 0x30, 0x01, 0xDA, 0x02, 0xD8, 0x00, 0x6F, 0xFF,
+    0x38, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+03A9 Ω
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xD8, 0x06, 0x80, 0x09,
+    0xF6, 0x7F, 0x6D, 0x60, 0x2F, 0x80, 0x08, 0xEF, 0x10, 0x6F, 0x30, 0x04,
+    0xFB, 0x00, 0x7F, 0x10, 0x01, 0xF6, 0x00, 0x5F, 0x20, 0x03, 0xF5, 0x00,
+    0x3F, 0x50, 0x08, 0xF8, 0x00, 0x0C, 0xD2, 0x3E, 0xCE, 0x40, 0x02, 0xDF,
+    0xFA, 0x1B, 0xF2, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+03B1 α
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x32, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC2, 0x00, 0x07, 0xF8, 0x46, 0xEA,
+    0x00, 0x0B, 0xC0, 0x00, 0x8D, 0x00, 0x0C, 0xA0, 0x00, 0x9D, 0x00, 0x0C,
+    0xA0, 0x05, 0xF8, 0x00, 0x0C, 0xA4, 0xEF, 0xD1, 0x00, 0x0C, 0xA2, 0x79,
+    0xED, 0x20, 0x0C, 0xA0, 0x00, 0x2E, 0x90, 0x0C, 0xA0, 0x00, 0x0B, 0xB0,
+    0x0C, 0xC0, 0x00, 0x0D, 0x90, 0x0C, 0xFD, 0x86, 0xBF, 0x30, 0x0C, 0xDD,
+    0xFF, 0xD5, 0x00, 0x0C, 0xA0, 0x21, 0x00, 0x00, 0x0C, 0xA0, 0x00, 0x00,
+    0x00, 0x0C, 0xA0, 0x00, 0x00, 0x00, 0x04, 0x30, 0x00, 0x00, 0x00, // U+03B2 β
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x20, 0x00, 0x09, 0x80, 0x6D,
+    0xB0, 0x00, 0x2F, 0x60, 0x04, 0xF2, 0x00, 0x7E, 0x10, 0x00, 0xE8, 0x00,
+    0xDA, 0x00, 0x00, 0x8D, 0x04, 0xF4, 0x00, 0x00, 0x3F, 0x49, 0xD0, 0x00,
+    0x00, 0x0C, 0xAE, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x20, 0x00, 0x00, 0x02,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00,
+    0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, // U+03B3 γ
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x34, 0x20, 0x00, 0x00, 0x7E, 0xFF, 0xF6, 0x00, 0x03, 0xFA, 0x21, 0x33,
+    0x00, 0x03, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFD, 0x91, 0x00, 0x03,
+    0xFB, 0x56, 0xEB, 0x00, 0x09, 0xE1, 0x00, 0x5F, 0x40, 0x0D, 0xB0, 0x00,
+    0x1F, 0x70, 0x0E, 0x90, 0x00, 0x0F, 0x80, 0x0D, 0xA0, 0x00, 0x1F, 0x80,
+    0x0A, 0xD0, 0x00, 0x4F, 0x50, 0x05, 0xF8, 0x12, 0xCD, 0x10, 0x00, 0x7F,
+    0xFF, 0xD3, 0x00, 0x00, 0x01, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+03B4 δ
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xEE, 0xB4, 0x00, 0x03,
+    0xF9, 0x11, 0x4B, 0x00, 0x05, 0xF1, 0x00, 0x00, 0x00, 0x01, 0xB8, 0x10,
+    0x00, 0x00, 0x00, 0x7E, 0xFF, 0x70, 0x00, 0x07, 0xF6, 0x10, 0x00, 0x00,
+    0x0A, 0xC0, 0x00, 0x00, 0x00, 0x05, 0xF7, 0x10, 0x27, 0x40, 0x00, 0x5B,
+    0xEF, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+03B5 ε
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x02, 0xFE, 0x70, 0x00, 0x00, 0x00, 0x29, 0xF2, 0x00,
+    0x00, 0x00, 0x01, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
+    0x01, 0xEF, 0x40, 0x00, 0x00, 0x07, 0xFE, 0x90, 0x00, 0x00, 0x0E, 0x98,
+    0xE1, 0x00, 0x00, 0x6F, 0x23, 0xF5, 0x00, 0x00, 0xDA, 0x00, 0xCB, 0x00,
+    0x05, 0xF3, 0x00, 0x6F, 0x20, 0x0C, 0xB0, 0x00, 0x1F, 0x70, 0x4F, 0x40,
+    0x00, 0x0A, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+03BB λ
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x4F, 0x30, 0x07,
+    0xF0, 0x00, 0x4F, 0x30, 0x07, 0xF0, 0x00, 0x4F, 0x30, 0x07, 0xF0, 0x00,
+    0x4F, 0x30, 0x07, 0xF0, 0x00, 0x4F, 0x30, 0x07, 0xF0, 0x00, 0x4F, 0x30,
+    0x07, 0xF1, 0x00, 0x6F, 0x30, 0x07, 0xF9, 0x13, 0xDF, 0x50, 0x07, 0xD9,
+    0xED, 0x6B, 0xE3, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
+    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+03BC μ
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xBB, 0xBB, 0xBB, 0xB0, 0x4C,
+    0xFB, 0xAA, 0xDF, 0xA0, 0x04, 0xF2, 0x00, 0x8E, 0x00, 0x04, 0xF2, 0x00,
+    0x8E, 0x00, 0x04, 0xF2, 0x00, 0x8E, 0x00, 0x04, 0xF2, 0x00, 0x8E, 0x00,
+    0x04, 0xF2, 0x00, 0x7E, 0x00, 0x04, 0xF2, 0x00, 0x7E, 0x10, 0x04, 0xF2,
+    0x00, 0x4F, 0xE3, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+03C0 π
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0x80, 0x0E, 0xA0, 0x00, 0x0F,
+    0x80, 0x0E, 0xA0, 0x00, 0x0F, 0x80, 0x0E, 0xA0, 0x00, 0x0F, 0x80, 0x0E,
+    0xA0, 0x00, 0x0F, 0x80, 0x0E, 0xA0, 0x00, 0x0F, 0x80, 0x0E, 0xA0, 0x00,
+    0x0F, 0x80, 0x0E, 0xA0, 0x00, 0x0F, 0x80, 0x0E, 0xA0, 0x00, 0x0F, 0x80,
+    0x0E, 0xA0, 0x00, 0x0F, 0x80, 0x0E, 0xA0, 0x00, 0x0F, 0x80, 0x0E, 0xA0,
+    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+041F П
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFD, 0x80, 0x00, 0x05,
+    0xF1, 0x03, 0xF6, 0x00, 0x05, 0xF1, 0x00, 0xD9, 0x00, 0x05, 0xF1, 0x03,
+    0xF5, 0x00, 0x05, 0xFF, 0xFF, 0xB1, 0x00, 0x05, 0xF1, 0x01, 0xCB, 0x00,
+    0x05, 0xF1, 0x00, 0x9E, 0x00, 0x05, 0xF1, 0x02, 0xDB, 0x00, 0x05, 0xFF,
+    0xFE, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0432 в
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xEE, 0xB2, 0x00, 0x02,
+    0xEA, 0x21, 0xAD, 0x00, 0x0A, 0xD0, 0x00, 0x1E, 0x60, 0x0E, 0x90, 0x00,
+    0x0C, 0x90, 0x0F, 0xFF, 0xFF, 0xFF, 0xA0, 0x0E, 0x80, 0x00, 0x00, 0x00,
+    0x0A, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xE9, 0x21, 0x39, 0x50, 0x00, 0x3A,
+    0xEE, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0435 е
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x8F, 0x30, 0x07,
+    0xF0, 0x02, 0xFF, 0x30, 0x07, 0xF0, 0x0A, 0xEF, 0x30, 0x07, 0xF0, 0x4F,
+    0x6F, 0x30, 0x07, 0xF0, 0xD9, 0x4F, 0x30, 0x07, 0xF7, 0xE1, 0x4F, 0x30,
+    0x07, 0xFE, 0x60, 0x4F, 0x30, 0x07, 0xFC, 0x00, 0x4F, 0x30, 0x07, 0xF4,
+    0x00, 0x4F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0438 и
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x30, 0x00, 0x07, 0xF3, 0x8F,
+    0xB0, 0x00, 0x1E, 0xF3, 0x8F, 0xF4, 0x00, 0x9F, 0xF3, 0x8E, 0xCC, 0x02,
+    0xFB, 0xF3, 0x8E, 0x4F, 0x6A, 0xE4, 0xF3, 0x8E, 0x0B, 0xEF, 0x63, 0xF3,
+    0x8E, 0x02, 0xFD, 0x03, 0xF3, 0x8E, 0x00, 0x00, 0x03, 0xF3, 0x8E, 0x00,
+    0x00, 0x03, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+043C м
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xE6, 0xDF, 0xB2, 0x00, 0x08,
+    0xFC, 0x22, 0xBD, 0x00, 0x08, 0xF4, 0x00, 0x2F, 0x50, 0x08, 0xF0, 0x00,
+    0x0E, 0x80, 0x08, 0xE0, 0x00, 0x0D, 0x90, 0x08, 0xF0, 0x00, 0x0E, 0x80,
+    0x08, 0xF4, 0x00, 0x2F, 0x50, 0x08, 0xFC, 0x22, 0xBD, 0x00, 0x08, 0xE7,
+    0xDF, 0xB2, 0x00, 0x08, 0xE0, 0x00, 0x00, 0x00, 0x08, 0xE0, 0x00, 0x00,
+    0x00, 0x08, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0440 р
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0x10, 0x00,
+    0x00, 0xC9, 0x00, 0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, 0x00, 0xC9,
+    0x00, 0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, 0x00, 0xC9, 0x00, 0x00,
+    0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, 0x00,
+    0xC9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0442 т
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+2013 –
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1E, 0x40, 0x7D, 0x00, 0x00, 0x8F, 0x10, 0xD9,
+    0x00, 0x01, 0xEC, 0x06, 0xF6, 0x00, 0x05, 0xFA, 0x0B, 0xF3, 0x00, 0x05,
+    0xFA, 0x0B, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+201C “
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x60, 0xFF, 0x00, 0x00, 0x9F, 0x60, 0xFE,
+    0x00, 0x00, 0xBE, 0x13, 0xF9, 0x00, 0x00, 0xF8, 0x06, 0xF2, 0x00, 0x03,
+    0xF2, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+201D ”
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x93, 0xFC, 0x0F, 0xF0, 0x6F, 0x93,
+    0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+2026 …
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xBE, 0xD8, 0x00, 0x00, 0x2E, 0x91, 0x3C,
+    0x40, 0x00, 0xAD, 0x00, 0x01, 0x30, 0x01, 0xE8, 0x00, 0x00, 0x00, 0x04,
+    0xF5, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xF2, 0x00,
+    0x00, 0x00, 0x8F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xF5, 0x00, 0x00, 0x00,
+    0x00, 0xDA, 0x00, 0x01, 0x30, 0x00, 0x4F, 0x71, 0x2C, 0x40, 0x00, 0x04,
+    0xBE, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+20AC €
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0x00, 0x00, 0x00, 0x0A, 0xB1, 0x00,
+    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF2, 0x1C, 0xB4, 0x44, 0x44, 0x40,
+    0x01, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+2190 ←
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
+    0x09, 0xFF, 0x40, 0x00, 0x00, 0x8B, 0xDA, 0xE2, 0x00, 0x00, 0x11, 0xC7,
+    0x20, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00,
+    0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0x00,
+    0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+2191 ↑
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00,
+    0x3E, 0x50, 0x7F, 0xFF, 0xFF, 0xFF, 0xF1, 0x24, 0x44, 0x44, 0x5E, 0x80,
+    0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+2192 →
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+    0x00, 0xC7, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0x00, 0xC7,
+    0x00, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00,
+    0x00, 0x76, 0xC7, 0xA2, 0x00, 0x00, 0x2D, 0xFF, 0x90, 0x00, 0x00, 0x02,
+    0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+2193 ↓
+    0x00, 0x00, 0x00, 0x00
+};
+
+static const uint16_t FontCodepoints_UnicodeMono16[] = {
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+    0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+    0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+    0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+    0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+    0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x00B0,
+    0x00B1, 0x00B5, 0x00C4, 0x00D6, 0x00DC, 0x00DF, 0x00E4, 0x00E5,
+    0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00F1, 0x00F6, 0x00F8, 0x00FC,
+    0x03A3, 0x03A9, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03BB,
+    0x03BC, 0x03C0, 0x041F, 0x0432, 0x0435, 0x0438, 0x043C, 0x0440,
+    0x0442, 0x2013, 0x201C, 0x201D, 0x2026, 0x20AC, 0x2190, 0x2191,
+    0x2192, 0x2193,
+};
+
+FontDef_s Font_UnicodeMono16 = {19, 10, 0, FontBitmap_UnicodeMono16, 0, 0, 0,
+                      0, 0, 0, 4, FontCodepoints_UnicodeMono16, 138, 0, 0};
@@ -0,0 +1,306 @@
+/* Generated by ILI9341FontCompiler from DejaVuSansMono.ttf at 16 px, do not edit */
+#include "fonts.h"
+
+static const uint8_t FontBitmap_UnicodeMono16Bits[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0020  
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08, 0x02,
+    0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0021 !
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x12, 0x04, 0x81, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0022 "
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x82, 0x40, 0x91, 0xFF, 0x13, 0x04,
+    0x81, 0x23, 0xFE, 0x26, 0x09, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0023 #
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x04, 0x07, 0xC3, 0x48, 0x90, 0x24, 0x07,
+    0x00, 0x70, 0x12, 0x04, 0x89, 0x21, 0xF0, 0x10, 0x04, 0x00, 0x00, 0x00, // U+0024 $
+    0x00, 0x00, 0x00, 0x01, 0xC0, 0x88, 0x22, 0x08, 0x81, 0xC4, 0x06, 0x06,
+    0x06, 0x70, 0x22, 0x08, 0x82, 0x20, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0025 %
+    0x00, 0x00, 0x00, 0x00, 0x78, 0x20, 0x08, 0x02, 0x00, 0x40, 0x28, 0x1B,
+    0x24, 0x49, 0x0A, 0x43, 0x08, 0xC1, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0026 &
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x02, 0x00, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0027 '
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x0C, 0x02, 0x00, 0x80, 0x40, 0x10, 0x04,
+    0x01, 0x00, 0x40, 0x10, 0x02, 0x00, 0x80, 0x30, 0x06, 0x00, 0x00, 0x00, // U+0028 (
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0x18, 0x02, 0x00, 0x80, 0x10, 0x04, 0x01,
+    0x00, 0x40, 0x10, 0x04, 0x02, 0x00, 0x80, 0x60, 0x30, 0x00, 0x00, 0x00, // U+0029 )
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x12, 0x43, 0xE0, 0x70, 0x6B, 0x02,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+002A *
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x02,
+    0x07, 0xF0, 0x20, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+002B +
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x30, 0x18, 0x04, 0x00, 0x00, // U+002C ,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+002D -
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+002E .
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x00, 0x80, 0x40, 0x10, 0x08, 0x02,
+    0x00, 0x80, 0x40, 0x10, 0x08, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, // U+002F /
+    0x00, 0x00, 0x00, 0x00, 0x78, 0x21, 0x08, 0x44, 0x09, 0x02, 0x4C, 0x93,
+    0x24, 0x09, 0x02, 0x21, 0x08, 0x41, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0030 0
+    0x00, 0x00, 0x00, 0x00, 0x70, 0x34, 0x01, 0x00, 0x40, 0x10, 0x04, 0x01,
+    0x00, 0x40, 0x10, 0x04, 0x01, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0031 1
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0x61, 0x10, 0x20, 0x08, 0x02, 0x01, 0x00,
+    0x80, 0x40, 0x20, 0x10, 0x0C, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0032 2
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0x41, 0x00, 0x20, 0x08, 0x06, 0x1E, 0x00,
+    0x40, 0x08, 0x02, 0x00, 0x90, 0x43, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0033 3
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x02, 0x81, 0xA0, 0x48, 0x22, 0x08,
+    0x84, 0x21, 0xFE, 0x02, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0034 4
+    0x00, 0x00, 0x00, 0x00, 0xFC, 0x20, 0x08, 0x02, 0x00, 0xF8, 0x21, 0x00,
+    0x20, 0x08, 0x02, 0x00, 0x90, 0x43, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0035 5
+    0x00, 0x00, 0x00, 0x00, 0x78, 0x31, 0x08, 0x04, 0x01, 0x78, 0x61, 0x10,
+    0x24, 0x09, 0x02, 0x40, 0x88, 0x41, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0036 6
+    0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x80, 0x40, 0x10, 0x08, 0x02, 0x01,
+    0x00, 0x40, 0x10, 0x08, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0037 7
+    0x00, 0x00, 0x00, 0x00, 0x78, 0x61, 0x90, 0x24, 0x09, 0x86, 0x1E, 0x08,
+    0x64, 0x09, 0x02, 0x40, 0x88, 0x41, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0038 8
+    0x00, 0x00, 0x00, 0x00, 0x78, 0x21, 0x10, 0x24, 0x09, 0x02, 0x40, 0x88,
+    0x61, 0xE8, 0x02, 0x01, 0x08, 0xC1, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0039 9
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+003A :
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x30, 0x18, 0x04, 0x00, 0x00, // U+003B ;
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1E, 0x1C, 0x1C,
+    0x07, 0x00, 0x70, 0x07, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+003C <
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80,
+    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+003D =
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0xE0, 0x0E, 0x00,
+    0xE0, 0x38, 0x38, 0x78, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+003E >
+    0x00, 0x00, 0x00, 0x00, 0x78, 0x23, 0x00, 0x40, 0x10, 0x0C, 0x06, 0x02,
+    0x00, 0x80, 0x20, 0x00, 0x02, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // U+003F ?
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x04, 0x62, 0x08, 0x9E, 0x4D, 0x92,
+    0x24, 0x89, 0x22, 0x48, 0x93, 0x62, 0x78, 0x80, 0x10, 0x03, 0xC0, 0x00, // U+0040 @
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x07, 0x81, 0x20, 0x48, 0x12, 0x08,
+    0x42, 0x10, 0xFC, 0x21, 0x10, 0x24, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0041 A
+    0x00, 0x00, 0x00, 0x01, 0xF8, 0x41, 0x90, 0x24, 0x09, 0x06, 0x7E, 0x10,
+    0x64, 0x09, 0x02, 0x40, 0x90, 0x67, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0042 B
+    0x00, 0x00, 0x00, 0x00, 0x3C, 0x31, 0x88, 0x04, 0x01, 0x00, 0x40, 0x10,
+    0x04, 0x01, 0x00, 0x20, 0x0C, 0x60, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0043 C
+    0x00, 0x00, 0x00, 0x01, 0xF0, 0x43, 0x10, 0x44, 0x09, 0x02, 0x40, 0x90,
+    0x24, 0x09, 0x02, 0x41, 0x10, 0xC7, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0044 D
+    0x00, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x10, 0x04, 0x01, 0x00, 0x7F, 0x90,
+    0x04, 0x01, 0x00, 0x40, 0x10, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0045 E
+    0x00, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x10, 0x04, 0x01, 0x00, 0x7F, 0x10,
+    0x04, 0x01, 0x00, 0x40, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0046 F
+    0x00, 0x00, 0x00, 0x00, 0x3C, 0x31, 0x88, 0x04, 0x01, 0x00, 0x40, 0x10,
+    0xE4, 0x09, 0x02, 0x20, 0x8C, 0x20, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0047 G
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x40, 0x90, 0x24, 0x09, 0x02, 0x7F, 0x90,
+    0x24, 0x09, 0x02, 0x40, 0x90, 0x24, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0048 H
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08, 0x02,
+    0x00, 0x80, 0x20, 0x08, 0x02, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0049 I
+    0x00, 0x00, 0x00, 0x00, 0x3C, 0x01, 0x00, 0x40, 0x10, 0x04, 0x01, 0x00,
+    0x40, 0x10, 0x04, 0x01, 0x18, 0x83, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+004A J
+    0x00, 0x00, 0x00, 0x01, 0x04, 0x42, 0x11, 0x04, 0x81, 0x40, 0x68, 0x12,
+    0x04, 0x41, 0x08, 0x42, 0x10, 0x44, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, // U+004B K
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x40, 0x10, 0x04, 0x01, 0x00, 0x40, 0x10,
+    0x04, 0x01, 0x00, 0x40, 0x10, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, // U+004C L
+    0x00, 0x00, 0x00, 0x01, 0x86, 0x61, 0x9C, 0xE5, 0x29, 0x4A, 0x4C, 0x93,
+    0x24, 0xC9, 0x02, 0x40, 0x90, 0x24, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, // U+004D M
+    0x00, 0x00, 0x00, 0x01, 0x82, 0x60, 0x94, 0x25, 0x09, 0x22, 0x48, 0x91,
+    0x24, 0x49, 0x0A, 0x42, 0x90, 0x64, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, // U+004E N
+    0x00, 0x00, 0x00, 0x00, 0x78, 0x21, 0x18, 0x64, 0x09, 0x02, 0x40, 0x90,
+    0x24, 0x09, 0x02, 0x61, 0x88, 0x41, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+004F O
+    0x00, 0x00, 0x00, 0x01, 0xF8, 0x41, 0x10, 0x24, 0x09, 0x02, 0x41, 0x1F,
+    0x84, 0x01, 0x00, 0x40, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0050 P
+    0x00, 0x00, 0x00, 0x00, 0x78, 0x21, 0x18, 0x44, 0x09, 0x02, 0x40, 0x90,
+    0x24, 0x09, 0x02, 0x61, 0x88, 0x41, 0xF0, 0x0C, 0x01, 0x00, 0x00, 0x00, // U+0051 Q
+    0x00, 0x00, 0x00, 0x01, 0xF8, 0x41, 0x10, 0x24, 0x09, 0x02, 0x41, 0x9F,
+    0x84, 0x11, 0x02, 0x40, 0x90, 0x24, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0052 R
+    0x00, 0x00, 0x00, 0x00, 0x78, 0x23, 0x10, 0x04, 0x01, 0x00, 0x38, 0x03,
+    0xC0, 0x08, 0x02, 0x40, 0x98, 0x63, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0053 S
+    0x00, 0x00, 0x00, 0x03, 0xFE, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08, 0x02,
+    0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0054 T
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x40, 0x90, 0x24, 0x09, 0x02, 0x40, 0x90,
+    0x24, 0x09, 0x02, 0x40, 0x88, 0x41, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0055 U
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x40, 0x88, 0x42, 0x10, 0x84, 0x21, 0x04,
+    0x81, 0x20, 0x48, 0x1E, 0x03, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0056 V
+    0x00, 0x00, 0x00, 0x02, 0x01, 0x80, 0x60, 0x14, 0xC9, 0x32, 0x4C, 0x93,
+    0x25, 0x29, 0x4A, 0x52, 0x88, 0x42, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0057 W
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x21, 0x08, 0x41, 0x20, 0x48, 0x0C, 0x03,
+    0x01, 0x20, 0x48, 0x21, 0x08, 0x44, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0058 X
+    0x00, 0x00, 0x00, 0x02, 0x02, 0x41, 0x08, 0x82, 0x20, 0x50, 0x14, 0x02,
+    0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0059 Y
+    0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x80, 0x40, 0x20, 0x18, 0x04, 0x02,
+    0x01, 0x80, 0x40, 0x20, 0x10, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, // U+005A Z
+    0x00, 0x00, 0x00, 0x00, 0x38, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08, 0x02,
+    0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x0E, 0x00, 0x00, 0x00, // U+005B [
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x20, 0x08, 0x01, 0x00, 0x40, 0x08, 0x02,
+    0x00, 0x80, 0x10, 0x04, 0x00, 0x80, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, // U+005C
+    0x00, 0x00, 0x00, 0x00, 0x70, 0x04, 0x01, 0x00, 0x40, 0x10, 0x04, 0x01,
+    0x00, 0x40, 0x10, 0x04, 0x01, 0x00, 0x40, 0x10, 0x1C, 0x00, 0x00, 0x00, // U+005D ]
+    0x00, 0x00, 0x00, 0x00, 0x38, 0x1B, 0x0C, 0x66, 0x0C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+005E ^
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, // U+005F _
+    0x00, 0x00, 0x03, 0x00, 0x60, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0060 `
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x86, 0x00, 0x87,
+    0xE6, 0x09, 0x02, 0x41, 0x98, 0xE3, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0061 a
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x40, 0x10, 0x05, 0xE1, 0x84, 0x40, 0x90,
+    0x24, 0x09, 0x02, 0x40, 0x98, 0x45, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0062 b
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x84, 0x40, 0x10,
+    0x04, 0x01, 0x00, 0x40, 0x08, 0x41, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0063 c
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x21, 0xE8, 0x86, 0x40, 0x90,
+    0x24, 0x09, 0x02, 0x40, 0x88, 0x61, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0064 d
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x84, 0x40, 0x90,
+    0x27, 0xF9, 0x00, 0x40, 0x08, 0x21, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0065 e
+    0x00, 0x00, 0x00, 0x00, 0x1C, 0x08, 0x02, 0x03, 0xF0, 0x20, 0x08, 0x02,
+    0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0066 f
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE8, 0x86, 0x40, 0x90,
+    0x24, 0x09, 0x02, 0x40, 0x88, 0x61, 0xE8, 0x02, 0x21, 0x07, 0x80, 0x00, // U+0067 g
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x40, 0x10, 0x05, 0xF1, 0x86, 0x40, 0x90,
+    0x24, 0x09, 0x02, 0x40, 0x90, 0x24, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0068 h
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x03, 0x80, 0x20, 0x08, 0x02,
+    0x00, 0x80, 0x20, 0x08, 0x02, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0069 i
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0x01, 0xC0, 0x10, 0x04, 0x01,
+    0x00, 0x40, 0x10, 0x04, 0x01, 0x00, 0x40, 0x10, 0x04, 0x0E, 0x00, 0x00, // U+006A j
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x40, 0x10, 0x04, 0x21, 0x10, 0x48, 0x14,
+    0x06, 0x81, 0x10, 0x42, 0x10, 0x44, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, // U+006B k
+    0x00, 0x00, 0x00, 0x01, 0xE0, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08, 0x02,
+    0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, // U+006C l
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE1, 0x24, 0x49, 0x12,
+    0x44, 0x91, 0x24, 0x49, 0x12, 0x44, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, // U+006D m
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF1, 0x86, 0x40, 0x90,
+    0x24, 0x09, 0x02, 0x40, 0x90, 0x24, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, // U+006E n
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x84, 0x40, 0x90,
+    0x24, 0x09, 0x02, 0x40, 0x88, 0x41, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+006F o
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xE1, 0x84, 0x40, 0x90,
+    0x24, 0x09, 0x02, 0x40, 0x98, 0x45, 0xE1, 0x00, 0x40, 0x10, 0x00, 0x00, // U+0070 p
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE8, 0x86, 0x40, 0x90,
+    0x24, 0x09, 0x02, 0x40, 0x88, 0x61, 0xE8, 0x02, 0x00, 0x80, 0x20, 0x00, // U+0071 q
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x70, 0x62, 0x10, 0x04,
+    0x01, 0x00, 0x40, 0x10, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0072 r
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF1, 0x82, 0x40, 0x18,
+    0x03, 0xF0, 0x06, 0x00, 0x90, 0x63, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0073 s
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x04, 0x07, 0xE0, 0x40, 0x10, 0x04,
+    0x01, 0x00, 0x40, 0x10, 0x04, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0074 t
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x09, 0x02, 0x40, 0x90,
+    0x24, 0x09, 0x02, 0x40, 0x98, 0x63, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0075 u
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x84, 0x21, 0x08,
+    0x41, 0x20, 0x48, 0x12, 0x03, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0076 v
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x06, 0x01, 0x4C, 0x93,
+    0x25, 0x49, 0x4A, 0x52, 0x88, 0x42, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0077 w
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x18, 0x84, 0x12, 0x03,
+    0x00, 0xC0, 0x30, 0x12, 0x08, 0x46, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0078 x
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x84, 0x21, 0x08,
+    0x41, 0x20, 0x48, 0x0A, 0x03, 0x00, 0xC0, 0x10, 0x08, 0x0E, 0x00, 0x00, // U+0079 y
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x02, 0x01, 0x00,
+    0x80, 0xC0, 0x40, 0x20, 0x10, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, // U+007A z
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08, 0x02,
+    0x03, 0x00, 0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08, 0x01, 0x80, 0x00, // U+007B {
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08, 0x02,
+    0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80, // U+007C |
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08, 0x02,
+    0x00, 0x60, 0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08, 0x0C, 0x00, 0x00, // U+007D }
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E,
+    0x24, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+007E ~
+    0x00, 0x00, 0x00, 0x00, 0x70, 0x22, 0x08, 0x82, 0x20, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00B0 °
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x20, 0x7F, 0x02,
+    0x00, 0x80, 0x20, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00B1 ±
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x09, 0x02, 0x40, 0x90,
+    0x24, 0x09, 0x02, 0x40, 0x98, 0x65, 0xED, 0x00, 0x40, 0x10, 0x00, 0x00, // U+00B5 µ
+    0x33, 0x0C, 0xC0, 0x00, 0x30, 0x0C, 0x07, 0x81, 0x20, 0x48, 0x12, 0x08,
+    0x42, 0x10, 0xFC, 0x21, 0x10, 0x24, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00C4 Ä
+    0x33, 0x0C, 0xC0, 0x00, 0x78, 0x21, 0x18, 0x64, 0x09, 0x02, 0x40, 0x90,
+    0x24, 0x09, 0x02, 0x61, 0x88, 0x41, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00D6 Ö
+    0x33, 0x0C, 0xC0, 0x01, 0x02, 0x40, 0x90, 0x24, 0x09, 0x02, 0x40, 0x90,
+    0x24, 0x09, 0x02, 0x40, 0x88, 0x41, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00DC Ü
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0x63, 0x10, 0x44, 0x61, 0x20, 0x48, 0x13,
+    0x04, 0x71, 0x06, 0x40, 0x90, 0x25, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00DF ß
+    0x00, 0x00, 0x00, 0x00, 0x6C, 0x1B, 0x00, 0x01, 0xF0, 0x86, 0x00, 0x87,
+    0xE6, 0x09, 0x02, 0x41, 0x98, 0xE3, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00E4 ä
+    0x00, 0x03, 0x01, 0x20, 0x48, 0x0C, 0x00, 0x01, 0xF0, 0x86, 0x00, 0x87,
+    0xE6, 0x09, 0x02, 0x41, 0x98, 0xE3, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00E5 å
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x84, 0x40, 0x10,
+    0x04, 0x01, 0x00, 0x40, 0x08, 0x41, 0xE0, 0x10, 0x02, 0x03, 0x80, 0x00, // U+00E7 ç
+    0x00, 0x00, 0x01, 0x00, 0x60, 0x0C, 0x00, 0x01, 0xE0, 0x84, 0x40, 0x90,
+    0x27, 0xF9, 0x00, 0x40, 0x08, 0x21, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00E8 è
+    0x00, 0x00, 0x00, 0x30, 0x18, 0x0C, 0x00, 0x01, 0xE0, 0x84, 0x40, 0x90,
+    0x27, 0xF9, 0x00, 0x40, 0x08, 0x21, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00E9 é
+    0x00, 0x00, 0x00, 0xC0, 0x50, 0x32, 0x00, 0x01, 0xE0, 0x84, 0x40, 0x90,
+    0x27, 0xF9, 0x00, 0x40, 0x08, 0x21, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00EA ê
+    0x00, 0x00, 0x00, 0x00, 0xE8, 0x2E, 0x00, 0x05, 0xF1, 0x86, 0x40, 0x90,
+    0x24, 0x09, 0x02, 0x40, 0x90, 0x24, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00F1 ñ
+    0x00, 0x00, 0x00, 0x00, 0xCC, 0x33, 0x00, 0x01, 0xE0, 0x84, 0x40, 0x90,
+    0x24, 0x09, 0x02, 0x40, 0x88, 0x41, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00F6 ö
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x86, 0x43, 0x91,
+    0xA4, 0xC9, 0x62, 0x70, 0x98, 0x47, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00F8 ø
+    0x00, 0x00, 0x00, 0x00, 0xCC, 0x33, 0x00, 0x04, 0x09, 0x02, 0x40, 0x90,
+    0x24, 0x09, 0x02, 0x40, 0x98, 0x63, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, // U+00FC ü
+    0x00, 0x00, 0x00, 0x01, 0xFE, 0x60, 0x08, 0x01, 0x00, 0x60, 0x08, 0x02,
+    0x01, 0x80, 0x40, 0x20, 0x18, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, // U+03A3 Σ
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x08, 0x46, 0x19, 0x02, 0x40, 0x90,
+    0x24, 0x09, 0x02, 0x21, 0x08, 0x47, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, // U+03A9 Ω
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD9, 0x94, 0x47, 0x10,
+    0xC4, 0x21, 0x08, 0x47, 0x19, 0xC3, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, // U+03B1 α
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x6E, 0x19,
+    0xC6, 0x19, 0x86, 0x61, 0x9C, 0xC7, 0xE1, 0x80, 0x60, 0x18, 0x00, 0x00, // U+03B2 β
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x19, 0x84, 0x21, 0x0C,
+    0xC3, 0x20, 0x58, 0x1E, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0x00, // U+03B3 γ
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0x30, 0x08, 0x03, 0xE0, 0xCC, 0x61, 0x18,
+    0x46, 0x19, 0x86, 0x61, 0x08, 0xC3, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+03B4 δ
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE1, 0x84, 0x40, 0x08,
+    0x03, 0xC1, 0x80, 0x40, 0x18, 0x43, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+03B5 ε
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0x18, 0x02, 0x00, 0xC0, 0x30, 0x0E, 0x07,
+    0x81, 0x20, 0xCC, 0x21, 0x18, 0x44, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, // U+03BB λ
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x09, 0x02, 0x40, 0x90,
+    0x24, 0x09, 0x02, 0x40, 0x98, 0x65, 0xED, 0x00, 0x40, 0x10, 0x00, 0x00, // U+03BC μ
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF9, 0xFE, 0x23, 0x08,
+    0xC2, 0x30, 0x8C, 0x23, 0x08, 0x42, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, // U+03C0 π
+    0x00, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x90, 0x24, 0x09, 0x02, 0x40, 0x90,
+    0x24, 0x09, 0x02, 0x40, 0x90, 0x24, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, // U+041F П
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC1, 0x08, 0x42, 0x10,
+    0x87, 0xC1, 0x08, 0x42, 0x10, 0x87, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0432 в
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x84, 0x40, 0x90,
+    0x27, 0xF9, 0x00, 0x40, 0x08, 0x21, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0435 е
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x0C, 0x47, 0x11,
+    0x44, 0x91, 0x44, 0x51, 0x18, 0x44, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0438 и
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x09, 0x86, 0x61, 0x94,
+    0xA5, 0xE9, 0x32, 0x4C, 0x90, 0x24, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, // U+043C м
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xE1, 0x84, 0x40, 0x90,
+    0x24, 0x09, 0x02, 0x40, 0x98, 0x45, 0xE1, 0x00, 0x40, 0x10, 0x00, 0x00, // U+0440 р
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x10, 0x04, 0x01,
+    0x00, 0x40, 0x10, 0x04, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0442 т
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+2013 –
+    0x00, 0x00, 0x00, 0x00, 0x44, 0x33, 0x19, 0x86, 0x61, 0x98, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+201C “
+    0x00, 0x00, 0x00, 0x00, 0xCC, 0x33, 0x0C, 0xC6, 0x61, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+201D ”
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1B, 0x66, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, // U+2026 …
+    0x00, 0x00, 0x00, 0x00, 0x3C, 0x18, 0x84, 0x02, 0x00, 0x80, 0x7E, 0x08,
+    0x07, 0xC0, 0x80, 0x10, 0x04, 0x20, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+20AC €
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x18,
+    0x07, 0xF9, 0x80, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+2190 ←
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x70, 0x3A, 0x02,
+    0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // U+2191 ↑
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x47, 0xF8, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+2192 →
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20, 0x08, 0x02,
+    0x00, 0x80, 0x20, 0x2A, 0x07, 0x80, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, // U+2193 ↓
+    0x00, 0x00, 0x00, 0x00
+};
+
+static const uint16_t FontCodepoints_UnicodeMono16Bits[] = {
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+    0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+    0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+    0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+    0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+    0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x00B0,
+    0x00B1, 0x00B5, 0x00C4, 0x00D6, 0x00DC, 0x00DF, 0x00E4, 0x00E5,
+    0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00F1, 0x00F6, 0x00F8, 0x00FC,
+    0x03A3, 0x03A9, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03BB,
+    0x03BC, 0x03C0, 0x041F, 0x0432, 0x0435, 0x0438, 0x043C, 0x0440,
+    0x0442, 0x2013, 0x201C, 0x201D, 0x2026, 0x20AC, 0x2190, 0x2191,
+    0x2192, 0x2193,
+};
+
+FontDef_s Font_UnicodeMono16Bits = {19, 10, 0, FontBitmap_UnicodeMono16Bits, 0, 0, 0,
+                      0, 0, 0, 1, FontCodepoints_UnicodeMono16Bits, 138, 0, 0};
@@ -0,0 +1,245 @@
+/* Generated by ILI9341FontCompiler from DejaVuSansMono.ttf at 16 px, do not edit */
+#include "fonts.h"
+
+static const uint8_t FontBitmap_UnicodeMono16Delta[] = {
+    0x00, 0x00, 0x00, // U+0020  
+    0x10, 0x80, 0x04, 0x00, 0x42, 0x04, 0x00, 0x00, // U+0021 !
+    0x11, 0x20, 0x40, 0x00, 0x00, // U+0022 "
+    0x08, 0x4D, 0x09, 0x17, 0xFE, 0x26, 0x44, 0x87, 0xFE, 0x93, 0x12, 0x42,
+    0xC8, 0x40, 0x00, // U+0023 #
+    0x10, 0x41, 0x1F, 0x26, 0x94, 0x90, 0x47, 0x08, 0x39, 0x04, 0x92, 0x4A,
+    0x3E, 0x41, 0x04, 0x00, 0x00, // U+0024 $
+    0x17, 0x03, 0x10, 0x17, 0x12, 0x0C, 0x46, 0x0B, 0x39, 0x08, 0x88, 0x39,
+    0x00, 0x00, // U+0025 %
+    0x11, 0xE2, 0x40, 0x11, 0x02, 0x50, 0x5B, 0x2A, 0x25, 0x42, 0xA8, 0x64,
+    0x8C, 0x8F, 0x50, 0x00, 0x00, // U+0026 &
+    0x10, 0x80, 0x40, 0x00, 0x00, // U+0027 '
+    0x10, 0x62, 0x18, 0x42, 0x04, 0x40, 0x04, 0x20, 0x43, 0x08, 0x31, 0x00,
+    0x00, // U+0028 (
+    0x13, 0x02, 0x30, 0x42, 0x04, 0x10, 0x04, 0x20, 0x46, 0x09, 0x81, 0x00,
+    0x00, // U+0029 )
+    0x10, 0x81, 0x49, 0x27, 0xC4, 0x70, 0xB5, 0x90, 0x81, 0x00, 0x00, 0x00, // U+002A *
+    0x01, 0x08, 0x0B, 0xF9, 0x08, 0x08, 0x00, 0x00, // U+002B +
+    0x00, 0x04, 0x30, 0x23, 0x04, 0x40, 0x80, 0x00, // U+002C ,
+    0x00, 0x23, 0xC4, 0x00, 0x00, // U+002D -
+    0x00, 0x04, 0x30, 0x40, 0x00, // U+002E .
+    0x10, 0x12, 0x04, 0x20, 0x82, 0x10, 0x11, 0x01, 0x20, 0x14, 0x02, 0x00,
+    0x00, // U+002F /
+    0x11, 0xE2, 0x42, 0x28, 0x12, 0x99, 0x28, 0x12, 0x42, 0x23, 0xC4, 0x00,
+    0x00, // U+0030 0
+    0x11, 0xC2, 0x68, 0x41, 0x00, 0x08, 0xF9, 0x00, 0x00, // U+0031 1
+    0x13, 0xE2, 0xC2, 0x50, 0x28, 0x04, 0x80, 0x90, 0x22, 0x08, 0x42, 0x08,
+    0x81, 0x30, 0x2F, 0xF4, 0x00, 0x00, // U+0032 2
+    0x13, 0xE2, 0x82, 0x40, 0x24, 0x06, 0x8F, 0x10, 0x12, 0x01, 0x14, 0x12,
+    0x7C, 0x40, 0x00, // U+0033 3
+    0x10, 0x62, 0x1C, 0x42, 0x88, 0xD1, 0x12, 0x24, 0x42, 0x84, 0x5F, 0xE8,
+    0x10, 0x40, 0x00, // U+0034 4
+    0x13, 0xF2, 0x40, 0x13, 0xE2, 0x42, 0x40, 0x21, 0x41, 0x27, 0xC4, 0x00,
+    0x00, // U+0035 5
+    0x11, 0xE2, 0x62, 0x48, 0x0A, 0x01, 0x5E, 0x2C, 0x25, 0x02, 0x12, 0x12,
+    0x3C, 0x40, 0x00, // U+0036 6
+    0x17, 0xFA, 0x01, 0x40, 0x44, 0x08, 0x41, 0x02, 0x10, 0x22, 0x04, 0x00,
+    0x00, // U+0037 7
+    0x11, 0xE2, 0xC3, 0x50, 0x25, 0x86, 0x8F, 0x12, 0x1A, 0x81, 0x12, 0x12,
+    0x3C, 0x40, 0x00, // U+0038 8
+    0x11, 0xE2, 0x42, 0x50, 0x21, 0x21, 0xA3, 0xD4, 0x02, 0x80, 0x92, 0x32,
+    0x3C, 0x40, 0x00, // U+0039 9
+    0x01, 0x0C, 0x10, 0x00, 0x43, 0x04, 0x00, 0x00, // U+003A :
+    0x01, 0x0C, 0x10, 0x00, 0x43, 0x02, 0x30, 0x44, 0x08, 0x00, // U+003B ;
+    0x02, 0x01, 0x41, 0xE8, 0xE1, 0x70, 0x11, 0xC2, 0x0F, 0x40, 0x28, 0x00,
+    0x00, // U+003C <
+    0x00, 0xBF, 0xD0, 0x01, 0x7F, 0xA0, 0x00, 0x00, // U+003D =
+    0x02, 0x80, 0x5E, 0x08, 0x71, 0x03, 0x90, 0xE2, 0xF0, 0x50, 0x08, 0x00,
+    0x00, // U+003E >
+    0x11, 0xE2, 0x46, 0x40, 0x44, 0x0C, 0x83, 0x10, 0x80, 0x80, 0x10, 0x81,
+    0x00, 0x00, // U+003F ?
+    0x08, 0x79, 0x11, 0xA4, 0x14, 0x9E, 0xA6, 0xD4, 0x88, 0x53, 0x69, 0x3D,
+    0x20, 0x22, 0x04, 0x3C, 0x80, 0x00, // U+0040 @
+    0x10, 0xC1, 0x1E, 0x22, 0x41, 0x21, 0x13, 0xF2, 0x42, 0x50, 0x24, 0x00,
+    0x00, // U+0041 A
+    0x17, 0xE2, 0x83, 0x50, 0x25, 0x06, 0xBF, 0x14, 0x1A, 0x81, 0x14, 0x1A,
+    0xFC, 0x40, 0x00, // U+0042 B
+    0x10, 0xF2, 0x63, 0x48, 0x0A, 0x00, 0x09, 0x01, 0x31, 0xA1, 0xE4, 0x00,
+    0x00, // U+0043 C
+    0x17, 0xC2, 0x86, 0x50, 0x4A, 0x04, 0x0A, 0x09, 0x43, 0x2F, 0x84, 0x00,
+    0x00, // U+0044 D
+    0x17, 0xFA, 0x80, 0x0B, 0xFD, 0x40, 0x02, 0xFF, 0x40, 0x00, // U+0045 E
+    0x17, 0xFA, 0x80, 0x0B, 0xF9, 0x40, 0x01, 0x00, 0x00, // U+0046 F
+    0x10, 0xF2, 0x63, 0x48, 0x0A, 0x00, 0x50, 0xEA, 0x04, 0x90, 0x53, 0x0A,
+    0x1E, 0x40, 0x00, // U+0047 G
+    0x14, 0x08, 0x2F, 0xF5, 0x02, 0x04, 0x00, 0x00, // U+0048 H
+    0x13, 0xE2, 0x10, 0x00, 0x27, 0xC4, 0x00, 0x00, // U+0049 I
+    0x10, 0xF2, 0x02, 0x00, 0x58, 0x89, 0xF1, 0x00, 0x00, // U+004A J
+    0x14, 0x12, 0x84, 0x51, 0x0A, 0x41, 0x50, 0x2D, 0x05, 0x20, 0xA2, 0x14,
+    0x21, 0x41, 0x28, 0x14, 0x00, 0x00, // U+004B K
+    0x14, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, // U+004C L
+    0x16, 0x19, 0x73, 0xAA, 0x52, 0x99, 0x14, 0x08, 0x40, 0x00, // U+004D M
+    0x16, 0x09, 0x50, 0x94, 0x89, 0x44, 0x94, 0x29, 0x41, 0x90, 0x00, 0x00, // U+004E N
+    0x11, 0xE2, 0x42, 0x58, 0x6A, 0x04, 0x0B, 0x0D, 0x21, 0x23, 0xC4, 0x00,
+    0x00, // U+004F O
+    0x17, 0xE2, 0x82, 0x50, 0x22, 0x82, 0x5F, 0x8A, 0x00, 0x10, 0x00, 0x00, // U+0050 P
+    0x11, 0xE2, 0x42, 0x58, 0x4A, 0x04, 0x0B, 0x0D, 0x21, 0x23, 0xE4, 0x0C,
+    0x80, 0x90, 0x00, // U+0051 Q
+    0x17, 0xE2, 0x82, 0x50, 0x22, 0x83, 0x5F, 0x8A, 0x09, 0x40, 0x8A, 0x03,
+    0x00, 0x00, // U+0052 R
+    0x11, 0xE2, 0x46, 0x50, 0x02, 0x70, 0x43, 0xC8, 0x04, 0xA0, 0x56, 0x1A,
+    0x7C, 0x40, 0x00, // U+0053 S
+    0x1F, 0xFA, 0x10, 0x00, 0x10, 0x00, 0x00, // U+0054 T
+    0x14, 0x08, 0x01, 0x21, 0x23, 0xC4, 0x00, 0x00, // U+0055 U
+    0x14, 0x09, 0x21, 0x04, 0x48, 0x23, 0xC4, 0x30, 0x40, 0x00, // U+0056 V
+    0x18, 0x04, 0xA6, 0x42, 0xA5, 0x12, 0x11, 0x00, 0x00, // U+0057 W
+    0x14, 0x0A, 0x42, 0x22, 0x42, 0x18, 0x22, 0x42, 0x42, 0x28, 0x14, 0x00,
+    0x00, // U+0058 X
+    0x18, 0x0A, 0x82, 0x48, 0x84, 0x50, 0x42, 0x00, 0x40, 0x00, // U+0059 Y
+    0x17, 0xFA, 0x01, 0x40, 0x48, 0x11, 0x06, 0x20, 0x84, 0x20, 0x8C, 0x11,
+    0x02, 0x40, 0x50, 0x0B, 0xFD, 0x00, 0x00, // U+005A Z
+    0x10, 0xE2, 0x10, 0x00, 0x08, 0x71, 0x00, 0x00, // U+005B [
+    0x14, 0x02, 0x40, 0x22, 0x02, 0x10, 0x10, 0x41, 0x02, 0x10, 0x12, 0x00,
+    0x00, // U+005C
+    0x11, 0xC2, 0x08, 0x00, 0x08, 0xE1, 0x00, 0x00, // U+005D ]
+    0x10, 0xE2, 0x36, 0x4C, 0x6B, 0x07, 0x00, 0x00, 0x00, // U+005E ^
+    0x00, 0x00, 0x3F, 0xF8, // U+005F _
+    0x26, 0x04, 0x60, 0x86, 0x10, 0x00, 0x00, 0x00, // U+0060 `
+    0x02, 0x3E, 0x48, 0x68, 0x05, 0x1F, 0xAC, 0x15, 0x02, 0xA0, 0xD6, 0x3A,
+    0x7D, 0x40, 0x00, // U+0061 a
+    0x14, 0x00, 0xAF, 0x16, 0x12, 0x81, 0x05, 0x84, 0xAF, 0x10, 0x00, 0x00, // U+0062 b
+    0x02, 0x3C, 0x48, 0x4A, 0x00, 0x12, 0x12, 0x3C, 0x40, 0x00, // U+0063 c
+    0x10, 0x08, 0x8F, 0x52, 0x1A, 0x81, 0x04, 0x86, 0x8F, 0x50, 0x00, 0x00, // U+0064 d
+    0x02, 0x3C, 0x48, 0x4A, 0x04, 0xBF, 0xD4, 0x01, 0x20, 0xA3, 0xE4, 0x00,
+    0x00, // U+0065 e
+    0x10, 0x72, 0x10, 0x27, 0xE4, 0x20, 0x01, 0x00, 0x00, // U+0066 f
+    0x02, 0x3D, 0x48, 0x6A, 0x04, 0x12, 0x1A, 0x3D, 0x40, 0x29, 0x09, 0x1E,
+    0x20, 0x00, // U+0067 g
+    0x14, 0x00, 0xAF, 0x96, 0x1A, 0x81, 0x01, 0x00, 0x00, // U+0068 h
+    0x10, 0x81, 0x00, 0x27, 0x04, 0x20, 0x02, 0xFE, 0x40, 0x00, // U+0069 i
+    0x10, 0x41, 0x00, 0x23, 0x84, 0x10, 0x00, 0x4E, 0x08, 0x00, // U+006A j
+    0x14, 0x00, 0xA1, 0x14, 0x42, 0x90, 0x54, 0x0B, 0x41, 0x44, 0x28, 0x45,
+    0x04, 0xA0, 0x50, 0x00, 0x00, // U+006B k
+    0x17, 0x82, 0x10, 0x00, 0x20, 0xE4, 0x00, 0x00, // U+006C l
+    0x02, 0xFC, 0x52, 0x40, 0x10, 0x00, 0x00, // U+006D m
+    0x02, 0xBE, 0x58, 0x6A, 0x04, 0x04, 0x00, 0x00, // U+006E n
+    0x02, 0x3C, 0x48, 0x4A, 0x04, 0x12, 0x12, 0x3C, 0x40, 0x00, // U+006F o
+    0x02, 0xBC, 0x58, 0x4A, 0x04, 0x16, 0x12, 0xBC, 0x50, 0x02, 0x00, 0x00, // U+0070 p
+    0x02, 0x3D, 0x48, 0x6A, 0x04, 0x12, 0x1A, 0x3D, 0x40, 0x22, 0x00, 0x00, // U+0071 q
+    0x02, 0x2E, 0x46, 0x28, 0x80, 0x04, 0x00, 0x00, // U+0072 r
+    0x02, 0x3E, 0x58, 0x2A, 0x01, 0x60, 0x27, 0xE4, 0x06, 0x80, 0x54, 0x1A,
+    0x7C, 0x40, 0x00, // U+0073 s
+    0x08, 0x80, 0xBF, 0x11, 0x00, 0x08, 0x71, 0x00, 0x00, // U+0074 t
+    0x02, 0x81, 0x01, 0x61, 0xA7, 0xD4, 0x00, 0x00, // U+0075 u
+    0x02, 0x81, 0x48, 0x42, 0x24, 0x10, 0xC1, 0x00, 0x00, // U+0076 v
+    0x03, 0x00, 0xA9, 0x92, 0xA9, 0x54, 0xA4, 0x84, 0x40, 0x00, // U+0077 w
+    0x02, 0xC3, 0x48, 0x48, 0x91, 0x0C, 0x08, 0x91, 0x21, 0x2C, 0x34, 0x00,
+    0x00, // U+0078 x
+    0x02, 0x81, 0x48, 0x42, 0x24, 0x21, 0x44, 0x30, 0x41, 0x08, 0x41, 0x38,
+    0x20, 0x00, // U+0079 y
+    0x02, 0xFF, 0x40, 0x28, 0x09, 0x02, 0x21, 0x84, 0x40, 0x90, 0x14, 0x02,
+    0xFF, 0x40, 0x00, // U+007A z
+    0x10, 0x62, 0x10, 0x02, 0x60, 0x42, 0x00, 0x41, 0x88, 0x00, // U+007B {
+    0x10, 0x80, 0x00, 0x00, // U+007C |
+    0x13, 0x02, 0x10, 0x02, 0x0C, 0x42, 0x00, 0x4C, 0x08, 0x00, // U+007D }
+    0x00, 0x4E, 0x2A, 0x39, 0x00, 0x00, 0x00, // U+007E ~
+    0x11, 0xC2, 0x44, 0x11, 0xC2, 0x00, 0x00, 0x00, // U+00B0 °
+    0x04, 0x20, 0x2F, 0xE4, 0x20, 0x20, 0x02, 0xFE, 0x40, 0x00, // U+00B1 ±
+    0x02, 0x81, 0x01, 0x61, 0xAB, 0xDD, 0x00, 0x20, 0x00, // U+00B5 µ
+    0x99, 0x88, 0x01, 0x0C, 0x11, 0xE2, 0x24, 0x12, 0x11, 0x3F, 0x24, 0x25,
+    0x02, 0x40, 0x00, // U+00C4 Ä
+    0x99, 0x88, 0x01, 0x1E, 0x24, 0x25, 0x86, 0xA0, 0x40, 0xB0, 0xD2, 0x12,
+    0x3C, 0x40, 0x00, // U+00D6 Ö
+    0x99, 0x88, 0x01, 0x40, 0x80, 0x12, 0x12, 0x3C, 0x40, 0x00, // U+00DC Ü
+    0x13, 0xE2, 0xC6, 0x50, 0x4A, 0x31, 0x48, 0x14, 0xC2, 0x8E, 0x50, 0x6A,
+    0x04, 0xAF, 0x90, 0x00, 0x00, // U+00DF ß
+    0x11, 0xB1, 0x00, 0x23, 0xE4, 0x86, 0x80, 0x51, 0xFA, 0xC1, 0x50, 0x2A,
+    0x0D, 0x63, 0xA7, 0xD4, 0x00, 0x00, // U+00E4 ä
+    0x43, 0x08, 0x90, 0x86, 0x10, 0x02, 0x3E, 0x48, 0x68, 0x05, 0x1F, 0xAC,
+    0x15, 0x02, 0xA0, 0xD6, 0x3A, 0x7D, 0x40, 0x00, // U+00E5 å
+    0x02, 0x3C, 0x48, 0x4A, 0x00, 0x12, 0x12, 0x3C, 0x41, 0x08, 0x11, 0x0E,
+    0x20, 0x00, // U+00E7 ç
+    0x22, 0x04, 0x60, 0x86, 0x10, 0x02, 0x3C, 0x48, 0x4A, 0x04, 0xBF, 0xD4,
+    0x01, 0x20, 0xA3, 0xE4, 0x00, 0x00, // U+00E8 è
+    0x20, 0x64, 0x18, 0x86, 0x10, 0x02, 0x3C, 0x48, 0x4A, 0x04, 0xBF, 0xD4,
+    0x01, 0x20, 0xA3, 0xE4, 0x00, 0x00, // U+00E9 é
+    0x21, 0x84, 0x50, 0x99, 0x10, 0x02, 0x3C, 0x48, 0x4A, 0x04, 0xBF, 0xD4,
+    0x01, 0x20, 0xA3, 0xE4, 0x00, 0x00, // U+00EA ê
+    0x13, 0xA2, 0x5C, 0x40, 0x0A, 0xF9, 0x61, 0xA8, 0x10, 0x10, 0x00, 0x00, // U+00F1 ñ
+    0x13, 0x31, 0x00, 0x23, 0xC4, 0x84, 0xA0, 0x41, 0x21, 0x23, 0xC4, 0x00,
+    0x00, // U+00F6 ö
+    0x02, 0x3F, 0x48, 0x6A, 0x1D, 0x46, 0xA9, 0x95, 0x62, 0xB8, 0x56, 0x12,
+    0xFC, 0x40, 0x00, // U+00F8 ø
+    0x13, 0x31, 0x00, 0x28, 0x10, 0x16, 0x1A, 0x7D, 0x40, 0x00, // U+00FC ü
+    0x17, 0xFA, 0xC0, 0x48, 0x08, 0x81, 0x18, 0x21, 0x02, 0x30, 0x44, 0x09,
+    0x01, 0x60, 0x2F, 0xF4, 0x00, 0x00, // U+03A3 Σ
+    0x08, 0xF1, 0x21, 0x2C, 0x35, 0x02, 0x09, 0x08, 0xB9, 0xD0, 0x00, 0x00, // U+03A9 Ω
+    0x02, 0x7B, 0x59, 0x4A, 0x39, 0x43, 0x28, 0x42, 0x8E, 0x59, 0xC9, 0xED,
+    0x00, 0x00, // U+03B1 α
+    0x13, 0xE2, 0xC6, 0x0B, 0x71, 0x67, 0x2C, 0x31, 0x73, 0x2F, 0xC5, 0x80,
+    0x20, 0x00, // U+03B2 β
+    0x03, 0x83, 0x58, 0x49, 0x09, 0x33, 0x26, 0x44, 0x58, 0x8F, 0x10, 0xC0,
+    0x20, 0x00, // U+03B3 γ
+    0x13, 0xE2, 0x60, 0x48, 0x09, 0xF1, 0x33, 0x2C, 0x22, 0xC3, 0x2C, 0x24,
+    0x8C, 0x9F, 0x10, 0x00, 0x00, // U+03B4 δ
+    0x02, 0x7C, 0x58, 0x4A, 0x01, 0x20, 0x27, 0x85, 0x80, 0xA0, 0x16, 0x12,
+    0x7C, 0x40, 0x00, // U+03B5 ε
+    0x13, 0x82, 0x30, 0x42, 0x08, 0x60, 0x87, 0x11, 0xE2, 0x24, 0x4C, 0xC9,
+    0x09, 0x61, 0x28, 0x34, 0x00, 0x00, // U+03BB λ
+    0x02, 0x81, 0x01, 0x61, 0xAB, 0xDD, 0x00, 0x20, 0x00, // U+03BC μ
+    0x02, 0xFF, 0x24, 0x60, 0x48, 0x49, 0x0D, 0x00, 0x00, // U+03C0 π
+    0x17, 0xFA, 0x81, 0x00, 0x10, 0x00, 0x00, // U+041F П
+    0x02, 0xF8, 0x50, 0x82, 0xF8, 0x50, 0x82, 0xF8, 0x40, 0x00, // U+0432 в
+    0x02, 0x3C, 0x48, 0x4A, 0x04, 0xBF, 0xD4, 0x01, 0x20, 0xA3, 0xE4, 0x00,
+    0x00, // U+0435 е
+    0x02, 0x82, 0x50, 0xCA, 0x39, 0x45, 0x29, 0x25, 0x44, 0x58, 0x4A, 0x09,
+    0x00, 0x00, // U+0438 и
+    0x02, 0x81, 0x58, 0x65, 0x4A, 0xAF, 0x54, 0xC9, 0x40, 0x90, 0x00, 0x00, // U+043C м
+    0x02, 0xBC, 0x58, 0x4A, 0x04, 0x16, 0x12, 0xBC, 0x50, 0x02, 0x00, 0x00, // U+0440 р
+    0x02, 0x3E, 0x41, 0x00, 0x10, 0x00, 0x00, // U+0442 т
+    0x00, 0x3F, 0xFC, 0x00, 0x00, // U+2013 –
+    0x11, 0x12, 0x66, 0x59, 0x82, 0x00, 0x00, 0x00, // U+201C “
+    0x13, 0x30, 0xB3, 0x14, 0x42, 0x00, 0x00, 0x00, // U+201D ”
+    0x00, 0x05, 0xB6, 0x40, 0x00, // U+2026 …
+    0x10, 0xF2, 0x31, 0x44, 0x09, 0x00, 0xBF, 0x12, 0x02, 0xF8, 0x48, 0x08,
+    0x81, 0x10, 0xA1, 0xE4, 0x00, 0x00, // U+20AC €
+    0x00, 0x90, 0x16, 0x02, 0xFF, 0x58, 0x09, 0x81, 0x00, 0x00, // U+2190 ←
+    0x02, 0x10, 0x47, 0x09, 0xD1, 0x08, 0x01, 0x00, 0x00, // U+2191 ↑
+    0x00, 0x81, 0x10, 0x12, 0xFF, 0x40, 0x68, 0x19, 0x00, 0x00, // U+2192 →
+    0x02, 0x10, 0x02, 0x54, 0x47, 0x88, 0x61, 0x00, 0x00, // U+2193 ↓
+    0x00, 0x00, 0x00, 0x00
+};
+
+static const uint16_t FontOffset_UnicodeMono16Delta[] = {
+    0, 3, 11, 16, 31, 48, 62, 79, 84, 97, 110, 122,
+    130, 138, 143, 148, 161, 174, 183, 201, 216, 231, 244, 259,
+    272, 287, 302, 310, 320, 333, 341, 354, 368, 386, 399, 414,
+    427, 440, 450, 459, 474, 482, 490, 499, 517, 524, 534, 546,
+    559, 571, 586, 600, 615, 622, 630, 640, 649, 662, 672, 691,
+    699, 712, 720, 729, 733, 741, 756, 768, 778, 790, 803, 812,
+    826, 835, 845, 855, 872, 880, 887, 895, 905, 917, 929, 937,
+    952, 961, 969, 978, 988, 1001, 1015, 1030, 1040, 1044, 1054, 1061,
+    1069, 1079, 1088, 1103, 1118, 1128, 1145, 1163, 1183, 1197, 1215, 1233,
+    1251, 1263, 1276, 1291, 1301, 1319, 1331, 1345, 1359, 1373, 1390, 1405,
+    1423, 1432, 1441, 1448, 1458, 1471, 1485, 1497, 1509, 1516, 1521, 1529,
+    1537, 1542, 1560, 1570, 1579, 1589,
+};
+
+static const uint16_t FontCodepoints_UnicodeMono16Delta[] = {
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+    0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+    0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+    0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+    0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+    0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x00B0,
+    0x00B1, 0x00B5, 0x00C4, 0x00D6, 0x00DC, 0x00DF, 0x00E4, 0x00E5,
+    0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00F1, 0x00F6, 0x00F8, 0x00FC,
+    0x03A3, 0x03A9, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03BB,
+    0x03BC, 0x03C0, 0x041F, 0x0432, 0x0435, 0x0438, 0x043C, 0x0440,
+    0x0442, 0x2013, 0x201C, 0x201D, 0x2026, 0x20AC, 0x2190, 0x2191,
+    0x2192, 0x2193,
+};
+
+FontDef_s Font_UnicodeMono16Delta = {19, 10, 0, FontBitmap_UnicodeMono16Delta, FontOffset_UnicodeMono16Delta, 0, 0,
+                      0, 0, 0, 1, FontCodepoints_UnicodeMono16Delta, 138, 2, 0};
@@ -0,0 +1,331 @@
+/* Generated by ILI9341FontCompiler from DejaVuSansMono.ttf at 16 px, do not edit */
+#include "fonts.h"
+
+static const uint8_t FontBitmap_UnicodeMono16Rle[] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, // U+0020  
+    0xFF, 0x41, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xFE, 0x19, 0x1F,
+    0xFF, 0x00, // U+0021 !
+    0xFF, 0x31, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x30, // U+0022 "
+    0xFF, 0xE1, 0x22, 0x51, 0x21, 0x61, 0x21, 0x39, 0x31, 0x22, 0x51, 0x21,
+    0x61, 0x21, 0x39, 0x31, 0x22, 0x51, 0x21, 0x52, 0x21, 0xFF, 0xE0, // U+0023 #
+    0xFF, 0x51, 0x91, 0x75, 0x42, 0x11, 0x21, 0x31, 0x21, 0x61, 0x21, 0x73,
+    0x93, 0x71, 0x21, 0x61, 0x21, 0x31, 0x21, 0x21, 0x45, 0x71, 0x91, 0xF9, // U+0024 $
+    0xFF, 0x13, 0x61, 0x31, 0x51, 0x31, 0x51, 0x31, 0x63, 0x31, 0x72, 0x62,
+    0x62, 0x23, 0x61, 0x31, 0x51, 0x31, 0x51, 0x31, 0x63, 0xFF, 0xC0, // U+0025 %
+    0xFF, 0x34, 0x51, 0x91, 0x91, 0xA1, 0x81, 0x11, 0x62, 0x12, 0x21, 0x21,
+    0x31, 0x21, 0x21, 0x41, 0x11, 0x21, 0x42, 0x41, 0x32, 0x54, 0x11, 0xFF,
+    0xB0, // U+0026 &
+    0xFF, 0x41, 0x91, 0x91, 0x91, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, // U+0027 '
+    0xFF, 0x52, 0x72, 0x81, 0x91, 0x81, 0x91, 0x91, 0x91, 0x91, 0x91, 0xA1,
+    0x91, 0x92, 0x92, 0xF8, // U+0028 (
+    0xFF, 0x22, 0x92, 0x91, 0x91, 0xA1, 0x91, 0x91, 0x91, 0x91, 0x91, 0x81,
+    0x91, 0x82, 0x72, 0xFB, // U+0029 )
+    0xFF, 0x41, 0x91, 0x61, 0x21, 0x21, 0x45, 0x63, 0x52, 0x11, 0x12, 0x61,
+    0x91, 0xFF, 0xFF, 0xFA, // U+002A *
+    0xFF, 0xFF, 0xE1, 0x91, 0x91, 0x67, 0x61, 0x91, 0x91, 0xFF, 0xFA, // U+002B +
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0x82, 0x82, 0x72, 0x81, 0xF1, // U+002C ,
+    0xFF, 0xFF, 0xFF, 0xD4, 0xFF, 0xFF, 0xF8, // U+002D -
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0x82, 0xFF, 0xE0, // U+002E .
+    0xFF, 0x71, 0x81, 0x91, 0x81, 0x91, 0x81, 0x91, 0x91, 0x81, 0x91, 0x81,
+    0x91, 0x81, 0xFF, 0x80, // U+002F /
+    0xFF, 0x34, 0x51, 0x41, 0x41, 0x41, 0x31, 0x61, 0x21, 0x61, 0x21, 0x22,
+    0x21, 0x21, 0x22, 0x21, 0x21, 0x61, 0x21, 0x61, 0x31, 0x41, 0x41, 0x41,
+    0x54, 0xFF, 0xD0, // U+0030 0
+    0xFF, 0x33, 0x62, 0x11, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x75, 0xFF, 0xC0, // U+0031 1
+    0xFF, 0x25, 0x42, 0x41, 0x31, 0x61, 0x91, 0x91, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x82, 0x78, 0xFF, 0xB0, // U+0032 2
+    0xFF, 0x25, 0x41, 0x51, 0xA1, 0x91, 0x82, 0x44, 0xA1, 0xA1, 0x91, 0x91,
+    0x21, 0x51, 0x45, 0xFF, 0xD0, // U+0033 3
+    0xFF, 0x52, 0x73, 0x71, 0x11, 0x62, 0x11, 0x61, 0x21, 0x51, 0x31, 0x51,
+    0x31, 0x41, 0x41, 0x48, 0x71, 0x91, 0x91, 0xFF, 0xD0, // U+0034 4
+    0xFF, 0x26, 0x41, 0x91, 0x91, 0x95, 0x51, 0x41, 0xA1, 0x91, 0x91, 0x91,
+    0x21, 0x51, 0x45, 0xFF, 0xD0, // U+0035 5
+    0xFF, 0x34, 0x52, 0x31, 0x41, 0x81, 0x91, 0x14, 0x42, 0x41, 0x31, 0x61,
+    0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x31, 0x41, 0x54, 0xFF, 0xD0, // U+0036 6
+    0xFF, 0x18, 0x91, 0x81, 0x91, 0x81, 0x91, 0x81, 0x91, 0x91, 0x81, 0x91,
+    0x81, 0xFF, 0xF1, // U+0037 7
+    0xFF, 0x34, 0x42, 0x42, 0x21, 0x61, 0x21, 0x61, 0x22, 0x42, 0x44, 0x51,
+    0x42, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x31, 0x41, 0x54, 0xFF, 0xD0, // U+0038 8
+    0xFF, 0x34, 0x51, 0x41, 0x31, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61,
+    0x31, 0x42, 0x44, 0x11, 0x91, 0x81, 0x41, 0x32, 0x54, 0xFF, 0xD0, // U+0039 9
+    0xFF, 0xFF, 0xE2, 0x82, 0xFF, 0xF3, 0x28, 0x2F, 0xFE, // U+003A :
+    0xFF, 0xFF, 0xE2, 0x82, 0xFF, 0xF3, 0x28, 0x28, 0x27, 0x28, 0x1F, 0x10, // U+003B ;
+    0xFF, 0xFF, 0x81, 0x64, 0x43, 0x53, 0x73, 0x93, 0x94, 0x91, 0xFF, 0xF6, // U+003C <
+    0xFF, 0xFF, 0xF6, 0x8F, 0x78, 0xFF, 0xFF, 0xB0, // U+003D =
+    0xFF, 0xFF, 0x11, 0x94, 0x93, 0x93, 0x73, 0x53, 0x44, 0x61, 0xFF, 0xFD, // U+003E >
+    0xFF, 0x34, 0x51, 0x32, 0x91, 0x91, 0x82, 0x72, 0x71, 0x91, 0x91, 0xF4,
+    0x19, 0x1F, 0xFF, 0x00, // U+003F ?
+    0xFF, 0xE4, 0x51, 0x32, 0x31, 0x51, 0x31, 0x24, 0x21, 0x22, 0x12, 0x21,
+    0x21, 0x31, 0x21, 0x21, 0x31, 0x21, 0x21, 0x31, 0x21, 0x21, 0x31, 0x21,
+    0x22, 0x12, 0x31, 0x24, 0x31, 0xA1, 0xA4, 0xC0, // U+0040 @
+    0xFF, 0x42, 0x82, 0x74, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x51, 0x41,
+    0x41, 0x41, 0x46, 0x41, 0x41, 0x31, 0x61, 0x21, 0x61, 0xFF, 0xB0, // U+0041 A
+    0xFF, 0x16, 0x41, 0x52, 0x21, 0x61, 0x21, 0x61, 0x21, 0x52, 0x26, 0x41,
+    0x52, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x52, 0x26, 0xFF, 0xD0, // U+0042 B
+    0xFF, 0x44, 0x42, 0x32, 0x31, 0x81, 0x91, 0x91, 0x91, 0x91, 0x91, 0xA1,
+    0x92, 0x32, 0x54, 0xFF, 0xC0, // U+0043 C
+    0xFF, 0x15, 0x51, 0x42, 0x31, 0x51, 0x31, 0x61, 0x21, 0x61, 0x21, 0x61,
+    0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x51, 0x31, 0x42, 0x35, 0xFF,
+    0xE0, // U+0044 D
+    0xFF, 0x18, 0x21, 0x91, 0x91, 0x91, 0x98, 0x21, 0x91, 0x91, 0x91, 0x91,
+    0x98, 0xFF, 0xB0, // U+0045 E
+    0xFF, 0x18, 0x21, 0x91, 0x91, 0x91, 0x97, 0x31, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0xFF, 0xF3, // U+0046 F
+    0xFF, 0x44, 0x42, 0x32, 0x31, 0x81, 0x91, 0x91, 0x91, 0x43, 0x21, 0x61,
+    0x21, 0x61, 0x31, 0x51, 0x32, 0x41, 0x54, 0xFF, 0xC0, // U+0047 G
+    0xFF, 0x11, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x28,
+    0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61,
+    0xFF, 0xB0, // U+0048 H
+    0xFF, 0x25, 0x71, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x75, 0xFF, 0xD0, // U+0049 I
+    0xFF, 0x44, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x32,
+    0x31, 0x55, 0xFF, 0xD0, // U+004A J
+    0xFF, 0x11, 0x51, 0x31, 0x41, 0x41, 0x31, 0x51, 0x21, 0x61, 0x11, 0x72,
+    0x11, 0x61, 0x21, 0x61, 0x31, 0x51, 0x41, 0x41, 0x41, 0x41, 0x51, 0x31,
+    0x61, 0xFF, 0xB0, // U+004B K
+    0xFF, 0x11, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x98, 0xFF, 0xB0, // U+004C L
+    0xFF, 0x12, 0x42, 0x22, 0x42, 0x23, 0x23, 0x21, 0x11, 0x21, 0x11, 0x21,
+    0x11, 0x21, 0x11, 0x21, 0x22, 0x21, 0x21, 0x22, 0x21, 0x21, 0x22, 0x21,
+    0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0xFF, 0xB0, // U+004D M
+    0xFF, 0x12, 0x51, 0x22, 0x51, 0x21, 0x11, 0x41, 0x21, 0x11, 0x41, 0x21,
+    0x21, 0x31, 0x21, 0x21, 0x31, 0x21, 0x31, 0x21, 0x21, 0x31, 0x21, 0x21,
+    0x41, 0x11, 0x21, 0x41, 0x11, 0x21, 0x52, 0x21, 0x52, 0xFF, 0xB0, // U+004E N
+    0xFF, 0x34, 0x51, 0x41, 0x32, 0x42, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61,
+    0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x22, 0x42, 0x31, 0x41, 0x54, 0xFF,
+    0xD0, // U+004F O
+    0xFF, 0x16, 0x41, 0x51, 0x31, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x51,
+    0x36, 0x41, 0x91, 0x91, 0x91, 0x91, 0xFF, 0xF3, // U+0050 P
+    0xFF, 0x34, 0x51, 0x41, 0x32, 0x41, 0x31, 0x61, 0x21, 0x61, 0x21, 0x61,
+    0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x22, 0x42, 0x31, 0x41, 0x55, 0x82,
+    0x91, 0xF7, // U+0051 Q
+    0xFF, 0x16, 0x41, 0x51, 0x31, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x52,
+    0x26, 0x41, 0x51, 0x31, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x71, 0xFF,
+    0xA0, // U+0052 R
+    0xFF, 0x34, 0x51, 0x32, 0x31, 0x91, 0x91, 0xA3, 0x94, 0xA1, 0x91, 0x21,
+    0x61, 0x22, 0x42, 0x35, 0xFF, 0xD0, // U+0053 S
+    0xFF, 0x09, 0x51, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0xFF, 0xF0, // U+0054 T
+    0xFF, 0x11, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21,
+    0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x31, 0x41, 0x54,
+    0xFF, 0xD0, // U+0055 U
+    0xFF, 0x11, 0x61, 0x21, 0x61, 0x31, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+    0x41, 0x51, 0x21, 0x61, 0x21, 0x61, 0x21, 0x64, 0x72, 0x82, 0xFF, 0xE0, // U+0056 V
+    0xFF, 0x01, 0x82, 0x82, 0x81, 0x11, 0x22, 0x21, 0x21, 0x22, 0x21, 0x21,
+    0x22, 0x21, 0x21, 0x22, 0x21, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21,
+    0x11, 0x21, 0x11, 0x21, 0x11, 0x31, 0x41, 0x41, 0x41, 0xFF, 0xC0, // U+0057 W
+    0xFF, 0x11, 0x61, 0x31, 0x41, 0x41, 0x41, 0x51, 0x21, 0x61, 0x21, 0x72,
+    0x82, 0x71, 0x21, 0x61, 0x21, 0x51, 0x41, 0x41, 0x41, 0x31, 0x61, 0xFF,
+    0xB0, // U+0058 X
+    0xFF, 0x01, 0x71, 0x21, 0x51, 0x41, 0x31, 0x51, 0x31, 0x61, 0x11, 0x71,
+    0x11, 0x81, 0x91, 0x91, 0x91, 0x91, 0x91, 0xFF, 0xF0, // U+0059 Y
+    0xFF, 0x18, 0x91, 0x81, 0x81, 0x82, 0x81, 0x81, 0x82, 0x81, 0x81, 0x81,
+    0x98, 0xFF, 0xB0, // U+005A Z
+    0xFF, 0x43, 0x71, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x93, 0xF8, // U+005B [
+    0xFF, 0x11, 0xA1, 0x91, 0xA1, 0x91, 0xA1, 0x91, 0x91, 0xA1, 0x91, 0xA1,
+    0x91, 0xA1, 0xFF, 0x20, // U+005C
+    0xFF, 0x33, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x73, 0xF9, // U+005D ]
+    0xFF, 0x43, 0x62, 0x12, 0x42, 0x32, 0x22, 0x52, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, // U+005E ^
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, // U+005F _
+    0xF7, 0x29, 0x29, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, // U+0060 `
+    0xFF, 0xFF, 0x35, 0x41, 0x42, 0x91, 0x46, 0x22, 0x51, 0x21, 0x61, 0x21,
+    0x52, 0x22, 0x33, 0x35, 0x11, 0xFF, 0xB0, // U+0061 a
+    0xFF, 0x11, 0x91, 0x91, 0x91, 0x14, 0x42, 0x41, 0x31, 0x61, 0x21, 0x61,
+    0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x22, 0x41, 0x31, 0x14, 0xFF, 0xD0, // U+0062 b
+    0xFF, 0xFF, 0x34, 0x51, 0x41, 0x31, 0x91, 0x91, 0x91, 0x91, 0xA1, 0x41,
+    0x54, 0xFF, 0xD0, // U+0063 c
+    0xFF, 0x81, 0x91, 0x91, 0x44, 0x11, 0x31, 0x42, 0x21, 0x61, 0x21, 0x61,
+    0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x31, 0x42, 0x44, 0x11, 0xFF, 0xB0, // U+0064 d
+    0xFF, 0xFF, 0x34, 0x51, 0x41, 0x31, 0x61, 0x21, 0x61, 0x28, 0x21, 0x91,
+    0xA1, 0x51, 0x45, 0xFF, 0xC0, // U+0065 e
+    0xFF, 0x53, 0x61, 0x91, 0x76, 0x61, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0xFF, 0xF0, // U+0066 f
+    0xFF, 0xFF, 0x34, 0x11, 0x31, 0x42, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61,
+    0x21, 0x61, 0x21, 0x61, 0x31, 0x42, 0x44, 0x11, 0x91, 0x31, 0x41, 0x54,
+    0xD0, // U+0067 g
+    0xFF, 0x11, 0x91, 0x91, 0x91, 0x15, 0x32, 0x42, 0x21, 0x61, 0x21, 0x61,
+    0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0xFF, 0xB0, // U+0068 h
+    0xFF, 0x41, 0x91, 0xF2, 0x39, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x16,
+    0x7F, 0xFC, // U+0069 i
+    0xFF, 0x51, 0x91, 0xF2, 0x39, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x16, 0x3F, 0x00, // U+006A j
+    0xFF, 0x11, 0x91, 0x91, 0x91, 0x41, 0x41, 0x31, 0x51, 0x21, 0x61, 0x11,
+    0x72, 0x11, 0x61, 0x31, 0x51, 0x41, 0x41, 0x51, 0x31, 0x61, 0xFF, 0xB0, // U+006B k
+    0xFF, 0x14, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0xA3, 0xFF, 0xC0, // U+006C l
+    0xFF, 0xFF, 0x16, 0x41, 0x21, 0x21, 0x31, 0x21, 0x21, 0x31, 0x21, 0x21,
+    0x31, 0x21, 0x21, 0x31, 0x21, 0x21, 0x31, 0x21, 0x21, 0x31, 0x21, 0x21,
+    0x31, 0x21, 0x21, 0xFF, 0xC0, // U+006D m
+    0xFF, 0xFF, 0x11, 0x15, 0x32, 0x42, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61,
+    0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0xFF, 0xB0, // U+006E n
+    0xFF, 0xFF, 0x34, 0x51, 0x41, 0x31, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21,
+    0x61, 0x21, 0x61, 0x31, 0x41, 0x54, 0xFF, 0xD0, // U+006F o
+    0xFF, 0xFF, 0x11, 0x14, 0x42, 0x41, 0x31, 0x61, 0x21, 0x61, 0x21, 0x61,
+    0x21, 0x61, 0x21, 0x61, 0x22, 0x41, 0x31, 0x14, 0x41, 0x91, 0x91, 0xF3, // U+0070 p
+    0xFF, 0xFF, 0x34, 0x11, 0x31, 0x42, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61,
+    0x21, 0x61, 0x21, 0x61, 0x31, 0x42, 0x44, 0x11, 0x91, 0x91, 0x91, 0xB0, // U+0071 q
+    0xFF, 0xFF, 0x31, 0x13, 0x52, 0x31, 0x41, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0xFF, 0xF1, // U+0072 r
+    0xFF, 0xFF, 0x35, 0x32, 0x51, 0x21, 0x92, 0x96, 0x92, 0x91, 0x21, 0x52,
+    0x35, 0xFF, 0xD0, // U+0073 s
+    0xFF, 0xD1, 0x91, 0x76, 0x61, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xA3,
+    0xFF, 0xD0, // U+0074 t
+    0xFF, 0xFF, 0x11, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61,
+    0x21, 0x61, 0x21, 0x61, 0x22, 0x42, 0x35, 0x11, 0xFF, 0xB0, // U+0075 u
+    0xFF, 0xFF, 0x11, 0x61, 0x31, 0x41, 0x41, 0x41, 0x41, 0x41, 0x51, 0x21,
+    0x61, 0x21, 0x61, 0x21, 0x72, 0x82, 0xFF, 0xE0, // U+0076 v
+    0xFF, 0xFF, 0x01, 0x82, 0x81, 0x11, 0x22, 0x21, 0x21, 0x22, 0x21, 0x21,
+    0x11, 0x11, 0x21, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x31,
+    0x41, 0x41, 0x41, 0xFF, 0xC0, // U+0077 w
+    0xFF, 0xFF, 0x12, 0x42, 0x31, 0x41, 0x51, 0x21, 0x72, 0x82, 0x82, 0x71,
+    0x21, 0x51, 0x41, 0x32, 0x42, 0xFF, 0xB0, // U+0078 x
+    0xFF, 0xFF, 0x11, 0x61, 0x31, 0x41, 0x41, 0x41, 0x41, 0x41, 0x51, 0x21,
+    0x61, 0x21, 0x71, 0x11, 0x72, 0x82, 0x91, 0x81, 0x73, 0xF0, // U+0079 y
+    0xFF, 0xFF, 0x18, 0x91, 0x81, 0x81, 0x72, 0x71, 0x81, 0x81, 0x98, 0xFF,
+    0xB0, // U+007A z
+    0xFF, 0x52, 0x71, 0x91, 0x91, 0x91, 0x91, 0x91, 0x72, 0xA1, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0xA2, 0xD0, // U+007B {
+    0xFF, 0x41, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x50, // U+007C |
+    0xFF, 0x22, 0xA1, 0x91, 0x91, 0x91, 0x91, 0x91, 0xA2, 0x71, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x72, 0xF1, // U+007D }
+    0xFF, 0xFF, 0xFF, 0x23, 0x31, 0x21, 0x33, 0xFF, 0xFF, 0xF7, // U+007E ~
+    0xFF, 0x33, 0x61, 0x31, 0x51, 0x31, 0x51, 0x31, 0x63, 0xFF, 0xFF, 0xFF,
+    0xF9, // U+00B0 °
+    0xFF, 0xF9, 0x19, 0x19, 0x16, 0x76, 0x19, 0x19, 0x1F, 0xB7, 0xFF, 0xC0, // U+00B1 ±
+    0xFF, 0xFF, 0x11, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61,
+    0x21, 0x61, 0x21, 0x61, 0x22, 0x42, 0x21, 0x14, 0x12, 0x11, 0x91, 0x91,
+    0xF3, // U+00B5 µ
+    0x22, 0x22, 0x42, 0x22, 0xF1, 0x28, 0x27, 0x46, 0x12, 0x16, 0x12, 0x16,
+    0x12, 0x15, 0x14, 0x14, 0x14, 0x14, 0x64, 0x14, 0x13, 0x16, 0x12, 0x16,
+    0x1F, 0xFB, // U+00C4 Ä
+    0x22, 0x22, 0x42, 0x22, 0xF0, 0x45, 0x14, 0x13, 0x24, 0x22, 0x16, 0x12,
+    0x16, 0x12, 0x16, 0x12, 0x16, 0x12, 0x16, 0x12, 0x16, 0x12, 0x24, 0x23,
+    0x14, 0x15, 0x4F, 0xFD, // U+00D6 Ö
+    0x22, 0x22, 0x42, 0x22, 0xD1, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61,
+    0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61,
+    0x31, 0x41, 0x54, 0xFF, 0xD0, // U+00DC Ü
+    0xFF, 0x25, 0x42, 0x32, 0x31, 0x51, 0x31, 0x32, 0x41, 0x21, 0x61, 0x21,
+    0x61, 0x22, 0x51, 0x33, 0x31, 0x52, 0x21, 0x61, 0x21, 0x61, 0x21, 0x15,
+    0xFF, 0xC0, // U+00DF ß
+    0xFF, 0x32, 0x12, 0x52, 0x12, 0xF0, 0x54, 0x14, 0x29, 0x14, 0x62, 0x25,
+    0x12, 0x16, 0x12, 0x15, 0x22, 0x23, 0x33, 0x51, 0x1F, 0xFB, // U+00E4 ä
+    0xE2, 0x71, 0x21, 0x61, 0x21, 0x72, 0xF2, 0x54, 0x14, 0x29, 0x14, 0x62,
+    0x25, 0x12, 0x16, 0x12, 0x15, 0x22, 0x23, 0x33, 0x51, 0x1F, 0xFB, // U+00E5 å
+    0xFF, 0xFF, 0x34, 0x51, 0x41, 0x31, 0x91, 0x91, 0x91, 0x91, 0xA1, 0x41,
+    0x54, 0x81, 0xA1, 0x73, 0xD0, // U+00E7 ç
+    0xF8, 0x19, 0x29, 0x2F, 0x24, 0x51, 0x41, 0x31, 0x61, 0x21, 0x61, 0x28,
+    0x21, 0x91, 0xA1, 0x51, 0x45, 0xFF, 0xC0, // U+00E8 è
+    0xFB, 0x27, 0x27, 0x2F, 0x24, 0x51, 0x41, 0x31, 0x61, 0x21, 0x61, 0x28,
+    0x21, 0x91, 0xA1, 0x51, 0x45, 0xFF, 0xC0, // U+00E9 é
+    0xF9, 0x27, 0x11, 0x16, 0x22, 0x1F, 0x14, 0x51, 0x41, 0x31, 0x61, 0x21,
+    0x61, 0x28, 0x21, 0x91, 0xA1, 0x51, 0x45, 0xFF, 0xC0, // U+00EA ê
+    0xFF, 0x23, 0x11, 0x51, 0x13, 0xE1, 0x15, 0x32, 0x42, 0x21, 0x61, 0x21,
+    0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0xFF,
+    0xB0, // U+00F1 ñ
+    0xFF, 0x22, 0x22, 0x42, 0x22, 0xF0, 0x45, 0x14, 0x13, 0x16, 0x12, 0x16,
+    0x12, 0x16, 0x12, 0x16, 0x12, 0x16, 0x13, 0x14, 0x15, 0x4F, 0xFD, // U+00F6 ö
+    0xFF, 0xFF, 0x36, 0x31, 0x42, 0x21, 0x43, 0x21, 0x32, 0x11, 0x21, 0x22,
+    0x21, 0x21, 0x12, 0x31, 0x23, 0x41, 0x22, 0x41, 0x36, 0xFF, 0xD0, // U+00F8 ø
+    0xFF, 0x22, 0x22, 0x42, 0x22, 0xD1, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21,
+    0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x22, 0x42, 0x35, 0x11, 0xFF,
+    0xB0, // U+00FC ü
+    0xFF, 0x18, 0x22, 0x91, 0xA1, 0x92, 0x91, 0x91, 0x82, 0x81, 0x81, 0x82,
+    0x88, 0xFF, 0xB0, // U+03A3 Σ
+    0xFF, 0xD4, 0x51, 0x41, 0x32, 0x42, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61,
+    0x21, 0x61, 0x21, 0x61, 0x31, 0x41, 0x41, 0x41, 0x33, 0x23, 0xFF, 0xB0, // U+03A9 Ω
+    0xFF, 0xFF, 0x24, 0x12, 0x22, 0x21, 0x11, 0x31, 0x33, 0x31, 0x42, 0x31,
+    0x41, 0x41, 0x41, 0x41, 0x33, 0x32, 0x23, 0x44, 0x12, 0xFF, 0xB0, // U+03B1 α
+    0xFF, 0x25, 0x42, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x13,
+    0x42, 0x23, 0x32, 0x42, 0x22, 0x42, 0x22, 0x42, 0x23, 0x22, 0x36, 0x42,
+    0x82, 0x82, 0xF2, // U+03B2 β
+    0xFF, 0xFF, 0x02, 0x52, 0x22, 0x41, 0x41, 0x41, 0x42, 0x22, 0x42, 0x21,
+    0x61, 0x12, 0x64, 0x72, 0x82, 0x82, 0x82, 0x82, 0xE0, // U+03B3 γ
+    0xFF, 0x25, 0x52, 0x81, 0x95, 0x52, 0x22, 0x32, 0x41, 0x32, 0x41, 0x32,
+    0x42, 0x22, 0x42, 0x22, 0x41, 0x41, 0x32, 0x45, 0xFF, 0xD0, // U+03B4 δ
+    0xFF, 0xFF, 0x25, 0x42, 0x41, 0x31, 0xA1, 0x94, 0x52, 0x81, 0x92, 0x41,
+    0x45, 0xFF, 0xD0, // U+03B5 ε
+    0xFF, 0x23, 0x82, 0x91, 0x92, 0x82, 0x83, 0x64, 0x61, 0x21, 0x52, 0x22,
+    0x41, 0x41, 0x32, 0x41, 0x31, 0x52, 0xFF, 0xB0, // U+03BB λ
+    0xFF, 0xFF, 0x11, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61,
+    0x21, 0x61, 0x21, 0x61, 0x22, 0x42, 0x21, 0x14, 0x12, 0x11, 0x91, 0x91,
+    0xF3, // U+03BC μ
+    0xFF, 0xFF, 0x18, 0x28, 0x31, 0x32, 0x41, 0x32, 0x41, 0x32, 0x41, 0x32,
+    0x41, 0x32, 0x41, 0x41, 0x41, 0x42, 0xFF, 0xB0, // U+03C0 π
+    0xFF, 0x18, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61,
+    0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61,
+    0xFF, 0xB0, // U+041F П
+    0xFF, 0xFF, 0x15, 0x51, 0x41, 0x41, 0x41, 0x41, 0x41, 0x45, 0x51, 0x41,
+    0x41, 0x41, 0x41, 0x41, 0x45, 0xFF, 0xE0, // U+0432 в
+    0xFF, 0xFF, 0x34, 0x51, 0x41, 0x31, 0x61, 0x21, 0x61, 0x28, 0x21, 0x91,
+    0xA1, 0x51, 0x45, 0xFF, 0xC0, // U+0435 е
+    0xFF, 0xFF, 0x11, 0x51, 0x31, 0x42, 0x31, 0x33, 0x31, 0x31, 0x11, 0x31,
+    0x21, 0x21, 0x31, 0x11, 0x31, 0x31, 0x11, 0x31, 0x32, 0x41, 0x31, 0x51,
+    0xFF, 0xC0, // U+0438 и
+    0xFF, 0xFF, 0x11, 0x61, 0x22, 0x42, 0x22, 0x42, 0x21, 0x11, 0x21, 0x11,
+    0x21, 0x14, 0x11, 0x21, 0x22, 0x21, 0x21, 0x22, 0x21, 0x21, 0x61, 0x21,
+    0x61, 0xFF, 0xB0, // U+043C м
+    0xFF, 0xFF, 0x11, 0x14, 0x42, 0x41, 0x31, 0x61, 0x21, 0x61, 0x21, 0x61,
+    0x21, 0x61, 0x21, 0x61, 0x22, 0x41, 0x31, 0x14, 0x41, 0x91, 0x91, 0xF3, // U+0440 р
+    0xFF, 0xFF, 0x35, 0x71, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xFF,
+    0xE0, // U+0442 т
+    0xFF, 0xFF, 0xFF, 0xAA, 0xFF, 0xFF, 0xF5, // U+2013 –
+    0xFF, 0x31, 0x31, 0x42, 0x22, 0x32, 0x22, 0x42, 0x22, 0x42, 0x22, 0xFF,
+    0xFF, 0xFF, 0xF8, // U+201C “
+    0xFF, 0x22, 0x22, 0x42, 0x22, 0x42, 0x22, 0x32, 0x22, 0x41, 0x31, 0xFF,
+    0xFF, 0xFF, 0xF9, // U+201D ”
+    0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0x12, 0x12, 0x22, 0x12, 0x12, 0xFF, 0xB0, // U+2026 …
+    0xFF, 0x44, 0x52, 0x31, 0x41, 0x81, 0x91, 0x86, 0x51, 0x85, 0x61, 0xA1,
+    0x91, 0x41, 0x54, 0xFF, 0xC0, // U+20AC €
+    0xFF, 0xFF, 0xF7, 0x18, 0x28, 0x82, 0x29, 0x2F, 0xFF, 0xF6, // U+2190 ←
+    0xFF, 0xFF, 0x41, 0x83, 0x63, 0x11, 0x71, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0xFF, 0xF0, // U+2191 ↑
+    0xFF, 0xFF, 0xFB, 0x1A, 0x13, 0x88, 0x27, 0x2F, 0xFF, 0xF2, // U+2192 →
+    0xFF, 0xFF, 0x41, 0x91, 0x91, 0x91, 0x91, 0x91, 0x71, 0x11, 0x11, 0x64,
+    0x72, 0xFF, 0xE0, // U+2193 ↓
+    0x00, 0x00, 0x00, 0x00
+};
+
+static const uint16_t FontOffset_UnicodeMono16Rle[] = {
+    0, 7, 21, 35, 58, 82, 105, 130, 140, 156, 172, 188,
+    199, 209, 216, 224, 240, 267, 283, 300, 317, 338, 355, 378,
+    393, 417, 440, 449, 461, 473, 481, 493, 509, 541, 564, 588,
+    605, 630, 645, 660, 681, 707, 722, 738, 765, 780, 814, 849,
+    874, 894, 920, 945, 963, 978, 1004, 1028, 1063, 1088, 1109, 1124,
+    1140, 1156, 1172, 1185, 1192, 1201, 1220, 1244, 1259, 1283, 1300, 1315,
+    1340, 1364, 1378, 1395, 1419, 1434, 1463, 1485, 1505, 1529, 1553, 1568,
+    1583, 1597, 1619, 1639, 1668, 1687, 1709, 1722, 1739, 1757, 1774, 1784,
+    1797, 1809, 1834, 1860, 1888, 1917, 1943, 1965, 1988, 2005, 2024, 2043,
+    2064, 2089, 2112, 2135, 2160, 2175, 2199, 2222, 2249, 2270, 2292, 2307,
+    2327, 2352, 2372, 2398, 2417, 2434, 2460, 2487, 2511, 2524, 2531, 2546,
+    2561, 2573, 2590, 2600, 2614, 2624,
+};
+
+static const uint16_t FontCodepoints_UnicodeMono16Rle[] = {
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+    0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+    0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+    0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+    0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+    0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x00B0,
+    0x00B1, 0x00B5, 0x00C4, 0x00D6, 0x00DC, 0x00DF, 0x00E4, 0x00E5,
+    0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00F1, 0x00F6, 0x00F8, 0x00FC,
+    0x03A3, 0x03A9, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03BB,
+    0x03BC, 0x03C0, 0x041F, 0x0432, 0x0435, 0x0438, 0x043C, 0x0440,
+    0x0442, 0x2013, 0x201C, 0x201D, 0x2026, 0x20AC, 0x2190, 0x2191,
+    0x2192, 0x2193,
+};
+
+FontDef_s Font_UnicodeMono16Rle = {19, 10, 0, FontBitmap_UnicodeMono16Rle, FontOffset_UnicodeMono16Rle, 0, 0,
+                      0, 0, 0, 1, FontCodepoints_UnicodeMono16Rle, 138, 1, 0};
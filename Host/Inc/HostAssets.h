@@ -0,0 +1,69 @@
+/********************************************************************************************************
+ * @Filename: HostAssets.h
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: Images the Makefile converts from Host/Assets with Tools/ImagePack.py
+ *********************************************************************************************************/
+#ifndef __STM32_ILI9341_LIB_HOST_ASSETS_HEADER__
+#define __STM32_ILI9341_LIB_HOST_ASSETS_HEADER__
+
+#include "ILI9341.h"
+
+/**
+ * @brief Assets/Splash.ppm, 200x120 flat-color UI art, compressed, raw and
+ * as QOI
+ */
+#define HOST_SPLASH_WIDTH 200
+#define HOST_SPLASH_HEIGHT 120
+extern const ILI9341RleImage_s Image_Splash;
+extern const uint16_t Image_SplashRaw[];
+extern const uint8_t Image_SplashQoi[];
+extern const uint32_t Image_SplashQoiSize;
+/**
+ * @brief Assets/Photo.ppm, 160x120 photo-like image as QOI and raw
+ */
+#define HOST_PHOTO_WIDTH 160
+#define HOST_PHOTO_HEIGHT 120
+extern const uint8_t Image_Photo[];
+extern const uint32_t Image_PhotoSize;
+extern const uint16_t Image_PhotoRaw[];
+/**
+ * @brief Assets/Photo.ppm as baseline JPEG, 4:2:0 at quality 85 and 4:4:4 at
+ * quality 90 with a restart marker every 5 MCUs
+ */
+extern const uint8_t Image_PhotoJpeg[];
+extern const uint32_t Image_PhotoJpegSize;
+extern const uint8_t Image_PhotoJpeg444[];
+extern const uint32_t Image_PhotoJpeg444Size;
+/**
+ * @brief Assets/PhotoLibjpeg.jpg, Assets/Photo.ppm through libjpeg at quality
+ * 80, 4:2:0 with its standard Huffman tables and a restart marker every 3 MCUs,
+ * and Assets/PhotoLibjpeg.ppm, that file decoded by libjpeg with the chroma
+ * upsampling of the driver (djpeg -nosmooth)
+ */
+extern const uint8_t Image_PhotoLibjpeg[];
+extern const uint32_t Image_PhotoLibjpegSize;
+extern const uint16_t Image_PhotoLibjpegDecoded[];
+/**
+ * @brief Splash and photo as PNG, an indexed and an RGB one
+ */
+extern const uint8_t Image_SplashPng[];
+extern const uint32_t Image_SplashPngSize;
+extern const uint8_t Image_PhotoPng[];
+extern const uint32_t Image_PhotoPngSize;
+/**
+ * @brief Assets/Badge.ppm with the alpha of Assets/BadgeAlpha.ppm, an RGBA PNG
+ */
+#define HOST_BADGE_SIZE 64
+extern const uint8_t Image_BadgePng[];
+extern const uint32_t Image_BadgePngSize;
+/**
+ * @brief Assets/Icon.ppm with the alpha of Assets/IconAlpha.ppm, a 2-bit
+ * indexed PNG with a transparent palette entry
+ */
+#define HOST_ICON_SIZE 27
+extern const uint8_t Image_IconPng[];
+extern const uint32_t Image_IconPngSize;
+
+#endif
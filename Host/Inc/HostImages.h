@@ -0,0 +1,44 @@
+/* Generated by ILI9341ImageCompiler, do not edit */
+#ifndef __ILI9341_IMAGES_HOSTIMAGES_H__
+#define __ILI9341_IMAGES_HOSTIMAGES_H__
+
+#include "ILI9341.h"
+
+/* Splash.ppm 200x120, qoi, 169476 decode cycles */
+#define Image_AssetSplash_WIDTH 200
+#define Image_AssetSplash_HEIGHT 120
+#define Image_AssetSplash_BYTES 5764
+extern const uint8_t Image_AssetSplash[];
+extern const uint32_t Image_AssetSplashSize;
+#define Image_AssetSplash_DRAW(x, y) ILI9341DrawQoi((x), (y), Image_AssetSplash, Image_AssetSplashSize)
+
+/* Splash.ppm 200x120, rle, 24326 decode cycles */
+#define Image_AssetSplashRle_WIDTH 200
+#define Image_AssetSplashRle_HEIGHT 120
+#define Image_AssetSplashRle_BYTES 6228
+extern const ILI9341RleImage_s Image_AssetSplashRle;
+#define Image_AssetSplashRle_DRAW(x, y) ILI9341DrawRleImage((x), (y), &Image_AssetSplashRle)
+
+/* Splash.ppm 200x120, qoi, 169476 decode cycles */
+#define Image_AssetSplashQoi_WIDTH 200
+#define Image_AssetSplashQoi_HEIGHT 120
+#define Image_AssetSplashQoi_BYTES 5764
+extern const uint8_t Image_AssetSplashQoi[];
+extern const uint32_t Image_AssetSplashQoiSize;
+#define Image_AssetSplashQoi_DRAW(x, y) ILI9341DrawQoi((x), (y), Image_AssetSplashQoi, Image_AssetSplashQoiSize)
+
+/* Badge.png 64x64, indexed at 8 bits per pixel, 26636 decode cycles */
+#define Image_AssetBadge_WIDTH 64
+#define Image_AssetBadge_HEIGHT 64
+#define Image_AssetBadge_BYTES 4482
+extern const ILI9341IndexedImage_s Image_AssetBadge;
+#define Image_AssetBadge_DRAW(x, y) ILI9341DrawIndexedImage((x), (y), &Image_AssetBadge)
+
+/* Icon.bmp 27x27, indexed at 2 bits per pixel, 4752 decode cycles */
+#define Image_AssetIcon_WIDTH 27
+#define Image_AssetIcon_HEIGHT 27
+#define Image_AssetIcon_BYTES 213
+extern const ILI9341IndexedImage_s Image_AssetIcon;
+#define Image_AssetIcon_DRAW(x, y) ILI9341DrawIndexedImage((x), (y), &Image_AssetIcon)
+
+#endif
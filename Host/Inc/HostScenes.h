@@ -0,0 +1,44 @@
+/********************************************************************************************************
+ * @Filename: HostScenes.h
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: Scripted scenes replayed by the host test harness
+ *********************************************************************************************************/
+#ifndef __STM32_ILI9341_LIB_HOST_SCENES_HEADER__
+#define __STM32_ILI9341_LIB_HOST_SCENES_HEADER__
+
+#include <stdint.h>
+
+typedef struct {
+  const char *name;
+  void (*draw)(void);
+} HostScene_s;
+
+/**
+ * @brief Scene table, terminated by an entry whose name is NULL
+ */
+extern const HostScene_s HostScenes[];
+/**
+ * @brief Keep the simulated frame as the reference of the scene's next
+ * self-checks
+ */
+void HostSceneSnapshot(void);
+/**
+ * @brief Self-check of a scene, a failed one fails the scene even when its
+ * golden image matches
+ * @param passed result of the check
+ * @param what what was checked, for the failure message
+ * @return passed
+ */
+uint8_t HostSceneExpect(uint8_t passed, const char *what);
+/**
+ * @brief Self-check of a scene, the frame must equal the last snapshot,
+ * otherwise the scene fails even when its golden image matches
+ * @param drawn 0 when the drawing under test already reported a failure
+ * @param what what was drawn, for the failure message
+ * @return 1 when the check passed
+ */
+uint8_t HostSceneExpectSnapshot(uint8_t drawn, const char *what);
+
+#endif
@@ -0,0 +1,123 @@
+/********************************************************************************************************
+ * @Filename: ILI9341Sim.h
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: Simulated ILI9341 controller for running the driver on a host
+ *********************************************************************************************************/
+#ifndef __STM32_ILI9341_LIB_SIMULATOR_HEADER__
+#define __STM32_ILI9341_LIB_SIMULATOR_HEADER__
+
+#include <stdint.h>
+
+/**
+ * @brief Physical panel size, GRAM is always stored in this scan order
+ */
+#define ILI9341_SIM_PANEL_WIDTH 240
+#define ILI9341_SIM_PANEL_HEIGHT 320
+
+/**
+ * @brief Bus activity since the last reset
+ */
+typedef struct {
+  uint32_t registerWrites;
+  uint32_t dataWrites;
+  uint32_t dataReads;
+  uint32_t pixelWrites;
+  uint32_t droppedPixels;
+  uint64_t busCycles;
+  uint32_t timingErrors;
+} ILI9341SimCounters_s;
+
+/**
+ * @brief FSMC timing in HCLK cycles, one access costs about
+ * addressSetup + dataSetup + 1 plus busTurnaround when the direction changes
+ */
+typedef struct {
+  uint8_t addressSetup;
+  uint8_t dataSetup;
+  uint8_t busTurnaround;
+} ILI9341SimTiming_s;
+
+/**
+ * @brief Timing-error model of the panel, minimum HCLK cycles an access needs
+ * @details A write faster than the limits latches the previous value of the
+ * data lines, a read faster than the limits returns the previous read word.
+ * All zero disables the model, which is the reset state
+ */
+typedef struct {
+  uint8_t writeDataSetup;
+  uint8_t writeCycle;
+  uint8_t readDataSetup;
+  uint8_t readCycle;
+} ILI9341SimPanelLimits_s;
+
+/**
+ * @brief Datasheet limits at 168 MHz HCLK: twc 66 ns, twrl 15 ns,
+ * trc 450 ns and trdl 355 ns for GRAM reads
+ */
+extern const ILI9341SimPanelLimits_s ILI9341SimDatasheetLimits;
+
+/**
+ * @brief Power-on reset of the simulated controller, clears GRAM and counters
+ * @return None
+ */
+void ILI9341SimReset(void);
+/**
+ * @brief Set the timing used for the bus cycle counter, the reset value is the
+ * one of MX_FSMC_Init
+ * @param writeTiming timing of write accesses
+ * @param readTiming timing of read accesses
+ * @return None
+ */
+void ILI9341SimSetTiming(const ILI9341SimTiming_s *writeTiming,
+                         const ILI9341SimTiming_s *readTiming);
+/**
+ * @brief Enable the timing-error model
+ * @param limits panel limits, NULL disables the model
+ * @return None
+ */
+void ILI9341SimSetPanelLimits(const ILI9341SimPanelLimits_s *limits);
+/**
+ * @brief Bus cycle with RS low, i.e. a command
+ * @param value value on the data lines
+ * @return None
+ */
+void ILI9341SimWriteRegister(uint16_t value);
+/**
+ * @brief Bus write cycle with RS high, i.e. a parameter or a pixel
+ * @param value value on the data lines
+ * @return None
+ */
+void ILI9341SimWriteData(uint16_t value);
+/**
+ * @brief Bus read cycle with RS high
+ * @return value driven by the controller, 0x2E returns a dummy word followed
+ * by 18-bit pixels packed as R1G1, B1R2, G2B2 like the real panel
+ */
+uint16_t ILI9341SimReadData(void);
+/**
+ * @brief Get the bus counters
+ * @return counters since the last reset
+ */
+ILI9341SimCounters_s ILI9341SimGetCounters(void);
+/**
+ * @brief Get the GRAM contents
+ * @return RGB565 pixels, ILI9341_SIM_PANEL_WIDTH per row in physical scan order
+ */
+const uint16_t *ILI9341SimGetFrame(void);
+/**
+ * @brief Dump the visible frame as a binary PPM
+ * @param path file to write
+ * @return 0 on success, -1 on I/O error
+ */
+int ILI9341SimWritePPM(const char *path);
+/**
+ * @brief Compare the visible frame with a PPM written by ILI9341SimWritePPM
+ * @param path golden image
+ * @param mismatches receives the number of differing pixels
+ * @return 0 when the file was read, -1 when it is missing or malformed
+ */
+int ILI9341SimComparePPM(const char *path, uint32_t *mismatches);
+
+#endif
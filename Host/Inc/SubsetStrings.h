@@ -0,0 +1,25 @@
+/********************************************************************************************************
+ * @Filename: SubsetStrings.h
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: Strings of the font subset scene and the fonts Tools/FontSubset.py cuts down to them
+ *********************************************************************************************************/
+#ifndef __STM32_ILI9341_LIB_HOST_SUBSET_STRINGS_HEADER__
+#define __STM32_ILI9341_LIB_HOST_SUBSET_STRINGS_HEADER__
+
+#include "Fonts/fonts.h"
+
+/**
+ * @brief Strings drawn by the subset scene, terminated by NULL
+ */
+extern const char *const SubsetStrings[];
+
+/**
+ * @brief build/fontsSubset.c, generated from the string literals of SubsetStrings.c
+ */
+extern FontDef_s Font_07x10S;
+extern FontDef_s Font_11x18PS;
+extern FontDef_s Font_16x26A4S;
+
+#endif
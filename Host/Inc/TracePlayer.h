@@ -0,0 +1,47 @@
+/********************************************************************************************************
+ * @Filename: TracePlayer.h
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: Replays bus traces recorded by ILI9341Trace.c into the simulated controller
+ *********************************************************************************************************/
+#ifndef __STM32_ILI9341_LIB_TRACE_PLAYER_HEADER__
+#define __STM32_ILI9341_LIB_TRACE_PLAYER_HEADER__
+
+#include <stdint.h>
+
+/**
+ * @brief Replay paths
+ * @details DIRECT feeds the trace as recorded. OPTIMIZED is the candidate
+ * path, it elides column/page address sets that repeat the latched window,
+ * the frame must stay identical to DIRECT
+ */
+#define TRACE_PLAYER_DIRECT 0
+#define TRACE_PLAYER_OPTIMIZED 1
+
+/**
+ * @brief Cost breakdown by command, data cycles count against the command
+ * they follow
+ */
+typedef struct {
+  uint32_t commands[256];
+  uint32_t dataWrites[256];
+  uint32_t dataReads[256];
+  uint64_t busCycles[256];
+  uint32_t marks;
+  uint32_t dropped;
+} TraceStats_s;
+
+/**
+ * @brief Replay a trace into the simulated controller, the caller resets the
+ * simulator before when it wants a clean panel
+ * @param trace recorded bytes, starting with the header
+ * @param length number of bytes
+ * @param path TRACE_PLAYER_DIRECT or TRACE_PLAYER_OPTIMIZED
+ * @param stats receives the breakdown, cleared first
+ * @return 0 on success, -1 when the trace is malformed
+ */
+int TracePlayerRun(const uint8_t *trace, uint32_t length, uint8_t path,
+                   TraceStats_s *stats);
+
+#endif
@@ -0,0 +1,15 @@
+/********************************************************************************************************
+ * @Filename: gpio.h
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: Host replacement of the CubeMX gpio header
+ *********************************************************************************************************/
+#ifndef __GPIO_H__
+#define __GPIO_H__
+
+#include "main.h"
+
+void MX_GPIO_Init(void);
+
+#endif /*__ GPIO_H__ */
@@ -0,0 +1,51 @@
+/********************************************************************************************************
+ * @Filename: main.h
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: Host replacement of the CubeMX main header, provides the few HAL pieces the driver uses
+ *********************************************************************************************************/
+#ifndef __MAIN_H
+#define __MAIN_H
+
+#include <stdint.h>
+
+typedef struct {
+  uint32_t ODR;
+} GPIO_TypeDef;
+
+typedef enum {
+  GPIO_PIN_RESET = 0,
+  GPIO_PIN_SET
+} GPIO_PinState;
+
+/**
+ * @brief Cycle counter stand-ins, CYCCNT does not advance on the host
+ */
+typedef struct {
+  volatile uint32_t CTRL;
+  volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct {
+  volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+extern GPIO_TypeDef HostGPIOB;
+extern DWT_Type HostDWT;
+extern CoreDebug_Type HostCoreDebug;
+
+#define DWT (&HostDWT)
+#define CoreDebug (&HostCoreDebug)
+#define DWT_CTRL_CYCCNTENA_Msk (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk (1UL << 24)
+
+#define GPIOB (&HostGPIOB)
+#define GPIO_PIN_15 ((uint16_t)0x8000)
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+void HAL_Delay(uint32_t Delay);
+uint32_t HAL_GetTick(void);
+void Error_Handler(void);
+
+#endif /* __MAIN_H */
@@ -0,0 +1,37 @@
+/********************************************************************************************************
+ * @Filename: HALStub.c
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: Host stand-ins for the HAL functions used by the driver
+ *********************************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "main.h"
+
+GPIO_TypeDef HostGPIOB;
+DWT_Type HostDWT;
+CoreDebug_Type HostCoreDebug;
+/**
+ * @brief Simulated millisecond tick, advanced by HAL_Delay and by one on every
+ * HAL_GetTick so polling loops terminate and runs stay deterministic
+ */
+static uint32_t hostTick;
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState) {
+  if (PinState != GPIO_PIN_RESET)
+    GPIOx->ODR |= GPIO_Pin;
+  else
+    GPIOx->ODR &= ~(uint32_t)GPIO_Pin;
+}
+
+void HAL_Delay(uint32_t Delay) { hostTick += Delay; }
+
+uint32_t HAL_GetTick(void) { return hostTick++; }
+
+void MX_GPIO_Init(void) { HostGPIOB.ODR = 0; }
+
+void Error_Handler(void) {
+  fprintf(stderr, "Error_Handler called\n");
+  exit(2);
+}
@@ -0,0 +1,1297 @@
+/* Generated by ILI9341ImageCompiler, do not edit */
+#include "HostImages.h"
+
+const uint8_t Image_AssetSplash[] = {
+    0x71, 0x6F, 0x69, 0x66, 0x00, 0x00, 0x00, 0xC8, 0x00, 0x00, 0x00, 0x78, 0x03, 0x00, 0xFE, 0x00,
+    0x78, 0xD0, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xCC, 0xFE, 0xF8, 0xFC, 0xF8, 0xC6, 0x3D, 0xFD, 0xFD, 0xFD, 0xC4, 0x11, 0xC6, 0x3D,
+    0xFD, 0xFD, 0xCA, 0x11, 0xC4, 0x3D, 0xC1, 0x11, 0xC4, 0x3D, 0xC1, 0x11, 0xC4, 0x3D, 0xC1, 0xFE,
+    0x58, 0xA0, 0xE0, 0xC4, 0xFE, 0x00, 0x78, 0xD0, 0xC1, 0xFE, 0x58, 0xA0, 0xE0, 0xC4, 0xFE, 0x00,
+    0x78, 0xD0, 0xCC, 0x11, 0xC0, 0x3D, 0xC2, 0x11, 0xC0, 0x3D, 0xFD, 0xFD, 0xCA, 0x11, 0xC4, 0x3D,
+    0xC1, 0x11, 0xC4, 0x3D, 0xC1, 0x11, 0xC4, 0x3D, 0xC1, 0xFE, 0x58, 0xA0, 0xE0, 0xC4, 0xFE, 0x00,
+    0x78, 0xD0, 0xC1, 0xFE, 0x58, 0xA0, 0xE0, 0xC4, 0xFE, 0x00, 0x78, 0xD0, 0xCC, 0x11, 0xC0, 0x3D,
+    0xC2, 0x11, 0xC0, 0x3D, 0xFD, 0xFD, 0xCA, 0x11, 0xC4, 0x3D, 0xC1, 0x11, 0xC4, 0x3D, 0xC1, 0x11,
+    0xC4, 0x3D, 0xC1, 0xFE, 0x58, 0xA0, 0xE0, 0xC4, 0xFE, 0x00, 0x78, 0xD0, 0xC1, 0xFE, 0x58, 0xA0,
+    0xE0, 0xC4, 0xFE, 0x00, 0x78, 0xD0, 0xCC, 0x11, 0xC0, 0x3D, 0xC2, 0x11, 0xC0, 0x3D, 0xFD, 0xFD,
+    0xCA, 0x11, 0xC4, 0x3D, 0xC1, 0x11, 0xC4, 0x3D, 0xC1, 0x11, 0xC4, 0x3D, 0xC1, 0xFE, 0x58, 0xA0,
+    0xE0, 0xC4, 0xFE, 0x00, 0x78, 0xD0, 0xC1, 0xFE, 0x58, 0xA0, 0xE0, 0xC4, 0xFE, 0x00, 0x78, 0xD0,
+    0xCC, 0x11, 0xC0, 0x3D, 0xC2, 0x11, 0xC0, 0x3D, 0xFD, 0xFD, 0xCA, 0x11, 0xC4, 0x3D, 0xC1, 0x11,
+    0xC4, 0x3D, 0xC1, 0x11, 0xC4, 0x3D, 0xC1, 0xFE, 0x58, 0xA0, 0xE0, 0xC4, 0xFE, 0x00, 0x78, 0xD0,
+    0xC1, 0xFE, 0x58, 0xA0, 0xE0, 0xC4, 0xFE, 0x00, 0x78, 0xD0, 0xCC, 0x11, 0xC6, 0x3D, 0xFD, 0xFD,
+    0xCA, 0x11, 0xC4, 0x3D, 0xC1, 0x11, 0xC4, 0x3D, 0xC1, 0x11, 0xC4, 0x3D, 0xC1, 0xFE, 0x58, 0xA0,
+    0xE0, 0xC4, 0xFE, 0x00, 0x78, 0xD0, 0xC1, 0xFE, 0x58, 0xA0, 0xE0, 0xC4, 0xFE, 0x00, 0x78, 0xD0,
+    0xCC, 0x11, 0xC6, 0x3D, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC6, 0xFE, 0x18, 0x1C, 0x28, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xF8, 0xFE, 0x38, 0xB4, 0x48, 0xFD, 0xCD, 0x21, 0xD0, 0xFE, 0xE0, 0x50, 0x38, 0xFD,
+    0xCD, 0x21, 0xD8, 0x19, 0xFD, 0xD1, 0x21, 0xCC, 0x2D, 0xFD, 0xD1, 0x21, 0xD5, 0x19, 0xFD, 0xD3,
+    0x21, 0xCA, 0x2D, 0xFD, 0xD3, 0x21, 0xD4, 0x19, 0xFD, 0xD3, 0x21, 0xCA, 0x2D, 0xFD, 0xD3, 0x21,
+    0xD3, 0x19, 0xFD, 0xD5, 0x21, 0xC8, 0x2D, 0xFD, 0xD5, 0x21, 0xD2, 0x19, 0xFD, 0xD5, 0x21, 0xC8,
+    0x2D, 0xFD, 0xD5, 0x21, 0xD2, 0x19, 0xFD, 0xD5, 0x21, 0xC8, 0x2D, 0xFD, 0xD5, 0x21, 0xD2, 0x19,
+    0xFD, 0xD5, 0x21, 0xC8, 0x2D, 0xFD, 0xD5, 0x21, 0xD2, 0x19, 0xFD, 0xD5, 0x21, 0xC8, 0x2D, 0xFD,
+    0xD5, 0x21, 0xD2, 0x19, 0xFD, 0xD5, 0x21, 0xC8, 0x2D, 0xFD, 0xD5, 0x21, 0xD2, 0x19, 0xFD, 0xD5,
+    0x21, 0xC8, 0x2D, 0xFD, 0xD5, 0x21, 0xD2, 0x19, 0xFD, 0xD5, 0x21, 0xC8, 0x2D, 0xFD, 0xD5, 0x21,
+    0xD2, 0x19, 0xFD, 0xD5, 0x21, 0xC8, 0x2D, 0xFD, 0xD5, 0x21, 0xD2, 0x19, 0xD0, 0x11, 0xEF, 0x19,
+    0xD0, 0x21, 0xC8, 0x2D, 0xD0, 0x11, 0xEF, 0x2D, 0xD0, 0x21, 0xD2, 0x19, 0xD0, 0x11, 0xEF, 0x19,
+    0xD0, 0x21, 0xC8, 0x2D, 0xD0, 0x11, 0xEF, 0x2D, 0xD0, 0x21, 0xD2, 0x19, 0xD0, 0x11, 0xEF, 0x19,
+    0xD0, 0x21, 0xC8, 0x2D, 0xD0, 0x11, 0xEF, 0x2D, 0xD0, 0x21, 0xD2, 0x19, 0xD0, 0x11, 0xEF, 0x19,
+    0xD0, 0x21, 0xC8, 0x2D, 0xD0, 0x11, 0xEF, 0x2D, 0xD0, 0x21, 0xD2, 0x19, 0xFD, 0xD5, 0x21, 0xC8,
+    0x2D, 0xFD, 0xD5, 0x21, 0xD2, 0x19, 0xFD, 0xD5, 0x21, 0xC8, 0x2D, 0xFD, 0xD5, 0x21, 0xD2, 0x19,
+    0xFD, 0xD5, 0x21, 0xC8, 0x2D, 0xFD, 0xD5, 0x21, 0xD2, 0x19, 0xFD, 0xD5, 0x21, 0xC8, 0x2D, 0xFD,
+    0xD5, 0x21, 0xD2, 0x19, 0xFD, 0xD5, 0x21, 0xC8, 0x2D, 0xFD, 0xD5, 0x21, 0xD2, 0x19, 0xFD, 0xD5,
+    0x21, 0xC8, 0x2D, 0xFD, 0xD5, 0x21, 0xD2, 0x19, 0xFD, 0xD5, 0x21, 0xC8, 0x2D, 0xFD, 0xD5, 0x21,
+    0xD2, 0x19, 0xFD, 0xD5, 0x21, 0xC8, 0x2D, 0xFD, 0xD5, 0x21, 0xD2, 0x19, 0xFD, 0xD5, 0x21, 0xC8,
+    0x2D, 0xFD, 0xD5, 0x21, 0xD3, 0x19, 0xFD, 0xD3, 0x21, 0xCA, 0x2D, 0xFD, 0xD3, 0x21, 0xD4, 0x19,
+    0xFD, 0xD3, 0x21, 0xCA, 0x2D, 0xFD, 0xD3, 0x21, 0xD5, 0x19, 0xFD, 0xD1, 0x21, 0xCC, 0x2D, 0xFD,
+    0xD1, 0x21, 0xD8, 0x19, 0xFD, 0xCD, 0x21, 0xD0, 0x2D, 0xFD, 0xCD, 0x21, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC6, 0xFE, 0xF8,
+    0xC8, 0x28, 0x21, 0xFD, 0xFD, 0xFD, 0xC6, 0x1D, 0xC9, 0x21, 0xFD, 0xFD, 0xFC, 0x1D, 0xCF, 0x21,
+    0xFD, 0xFD, 0xF8, 0x1D, 0xD1, 0x21, 0xFD, 0xFD, 0xF5, 0x1D, 0xD5, 0x21, 0xFD, 0xFD, 0xF2, 0x1D,
+    0xD7, 0x21, 0xFD, 0xFD, 0xF0, 0x1D, 0xD9, 0x21, 0xFD, 0xFD, 0xEE, 0x1D, 0xDB, 0x21, 0xFD, 0xFD,
+    0xED, 0x1D, 0xCC, 0x21, 0x1D, 0xCC, 0x21, 0xCD, 0xFE, 0x28, 0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80,
+    0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0,
+    0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48,
+    0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE,
+    0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0,
+    0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8,
+    0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80,
+    0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE,
+    0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4,
+    0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0,
+    0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58,
+    0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8,
+    0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C,
+    0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C,
+    0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xE1,
+    0xFE, 0xF8, 0xC8, 0x28, 0xC9, 0x21, 0xC7, 0x1D, 0xC9, 0x21, 0xCC, 0xFE, 0x28, 0xC8, 0xF8, 0x9C,
+    0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE,
+    0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0,
+    0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0,
+    0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0,
+    0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE,
+    0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C,
+    0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C,
+    0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78,
+    0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64,
+    0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0,
+    0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4,
+    0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40,
+    0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C,
+    0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18,
+    0x1C, 0x28, 0xE0, 0xFE, 0xF8, 0xC8, 0x28, 0xC8, 0x21, 0xCB, 0x1D, 0xC8, 0x21, 0xCB, 0xFE, 0x28,
+    0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C,
+    0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C,
+    0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0,
+    0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60,
+    0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C,
+    0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0,
+    0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C,
+    0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE,
+    0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80,
+    0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC,
+    0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54,
+    0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE,
+    0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0,
+    0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C,
+    0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xE0, 0xFE, 0xF8, 0xC8, 0x28, 0xC7, 0x21, 0xCD, 0x1D, 0xC7, 0x21,
+    0xCB, 0xFE, 0x28, 0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0,
+    0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4,
+    0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50,
+    0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C,
+    0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0,
+    0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0,
+    0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1,
+    0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0,
+    0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC,
+    0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60,
+    0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0,
+    0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0,
+    0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1,
+    0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34,
+    0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xE0, 0xFE, 0xF8, 0xC8, 0x28, 0xC6, 0x21, 0xCF,
+    0x1D, 0xC6, 0x21, 0xCB, 0xFE, 0x28, 0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE,
+    0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0,
+    0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C,
+    0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1,
+    0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68,
+    0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE,
+    0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80,
+    0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0,
+    0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70,
+    0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE,
+    0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80,
+    0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC,
+    0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8,
+    0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80,
+    0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xDF, 0xFE, 0xF8, 0xC8, 0x28,
+    0xC7, 0x21, 0xCF, 0x1D, 0xC7, 0x21, 0xCA, 0xFE, 0x28, 0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80, 0xC0,
+    0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0, 0xC1,
+    0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48, 0xAC,
+    0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x58,
+    0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0, 0x80,
+    0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8, 0x9C,
+    0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80, 0x84,
+    0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x90,
+    0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4, 0xFE,
+    0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0, 0x80,
+    0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58, 0x58,
+    0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8, 0x50,
+    0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C, 0xCC,
+    0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C, 0xCC,
+    0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xDF, 0xFE,
+    0xF8, 0xC8, 0x28, 0xC6, 0x21, 0xD1, 0x1D, 0xC6, 0x21, 0xCA, 0xFE, 0x28, 0xC8, 0xF8, 0x9C, 0xCC,
+    0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x38,
+    0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80,
+    0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0,
+    0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0, 0x9C,
+    0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0x70,
+    0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC,
+    0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C, 0xCC,
+    0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78, 0xC1,
+    0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64, 0x68,
+    0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE,
+    0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4, 0xC1,
+    0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40, 0xA0,
+    0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C, 0x28,
+    0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18, 0x1C,
+    0x28, 0xDF, 0xFE, 0xF8, 0xC8, 0x28, 0xC6, 0x21, 0xD1, 0x1D, 0xC6, 0x21, 0xCA, 0xFE, 0x28, 0xC8,
+    0xF8, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C, 0xCC,
+    0xC1, 0xFE, 0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C, 0xCC,
+    0xC0, 0xA0, 0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0, 0x9C,
+    0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60, 0x9C,
+    0xB8, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C, 0xCC,
+    0xC0, 0xFE, 0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0, 0x80,
+    0xC0, 0x9C, 0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C, 0x88,
+    0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x98,
+    0x70, 0x78, 0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE,
+    0xA8, 0x64, 0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC, 0xA0,
+    0x80, 0xC0, 0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54, 0x50,
+    0x9C, 0xC4, 0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0xD0,
+    0x48, 0x40, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE,
+    0xE0, 0x3C, 0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C, 0xC4,
+    0xFE, 0x18, 0x1C, 0x28, 0xDF, 0xFE, 0xF8, 0xC8, 0x28, 0xC6, 0x21, 0xD1, 0x1D, 0xC6, 0x21, 0xCA,
+    0xFE, 0x28, 0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0,
+    0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8,
+    0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8,
+    0xC8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC,
+    0xFE, 0x60, 0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0,
+    0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C,
+    0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE,
+    0x88, 0x7C, 0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0,
+    0x80, 0xFE, 0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0,
+    0xA0, 0x80, 0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0,
+    0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE,
+    0xC0, 0x54, 0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C,
+    0xCC, 0xFE, 0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C,
+    0xCC, 0xC0, 0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20,
+    0xC1, 0x9C, 0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xDF, 0xFE, 0xF8, 0xC8, 0x28, 0xC6, 0x21, 0xD1, 0x1D,
+    0xC6, 0x21, 0xCA, 0xFE, 0x28, 0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30,
+    0xC0, 0xF0, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE,
+    0x40, 0xB4, 0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4,
+    0xFE, 0x50, 0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0,
+    0x80, 0x9C, 0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94,
+    0xB0, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78,
+    0x8C, 0xA0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C,
+    0xCC, 0xC1, 0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C,
+    0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0,
+    0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0,
+    0x60, 0x60, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C,
+    0xCC, 0xC0, 0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0,
+    0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40,
+    0x30, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE,
+    0xE8, 0x34, 0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xDE, 0xFE, 0xF8, 0xC8, 0x28, 0xC6,
+    0x21, 0xD3, 0x1D, 0xC6, 0x21, 0xC9, 0xFE, 0x28, 0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C,
+    0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0, 0xC1, 0x9C,
+    0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48, 0xAC, 0xD0,
+    0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x58, 0xA0,
+    0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0,
+    0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8, 0x9C, 0xC4,
+    0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80, 0x84, 0x98,
+    0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x90, 0x78,
+    0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4, 0xFE, 0xA0,
+    0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0, 0x80, 0x9C,
+    0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58, 0x58, 0xC0,
+    0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8, 0x50, 0x48,
+    0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C, 0xCC, 0xC1,
+    0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C, 0xCC, 0xC0,
+    0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xDF, 0xFE, 0xF8,
+    0xC8, 0x28, 0xC6, 0x21, 0xD1, 0x1D, 0xC6, 0x21, 0xCA, 0xFE, 0x28, 0xC8, 0xF8, 0x9C, 0xCC, 0xA0,
+    0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x38, 0xB8,
+    0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE,
+    0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80,
+    0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0, 0x9C, 0xCC,
+    0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0x70, 0x90,
+    0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE,
+    0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C, 0xCC, 0xC0,
+    0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78, 0xC1, 0x9C,
+    0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64, 0x68, 0xC1,
+    0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0xB8,
+    0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4, 0xC1, 0xFE,
+    0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40, 0xA0, 0x80,
+    0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C, 0x28, 0xC0,
+    0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18, 0x1C, 0x28,
+    0xDF, 0xFE, 0xF8, 0xC8, 0x28, 0xC6, 0x21, 0xD1, 0x1D, 0xC6, 0x21, 0xCA, 0xFE, 0x28, 0xC8, 0xF8,
+    0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C, 0xCC, 0xC1,
+    0xFE, 0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C, 0xCC, 0xC0,
+    0xA0, 0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0, 0x9C, 0xCC,
+    0xC0, 0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60, 0x9C, 0xB8,
+    0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0,
+    0xFE, 0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0,
+    0x9C, 0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C, 0x88, 0xC1,
+    0x9C, 0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x98, 0x70,
+    0x78, 0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xA8,
+    0x64, 0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC, 0xA0, 0x80,
+    0xC0, 0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54, 0x50, 0x9C,
+    0xC4, 0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0xD0, 0x48,
+    0x40, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0xE0,
+    0x3C, 0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C, 0xC4, 0xFE,
+    0x18, 0x1C, 0x28, 0xDF, 0xFE, 0xF8, 0xC8, 0x28, 0xC6, 0x21, 0xD1, 0x1D, 0xC6, 0x21, 0xCA, 0xFE,
+    0x28, 0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80,
+    0x9C, 0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0,
+    0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8,
+    0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE,
+    0x60, 0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80,
+    0x9C, 0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC,
+    0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88,
+    0x7C, 0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80,
+    0xFE, 0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0,
+    0x80, 0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C,
+    0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0,
+    0x54, 0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC,
+    0xFE, 0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC,
+    0xC0, 0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1,
+    0x9C, 0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xDF, 0xFE, 0xF8, 0xC8, 0x28, 0xC6, 0x21, 0xD1, 0x1D, 0xC6,
+    0x21, 0xCA, 0xFE, 0x28, 0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0,
+    0xF0, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40,
+    0xB4, 0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE,
+    0x50, 0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80,
+    0x9C, 0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0,
+    0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C,
+    0xA0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC,
+    0xC1, 0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC,
+    0xC0, 0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C,
+    0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60,
+    0x60, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC,
+    0xC0, 0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80,
+    0xC0, 0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30,
+    0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8,
+    0x34, 0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xDF, 0xFE, 0xF8, 0xC8, 0x28, 0xC7, 0x21,
+    0xCF, 0x1D, 0xC7, 0x21, 0xCA, 0xFE, 0x28, 0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC,
+    0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC,
+    0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1,
+    0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0,
+    0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE,
+    0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1,
+    0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0,
+    0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80,
+    0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C,
+    0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC,
+    0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0,
+    0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C,
+    0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE,
+    0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0,
+    0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xE0, 0xFE, 0xF8, 0xC8,
+    0x28, 0xC6, 0x21, 0xCF, 0x1D, 0xC6, 0x21, 0xCB, 0xFE, 0x28, 0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80,
+    0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0,
+    0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48,
+    0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE,
+    0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0,
+    0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8,
+    0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80,
+    0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE,
+    0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4,
+    0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0,
+    0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58,
+    0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8,
+    0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C,
+    0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C,
+    0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xE0,
+    0xFE, 0xF8, 0xC8, 0x28, 0xC7, 0x21, 0xCD, 0x1D, 0xC7, 0x21, 0xCB, 0xFE, 0x28, 0xC8, 0xF8, 0x9C,
+    0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE,
+    0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0,
+    0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0,
+    0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0,
+    0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE,
+    0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C,
+    0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C,
+    0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78,
+    0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64,
+    0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0,
+    0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4,
+    0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40,
+    0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C,
+    0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18,
+    0x1C, 0x28, 0xE0, 0xFE, 0xF8, 0xC8, 0x28, 0xC8, 0x21, 0xCB, 0x1D, 0xC8, 0x21, 0xCB, 0xFE, 0x28,
+    0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C,
+    0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C,
+    0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0,
+    0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60,
+    0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C,
+    0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0,
+    0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C,
+    0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE,
+    0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80,
+    0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC,
+    0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54,
+    0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE,
+    0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0,
+    0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C,
+    0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xE1, 0xFE, 0xF8, 0xC8, 0x28, 0xC9, 0x21, 0xC7, 0x1D, 0xC9, 0x21,
+    0xCC, 0xFE, 0x28, 0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0,
+    0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4,
+    0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50,
+    0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C,
+    0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0,
+    0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0,
+    0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1,
+    0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0,
+    0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC,
+    0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60,
+    0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0,
+    0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0,
+    0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1,
+    0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34,
+    0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xE2, 0xFE, 0xF8, 0xC8, 0x28, 0xCC, 0x21, 0x1D,
+    0xCC, 0x21, 0xFD, 0xFD, 0xED, 0x1D, 0xDB, 0x21, 0xFD, 0xFD, 0xEE, 0x1D, 0xD9, 0x21, 0xFD, 0xFD,
+    0xF0, 0x1D, 0xD7, 0x21, 0xFD, 0xFD, 0xF2, 0x1D, 0xD5, 0x21, 0xD0, 0xFE, 0x00, 0xC8, 0xF8, 0xFD,
+    0xD0, 0xFE, 0x58, 0x64, 0x78, 0xE6, 0x21, 0xE7, 0x1D, 0xD1, 0x21, 0xD2, 0x25, 0xFD, 0xD0, 0x39,
+    0xE6, 0x21, 0xE8, 0x1D, 0xCF, 0x21, 0xD3, 0x25, 0xFD, 0xD0, 0x39, 0xE6, 0x21, 0xEB, 0x1D, 0xC9,
+    0x21, 0xD6, 0x25, 0xFD, 0xD0, 0x39, 0xE6, 0x21, 0xF0, 0x1D, 0x21, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+};
+
+const uint32_t Image_AssetSplashSize = sizeof(Image_AssetSplash);
+
+static const uint16_t Image_AssetSplashRleData[] = {
+    0x83ED, 0x03DA, 0x8007, 0xFFFF, 0x80BF, 0x03DA, 0x8007, 0xFFFF, 0x8087, 0x03DA, 0x8005, 0xFFFF,
+    0x8002, 0x03DA, 0x8005, 0xFFFF, 0x8002, 0x03DA, 0x8005, 0xFFFF, 0x8002, 0x03DA, 0x8005, 0x5D1C,
+    0x8002, 0x03DA, 0x8005, 0x5D1C, 0x800D, 0x03DA, 0x0001, 0xFFFF, 0xFFFF, 0x8003, 0x03DA, 0x0001,
+    0xFFFF, 0xFFFF, 0x8087, 0x03DA, 0x8005, 0xFFFF, 0x8002, 0x03DA, 0x8005, 0xFFFF, 0x8002, 0x03DA,
+    0x8005, 0xFFFF, 0x8002, 0x03DA, 0x8005, 0x5D1C, 0x8002, 0x03DA, 0x8005, 0x5D1C, 0x800D, 0x03DA,
+    0x0001, 0xFFFF, 0xFFFF, 0x8003, 0x03DA, 0x0001, 0xFFFF, 0xFFFF, 0x8087, 0x03DA, 0x8005, 0xFFFF,
+    0x8002, 0x03DA, 0x8005, 0xFFFF, 0x8002, 0x03DA, 0x8005, 0xFFFF, 0x8002, 0x03DA, 0x8005, 0x5D1C,
+    0x8002, 0x03DA, 0x8005, 0x5D1C, 0x800D, 0x03DA, 0x0001, 0xFFFF, 0xFFFF, 0x8003, 0x03DA, 0x0001,
+    0xFFFF, 0xFFFF, 0x8087, 0x03DA, 0x8005, 0xFFFF, 0x8002, 0x03DA, 0x8005, 0xFFFF, 0x8002, 0x03DA,
+    0x8005, 0xFFFF, 0x8002, 0x03DA, 0x8005, 0x5D1C, 0x8002, 0x03DA, 0x8005, 0x5D1C, 0x800D, 0x03DA,
+    0x0001, 0xFFFF, 0xFFFF, 0x8003, 0x03DA, 0x0001, 0xFFFF, 0xFFFF, 0x8087, 0x03DA, 0x8005, 0xFFFF,
+    0x8002, 0x03DA, 0x8005, 0xFFFF, 0x8002, 0x03DA, 0x8005, 0xFFFF, 0x8002, 0x03DA, 0x8005, 0x5D1C,
+    0x8002, 0x03DA, 0x8005, 0x5D1C, 0x800D, 0x03DA, 0x8007, 0xFFFF, 0x8087, 0x03DA, 0x8005, 0xFFFF,
+    0x8002, 0x03DA, 0x8005, 0xFFFF, 0x8002, 0x03DA, 0x8005, 0xFFFF, 0x8002, 0x03DA, 0x8005, 0x5D1C,
+    0x8002, 0x03DA, 0x8005, 0x5D1C, 0x800D, 0x03DA, 0x8007, 0xFFFF, 0x84A1, 0x03DA, 0x896D, 0x18E5,
+    0x804C, 0x3DA9, 0x8011, 0x18E5, 0x804C, 0xE287, 0x8019, 0x18E5, 0x8050, 0x3DA9, 0x800D, 0x18E5,
+    0x8050, 0xE287, 0x8016, 0x18E5, 0x8052, 0x3DA9, 0x800B, 0x18E5, 0x8052, 0xE287, 0x8015, 0x18E5,
+    0x8052, 0x3DA9, 0x800B, 0x18E5, 0x8052, 0xE287, 0x8014, 0x18E5, 0x8054, 0x3DA9, 0x8009, 0x18E5,
+    0x8054, 0xE287, 0x8013, 0x18E5, 0x8054, 0x3DA9, 0x8009, 0x18E5, 0x8054, 0xE287, 0x8013, 0x18E5,
+    0x8054, 0x3DA9, 0x8009, 0x18E5, 0x8054, 0xE287, 0x8013, 0x18E5, 0x8054, 0x3DA9, 0x8009, 0x18E5,
+    0x8054, 0xE287, 0x8013, 0x18E5, 0x8054, 0x3DA9, 0x8009, 0x18E5, 0x8054, 0xE287, 0x8013, 0x18E5,
+    0x8054, 0x3DA9, 0x8009, 0x18E5, 0x8054, 0xE287, 0x8013, 0x18E5, 0x8054, 0x3DA9, 0x8009, 0x18E5,
+    0x8054, 0xE287, 0x8013, 0x18E5, 0x8054, 0x3DA9, 0x8009, 0x18E5, 0x8054, 0xE287, 0x8013, 0x18E5,
+    0x8054, 0x3DA9, 0x8009, 0x18E5, 0x8054, 0xE287, 0x8013, 0x18E5, 0x8011, 0x3DA9, 0x8030, 0xFFFF,
+    0x8011, 0x3DA9, 0x8009, 0x18E5, 0x8011, 0xE287, 0x8030, 0xFFFF, 0x8011, 0xE287, 0x8013, 0x18E5,
+    0x8011, 0x3DA9, 0x8030, 0xFFFF, 0x8011, 0x3DA9, 0x8009, 0x18E5, 0x8011, 0xE287, 0x8030, 0xFFFF,
+    0x8011, 0xE287, 0x8013, 0x18E5, 0x8011, 0x3DA9, 0x8030, 0xFFFF, 0x8011, 0x3DA9, 0x8009, 0x18E5,
+    0x8011, 0xE287, 0x8030, 0xFFFF, 0x8011, 0xE287, 0x8013, 0x18E5, 0x8011, 0x3DA9, 0x8030, 0xFFFF,
+    0x8011, 0x3DA9, 0x8009, 0x18E5, 0x8011, 0xE287, 0x8030, 0xFFFF, 0x8011, 0xE287, 0x8013, 0x18E5,
+    0x8054, 0x3DA9, 0x8009, 0x18E5, 0x8054, 0xE287, 0x8013, 0x18E5, 0x8054, 0x3DA9, 0x8009, 0x18E5,
+    0x8054, 0xE287, 0x8013, 0x18E5, 0x8054, 0x3DA9, 0x8009, 0x18E5, 0x8054, 0xE287, 0x8013, 0x18E5,
+    0x8054, 0x3DA9, 0x8009, 0x18E5, 0x8054, 0xE287, 0x8013, 0x18E5, 0x8054, 0x3DA9, 0x8009, 0x18E5,
+    0x8054, 0xE287, 0x8013, 0x18E5, 0x8054, 0x3DA9, 0x8009, 0x18E5, 0x8054, 0xE287, 0x8013, 0x18E5,
+    0x8054, 0x3DA9, 0x8009, 0x18E5, 0x8054, 0xE287, 0x8013, 0x18E5, 0x8054, 0x3DA9, 0x8009, 0x18E5,
+    0x8054, 0xE287, 0x8013, 0x18E5, 0x8054, 0x3DA9, 0x8009, 0x18E5, 0x8054, 0xE287, 0x8014, 0x18E5,
+    0x8052, 0x3DA9, 0x800B, 0x18E5, 0x8052, 0xE287, 0x8015, 0x18E5, 0x8052, 0x3DA9, 0x800B, 0x18E5,
+    0x8052, 0xE287, 0x8016, 0x18E5, 0x8050, 0x3DA9, 0x800D, 0x18E5, 0x8050, 0xE287, 0x8019, 0x18E5,
+    0x804C, 0x3DA9, 0x8011, 0x18E5, 0x804C, 0xE287, 0x8805, 0x18E5, 0x0000, 0xFE45, 0x80C1, 0x18E5,
+    0x800A, 0xFE45, 0x80B9, 0x18E5, 0x8010, 0xFE45, 0x80B5, 0x18E5, 0x8012, 0xFE45, 0x80B2, 0x18E5,
+    0x8016, 0xFE45, 0x80AF, 0x18E5, 0x8018, 0xFE45, 0x80AD, 0x18E5, 0x801A, 0xFE45, 0x80AB, 0x18E5,
+    0x801C, 0xFE45, 0x80AA, 0x18E5, 0x800D, 0xFE45, 0x0000, 0x18E5, 0x800D, 0xFE45, 0x800E, 0x18E5,
+    0x0006, 0x2E5F, 0x2E3F, 0x2E3E, 0x2E3E, 0x2E1E, 0x361E, 0x361D, 0x8002, 0x35FD, 0x8002, 0x3DDC,
+    0x0006, 0x3DBC, 0x3DBC, 0x45BB, 0x45BB, 0x459B, 0x459B, 0x459A, 0x8002, 0x4D7A, 0x0005, 0x4D59,
+    0x5559, 0x5559, 0x5539, 0x5539, 0x5538, 0x8002, 0x5D18, 0x000C, 0x5D17, 0x5CF7, 0x64F7, 0x64F7,
+    0x64D7, 0x64D6, 0x64D6, 0x6CB6, 0x6CB6, 0x6CB5, 0x6C95, 0x6C95, 0x7495, 0x8002, 0x7474, 0x0006,
+    0x7C74, 0x7C54, 0x7C53, 0x7C53, 0x7C33, 0x8433, 0x8432, 0x8002, 0x8412, 0x8002, 0x8BF1, 0x0006,
+    0x8BD1, 0x8BD1, 0x93D0, 0x93D0, 0x93B0, 0x93B0, 0x93AF, 0x8002, 0x9B8F, 0x0005, 0x9B6E, 0xA36E,
+    0xA36E, 0xA34E, 0xA34E, 0xA34D, 0x8002, 0xAB2D, 0x000C, 0xAB2C, 0xAB0C, 0xB30C, 0xB30C, 0xB2EC,
+    0xB2EB, 0xB2EB, 0xBACB, 0xBACB, 0xBACA, 0xBAAA, 0xBAAA, 0xC2AA, 0x8002, 0xC289, 0x0006, 0xCA89,
+    0xCA69, 0xCA68, 0xCA68, 0xCA48, 0xD248, 0xD247, 0x8002, 0xD227, 0x8002, 0xDA06, 0x0006, 0xD9E6,
+    0xD9E6, 0xE1E5, 0xE1E5, 0xE1C5, 0xE1C5, 0xE1C4, 0x8002, 0xE9A4, 0x0000, 0xE983, 0x8022, 0x18E5,
+    0x800A, 0xFE45, 0x8008, 0x18E5, 0x800A, 0xFE45, 0x800D, 0x18E5, 0x0006, 0x2E5F, 0x2E3F, 0x2E3E,
+    0x2E3E, 0x2E1E, 0x361E, 0x361D, 0x8002, 0x35FD, 0x8002, 0x3DDC, 0x0006, 0x3DBC, 0x3DBC, 0x45BB,
+    0x45BB, 0x459B, 0x459B, 0x459A, 0x8002, 0x4D7A, 0x0005, 0x4D59, 0x5559, 0x5559, 0x5539, 0x5539,
+    0x5538, 0x8002, 0x5D18, 0x000C, 0x5D17, 0x5CF7, 0x64F7, 0x64F7, 0x64D7, 0x64D6, 0x64D6, 0x6CB6,
+    0x6CB6, 0x6CB5, 0x6C95, 0x6C95, 0x7495, 0x8002, 0x7474, 0x0006, 0x7C74, 0x7C54, 0x7C53, 0x7C53,
+    0x7C33, 0x8433, 0x8432, 0x8002, 0x8412, 0x8002, 0x8BF1, 0x0006, 0x8BD1, 0x8BD1, 0x93D0, 0x93D0,
+    0x93B0, 0x93B0, 0x93AF, 0x8002, 0x9B8F, 0x0005, 0x9B6E, 0xA36E, 0xA36E, 0xA34E, 0xA34E, 0xA34D,
+    0x8002, 0xAB2D, 0x000C, 0xAB2C, 0xAB0C, 0xB30C, 0xB30C, 0xB2EC, 0xB2EB, 0xB2EB, 0xBACB, 0xBACB,
+    0xBACA, 0xBAAA, 0xBAAA, 0xC2AA, 0x8002, 0xC289, 0x0006, 0xCA89, 0xCA69, 0xCA68, 0xCA68, 0xCA48,
+    0xD248, 0xD247, 0x8002, 0xD227, 0x8002, 0xDA06, 0x0006, 0xD9E6, 0xD9E6, 0xE1E5, 0xE1E5, 0xE1C5,
+    0xE1C5, 0xE1C4, 0x8002, 0xE9A4, 0x0000, 0xE983, 0x8021, 0x18E5, 0x8009, 0xFE45, 0x800C, 0x18E5,
+    0x8009, 0xFE45, 0x800C, 0x18E5, 0x0006, 0x2E5F, 0x2E3F, 0x2E3E, 0x2E3E, 0x2E1E, 0x361E, 0x361D,
+    0x8002, 0x35FD, 0x8002, 0x3DDC, 0x0006, 0x3DBC, 0x3DBC, 0x45BB, 0x45BB, 0x459B, 0x459B, 0x459A,
+    0x8002, 0x4D7A, 0x0005, 0x4D59, 0x5559, 0x5559, 0x5539, 0x5539, 0x5538, 0x8002, 0x5D18, 0x000C,
+    0x5D17, 0x5CF7, 0x64F7, 0x64F7, 0x64D7, 0x64D6, 0x64D6, 0x6CB6, 0x6CB6, 0x6CB5, 0x6C95, 0x6C95,
+    0x7495, 0x8002, 0x7474, 0x0006, 0x7C74, 0x7C54, 0x7C53, 0x7C53, 0x7C33, 0x8433, 0x8432, 0x8002,
+    0x8412, 0x8002, 0x8BF1, 0x0006, 0x8BD1, 0x8BD1, 0x93D0, 0x93D0, 0x93B0, 0x93B0, 0x93AF, 0x8002,
+    0x9B8F, 0x0005, 0x9B6E, 0xA36E, 0xA36E, 0xA34E, 0xA34E, 0xA34D, 0x8002, 0xAB2D, 0x000C, 0xAB2C,
+    0xAB0C, 0xB30C, 0xB30C, 0xB2EC, 0xB2EB, 0xB2EB, 0xBACB, 0xBACB, 0xBACA, 0xBAAA, 0xBAAA, 0xC2AA,
+    0x8002, 0xC289, 0x0006, 0xCA89, 0xCA69, 0xCA68, 0xCA68, 0xCA48, 0xD248, 0xD247, 0x8002, 0xD227,
+    0x8002, 0xDA06, 0x0006, 0xD9E6, 0xD9E6, 0xE1E5, 0xE1E5, 0xE1C5, 0xE1C5, 0xE1C4, 0x8002, 0xE9A4,
+    0x0000, 0xE983, 0x8021, 0x18E5, 0x8008, 0xFE45, 0x800E, 0x18E5, 0x8008, 0xFE45, 0x800C, 0x18E5,
+    0x0006, 0x2E5F, 0x2E3F, 0x2E3E, 0x2E3E, 0x2E1E, 0x361E, 0x361D, 0x8002, 0x35FD, 0x8002, 0x3DDC,
+    0x0006, 0x3DBC, 0x3DBC, 0x45BB, 0x45BB, 0x459B, 0x459B, 0x459A, 0x8002, 0x4D7A, 0x0005, 0x4D59,
+    0x5559, 0x5559, 0x5539, 0x5539, 0x5538, 0x8002, 0x5D18, 0x000C, 0x5D17, 0x5CF7, 0x64F7, 0x64F7,
+    0x64D7, 0x64D6, 0x64D6, 0x6CB6, 0x6CB6, 0x6CB5, 0x6C95, 0x6C95, 0x7495, 0x8002, 0x7474, 0x0006,
+    0x7C74, 0x7C54, 0x7C53, 0x7C53, 0x7C33, 0x8433, 0x8432, 0x8002, 0x8412, 0x8002, 0x8BF1, 0x0006,
+    0x8BD1, 0x8BD1, 0x93D0, 0x93D0, 0x93B0, 0x93B0, 0x93AF, 0x8002, 0x9B8F, 0x0005, 0x9B6E, 0xA36E,
+    0xA36E, 0xA34E, 0xA34E, 0xA34D, 0x8002, 0xAB2D, 0x000C, 0xAB2C, 0xAB0C, 0xB30C, 0xB30C, 0xB2EC,
+    0xB2EB, 0xB2EB, 0xBACB, 0xBACB, 0xBACA, 0xBAAA, 0xBAAA, 0xC2AA, 0x8002, 0xC289, 0x0006, 0xCA89,
+    0xCA69, 0xCA68, 0xCA68, 0xCA48, 0xD248, 0xD247, 0x8002, 0xD227, 0x8002, 0xDA06, 0x0006, 0xD9E6,
+    0xD9E6, 0xE1E5, 0xE1E5, 0xE1C5, 0xE1C5, 0xE1C4, 0x8002, 0xE9A4, 0x0000, 0xE983, 0x8021, 0x18E5,
+    0x8007, 0xFE45, 0x8010, 0x18E5, 0x8007, 0xFE45, 0x800C, 0x18E5, 0x0006, 0x2E5F, 0x2E3F, 0x2E3E,
+    0x2E3E, 0x2E1E, 0x361E, 0x361D, 0x8002, 0x35FD, 0x8002, 0x3DDC, 0x0006, 0x3DBC, 0x3DBC, 0x45BB,
+    0x45BB, 0x459B, 0x459B, 0x459A, 0x8002, 0x4D7A, 0x0005, 0x4D59, 0x5559, 0x5559, 0x5539, 0x5539,
+    0x5538, 0x8002, 0x5D18, 0x000C, 0x5D17, 0x5CF7, 0x64F7, 0x64F7, 0x64D7, 0x64D6, 0x64D6, 0x6CB6,
+    0x6CB6, 0x6CB5, 0x6C95, 0x6C95, 0x7495, 0x8002, 0x7474, 0x0006, 0x7C74, 0x7C54, 0x7C53, 0x7C53,
+    0x7C33, 0x8433, 0x8432, 0x8002, 0x8412, 0x8002, 0x8BF1, 0x0006, 0x8BD1, 0x8BD1, 0x93D0, 0x93D0,
+    0x93B0, 0x93B0, 0x93AF, 0x8002, 0x9B8F, 0x0005, 0x9B6E, 0xA36E, 0xA36E, 0xA34E, 0xA34E, 0xA34D,
+    0x8002, 0xAB2D, 0x000C, 0xAB2C, 0xAB0C, 0xB30C, 0xB30C, 0xB2EC, 0xB2EB, 0xB2EB, 0xBACB, 0xBACB,
+    0xBACA, 0xBAAA, 0xBAAA, 0xC2AA, 0x8002, 0xC289, 0x0006, 0xCA89, 0xCA69, 0xCA68, 0xCA68, 0xCA48,
+    0xD248, 0xD247, 0x8002, 0xD227, 0x8002, 0xDA06, 0x0006, 0xD9E6, 0xD9E6, 0xE1E5, 0xE1E5, 0xE1C5,
+    0xE1C5, 0xE1C4, 0x8002, 0xE9A4, 0x0000, 0xE983, 0x8020, 0x18E5, 0x8008, 0xFE45, 0x8010, 0x18E5,
+    0x8008, 0xFE45, 0x800B, 0x18E5, 0x0006, 0x2E5F, 0x2E3F, 0x2E3E, 0x2E3E, 0x2E1E, 0x361E, 0x361D,
+    0x8002, 0x35FD, 0x8002, 0x3DDC, 0x0006, 0x3DBC, 0x3DBC, 0x45BB, 0x45BB, 0x459B, 0x459B, 0x459A,
+    0x8002, 0x4D7A, 0x0005, 0x4D59, 0x5559, 0x5559, 0x5539, 0x5539, 0x5538, 0x8002, 0x5D18, 0x000C,
+    0x5D17, 0x5CF7, 0x64F7, 0x64F7, 0x64D7, 0x64D6, 0x64D6, 0x6CB6, 0x6CB6, 0x6CB5, 0x6C95, 0x6C95,
+    0x7495, 0x8002, 0x7474, 0x0006, 0x7C74, 0x7C54, 0x7C53, 0x7C53, 0x7C33, 0x8433, 0x8432, 0x8002,
+    0x8412, 0x8002, 0x8BF1, 0x0006, 0x8BD1, 0x8BD1, 0x93D0, 0x93D0, 0x93B0, 0x93B0, 0x93AF, 0x8002,
+    0x9B8F, 0x0005, 0x9B6E, 0xA36E, 0xA36E, 0xA34E, 0xA34E, 0xA34D, 0x8002, 0xAB2D, 0x000C, 0xAB2C,
+    0xAB0C, 0xB30C, 0xB30C, 0xB2EC, 0xB2EB, 0xB2EB, 0xBACB, 0xBACB, 0xBACA, 0xBAAA, 0xBAAA, 0xC2AA,
+    0x8002, 0xC289, 0x0006, 0xCA89, 0xCA69, 0xCA68, 0xCA68, 0xCA48, 0xD248, 0xD247, 0x8002, 0xD227,
+    0x8002, 0xDA06, 0x0006, 0xD9E6, 0xD9E6, 0xE1E5, 0xE1E5, 0xE1C5, 0xE1C5, 0xE1C4, 0x8002, 0xE9A4,
+    0x0000, 0xE983, 0x8020, 0x18E5, 0x8007, 0xFE45, 0x8012, 0x18E5, 0x8007, 0xFE45, 0x800B, 0x18E5,
+    0x0006, 0x2E5F, 0x2E3F, 0x2E3E, 0x2E3E, 0x2E1E, 0x361E, 0x361D, 0x8002, 0x35FD, 0x8002, 0x3DDC,
+    0x0006, 0x3DBC, 0x3DBC, 0x45BB, 0x45BB, 0x459B, 0x459B, 0x459A, 0x8002, 0x4D7A, 0x0005, 0x4D59,
+    0x5559, 0x5559, 0x5539, 0x5539, 0x5538, 0x8002, 0x5D18, 0x000C, 0x5D17, 0x5CF7, 0x64F7, 0x64F7,
+    0x64D7, 0x64D6, 0x64D6, 0x6CB6, 0x6CB6, 0x6CB5, 0x6C95, 0x6C95, 0x7495, 0x8002, 0x7474, 0x0006,
+    0x7C74, 0x7C54, 0x7C53, 0x7C53, 0x7C33, 0x8433, 0x8432, 0x8002, 0x8412, 0x8002, 0x8BF1, 0x0006,
+    0x8BD1, 0x8BD1, 0x93D0, 0x93D0, 0x93B0, 0x93B0, 0x93AF, 0x8002, 0x9B8F, 0x0005, 0x9B6E, 0xA36E,
+    0xA36E, 0xA34E, 0xA34E, 0xA34D, 0x8002, 0xAB2D, 0x000C, 0xAB2C, 0xAB0C, 0xB30C, 0xB30C, 0xB2EC,
+    0xB2EB, 0xB2EB, 0xBACB, 0xBACB, 0xBACA, 0xBAAA, 0xBAAA, 0xC2AA, 0x8002, 0xC289, 0x0006, 0xCA89,
+    0xCA69, 0xCA68, 0xCA68, 0xCA48, 0xD248, 0xD247, 0x8002, 0xD227, 0x8002, 0xDA06, 0x0006, 0xD9E6,
+    0xD9E6, 0xE1E5, 0xE1E5, 0xE1C5, 0xE1C5, 0xE1C4, 0x8002, 0xE9A4, 0x0000, 0xE983, 0x8020, 0x18E5,
+    0x8007, 0xFE45, 0x8012, 0x18E5, 0x8007, 0xFE45, 0x800B, 0x18E5, 0x0006, 0x2E5F, 0x2E3F, 0x2E3E,
+    0x2E3E, 0x2E1E, 0x361E, 0x361D, 0x8002, 0x35FD, 0x8002, 0x3DDC, 0x0006, 0x3DBC, 0x3DBC, 0x45BB,
+    0x45BB, 0x459B, 0x459B, 0x459A, 0x8002, 0x4D7A, 0x0005, 0x4D59, 0x5559, 0x5559, 0x5539, 0x5539,
+    0x5538, 0x8002, 0x5D18, 0x000C, 0x5D17, 0x5CF7, 0x64F7, 0x64F7, 0x64D7, 0x64D6, 0x64D6, 0x6CB6,
+    0x6CB6, 0x6CB5, 0x6C95, 0x6C95, 0x7495, 0x8002, 0x7474, 0x0006, 0x7C74, 0x7C54, 0x7C53, 0x7C53,
+    0x7C33, 0x8433, 0x8432, 0x8002, 0x8412, 0x8002, 0x8BF1, 0x0006, 0x8BD1, 0x8BD1, 0x93D0, 0x93D0,
+    0x93B0, 0x93B0, 0x93AF, 0x8002, 0x9B8F, 0x0005, 0x9B6E, 0xA36E, 0xA36E, 0xA34E, 0xA34E, 0xA34D,
+    0x8002, 0xAB2D, 0x000C, 0xAB2C, 0xAB0C, 0xB30C, 0xB30C, 0xB2EC, 0xB2EB, 0xB2EB, 0xBACB, 0xBACB,
+    0xBACA, 0xBAAA, 0xBAAA, 0xC2AA, 0x8002, 0xC289, 0x0006, 0xCA89, 0xCA69, 0xCA68, 0xCA68, 0xCA48,
+    0xD248, 0xD247, 0x8002, 0xD227, 0x8002, 0xDA06, 0x0006, 0xD9E6, 0xD9E6, 0xE1E5, 0xE1E5, 0xE1C5,
+    0xE1C5, 0xE1C4, 0x8002, 0xE9A4, 0x0000, 0xE983, 0x8020, 0x18E5, 0x8007, 0xFE45, 0x8012, 0x18E5,
+    0x8007, 0xFE45, 0x800B, 0x18E5, 0x0006, 0x2E5F, 0x2E3F, 0x2E3E, 0x2E3E, 0x2E1E, 0x361E, 0x361D,
+    0x8002, 0x35FD, 0x8002, 0x3DDC, 0x0006, 0x3DBC, 0x3DBC, 0x45BB, 0x45BB, 0x459B, 0x459B, 0x459A,
+    0x8002, 0x4D7A, 0x0005, 0x4D59, 0x5559, 0x5559, 0x5539, 0x5539, 0x5538, 0x8002, 0x5D18, 0x000C,
+    0x5D17, 0x5CF7, 0x64F7, 0x64F7, 0x64D7, 0x64D6, 0x64D6, 0x6CB6, 0x6CB6, 0x6CB5, 0x6C95, 0x6C95,
+    0x7495, 0x8002, 0x7474, 0x0006, 0x7C74, 0x7C54, 0x7C53, 0x7C53, 0x7C33, 0x8433, 0x8432, 0x8002,
+    0x8412, 0x8002, 0x8BF1, 0x0006, 0x8BD1, 0x8BD1, 0x93D0, 0x93D0, 0x93B0, 0x93B0, 0x93AF, 0x8002,
+    0x9B8F, 0x0005, 0x9B6E, 0xA36E, 0xA36E, 0xA34E, 0xA34E, 0xA34D, 0x8002, 0xAB2D, 0x000C, 0xAB2C,
+    0xAB0C, 0xB30C, 0xB30C, 0xB2EC, 0xB2EB, 0xB2EB, 0xBACB, 0xBACB, 0xBACA, 0xBAAA, 0xBAAA, 0xC2AA,
+    0x8002, 0xC289, 0x0006, 0xCA89, 0xCA69, 0xCA68, 0xCA68, 0xCA48, 0xD248, 0xD247, 0x8002, 0xD227,
+    0x8002, 0xDA06, 0x0006, 0xD9E6, 0xD9E6, 0xE1E5, 0xE1E5, 0xE1C5, 0xE1C5, 0xE1C4, 0x8002, 0xE9A4,
+    0x0000, 0xE983, 0x8020, 0x18E5, 0x8007, 0xFE45, 0x8012, 0x18E5, 0x8007, 0xFE45, 0x800B, 0x18E5,
+    0x0006, 0x2E5F, 0x2E3F, 0x2E3E, 0x2E3E, 0x2E1E, 0x361E, 0x361D, 0x8002, 0x35FD, 0x8002, 0x3DDC,
+    0x0006, 0x3DBC, 0x3DBC, 0x45BB, 0x45BB, 0x459B, 0x459B, 0x459A, 0x8002, 0x4D7A, 0x0005, 0x4D59,
+    0x5559, 0x5559, 0x5539, 0x5539, 0x5538, 0x8002, 0x5D18, 0x000C, 0x5D17, 0x5CF7, 0x64F7, 0x64F7,
+    0x64D7, 0x64D6, 0x64D6, 0x6CB6, 0x6CB6, 0x6CB5, 0x6C95, 0x6C95, 0x7495, 0x8002, 0x7474, 0x0006,
+    0x7C74, 0x7C54, 0x7C53, 0x7C53, 0x7C33, 0x8433, 0x8432, 0x8002, 0x8412, 0x8002, 0x8BF1, 0x0006,
+    0x8BD1, 0x8BD1, 0x93D0, 0x93D0, 0x93B0, 0x93B0, 0x93AF, 0x8002, 0x9B8F, 0x0005, 0x9B6E, 0xA36E,
+    0xA36E, 0xA34E, 0xA34E, 0xA34D, 0x8002, 0xAB2D, 0x000C, 0xAB2C, 0xAB0C, 0xB30C, 0xB30C, 0xB2EC,
+    0xB2EB, 0xB2EB, 0xBACB, 0xBACB, 0xBACA, 0xBAAA, 0xBAAA, 0xC2AA, 0x8002, 0xC289, 0x0006, 0xCA89,
+    0xCA69, 0xCA68, 0xCA68, 0xCA48, 0xD248, 0xD247, 0x8002, 0xD227, 0x8002, 0xDA06, 0x0006, 0xD9E6,
+    0xD9E6, 0xE1E5, 0xE1E5, 0xE1C5, 0xE1C5, 0xE1C4, 0x8002, 0xE9A4, 0x0000, 0xE983, 0x801F, 0x18E5,
+    0x8007, 0xFE45, 0x8014, 0x18E5, 0x8007, 0xFE45, 0x800A, 0x18E5, 0x0006, 0x2E5F, 0x2E3F, 0x2E3E,
+    0x2E3E, 0x2E1E, 0x361E, 0x361D, 0x8002, 0x35FD, 0x8002, 0x3DDC, 0x0006, 0x3DBC, 0x3DBC, 0x45BB,
+    0x45BB, 0x459B, 0x459B, 0x459A, 0x8002, 0x4D7A, 0x0005, 0x4D59, 0x5559, 0x5559, 0x5539, 0x5539,
+    0x5538, 0x8002, 0x5D18, 0x000C, 0x5D17, 0x5CF7, 0x64F7, 0x64F7, 0x64D7, 0x64D6, 0x64D6, 0x6CB6,
+    0x6CB6, 0x6CB5, 0x6C95, 0x6C95, 0x7495, 0x8002, 0x7474, 0x0006, 0x7C74, 0x7C54, 0x7C53, 0x7C53,
+    0x7C33, 0x8433, 0x8432, 0x8002, 0x8412, 0x8002, 0x8BF1, 0x0006, 0x8BD1, 0x8BD1, 0x93D0, 0x93D0,
+    0x93B0, 0x93B0, 0x93AF, 0x8002, 0x9B8F, 0x0005, 0x9B6E, 0xA36E, 0xA36E, 0xA34E, 0xA34E, 0xA34D,
+    0x8002, 0xAB2D, 0x000C, 0xAB2C, 0xAB0C, 0xB30C, 0xB30C, 0xB2EC, 0xB2EB, 0xB2EB, 0xBACB, 0xBACB,
+    0xBACA, 0xBAAA, 0xBAAA, 0xC2AA, 0x8002, 0xC289, 0x0006, 0xCA89, 0xCA69, 0xCA68, 0xCA68, 0xCA48,
+    0xD248, 0xD247, 0x8002, 0xD227, 0x8002, 0xDA06, 0x0006, 0xD9E6, 0xD9E6, 0xE1E5, 0xE1E5, 0xE1C5,
+    0xE1C5, 0xE1C4, 0x8002, 0xE9A4, 0x0000, 0xE983, 0x8020, 0x18E5, 0x8007, 0xFE45, 0x8012, 0x18E5,
+    0x8007, 0xFE45, 0x800B, 0x18E5, 0x0006, 0x2E5F, 0x2E3F, 0x2E3E, 0x2E3E, 0x2E1E, 0x361E, 0x361D,
+    0x8002, 0x35FD, 0x8002, 0x3DDC, 0x0006, 0x3DBC, 0x3DBC, 0x45BB, 0x45BB, 0x459B, 0x459B, 0x459A,
+    0x8002, 0x4D7A, 0x0005, 0x4D59, 0x5559, 0x5559, 0x5539, 0x5539, 0x5538, 0x8002, 0x5D18, 0x000C,
+    0x5D17, 0x5CF7, 0x64F7, 0x64F7, 0x64D7, 0x64D6, 0x64D6, 0x6CB6, 0x6CB6, 0x6CB5, 0x6C95, 0x6C95,
+    0x7495, 0x8002, 0x7474, 0x0006, 0x7C74, 0x7C54, 0x7C53, 0x7C53, 0x7C33, 0x8433, 0x8432, 0x8002,
+    0x8412, 0x8002, 0x8BF1, 0x0006, 0x8BD1, 0x8BD1, 0x93D0, 0x93D0, 0x93B0, 0x93B0, 0x93AF, 0x8002,
+    0x9B8F, 0x0005, 0x9B6E, 0xA36E, 0xA36E, 0xA34E, 0xA34E, 0xA34D, 0x8002, 0xAB2D, 0x000C, 0xAB2C,
+    0xAB0C, 0xB30C, 0xB30C, 0xB2EC, 0xB2EB, 0xB2EB, 0xBACB, 0xBACB, 0xBACA, 0xBAAA, 0xBAAA, 0xC2AA,
+    0x8002, 0xC289, 0x0006, 0xCA89, 0xCA69, 0xCA68, 0xCA68, 0xCA48, 0xD248, 0xD247, 0x8002, 0xD227,
+    0x8002, 0xDA06, 0x0006, 0xD9E6, 0xD9E6, 0xE1E5, 0xE1E5, 0xE1C5, 0xE1C5, 0xE1C4, 0x8002, 0xE9A4,
+    0x0000, 0xE983, 0x8020, 0x18E5, 0x8007, 0xFE45, 0x8012, 0x18E5, 0x8007, 0xFE45, 0x800B, 0x18E5,
+    0x0006, 0x2E5F, 0x2E3F, 0x2E3E, 0x2E3E, 0x2E1E, 0x361E, 0x361D, 0x8002, 0x35FD, 0x8002, 0x3DDC,
+    0x0006, 0x3DBC, 0x3DBC, 0x45BB, 0x45BB, 0x459B, 0x459B, 0x459A, 0x8002, 0x4D7A, 0x0005, 0x4D59,
+    0x5559, 0x5559, 0x5539, 0x5539, 0x5538, 0x8002, 0x5D18, 0x000C, 0x5D17, 0x5CF7, 0x64F7, 0x64F7,
+    0x64D7, 0x64D6, 0x64D6, 0x6CB6, 0x6CB6, 0x6CB5, 0x6C95, 0x6C95, 0x7495, 0x8002, 0x7474, 0x0006,
+    0x7C74, 0x7C54, 0x7C53, 0x7C53, 0x7C33, 0x8433, 0x8432, 0x8002, 0x8412, 0x8002, 0x8BF1, 0x0006,
+    0x8BD1, 0x8BD1, 0x93D0, 0x93D0, 0x93B0, 0x93B0, 0x93AF, 0x8002, 0x9B8F, 0x0005, 0x9B6E, 0xA36E,
+    0xA36E, 0xA34E, 0xA34E, 0xA34D, 0x8002, 0xAB2D, 0x000C, 0xAB2C, 0xAB0C, 0xB30C, 0xB30C, 0xB2EC,
+    0xB2EB, 0xB2EB, 0xBACB, 0xBACB, 0xBACA, 0xBAAA, 0xBAAA, 0xC2AA, 0x8002, 0xC289, 0x0006, 0xCA89,
+    0xCA69, 0xCA68, 0xCA68, 0xCA48, 0xD248, 0xD247, 0x8002, 0xD227, 0x8002, 0xDA06, 0x0006, 0xD9E6,
+    0xD9E6, 0xE1E5, 0xE1E5, 0xE1C5, 0xE1C5, 0xE1C4, 0x8002, 0xE9A4, 0x0000, 0xE983, 0x8020, 0x18E5,
+    0x8007, 0xFE45, 0x8012, 0x18E5, 0x8007, 0xFE45, 0x800B, 0x18E5, 0x0006, 0x2E5F, 0x2E3F, 0x2E3E,
+    0x2E3E, 0x2E1E, 0x361E, 0x361D, 0x8002, 0x35FD, 0x8002, 0x3DDC, 0x0006, 0x3DBC, 0x3DBC, 0x45BB,
+    0x45BB, 0x459B, 0x459B, 0x459A, 0x8002, 0x4D7A, 0x0005, 0x4D59, 0x5559, 0x5559, 0x5539, 0x5539,
+    0x5538, 0x8002, 0x5D18, 0x000C, 0x5D17, 0x5CF7, 0x64F7, 0x64F7, 0x64D7, 0x64D6, 0x64D6, 0x6CB6,
+    0x6CB6, 0x6CB5, 0x6C95, 0x6C95, 0x7495, 0x8002, 0x7474, 0x0006, 0x7C74, 0x7C54, 0x7C53, 0x7C53,
+    0x7C33, 0x8433, 0x8432, 0x8002, 0x8412, 0x8002, 0x8BF1, 0x0006, 0x8BD1, 0x8BD1, 0x93D0, 0x93D0,
+    0x93B0, 0x93B0, 0x93AF, 0x8002, 0x9B8F, 0x0005, 0x9B6E, 0xA36E, 0xA36E, 0xA34E, 0xA34E, 0xA34D,
+    0x8002, 0xAB2D, 0x000C, 0xAB2C, 0xAB0C, 0xB30C, 0xB30C, 0xB2EC, 0xB2EB, 0xB2EB, 0xBACB, 0xBACB,
+    0xBACA, 0xBAAA, 0xBAAA, 0xC2AA, 0x8002, 0xC289, 0x0006, 0xCA89, 0xCA69, 0xCA68, 0xCA68, 0xCA48,
+    0xD248, 0xD247, 0x8002, 0xD227, 0x8002, 0xDA06, 0x0006, 0xD9E6, 0xD9E6, 0xE1E5, 0xE1E5, 0xE1C5,
+    0xE1C5, 0xE1C4, 0x8002, 0xE9A4, 0x0000, 0xE983, 0x8020, 0x18E5, 0x8007, 0xFE45, 0x8012, 0x18E5,
+    0x8007, 0xFE45, 0x800B, 0x18E5, 0x0006, 0x2E5F, 0x2E3F, 0x2E3E, 0x2E3E, 0x2E1E, 0x361E, 0x361D,
+    0x8002, 0x35FD, 0x8002, 0x3DDC, 0x0006, 0x3DBC, 0x3DBC, 0x45BB, 0x45BB, 0x459B, 0x459B, 0x459A,
+    0x8002, 0x4D7A, 0x0005, 0x4D59, 0x5559, 0x5559, 0x5539, 0x5539, 0x5538, 0x8002, 0x5D18, 0x000C,
+    0x5D17, 0x5CF7, 0x64F7, 0x64F7, 0x64D7, 0x64D6, 0x64D6, 0x6CB6, 0x6CB6, 0x6CB5, 0x6C95, 0x6C95,
+    0x7495, 0x8002, 0x7474, 0x0006, 0x7C74, 0x7C54, 0x7C53, 0x7C53, 0x7C33, 0x8433, 0x8432, 0x8002,
+    0x8412, 0x8002, 0x8BF1, 0x0006, 0x8BD1, 0x8BD1, 0x93D0, 0x93D0, 0x93B0, 0x93B0, 0x93AF, 0x8002,
+    0x9B8F, 0x0005, 0x9B6E, 0xA36E, 0xA36E, 0xA34E, 0xA34E, 0xA34D, 0x8002, 0xAB2D, 0x000C, 0xAB2C,
+    0xAB0C, 0xB30C, 0xB30C, 0xB2EC, 0xB2EB, 0xB2EB, 0xBACB, 0xBACB, 0xBACA, 0xBAAA, 0xBAAA, 0xC2AA,
+    0x8002, 0xC289, 0x0006, 0xCA89, 0xCA69, 0xCA68, 0xCA68, 0xCA48, 0xD248, 0xD247, 0x8002, 0xD227,
+    0x8002, 0xDA06, 0x0006, 0xD9E6, 0xD9E6, 0xE1E5, 0xE1E5, 0xE1C5, 0xE1C5, 0xE1C4, 0x8002, 0xE9A4,
+    0x0000, 0xE983, 0x8020, 0x18E5, 0x8008, 0xFE45, 0x8010, 0x18E5, 0x8008, 0xFE45, 0x800B, 0x18E5,
+    0x0006, 0x2E5F, 0x2E3F, 0x2E3E, 0x2E3E, 0x2E1E, 0x361E, 0x361D, 0x8002, 0x35FD, 0x8002, 0x3DDC,
+    0x0006, 0x3DBC, 0x3DBC, 0x45BB, 0x45BB, 0x459B, 0x459B, 0x459A, 0x8002, 0x4D7A, 0x0005, 0x4D59,
+    0x5559, 0x5559, 0x5539, 0x5539, 0x5538, 0x8002, 0x5D18, 0x000C, 0x5D17, 0x5CF7, 0x64F7, 0x64F7,
+    0x64D7, 0x64D6, 0x64D6, 0x6CB6, 0x6CB6, 0x6CB5, 0x6C95, 0x6C95, 0x7495, 0x8002, 0x7474, 0x0006,
+    0x7C74, 0x7C54, 0x7C53, 0x7C53, 0x7C33, 0x8433, 0x8432, 0x8002, 0x8412, 0x8002, 0x8BF1, 0x0006,
+    0x8BD1, 0x8BD1, 0x93D0, 0x93D0, 0x93B0, 0x93B0, 0x93AF, 0x8002, 0x9B8F, 0x0005, 0x9B6E, 0xA36E,
+    0xA36E, 0xA34E, 0xA34E, 0xA34D, 0x8002, 0xAB2D, 0x000C, 0xAB2C, 0xAB0C, 0xB30C, 0xB30C, 0xB2EC,
+    0xB2EB, 0xB2EB, 0xBACB, 0xBACB, 0xBACA, 0xBAAA, 0xBAAA, 0xC2AA, 0x8002, 0xC289, 0x0006, 0xCA89,
+    0xCA69, 0xCA68, 0xCA68, 0xCA48, 0xD248, 0xD247, 0x8002, 0xD227, 0x8002, 0xDA06, 0x0006, 0xD9E6,
+    0xD9E6, 0xE1E5, 0xE1E5, 0xE1C5, 0xE1C5, 0xE1C4, 0x8002, 0xE9A4, 0x0000, 0xE983, 0x8021, 0x18E5,
+    0x8007, 0xFE45, 0x8010, 0x18E5, 0x8007, 0xFE45, 0x800C, 0x18E5, 0x0006, 0x2E5F, 0x2E3F, 0x2E3E,
+    0x2E3E, 0x2E1E, 0x361E, 0x361D, 0x8002, 0x35FD, 0x8002, 0x3DDC, 0x0006, 0x3DBC, 0x3DBC, 0x45BB,
+    0x45BB, 0x459B, 0x459B, 0x459A, 0x8002, 0x4D7A, 0x0005, 0x4D59, 0x5559, 0x5559, 0x5539, 0x5539,
+    0x5538, 0x8002, 0x5D18, 0x000C, 0x5D17, 0x5CF7, 0x64F7, 0x64F7, 0x64D7, 0x64D6, 0x64D6, 0x6CB6,
+    0x6CB6, 0x6CB5, 0x6C95, 0x6C95, 0x7495, 0x8002, 0x7474, 0x0006, 0x7C74, 0x7C54, 0x7C53, 0x7C53,
+    0x7C33, 0x8433, 0x8432, 0x8002, 0x8412, 0x8002, 0x8BF1, 0x0006, 0x8BD1, 0x8BD1, 0x93D0, 0x93D0,
+    0x93B0, 0x93B0, 0x93AF, 0x8002, 0x9B8F, 0x0005, 0x9B6E, 0xA36E, 0xA36E, 0xA34E, 0xA34E, 0xA34D,
+    0x8002, 0xAB2D, 0x000C, 0xAB2C, 0xAB0C, 0xB30C, 0xB30C, 0xB2EC, 0xB2EB, 0xB2EB, 0xBACB, 0xBACB,
+    0xBACA, 0xBAAA, 0xBAAA, 0xC2AA, 0x8002, 0xC289, 0x0006, 0xCA89, 0xCA69, 0xCA68, 0xCA68, 0xCA48,
+    0xD248, 0xD247, 0x8002, 0xD227, 0x8002, 0xDA06, 0x0006, 0xD9E6, 0xD9E6, 0xE1E5, 0xE1E5, 0xE1C5,
+    0xE1C5, 0xE1C4, 0x8002, 0xE9A4, 0x0000, 0xE983, 0x8021, 0x18E5, 0x8008, 0xFE45, 0x800E, 0x18E5,
+    0x8008, 0xFE45, 0x800C, 0x18E5, 0x0006, 0x2E5F, 0x2E3F, 0x2E3E, 0x2E3E, 0x2E1E, 0x361E, 0x361D,
+    0x8002, 0x35FD, 0x8002, 0x3DDC, 0x0006, 0x3DBC, 0x3DBC, 0x45BB, 0x45BB, 0x459B, 0x459B, 0x459A,
+    0x8002, 0x4D7A, 0x0005, 0x4D59, 0x5559, 0x5559, 0x5539, 0x5539, 0x5538, 0x8002, 0x5D18, 0x000C,
+    0x5D17, 0x5CF7, 0x64F7, 0x64F7, 0x64D7, 0x64D6, 0x64D6, 0x6CB6, 0x6CB6, 0x6CB5, 0x6C95, 0x6C95,
+    0x7495, 0x8002, 0x7474, 0x0006, 0x7C74, 0x7C54, 0x7C53, 0x7C53, 0x7C33, 0x8433, 0x8432, 0x8002,
+    0x8412, 0x8002, 0x8BF1, 0x0006, 0x8BD1, 0x8BD1, 0x93D0, 0x93D0, 0x93B0, 0x93B0, 0x93AF, 0x8002,
+    0x9B8F, 0x0005, 0x9B6E, 0xA36E, 0xA36E, 0xA34E, 0xA34E, 0xA34D, 0x8002, 0xAB2D, 0x000C, 0xAB2C,
+    0xAB0C, 0xB30C, 0xB30C, 0xB2EC, 0xB2EB, 0xB2EB, 0xBACB, 0xBACB, 0xBACA, 0xBAAA, 0xBAAA, 0xC2AA,
+    0x8002, 0xC289, 0x0006, 0xCA89, 0xCA69, 0xCA68, 0xCA68, 0xCA48, 0xD248, 0xD247, 0x8002, 0xD227,
+    0x8002, 0xDA06, 0x0006, 0xD9E6, 0xD9E6, 0xE1E5, 0xE1E5, 0xE1C5, 0xE1C5, 0xE1C4, 0x8002, 0xE9A4,
+    0x0000, 0xE983, 0x8021, 0x18E5, 0x8009, 0xFE45, 0x800C, 0x18E5, 0x8009, 0xFE45, 0x800C, 0x18E5,
+    0x0006, 0x2E5F, 0x2E3F, 0x2E3E, 0x2E3E, 0x2E1E, 0x361E, 0x361D, 0x8002, 0x35FD, 0x8002, 0x3DDC,
+    0x0006, 0x3DBC, 0x3DBC, 0x45BB, 0x45BB, 0x459B, 0x459B, 0x459A, 0x8002, 0x4D7A, 0x0005, 0x4D59,
+    0x5559, 0x5559, 0x5539, 0x5539, 0x5538, 0x8002, 0x5D18, 0x000C, 0x5D17, 0x5CF7, 0x64F7, 0x64F7,
+    0x64D7, 0x64D6, 0x64D6, 0x6CB6, 0x6CB6, 0x6CB5, 0x6C95, 0x6C95, 0x7495, 0x8002, 0x7474, 0x0006,
+    0x7C74, 0x7C54, 0x7C53, 0x7C53, 0x7C33, 0x8433, 0x8432, 0x8002, 0x8412, 0x8002, 0x8BF1, 0x0006,
+    0x8BD1, 0x8BD1, 0x93D0, 0x93D0, 0x93B0, 0x93B0, 0x93AF, 0x8002, 0x9B8F, 0x0005, 0x9B6E, 0xA36E,
+    0xA36E, 0xA34E, 0xA34E, 0xA34D, 0x8002, 0xAB2D, 0x000C, 0xAB2C, 0xAB0C, 0xB30C, 0xB30C, 0xB2EC,
+    0xB2EB, 0xB2EB, 0xBACB, 0xBACB, 0xBACA, 0xBAAA, 0xBAAA, 0xC2AA, 0x8002, 0xC289, 0x0006, 0xCA89,
+    0xCA69, 0xCA68, 0xCA68, 0xCA48, 0xD248, 0xD247, 0x8002, 0xD227, 0x8002, 0xDA06, 0x0006, 0xD9E6,
+    0xD9E6, 0xE1E5, 0xE1E5, 0xE1C5, 0xE1C5, 0xE1C4, 0x8002, 0xE9A4, 0x0000, 0xE983, 0x8022, 0x18E5,
+    0x800A, 0xFE45, 0x8008, 0x18E5, 0x800A, 0xFE45, 0x800D, 0x18E5, 0x0006, 0x2E5F, 0x2E3F, 0x2E3E,
+    0x2E3E, 0x2E1E, 0x361E, 0x361D, 0x8002, 0x35FD, 0x8002, 0x3DDC, 0x0006, 0x3DBC, 0x3DBC, 0x45BB,
+    0x45BB, 0x459B, 0x459B, 0x459A, 0x8002, 0x4D7A, 0x0005, 0x4D59, 0x5559, 0x5559, 0x5539, 0x5539,
+    0x5538, 0x8002, 0x5D18, 0x000C, 0x5D17, 0x5CF7, 0x64F7, 0x64F7, 0x64D7, 0x64D6, 0x64D6, 0x6CB6,
+    0x6CB6, 0x6CB5, 0x6C95, 0x6C95, 0x7495, 0x8002, 0x7474, 0x0006, 0x7C74, 0x7C54, 0x7C53, 0x7C53,
+    0x7C33, 0x8433, 0x8432, 0x8002, 0x8412, 0x8002, 0x8BF1, 0x0006, 0x8BD1, 0x8BD1, 0x93D0, 0x93D0,
+    0x93B0, 0x93B0, 0x93AF, 0x8002, 0x9B8F, 0x0005, 0x9B6E, 0xA36E, 0xA36E, 0xA34E, 0xA34E, 0xA34D,
+    0x8002, 0xAB2D, 0x000C, 0xAB2C, 0xAB0C, 0xB30C, 0xB30C, 0xB2EC, 0xB2EB, 0xB2EB, 0xBACB, 0xBACB,
+    0xBACA, 0xBAAA, 0xBAAA, 0xC2AA, 0x8002, 0xC289, 0x0006, 0xCA89, 0xCA69, 0xCA68, 0xCA68, 0xCA48,
+    0xD248, 0xD247, 0x8002, 0xD227, 0x8002, 0xDA06, 0x0006, 0xD9E6, 0xD9E6, 0xE1E5, 0xE1E5, 0xE1C5,
+    0xE1C5, 0xE1C4, 0x8002, 0xE9A4, 0x0000, 0xE983, 0x8023, 0x18E5, 0x800D, 0xFE45, 0x0000, 0x18E5,
+    0x800D, 0xFE45, 0x80AA, 0x18E5, 0x801C, 0xFE45, 0x80AB, 0x18E5, 0x801A, 0xFE45, 0x80AD, 0x18E5,
+    0x8018, 0xFE45, 0x80AF, 0x18E5, 0x8016, 0xFE45, 0x8011, 0x18E5, 0x804F, 0x065F, 0x8027, 0x5B2F,
+    0x8028, 0x18E5, 0x8012, 0xFE45, 0x8013, 0x18E5, 0x804F, 0x065F, 0x8027, 0x5B2F, 0x8029, 0x18E5,
+    0x8010, 0xFE45, 0x8014, 0x18E5, 0x804F, 0x065F, 0x8027, 0x5B2F, 0x802C, 0x18E5, 0x800A, 0xFE45,
+    0x8017, 0x18E5, 0x804F, 0x065F, 0x8027, 0x5B2F, 0x8031, 0x18E5, 0x0000, 0xFE45, 0x8AC6, 0x18E5
+};
+
+const ILI9341RleImage_s Image_AssetSplashRle = {200, 120, Image_AssetSplashRleData, 3108};
+
+const uint8_t Image_AssetSplashQoi[] = {
+    0x71, 0x6F, 0x69, 0x66, 0x00, 0x00, 0x00, 0xC8, 0x00, 0x00, 0x00, 0x78, 0x03, 0x00, 0xFE, 0x00,
+    0x78, 0xD0, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xCC, 0xFE, 0xF8, 0xFC, 0xF8, 0xC6, 0x3D, 0xFD, 0xFD, 0xFD, 0xC4, 0x11, 0xC6, 0x3D,
+    0xFD, 0xFD, 0xCA, 0x11, 0xC4, 0x3D, 0xC1, 0x11, 0xC4, 0x3D, 0xC1, 0x11, 0xC4, 0x3D, 0xC1, 0xFE,
+    0x58, 0xA0, 0xE0, 0xC4, 0xFE, 0x00, 0x78, 0xD0, 0xC1, 0xFE, 0x58, 0xA0, 0xE0, 0xC4, 0xFE, 0x00,
+    0x78, 0xD0, 0xCC, 0x11, 0xC0, 0x3D, 0xC2, 0x11, 0xC0, 0x3D, 0xFD, 0xFD, 0xCA, 0x11, 0xC4, 0x3D,
+    0xC1, 0x11, 0xC4, 0x3D, 0xC1, 0x11, 0xC4, 0x3D, 0xC1, 0xFE, 0x58, 0xA0, 0xE0, 0xC4, 0xFE, 0x00,
+    0x78, 0xD0, 0xC1, 0xFE, 0x58, 0xA0, 0xE0, 0xC4, 0xFE, 0x00, 0x78, 0xD0, 0xCC, 0x11, 0xC0, 0x3D,
+    0xC2, 0x11, 0xC0, 0x3D, 0xFD, 0xFD, 0xCA, 0x11, 0xC4, 0x3D, 0xC1, 0x11, 0xC4, 0x3D, 0xC1, 0x11,
+    0xC4, 0x3D, 0xC1, 0xFE, 0x58, 0xA0, 0xE0, 0xC4, 0xFE, 0x00, 0x78, 0xD0, 0xC1, 0xFE, 0x58, 0xA0,
+    0xE0, 0xC4, 0xFE, 0x00, 0x78, 0xD0, 0xCC, 0x11, 0xC0, 0x3D, 0xC2, 0x11, 0xC0, 0x3D, 0xFD, 0xFD,
+    0xCA, 0x11, 0xC4, 0x3D, 0xC1, 0x11, 0xC4, 0x3D, 0xC1, 0x11, 0xC4, 0x3D, 0xC1, 0xFE, 0x58, 0xA0,
+    0xE0, 0xC4, 0xFE, 0x00, 0x78, 0xD0, 0xC1, 0xFE, 0x58, 0xA0, 0xE0, 0xC4, 0xFE, 0x00, 0x78, 0xD0,
+    0xCC, 0x11, 0xC0, 0x3D, 0xC2, 0x11, 0xC0, 0x3D, 0xFD, 0xFD, 0xCA, 0x11, 0xC4, 0x3D, 0xC1, 0x11,
+    0xC4, 0x3D, 0xC1, 0x11, 0xC4, 0x3D, 0xC1, 0xFE, 0x58, 0xA0, 0xE0, 0xC4, 0xFE, 0x00, 0x78, 0xD0,
+    0xC1, 0xFE, 0x58, 0xA0, 0xE0, 0xC4, 0xFE, 0x00, 0x78, 0xD0, 0xCC, 0x11, 0xC6, 0x3D, 0xFD, 0xFD,
+    0xCA, 0x11, 0xC4, 0x3D, 0xC1, 0x11, 0xC4, 0x3D, 0xC1, 0x11, 0xC4, 0x3D, 0xC1, 0xFE, 0x58, 0xA0,
+    0xE0, 0xC4, 0xFE, 0x00, 0x78, 0xD0, 0xC1, 0xFE, 0x58, 0xA0, 0xE0, 0xC4, 0xFE, 0x00, 0x78, 0xD0,
+    0xCC, 0x11, 0xC6, 0x3D, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC6, 0xFE, 0x18, 0x1C, 0x28, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xF8, 0xFE, 0x38, 0xB4, 0x48, 0xFD, 0xCD, 0x21, 0xD0, 0xFE, 0xE0, 0x50, 0x38, 0xFD,
+    0xCD, 0x21, 0xD8, 0x19, 0xFD, 0xD1, 0x21, 0xCC, 0x2D, 0xFD, 0xD1, 0x21, 0xD5, 0x19, 0xFD, 0xD3,
+    0x21, 0xCA, 0x2D, 0xFD, 0xD3, 0x21, 0xD4, 0x19, 0xFD, 0xD3, 0x21, 0xCA, 0x2D, 0xFD, 0xD3, 0x21,
+    0xD3, 0x19, 0xFD, 0xD5, 0x21, 0xC8, 0x2D, 0xFD, 0xD5, 0x21, 0xD2, 0x19, 0xFD, 0xD5, 0x21, 0xC8,
+    0x2D, 0xFD, 0xD5, 0x21, 0xD2, 0x19, 0xFD, 0xD5, 0x21, 0xC8, 0x2D, 0xFD, 0xD5, 0x21, 0xD2, 0x19,
+    0xFD, 0xD5, 0x21, 0xC8, 0x2D, 0xFD, 0xD5, 0x21, 0xD2, 0x19, 0xFD, 0xD5, 0x21, 0xC8, 0x2D, 0xFD,
+    0xD5, 0x21, 0xD2, 0x19, 0xFD, 0xD5, 0x21, 0xC8, 0x2D, 0xFD, 0xD5, 0x21, 0xD2, 0x19, 0xFD, 0xD5,
+    0x21, 0xC8, 0x2D, 0xFD, 0xD5, 0x21, 0xD2, 0x19, 0xFD, 0xD5, 0x21, 0xC8, 0x2D, 0xFD, 0xD5, 0x21,
+    0xD2, 0x19, 0xFD, 0xD5, 0x21, 0xC8, 0x2D, 0xFD, 0xD5, 0x21, 0xD2, 0x19, 0xD0, 0x11, 0xEF, 0x19,
+    0xD0, 0x21, 0xC8, 0x2D, 0xD0, 0x11, 0xEF, 0x2D, 0xD0, 0x21, 0xD2, 0x19, 0xD0, 0x11, 0xEF, 0x19,
+    0xD0, 0x21, 0xC8, 0x2D, 0xD0, 0x11, 0xEF, 0x2D, 0xD0, 0x21, 0xD2, 0x19, 0xD0, 0x11, 0xEF, 0x19,
+    0xD0, 0x21, 0xC8, 0x2D, 0xD0, 0x11, 0xEF, 0x2D, 0xD0, 0x21, 0xD2, 0x19, 0xD0, 0x11, 0xEF, 0x19,
+    0xD0, 0x21, 0xC8, 0x2D, 0xD0, 0x11, 0xEF, 0x2D, 0xD0, 0x21, 0xD2, 0x19, 0xFD, 0xD5, 0x21, 0xC8,
+    0x2D, 0xFD, 0xD5, 0x21, 0xD2, 0x19, 0xFD, 0xD5, 0x21, 0xC8, 0x2D, 0xFD, 0xD5, 0x21, 0xD2, 0x19,
+    0xFD, 0xD5, 0x21, 0xC8, 0x2D, 0xFD, 0xD5, 0x21, 0xD2, 0x19, 0xFD, 0xD5, 0x21, 0xC8, 0x2D, 0xFD,
+    0xD5, 0x21, 0xD2, 0x19, 0xFD, 0xD5, 0x21, 0xC8, 0x2D, 0xFD, 0xD5, 0x21, 0xD2, 0x19, 0xFD, 0xD5,
+    0x21, 0xC8, 0x2D, 0xFD, 0xD5, 0x21, 0xD2, 0x19, 0xFD, 0xD5, 0x21, 0xC8, 0x2D, 0xFD, 0xD5, 0x21,
+    0xD2, 0x19, 0xFD, 0xD5, 0x21, 0xC8, 0x2D, 0xFD, 0xD5, 0x21, 0xD2, 0x19, 0xFD, 0xD5, 0x21, 0xC8,
+    0x2D, 0xFD, 0xD5, 0x21, 0xD3, 0x19, 0xFD, 0xD3, 0x21, 0xCA, 0x2D, 0xFD, 0xD3, 0x21, 0xD4, 0x19,
+    0xFD, 0xD3, 0x21, 0xCA, 0x2D, 0xFD, 0xD3, 0x21, 0xD5, 0x19, 0xFD, 0xD1, 0x21, 0xCC, 0x2D, 0xFD,
+    0xD1, 0x21, 0xD8, 0x19, 0xFD, 0xCD, 0x21, 0xD0, 0x2D, 0xFD, 0xCD, 0x21, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC6, 0xFE, 0xF8,
+    0xC8, 0x28, 0x21, 0xFD, 0xFD, 0xFD, 0xC6, 0x1D, 0xC9, 0x21, 0xFD, 0xFD, 0xFC, 0x1D, 0xCF, 0x21,
+    0xFD, 0xFD, 0xF8, 0x1D, 0xD1, 0x21, 0xFD, 0xFD, 0xF5, 0x1D, 0xD5, 0x21, 0xFD, 0xFD, 0xF2, 0x1D,
+    0xD7, 0x21, 0xFD, 0xFD, 0xF0, 0x1D, 0xD9, 0x21, 0xFD, 0xFD, 0xEE, 0x1D, 0xDB, 0x21, 0xFD, 0xFD,
+    0xED, 0x1D, 0xCC, 0x21, 0x1D, 0xCC, 0x21, 0xCD, 0xFE, 0x28, 0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80,
+    0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0,
+    0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48,
+    0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE,
+    0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0,
+    0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8,
+    0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80,
+    0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE,
+    0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4,
+    0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0,
+    0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58,
+    0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8,
+    0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C,
+    0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C,
+    0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xE1,
+    0xFE, 0xF8, 0xC8, 0x28, 0xC9, 0x21, 0xC7, 0x1D, 0xC9, 0x21, 0xCC, 0xFE, 0x28, 0xC8, 0xF8, 0x9C,
+    0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE,
+    0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0,
+    0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0,
+    0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0,
+    0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE,
+    0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C,
+    0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C,
+    0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78,
+    0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64,
+    0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0,
+    0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4,
+    0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40,
+    0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C,
+    0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18,
+    0x1C, 0x28, 0xE0, 0xFE, 0xF8, 0xC8, 0x28, 0xC8, 0x21, 0xCB, 0x1D, 0xC8, 0x21, 0xCB, 0xFE, 0x28,
+    0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C,
+    0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C,
+    0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0,
+    0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60,
+    0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C,
+    0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0,
+    0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C,
+    0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE,
+    0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80,
+    0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC,
+    0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54,
+    0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE,
+    0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0,
+    0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C,
+    0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xE0, 0xFE, 0xF8, 0xC8, 0x28, 0xC7, 0x21, 0xCD, 0x1D, 0xC7, 0x21,
+    0xCB, 0xFE, 0x28, 0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0,
+    0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4,
+    0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50,
+    0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C,
+    0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0,
+    0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0,
+    0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1,
+    0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0,
+    0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC,
+    0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60,
+    0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0,
+    0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0,
+    0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1,
+    0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34,
+    0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xE0, 0xFE, 0xF8, 0xC8, 0x28, 0xC6, 0x21, 0xCF,
+    0x1D, 0xC6, 0x21, 0xCB, 0xFE, 0x28, 0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE,
+    0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0,
+    0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C,
+    0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1,
+    0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68,
+    0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE,
+    0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80,
+    0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0,
+    0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70,
+    0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE,
+    0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80,
+    0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC,
+    0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8,
+    0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80,
+    0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xDF, 0xFE, 0xF8, 0xC8, 0x28,
+    0xC7, 0x21, 0xCF, 0x1D, 0xC7, 0x21, 0xCA, 0xFE, 0x28, 0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80, 0xC0,
+    0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0, 0xC1,
+    0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48, 0xAC,
+    0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x58,
+    0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0, 0x80,
+    0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8, 0x9C,
+    0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80, 0x84,
+    0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x90,
+    0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4, 0xFE,
+    0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0, 0x80,
+    0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58, 0x58,
+    0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8, 0x50,
+    0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C, 0xCC,
+    0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C, 0xCC,
+    0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xDF, 0xFE,
+    0xF8, 0xC8, 0x28, 0xC6, 0x21, 0xD1, 0x1D, 0xC6, 0x21, 0xCA, 0xFE, 0x28, 0xC8, 0xF8, 0x9C, 0xCC,
+    0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x38,
+    0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80,
+    0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0,
+    0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0, 0x9C,
+    0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0x70,
+    0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC,
+    0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C, 0xCC,
+    0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78, 0xC1,
+    0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64, 0x68,
+    0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE,
+    0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4, 0xC1,
+    0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40, 0xA0,
+    0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C, 0x28,
+    0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18, 0x1C,
+    0x28, 0xDF, 0xFE, 0xF8, 0xC8, 0x28, 0xC6, 0x21, 0xD1, 0x1D, 0xC6, 0x21, 0xCA, 0xFE, 0x28, 0xC8,
+    0xF8, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C, 0xCC,
+    0xC1, 0xFE, 0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C, 0xCC,
+    0xC0, 0xA0, 0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0, 0x9C,
+    0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60, 0x9C,
+    0xB8, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C, 0xCC,
+    0xC0, 0xFE, 0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0, 0x80,
+    0xC0, 0x9C, 0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C, 0x88,
+    0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x98,
+    0x70, 0x78, 0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE,
+    0xA8, 0x64, 0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC, 0xA0,
+    0x80, 0xC0, 0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54, 0x50,
+    0x9C, 0xC4, 0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0xD0,
+    0x48, 0x40, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE,
+    0xE0, 0x3C, 0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C, 0xC4,
+    0xFE, 0x18, 0x1C, 0x28, 0xDF, 0xFE, 0xF8, 0xC8, 0x28, 0xC6, 0x21, 0xD1, 0x1D, 0xC6, 0x21, 0xCA,
+    0xFE, 0x28, 0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0,
+    0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8,
+    0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8,
+    0xC8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC,
+    0xFE, 0x60, 0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0,
+    0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C,
+    0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE,
+    0x88, 0x7C, 0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0,
+    0x80, 0xFE, 0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0,
+    0xA0, 0x80, 0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0,
+    0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE,
+    0xC0, 0x54, 0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C,
+    0xCC, 0xFE, 0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C,
+    0xCC, 0xC0, 0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20,
+    0xC1, 0x9C, 0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xDF, 0xFE, 0xF8, 0xC8, 0x28, 0xC6, 0x21, 0xD1, 0x1D,
+    0xC6, 0x21, 0xCA, 0xFE, 0x28, 0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30,
+    0xC0, 0xF0, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE,
+    0x40, 0xB4, 0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4,
+    0xFE, 0x50, 0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0,
+    0x80, 0x9C, 0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94,
+    0xB0, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78,
+    0x8C, 0xA0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C,
+    0xCC, 0xC1, 0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C,
+    0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0,
+    0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0,
+    0x60, 0x60, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C,
+    0xCC, 0xC0, 0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0,
+    0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40,
+    0x30, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE,
+    0xE8, 0x34, 0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xDE, 0xFE, 0xF8, 0xC8, 0x28, 0xC6,
+    0x21, 0xD3, 0x1D, 0xC6, 0x21, 0xC9, 0xFE, 0x28, 0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C,
+    0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0, 0xC1, 0x9C,
+    0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48, 0xAC, 0xD0,
+    0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x58, 0xA0,
+    0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0,
+    0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8, 0x9C, 0xC4,
+    0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80, 0x84, 0x98,
+    0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x90, 0x78,
+    0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4, 0xFE, 0xA0,
+    0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0, 0x80, 0x9C,
+    0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58, 0x58, 0xC0,
+    0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8, 0x50, 0x48,
+    0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C, 0xCC, 0xC1,
+    0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C, 0xCC, 0xC0,
+    0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xDF, 0xFE, 0xF8,
+    0xC8, 0x28, 0xC6, 0x21, 0xD1, 0x1D, 0xC6, 0x21, 0xCA, 0xFE, 0x28, 0xC8, 0xF8, 0x9C, 0xCC, 0xA0,
+    0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x38, 0xB8,
+    0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE,
+    0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80,
+    0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0, 0x9C, 0xCC,
+    0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0x70, 0x90,
+    0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE,
+    0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C, 0xCC, 0xC0,
+    0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78, 0xC1, 0x9C,
+    0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64, 0x68, 0xC1,
+    0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0xB8,
+    0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4, 0xC1, 0xFE,
+    0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40, 0xA0, 0x80,
+    0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C, 0x28, 0xC0,
+    0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18, 0x1C, 0x28,
+    0xDF, 0xFE, 0xF8, 0xC8, 0x28, 0xC6, 0x21, 0xD1, 0x1D, 0xC6, 0x21, 0xCA, 0xFE, 0x28, 0xC8, 0xF8,
+    0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C, 0xCC, 0xC1,
+    0xFE, 0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C, 0xCC, 0xC0,
+    0xA0, 0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0, 0x9C, 0xCC,
+    0xC0, 0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60, 0x9C, 0xB8,
+    0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0,
+    0xFE, 0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0,
+    0x9C, 0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C, 0x88, 0xC1,
+    0x9C, 0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x98, 0x70,
+    0x78, 0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xA8,
+    0x64, 0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC, 0xA0, 0x80,
+    0xC0, 0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54, 0x50, 0x9C,
+    0xC4, 0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0xD0, 0x48,
+    0x40, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0xE0,
+    0x3C, 0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C, 0xC4, 0xFE,
+    0x18, 0x1C, 0x28, 0xDF, 0xFE, 0xF8, 0xC8, 0x28, 0xC6, 0x21, 0xD1, 0x1D, 0xC6, 0x21, 0xCA, 0xFE,
+    0x28, 0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80,
+    0x9C, 0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0,
+    0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8,
+    0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE,
+    0x60, 0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80,
+    0x9C, 0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC,
+    0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88,
+    0x7C, 0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80,
+    0xFE, 0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0,
+    0x80, 0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C,
+    0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0,
+    0x54, 0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC,
+    0xFE, 0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC,
+    0xC0, 0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1,
+    0x9C, 0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xDF, 0xFE, 0xF8, 0xC8, 0x28, 0xC6, 0x21, 0xD1, 0x1D, 0xC6,
+    0x21, 0xCA, 0xFE, 0x28, 0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0,
+    0xF0, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40,
+    0xB4, 0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE,
+    0x50, 0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80,
+    0x9C, 0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0,
+    0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C,
+    0xA0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC,
+    0xC1, 0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC,
+    0xC0, 0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C,
+    0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60,
+    0x60, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC,
+    0xC0, 0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80,
+    0xC0, 0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30,
+    0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8,
+    0x34, 0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xDF, 0xFE, 0xF8, 0xC8, 0x28, 0xC7, 0x21,
+    0xCF, 0x1D, 0xC7, 0x21, 0xCA, 0xFE, 0x28, 0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC,
+    0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC,
+    0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1,
+    0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0,
+    0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE,
+    0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1,
+    0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0,
+    0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80,
+    0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C,
+    0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC,
+    0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0,
+    0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C,
+    0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE,
+    0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0,
+    0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xE0, 0xFE, 0xF8, 0xC8,
+    0x28, 0xC6, 0x21, 0xCF, 0x1D, 0xC6, 0x21, 0xCB, 0xFE, 0x28, 0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80,
+    0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0,
+    0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48,
+    0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE,
+    0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0,
+    0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8,
+    0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80,
+    0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE,
+    0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4,
+    0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0,
+    0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58,
+    0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8,
+    0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C,
+    0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C,
+    0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xE0,
+    0xFE, 0xF8, 0xC8, 0x28, 0xC7, 0x21, 0xCD, 0x1D, 0xC7, 0x21, 0xCB, 0xFE, 0x28, 0xC8, 0xF8, 0x9C,
+    0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE,
+    0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0,
+    0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0,
+    0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0,
+    0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE,
+    0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C,
+    0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C,
+    0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78,
+    0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64,
+    0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0,
+    0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4,
+    0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40,
+    0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C,
+    0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18,
+    0x1C, 0x28, 0xE0, 0xFE, 0xF8, 0xC8, 0x28, 0xC8, 0x21, 0xCB, 0x1D, 0xC8, 0x21, 0xCB, 0xFE, 0x28,
+    0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0, 0xA0, 0x80, 0x9C,
+    0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4, 0xD8, 0xC0, 0x9C,
+    0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50, 0xA8, 0xC8, 0xC0,
+    0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0x60,
+    0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0, 0xA0, 0x80, 0x9C,
+    0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0, 0x9C, 0xCC, 0xA0,
+    0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x88, 0x7C,
+    0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE,
+    0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80,
+    0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60, 0xC0, 0x9C, 0xCC,
+    0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0xC0, 0x54,
+    0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE,
+    0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1, 0x9C, 0xCC, 0xC0,
+    0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34, 0x20, 0xC1, 0x9C,
+    0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xE1, 0xFE, 0xF8, 0xC8, 0x28, 0xC9, 0x21, 0xC7, 0x1D, 0xC9, 0x21,
+    0xCC, 0xFE, 0x28, 0xC8, 0xF8, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x30, 0xC0, 0xF0,
+    0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0x38, 0xB8, 0xE0, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x40, 0xB4,
+    0xD8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x48, 0xAC, 0xD0, 0xC1, 0x9C, 0xC4, 0xFE, 0x50,
+    0xA8, 0xC8, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0x58, 0xA0, 0xC0, 0xC1, 0xA0, 0x80, 0x9C,
+    0xCC, 0xFE, 0x60, 0x9C, 0xB8, 0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0x68, 0x94, 0xB0, 0xC0,
+    0xA0, 0x80, 0x9C, 0xCC, 0xC0, 0xFE, 0x70, 0x90, 0xA8, 0x9C, 0xC4, 0xC1, 0xFE, 0x78, 0x8C, 0xA0,
+    0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0x9C, 0xCC, 0xFE, 0x80, 0x84, 0x98, 0xA0, 0x80, 0x9C, 0xCC, 0xC1,
+    0xFE, 0x88, 0x7C, 0x88, 0xC1, 0x9C, 0xCC, 0xC0, 0xFE, 0x90, 0x78, 0x80, 0xC0, 0x9C, 0xCC, 0xC0,
+    0xA0, 0x80, 0xFE, 0x98, 0x70, 0x78, 0xC1, 0x9C, 0xC4, 0xFE, 0xA0, 0x6C, 0x70, 0xC0, 0x9C, 0xCC,
+    0xC0, 0xA0, 0x80, 0xFE, 0xA8, 0x64, 0x68, 0xC1, 0xA0, 0x80, 0x9C, 0xCC, 0xFE, 0xB0, 0x60, 0x60,
+    0xC0, 0x9C, 0xCC, 0xA0, 0x80, 0xC0, 0xFE, 0xB8, 0x58, 0x58, 0xC0, 0xA0, 0x80, 0x9C, 0xCC, 0xC0,
+    0xFE, 0xC0, 0x54, 0x50, 0x9C, 0xC4, 0xC1, 0xFE, 0xC8, 0x50, 0x48, 0x9C, 0xCC, 0xA0, 0x80, 0xC0,
+    0x9C, 0xCC, 0xFE, 0xD0, 0x48, 0x40, 0xA0, 0x80, 0x9C, 0xCC, 0xC1, 0xFE, 0xD8, 0x40, 0x30, 0xC1,
+    0x9C, 0xCC, 0xC0, 0xFE, 0xE0, 0x3C, 0x28, 0xC0, 0x9C, 0xCC, 0xC0, 0xA0, 0x80, 0xFE, 0xE8, 0x34,
+    0x20, 0xC1, 0x9C, 0xC4, 0xFE, 0x18, 0x1C, 0x28, 0xE2, 0xFE, 0xF8, 0xC8, 0x28, 0xCC, 0x21, 0x1D,
+    0xCC, 0x21, 0xFD, 0xFD, 0xED, 0x1D, 0xDB, 0x21, 0xFD, 0xFD, 0xEE, 0x1D, 0xD9, 0x21, 0xFD, 0xFD,
+    0xF0, 0x1D, 0xD7, 0x21, 0xFD, 0xFD, 0xF2, 0x1D, 0xD5, 0x21, 0xD0, 0xFE, 0x00, 0xC8, 0xF8, 0xFD,
+    0xD0, 0xFE, 0x58, 0x64, 0x78, 0xE6, 0x21, 0xE7, 0x1D, 0xD1, 0x21, 0xD2, 0x25, 0xFD, 0xD0, 0x39,
+    0xE6, 0x21, 0xE8, 0x1D, 0xCF, 0x21, 0xD3, 0x25, 0xFD, 0xD0, 0x39, 0xE6, 0x21, 0xEB, 0x1D, 0xC9,
+    0x21, 0xD6, 0x25, 0xFD, 0xD0, 0x39, 0xE6, 0x21, 0xF0, 0x1D, 0x21, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+};
+
+const uint32_t Image_AssetSplashQoiSize = sizeof(Image_AssetSplashQoi);
+
+static const uint16_t Image_AssetBadgePalette[] = {
+    0x0000, 0x0821, 0x2088, 0x40ED, 0x5152, 0x6995, 0x71B8, 0x79DA, 0x81FB, 0x1043, 0x38EC, 0x6174,
+    0x81FA, 0x5952, 0x89FA, 0x89F9, 0x89F8, 0x91F8, 0x30CA, 0x91F7, 0xFFFF, 0x4930, 0x5973, 0x0822,
+    0xA215, 0xA214, 0xAA14, 0xAA13, 0xAA33, 0xAA34, 0xAA32, 0x9218, 0xA234, 0xB232, 0xB252, 0xB251,
+    0xA235, 0xBA51, 0xBA50, 0x9217, 0xAA52, 0xBA70, 0xBA6F, 0xAA53, 0xC26F, 0x6127, 0x6147, 0x8A18,
+    0xBA71, 0xAA54, 0xB271, 0xC28F, 0x6146, 0xB272, 0xBA90, 0x6946, 0xA254, 0x6966, 0x8A19, 0xAA72,
+    0x6166, 0xD2CB, 0xA255, 0xAA73, 0xBA91, 0xBA8F, 0x6167, 0xD2EB, 0xDAEB, 0xDAEA, 0xB291, 0xC2AF,
+    0xDB0A, 0xDB09, 0x9237, 0xAA74, 0xB292, 0xBAB0, 0xBAAF, 0xE309, 0xE329, 0x6986, 0xD30B, 0xE328,
+    0xA274, 0xDB0B, 0xDB2A, 0xDB29, 0xE348, 0xEB48, 0xEB47, 0x9238, 0xAA93, 0xB2B1, 0xBAD0, 0x6186,
+    0xE349, 0xEB67, 0xEB66, 0xA275, 0xAA92, 0xBACF, 0xD32B, 0xDB4A, 0xE368, 0xF386, 0xB2B2, 0xDB49,
+    0xE369, 0xEB87, 0xEB86, 0xF3A5, 0x6187, 0xF3A6, 0xB2D1, 0xBAEF, 0xD34B, 0xDB6A, 0xE388, 0xEBA7,
+    0xA294, 0xAAB3, 0xBAF0, 0x69A6, 0xEB88, 0xEBA6, 0xDB6B, 0xDB89, 0xE389, 0xEBA8, 0xAA94, 0xBAD1,
+    0xC2EF, 0xD36B, 0xDB8A, 0xE3A8, 0x8A1A, 0xB2D2, 0xBB0F, 0x61A6, 0xE3A9, 0xA295, 0xBB10, 0xC30F,
+    0xDBAA, 0xDBA9, 0x8A38, 0xBAF1, 0x61A7, 0x69C6, 0xD38B, 0xDB8B, 0xAAB4, 0xAAD2, 0xB2F1, 0x9258,
+    0xAAD3, 0xB2F2, 0xC32F, 0xBB11, 0xBB30, 0x61C6, 0x9257, 0xA2B4, 0xB311, 0xBB2F, 0xC34F, 0x8A39,
+    0xAAF2, 0xB312, 0xBB50, 0xBB4F, 0xA2D4, 0xAAF3, 0xBB31, 0xA2B5, 0xAAD4, 0xB331, 0x821A, 0xAB12,
+    0xAAF4, 0x9277, 0xA2D5, 0x9278, 0x8A58
+};
+
+static const uint8_t Image_AssetBadgeData[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0A, 0x0B, 0x08, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x08, 0x0B, 0x0A, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x0D, 0x08, 0x0C, 0x0C, 0x0C, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0x0E, 0x0C, 0x0C, 0x0C, 0x08, 0x0D, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x0B, 0x0C, 0x0C, 0x0C, 0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0x0C, 0x0C, 0x0C, 0x0B, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x04, 0x08, 0x0C, 0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0x0C, 0x08, 0x04,
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x07,
+    0x0C, 0x0E, 0x0F, 0x0F, 0x0F, 0x10, 0x11, 0x11, 0x11, 0x11, 0x13, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x13, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0F, 0x0F, 0x0F, 0x0E, 0x0C,
+    0x07, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0C, 0x0C,
+    0x0E, 0x0F, 0x0F, 0x10, 0x11, 0x11, 0x11, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x11, 0x11, 0x11, 0x10, 0x0F, 0x0F, 0x0E,
+    0x0C, 0x0C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 0x0C, 0x0C, 0x0F,
+    0x0F, 0x0F, 0x11, 0x11, 0x13, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x13, 0x11, 0x11, 0x0F, 0x0F,
+    0x0F, 0x0C, 0x0C, 0x16, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x05, 0x0C, 0x0E, 0x0F, 0x0F,
+    0x10, 0x11, 0x11, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x11, 0x11, 0x10,
+    0x0F, 0x0F, 0x0E, 0x0C, 0x05, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x0C, 0x0E, 0x0F, 0x0F, 0x11,
+    0x11, 0x13, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x18, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x13, 0x11,
+    0x11, 0x0F, 0x0F, 0x0E, 0x0C, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x0C, 0x0E, 0x0F, 0x0F, 0x11, 0x11,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x18, 0x19, 0x19, 0x19, 0x1A, 0x1A, 0x1B, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1B, 0x1A, 0x1A, 0x19, 0x19, 0x19, 0x18, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x11, 0x11, 0x0F, 0x0F, 0x0E, 0x0C, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0C, 0x0E, 0x0F, 0x0F, 0x11, 0x11, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x18, 0x19, 0x19, 0x1D, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1E, 0x1E,
+    0x1E, 0x1E, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1D, 0x19, 0x19, 0x18, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x11, 0x11, 0x0F, 0x0F, 0x0E, 0x0C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0C, 0x0C, 0x0F, 0x0F, 0x11, 0x1F, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x18, 0x20, 0x1D, 0x1C, 0x1C, 0x1C, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+    0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x1C, 0x1C, 0x1C, 0x1D, 0x20, 0x18, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x1F, 0x11, 0x0F, 0x0F, 0x0C, 0x0C, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x07, 0x0C, 0x0F, 0x0F, 0x11, 0x1F, 0x14, 0x14, 0x14,
+    0x14, 0x18, 0x20, 0x20, 0x1D, 0x1C, 0x1C, 0x1E, 0x21, 0x21, 0x22, 0x23, 0x23, 0x23, 0x23, 0x23,
+    0x23, 0x23, 0x23, 0x23, 0x23, 0x22, 0x21, 0x21, 0x1E, 0x1C, 0x1C, 0x1D, 0x20, 0x20, 0x18, 0x14,
+    0x14, 0x14, 0x14, 0x1F, 0x11, 0x0F, 0x0F, 0x0C, 0x07, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0C, 0x0E, 0x0F, 0x10, 0x1F, 0x14, 0x14, 0x14, 0x14,
+    0x24, 0x20, 0x20, 0x1C, 0x1C, 0x1C, 0x22, 0x22, 0x23, 0x23, 0x25, 0x25, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 0x23, 0x23, 0x22, 0x22, 0x1C, 0x1C, 0x1C, 0x20, 0x20, 0x24,
+    0x14, 0x14, 0x14, 0x14, 0x1F, 0x10, 0x0F, 0x0E, 0x0C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x0E, 0x0F, 0x0F, 0x1F, 0x27, 0x14, 0x14, 0x14, 0x24,
+    0x20, 0x20, 0x1C, 0x1C, 0x28, 0x22, 0x22, 0x23, 0x25, 0x26, 0x26, 0x29, 0x29, 0x29, 0x2A, 0x2A,
+    0x2A, 0x2A, 0x29, 0x29, 0x29, 0x26, 0x26, 0x25, 0x23, 0x22, 0x22, 0x28, 0x1C, 0x1C, 0x20, 0x20,
+    0x24, 0x14, 0x14, 0x14, 0x27, 0x1F, 0x0F, 0x0F, 0x0E, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x0C, 0x0F, 0x0F, 0x1F, 0x1F, 0x14, 0x14, 0x14, 0x14, 0x20,
+    0x20, 0x1C, 0x2B, 0x22, 0x22, 0x23, 0x23, 0x29, 0x29, 0x29, 0x2A, 0x2C, 0x2D, 0x2D, 0x2D, 0x2E,
+    0x2E, 0x2D, 0x2D, 0x2D, 0x2C, 0x2A, 0x29, 0x29, 0x29, 0x23, 0x23, 0x22, 0x22, 0x2B, 0x1C, 0x20,
+    0x20, 0x14, 0x14, 0x14, 0x14, 0x1F, 0x1F, 0x0F, 0x0F, 0x0C, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x0C, 0x0E, 0x0F, 0x2F, 0x1F, 0x14, 0x14, 0x14, 0x14, 0x24, 0x20,
+    0x2B, 0x2B, 0x22, 0x22, 0x23, 0x30, 0x29, 0x29, 0x2A, 0x2C, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2C, 0x2A, 0x29, 0x29, 0x30, 0x23, 0x22, 0x22, 0x2B, 0x2B,
+    0x20, 0x24, 0x14, 0x14, 0x14, 0x14, 0x1F, 0x2F, 0x0F, 0x0E, 0x0C, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0D, 0x0C, 0x0F, 0x0F, 0x1F, 0x27, 0x14, 0x14, 0x14, 0x24, 0x20, 0x31,
+    0x2B, 0x28, 0x22, 0x32, 0x30, 0x29, 0x29, 0x33, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x34, 0x34, 0x34,
+    0x34, 0x34, 0x34, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x33, 0x29, 0x29, 0x30, 0x32, 0x22, 0x28, 0x2B,
+    0x31, 0x20, 0x24, 0x14, 0x14, 0x14, 0x27, 0x1F, 0x0F, 0x0F, 0x0C, 0x0D, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x08, 0x0C, 0x0F, 0x2F, 0x1F, 0x14, 0x14, 0x14, 0x14, 0x20, 0x31, 0x2B,
+    0x2B, 0x35, 0x32, 0x30, 0x29, 0x36, 0x33, 0x2E, 0x2E, 0x2E, 0x2E, 0x34, 0x34, 0x34, 0x37, 0x37,
+    0x37, 0x37, 0x34, 0x34, 0x34, 0x2E, 0x2E, 0x2E, 0x2E, 0x33, 0x36, 0x29, 0x30, 0x32, 0x35, 0x2B,
+    0x2B, 0x31, 0x20, 0x14, 0x14, 0x14, 0x14, 0x1F, 0x2F, 0x0F, 0x0C, 0x08, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0x0C, 0x0E, 0x0F, 0x1F, 0x1F, 0x14, 0x14, 0x14, 0x24, 0x38, 0x2B, 0x2B,
+    0x35, 0x35, 0x32, 0x36, 0x36, 0x33, 0x2E, 0x2E, 0x2E, 0x34, 0x34, 0x39, 0x39, 0x39, 0x39, 0x39,
+    0x39, 0x39, 0x39, 0x39, 0x39, 0x34, 0x34, 0x2E, 0x2E, 0x2E, 0x33, 0x36, 0x36, 0x32, 0x35, 0x35,
+    0x2B, 0x2B, 0x38, 0x24, 0x14, 0x14, 0x14, 0x1F, 0x1F, 0x0F, 0x0E, 0x0C, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0B, 0x0C, 0x0F, 0x3A, 0x1F, 0x14, 0x14, 0x14, 0x14, 0x38, 0x31, 0x2B, 0x3B,
+    0x35, 0x32, 0x36, 0x36, 0x33, 0x2E, 0x2E, 0x2E, 0x3C, 0x39, 0x39, 0x39, 0x39, 0x3D, 0x3D, 0x3D,
+    0x3D, 0x3D, 0x3D, 0x39, 0x39, 0x39, 0x39, 0x3C, 0x2E, 0x2E, 0x2E, 0x33, 0x36, 0x36, 0x32, 0x35,
+    0x3B, 0x2B, 0x31, 0x38, 0x14, 0x14, 0x14, 0x14, 0x1F, 0x3A, 0x0F, 0x0C, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x08, 0x0C, 0x0F, 0x2F, 0x1F, 0x14, 0x14, 0x14, 0x3E, 0x38, 0x2B, 0x3F, 0x35,
+    0x32, 0x40, 0x36, 0x41, 0x2E, 0x2E, 0x42, 0x3C, 0x39, 0x39, 0x39, 0x43, 0x44, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x45, 0x44, 0x43, 0x39, 0x39, 0x39, 0x3C, 0x42, 0x2E, 0x2E, 0x41, 0x36, 0x40, 0x32,
+    0x35, 0x3F, 0x2B, 0x38, 0x3E, 0x14, 0x14, 0x14, 0x1F, 0x2F, 0x0F, 0x0C, 0x08, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x0C, 0x0E, 0x3A, 0x1F, 0x1F, 0x14, 0x14, 0x14, 0x3E, 0x38, 0x3F, 0x3F, 0x35,
+    0x46, 0x36, 0x36, 0x47, 0x2E, 0x42, 0x3C, 0x39, 0x39, 0x39, 0x43, 0x45, 0x48, 0x48, 0x48, 0x49,
+    0x49, 0x48, 0x48, 0x48, 0x45, 0x43, 0x39, 0x39, 0x39, 0x3C, 0x42, 0x2E, 0x47, 0x36, 0x36, 0x46,
+    0x35, 0x3F, 0x3F, 0x38, 0x3E, 0x14, 0x14, 0x14, 0x1F, 0x1F, 0x3A, 0x0E, 0x0C, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x0C, 0x0E, 0x3A, 0x1F, 0x4A, 0x14, 0x14, 0x14, 0x38, 0x4B, 0x3F, 0x35, 0x4C,
+    0x40, 0x4D, 0x4E, 0x42, 0x42, 0x42, 0x3C, 0x39, 0x39, 0x43, 0x48, 0x48, 0x49, 0x4F, 0x50, 0x50,
+    0x50, 0x50, 0x4F, 0x49, 0x48, 0x48, 0x43, 0x39, 0x39, 0x3C, 0x42, 0x42, 0x42, 0x4E, 0x4D, 0x40,
+    0x4C, 0x35, 0x3F, 0x4B, 0x38, 0x14, 0x14, 0x14, 0x4A, 0x1F, 0x3A, 0x0E, 0x0C, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x0C, 0x0F, 0x3A, 0x1F, 0x14, 0x14, 0x14, 0x3E, 0x38, 0x4B, 0x3F, 0x4C, 0x46,
+    0x40, 0x4D, 0x47, 0x42, 0x42, 0x3C, 0x39, 0x51, 0x52, 0x48, 0x48, 0x50, 0x50, 0x53, 0x53, 0x53,
+    0x53, 0x53, 0x53, 0x50, 0x50, 0x48, 0x48, 0x52, 0x51, 0x39, 0x3C, 0x42, 0x42, 0x47, 0x4D, 0x40,
+    0x46, 0x4C, 0x3F, 0x4B, 0x38, 0x3E, 0x14, 0x14, 0x14, 0x1F, 0x3A, 0x0F, 0x0C, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x0C, 0x3A, 0x3A, 0x1F, 0x14, 0x14, 0x14, 0x3E, 0x54, 0x3F, 0x3F, 0x4C, 0x46,
+    0x4D, 0x4D, 0x42, 0x42, 0x42, 0x3C, 0x51, 0x51, 0x55, 0x56, 0x57, 0x50, 0x58, 0x59, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x59, 0x58, 0x50, 0x57, 0x56, 0x55, 0x51, 0x51, 0x3C, 0x42, 0x42, 0x42, 0x4D, 0x4D,
+    0x46, 0x4C, 0x3F, 0x3F, 0x54, 0x3E, 0x14, 0x14, 0x14, 0x1F, 0x3A, 0x3A, 0x0C, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x0C, 0x3A, 0x2F, 0x5B, 0x14, 0x14, 0x14, 0x3E, 0x54, 0x3F, 0x5C, 0x4C, 0x5D,
+    0x4D, 0x5E, 0x42, 0x42, 0x3C, 0x5F, 0x51, 0x52, 0x56, 0x56, 0x60, 0x58, 0x59, 0x61, 0x61, 0x62,
+    0x62, 0x61, 0x61, 0x59, 0x58, 0x60, 0x56, 0x56, 0x52, 0x51, 0x5F, 0x3C, 0x42, 0x42, 0x5E, 0x4D,
+    0x5D, 0x4C, 0x5C, 0x3F, 0x54, 0x3E, 0x14, 0x14, 0x14, 0x5B, 0x2F, 0x3A, 0x0C, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x0C, 0x3A, 0x2F, 0x5B, 0x14, 0x14, 0x14, 0x63, 0x54, 0x3F, 0x64, 0x4C, 0x5D,
+    0x4D, 0x65, 0x42, 0x42, 0x5F, 0x51, 0x51, 0x66, 0x56, 0x67, 0x60, 0x68, 0x61, 0x61, 0x69, 0x69,
+    0x69, 0x69, 0x61, 0x61, 0x68, 0x60, 0x67, 0x56, 0x66, 0x51, 0x51, 0x5F, 0x42, 0x42, 0x65, 0x4D,
+    0x5D, 0x4C, 0x64, 0x3F, 0x54, 0x63, 0x14, 0x14, 0x14, 0x5B, 0x2F, 0x3A, 0x0C, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x0C, 0x3A, 0x2F, 0x5B, 0x14, 0x14, 0x14, 0x63, 0x54, 0x5C, 0x64, 0x6A, 0x5D,
+    0x5E, 0x65, 0x42, 0x42, 0x5F, 0x51, 0x51, 0x66, 0x67, 0x6B, 0x6C, 0x68, 0x6D, 0x6E, 0x69, 0x6F,
+    0x6F, 0x69, 0x6E, 0x6D, 0x68, 0x6C, 0x6B, 0x67, 0x66, 0x51, 0x51, 0x5F, 0x42, 0x42, 0x65, 0x5E,
+    0x5D, 0x6A, 0x64, 0x5C, 0x54, 0x63, 0x14, 0x14, 0x14, 0x5B, 0x2F, 0x3A, 0x0C, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x0C, 0x3A, 0x2F, 0x5B, 0x14, 0x14, 0x14, 0x63, 0x54, 0x5C, 0x64, 0x6A, 0x5D,
+    0x5E, 0x65, 0x42, 0x70, 0x5F, 0x51, 0x51, 0x66, 0x67, 0x6B, 0x6C, 0x68, 0x6D, 0x6E, 0x71, 0x6F,
+    0x6F, 0x71, 0x6E, 0x6D, 0x68, 0x6C, 0x6B, 0x67, 0x66, 0x51, 0x51, 0x5F, 0x70, 0x42, 0x65, 0x5E,
+    0x5D, 0x6A, 0x64, 0x5C, 0x54, 0x63, 0x14, 0x14, 0x14, 0x5B, 0x2F, 0x3A, 0x0C, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x0C, 0x3A, 0x2F, 0x5B, 0x14, 0x14, 0x14, 0x63, 0x54, 0x5C, 0x64, 0x6A, 0x72,
+    0x5E, 0x73, 0x42, 0x70, 0x5F, 0x51, 0x51, 0x74, 0x67, 0x75, 0x6C, 0x76, 0x6D, 0x77, 0x71, 0x71,
+    0x71, 0x71, 0x77, 0x6D, 0x76, 0x6C, 0x75, 0x67, 0x74, 0x51, 0x51, 0x5F, 0x70, 0x42, 0x73, 0x5E,
+    0x72, 0x6A, 0x64, 0x5C, 0x54, 0x63, 0x14, 0x14, 0x14, 0x5B, 0x2F, 0x3A, 0x0C, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x0C, 0x3A, 0x2F, 0x5B, 0x14, 0x14, 0x14, 0x63, 0x78, 0x5C, 0x79, 0x6A, 0x72,
+    0x5E, 0x7A, 0x70, 0x70, 0x5F, 0x5F, 0x7B, 0x74, 0x67, 0x75, 0x6C, 0x76, 0x7C, 0x77, 0x77, 0x7D,
+    0x7D, 0x77, 0x77, 0x7C, 0x76, 0x6C, 0x75, 0x67, 0x74, 0x7B, 0x5F, 0x5F, 0x70, 0x70, 0x7A, 0x5E,
+    0x72, 0x6A, 0x79, 0x5C, 0x78, 0x63, 0x14, 0x14, 0x14, 0x5B, 0x2F, 0x3A, 0x0C, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x0C, 0x3A, 0x3A, 0x5B, 0x14, 0x14, 0x14, 0x63, 0x78, 0x5C, 0x79, 0x6A, 0x72,
+    0x5E, 0x7A, 0x70, 0x70, 0x70, 0x5F, 0x7B, 0x7B, 0x7E, 0x75, 0x7F, 0x80, 0x76, 0x81, 0x77, 0x77,
+    0x77, 0x77, 0x81, 0x76, 0x80, 0x7F, 0x75, 0x7E, 0x7B, 0x7B, 0x5F, 0x70, 0x70, 0x70, 0x7A, 0x5E,
+    0x72, 0x6A, 0x79, 0x5C, 0x78, 0x63, 0x14, 0x14, 0x14, 0x5B, 0x3A, 0x3A, 0x0C, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x0C, 0x3A, 0x3A, 0x5B, 0x14, 0x14, 0x14, 0x63, 0x78, 0x82, 0x79, 0x6A, 0x72,
+    0x83, 0x7A, 0x84, 0x70, 0x70, 0x5F, 0x7B, 0x7B, 0x85, 0x75, 0x86, 0x80, 0x80, 0x87, 0x87, 0x87,
+    0x87, 0x87, 0x87, 0x80, 0x80, 0x86, 0x75, 0x85, 0x7B, 0x7B, 0x5F, 0x70, 0x70, 0x84, 0x7A, 0x83,
+    0x72, 0x6A, 0x79, 0x82, 0x78, 0x63, 0x14, 0x14, 0x14, 0x5B, 0x3A, 0x3A, 0x0C, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x0C, 0x88, 0x3A, 0x5B, 0x4A, 0x14, 0x14, 0x14, 0x78, 0x82, 0x79, 0x6A, 0x89,
+    0x83, 0x7A, 0x8A, 0x70, 0x70, 0x70, 0x8B, 0x7B, 0x7B, 0x85, 0x86, 0x86, 0x7F, 0x8C, 0x8C, 0x8C,
+    0x8C, 0x8C, 0x8C, 0x7F, 0x86, 0x86, 0x85, 0x7B, 0x7B, 0x8B, 0x70, 0x70, 0x70, 0x8A, 0x7A, 0x83,
+    0x89, 0x6A, 0x79, 0x82, 0x78, 0x14, 0x14, 0x14, 0x4A, 0x5B, 0x3A, 0x88, 0x0C, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x0C, 0x88, 0x3A, 0x5B, 0x5B, 0x14, 0x14, 0x14, 0x8D, 0x78, 0x79, 0x79, 0x89,
+    0x72, 0x7A, 0x8E, 0x8F, 0x70, 0x70, 0x8B, 0x7B, 0x7B, 0x7B, 0x85, 0x86, 0x86, 0x86, 0x90, 0x91,
+    0x91, 0x90, 0x86, 0x86, 0x86, 0x85, 0x7B, 0x7B, 0x7B, 0x8B, 0x70, 0x70, 0x8F, 0x8E, 0x7A, 0x72,
+    0x89, 0x79, 0x79, 0x78, 0x8D, 0x14, 0x14, 0x14, 0x5B, 0x5B, 0x3A, 0x88, 0x0C, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x08, 0x0C, 0x3A, 0x92, 0x5B, 0x14, 0x14, 0x14, 0x8D, 0x78, 0x79, 0x79, 0x89,
+    0x72, 0x93, 0x7A, 0x8A, 0x70, 0x70, 0x94, 0x8B, 0x7B, 0x7B, 0x95, 0x96, 0x97, 0x86, 0x86, 0x86,
+    0x86, 0x86, 0x86, 0x97, 0x96, 0x95, 0x7B, 0x7B, 0x8B, 0x94, 0x70, 0x70, 0x8A, 0x7A, 0x93, 0x72,
+    0x89, 0x79, 0x79, 0x78, 0x8D, 0x14, 0x14, 0x14, 0x5B, 0x92, 0x3A, 0x0C, 0x08, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0B, 0x0C, 0x3A, 0x3A, 0x5B, 0x14, 0x14, 0x14, 0x14, 0x78, 0x98, 0x79, 0x99,
+    0x89, 0x9A, 0x7A, 0x8E, 0x8F, 0x70, 0x94, 0x94, 0x8B, 0x7B, 0x7B, 0x95, 0x95, 0x96, 0x96, 0x96,
+    0x96, 0x96, 0x96, 0x95, 0x95, 0x7B, 0x7B, 0x8B, 0x94, 0x94, 0x70, 0x8F, 0x8E, 0x7A, 0x9A, 0x89,
+    0x99, 0x79, 0x98, 0x78, 0x14, 0x14, 0x14, 0x14, 0x5B, 0x3A, 0x3A, 0x0C, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0x0C, 0x88, 0x3A, 0x5B, 0x9B, 0x14, 0x14, 0x14, 0x8D, 0x78, 0x79, 0x9C,
+    0x89, 0x9D, 0x9A, 0x8E, 0x8E, 0x9E, 0x70, 0x94, 0x94, 0x8B, 0x8B, 0x7B, 0x95, 0x95, 0x95, 0x95,
+    0x95, 0x95, 0x95, 0x95, 0x7B, 0x8B, 0x8B, 0x94, 0x94, 0x70, 0x9E, 0x8E, 0x8E, 0x9A, 0x9D, 0x89,
+    0x9C, 0x79, 0x78, 0x8D, 0x14, 0x14, 0x14, 0x9B, 0x5B, 0x3A, 0x88, 0x0C, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x08, 0x0C, 0x3A, 0x92, 0x5B, 0x14, 0x14, 0x14, 0x14, 0x78, 0x98, 0x79,
+    0x9C, 0x9D, 0x9A, 0x9F, 0x8E, 0xA0, 0x9E, 0x94, 0x94, 0x94, 0x94, 0x8B, 0x8B, 0xA1, 0x95, 0x95,
+    0x95, 0x95, 0xA1, 0x8B, 0x8B, 0x94, 0x94, 0x94, 0x94, 0x9E, 0xA0, 0x8E, 0x9F, 0x9A, 0x9D, 0x9C,
+    0x79, 0x98, 0x78, 0x14, 0x14, 0x14, 0x14, 0x5B, 0x92, 0x3A, 0x0C, 0x08, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0D, 0x0C, 0x3A, 0x3A, 0x5B, 0xA2, 0x14, 0x14, 0x14, 0x8D, 0xA3, 0x98,
+    0x9C, 0x99, 0x9D, 0x9A, 0x9F, 0x8E, 0xA0, 0x9E, 0x94, 0x94, 0x94, 0x94, 0x94, 0x8B, 0x8B, 0x8B,
+    0x8B, 0x8B, 0x8B, 0x94, 0x94, 0x94, 0x94, 0x94, 0x9E, 0xA0, 0x8E, 0x9F, 0x9A, 0x9D, 0x99, 0x9C,
+    0x98, 0xA3, 0x8D, 0x14, 0x14, 0x14, 0xA2, 0x5B, 0x3A, 0x3A, 0x0C, 0x0D, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x0C, 0x88, 0x3A, 0x92, 0x5B, 0x14, 0x14, 0x14, 0x14, 0x8D, 0xA3,
+    0x9C, 0x9C, 0x9D, 0x9D, 0xA4, 0x9F, 0x8E, 0xA0, 0xA5, 0xA6, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+    0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0xA6, 0xA5, 0xA0, 0x8E, 0x9F, 0xA4, 0x9D, 0x9D, 0x9C, 0x9C,
+    0xA3, 0x8D, 0x14, 0x14, 0x14, 0x14, 0x5B, 0x92, 0x3A, 0x88, 0x0C, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x0C, 0x3A, 0xA7, 0x5B, 0x9B, 0x14, 0x14, 0x14, 0x14, 0xA3,
+    0xA3, 0x9C, 0x9C, 0x9D, 0x9D, 0xA4, 0xA4, 0x8E, 0xA0, 0xA0, 0xA5, 0xA6, 0x94, 0x94, 0x94, 0x94,
+    0x94, 0x94, 0x94, 0x94, 0xA6, 0xA5, 0xA0, 0xA0, 0x8E, 0xA4, 0xA4, 0x9D, 0x9D, 0x9C, 0x9C, 0xA3,
+    0xA3, 0x14, 0x14, 0x14, 0x14, 0x9B, 0x5B, 0xA7, 0x3A, 0x0C, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x88, 0x3A, 0xA7, 0x5B, 0xA2, 0x14, 0x14, 0x14, 0x8D,
+    0xA3, 0xA3, 0x9C, 0x9C, 0xA8, 0x9D, 0xA9, 0xA4, 0x9F, 0xA0, 0xA0, 0xA0, 0xA0, 0xAA, 0xAB, 0xAB,
+    0xAB, 0xAB, 0xAA, 0xA0, 0xA0, 0xA0, 0xA0, 0x9F, 0xA4, 0xA9, 0x9D, 0xA8, 0x9C, 0x9C, 0xA3, 0xA3,
+    0x8D, 0x14, 0x14, 0x14, 0xA2, 0x5B, 0xA7, 0x3A, 0x88, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0C, 0x88, 0x3A, 0x92, 0x9B, 0x14, 0x14, 0x14, 0x14,
+    0x8D, 0xA3, 0xAC, 0x9C, 0x9C, 0xAD, 0x9D, 0xA9, 0xA4, 0xA4, 0xAE, 0xAE, 0xA0, 0xA0, 0xA0, 0xA0,
+    0xA0, 0xA0, 0xA0, 0xA0, 0xAE, 0xAE, 0xA4, 0xA4, 0xA9, 0x9D, 0xAD, 0x9C, 0x9C, 0xAC, 0xA3, 0x8D,
+    0x14, 0x14, 0x14, 0x14, 0x9B, 0x92, 0x3A, 0x88, 0x0C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x07, 0x0C, 0x3A, 0xA7, 0x5B, 0x9B, 0x14, 0x14, 0x14,
+    0x14, 0xAF, 0xA3, 0xAC, 0xB0, 0x9C, 0xAD, 0xA8, 0x9D, 0xA9, 0xA9, 0xA4, 0xA4, 0xB1, 0xB1, 0xB1,
+    0xB1, 0xB1, 0xB1, 0xA4, 0xA4, 0xA9, 0xA9, 0x9D, 0xA8, 0xAD, 0x9C, 0xB0, 0xAC, 0xA3, 0xAF, 0x14,
+    0x14, 0x14, 0x14, 0x9B, 0x5B, 0xA7, 0x3A, 0x0C, 0x07, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0C, 0xB2, 0x3A, 0xA7, 0x5B, 0x9B, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0xAF, 0xAC, 0xB0, 0x9C, 0xAD, 0xAD, 0xAD, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+    0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xAD, 0xAD, 0xAD, 0x9C, 0xB0, 0xAC, 0xAF, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x9B, 0x5B, 0xA7, 0x3A, 0xB2, 0x0C, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0C, 0x88, 0x3A, 0xA7, 0x9B, 0x9B, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0xAF, 0xA3, 0xAC, 0xB0, 0x9C, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xB3, 0xB3,
+    0xB3, 0xB3, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0x9C, 0xB0, 0xAC, 0xA3, 0xAF, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x9B, 0x9B, 0xA7, 0x3A, 0x88, 0x0C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x0C, 0x88, 0x3A, 0xA7, 0x9B, 0x9B,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xAF, 0xAC, 0xAC, 0xAC, 0xB0, 0xB4, 0xAD, 0xAD, 0xAD, 0xAD,
+    0xAD, 0xAD, 0xAD, 0xAD, 0xB4, 0xB0, 0xAC, 0xAC, 0xAC, 0xAF, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x9B, 0x9B, 0xA7, 0x3A, 0x88, 0x0C, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x0C, 0x88, 0x3A, 0xA7, 0x9B,
+    0x9B, 0xB5, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xAF, 0xAF, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+    0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAF, 0xAF, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xB5, 0x9B,
+    0x9B, 0xA7, 0x3A, 0x88, 0x0C, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x05, 0x0C, 0x88, 0x3A, 0xA7,
+    0x92, 0x9B, 0x9B, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xAF, 0xAF, 0xAF, 0xB6, 0xB6,
+    0xB6, 0xB6, 0xAF, 0xAF, 0xAF, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x9B, 0x9B, 0x92,
+    0xA7, 0x3A, 0x88, 0x0C, 0x05, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 0x0C, 0xB2, 0x3A,
+    0xA7, 0xA7, 0x9B, 0x9B, 0xB5, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xB5, 0x9B, 0x9B, 0xA7, 0xA7,
+    0x3A, 0xB2, 0x0C, 0x16, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0C, 0xB2,
+    0x88, 0xA7, 0xA7, 0x92, 0x9B, 0x9B, 0xB7, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xB7, 0x9B, 0x9B, 0x92, 0xA7, 0xA7, 0x88,
+    0xB2, 0x0C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x07,
+    0x0C, 0x88, 0x3A, 0xA7, 0xA7, 0x92, 0x9B, 0x9B, 0x9B, 0xB7, 0xB5, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0xB5, 0xB7, 0x9B, 0x9B, 0x9B, 0x92, 0xA7, 0xA7, 0x3A, 0x88, 0x0C,
+    0x07, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x04, 0x08, 0xB2, 0x88, 0x3A, 0xA7, 0xA7, 0xA7, 0xB8, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0xB7, 0xB7,
+    0xB7, 0xB7, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0xB8, 0xA7, 0xA7, 0xA7, 0x3A, 0x88, 0xB2, 0x08, 0x04,
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x0B, 0x0C, 0xB2, 0xB2, 0x88, 0x3A, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0x3A, 0x88, 0xB2, 0xB2, 0x0C, 0x0B, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x0D, 0x08, 0x0C, 0xB2, 0xB2, 0x88, 0x88, 0x3A, 0xA7, 0xA7, 0xA7, 0xA7,
+    0xA7, 0xA7, 0xA7, 0xA7, 0x3A, 0x88, 0x88, 0xB2, 0xB2, 0x0C, 0x08, 0x0D, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0A, 0x0B, 0x08, 0x0C, 0x0C, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2,
+    0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0x0C, 0x0C, 0x08, 0x0B, 0x0A, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const ILI9341IndexedImage_s Image_AssetBadge = {64, 64, 8, Image_AssetBadgePalette, Image_AssetBadgeData};
+
+static const uint16_t Image_AssetIconPalette[] = {
+    0x0000, 0x1154, 0xE2C2, 0xFE83
+};
+
+static const uint8_t Image_AssetIconData[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x65,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x15, 0xBD, 0x50, 0x00, 0x00, 0x00, 0x00, 0x56, 0xFE, 0x54, 0x00,
+    0x00, 0x00, 0x01, 0x5B, 0xFA, 0x95, 0x00, 0x00, 0x00, 0x05, 0x6F, 0xEA, 0xF5, 0x40, 0x00, 0x00,
+    0x15, 0xBF, 0xAB, 0xF9, 0x50, 0x00, 0x00, 0x56, 0xFE, 0xAF, 0xEA, 0x54, 0x00, 0x01, 0x5B, 0xFA,
+    0xBF, 0xAB, 0xD5, 0x00, 0x05, 0x6F, 0xEA, 0xFE, 0xAF, 0xE5, 0x40, 0x15, 0xBF, 0xAB, 0xFA, 0xBF,
+    0xA9, 0x50, 0x05, 0x7E, 0xAF, 0xEA, 0xFE, 0xA5, 0x40, 0x01, 0x5A, 0xBF, 0xAB, 0xFA, 0x95, 0x00,
+    0x00, 0x56, 0xFE, 0xAF, 0xEA, 0x54, 0x00, 0x00, 0x15, 0xFA, 0xBF, 0xA9, 0x50, 0x00, 0x00, 0x05,
+    0x6A, 0xFE, 0xA5, 0x40, 0x00, 0x00, 0x01, 0x5B, 0xFA, 0x95, 0x00, 0x00, 0x00, 0x00, 0x57, 0xEA,
+    0x54, 0x00, 0x00, 0x00, 0x00, 0x15, 0xA9, 0x50, 0x00, 0x00, 0x00, 0x00, 0x05, 0x65, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const ILI9341IndexedImage_s Image_AssetIcon = {27, 27, 2, Image_AssetIconPalette, Image_AssetIconData};
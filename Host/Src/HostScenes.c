@@ -0,0 +1,769 @@
+/********************************************************************************************************
+ * @Filename: HostScenes.c
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: Scripted scenes replayed by the host test harness, each one starts from a reset panel
+ *********************************************************************************************************/
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "ILI9341.h"
+#include "ILI9341Sim.h"
+#include "HostScenes.h"
+#include "SubsetStrings.h"
+#include "HostAssets.h"
+#include "HostImages.h"
+
+static void sceneTestFunction(void) { ILI9341TestScene(); }
+
+static void sceneFonts(void) {
+  ILI9341Initialize();
+  ILI9341FillScreen(RGB565_WHITE);
+  ILI9341DrawString(0, 0, "0123456789 !\"#$%&'()*+,-./", Font_07x10,
+                    RGB565_BLACK, RGB565_WHITE);
+  ILI9341DrawString(0, 20, "ABCDEFGHIJKLMNOPQRSTUVWXYZ", Font_11x18,
+                    RGB565_RED, RGB565_YELLOW);
+  ILI9341DrawString(0, 80, "abcdefghijklmnopqrstuvwxyz", Font_16x26,
+                    RGB565_DARKGREEN, RGB565_WHITE);
+}
+
+static void sceneProportional(void) {
+  static const char *const lines[] = {"AVATAR LTVW.", "Type: To Ya Wo", "iiii mmmm"};
+  FontDef_s fonts[] = {Font_07x10P, Font_11x18P, Font_16x26P};
+  uint16_t y = 4;
+  ILI9341Initialize();
+  ILI9341FillScreen(RGB565_WHITE);
+  for (uint32_t f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++) {
+    for (uint32_t l = 0; l < sizeof(lines) / sizeof(lines[0]); l++) {
+      ILI9341Extent_s extent = ILI9341MeasureString(lines[l], fonts[f]);
+      /* Outline the measured box, it must hug the drawn string */
+      ILI9341DrawLine(3, y - 1, 4 + extent.width, y - 1, RGB565_RED);
+      ILI9341DrawLine(3, y + extent.height, 4 + extent.width, y + extent.height, RGB565_RED);
+      ILI9341DrawString(4, y, lines[l], fonts[f], RGB565_BLACK, RGB565_YELLOW);
+      y += extent.height + 3;
+    }
+  }
+  ILI9341DrawString(0, y, "Lines of proportional text wrap at the edge", Font_11x18P,
+                    RGB565_DARKGREEN, RGB565_WHITE);
+}
+
+static void sceneAntialiased(void) {
+  ILI9341Initialize();
+  ILI9341FillScreen(RGB565_DARKCYAN);
+  ILI9341DrawString(0, 0, "AVWXYZ 0123", Font_11x18, RGB565_WHITE, RGB565_DARKCYAN);
+  ILI9341DrawString(0, 20, "AVWXYZ 0123", Font_11x18A2, RGB565_WHITE, RGB565_DARKCYAN);
+  ILI9341DrawString(0, 40, "AVWXYZ 0123", Font_11x18A4, RGB565_WHITE, RGB565_DARKCYAN);
+  ILI9341DrawString(0, 70, "AVWXYZ 0123", Font_16x26, RGB565_YELLOW, RGB565_BLUE);
+  ILI9341DrawString(0, 100, "AVWXYZ 0123", Font_16x26A2, RGB565_YELLOW, RGB565_BLUE);
+  ILI9341DrawString(0, 130, "AVWXYZ 0123", Font_16x26A4, RGB565_YELLOW, RGB565_BLUE);
+  ILI9341DrawString(0, 170, "swoosh", Font_16x26A4, RGB565_BLACK, RGB565_WHITE);
+}
+
+static void sceneGlyphCache(void) {
+  ILI9341GlyphCacheStats_s stats;
+  char line[40];
+  ILI9341Initialize();
+  ILI9341GlyphCacheReset();
+  ILI9341FillScreen(RGB565_BLACK);
+  /* A counter redrawn every frame next to a label, the label does not fit
+     into the 4 KiB host cache together with the digits */
+  for (uint32_t frame = 0; frame < 40; frame++) {
+    snprintf(line, sizeof(line), "%05lu", (unsigned long)(frame * 37));
+    ILI9341DrawString(10, 40, line, Font_11x18, RGB565_GREEN, RGB565_BLACK);
+    if (frame % 10 == 0)
+      ILI9341DrawString(10, 10, "Count", Font_16x26, RGB565_WHITE, RGB565_BLUE);
+  }
+  ILI9341GlyphCacheGetStats(&stats);
+  snprintf(line, sizeof(line), "hits %lu misses %lu", (unsigned long)stats.hits,
+           (unsigned long)stats.misses);
+  ILI9341DrawString(10, 80, line, Font_07x10, RGB565_WHITE, RGB565_BLACK);
+  snprintf(line, sizeof(line), "evictions %lu", (unsigned long)stats.evictions);
+  ILI9341DrawString(10, 92, line, Font_07x10, RGB565_WHITE, RGB565_BLACK);
+  snprintf(line, sizeof(line), "entries %lu bytes %lu", (unsigned long)stats.entries,
+           (unsigned long)stats.bytesUsed);
+  ILI9341DrawString(10, 104, line, Font_07x10, RGB565_WHITE, RGB565_BLACK);
+}
+
+static void sceneUnicode(void) {
+  ILI9341Extent_s extent;
+  ILI9341Initialize();
+  ILI9341FillScreen(RGB565_WHITE);
+  ILI9341DrawString(4, 4, "Grüße, Straße €5 ±0.5°", Font_Unicode14, RGB565_BLACK, RGB565_WHITE);
+  ILI9341DrawString(4, 24, "αβγ δεπ λμ ΣΩ", Font_Unicode14, RGB565_BLUE, RGB565_WHITE);
+  ILI9341DrawString(4, 44, "Привет мир… “ok” ←↑→↓", Font_Unicode14, RGB565_RED, RGB565_WHITE);
+  extent = ILI9341MeasureString("Привет мир", Font_Unicode14);
+  ILI9341FillRectangle(4, 64, extent.width, 2, RGB565_RED);
+  /* Missing characters and malformed UTF-8 draw glyph 0 */
+  ILI9341DrawString(4, 70, "A\xE4\xB8\xAD" "B\xFF" "C", Font_Unicode14, RGB565_BLACK, RGB565_YELLOW);
+  ILI9341DrawString(0, 100, "Mono: ÄÖÜ äöü ß", Font_UnicodeMono16, RGB565_BLACK, RGB565_WHITE);
+  ILI9341DrawString(0, 122, "ΣΩ πλμ Привет мир", Font_UnicodeMono16, RGB565_WHITE, RGB565_DARKGREEN);
+}
+
+static void sceneCompressed(void) {
+  static const char *const text = "Compressed glyphs: ÄÖÜ äöü ß αβγ ΣΩ Привет мир 0123456789";
+  ILI9341Initialize();
+  ILI9341FillScreen(RGB565_WHITE);
+  /* Both encodings must decode to the pixels of the uncompressed font */
+  ILI9341DrawString(0, 0, text, Font_UnicodeMono16Bits, RGB565_BLACK, RGB565_WHITE);
+  HostSceneSnapshot();
+  ILI9341FillScreen(RGB565_WHITE);
+  ILI9341DrawString(0, 0, text, Font_UnicodeMono16Rle, RGB565_BLACK, RGB565_WHITE);
+  HostSceneExpectSnapshot(1, "rle glyphs");
+  ILI9341FillScreen(RGB565_WHITE);
+  ILI9341DrawString(0, 0, text, Font_UnicodeMono16Delta, RGB565_BLACK, RGB565_WHITE);
+  HostSceneExpectSnapshot(1, "delta glyphs");
+}
+
+static void sceneTextLayout(void) {
+  static const char *const text = "The quick brown fox jumps over the lazy dog.\nSecond paragraph";
+  static const uint8_t aligns[] = {ILI9341_TEXT_ALIGN_LEFT, ILI9341_TEXT_ALIGN_CENTER,
+                                   ILI9341_TEXT_ALIGN_RIGHT};
+  ILI9341TextLayout_s layout = {0};
+  char line[48];
+  uint8_t first, second;
+  ILI9341Initialize();
+  ILI9341FillScreen(RGB565_WHITE);
+  for (uint32_t i = 0; i < 3; i++) {
+    uint16_t y = (uint16_t)(4 + i * 62);
+    ILI9341FillRectangle(9, y - 1, 222, 58, RGB565_RED);
+    ILI9341DrawTextBox(10, y, 220, 56, text, Font_11x18P,
+                       aligns[i] | ILI9341_TEXT_WRAP | ILI9341_TEXT_FILL, 1,
+                       RGB565_BLACK, RGB565_YELLOW);
+  }
+  /* Monospace text with spacing, a word wider than the box and a cut last line */
+  ILI9341FillRectangle(9, 191, 102, 62, RGB565_BLUE);
+  ILI9341DrawTextBox(10, 192, 100, 60, "Cells  wrap at spaces, Supercalifragilistic too", Font_07x10,
+                     ILI9341_TEXT_ALIGN_CENTER | ILI9341_TEXT_WRAP | ILI9341_TEXT_FILL, 3,
+                     RGB565_WHITE, RGB565_DARKGREEN);
+  /* No wrap, clipped on both edges of the box */
+  ILI9341FillRectangle(129, 191, 102, 22, RGB565_BLUE);
+  ILI9341DrawTextBox(130, 192, 100, 20, "Clipped", Font_16x26, ILI9341_TEXT_ALIGN_CENTER, 0,
+                     RGB565_BLACK, RGB565_CYAN);
+  ILI9341FillRectangle(129, 219, 102, 22, RGB565_BLUE);
+  ILI9341DrawTextBox(130, 220, 100, 20, "Clipped", Font_16x26P, ILI9341_TEXT_ALIGN_RIGHT, 0,
+                     RGB565_BLACK, RGB565_CYAN);
+  /* A second layout of the same string is served from the cache */
+  first = ILI9341LayoutText(&layout, text, Font_07x10P, 100, 100, ILI9341_TEXT_WRAP, 0);
+  second = ILI9341LayoutText(&layout, text, Font_07x10P, 100, 100, ILI9341_TEXT_WRAP, 0);
+  snprintf(line, sizeof(line), "layout %u %u lines %u %ux%u", first, second, layout.lineNum,
+           layout.extent.width, layout.extent.height);
+  ILI9341DrawString(10, 260, line, Font_07x10, RGB565_BLACK, RGB565_WHITE);
+}
+
+static void sceneTerminal(void) {
+  static ILI9341Terminal_s terminal;
+  uint32_t first, unchanged;
+  ILI9341Initialize();
+  ILI9341FillScreen(RGB565_WHITE);
+  /* Fixed rows above and below the scroll area must not move */
+  ILI9341DrawString(4, 4, "Terminal", Font_11x18, RGB565_BLACK, RGB565_WHITE);
+  ILI9341TerminalInit(&terminal, 30, 20, Font_07x10);
+  for (int32_t i = 0; i < 31; i++) {
+    ILI9341TerminalSetAttribute(&terminal, ILI9341_TERMINAL_ATTRIBUTE(i % 3 == 0 ? 10 : 7, 0));
+    ILI9341TerminalPrintf(&terminal, "%3d %-6s %05ld 0x%04X %c|\n", i, i % 2 ? "odd" : "even",
+                          (long)(i * -137), (unsigned)(i * 4099), 'a' + i % 26);
+    if (i % 4 == 3)
+      ILI9341TerminalFlush(&terminal);
+  }
+  ILI9341TerminalSetAttribute(&terminal, ILI9341_TERMINAL_ATTRIBUTE(0, 14));
+  ILI9341TerminalWrite(&terminal, "Wrapped: the quick brown fox jumps over the lazy dog\tÄ");
+  first = ILI9341TerminalFlush(&terminal);
+  ILI9341TerminalWrite(&terminal, "\r over the");
+  unchanged = ILI9341TerminalFlush(&terminal);
+  ILI9341TerminalPrintf(&terminal, "\ncells %lu then %lu", (unsigned long)first,
+                        (unsigned long)unchanged);
+  ILI9341TerminalFlush(&terminal);
+  ILI9341DrawString(4, 236, "Footer", Font_11x18, RGB565_BLACK, RGB565_WHITE);
+}
+
+static void sceneReadout(void) {
+  static const struct {
+    int32_t value;
+    uint8_t fractionBits;
+    uint8_t decimals;
+  } cases[] = {
+    {INT32_MIN, 0, 0}, {INT32_MAX, 0, 3}, {-5, 0, 3}, {7, 0, 9}, {0x18000, 16, 2},
+    {-0x8000, 16, 0}, {-1, 16, 3}, {0x7FFFFFFF, 4, 9},
+  };
+  ILI9341Readout_s voltage, frequency, phase;
+  uint32_t drawn = 0, cells = 0;
+  char line[ILI9341_FORMAT_BUFFER_SIZE + 24];
+  ILI9341Initialize();
+  ILI9341FillScreen(RGB565_BLACK);
+  ILI9341ReadoutInit(&voltage, 10, 10, Font_16x26, 8, 3, RGB565_YELLOW, RGB565_BLACK);
+  ILI9341ReadoutInit(&frequency, 10, 44, Font_11x18P, 9, 2, RGB565_GREEN, RGB565_BLACK);
+  ILI9341ReadoutInit(&phase, 10, 70, Font_11x18, 7, 1, RGB565_CYAN, RGB565_BLACK);
+  /* 50 updates of slowly drifting values, most digits stay */
+  for (int32_t frame = 0; frame < 50; frame++) {
+    drawn += ILI9341ReadoutSetInteger(&voltage, 229870 + frame * 7);
+    drawn += ILI9341ReadoutSetInteger(&frequency, 4999 + (frame % 5));
+    drawn += ILI9341ReadoutSetFixed(&phase, -(1800 << 16) / 10 + frame * 0x4000, 16);
+    cells += 8 + 9 + 7;
+    if (frame == 30)
+      ILI9341ReadoutSetColors(&voltage, RGB565_RED, RGB565_BLACK);
+  }
+  snprintf(line, sizeof(line), "cells %lu of %lu", (unsigned long)drawn, (unsigned long)cells);
+  ILI9341DrawString(10, 96, line, Font_07x10, RGB565_WHITE, RGB565_BLACK);
+  ILI9341ReadoutSetText(&phase, "overflowing");
+  for (uint32_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+    ILI9341FormatFixed(line, cases[i].value, cases[i].fractionBits, cases[i].decimals);
+    ILI9341DrawString(10, (uint16_t)(120 + i * 12), line, Font_07x10, RGB565_WHITE, RGB565_BLACK);
+  }
+}
+
+static void sceneScaled(void) {
+  ILI9341SimCounters_s before, after;
+  uint32_t small, large;
+  char line[40];
+  ILI9341Initialize();
+  ILI9341FillScreen(RGB565_WHITE);
+  /* Window setups of a 1x and a 4x digit string, three commands per window */
+  before = ILI9341SimGetCounters();
+  ILI9341DrawString(4, 4, "12.5", Font_16x26, RGB565_BLACK, RGB565_WHITE);
+  after = ILI9341SimGetCounters();
+  small = after.registerWrites - before.registerWrites;
+  ILI9341DrawStringScaled(4, 34, "12.5", Font_16x26, 3, RGB565_BLUE, RGB565_YELLOW);
+  before = ILI9341SimGetCounters();
+  large = before.registerWrites - after.registerWrites;
+  ILI9341DrawStringScaled(4, 116, "42", Font_07x10, 8, RGB565_WHITE, RGB565_DARKGREEN);
+  ILI9341DrawStringScaled(130, 116, "8.3", Font_16x26A4, 2, RGB565_BLACK, RGB565_WHITE);
+  ILI9341DrawStringScaled(4, 200, "AVA Wave", Font_11x18P, 2, RGB565_RED, RGB565_WHITE);
+  /* Cut at the screen edges */
+  ILI9341DrawStringScaled(180, 250, "XYZ", Font_11x18, 4, RGB565_WHITE, RGB565_BLUE);
+  ILI9341DrawStringScaled(0, 290, "Edge", Font_11x18P, 3, RGB565_BLACK, RGB565_CYAN);
+  snprintf(line, sizeof(line), "commands 1x %lu 3x %lu", (unsigned long)small, (unsigned long)large);
+  ILI9341DrawString(4, 240, line, Font_07x10, RGB565_BLACK, RGB565_WHITE);
+}
+
+static void sceneSubset(void) {
+  FontDef_s fonts[] = {Font_07x10, Font_11x18P, Font_16x26A4};
+  FontDef_s subsets[] = {Font_07x10S, Font_11x18PS, Font_16x26A4S};
+  uint16_t y = 4;
+  ILI9341Initialize();
+  /* Each string drawn with the full and the subset font must give the same frame */
+  for (uint32_t i = 0; SubsetStrings[i] != NULL; i++) {
+    for (uint32_t f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++) {
+      ILI9341FillRectangle(0, 0, 240, 32, RGB565_WHITE);
+      ILI9341DrawString(4, 4, SubsetStrings[i], fonts[f], RGB565_BLACK, RGB565_WHITE);
+      HostSceneSnapshot();
+      ILI9341FillRectangle(0, 0, 240, 32, RGB565_WHITE);
+      ILI9341DrawString(4, 4, SubsetStrings[i], subsets[f], RGB565_BLACK, RGB565_WHITE);
+      HostSceneExpectSnapshot(1, "subset font string");
+    }
+  }
+  ILI9341FillScreen(RGB565_WHITE);
+  for (uint32_t f = 0; f < sizeof(subsets) / sizeof(subsets[0]); f++) {
+    for (uint32_t i = 0; SubsetStrings[i] != NULL; i++) {
+      ILI9341DrawString(4, y, SubsetStrings[i], subsets[f], RGB565_BLACK, RGB565_WHITE);
+      y = (uint16_t)(y + subsets[f].height + 2);
+    }
+  }
+  /* Characters left out of the subset draw as a space */
+  ILI9341DrawString(4, y, "[xyz] Quit", Font_11x18PS, RGB565_RED, RGB565_WHITE);
+}
+
+static void sceneBitmap(void) {
+  /* 16x16 bell icon, MSB first */
+  static const uint8_t bell[] = {
+    0x01, 0x80, 0x03, 0xC0, 0x0F, 0xF0, 0x1F, 0xF8, 0x1F, 0xF8, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC,
+    0x3F, 0xFC, 0x7F, 0xFE, 0x7F, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xC0, 0x01, 0x80,
+  };
+  /* 45 pixels wide, rows cross the 32-pixel chunks and end mid byte */
+  static uint8_t rings[6 * 45];
+  ILI9341SimCounters_s before, after;
+  uint32_t opaque, transparent;
+  char line[48];
+  for (int32_t y = 0; y < 45; y++)
+    for (int32_t x = 0; x < 45; x++) {
+      int32_t dx = x - 22, dy = y - 22, d = dx * dx + dy * dy;
+      if ((d / 60) % 2 == 0 || x == 44)
+        rings[y * 6 + x / 8] |= (uint8_t)(0x80 >> (x % 8));
+    }
+  ILI9341Initialize();
+  for (uint16_t y = 0; y < 320; y += 8)
+    ILI9341FillRectangle(0, y, 240, 8, RGB888ToRGB565(y / 2, 80, (255 - y * 3 / 4)));
+  ILI9341DrawBitmap(8, 8, 16, 16, bell, RGB565_YELLOW, RGB565_BLACK);
+  ILI9341DrawBitmapTransparent(32, 8, 16, 16, bell, RGB565_YELLOW);
+  before = ILI9341SimGetCounters();
+  ILI9341DrawBitmap(8, 40, 45, 45, rings, RGB565_WHITE, RGB565_DARKGREEN);
+  after = ILI9341SimGetCounters();
+  opaque = after.registerWrites + after.dataWrites - before.registerWrites - before.dataWrites;
+  ILI9341DrawBitmapTransparent(70, 40, 45, 45, rings, RGB565_WHITE);
+  before = ILI9341SimGetCounters();
+  transparent = before.registerWrites + before.dataWrites - after.registerWrites - after.dataWrites;
+  /* Clipped at the right and bottom edges */
+  ILI9341DrawBitmap(210, 100, 45, 45, rings, RGB565_BLACK, RGB565_ORANGE);
+  ILI9341DrawBitmapTransparent(200, 290, 45, 45, rings, RGB565_RED);
+  snprintf(line, sizeof(line), "opaque %lu transparent %lu", (unsigned long)opaque,
+           (unsigned long)transparent);
+  ILI9341DrawString(8, 100, line, Font_07x10, RGB565_WHITE, RGB565_BLACK);
+}
+
+static void sceneRleImage(void) {
+  ILI9341SimCounters_s before, after;
+  ILI9341RleStream_s stream;
+  uint32_t rawWrites, rleWrites, offset, left = 1;
+  char line[48];
+  ILI9341Initialize();
+  ILI9341FillScreen(RGB565_BLACK);
+  before = ILI9341SimGetCounters();
+  ILI9341DrawImage(20, 10, HOST_SPLASH_WIDTH, HOST_SPLASH_HEIGHT, Image_SplashRaw);
+  after = ILI9341SimGetCounters();
+  rawWrites = after.dataWrites - before.dataWrites;
+  HostSceneSnapshot();
+  ILI9341FillScreen(RGB565_BLACK);
+  before = ILI9341SimGetCounters();
+  ILI9341DrawRleImage(20, 10, &Image_Splash);
+  after = ILI9341SimGetCounters();
+  rleWrites = after.dataWrites - before.dataWrites;
+  HostSceneExpectSnapshot(1, "rle image");
+  /* 7-word chunks split headers, colors and literals everywhere */
+  ILI9341FillScreen(RGB565_BLACK);
+  ILI9341RleBegin(&stream, 20, 10, Image_Splash.width, Image_Splash.height);
+  for (offset = 0; offset < Image_Splash.length && left != 0; offset += 7)
+    left = ILI9341RleFeed(&stream, Image_Splash.data + offset,
+                          Image_Splash.length - offset < 7 ? Image_Splash.length - offset : 7);
+  HostSceneExpectSnapshot(left == 0, "rle stream");
+  ILI9341DrawRleImage(20, 140, &Image_Splash);
+  /* Does not fit, not drawn */
+  ILI9341DrawRleImage(100, 270, &Image_Splash);
+  snprintf(line, sizeof(line), "rle %lu of %lu bytes", (unsigned long)Image_Splash.length * 2,
+           (unsigned long)(HOST_SPLASH_WIDTH * HOST_SPLASH_HEIGHT * 2));
+  ILI9341DrawString(20, 270, line, Font_07x10, RGB565_WHITE, RGB565_BLACK);
+  snprintf(line, sizeof(line), "data writes %lu raw %lu", (unsigned long)rleWrites,
+           (unsigned long)rawWrites);
+  ILI9341DrawString(20, 284, line, Font_07x10, RGB565_WHITE, RGB565_BLACK);
+}
+
+static void sceneQoi(void) {
+  static ILI9341QoiDecoder_s decoder;
+  static const uint8_t notQoi[] = "qoix0000000000";
+  /* x + width wraps to 0 in 32 bits */
+  static const uint8_t hugeQoi[] = {'q', 'o', 'i', 'f', 0xFF, 0xFF, 0xFF, 0xFF, 0, 0, 0, 1, 3, 0};
+  uint32_t offset;
+  uint8_t state = ILI9341_QOI_MORE, truncated, error;
+  char line[48];
+  ILI9341Initialize();
+  ILI9341FillScreen(RGB565_BLACK);
+  ILI9341DrawImage(40, 10, HOST_PHOTO_WIDTH, HOST_PHOTO_HEIGHT, Image_PhotoRaw);
+  HostSceneSnapshot();
+  ILI9341FillScreen(RGB565_BLACK);
+  state = ILI9341DrawQoi(40, 10, Image_Photo, Image_PhotoSize);
+  HostSceneExpectSnapshot(state == ILI9341_QOI_DONE, "qoi image");
+  /* 3-byte chunks split the header and every multi-byte op */
+  ILI9341FillScreen(RGB565_BLACK);
+  ILI9341QoiBegin(&decoder, 40, 10);
+  for (offset = 0, state = ILI9341_QOI_MORE; offset < Image_PhotoSize && state == ILI9341_QOI_MORE;
+       offset += 3)
+    state = ILI9341QoiFeed(&decoder, Image_Photo + offset,
+                           Image_PhotoSize - offset < 3 ? Image_PhotoSize - offset : 3);
+  HostSceneExpectSnapshot(state == ILI9341_QOI_DONE, "qoi stream");
+  ILI9341DrawQoi(40, 140, Image_Photo, Image_PhotoSize);
+  truncated = ILI9341DrawQoi(0, 200, Image_Photo, 20);
+  error = ILI9341DrawQoi(0, 0, notQoi, sizeof(notQoi) - 1);
+  HostSceneExpect(ILI9341DrawQoi(1, 0, hugeQoi, sizeof(hugeQoi)) == ILI9341_QOI_ERROR, "huge width");
+  snprintf(line, sizeof(line), "qoi %lu of %lu bytes", (unsigned long)Image_PhotoSize,
+           (unsigned long)(HOST_PHOTO_WIDTH * HOST_PHOTO_HEIGHT * 2));
+  ILI9341DrawString(40, 270, line, Font_07x10, RGB565_WHITE, RGB565_BLACK);
+  snprintf(line, sizeof(line), "states %u %u", truncated, error);
+  ILI9341DrawString(40, 284, line, Font_07x10, RGB565_WHITE, RGB565_BLACK);
+}
+
+/**
+ * @brief Mean absolute difference of two frames per channel in tenths of an
+ * 8-bit step, over pixelNum pixels that differ from black
+ */
+static uint32_t frameError(const uint16_t *a, const uint16_t *b, uint32_t pixelNum) {
+  uint32_t sum = 0, i;
+  for (i = 0; i < ILI9341_SIM_PANEL_WIDTH * ILI9341_SIM_PANEL_HEIGHT; i++) {
+    int32_t red = (a[i] >> 11 << 3) - (b[i] >> 11 << 3);
+    int32_t green = ((a[i] >> 5 & 0x3F) << 2) - ((b[i] >> 5 & 0x3F) << 2);
+    int32_t blue = ((a[i] & 0x1F) << 3) - ((b[i] & 0x1F) << 3);
+    sum += (uint32_t)((red < 0 ? -red : red) + (green < 0 ? -green : green) + (blue < 0 ? -blue : blue));
+  }
+  return sum * 10 / (pixelNum * 3);
+}
+/**
+ * @brief Hands the JPEG out 100 bytes at a time like a file read
+ */
+static uint32_t readJpegChunk(void *context, uint8_t *buffer, uint32_t size) {
+  uint32_t *offset = context;
+  uint32_t count = Image_PhotoJpegSize - *offset < 100 ? Image_PhotoJpegSize - *offset : 100;
+  if (count > size)
+    count = size;
+  memcpy(buffer, Image_PhotoJpeg + *offset, count);
+  *offset += count;
+  return count;
+}
+
+static void sceneJpeg(void) {
+  static uint16_t raw[ILI9341_SIM_PANEL_WIDTH * ILI9341_SIM_PANEL_HEIGHT];
+  static ILI9341JpegDecoder_s decoder;
+  static const uint8_t notJpeg[] = {0xFF, 0xD8, 0xFF, 0xC2, 0x00, 0x02};
+  uint32_t error420, error444, offset = 0;
+  uint8_t truncated, unsupported;
+  char line[48];
+  ILI9341Initialize();
+  ILI9341FillScreen(RGB565_BLACK);
+  ILI9341DrawImage(40, 10, HOST_PHOTO_WIDTH, HOST_PHOTO_HEIGHT, Image_PhotoRaw);
+  memcpy(raw, ILI9341SimGetFrame(), sizeof(raw));
+  ILI9341FillScreen(RGB565_BLACK);
+  ILI9341DrawJpeg(40, 10, Image_PhotoJpeg444, Image_PhotoJpeg444Size, ILI9341_JPEG_SCALE_1);
+  error444 = frameError(raw, ILI9341SimGetFrame(), HOST_PHOTO_WIDTH * HOST_PHOTO_HEIGHT);
+  /* A file of another encoder, its restart intervals end mid row and at a partial last one */
+  ILI9341FillScreen(RGB565_BLACK);
+  ILI9341DrawImage(40, 10, HOST_PHOTO_WIDTH, HOST_PHOTO_HEIGHT, Image_PhotoLibjpegDecoded);
+  HostSceneSnapshot();
+  ILI9341FillScreen(RGB565_BLACK);
+  HostSceneExpectSnapshot(ILI9341DrawJpeg(40, 10, Image_PhotoLibjpeg, Image_PhotoLibjpegSize,
+                                          ILI9341_JPEG_SCALE_1) == ILI9341_JPEG_OK, "libjpeg file");
+  ILI9341FillScreen(RGB565_BLACK);
+  ILI9341DrawJpeg(40, 10, Image_PhotoJpeg, Image_PhotoJpegSize, ILI9341_JPEG_SCALE_1);
+  error420 = frameError(raw, ILI9341SimGetFrame(), HOST_PHOTO_WIDTH * HOST_PHOTO_HEIGHT);
+  HostSceneSnapshot();
+  /* The same file through the read callback in chunks smaller than the input buffer */
+  HostSceneExpectSnapshot(ILI9341JpegBegin(&decoder, NULL, 0, readJpegChunk, &offset) == ILI9341_JPEG_OK &&
+                          ILI9341JpegDraw(&decoder, 40, 10, ILI9341_JPEG_SCALE_1) == ILI9341_JPEG_OK,
+                          "jpeg read callback");
+  ILI9341DrawJpeg(0, 140, Image_PhotoJpeg, Image_PhotoJpegSize, ILI9341_JPEG_SCALE_2);
+  ILI9341DrawJpeg(90, 140, Image_PhotoJpeg, Image_PhotoJpegSize, ILI9341_JPEG_SCALE_4);
+  ILI9341DrawJpeg(135, 140, Image_PhotoJpeg, Image_PhotoJpegSize, ILI9341_JPEG_SCALE_8);
+  ILI9341DrawJpeg(160, 140, Image_PhotoJpeg444, Image_PhotoJpeg444Size, ILI9341_JPEG_SCALE_2);
+  /* Clipped at the right and bottom edges */
+  ILI9341DrawJpeg(160, 240, Image_PhotoJpeg, Image_PhotoJpegSize, ILI9341_JPEG_SCALE_1);
+  ILI9341DrawJpeg(0, 252, Image_PhotoLibjpeg, Image_PhotoLibjpegSize, ILI9341_JPEG_SCALE_2);
+  truncated = ILI9341DrawJpeg(135, 170, Image_PhotoJpeg, Image_PhotoJpegSize / 2, ILI9341_JPEG_SCALE_8);
+  unsupported = ILI9341DrawJpeg(0, 0, notJpeg, sizeof(notJpeg), ILI9341_JPEG_SCALE_1);
+  snprintf(line, sizeof(line), "jpeg %lu of %lu bytes", (unsigned long)Image_PhotoJpegSize,
+           (unsigned long)(HOST_PHOTO_WIDTH * HOST_PHOTO_HEIGHT * 2));
+  ILI9341DrawString(0, 210, line, Font_07x10, RGB565_WHITE, RGB565_BLACK);
+  snprintf(line, sizeof(line), "err 420 %lu.%lu 444 %lu.%lu", (unsigned long)(error420 / 10),
+           (unsigned long)(error420 % 10), (unsigned long)(error444 / 10), (unsigned long)(error444 % 10));
+  ILI9341DrawString(0, 224, line, Font_07x10, RGB565_WHITE, RGB565_BLACK);
+  snprintf(line, sizeof(line), "states %u %u", truncated, unsupported);
+  ILI9341DrawString(0, 238, line, Font_07x10, RGB565_WHITE, RGB565_BLACK);
+}
+
+/**
+ * @brief Hands the photo PNG out 64 bytes at a time like a file read
+ */
+static uint32_t readPngChunk(void *context, uint8_t *buffer, uint32_t size) {
+  uint32_t *offset = context;
+  uint32_t count = Image_PhotoPngSize - *offset < 64 ? Image_PhotoPngSize - *offset : 64;
+  if (count > size)
+    count = size;
+  memcpy(buffer, Image_PhotoPng + *offset, count);
+  *offset += count;
+  return count;
+}
+
+static void scenePng(void) {
+  static ILI9341PngDecoder_s decoder;
+  /* Signature and an IHDR of an interlaced image, CRCs are not checked */
+  static const uint8_t interlaced[] = {
+    0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A, 0, 0, 0, 13, 'I', 'H', 'D', 'R',
+    0, 0, 0, 8, 0, 0, 0, 8, 8, 2, 0, 0, 1, 0, 0, 0, 0
+  };
+  uint32_t offset = 0;
+  uint8_t truncated, error, unsupported;
+  char line[64];
+  ILI9341Initialize();
+  ILI9341FillScreen(RGB565_BLACK);
+  ILI9341DrawImage(20, 0, HOST_SPLASH_WIDTH, HOST_SPLASH_HEIGHT, Image_SplashRaw);
+  HostSceneSnapshot();
+  ILI9341FillScreen(RGB565_BLACK);
+  HostSceneExpectSnapshot(ILI9341DrawPng(20, 0, Image_SplashPng, Image_SplashPngSize, RGB565_BLACK) ==
+                          ILI9341_PNG_OK, "png image");
+  ILI9341FillScreen(RGB565_BLACK);
+  ILI9341DrawImage(40, 10, HOST_PHOTO_WIDTH, HOST_PHOTO_HEIGHT, Image_PhotoRaw);
+  HostSceneSnapshot();
+  ILI9341FillScreen(RGB565_BLACK);
+  /* Through the read callback, chunks smaller than the input buffer and the IDAT chunks */
+  HostSceneExpectSnapshot(ILI9341PngBegin(&decoder, NULL, 0, readPngChunk, &offset) == ILI9341_PNG_OK &&
+                          ILI9341PngDraw(&decoder, 40, 10, RGB565_BLACK) == ILI9341_PNG_OK,
+                          "png read callback");
+  ILI9341FillScreen(RGB565_BLACK);
+  ILI9341DrawPng(20, 0, Image_SplashPng, Image_SplashPngSize, RGB565_BLACK);
+  /* Alpha over the background color, drawn on a rectangle of that color */
+  ILI9341DrawPng(8, 128, Image_BadgePng, Image_BadgePngSize, RGB565_BLACK);
+  ILI9341FillRectangle(80, 128, HOST_BADGE_SIZE, HOST_BADGE_SIZE, RGB565_ORANGE);
+  ILI9341DrawPng(80, 128, Image_BadgePng, Image_BadgePngSize, RGB565_ORANGE);
+  ILI9341FillRectangle(200, 128, 40, HOST_BADGE_SIZE, RGB565_DARKCYAN);
+  ILI9341DrawPng(200, 128, Image_BadgePng, Image_BadgePngSize, RGB565_DARKCYAN);
+  ILI9341DrawPng(152, 128, Image_IconPng, Image_IconPngSize, RGB565_BLACK);
+  ILI9341FillRectangle(152, 162, HOST_ICON_SIZE, HOST_ICON_SIZE, RGB565_WHITE);
+  ILI9341DrawPng(152, 162, Image_IconPng, Image_IconPngSize, RGB565_WHITE);
+  /* Clipped at the bottom and right edges */
+  ILI9341DrawPng(160, 250, Image_PhotoPng, Image_PhotoPngSize, RGB565_BLACK);
+  truncated = ILI9341DrawPng(0, 250, Image_PhotoPng, Image_PhotoPngSize / 8, RGB565_BLACK);
+  error = ILI9341DrawPng(0, 0, Image_PhotoPng + 1, Image_PhotoPngSize - 1, RGB565_BLACK);
+  unsupported = ILI9341DrawPng(0, 0, interlaced, sizeof(interlaced), RGB565_BLACK);
+  snprintf(line, sizeof(line), "png %lu %lu %lu %lu bytes", (unsigned long)Image_SplashPngSize,
+           (unsigned long)Image_PhotoPngSize, (unsigned long)Image_BadgePngSize,
+           (unsigned long)Image_IconPngSize);
+  ILI9341DrawString(0, 200, line, Font_07x10, RGB565_WHITE, RGB565_BLACK);
+  snprintf(line, sizeof(line), "states %u %u %u", truncated, error, unsupported);
+  ILI9341DrawString(0, 214, line, Font_07x10, RGB565_WHITE, RGB565_BLACK);
+}
+
+static void sceneAssets(void) {
+  char line[64];
+  ILI9341Initialize();
+  ILI9341FillScreen(RGB565_BLACK);
+  ILI9341DrawImage(20, 0, HOST_SPLASH_WIDTH, HOST_SPLASH_HEIGHT, Image_SplashRaw);
+  HostSceneSnapshot();
+  /* The chosen format and the forced one draw the same pixels as the raw image */
+  ILI9341FillScreen(RGB565_BLACK);
+  Image_AssetSplash_DRAW(20, 0);
+  HostSceneExpectSnapshot(1, "chosen format");
+  ILI9341FillScreen(RGB565_BLACK);
+  Image_AssetSplashRle_DRAW(20, 0);
+  HostSceneExpectSnapshot(1, "forced rle");
+  /* ImageCompiler.cpp and ImagePack.py each have an rle and a qoi encoder, they must agree */
+  HostSceneExpect(Image_AssetSplashRle.length == Image_Splash.length &&
+                  memcmp(Image_AssetSplashRle.data, Image_Splash.data, Image_Splash.length * 2) == 0,
+                  "rle of the two image tools differs");
+  HostSceneExpect(Image_AssetSplashQoiSize == Image_SplashQoiSize &&
+                  memcmp(Image_AssetSplashQoi, Image_SplashQoi, Image_SplashQoiSize) == 0,
+                  "qoi of the two image tools differs");
+  Image_AssetBadge_DRAW(8, 128);
+  Image_AssetIcon_DRAW(88, 128);
+  /* Clipped at the bottom and right edges */
+  Image_AssetBadge_DRAW(200, 280);
+  Image_AssetIcon_DRAW(180, 305);
+  snprintf(line, sizeof(line), "bytes %u %u %u %u", Image_AssetSplash_BYTES, Image_AssetSplashRle_BYTES,
+           Image_AssetBadge_BYTES, Image_AssetIcon_BYTES);
+  ILI9341DrawString(0, 200, line, Font_07x10, RGB565_WHITE, RGB565_BLACK);
+}
+
+/**
+ * @brief Tile color of the Sprites scene backdrop
+ */
+static uint16_t spriteTile(uint32_t x, uint32_t y) {
+  return ((x / 20 + y / 20) & 1) ? RGB565_DARKCYAN : RGB565_BLACK;
+}
+
+/**
+ * @brief Background callback of the cursor sprite, recomputes the tiles
+ */
+static void spriteBackground(void *context, uint16_t x, uint16_t y, uint16_t *pixels, uint16_t pixelNum) {
+  (void)context;
+  for (uint16_t i = 0; i < pixelNum; i++)
+    pixels[i] = spriteTile(x + i, y);
+}
+
+static void sceneSprites(void) {
+  static uint16_t ring[12 * 12], arrow[11 * 11], saved[8][12 * 12];
+  static ILI9341Sprite_s markers[8], cursor;
+  uint32_t i, step;
+  /* A ring marker and an outlined arrow, the rest is the key color */
+  for (i = 0; i < 12 * 12; i++) {
+    int32_t dx = (int32_t)(i % 12) * 2 - 11, dy = (int32_t)(i / 12) * 2 - 11;
+    ring[i] = dx * dx + dy * dy >= 64 && dx * dx + dy * dy <= 144 ? RGB565_YELLOW : RGB565_MAGENTA;
+  }
+  for (i = 0; i < 11 * 11; i++) {
+    uint32_t x = i % 11, y = i / 11;
+    arrow[i] = x > y ? RGB565_MAGENTA : x == 0 || x == y || y == 10 ? RGB565_WHITE : RGB565_RED;
+  }
+  ILI9341Initialize();
+  for (uint16_t y = 0; y < 320; y += 20)
+    for (uint16_t x = 0; x < 240; x += 20)
+      ILI9341FillRectangle(x, y, 20, 20, spriteTile(x, y));
+  ILI9341DrawString(40, 100, "save under", Font_11x18, RGB565_WHITE, RGB565_BLUE);
+  HostSceneSnapshot();
+  /* Markers save through GRAM readback and leave the screen on both sides, the
+     cursor restores from the callback and leaves it at the bottom */
+  for (i = 0; i < 8; i++)
+    ILI9341SpriteInit(&markers[i], ring, 12, 12, RGB565_MAGENTA, saved[i], NULL, NULL);
+  ILI9341SpriteInit(&cursor, arrow, 11, 11, RGB565_MAGENTA, NULL, spriteBackground, NULL);
+  for (step = 0; step < 16; step++) {
+    for (i = 0; i < 8; i++)
+      ILI9341SpriteMove(&markers[i], (int16_t)(i * 30 + step * 2 - 6),
+                        (int16_t)(94 + step * 2 * ((int32_t)(i % 3) - 1)));
+    ILI9341SpriteMove(&cursor, (int16_t)(step * 14), (int16_t)(230 + step * 6));
+  }
+  ILI9341SpriteHide(&cursor);
+  for (i = 8; i-- > 0;)
+    ILI9341SpriteHide(&markers[i]);
+  HostSceneExpectSnapshot(1, "hidden sprites");
+  for (i = 0; i < 8; i++)
+    ILI9341SpriteMove(&markers[i], (int16_t)(i * 30 + 24), (int16_t)(94 + 30 * ((int32_t)(i % 3) - 1)));
+  ILI9341SpriteMove(&cursor, 120, 300);
+}
+
+static void sceneScaledImage(void) {
+  static const uint16_t colors[4] = {RGB565_RED, RGB565_GREEN, RGB565_BLUE, RGB565_BLACK};
+  uint16_t tiny[8 * 6];
+  uint32_t i;
+  for (i = 0; i < 8 * 6; i++)
+    tiny[i] = ((i % 8 + i / 8) & 1) ? RGB565_WHITE : colors[(i % 8) / 2];
+  ILI9341Initialize();
+  ILI9341FillScreen(RGB565_BLACK);
+  ILI9341DrawImage(40, 10, HOST_PHOTO_WIDTH, HOST_PHOTO_HEIGHT, Image_PhotoRaw);
+  HostSceneSnapshot();
+  /* At 1:1 both filters sample pixel centers exactly */
+  ILI9341FillScreen(RGB565_BLACK);
+  ILI9341DrawImageScaled(40, 10, HOST_PHOTO_WIDTH, HOST_PHOTO_HEIGHT, Image_PhotoRaw, HOST_PHOTO_WIDTH,
+                         HOST_PHOTO_HEIGHT, ILI9341_SCALE_NEAREST);
+  HostSceneExpectSnapshot(1, "nearest at 1:1");
+  ILI9341FillScreen(RGB565_BLACK);
+  ILI9341DrawImageScaled(40, 10, HOST_PHOTO_WIDTH, HOST_PHOTO_HEIGHT, Image_PhotoRaw, HOST_PHOTO_WIDTH,
+                         HOST_PHOTO_HEIGHT, ILI9341_SCALE_BILINEAR);
+  HostSceneExpectSnapshot(1, "bilinear at 1:1");
+  ILI9341FillScreen(RGB565_BLACK);
+  /* Thumbnails, a zoom of the icon and a zoom clipped at the bottom and right edges */
+  ILI9341DrawImageScaled(0, 0, HOST_PHOTO_WIDTH, HOST_PHOTO_HEIGHT, Image_PhotoRaw, 72, 54,
+                         ILI9341_SCALE_NEAREST);
+  ILI9341DrawImageScaled(80, 0, HOST_PHOTO_WIDTH, HOST_PHOTO_HEIGHT, Image_PhotoRaw, 72, 54,
+                         ILI9341_SCALE_BILINEAR);
+  ILI9341DrawImageScaled(160, 0, HOST_SPLASH_WIDTH, HOST_SPLASH_HEIGHT, Image_SplashRaw, 80, 48,
+                         ILI9341_SCALE_BILINEAR);
+  ILI9341DrawImageScaled(0, 70, HOST_PHOTO_WIDTH, HOST_PHOTO_HEIGHT, Image_PhotoRaw, 115, 86,
+                         ILI9341_SCALE_NEAREST);
+  ILI9341DrawImageScaled(120, 70, HOST_PHOTO_WIDTH, HOST_PHOTO_HEIGHT, Image_PhotoRaw, 115, 86,
+                         ILI9341_SCALE_BILINEAR);
+  ILI9341DrawImageScaled(0, 180, 8, 6, tiny, 96, 72, ILI9341_SCALE_NEAREST);
+  ILI9341DrawImageScaled(100, 180, 8, 6, tiny, 96, 72, ILI9341_SCALE_BILINEAR);
+  ILI9341DrawImageScaled(200, 250, HOST_PHOTO_WIDTH, HOST_PHOTO_HEIGHT, Image_PhotoRaw, 320, 240,
+                         ILI9341_SCALE_BILINEAR);
+}
+
+static void sceneRotated(void) {
+  static uint16_t turned[HOST_SPLASH_WIDTH * HOST_SPLASH_HEIGHT];
+  static const int32_t angles[5] = {-450, 0, 1275, 2400, 3337};
+  uint16_t needle[9 * 64];
+  uint32_t i;
+  /* A tapered needle with a white spine, its hub at 4, 56 */
+  for (i = 0; i < 9 * 64; i++) {
+    int32_t column = (int32_t)(i % 9) - 4, row = (int32_t)(i / 9);
+    int32_t half = row < 56 ? 1 + row * 3 / 56 : 4;
+    needle[i] = column < -half || column > half ? RGB565_MAGENTA : column == 0 ? RGB565_WHITE : RGB565_RED;
+  }
+  /* 0 degrees is ILI9341DrawImage, a quarter turn the image turned in a buffer */
+  ILI9341Initialize();
+  ILI9341FillScreen(RGB565_BLACK);
+  ILI9341DrawImage(20, 0, HOST_SPLASH_WIDTH, HOST_SPLASH_HEIGHT, Image_SplashRaw);
+  HostSceneSnapshot();
+  ILI9341FillScreen(RGB565_BLACK);
+  ILI9341DrawImageRotated(20, 0, HOST_SPLASH_WIDTH, HOST_SPLASH_HEIGHT, Image_SplashRaw, 0, 0, 3600, 256,
+                          ILI9341_NO_COLOR_KEY);
+  HostSceneExpectSnapshot(1, "full turn");
+  for (i = 0; i < HOST_SPLASH_WIDTH * HOST_SPLASH_HEIGHT; i++)
+    turned[(i % HOST_SPLASH_WIDTH) * HOST_SPLASH_HEIGHT + HOST_SPLASH_HEIGHT - 1 - i / HOST_SPLASH_WIDTH] =
+      Image_SplashRaw[i];
+  ILI9341FillScreen(RGB565_BLACK);
+  ILI9341DrawImage(60, 10, HOST_SPLASH_HEIGHT, HOST_SPLASH_WIDTH, turned);
+  HostSceneSnapshot();
+  ILI9341FillScreen(RGB565_BLACK);
+  ILI9341DrawImageRotated(179, 10, HOST_SPLASH_WIDTH, HOST_SPLASH_HEIGHT, Image_SplashRaw, 0, 0, 900, 256,
+                          ILI9341_NO_COLOR_KEY);
+  HostSceneExpectSnapshot(1, "quarter turn");
+  /* Dial with keyed needles, a photo tilted and shrunk, one enlarged past the screen corner */
+  ILI9341FillScreen(RGB565_BLACK);
+  ILI9341DrawImageRotated(170, 60, HOST_PHOTO_WIDTH, HOST_PHOTO_HEIGHT, Image_PhotoRaw, 80, 60, 300, 160,
+                          ILI9341_NO_COLOR_KEY);
+  ILI9341FillCircle(70, 80, 62, RGB565_DARKCYAN);
+  for (i = 0; i < 5; i++)
+    ILI9341DrawImageRotated(70, 80, 9, 64, needle, 4, 56, angles[i], 256, RGB565_MAGENTA);
+  ILI9341DrawImageRotated(70, 230, 9, 64, needle, 4, 56, 600, 512, RGB565_MAGENTA);
+  ILI9341DrawImageRotated(230, 300, HOST_PHOTO_WIDTH, HOST_PHOTO_HEIGHT, Image_PhotoRaw, 80, 60, -200, 384,
+                          ILI9341_NO_COLOR_KEY);
+}
+
+static void scenePrimitives(void) {
+  static uint16_t image[32 * 48];
+  for (uint16_t y = 0; y < 48; y++)
+    for (uint16_t x = 0; x < 32; x++)
+      image[y * 32 + x] = RGB888ToRGB565(x * 8, y * 5, (255 - x * 8));
+  ILI9341Initialize();
+  ILI9341FillScreen(RGB565_BLACK);
+  ILI9341DrawImage(10, 10, 32, 48, image);
+  ILI9341FillRectangle(60, 10, 100, 40, RGB565_ORANGE);
+  ILI9341DrawLine(0, 319, 239, 70, RGB565_GREENYELLOW);
+  ILI9341DrawLine(120, 80, 120, 300, RGB565_WHITE);
+  ILI9341FillCircle(180, 200, 40, RGB565_MAGENTA);
+  ILI9341FillTriangle(20, 300, 100, 120, 160, 310, RGB565_DARKCYAN);
+  for (uint16_t i = 0; i < 200; i += 7)
+    ILI9341DrawPixel(20 + i, 60 + i / 2, RGB565_RED);
+}
+
+/**
+ * @brief Stand-in for MX_FSMC_ApplyLCDTiming, programs the simulated bus
+ */
+static void applySimTiming(const ILI9341Timing_s *timing) {
+  ILI9341SimTiming_s writeTiming = {timing->writeAddressSetup, timing->writeDataSetup, 0};
+  ILI9341SimTiming_s readTiming = {timing->readAddressSetup, timing->readDataSetup, 0};
+  ILI9341SimSetTiming(&writeTiming, &readTiming);
+}
+/**
+ * @brief Calibrate against the datasheet limits and print the result, a
+ * timing that corrupts the bus would show up in the frame
+ */
+static void sceneCalibration(void) {
+  ILI9341Timing_s timing;
+  char line[32];
+  ILI9341SimSetPanelLimits(&ILI9341SimDatasheetLimits);
+  ILI9341Initialize();
+  ILI9341FillScreen(RGB565_BLUE);
+  if (ILI9341CalibrateTiming(applySimTiming, &timing) != 0)
+    ILI9341DrawString(0, 0, "calibration failed", Font_07x10, RGB565_RED, RGB565_BLUE);
+  snprintf(line, sizeof(line), "W %u/%u", timing.writeAddressSetup, timing.writeDataSetup);
+  ILI9341DrawString(0, 20, line, Font_11x18, RGB565_WHITE, RGB565_BLUE);
+  snprintf(line, sizeof(line), "R %u/%u", timing.readAddressSetup, timing.readDataSetup);
+  ILI9341DrawString(0, 40, line, Font_11x18, RGB565_WHITE, RGB565_BLUE);
+  ILI9341FillRectangle(20, 100, 200, 180, RGB565_GREENYELLOW);
+  ILI9341SimSetPanelLimits(NULL);
+}
+
+/**
+ * @brief Minimal profile through the non-blocking path, with display
+ * inversion so the profile shows up in the frame
+ */
+static void sceneInitProfile(void) {
+  static const uint8_t profile[] = {
+    0x01, ILI9341_INIT_DELAY | 0, 50,
+    0x3A, 1, 0x55,
+    0x11, ILI9341_INIT_DELAY | 0, 12,
+    0x21, 0,
+    0x29, 0,
+    0x36, 1, 0x08,
+    0x00, ILI9341_INIT_END
+  };
+  uint32_t polls = 0;
+  char line[32];
+  ILI9341InitStart(profile);
+  while (!ILI9341InitPoll())
+    polls++;
+  ILI9341FillScreen(RGB565_WHITE);
+  snprintf(line, sizeof(line), "%s", polls > 2 ? "polled" : "blocked");
+  ILI9341DrawString(10, 10, line, Font_16x26, RGB565_BLACK, RGB565_WHITE);
+}
+
+const HostScene_s HostScenes[] = {
+  {"TestFunction", sceneTestFunction},
+  {"Fonts", sceneFonts},
+  {"Proportional", sceneProportional},
+  {"Antialiased", sceneAntialiased},
+  {"GlyphCache", sceneGlyphCache},
+  {"Unicode", sceneUnicode},
+  {"Compressed", sceneCompressed},
+  {"TextLayout", sceneTextLayout},
+  {"Terminal", sceneTerminal},
+  {"Readout", sceneReadout},
+  {"Scaled", sceneScaled},
+  {"Subset", sceneSubset},
+  {"Bitmap", sceneBitmap},
+  {"RleImage", sceneRleImage},
+  {"Qoi", sceneQoi},
+  {"Jpeg", sceneJpeg},
+  {"Png", scenePng},
+  {"Assets", sceneAssets},
+  {"Sprites", sceneSprites},
+  {"ScaledImage", sceneScaledImage},
+  {"Rotated", sceneRotated},
+  {"Primitives", scenePrimitives},
+  {"Calibration", sceneCalibration},
+  {"InitProfile", sceneInitProfile},
+  {0, 0},
+};
@@ -0,0 +1,258 @@
+/********************************************************************************************************
+ * @Filename: HostTest.c
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: Host test harness, replays scenes against the simulated controller and checks the
+ *               frames against golden images and the bus writes against the recorded budget
+ *********************************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "ILI9341Sim.h"
+#include "ILI9341Trace.h"
+#include "HostScenes.h"
+#include "TracePlayer.h"
+
+#define HOST_MAX_SCENES 64
+#define HOST_PATH_LENGTH 512
+
+typedef struct {
+  char name[64];
+  uint32_t busWrites;
+} BusCost_s;
+
+static BusCost_s goldenCosts[HOST_MAX_SCENES];
+static uint32_t goldenCostNum;
+/**
+ * @brief Bus trace of the running scene, recorded through the driver's
+ * callback sink
+ */
+static uint8_t *traceBytes;
+static uint32_t traceLength, traceCapacity;
+static uint16_t sceneFrame[ILI9341_SIM_PANEL_WIDTH * ILI9341_SIM_PANEL_HEIGHT];
+static TraceStats_s traceStats;
+/**
+ * @brief Reference frame and failed self-checks of the running scene
+ */
+static uint16_t snapshotFrame[ILI9341_SIM_PANEL_WIDTH * ILI9341_SIM_PANEL_HEIGHT];
+static const char *sceneName;
+static uint32_t checkFailures;
+
+void HostSceneSnapshot(void) {
+  memcpy(snapshotFrame, ILI9341SimGetFrame(), sizeof(snapshotFrame));
+}
+
+uint8_t HostSceneExpect(uint8_t passed, const char *what) {
+  if (!passed) {
+    printf("%-16s FAIL %s\n", sceneName, what);
+    checkFailures++;
+  }
+  return passed;
+}
+
+uint8_t HostSceneExpectSnapshot(uint8_t drawn, const char *what) {
+  if (drawn && memcmp(snapshotFrame, ILI9341SimGetFrame(), sizeof(snapshotFrame)) == 0)
+    return 1;
+  printf("%-16s FAIL %s %s\n", sceneName, what, drawn ? "differs from the snapshot" : "failed");
+  checkFailures++;
+  return 0;
+}
+
+static void traceSink(const uint8_t *bytes, uint32_t length) {
+  if (traceLength + length > traceCapacity) {
+    traceCapacity = (traceLength + length) * 2;
+    traceBytes = realloc(traceBytes, traceCapacity);
+    if (traceBytes == NULL) {
+      fprintf(stderr, "out of memory for the bus trace\n");
+      exit(2);
+    }
+  }
+  memcpy(traceBytes + traceLength, bytes, length);
+  traceLength += length;
+}
+/**
+ * @brief Save the scene's trace and check that replaying it reproduces the
+ * frame drawn by the driver
+ * @return 0 when the replay matches
+ */
+static int checkTrace(const char *outputDir, const char *name) {
+  char path[HOST_PATH_LENGTH];
+  FILE *file;
+  snprintf(path, sizeof(path), "%s/%s.trace", outputDir, name);
+  file = fopen(path, "wb");
+  if (file != NULL) {
+    fwrite(traceBytes, 1, traceLength, file);
+    fclose(file);
+  }
+  memcpy(sceneFrame, ILI9341SimGetFrame(), sizeof(sceneFrame));
+  ILI9341SimReset();
+  if (TracePlayerRun(traceBytes, traceLength, TRACE_PLAYER_DIRECT, &traceStats) != 0)
+    return -1;
+  return memcmp(sceneFrame, ILI9341SimGetFrame(), sizeof(sceneFrame)) == 0 ? 0 : -1;
+}
+
+static void usage(const char *program) {
+  fprintf(stderr,
+          "Usage: %s [-u] [-t percent] [-g goldenDir] [-o outputDir] [scene...]\n"
+          "  -u  rewrite golden images and bus budget from this run\n"
+          "  -t  allowed bus write increase over the budget, default 1%%\n",
+          program);
+}
+
+static void loadBusCosts(const char *path) {
+  char line[128];
+  FILE *file = fopen(path, "r");
+  goldenCostNum = 0;
+  if (file == NULL)
+    return;
+  while (fgets(line, sizeof(line), file) && goldenCostNum < HOST_MAX_SCENES) {
+    BusCost_s *cost = &goldenCosts[goldenCostNum];
+    if (line[0] == '#')
+      continue;
+    if (sscanf(line, "%63s %u", cost->name, &cost->busWrites) == 2)
+      goldenCostNum++;
+  }
+  fclose(file);
+}
+
+static const BusCost_s *findBusCost(const char *name) {
+  for (uint32_t i = 0; i < goldenCostNum; i++)
+    if (strcmp(goldenCosts[i].name, name) == 0)
+      return &goldenCosts[i];
+  return NULL;
+}
+/**
+ * @brief Merge this run's costs into the budget file, keeping scenes that
+ * were not run
+ */
+static int saveBusCosts(const char *path, const BusCost_s *costs, uint32_t costNum) {
+  FILE *file;
+  for (uint32_t i = 0; i < costNum; i++) {
+    BusCost_s *cost = (BusCost_s *)findBusCost(costs[i].name);
+    if (cost != NULL) {
+      cost->busWrites = costs[i].busWrites;
+    } else if (goldenCostNum < HOST_MAX_SCENES) {
+      goldenCosts[goldenCostNum++] = costs[i];
+    }
+  }
+  file = fopen(path, "w");
+  if (file == NULL)
+    return -1;
+  fprintf(file, "# scene busWrites, regenerate with `make golden`\n");
+  for (uint32_t i = 0; i < goldenCostNum; i++)
+    fprintf(file, "%s %u\n", goldenCosts[i].name, goldenCosts[i].busWrites);
+  return fclose(file) == 0 ? 0 : -1;
+}
+
+static int sceneSelected(const char *name, char **selected, int selectedNum) {
+  if (selectedNum == 0)
+    return 1;
+  for (int i = 0; i < selectedNum; i++)
+    if (strcmp(selected[i], name) == 0)
+      return 1;
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  const char *goldenDir = "Golden", *outputDir = "build/frames";
+  char path[HOST_PATH_LENGTH], costPath[HOST_PATH_LENGTH];
+  double threshold = 1.0;
+  int update = 0, failures = 0, argi;
+  BusCost_s costs[HOST_MAX_SCENES];
+  uint32_t costNum = 0;
+
+  for (argi = 1; argi < argc && argv[argi][0] == '-'; argi++) {
+    if (strcmp(argv[argi], "-u") == 0) {
+      update = 1;
+    } else if (strcmp(argv[argi], "-t") == 0 && argi + 1 < argc) {
+      threshold = atof(argv[++argi]);
+    } else if (strcmp(argv[argi], "-g") == 0 && argi + 1 < argc) {
+      goldenDir = argv[++argi];
+    } else if (strcmp(argv[argi], "-o") == 0 && argi + 1 < argc) {
+      outputDir = argv[++argi];
+    } else {
+      usage(argv[0]);
+      return 2;
+    }
+  }
+  mkdir(outputDir, 0755);
+  snprintf(costPath, sizeof(costPath), "%s/BusCost.txt", goldenDir);
+  loadBusCosts(costPath);
+
+  for (const HostScene_s *scene = HostScenes; scene->name != NULL; scene++) {
+    ILI9341SimCounters_s counters;
+    uint32_t mismatches = 0, busWrites;
+    const BusCost_s *golden;
+    int frameFailed = 0, costFailed = 0;
+
+    if (!sceneSelected(scene->name, argv + argi, argc - argi))
+      continue;
+    ILI9341SimReset();
+    traceLength = 0;
+    sceneName = scene->name;
+    checkFailures = 0;
+    ILI9341TraceStartCallback(traceSink);
+    scene->draw();
+    ILI9341TraceStop();
+    failures += checkFailures != 0;
+    counters = ILI9341SimGetCounters();
+    busWrites = counters.registerWrites + counters.dataWrites;
+
+    snprintf(path, sizeof(path), "%s/%s.ppm", outputDir, scene->name);
+    if (ILI9341SimWritePPM(path) != 0)
+      fprintf(stderr, "%s: cannot write %s\n", scene->name, path);
+    if (checkTrace(outputDir, scene->name) != 0) {
+      printf("%-16s FAIL bus trace replay does not reproduce the frame\n", scene->name);
+      failures++;
+    }
+    /* A scene failing its self-checks never becomes golden */
+    if (update && checkFailures != 0) {
+      printf("%-16s not updated\n", scene->name);
+      continue;
+    }
+    snprintf(path, sizeof(path), "%s/%s.ppm", goldenDir, scene->name);
+    if (costNum < HOST_MAX_SCENES) {
+      snprintf(costs[costNum].name, sizeof(costs[costNum].name), "%s", scene->name);
+      costs[costNum++].busWrites = busWrites;
+    }
+
+    if (update) {
+      if (ILI9341SimWritePPM(path) != 0) {
+        fprintf(stderr, "%s: cannot write %s\n", scene->name, path);
+        failures++;
+      }
+      printf("%-16s updated, bus writes %u\n", scene->name, busWrites);
+      continue;
+    }
+
+    if (ILI9341SimComparePPM(path, &mismatches) != 0) {
+      printf("%-16s FAIL missing golden image %s\n", scene->name, path);
+      frameFailed = 1;
+    } else if (mismatches != 0) {
+      printf("%-16s FAIL %u pixels differ from %s\n", scene->name, mismatches, path);
+      frameFailed = 1;
+    }
+    golden = findBusCost(scene->name);
+    if (golden == NULL) {
+      printf("%-16s FAIL no bus budget in %s\n", scene->name, costPath);
+      costFailed = 1;
+    } else {
+      double change = golden->busWrites == 0 ? 0.0
+          : 100.0 * ((double)busWrites - golden->busWrites) / golden->busWrites;
+      costFailed = change > threshold;
+      printf("%-16s %s bus writes %u (budget %u, %+.2f%%), reads %u, pixels %u, trace %u bytes\n",
+             scene->name, costFailed ? "FAIL" : (frameFailed ? "    " : "OK  "),
+             busWrites, golden->busWrites, change, counters.dataReads,
+             counters.pixelWrites, traceLength);
+    }
+    failures += frameFailed || costFailed;
+  }
+
+  if (update && saveBusCosts(costPath, costs, costNum) != 0) {
+    fprintf(stderr, "cannot write %s\n", costPath);
+    failures++;
+  }
+  return failures == 0 ? 0 : 1;
+}
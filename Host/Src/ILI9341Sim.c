@@ -0,0 +1,377 @@
+/********************************************************************************************************
+ * @Filename: ILI9341Sim.c
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: Simulated ILI9341 controller, models the commands the driver uses on a 16-bit 8080 bus
+ *********************************************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "ILI9341Sim.h"
+
+#define SIM_MADCTL_MY 0x80
+#define SIM_MADCTL_MX 0x40
+#define SIM_MADCTL_MV 0x20
+
+#define SIM_PIXELS (ILI9341_SIM_PANEL_WIDTH * ILI9341_SIM_PANEL_HEIGHT)
+
+static struct {
+  uint16_t gram[SIM_PIXELS];
+  uint8_t command;
+  uint8_t params[16];
+  uint8_t paramCount;
+  uint16_t startColumn;
+  uint16_t endColumn;
+  uint16_t startPage;
+  uint16_t endPage;
+  uint16_t column;
+  uint16_t page;
+  uint8_t madctl;
+  uint8_t inverted;
+  uint8_t displayOn;
+  uint8_t sleeping;
+  uint16_t fixedTop;
+  uint16_t scrollHeight;
+  uint16_t scrollStart;
+  uint8_t scrolling;
+  uint8_t readDummyPending;
+  uint8_t readFifo[4];
+  uint8_t readFifoCount;
+  uint8_t lastAccessRead;
+  ILI9341SimTiming_s writeTiming;
+  ILI9341SimTiming_s readTiming;
+  ILI9341SimPanelLimits_s limits;
+  uint16_t lastWrite;
+  uint16_t lastRead;
+  ILI9341SimCounters_s counters;
+} sim;
+
+const ILI9341SimPanelLimits_s ILI9341SimDatasheetLimits = {3, 12, 60, 76};
+
+/**
+ * @brief Timing programmed by MX_FSMC_Init in Example/Core/Src/fsmc.c
+ */
+static const ILI9341SimTiming_s defaultTiming = {2, 16, 2};
+
+/**
+ * @brief Register reset, GRAM is left untouched like the real controller
+ */
+static void resetRegisters(void) {
+  sim.command = 0x00;
+  sim.paramCount = 0;
+  sim.startColumn = 0;
+  sim.endColumn = ILI9341_SIM_PANEL_WIDTH - 1;
+  sim.startPage = 0;
+  sim.endPage = ILI9341_SIM_PANEL_HEIGHT - 1;
+  sim.column = 0;
+  sim.page = 0;
+  sim.madctl = 0;
+  sim.inverted = 0;
+  sim.displayOn = 0;
+  sim.sleeping = 1;
+  sim.fixedTop = 0;
+  sim.scrollHeight = ILI9341_SIM_PANEL_HEIGHT;
+  sim.scrollStart = 0;
+  sim.scrolling = 0;
+  sim.readDummyPending = 0;
+  sim.readFifoCount = 0;
+}
+/**
+ * @brief Account one bus access in the cycle counter
+ */
+static void countAccess(uint8_t read) {
+  const ILI9341SimTiming_s *timing = read ? &sim.readTiming : &sim.writeTiming;
+  sim.counters.busCycles += timing->addressSetup + timing->dataSetup + 1;
+  if (read != sim.lastAccessRead)
+    sim.counters.busCycles += timing->busTurnaround;
+  sim.lastAccessRead = read;
+}
+/**
+ * @brief Apply the timing-error model to a write
+ * @return value latched by the controller
+ */
+static uint16_t latchWrite(uint16_t value) {
+  uint16_t latched = value;
+  const ILI9341SimTiming_s *timing = &sim.writeTiming;
+  if (timing->dataSetup < sim.limits.writeDataSetup
+      || timing->addressSetup + timing->dataSetup + 1 < sim.limits.writeCycle) {
+    sim.counters.timingErrors++;
+    latched = sim.lastWrite;
+  }
+  sim.lastWrite = value;
+  return latched;
+}
+/**
+ * @brief Apply the timing-error model to a read
+ * @return value sampled by the FSMC
+ */
+static uint16_t sampleRead(uint16_t value) {
+  uint16_t sampled = value;
+  const ILI9341SimTiming_s *timing = &sim.readTiming;
+  if (timing->dataSetup < sim.limits.readDataSetup
+      || timing->addressSetup + timing->dataSetup + 1 < sim.limits.readCycle) {
+    sim.counters.timingErrors++;
+    sampled = sim.lastRead;
+  }
+  sim.lastRead = value;
+  return sampled;
+}
+/**
+ * @brief Translate a logical column/page into a GRAM index according to MADCTL
+ * @return 1 when the address lands on the panel
+ */
+static int mapToPanel(uint16_t column, uint16_t page, uint32_t *index) {
+  uint16_t x = column, y = page;
+  if (sim.madctl & SIM_MADCTL_MV) {
+    x = page;
+    y = column;
+  }
+  if (x >= ILI9341_SIM_PANEL_WIDTH || y >= ILI9341_SIM_PANEL_HEIGHT)
+    return 0;
+  if (sim.madctl & SIM_MADCTL_MX)
+    x = ILI9341_SIM_PANEL_WIDTH - 1 - x;
+  if (sim.madctl & SIM_MADCTL_MY)
+    y = ILI9341_SIM_PANEL_HEIGHT - 1 - y;
+  *index = (uint32_t)y * ILI9341_SIM_PANEL_WIDTH + x;
+  return 1;
+}
+/**
+ * @brief Advance the address counter inside the current window
+ */
+static void advanceCursor(void) {
+  if (sim.column >= sim.endColumn) {
+    sim.column = sim.startColumn;
+    if (sim.page >= sim.endPage)
+      sim.page = sim.startPage;
+    else
+      sim.page++;
+  } else {
+    sim.column++;
+  }
+}
+
+static void writePixel(uint16_t value) {
+  uint32_t index;
+  sim.counters.pixelWrites++;
+  if (mapToPanel(sim.column, sim.page, &index))
+    sim.gram[index] = value;
+  else
+    sim.counters.droppedPixels++;
+  advanceCursor();
+}
+/**
+ * @brief Latch parameters once a command has received enough of them
+ */
+static void applyParameter(void) {
+  const uint8_t *p = sim.params;
+  switch (sim.command) {
+  case 0x2A:
+    if (sim.paramCount == 4) {
+      sim.startColumn = (uint16_t)(p[0] << 8 | p[1]);
+      sim.endColumn = (uint16_t)(p[2] << 8 | p[3]);
+    }
+    break;
+  case 0x2B:
+    if (sim.paramCount == 4) {
+      sim.startPage = (uint16_t)(p[0] << 8 | p[1]);
+      sim.endPage = (uint16_t)(p[2] << 8 | p[3]);
+    }
+    break;
+  case 0x33:
+    if (sim.paramCount == 6 && (p[0] << 8 | p[1]) + (p[2] << 8 | p[3]) + (p[4] << 8 | p[5])
+                                  == ILI9341_SIM_PANEL_HEIGHT) {
+      sim.fixedTop = (uint16_t)(p[0] << 8 | p[1]);
+      sim.scrollHeight = (uint16_t)(p[2] << 8 | p[3]);
+    }
+    break;
+  case 0x36:
+    if (sim.paramCount == 1)
+      sim.madctl = p[0];
+    break;
+  case 0x37:
+    if (sim.paramCount == 2) {
+      sim.scrollStart = (uint16_t)(p[0] << 8 | p[1]);
+      sim.scrolling = 1;
+    }
+    break;
+  default:
+    break;
+  }
+}
+
+void ILI9341SimReset(void) {
+  memset(&sim, 0, sizeof(sim));
+  sim.writeTiming = defaultTiming;
+  sim.readTiming = defaultTiming;
+  resetRegisters();
+}
+
+void ILI9341SimSetPanelLimits(const ILI9341SimPanelLimits_s *limits) {
+  if (limits != NULL)
+    sim.limits = *limits;
+  else
+    memset(&sim.limits, 0, sizeof(sim.limits));
+}
+
+void ILI9341SimSetTiming(const ILI9341SimTiming_s *writeTiming,
+                         const ILI9341SimTiming_s *readTiming) {
+  sim.writeTiming = *writeTiming;
+  sim.readTiming = *readTiming;
+}
+
+void ILI9341SimWriteRegister(uint16_t value) {
+  sim.counters.registerWrites++;
+  countAccess(0);
+  value = latchWrite(value);
+  sim.command = (uint8_t)value;
+  sim.paramCount = 0;
+  switch (sim.command) {
+  case 0x01:
+    resetRegisters();
+    break;
+  case 0x10:
+    sim.sleeping = 1;
+    break;
+  case 0x11:
+    sim.sleeping = 0;
+    break;
+  case 0x13:
+    sim.scrolling = 0;
+    break;
+  case 0x20:
+    sim.inverted = 0;
+    break;
+  case 0x21:
+    sim.inverted = 1;
+    break;
+  case 0x28:
+    sim.displayOn = 0;
+    break;
+  case 0x29:
+    sim.displayOn = 1;
+    break;
+  case 0x2C:
+  case 0x2E:
+    sim.column = sim.startColumn;
+    sim.page = sim.startPage;
+    sim.readDummyPending = 1;
+    sim.readFifoCount = 0;
+    break;
+  case 0x3E:
+    sim.readDummyPending = 1;
+    sim.readFifoCount = 0;
+    break;
+  default:
+    break;
+  }
+}
+
+void ILI9341SimWriteData(uint16_t value) {
+  sim.counters.dataWrites++;
+  countAccess(0);
+  value = latchWrite(value);
+  if (sim.command == 0x2C || sim.command == 0x3C) {
+    writePixel(value);
+    return;
+  }
+  if (sim.paramCount < sizeof(sim.params)) {
+    sim.params[sim.paramCount++] = (uint8_t)value;
+    applyParameter();
+  }
+}
+
+uint16_t ILI9341SimReadData(void) {
+  uint32_t index;
+  uint16_t pixel;
+  sim.counters.dataReads++;
+  countAccess(1);
+  if (sim.command != 0x2E && sim.command != 0x3E)
+    return sampleRead(0);
+  if (sim.readDummyPending) {
+    sim.readDummyPending = 0;
+    return sampleRead(0);
+  }
+  while (sim.readFifoCount < 2) {
+    pixel = mapToPanel(sim.column, sim.page, &index) ? sim.gram[index] : 0;
+    sim.readFifo[sim.readFifoCount++] = (uint8_t)((pixel >> 11) << 3);
+    sim.readFifo[sim.readFifoCount++] = (uint8_t)(((pixel >> 5) & 0x3F) << 2);
+    sim.readFifo[sim.readFifoCount++] = (uint8_t)((pixel & 0x1F) << 3);
+    advanceCursor();
+  }
+  pixel = (uint16_t)(sim.readFifo[0] << 8 | sim.readFifo[1]);
+  sim.readFifoCount -= 2;
+  memmove(sim.readFifo, sim.readFifo + 2, sim.readFifoCount);
+  return sampleRead(pixel);
+}
+
+ILI9341SimCounters_s ILI9341SimGetCounters(void) { return sim.counters; }
+
+const uint16_t *ILI9341SimGetFrame(void) { return sim.gram; }
+/**
+ * @brief Expand one GRAM pixel to what the panel shows
+ */
+static void pixelToRGB888(uint16_t pixel, uint8_t *rgb) {
+  if (sim.inverted)
+    pixel = (uint16_t)~pixel;
+  rgb[0] = (uint8_t)(((pixel >> 11) & 0x1F) * 255 / 31);
+  rgb[1] = (uint8_t)(((pixel >> 5) & 0x3F) * 255 / 63);
+  rgb[2] = (uint8_t)((pixel & 0x1F) * 255 / 31);
+}
+
+/**
+ * @brief GRAM row shown on a panel row, vertical scrolling shows the scroll
+ * area starting at the VSCRSADD row and wraps inside it
+ */
+static uint32_t visibleRow(uint32_t row) {
+  uint32_t scrollEnd = (uint32_t)sim.fixedTop + sim.scrollHeight;
+  if (!sim.scrolling || row < sim.fixedTop || row >= scrollEnd
+      || sim.scrollStart < sim.fixedTop || sim.scrollStart >= scrollEnd)
+    return row;
+  return sim.fixedTop + (row - sim.fixedTop + sim.scrollStart - sim.fixedTop) % sim.scrollHeight;
+}
+/**
+ * @brief GRAM pixel shown at a panel index
+ */
+static uint16_t visiblePixel(uint32_t index) {
+  uint32_t row = index / ILI9341_SIM_PANEL_WIDTH;
+  return sim.gram[visibleRow(row) * ILI9341_SIM_PANEL_WIDTH + index % ILI9341_SIM_PANEL_WIDTH];
+}
+
+int ILI9341SimWritePPM(const char *path) {
+  uint8_t rgb[3];
+  FILE *file = fopen(path, "wb");
+  if (file == NULL)
+    return -1;
+  fprintf(file, "P6\n%d %d\n255\n", ILI9341_SIM_PANEL_WIDTH, ILI9341_SIM_PANEL_HEIGHT);
+  for (uint32_t i = 0; i < SIM_PIXELS; i++) {
+    pixelToRGB888(visiblePixel(i), rgb);
+    fwrite(rgb, 1, 3, file);
+  }
+  return fclose(file) == 0 ? 0 : -1;
+}
+
+int ILI9341SimComparePPM(const char *path, uint32_t *mismatches) {
+  uint8_t rgb[3], golden[3];
+  int width, height, maxValue;
+  FILE *file = fopen(path, "rb");
+  if (file == NULL)
+    return -1;
+  if (fscanf(file, "P6 %d %d %d", &width, &height, &maxValue) != 3
+      || width != ILI9341_SIM_PANEL_WIDTH || height != ILI9341_SIM_PANEL_HEIGHT
+      || maxValue != 255 || fgetc(file) == EOF) {
+    fclose(file);
+    return -1;
+  }
+  *mismatches = 0;
+  for (uint32_t i = 0; i < SIM_PIXELS; i++) {
+    if (fread(golden, 1, 3, file) != 3) {
+      *mismatches += SIM_PIXELS - i;
+      break;
+    }
+    pixelToRGB888(visiblePixel(i), rgb);
+    if (memcmp(rgb, golden, 3) != 0)
+      (*mismatches)++;
+  }
+  fclose(file);
+  return 0;
+}
@@ -0,0 +1,16 @@
+/********************************************************************************************************
+ * @Filename: SubsetStrings.c
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: Strings of the font subset scene, the Makefile subsets the fonts to their characters
+ *********************************************************************************************************/
+#include <stddef.h>
+#include "SubsetStrings.h"
+
+const char *const SubsetStrings[] = {
+  "Subset fonts",
+  "Volts: 12.5 V",
+  "AVATAR Wave",
+  NULL,
+};
@@ -0,0 +1,167 @@
+/********************************************************************************************************
+ * @Filename: TracePlayer.c
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: Replays bus traces recorded by ILI9341Trace.c into the simulated controller
+ *********************************************************************************************************/
+#include <string.h>
+#include "ILI9341Sim.h"
+#include "ILI9341Trace.h"
+#include "TracePlayer.h"
+
+static struct {
+  TraceStats_s *stats;
+  uint8_t path;
+  uint8_t command;
+  /* Window elision state of the optimized path */
+  uint8_t held;
+  uint8_t heldCommand;
+  uint8_t heldParams[4];
+  uint8_t heldCount;
+  uint8_t windowKnown[2];
+  uint8_t window[2][4];
+} player;
+
+static void simCommand(uint8_t command) {
+  uint64_t cycles = ILI9341SimGetCounters().busCycles;
+  player.command = command;
+  player.stats->commands[command]++;
+  ILI9341SimWriteRegister(command);
+  player.stats->busCycles[command] += ILI9341SimGetCounters().busCycles - cycles;
+}
+
+static void simData(uint16_t value) {
+  uint64_t cycles = ILI9341SimGetCounters().busCycles;
+  player.stats->dataWrites[player.command]++;
+  ILI9341SimWriteData(value);
+  player.stats->busCycles[player.command] += ILI9341SimGetCounters().busCycles - cycles;
+}
+
+static void simRead(void) {
+  uint64_t cycles = ILI9341SimGetCounters().busCycles;
+  player.stats->dataReads[player.command]++;
+  ILI9341SimReadData();
+  player.stats->busCycles[player.command] += ILI9341SimGetCounters().busCycles - cycles;
+}
+/**
+ * @brief Send a held address set as it was recorded
+ */
+static void releaseHeld(void) {
+  if (!player.held)
+    return;
+  player.held = 0;
+  simCommand(player.heldCommand);
+  for (uint8_t i = 0; i < player.heldCount; i++)
+    simData(player.heldParams[i]);
+}
+
+static void playCommand(uint8_t command) {
+  releaseHeld();
+  if (player.path == TRACE_PLAYER_OPTIMIZED && (command == 0x2A || command == 0x2B)) {
+    player.held = 1;
+    player.heldCommand = command;
+    player.heldCount = 0;
+    return;
+  }
+  if (command == 0x01)
+    player.windowKnown[0] = player.windowKnown[1] = 0;
+  simCommand(command);
+}
+
+static void playData(uint16_t value) {
+  uint8_t axis;
+  if (!player.held) {
+    simData(value);
+    return;
+  }
+  player.heldParams[player.heldCount++] = (uint8_t)value;
+  if (player.heldCount < 4)
+    return;
+  axis = player.heldCommand == 0x2B;
+  player.held = 0;
+  if (player.windowKnown[axis]
+      && memcmp(player.window[axis], player.heldParams, 4) == 0)
+    return;
+  memcpy(player.window[axis], player.heldParams, 4);
+  player.windowKnown[axis] = 1;
+  player.held = 1;
+  releaseHeld();
+}
+/**
+ * @brief Decode an unsigned LEB128 varint
+ * @return bytes consumed, 0 when truncated
+ */
+static uint32_t getVarint(const uint8_t *bytes, uint32_t length, uint32_t *value) {
+  uint32_t consumed = 0, shift = 0;
+  *value = 0;
+  while (consumed < length && shift < 32) {
+    uint8_t byte = bytes[consumed++];
+    *value |= (uint32_t)(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0)
+      return consumed;
+    shift += 7;
+  }
+  return 0;
+}
+
+int TracePlayerRun(const uint8_t *trace, uint32_t length, uint8_t path,
+                   TraceStats_s *stats) {
+  uint32_t position = 4, count, used;
+  memset(stats, 0, sizeof(*stats));
+  memset(&player, 0, sizeof(player));
+  player.stats = stats;
+  player.path = path;
+  if (length < 4 || trace[0] != 'I' || trace[1] != 'L' || trace[2] != 'T'
+      || trace[3] != ILI9341_TRACE_VERSION)
+    return -1;
+  while (position < length) {
+    uint8_t tag = trace[position++];
+    switch (tag) {
+    case ILI9341_TRACE_TAG_COMMAND:
+      if (position + 1 > length)
+        return -1;
+      playCommand(trace[position++]);
+      break;
+    case ILI9341_TRACE_TAG_DATA:
+      if (position + 2 > length)
+        return -1;
+      playData((uint16_t)(trace[position] | trace[position + 1] << 8));
+      position += 2;
+      break;
+    case ILI9341_TRACE_TAG_DATA_RUN:
+      used = getVarint(trace + position, length - position, &count);
+      if (used == 0 || position + used + 2 > length)
+        return -1;
+      position += used;
+      while (count--)
+        playData((uint16_t)(trace[position] | trace[position + 1] << 8));
+      position += 2;
+      break;
+    case ILI9341_TRACE_TAG_READ:
+      used = getVarint(trace + position, length - position, &count);
+      if (used == 0)
+        return -1;
+      position += used;
+      releaseHeld();
+      while (count--)
+        simRead();
+      break;
+    case ILI9341_TRACE_TAG_MARK:
+    case ILI9341_TRACE_TAG_DROPPED:
+      used = getVarint(trace + position, length - position, &count);
+      if (used == 0)
+        return -1;
+      position += used;
+      if (tag == ILI9341_TRACE_TAG_MARK)
+        stats->marks++;
+      else
+        stats->dropped += count;
+      break;
+    default:
+      return -1;
+    }
+  }
+  releaseHeld();
+  return 0;
+}
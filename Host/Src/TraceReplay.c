@@ -0,0 +1,131 @@
+/********************************************************************************************************
+ * @Filename: TraceReplay.c
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: Host tool replaying a recorded bus trace, renders the final frame and breaks the bus
+ *               cost down by command, optionally against the candidate optimized path
+ *********************************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ILI9341Sim.h"
+#include "TracePlayer.h"
+
+static uint16_t directFrame[ILI9341_SIM_PANEL_WIDTH * ILI9341_SIM_PANEL_HEIGHT];
+static TraceStats_s directStats, optimizedStats;
+
+static void usage(const char *program) {
+  fprintf(stderr,
+          "Usage: %s [-O] [-o frame.ppm] trace\n"
+          "  -O  also replay through the optimized path and compare bus cycles\n"
+          "  -o  write the final frame of the direct replay\n",
+          program);
+}
+
+static uint8_t *loadFile(const char *path, uint32_t *length) {
+  uint8_t *bytes;
+  long size;
+  FILE *file = fopen(path, "rb");
+  if (file == NULL)
+    return NULL;
+  fseek(file, 0, SEEK_END);
+  size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  bytes = malloc(size > 0 ? (size_t)size : 1);
+  if (bytes != NULL && fread(bytes, 1, (size_t)size, file) != (size_t)size) {
+    free(bytes);
+    bytes = NULL;
+  }
+  fclose(file);
+  *length = (uint32_t)size;
+  return bytes;
+}
+
+static uint64_t totalCycles(const TraceStats_s *stats) {
+  uint64_t cycles = 0;
+  for (uint32_t i = 0; i < 256; i++)
+    cycles += stats->busCycles[i];
+  return cycles;
+}
+
+static void printBreakdown(const char *title, const TraceStats_s *stats,
+                           const TraceStats_s *baseline) {
+  uint64_t total = totalCycles(stats);
+  printf("%s: %llu bus cycles, %u marks, %u dropped records\n", title,
+         (unsigned long long)total, stats->marks, stats->dropped);
+  printf("  cmd    count     writes      reads         cycles  share%s\n",
+         baseline ? "   saved" : "");
+  for (uint32_t i = 0; i < 256; i++) {
+    if (stats->commands[i] == 0 && stats->dataWrites[i] == 0
+        && (baseline == NULL || baseline->commands[i] == 0))
+      continue;
+    printf("  0x%02X %8u %10u %10u %14llu %5.1f%%", i, stats->commands[i],
+           stats->dataWrites[i], stats->dataReads[i],
+           (unsigned long long)stats->busCycles[i],
+           total ? 100.0 * stats->busCycles[i] / total : 0.0);
+    if (baseline != NULL)
+      printf(" %7lld", (long long)(baseline->busCycles[i] - stats->busCycles[i]));
+    printf("\n");
+  }
+}
+
+int main(int argc, char **argv) {
+  const char *framePath = NULL, *tracePath = NULL;
+  int optimize = 0, result;
+  uint32_t length;
+  uint8_t *trace;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-O") == 0)
+      optimize = 1;
+    else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+      framePath = argv[++i];
+    else if (argv[i][0] != '-' && tracePath == NULL)
+      tracePath = argv[i];
+    else {
+      usage(argv[0]);
+      return 2;
+    }
+  }
+  if (tracePath == NULL) {
+    usage(argv[0]);
+    return 2;
+  }
+  trace = loadFile(tracePath, &length);
+  if (trace == NULL) {
+    fprintf(stderr, "cannot read %s\n", tracePath);
+    return 2;
+  }
+
+  ILI9341SimReset();
+  if (TracePlayerRun(trace, length, TRACE_PLAYER_DIRECT, &directStats) != 0) {
+    fprintf(stderr, "%s: malformed trace\n", tracePath);
+    free(trace);
+    return 1;
+  }
+  printBreakdown("direct", &directStats, NULL);
+  if (framePath != NULL && ILI9341SimWritePPM(framePath) != 0)
+    fprintf(stderr, "cannot write %s\n", framePath);
+  if (!optimize) {
+    free(trace);
+    return 0;
+  }
+
+  memcpy(directFrame, ILI9341SimGetFrame(), sizeof(directFrame));
+  ILI9341SimReset();
+  result = TracePlayerRun(trace, length, TRACE_PLAYER_OPTIMIZED, &optimizedStats);
+  free(trace);
+  if (result != 0) {
+    fprintf(stderr, "%s: malformed trace\n", tracePath);
+    return 1;
+  }
+  printBreakdown("optimized", &optimizedStats, &directStats);
+  if (memcmp(directFrame, ILI9341SimGetFrame(), sizeof(directFrame)) != 0) {
+    printf("optimized path changed the frame\n");
+    return 1;
+  }
+  printf("frame identical, %.2f%% of the direct bus cycles\n",
+         100.0 * totalCycles(&optimizedStats) / totalCycles(&directStats));
+  return 0;
+}
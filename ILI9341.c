@@ -6,16 +6,9 @@
  * @Description: Implementation of ILI9341 Driver
  *********************************************************************************************************/
 #include "ILI9341.h"
-/**
- * @brief MADCTL Values
- */
-#define ILI9341_MADCTL_MY   0x80
-#define ILI9341_MADCTL_MX   0x40
-#define ILI9341_MADCTL_MV   0x20
-#define ILI9341_MADCTL_ML   0x10
-#define ILI9341_MADCTL_BGR  0x08
-#define ILI9341_MADCTL_MH   0x04
-#define ILI9341_MADCTL_RGB  0x00
+#include "ILI9341Private.h"
+#include "ILI9341Trace.h"
+#include <string.h>
 /**
  * @brief Address Handling
  */
@@ -29,26 +22,6 @@
     #define ILI9341_COMMAND_ADDRESS 0x60000000
 #endif
 #define ILI9341_DATA_ADDRESS (*(volatile uint16_t *)(ILI9341_COMMAND_ADDRESS | (1 << (ILI9341_FSMC_RS_ADDRESS_LINE_NUMBER + 1))))
-/**
- * @brief Rotation handling
- */
-#if ILI9341_SCREEN_ORIENTATION == 0
-  #define ILI9341_WIDTH   240
-  #define ILI9341_HEIGHT  320
-  #define ILI9341_ROTATION (ILI9341_MADCTL_MX | ILI9341_MADCTL_BGR)
-#elif ILI9341_SCREEN_ORIENTATIONS == 1
-  #define ILI9341_WIDTH   320
-  #define ILI9341_HEIGHT  240
-  #define ILI9341_ROTATION (ILI9341_MADCTL_MY | ILI9341_MADCTL_BGR | ILI9341_MADCTL_MX | ILI9341_MADCTL_MV)
-#elif ILI9341_SCREEN_ORIENTATION == 2
-  #define ILI9341_WIDTH   240
-  #define ILI9341_HEIGHT  320
-  #define ILI9341_ROTATION (ILI9341_MADCTL_MY | ILI9341_MADCTL_BGR)
-#elif ILI9341_SCREEN_ORIENTATION == 3
-  #define ILI9341_WIDTH   320
-  #define ILI9341_HEIGHT  240
-  #define ILI9341_ROTATION (ILI9341_MADCTL_MV|  ILI9341_MADCTL_BGR)
-#endif
 /**
  * @brief Absolute value function
  * @param x Input
@@ -56,26 +29,179 @@
  */
 #define ABS(x) (x > 0 ? x : -x)
 /**Some Black Magic Here**/
+#if ILI9341_BUS_SIMULATION == 1
+#include "ILI9341Sim.h"
+/**
+ * @brief Bus accessors, routed into the simulated controller on the host
+ */
+#define ILI9341_BUS_WRITE_REGISTER(value) ILI9341SimWriteRegister(value)
+#define ILI9341_BUS_WRITE_DATA(value) ILI9341SimWriteData(value)
+#define ILI9341_BUS_READ_DATA() ILI9341SimReadData()
+#define ILI9341_BUS_WRITE_DATA_PAIR(pair)                                      \
+  (ILI9341SimWriteData((uint16_t)(pair)), ILI9341SimWriteData((uint16_t)((pair) >> 16)))
+#else
 typedef struct {
   volatile uint16_t Register;
   volatile uint16_t Data;
 } ILI9341_t; 
 
 ILI9341_t* LCDPtr = (ILI9341_t*)(ILI9341_COMMAND_ADDRESS | ((1 << (ILI9341_FSMC_RS_ADDRESS_LINE_NUMBER + 1)) - 2));
+/**
+ * @brief Bus accessors, each one is a single FSMC cycle
+ */
+#define ILI9341_BUS_WRITE_REGISTER(value) (LCDPtr->Register = (value))
+#define ILI9341_BUS_WRITE_DATA(value) (LCDPtr->Data = (value))
+#define ILI9341_BUS_READ_DATA() (LCDPtr->Data)
+#if ILI9341_FSMC_RS_ADDRESS_LINE_NUMBER == 0
+/**
+ * @brief Two 16-bit stores, with RS on A0 the data address is only 2-byte
+ * aligned and the second half of a 32-bit store would clear RS
+ */
+#define ILI9341_BUS_WRITE_DATA_PAIR(pair)                                      \
+  (LCDPtr->Data = (uint16_t)(pair), LCDPtr->Data = (uint16_t)((pair) >> 16))
+#else
+/**
+ * @brief 32-bit store to the data address, the FSMC splits it into two
+ * back-to-back 16-bit cycles, low half first. Needs RS on A1 or above: the
+ * data address is then 4-byte aligned and the second half lands on
+ * HADDR[1], which is FSMC A0 and leaves the RS line untouched
+ */
+#define ILI9341_BUS_WRITE_DATA_PAIR(pair) (*(volatile uint32_t *)&LCDPtr->Data = (pair))
+#endif
+#endif
 /**
  * @brief Private Function for Writing ILI9341's Register
  * @param regValue Value to be written
  * @return None
  **/
-// void writeRegister(uint16_t regValue) { ILI9341_COMMAND_ADDRESS = regValue; }
-void writeRegister(uint16_t regValue) { LCDPtr->Register = regValue; }
+void writeRegister(uint16_t regValue) {
+  ILI9341_TRACE_COMMAND(regValue);
+  ILI9341_BUS_WRITE_REGISTER(regValue);
+}
 /**
  * @brief Private function for writing ILI9341's Graphics RAM
  * @param Data Data to be written(Only 1 uint16_t value)
  * @return None
  **/
-// void writeGraphicsRAM(uint16_t Data) { ILI9341_DATA_ADDRESS = Data; }
-void writeGraphicsRAM(uint16_t Data) { LCDPtr->Data = Data; }
+void writeGraphicsRAM(uint16_t Data) {
+  ILI9341_TRACE_DATA(Data);
+  ILI9341_BUS_WRITE_DATA(Data);
+}
+/**
+ * @brief Write two pixels with one 32-bit store
+ * @param pair first pixel in the low half, second pixel in the high half
+ * @return None
+ */
+static inline void writeGraphicsRAMPair(uint32_t pair) {
+  ILI9341_TRACE_DATA((uint16_t)pair);
+  ILI9341_TRACE_DATA((uint16_t)(pair >> 16));
+  ILI9341_BUS_WRITE_DATA_PAIR(pair);
+}
+/**
+ * @brief Load two neighbouring pixels as one little endian word
+ */
+static inline uint32_t loadPixelPair(const uint16_t *pixels) {
+  uint32_t pair;
+  memcpy(&pair, pixels, sizeof(pair));
+  return pair;
+}
+/**
+ * @brief Private pixel pump, streams pixels into Graphics RAM two per 32-bit
+ * store with the inner loop unrolled to eight pixels
+ * @param pixels Start pointer of the pixels, any 16-bit alignment
+ * @param pixelNum Number of pixels
+ * @return None
+ */
+void writePixelsIntoGraphicsRAM(const uint16_t *pixels, uint32_t pixelNum) {
+  if (pixelNum && ((uintptr_t)pixels & 2)) {
+    writeGraphicsRAM(*pixels++);
+    pixelNum--;
+  }
+  for (; pixelNum >= 8; pixelNum -= 8, pixels += 8) {
+    writeGraphicsRAMPair(loadPixelPair(pixels));
+    writeGraphicsRAMPair(loadPixelPair(pixels + 2));
+    writeGraphicsRAMPair(loadPixelPair(pixels + 4));
+    writeGraphicsRAMPair(loadPixelPair(pixels + 6));
+  }
+  for (; pixelNum >= 2; pixelNum -= 2, pixels += 2)
+    writeGraphicsRAMPair(loadPixelPair(pixels));
+  if (pixelNum)
+    writeGraphicsRAM(*pixels);
+}
+/**
+ * @brief Bulk writer set by ILI9341SetBulkWrite
+ */
+static ILI9341BulkWrite_t bulkWriter;
+
+void ILI9341SetBulkWrite(ILI9341BulkWrite_t bulkWrite) {
+  bulkWriter = bulkWrite;
+}
+/**
+ * @brief Private function for writing a long pixel run through the bulk
+ * writer, falls back to the pixel pump without one or while a bus trace
+ * records, the trace only sees CPU stores
+ * @param pixels Start pointer of the pixels
+ * @param pixelNum Number of pixels
+ * @return None
+ */
+void bulkWritePixelsIntoGraphicsRAM(const uint16_t *pixels, uint32_t pixelNum) {
+#if ILI9341_BUS_SIMULATION == 0
+  if (bulkWriter != 0 && !ILI9341_TRACE_ACTIVE()) {
+    bulkWriter(pixels, pixelNum, &LCDPtr->Data);
+    return;
+  }
+#endif
+  writePixelsIntoGraphicsRAM(pixels, pixelNum);
+}
+/**
+ * @brief Private function for filling Graphics RAM with one color, two pixels
+ * per 32-bit store with the inner loop unrolled to sixteen pixels
+ * @param color Color to fill with
+ * @param pixelNum Number of pixels
+ * @return None
+ */
+void fillGraphicsRAM(uint16_t color, uint32_t pixelNum) {
+  uint32_t pair = color | (uint32_t)color << 16;
+  for (; pixelNum >= 16; pixelNum -= 16) {
+    writeGraphicsRAMPair(pair);
+    writeGraphicsRAMPair(pair);
+    writeGraphicsRAMPair(pair);
+    writeGraphicsRAMPair(pair);
+    writeGraphicsRAMPair(pair);
+    writeGraphicsRAMPair(pair);
+    writeGraphicsRAMPair(pair);
+    writeGraphicsRAMPair(pair);
+  }
+  for (; pixelNum >= 2; pixelNum -= 2)
+    writeGraphicsRAMPair(pair);
+  if (pixelNum)
+    writeGraphicsRAM(color);
+}
+/**
+ * @brief Bulk filler set by ILI9341SetBulkFill
+ */
+static ILI9341BulkFill_t bulkFiller;
+
+void ILI9341SetBulkFill(ILI9341BulkFill_t bulkFill) {
+  bulkFiller = bulkFill;
+}
+/**
+ * @brief Private function for filling a long run through the bulk filler,
+ * falls back to the CPU fill for short runs, without one or while a bus
+ * trace records
+ * @param color Color to fill with
+ * @param pixelNum Number of pixels
+ * @return None
+ */
+void bulkFillGraphicsRAM(uint16_t color, uint32_t pixelNum) {
+#if ILI9341_BUS_SIMULATION == 0
+  if (bulkFiller != 0 && pixelNum >= ILI9341_BULK_MIN_PIXELS && !ILI9341_TRACE_ACTIVE()) {
+    bulkFiller(color, pixelNum, &LCDPtr->Data);
+    return;
+  }
+#endif
+  fillGraphicsRAM(color, pixelNum);
+}
 /**
  * @brief Private function for writing array into ILI9341's Graphics RAM
  * @param arrayPtr Start poniter of the array
@@ -84,7 +210,7 @@ void writeGraphicsRAM(uint16_t Data) { LCDPtr->Data = Data; }
  */
 void writeArrayIntoGraphicsRAM(uint16_t *arrayPtr, uint32_t arraySize) {
   while (arraySize--)
-    ILI9341_DATA_ADDRESS = *arrayPtr++;
+    writeGraphicsRAM(*arrayPtr++);
 }
 /**
  * @brief Private function for reading Graphics RAM
@@ -93,8 +219,42 @@ void writeArrayIntoGraphicsRAM(uint16_t *arrayPtr, uint32_t arraySize) {
  * @return None
  */
 void readArrayFromGraphicsRAM(uint16_t *arrayPtr, uint32_t arraySize) {
-  while (arraySize--)
-    *arrayPtr++ = ILI9341_DATA_ADDRESS;
+  while (arraySize--) {
+    ILI9341_TRACE_READ();
+    *arrayPtr++ = ILI9341_BUS_READ_DATA();
+  }
+}
+/**
+ * @brief Private function for reading pixels back from Graphics RAM
+ * @details Call it right after setAddressWindow, it issues Memory Read and
+ * converts the 18-bit read format (R1G1, B1R2, G2B2) back into RGB565
+ * @param pixels Read buffer's starting address
+ * @param pixelNum Number of pixels to read
+ * @return None
+ */
+void readPixelsFromGraphicsRAM(uint16_t *pixels, uint32_t pixelNum) {
+  uint16_t word0, word1, word2;
+  writeRegister(0x2E);
+  ILI9341_TRACE_READ();
+  (void)ILI9341_BUS_READ_DATA();
+  while (pixelNum >= 2) {
+    ILI9341_TRACE_READ();
+    word0 = ILI9341_BUS_READ_DATA();
+    ILI9341_TRACE_READ();
+    word1 = ILI9341_BUS_READ_DATA();
+    ILI9341_TRACE_READ();
+    word2 = ILI9341_BUS_READ_DATA();
+    *pixels++ = (word0 & 0xF800) | ((word0 & 0x00FC) << 3) | (word1 >> 11);
+    *pixels++ = ((word1 & 0x00F8) << 8) | ((word2 & 0xFC00) >> 5) | ((word2 & 0x00F8) >> 3);
+    pixelNum -= 2;
+  }
+  if (pixelNum) {
+    ILI9341_TRACE_READ();
+    word0 = ILI9341_BUS_READ_DATA();
+    ILI9341_TRACE_READ();
+    word1 = ILI9341_BUS_READ_DATA();
+    *pixels = (word0 & 0xF800) | ((word0 & 0x00FC) << 3) | (word1 >> 11);
+  }
 }
 /**
  * @brief Private function for setting the address window of ILI9341
@@ -133,132 +293,83 @@ void ILI9341BacklightControl(uint8_t backlightOn) {
   }
 }
 
-void ILI9341Initialize(void) {
+/**
+ * @brief Default initialization table, see ILI9341InitStart for the format
+ */
+const uint8_t ILI9341InitTableDefault[] = {
+  0x01, ILI9341_INIT_DELAY | 0, 50,                   // Software reset, 500ms
+  0xCB, 5, 0x39, 0x2C, 0x00, 0x34, 0x02,              // Power control A configuration
+  0xCF, 3, 0x00, 0xC1, 0x30,                          // Power control B configuration
+  0xE8, 3, 0x85, 0x00, 0x78,                          // Driver Timing A configuration
+  0xEA, 2, 0x00, 0x00,                                // Driver Timing B configuration
+  0xED, 4, 0x04, 0x03, 0x12, 0x81,                    // Power on sequence configuration
+  0xF7, 1, 0x20,                                      // Charge pump ratio configuration
+  0xC0, 1, 0x23,                                      // Power configuration, VRH[5:0]
+  0xC1, 1, 0x10,                                      // Power configuration, SAP[2:0] BT[3:0]
+  0xC5, 2, 0x3E, 0x28,                                // Power configuration, VCM
+  0xC7, 1, 0x86,                                      // Power configuration, VCM2
+  0x36, 1, 0x48,                                      // Memory address configuration
+  0x3A, 1, 0x55,                                      // Pixel format configuration
+  0xB1, 1, 0x00,                                      // Frame ratio configuration, DIVA only, RTNA stays 0x1B
+  0xB6, 3, 0x08, 0x82, 0x27,                          // Display function configuration
+  0xF2, 1, 0x00,                                      // Gamma function disable
+  0x26, 1, 0x01,                                      // Gamma curve selection
+  0xE0, 15, 0x0F, 0x31, 0x2B, 0x0C, 0x0E, 0x08, 0x4E, // Positive gamma correction
+        0xF1, 0x37, 0x07, 0x10, 0x03, 0x0E, 0x09, 0x00,
+  0xE1, 15, 0x00, 0x0E, 0x14, 0x03, 0x11, 0x07, 0x31, // Negative gamma correction
+        0xC1, 0x48, 0x08, 0x0F, 0x0C, 0x31, 0x36, 0x0F,
+  0x11, ILI9341_INIT_DELAY | 0, 12,                   // Exit sleep mode, 120ms
+  0x29, 0,                                            // Display on
+  0x36, 1, ILI9341_ROTATION,                          // MADCTL
+  0x00, ILI9341_INIT_END
+};
+/**
+ * @brief Progress of the initialization state machine
+ */
+static struct {
+  const uint8_t *entry;
+  uint32_t waitStart;
+  uint32_t waitTime;
+  uint8_t running;
+} initState;
+
+void ILI9341InitStart(const uint8_t *initTable) {
+  initState.entry = initTable != 0 ? initTable : ILI9341InitTableDefault;
+  initState.waitTime = 0;
+  initState.running = 1;
   ILI9341BacklightControl(0);
-  writeRegister(0x01);
-  HAL_Delay(500);
-  // Power control A configuration
-  writeRegister(0xCB);
-  {
-    uint16_t regValue[] = {0x39, 0x2C, 0x00, 0x34, 0x02};
-    writeArrayIntoGraphicsRAM(regValue, 5);
-  }
-  // Power control B configuration
-  writeRegister(0xCF);
-  {
-    uint16_t regValue[] = {0x00, 0xC1, 0x30};
-    writeArrayIntoGraphicsRAM(regValue, 3);
-  }
-  // Driver Timing A configuration
-  writeRegister(0xE8);
-  {
-    uint16_t regValue[] = {0x85, 0x00, 0x78};
-    writeArrayIntoGraphicsRAM(regValue, 3);
-  }
-  // Driver Timing B configuration
-  writeRegister(0xEA);
-  {
-    uint16_t regValue[] = {0x00, 0x00};
-    writeArrayIntoGraphicsRAM(regValue, 2);
-  }
-  // Power on sequence configuration
-  writeRegister(0xED);
-  {
-    uint16_t regValue[] = {0x04, 0x03, 0x12, 0x81};
-    writeArrayIntoGraphicsRAM(regValue, 4);
-  }
-  // Charge pump ratio configuration
-  writeRegister(0xF7);
-  {
-    uint16_t regValue[] = {0x20};
-    writeArrayIntoGraphicsRAM(regValue, 1);
-  }
-  // Power configuration, VRH[5:0]
-  writeRegister(0xC0);
-  {
-    uint16_t regValue[] = {0x23};
-    writeArrayIntoGraphicsRAM(regValue, 1);
-  }
-  // Power configuration, SAP[2:0] BT[3:0]
-  writeRegister(0xC1);
-  {
-    uint16_t regValue[] = {0x10};
-    writeArrayIntoGraphicsRAM(regValue, 1);
-  }
-  // Power configuration, VCM
-  writeRegister(0xC5);
-  {
-    uint16_t regValue[] = {0x3E, 0x28};
-    writeArrayIntoGraphicsRAM(regValue, 2);
-  }
-  // Power configuration, VCM2
-  writeRegister(0xC7);
-  {
-    uint16_t regValue[] = {0x86};
-    writeArrayIntoGraphicsRAM(regValue, 1);
-  }
-  // Memory address configuration
-  writeRegister(0x36);
-  {
-    uint16_t regValue[] = {0x48};
-    writeArrayIntoGraphicsRAM(regValue, 1);
-  }
-  // Pixel format configuration
-  writeRegister(0x3A);
-  {
-    uint16_t regValue[] = {0x55};
-    writeArrayIntoGraphicsRAM(regValue, 1);
-  }
-  // Frame ratio configuration
-  writeRegister(0xB1);
-  {
-    uint16_t regValue[] = {0x00, 0x18};
-    writeArrayIntoGraphicsRAM(regValue, 1);
-  }
-  // Display function configuration
-  writeRegister(0xB6);
-  {
-    uint16_t regValue[] = {0x08, 0x82, 0x27};
-    writeArrayIntoGraphicsRAM(regValue, 3);
-  }
-  // Gamma function disable
-  writeRegister(0xF2);
-  {
-    uint16_t regValue[] = {0x00};
-    writeArrayIntoGraphicsRAM(regValue, 1);
-  }
-  // Gamma curve selection
-  writeRegister(0x26);
-  {
-    uint16_t regValue[] = {0x01};
-    writeArrayIntoGraphicsRAM(regValue, 1);
-  }
-  // Positive gamma correction
-  writeRegister(0xE0);
-  {
-    uint16_t regValue[] = {0x0F, 0x31, 0x2B, 0x0C, 0x0E, 0x08, 0x4E, 0xF1,
-                            0x37, 0x07, 0x10, 0x03, 0x0E, 0x09, 0x00};
-    writeArrayIntoGraphicsRAM(regValue, 15);
-  }
-  // Negative gamma correction
-  writeRegister(0xE1);
-  {
-    uint16_t regValue[] = {0x00, 0x0E, 0x14, 0x03, 0x11, 0x07, 0x31, 0xC1,
-                            0x48, 0x08, 0x0F, 0x0C, 0x31, 0x36, 0x0F};
-    writeArrayIntoGraphicsRAM(regValue, 15);
-  }
-  // Exit sleep mode
-  writeRegister(0x11);
-  HAL_Delay(120);
-  // Display on
-  writeRegister(0x29);
-  // MADCTL
-  writeRegister(0x36);
-  {
-    uint16_t regValue[] = {ILI9341_ROTATION};
-    writeArrayIntoGraphicsRAM(regValue, 1);
+}
+
+uint8_t ILI9341InitPoll(void) {
+  uint8_t length, paramNum;
+  if (!initState.running)
+    return 1;
+  if (initState.waitTime != 0) {
+    if (HAL_GetTick() - initState.waitStart < initState.waitTime)
+      return 0;
+    initState.waitTime = 0;
+  }
+  while ((length = initState.entry[1]) != ILI9341_INIT_END) {
+    paramNum = length & ~ILI9341_INIT_DELAY;
+    writeRegister(initState.entry[0]);
+    for (uint8_t i = 0; i < paramNum; i++)
+      writeGraphicsRAM(initState.entry[2 + i]);
+    initState.entry += 2 + paramNum;
+    if (length & ILI9341_INIT_DELAY) {
+      initState.waitTime = *initState.entry++ * 10UL;
+      initState.waitStart = HAL_GetTick();
+      return 0;
+    }
   }
+  initState.running = 0;
   ILI9341BacklightControl(1);
+  return 1;
+}
+
+void ILI9341Initialize(void) {
+  ILI9341InitStart(0);
+  while (!ILI9341InitPoll()) {
+  }
 }
 void ILI9341DrawPixel(uint16_t x, uint16_t y, uint16_t color) {
   if((x > ILI9341_WIDTH) || (y > ILI9341_HEIGHT))
@@ -266,49 +377,6 @@ void ILI9341DrawPixel(uint16_t x, uint16_t y, uint16_t color) {
   setAddressWindow(x, y, x + 1, y + 1);
   writeGraphicsRAM(color);
 }
-/**
- * @brief Draw char on screen
- * @param x left coordinate of character
- * @param y top coordinate of character
- * @param ch character to draw
- * @param font font of character
- * @param color color of character
- * @param bgcolor background color of character
- * @return * void 
- */
-void drawChar(uint16_t x, uint16_t y, char ch, FontDef_s font,
-              uint16_t color, uint16_t bgcolor){
-  uint32_t i, b, j;
-  setAddressWindow(x, y, font.width+x-1, font.height+y-1);
-  for(i=0; i<font.height; i++){
-    b = font.fontData[(ch-32)*font.height+i];
-    for(j=0; j<font.width; j++){
-      if ((b << j) & 0x8000)
-        ILI9341DrawPixel(x+j, y+i, color);
-      else
-        ILI9341DrawPixel(x+j, y+i, bgcolor);
-    }
-  }
-}
-
-void ILI9341DrawString(uint16_t x, uint16_t y, const char *string,
-                        FontDef_s font, uint16_t color, uint16_t bgColor){
-  while(*string) {
-    if(x + font.width >= ILI9341_WIDTH) {
-      x = 0;
-      y += font.height;
-      if(y + font.height >= ILI9341_HEIGHT)
-        break;
-      if(*string == ' ') {
-        string++;
-        continue;
-      }
-    }
-    drawChar(x, y, *string, font, color, bgColor);
-    x += font.width;
-    string++;
-  }
-}
 void ILI9341FillRectangle(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
                             uint16_t color){
   if(x >= ILI9341_WIDTH || y >= ILI9341_HEIGHT)
@@ -318,18 +386,45 @@ void ILI9341FillRectangle(uint16_t x, uint16_t y, uint16_t width, uint16_t heigh
   if(y+height+1 >= ILI9341_HEIGHT)
     height = ILI9341_HEIGHT - y;
   setAddressWindow(x, y, x+width-1, y+height-1);
-  for(y = height; y >0; y--) {
-    for(x = width; x >0; x--) {
-      writeGraphicsRAM(color);
-    }
-  }
+  bulkFillGraphicsRAM(color, (uint32_t)width * height);
 }
 void ILI9341FillScreen(uint16_t color){
   ILI9341FillRectangle(0, 0, ILI9341_WIDTH, ILI9341_HEIGHT, color);
 }
+/**
+ * @brief Draw a horizontal or vertical line as one window filled by the pixel
+ * pump, covering the same pixels as the Bresenham loop
+ * @return None
+ */
+static void drawStraightLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                             uint16_t color){
+  uint16_t swapBuffer;
+  if(x0 > x1) {
+    swapBuffer = x0;
+    x0 = x1;
+    x1 = swapBuffer;
+  }
+  if(y0 > y1) {
+    swapBuffer = y0;
+    y0 = y1;
+    y1 = swapBuffer;
+  }
+  if(x0 >= ILI9341_WIDTH || y0 >= ILI9341_HEIGHT)
+    return;
+  if(x1 >= ILI9341_WIDTH)
+    x1 = ILI9341_WIDTH - 1;
+  if(y1 >= ILI9341_HEIGHT)
+    y1 = ILI9341_HEIGHT - 1;
+  setAddressWindow(x0, y0, x1, y1);
+  fillGraphicsRAM(color, (uint32_t)(x1 - x0 + 1) * (y1 - y0 + 1));
+}
 void ILI9341DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
                         uint16_t color){
   uint16_t swapBuffer;
+  if(x0 == x1 || y0 == y1) {
+    drawStraightLine(x0, y0, x1, y1, color);
+    return;
+  }
   uint16_t steep = (y1 > y0 ? y1 - y0 : y0 - y1) > (x1 > x0 ? x1 - x0 : x0 - x1);
   if(steep) {
     swapBuffer = x0;
@@ -533,9 +628,57 @@ void ILI9341DrawImage(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
   if(y + height - 1 >= ILI9341_HEIGHT)
     return;
   setAddressWindow(x, y, x + width - 1, y + height - 1);
-  writeArrayIntoGraphicsRAM((uint16_t*)image, width * height);
+  writePixelsIntoGraphicsRAM(image, (uint32_t)width * height);
 }
 
 void ILI9341ColorInvert(uint8_t invert) {
   writeRegister(invert ? 0x21 : 0x20);
 }
+/**
+ * @brief Vertical scroll area in screen rows, kept for ILI9341SetScrollOffset
+ */
+static uint16_t scrollAreaTop;
+static uint16_t scrollAreaHeight;
+/**
+ * @brief Write a 16-bit parameter, high byte first
+ */
+static void writeParameter16(uint16_t value) {
+  writeGraphicsRAM(value >> 8);
+  writeGraphicsRAM(value & 0x00FF);
+}
+
+uint8_t ILI9341SetScrollArea(uint16_t top, uint16_t height) {
+  uint16_t fixedTop = top, fixedBottom;
+  /* The panel scrolls along its gate lines, which are screen columns once MV swaps the axes */
+  if ((ILI9341_ROTATION & ILI9341_MADCTL_MV) || height == 0 || top + height > ILI9341_HEIGHT)
+    return 0;
+  fixedBottom = ILI9341_HEIGHT - top - height;
+  if (ILI9341_ROTATION & ILI9341_MADCTL_MY) {
+    fixedTop = fixedBottom;
+    fixedBottom = top;
+  }
+  writeRegister(0x33);
+  writeParameter16(fixedTop);
+  writeParameter16(height);
+  writeParameter16(fixedBottom);
+  scrollAreaTop = top;
+  scrollAreaHeight = height;
+  ILI9341SetScrollOffset(0);
+  return 1;
+}
+
+void ILI9341SetScrollOffset(uint16_t offset) {
+  uint16_t start;
+  if (scrollAreaHeight == 0)
+    return;
+  offset %= scrollAreaHeight;
+  /* VSCRSADD names the GRAM line shown on the first gate line of the area,
+     with MY that gate line is the bottom screen row of the area */
+  if (ILI9341_ROTATION & ILI9341_MADCTL_MY)
+    start = ILI9341_HEIGHT - scrollAreaTop - scrollAreaHeight +
+            (scrollAreaHeight - offset) % scrollAreaHeight;
+  else
+    start = scrollAreaTop + offset;
+  writeRegister(0x37);
+  writeParameter16(start);
+}
@@ -38,6 +38,359 @@
  */
 #define RGB888ToRGB565(r, g, b)                                                \
   (((r & 0xF8) << 8) | ((g & 0xFC) << 3) | ((b & 0xF8) >> 3))
+/**
+ * @brief FSMC timing of the LCD bank in HCLK cycles, FSMC extended mode keeps
+ * separate read and write timings
+ */
+typedef struct {
+  uint8_t writeAddressSetup;
+  uint8_t writeDataSetup;
+  uint8_t readAddressSetup;
+  uint8_t readDataSetup;
+} ILI9341Timing_s;
+/**
+ * @brief Callback programming the FSMC with a timing, provided by the board
+ * code (see MX_FSMC_ApplyLCDTiming in Example/Core/Src/fsmc.c)
+ */
+typedef void (*ILI9341TimingApply_t)(const ILI9341Timing_s *timing);
+/**
+ * @brief Bulk pixel writer, e.g. a memory-to-memory DMA into the data
+ * register, provided by the board code (see MX_FSMC_LCDBulkWrite in
+ * Example/Core/Src/fsmc.c). It must return once the last pixel is on the bus
+ * @param pixels pixels to write, 16-bit aligned
+ * @param pixelNum number of pixels
+ * @param dataRegister address of the LCD data register
+ */
+typedef void (*ILI9341BulkWrite_t)(const uint16_t *pixels, uint32_t pixelNum,
+                                   volatile uint16_t *dataRegister);
+/**
+ * @brief Bulk filler writing one color pixelNum times, e.g. a DMA whose
+ * source does not increment, provided by the board code (see
+ * MX_FSMC_LCDBulkFill in Example/Core/Src/fsmc.c). It must return once the
+ * last pixel is on the bus
+ * @param color color to write
+ * @param pixelNum number of pixels
+ * @param dataRegister address of the LCD data register
+ */
+typedef void (*ILI9341BulkFill_t)(uint16_t color, uint32_t pixelNum,
+                                  volatile uint16_t *dataRegister);
+/**
+ * @brief Expanded glyph cache counters
+ */
+typedef struct {
+  uint32_t hits;
+  uint32_t misses;
+  uint32_t evictions;
+  uint32_t entries;
+  uint32_t bytesUsed;
+} ILI9341GlyphCacheStats_s;
+/**
+ * @brief Size of rendered text in pixels
+ */
+typedef struct {
+  uint16_t width;
+  uint16_t height;
+} ILI9341Extent_s;
+/**
+ * @brief Largest factor of ILI9341DrawStringScaled
+ */
+#define ILI9341_TEXT_SCALE_MAX 8
+/**
+ * @brief Text layout flags, one alignment optionally or-ed with the others
+ */
+#define ILI9341_TEXT_ALIGN_LEFT   0x00
+#define ILI9341_TEXT_ALIGN_CENTER 0x01
+#define ILI9341_TEXT_ALIGN_RIGHT  0x02
+#define ILI9341_TEXT_ALIGN_MASK   0x03
+#define ILI9341_TEXT_WRAP         0x04  /* break lines at spaces to fit the box width */
+#define ILI9341_TEXT_FILL         0x08  /* paint the box area around the text with the background */
+/**
+ * @brief One line of a text layout, bytes of the string without trailing spaces
+ */
+typedef struct {
+  uint16_t start;
+  uint16_t length;
+  uint16_t width;
+} ILI9341TextLine_s;
+/**
+ * @brief Measured and wrapped text, valid as long as the string, font and box
+ * stay the same
+ */
+typedef struct {
+  const char *string;
+  uint32_t hash;
+  FontDef_s font;
+  uint16_t width;
+  uint16_t height;
+  uint8_t flags;
+  uint8_t lineSpacing;
+  uint8_t lineNum;
+  ILI9341Extent_s extent;
+  ILI9341TextLine_s lines[ILI9341_TEXT_MAX_LINES];
+} ILI9341TextLayout_s;
+/**
+ * @brief Terminal cell attribute, indices into the terminal palette
+ */
+#define ILI9341_TERMINAL_ATTRIBUTE(fg, bg) ((uint8_t)(((bg) & 0x0F) << 4 | ((fg) & 0x0F)))
+/**
+ * @brief Character-cell terminal, the grid is a ring of rows so scrolling
+ * never moves cells
+ */
+typedef struct {
+  FontDef_s font;
+  uint16_t y;
+  uint8_t rows;
+  uint8_t columns;
+  uint8_t top;                /* ring row shown on the first screen row */
+  uint8_t cursorRow;          /* screen row */
+  uint8_t cursorColumn;       /* == columns while a wrap is pending */
+  uint8_t attribute;
+  uint8_t hardwareScroll;
+  uint8_t scrolled;           /* top changed since the last flush */
+  uint16_t palette[16];
+  uint16_t cells[ILI9341_TERMINAL_MAX_ROWS][ILI9341_TERMINAL_MAX_COLUMNS];
+  uint8_t attributes[ILI9341_TERMINAL_MAX_ROWS][ILI9341_TERMINAL_MAX_COLUMNS];
+  uint64_t dirty[ILI9341_TERMINAL_MAX_ROWS];
+} ILI9341Terminal_s;
+/**
+ * @brief Buffer size for ILI9341FormatInteger and ILI9341FormatFixed, sign,
+ * ten integer digits, point, nine decimals and terminator
+ */
+#define ILI9341_FORMAT_BUFFER_SIZE 22
+/**
+ * @brief Numeric field that remembers what it shows and redraws only the
+ * character cells that change
+ */
+typedef struct {
+  FontDef_s font;
+  uint16_t x;
+  uint16_t y;
+  uint16_t color;
+  uint16_t bgColor;
+  uint8_t length;             /* cells, the value is right aligned */
+  uint8_t decimals;
+  uint8_t drawn;              /* shown matches the screen */
+  char shown[ILI9341_READOUT_MAX_CHARS];
+} ILI9341Readout_s;
+/**
+ * @brief Run-length compressed RGB565 image
+ * @details data is a stream of packets over the whole image, rows run into
+ * each other. A header word with ILI9341_RLE_RUN set is followed by one color
+ * repeated (header & ILI9341_RLE_COUNT_MASK) + 1 times, otherwise by
+ * header + 1 literal pixels. Tools/ImagePack.py writes them
+ */
+#define ILI9341_RLE_RUN 0x8000
+#define ILI9341_RLE_COUNT_MASK 0x7FFF
+typedef struct {
+  uint16_t width;
+  uint16_t height;
+  const uint16_t *data;
+  uint32_t length;            /* words in data */
+} ILI9341RleImage_s;
+/**
+ * @brief Decoder state of an RLE image fed in chunks, packets may be split
+ * anywhere between two chunks
+ */
+typedef struct {
+  uint32_t pixelsLeft;        /* pixels of the image still to come */
+  uint16_t packetLeft;        /* pixels left in the current packet, 0 before a header */
+  uint8_t run;                /* current packet is a run */
+  uint8_t haveColor;          /* the color of the current run has been read */
+  uint16_t color;
+} ILI9341RleStream_s;
+/**
+ * @brief Palette image of 1, 2, 4 or 8 bits per pixel
+ * @details Rows are MSB first and padded to whole bytes like the bitmaps of
+ * ILI9341DrawBitmap, every pixel is an index into palette.
+ * Tools/ImageCompiler.cpp writes them
+ */
+typedef struct {
+  uint16_t width;
+  uint16_t height;
+  uint8_t bits;               /* bits per pixel */
+  const uint16_t *palette;    /* RGB565 colors */
+  const uint8_t *data;        /* (width * bits + 7) / 8 bytes per row */
+} ILI9341IndexedImage_s;
+/**
+ * @brief Result of ILI9341QoiFeed
+ */
+#define ILI9341_QOI_MORE  0   /* the image needs more data */
+#define ILI9341_QOI_DONE  1   /* every pixel has been drawn */
+#define ILI9341_QOI_ERROR 2   /* not a QOI image or it does not fit on the screen */
+/**
+ * @brief Decoder state of a QOI image fed in chunks, about 1 KB with the
+ * default ILI9341_QOI_BUFFER_PIXELS
+ */
+typedef struct {
+  uint32_t index[64];         /* RGBA of recently seen pixels, r in the low byte */
+  uint32_t pixelsLeft;         /* pixels still to decode */
+  uint32_t run;               /* decoded repeats of the previous pixel not yet written */
+  uint16_t x;
+  uint16_t y;
+  uint16_t width;
+  uint16_t height;
+  uint8_t r, g, b, a;         /* previous pixel */
+  uint8_t state;              /* ILI9341_QOI_MORE, DONE or ERROR */
+  uint8_t pendingNum;         /* bytes of a header or an op split between chunks */
+  uint8_t pending[14];
+  uint16_t bufferNum;
+  uint16_t buffer[ILI9341_QOI_BUFFER_PIXELS];
+} ILI9341QoiDecoder_s;
+/**
+ * @brief Results of the JPEG decoder
+ */
+#define ILI9341_JPEG_OK          0
+#define ILI9341_JPEG_TRUNCATED   1   /* the data ended early, the rest of the image is garbage */
+#define ILI9341_JPEG_ERROR       2   /* not a JPEG file or a corrupt one */
+#define ILI9341_JPEG_UNSUPPORTED 3   /* progressive, arithmetic coded, 12-bit or unusual sampling */
+/**
+ * @brief Output scale of ILI9341JpegDraw, applied in the IDCT
+ */
+#define ILI9341_JPEG_SCALE_1 0
+#define ILI9341_JPEG_SCALE_2 1       /* half width and height */
+#define ILI9341_JPEG_SCALE_4 2
+#define ILI9341_JPEG_SCALE_8 3       /* DC coefficients only */
+/**
+ * @brief Callback supplying more JPEG data, e.g. from an SD card
+ * @param context pointer given to ILI9341JpegBegin
+ * @param buffer receives the data
+ * @param size size of the buffer
+ * @return bytes stored, 0 at the end of the file
+ */
+typedef uint32_t (*ILI9341JpegRead_t)(void *context, uint8_t *buffer, uint32_t size);
+/**
+ * @brief Huffman table of the JPEG decoder
+ */
+typedef struct {
+  uint16_t lookup[256];       /* length << 8 | symbol of codes up to 8 bits by their first byte, 0 if longer */
+  int32_t maxCode[17];        /* largest code of each length, -1 when there is none */
+  int16_t valueOffset[17];    /* index of the symbol of a code minus the code */
+  uint8_t values[256];
+} ILI9341JpegHuffman_s;
+/**
+ * @brief Color component of a JPEG image
+ */
+typedef struct {
+  uint8_t id;
+  uint8_t h, v;               /* sampling factors */
+  uint8_t quant;              /* quantization table */
+  uint8_t dc, ac;             /* Huffman tables */
+  int16_t prediction;         /* DC of the previous block */
+} ILI9341JpegComponent_s;
+/**
+ * @brief Baseline JPEG decoder state, about 5 KB plus the strip and input buffers
+ */
+typedef struct {
+  ILI9341JpegHuffman_s huffman[4];    /* DC 0, DC 1, AC 0, AC 1 */
+  uint16_t quant[4][64];              /* zigzag order */
+  ILI9341JpegComponent_s component[3];
+  int16_t block[64];
+  uint8_t luma[256];                  /* samples of one MCU */
+  uint8_t chroma[2][64];
+  uint16_t strip[ILI9341_JPEG_STRIP_PIXELS];
+  const uint8_t *next;                /* unread data */
+  const uint8_t *end;
+  ILI9341JpegRead_t read;
+  void *context;
+  uint32_t bits;                      /* entropy coded bits, the next one in bit 31 */
+  uint8_t bitCount;
+  uint8_t marker;                     /* marker that ended the entropy coded data, 0 before */
+  uint8_t status;                     /* ILI9341_JPEG_OK or the first problem */
+  uint8_t componentNum;
+  uint8_t hMax, vMax;
+  uint16_t width;
+  uint16_t height;
+  uint16_t restartInterval;           /* MCUs between restart markers, 0 without */
+  uint8_t input[ILI9341_JPEG_INPUT_BYTES];
+} ILI9341JpegDecoder_s;
+/**
+ * @brief Results of the PNG decoder
+ */
+#define ILI9341_PNG_OK          0
+#define ILI9341_PNG_TRUNCATED   1   /* the data ended early, the rows after it are not drawn */
+#define ILI9341_PNG_ERROR       2   /* not a PNG file or a corrupt one */
+#define ILI9341_PNG_UNSUPPORTED 3   /* interlaced, 16 bits per channel, wider than ILI9341_PNG_MAX_WIDTH
+                                       or a larger inflate window than ILI9341_PNG_WINDOW_BYTES */
+/**
+ * @brief Callback supplying more PNG data, same contract as ILI9341JpegRead_t
+ */
+typedef uint32_t (*ILI9341PngRead_t)(void *context, uint8_t *buffer, uint32_t size);
+/**
+ * @brief Huffman table of the inflater
+ */
+typedef struct {
+  uint16_t lookup[512];       /* length << 9 | symbol of codes up to 9 bits by their next 9 bits, 0 if longer */
+  uint16_t count[16];         /* codes of each length */
+  uint16_t symbol[288];       /* symbols in code order */
+} ILI9341PngHuffman_s;
+/**
+ * @brief PNG decoder state, sizeof() is the peak RAM of a decode: about
+ * 41 KB with the defaults, 12 KB with a 4 KB window. Decoding adds about
+ * 400 bytes of stack
+ */
+typedef struct {
+  ILI9341PngHuffman_s literal;                        /* literal and length codes */
+  ILI9341PngHuffman_s distance;                       /* distance codes, code length codes of a block header */
+  uint8_t window[ILI9341_PNG_WINDOW_BYTES];           /* inflated bytes, also the filtered rows */
+  uint8_t rows[2][1 + 4 * ILI9341_PNG_MAX_WIDTH];     /* filter type and bytes of the current and previous row */
+  uint16_t line[ILI9341_PNG_MAX_WIDTH];               /* RGB565 of the current row */
+  uint8_t palette[256][4];                            /* RGBA */
+  uint16_t colors[256];                               /* palette over the background */
+  const uint8_t *next;                                /* unread data */
+  const uint8_t *end;
+  ILI9341PngRead_t read;
+  void *context;
+  uint32_t chunkLeft;                                 /* bytes left of the current IDAT chunk */
+  uint32_t bits;                                      /* inflate bits, the next one in bit 0 */
+  uint8_t bitCount;
+  uint8_t padding;                                    /* zero bits after the end of the data */
+  uint8_t status;                                     /* ILI9341_PNG_OK or the first problem */
+  uint8_t lastChunk;                                  /* no IDAT chunk follows */
+  uint32_t output;                                    /* inflated bytes so far */
+  uint32_t rowBytes;                                  /* bytes of a row without its filter type */
+  uint32_t rowFill;                                   /* bytes of the current row so far */
+  uint16_t width;
+  uint16_t height;
+  uint16_t row;                                       /* rows done */
+  uint16_t visibleWidth;
+  uint16_t visibleHeight;
+  uint16_t key[3];                                    /* tRNS color of gray and RGB images */
+  uint16_t background;
+  uint8_t bitDepth;
+  uint8_t colorType;
+  uint8_t pixelBytes;                                 /* filter distance */
+  uint8_t hasKey;
+  uint8_t current;                                    /* index of the current row */
+  uint8_t input[ILI9341_PNG_INPUT_BYTES];
+} ILI9341PngDecoder_s;
+/**
+ * @brief Callback supplying the background of a row piece a sprite uncovers
+ * @param context context given to ILI9341SpriteInit
+ * @param x left coordinate of the piece
+ * @param y row of the piece
+ * @param pixels filled with pixelNum RGB565 background pixels
+ * @param pixelNum number of pixels
+ */
+typedef void (*ILI9341SpriteBackground_t)(void *context, uint16_t x, uint16_t y, uint16_t *pixels,
+                                          uint16_t pixelNum);
+/**
+ * @brief Color-keyed sprite that restores what it covered when it moves or hides
+ * @details The background comes from saved, width * height pixels read back
+ * from GRAM as the sprite is drawn, or from the background callback when
+ * saved is NULL
+ */
+typedef struct {
+  const uint16_t *image;      /* width * height RGB565 pixels */
+  uint16_t *saved;            /* pixels under the sprite, row by row like image */
+  ILI9341SpriteBackground_t background;
+  void *context;
+  uint16_t width;
+  uint16_t height;
+  uint16_t key;               /* pixels of this color are transparent */
+  int16_t x;                  /* position drawn at while shown */
+  int16_t y;
+  uint8_t shown;
+} ILI9341Sprite_s;
 /**
  * @brief Backlight control
  * @param backlightOn 0: backlight off, 1: backlight on
@@ -47,9 +400,36 @@ void ILI9341BacklightControl(uint8_t backlightOn);
 /**
  * @brief Initializes ILI9341, make sure always call this function before using
  * any other functions
+ * @details Blocks for about 620ms, use ILI9341InitStart and ILI9341InitPoll to
+ * initialize while the rest of the system boots
  * @return None
  */
 void ILI9341Initialize(void);
+/**
+ * @brief Initialization table entry flags
+ * @details An entry is the command, the length byte, the parameters and, when
+ * ILI9341_INIT_DELAY is set in the length byte, one byte of delay in 10ms
+ * units. The low 7 bits of the length byte are the parameter count. The table
+ * ends with the length byte ILI9341_INIT_END
+ */
+#define ILI9341_INIT_DELAY 0x80
+#define ILI9341_INIT_END 0xFF
+/**
+ * @brief Default panel profile used by ILI9341Initialize
+ */
+extern const uint8_t ILI9341InitTableDefault[];
+/**
+ * @brief Start the non-blocking initialization, the backlight stays off until
+ * it is done
+ * @param initTable panel profile, NULL for ILI9341InitTableDefault
+ * @return None
+ */
+void ILI9341InitStart(const uint8_t *initTable);
+/**
+ * @brief Run the initialization until its next delay, never blocks
+ * @return 1 once the panel is ready, 0 while still initializing
+ */
+uint8_t ILI9341InitPoll(void);
 /**
  * @brief Draw a pixel on screen
  * @param x x coordinate of the pixel
@@ -70,6 +450,228 @@ void ILI9341DrawPixel(uint16_t x, uint16_t y, uint16_t color);
  */
 void ILI9341DrawString(uint16_t x, uint16_t y, const char *string,
                         FontDef_s font, uint16_t color, uint16_t bgColor);
+/**
+ * @brief Measure a string as ILI9341DrawString would draw it on one line,
+ * including advances and kerning of proportional fonts
+ * @param string string to measure
+ * @param font font of the string
+ * @return width and height of the string
+ */
+ILI9341Extent_s ILI9341MeasureString(const char *string, FontDef_s font);
+/**
+ * @brief Draw a string on one line with every glyph pixel scaled up to a
+ * scale x scale block. Monospace glyphs are streamed through one window each,
+ * proportional lines through one window for the line, so big text needs no
+ * more window setups than small text. Characters that do not fit on the
+ * screen width are dropped, rows below the screen are clipped
+ * @param x left coordinate of the string
+ * @param y top coordinate of the string
+ * @param string UTF-8 string to draw
+ * @param font font of the string
+ * @param scale 1 to ILI9341_TEXT_SCALE_MAX, 1 is ILI9341DrawString
+ * @param color font color of the string
+ * @param bgColor background color of the string
+ * @return None
+ */
+void ILI9341DrawStringScaled(uint16_t x, uint16_t y, const char *string, FontDef_s font,
+                             uint8_t scale, uint16_t color, uint16_t bgColor);
+/**
+ * @brief Break a string into lines inside a box, lines starting below the box
+ * are dropped
+ * @details Line breaks are found in one pass. '\n' always breaks, with
+ * ILI9341_TEXT_WRAP a line also breaks at its last space before the box edge,
+ * or inside a word wider than the box. Nothing is recomputed when the layout
+ * already holds the same string content, font and box
+ * @param layout layout to fill, zeroed before its first use
+ * @param string string to lay out, must outlive the layout
+ * @param font font of the string
+ * @param width width of the box
+ * @param height height of the box
+ * @param flags ILI9341_TEXT_* flags
+ * @param lineSpacing extra pixels between lines
+ * @return 1 if the layout was computed, 0 if the cached one was reused
+ */
+uint8_t ILI9341LayoutText(ILI9341TextLayout_s *layout, const char *string, FontDef_s font,
+                          uint16_t width, uint16_t height, uint8_t flags, uint8_t lineSpacing);
+/**
+ * @brief Draw a text layout clipped to its box
+ * @param layout layout from ILI9341LayoutText
+ * @param x left coordinate of the box
+ * @param y top coordinate of the box
+ * @param color font color of the text
+ * @param bgColor background color of the text
+ * @return None
+ */
+void ILI9341DrawLayout(const ILI9341TextLayout_s *layout, uint16_t x, uint16_t y,
+                       uint16_t color, uint16_t bgColor);
+/**
+ * @brief Lay out and draw a string inside a box, the layouts of the last
+ * ILI9341_TEXT_LAYOUT_CACHE strings are kept for the next call
+ * @param x left coordinate of the box
+ * @param y top coordinate of the box
+ * @param width width of the box
+ * @param height height of the box
+ * @param string string to draw
+ * @param font font of the string
+ * @param flags ILI9341_TEXT_* flags
+ * @param lineSpacing extra pixels between lines
+ * @param color font color of the text
+ * @param bgColor background color of the text
+ * @return None
+ */
+void ILI9341DrawTextBox(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                        const char *string, FontDef_s font, uint8_t flags, uint8_t lineSpacing,
+                        uint16_t color, uint16_t bgColor);
+/**
+ * @brief Start a terminal on full-width screen rows, cleared to the default
+ * attribute (light gray on black). The rows scroll in hardware in portrait
+ * orientations, only one terminal can own the scroll area
+ * @param terminal terminal to set up
+ * @param y top row of the terminal
+ * @param rows number of text rows, limited to the screen and ILI9341_TERMINAL_MAX_ROWS
+ * @param font monospace font of the terminal
+ * @return 0 when not even one row or column fits at y, nothing is drawn then
+ */
+uint8_t ILI9341TerminalInit(ILI9341Terminal_s *terminal, uint16_t y, uint8_t rows, FontDef_s font);
+/**
+ * @brief Set the attribute of the characters written next
+ * @param terminal terminal
+ * @param attribute ILI9341_TERMINAL_ATTRIBUTE(fg, bg)
+ * @return None
+ */
+void ILI9341TerminalSetAttribute(ILI9341Terminal_s *terminal, uint8_t attribute);
+/**
+ * @brief Write one character, '\n' starts a new line, '\r', '\b' and '\t'
+ * move the cursor, '\f' clears the terminal
+ * @param terminal terminal
+ * @param codepoint character
+ * @return None
+ */
+void ILI9341TerminalPutChar(ILI9341Terminal_s *terminal, uint32_t codepoint);
+/**
+ * @brief Write a UTF-8 string
+ * @param terminal terminal
+ * @param string string to write
+ * @return None
+ */
+void ILI9341TerminalWrite(ILI9341Terminal_s *terminal, const char *string);
+/**
+ * @brief Formatted write without heap or buffer: %d %i %u %x %X %c %s %%
+ * with '-' and '0' flags, a width and the 'l' length modifier
+ * @param terminal terminal
+ * @param format format string
+ * @return None
+ */
+void ILI9341TerminalPrintf(ILI9341Terminal_s *terminal, const char *format, ...);
+/**
+ * @brief Clear every cell and home the cursor
+ * @param terminal terminal
+ * @return None
+ */
+void ILI9341TerminalClear(ILI9341Terminal_s *terminal);
+/**
+ * @brief Bring the screen up to date, applies pending scrolling and draws
+ * the cells changed since the last flush
+ * @param terminal terminal
+ * @return number of cells drawn
+ */
+uint32_t ILI9341TerminalFlush(ILI9341Terminal_s *terminal);
+/**
+ * @brief Format a scaled integer without printf, two digits per division
+ * @param buffer destination, ILI9341_FORMAT_BUFFER_SIZE characters
+ * @param value value in units of 10^-decimals, 12345 with 3 decimals is 12.345
+ * @param decimals digits after the point, at most 9
+ * @return length of the string
+ */
+uint8_t ILI9341FormatInteger(char *buffer, int32_t value, uint8_t decimals);
+/**
+ * @brief Format a binary fixed-point value, rounded half away from zero
+ * @param buffer destination, ILI9341_FORMAT_BUFFER_SIZE characters
+ * @param value value with fractionBits fraction bits, 0x18000 in Q16 is 1.5
+ * @param fractionBits number of fraction bits, at most 31
+ * @param decimals digits after the point, at most 9
+ * @return length of the string
+ */
+uint8_t ILI9341FormatFixed(char *buffer, int32_t value, uint8_t fractionBits, uint8_t decimals);
+/**
+ * @brief Set up a readout field, nothing is drawn before the first value
+ * @param readout field to set up
+ * @param x left coordinate of the field
+ * @param y top coordinate of the field
+ * @param font font of the field, proportional glyphs are centered in cells
+ * of the nominal font width
+ * @param length number of character cells, at most ILI9341_READOUT_MAX_CHARS
+ * @param decimals digits after the point of numeric values
+ * @param color font color of the field
+ * @param bgColor background color of the field
+ * @return None
+ */
+void ILI9341ReadoutInit(ILI9341Readout_s *readout, uint16_t x, uint16_t y, FontDef_s font,
+                        uint8_t length, uint8_t decimals, uint16_t color, uint16_t bgColor);
+/**
+ * @brief Show a string right aligned in the field, only cells that differ
+ * from what the field shows are drawn. A string longer than the field shows
+ * as ###
+ * @param readout field
+ * @param text ASCII string
+ * @return number of cells drawn
+ */
+uint8_t ILI9341ReadoutSetText(ILI9341Readout_s *readout, const char *text);
+/**
+ * @brief Show a scaled integer, see ILI9341FormatInteger
+ * @param readout field
+ * @param value value in units of 10^-decimals of the field
+ * @return number of cells drawn
+ */
+uint8_t ILI9341ReadoutSetInteger(ILI9341Readout_s *readout, int32_t value);
+/**
+ * @brief Show a binary fixed-point value, see ILI9341FormatFixed
+ * @param readout field
+ * @param value fixed-point value
+ * @param fractionBits number of fraction bits of value
+ * @return number of cells drawn
+ */
+uint8_t ILI9341ReadoutSetFixed(ILI9341Readout_s *readout, int32_t value, uint8_t fractionBits);
+/**
+ * @brief Change the colors of a field, the next value redraws every cell
+ * @param readout field
+ * @param color font color of the field
+ * @param bgColor background color of the field
+ * @return None
+ */
+void ILI9341ReadoutSetColors(ILI9341Readout_s *readout, uint16_t color, uint16_t bgColor);
+/**
+ * @brief Forget what the field shows, needed after drawing over it
+ * @param readout field
+ * @return None
+ */
+void ILI9341ReadoutInvalidate(ILI9341Readout_s *readout);
+/**
+ * @brief Read the expanded glyph cache counters, all zero when
+ * ILI9341_GLYPH_CACHE_SIZE is 0
+ * @param stats destination of the counters
+ * @return None
+ */
+void ILI9341GlyphCacheGetStats(ILI9341GlyphCacheStats_s *stats);
+/**
+ * @brief Drop every cached glyph and clear the counters, needed when font
+ * data in RAM changes
+ * @return None
+ */
+void ILI9341GlyphCacheReset(void);
+/**
+ * @brief Hand long pixel runs such as cached glyphs to a bulk writer
+ * @param bulkWrite bulk writer, 0 to use the CPU pixel pump
+ * @return None
+ */
+void ILI9341SetBulkWrite(ILI9341BulkWrite_t bulkWrite);
+/**
+ * @brief Hand rectangle fills and long image runs, at least
+ * ILI9341_BULK_MIN_PIXELS, to a bulk filler
+ * @param bulkFill bulk filler, 0 to fill with the CPU
+ * @return None
+ */
+void ILI9341SetBulkFill(ILI9341BulkFill_t bulkFill);
 /**
  * @brief Fill a rectangle with the specified color
  * @param x left x coordinate
@@ -154,6 +756,311 @@ void ILI9341DrawBezierCurve(uint16_t x, uint16_t y,
  */
 void ILI9341DrawImage(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
                         const uint16_t *image);
+/**
+ * @brief Sampling of ILI9341DrawImageScaled
+ */
+#define ILI9341_SCALE_NEAREST 0
+#define ILI9341_SCALE_BILINEAR 1
+/**
+ * @brief Draw an image scaled to another size through one address window
+ * @details Source positions step in 16.16 fixed point from pixel center to
+ * pixel center. Every output row is generated into a line buffer and
+ * streamed, a nearest row repeating the previous one is written again
+ * without sampling. Bilinear blends 2x2 pixels with 5-bit weights on packed
+ * RGB565. Parts outside the screen are clipped
+ * @param x left coordinate of the scaled image
+ * @param y top coordinate of the scaled image
+ * @param width width of the image
+ * @param height height of the image
+ * @param image rgb565 points array
+ * @param scaledWidth width on screen
+ * @param scaledHeight height on screen
+ * @param filter ILI9341_SCALE_NEAREST or ILI9341_SCALE_BILINEAR
+ * @return None
+ */
+void ILI9341DrawImageScaled(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t *image,
+                            uint16_t scaledWidth, uint16_t scaledHeight, uint8_t filter);
+/**
+ * @brief Key of ILI9341DrawImageRotated that leaves every pixel opaque
+ */
+#define ILI9341_NO_COLOR_KEY 0x10000
+/**
+ * @brief Draw an image rotated and zoomed about a pivot
+ * @details Screen pixels of the bounding box step through the image in 16.16
+ * fixed point. The span of every row that lands inside the image is solved
+ * exactly, nothing outside it is sampled or written. Spans are generated
+ * into a line buffer and written through one window each, key pixels split
+ * them. Nearest sampling. Parts outside the screen are clipped
+ * @param x screen column of the pivot, may be off the screen
+ * @param y screen row of the pivot, may be off the screen
+ * @param width width of the image, below 16384
+ * @param height height of the image, below 16384
+ * @param image rgb565 points array
+ * @param pivotX image column turning around x, y, e.g. the hub of a needle
+ * @param pivotY image row turning around x, y
+ * @param angle clockwise angle in tenths of a degree, any value
+ * @param zoom size on screen in 1/256, 256 is 1:1
+ * @param key transparent color, ILI9341_NO_COLOR_KEY for none
+ * @return None
+ */
+void ILI9341DrawImageRotated(int16_t x, int16_t y, uint16_t width, uint16_t height, const uint16_t *image,
+                             int16_t pivotX, int16_t pivotY, int32_t angle, uint16_t zoom, uint32_t key);
+/**
+ * @brief Draw a 1-bpp bitmap in two colors through one address window
+ * @details Rows are MSB first and padded to whole bytes, the layout of
+ * image2cpp and most icon converters. Parts outside the screen are clipped
+ * @param x left coordinate of the bitmap
+ * @param y top coordinate of the bitmap
+ * @param width width of the bitmap
+ * @param height height of the bitmap
+ * @param bitmap (width + 7) / 8 bytes per row
+ * @param color color of set bits
+ * @param bgColor color of clear bits
+ * @return None
+ */
+void ILI9341DrawBitmap(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                       const uint8_t *bitmap, uint16_t color, uint16_t bgColor);
+/**
+ * @brief Draw only the set bits of a 1-bpp bitmap, clear bits keep what is on screen
+ * @details Every horizontal run of set bits is one address window and a fill,
+ * so sparse icons and outlines cost far less than their bounding box
+ * @param x left coordinate of the bitmap
+ * @param y top coordinate of the bitmap
+ * @param width width of the bitmap
+ * @param height height of the bitmap
+ * @param bitmap (width + 7) / 8 bytes per row, MSB first
+ * @param color color of set bits
+ * @return None
+ */
+void ILI9341DrawBitmapTransparent(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                                  const uint8_t *bitmap, uint16_t color);
+/**
+ * @brief Draw a run-length compressed image through one address window
+ * @details Runs are filled and literals streamed straight into GRAM, nothing
+ * is decompressed into RAM. Runs and literals of at least
+ * ILI9341_BULK_MIN_PIXELS go to the bulk filler and writer. Like
+ * ILI9341DrawImage, an image that does not fit on the screen is not drawn
+ * @param x left coordinate of the image
+ * @param y top coordinate of the image
+ * @param image compressed image
+ * @return None
+ */
+void ILI9341DrawRleImage(uint16_t x, uint16_t y, const ILI9341RleImage_s *image);
+/**
+ * @brief Open the address window of an RLE image whose data comes in chunks,
+ * e.g. read from external flash or an SD card
+ * @param stream decoder state
+ * @param x left coordinate of the image
+ * @param y top coordinate of the image
+ * @param width width of the image
+ * @param height height of the image
+ * @return 0 when the image does not fit on the screen, 1 otherwise
+ */
+uint8_t ILI9341RleBegin(ILI9341RleStream_s *stream, uint16_t x, uint16_t y,
+                        uint16_t width, uint16_t height);
+/**
+ * @brief Decode the next chunk of an RLE image opened with ILI9341RleBegin
+ * @details Nothing else may draw until the image is complete, the chunks go
+ * into the open address window
+ * @param stream decoder state
+ * @param words next words of the packet stream, any length
+ * @param wordNum number of words
+ * @return pixels of the image still to come, 0 once it is complete
+ */
+uint32_t ILI9341RleFeed(ILI9341RleStream_s *stream, const uint16_t *words, uint32_t wordNum);
+/**
+ * @brief Draw a palette image through one address window
+ * @details Pixels are looked up into a line buffer that runs on across row
+ * ends, so even narrow images go out in bulk writes of
+ * ILI9341_BULK_MIN_PIXELS. Parts outside the screen are clipped
+ * @param x left coordinate of the image
+ * @param y top coordinate of the image
+ * @param image palette image
+ * @return None
+ */
+void ILI9341DrawIndexedImage(uint16_t x, uint16_t y, const ILI9341IndexedImage_s *image);
+/**
+ * @brief Draw a QOI image through one address window
+ * @details The decoder keeps the 64-entry index and a pixel buffer, converts
+ * to RGB565 on the fly and writes every full buffer in one bulk write; long
+ * runs become fills. Alpha is ignored. Uses a static decoder, call
+ * ILI9341QoiBegin and ILI9341QoiFeed with your own for images in chunks
+ * @param x left coordinate of the image
+ * @param y top coordinate of the image
+ * @param data QOI file
+ * @param size size of the file in bytes
+ * @return ILI9341_QOI_DONE, ILI9341_QOI_MORE for a truncated file or
+ * ILI9341_QOI_ERROR
+ */
+uint8_t ILI9341DrawQoi(uint16_t x, uint16_t y, const uint8_t *data, uint32_t size);
+/**
+ * @brief Start decoding a QOI image that comes in chunks
+ * @param decoder decoder state
+ * @param x left coordinate of the image
+ * @param y top coordinate of the image
+ * @return None
+ */
+void ILI9341QoiBegin(ILI9341QoiDecoder_s *decoder, uint16_t x, uint16_t y);
+/**
+ * @brief Decode the next chunk of a QOI image
+ * @details The address window opens once the header is complete, width and
+ * height of the decoder are valid from then on. Nothing else may draw until
+ * the image is done
+ * @param decoder decoder state
+ * @param bytes next bytes of the file, any length
+ * @param byteNum number of bytes
+ * @return ILI9341_QOI_MORE, ILI9341_QOI_DONE or ILI9341_QOI_ERROR
+ */
+uint8_t ILI9341QoiFeed(ILI9341QoiDecoder_s *decoder, const uint8_t *bytes, uint32_t byteNum);
+/**
+ * @brief Draw a baseline JPEG image
+ * @details Uses a static decoder, see ILI9341JpegBegin and ILI9341JpegDraw.
+ * The image is clipped at the screen edges
+ * @param x left coordinate of the image
+ * @param y top coordinate of the image
+ * @param data JPEG file
+ * @param size size of the file in bytes
+ * @param scale ILI9341_JPEG_SCALE_1, _2, _4 or _8
+ * @return ILI9341_JPEG_OK or a problem of the file
+ */
+uint8_t ILI9341DrawJpeg(uint16_t x, uint16_t y, const uint8_t *data, uint32_t size, uint8_t scale);
+/**
+ * @brief Read the headers of a JPEG file up to the image data
+ * @details Width and height of the decoder are valid afterwards, e.g. to pick
+ * a scale. The file starts with data and goes on with what read returns
+ * @param decoder decoder state
+ * @param data first bytes of the file, may be NULL
+ * @param size number of bytes of data
+ * @param read callback for the rest of the file, NULL when data is all of it
+ * @param context passed to read
+ * @return ILI9341_JPEG_OK or a problem of the file
+ */
+uint8_t ILI9341JpegBegin(ILI9341JpegDecoder_s *decoder, const uint8_t *data, uint32_t size,
+                         ILI9341JpegRead_t read, void *context);
+/**
+ * @brief Decode and draw the image of ILI9341JpegBegin
+ * @details One MCU row is decoded into the strip buffer, converted to RGB565
+ * and written in one bulk write per strip. Scaling happens in the IDCT, a
+ * 1/8 image only needs the DC coefficients. MCUs right of the screen skip the
+ * IDCT, decoding stops below it
+ * @param decoder decoder state
+ * @param x left coordinate of the image
+ * @param y top coordinate of the image
+ * @param scale ILI9341_JPEG_SCALE_1, _2, _4 or _8
+ * @return ILI9341_JPEG_OK or a problem of the file
+ */
+uint8_t ILI9341JpegDraw(ILI9341JpegDecoder_s *decoder, uint16_t x, uint16_t y, uint8_t scale);
+/**
+ * @brief Draw a PNG image
+ * @details Uses a static decoder, see ILI9341PngBegin and ILI9341PngDraw.
+ * The image is clipped at the screen edges
+ * @param x left coordinate of the image
+ * @param y top coordinate of the image
+ * @param data PNG file
+ * @param size size of the file in bytes
+ * @param background RGB565 color under transparent pixels
+ * @return ILI9341_PNG_OK or a problem of the file
+ */
+uint8_t ILI9341DrawPng(uint16_t x, uint16_t y, const uint8_t *data, uint32_t size, uint16_t background);
+/**
+ * @brief Read the chunks of a PNG file up to the image data
+ * @details Width and height of the decoder are valid afterwards. The file
+ * starts with data and goes on with what read returns
+ * @param decoder decoder state
+ * @param data first bytes of the file, may be NULL
+ * @param size number of bytes of data
+ * @param read callback for the rest of the file, NULL when data is all of it
+ * @param context passed to read
+ * @return ILI9341_PNG_OK or a problem of the file
+ */
+uint8_t ILI9341PngBegin(ILI9341PngDecoder_s *decoder, const uint8_t *data, uint32_t size,
+                        ILI9341PngRead_t read, void *context);
+/**
+ * @brief Inflate, unfilter and draw the image of ILI9341PngBegin
+ * @details Palette, gray and truecolor images of 1 to 8 bits per channel.
+ * Each row is unfiltered against the previous one, converted to RGB565 with
+ * alpha and tRNS colors blended over the background, and written in one bulk
+ * write into a single address window. Decoding stops below the screen. CRCs
+ * and the Adler-32 are not checked
+ * @param decoder decoder state
+ * @param x left coordinate of the image
+ * @param y top coordinate of the image
+ * @param background RGB565 color under transparent pixels
+ * @return ILI9341_PNG_OK or a problem of the file
+ */
+uint8_t ILI9341PngDraw(ILI9341PngDecoder_s *decoder, uint16_t x, uint16_t y, uint16_t background);
+/**
+ * @brief Set up a sprite, nothing is drawn before ILI9341SpriteMove
+ * @details Sprites that overlap each other must be hidden in the reverse
+ * order they were drawn in, each one restores what was under it when it was
+ * drawn
+ * @param sprite sprite to set up
+ * @param image width * height RGB565 pixels
+ * @param width width of the sprite, at most ILI9341_SPRITE_MAX_WIDTH with a
+ * background callback
+ * @param height height of the sprite
+ * @param key transparent color
+ * @param saved buffer of width * height pixels for GRAM readback, or NULL
+ * @param background callback used when saved is NULL
+ * @param context passed to the callback
+ * @return 0 when neither saved nor background is given or the sprite is too
+ * wide for the callback, 1 otherwise
+ */
+uint8_t ILI9341SpriteInit(ILI9341Sprite_s *sprite, const uint16_t *image, uint16_t width, uint16_t height,
+                          uint16_t key, uint16_t *saved, ILI9341SpriteBackground_t background,
+                          void *context);
+/**
+ * @brief Draw a sprite at a position, moving it there if it is shown
+ * @details Only the opaque row spans are written. The pixels it leaves are
+ * restored, the ones it still covers are not touched twice. Parts outside the
+ * screen are clipped. A sprite already shown at x, y is not drawn again
+ * @param sprite sprite set up with ILI9341SpriteInit
+ * @param x left coordinate, may be negative
+ * @param y top coordinate, may be negative
+ * @return None
+ */
+void ILI9341SpriteMove(ILI9341Sprite_s *sprite, int16_t x, int16_t y);
+/**
+ * @brief Restore the pixels under a shown sprite
+ * @param sprite sprite set up with ILI9341SpriteInit
+ * @return None
+ */
+void ILI9341SpriteHide(ILI9341Sprite_s *sprite);
+/**
+ * @brief Find the fastest stable FSMC timing by writing test patterns into
+ * GRAM and reading them back, then add ILI9341_TIMING_MARGIN_PERCENT
+ * @details Call it after ILI9341Initialize and before drawing, the top-left
+ * 16x2 pixels are cleared to black afterwards. The result is applied, stored
+ * for ILI9341GetTiming and can be persisted and re-applied at boot instead of
+ * calibrating again
+ * @param apply callback programming the FSMC
+ * @param result receives the calibrated timing, may be NULL
+ * @return 0 on success, 1 when even the slowest timing fails, the slowest
+ * timing is left applied in that case
+ */
+uint8_t ILI9341CalibrateTiming(ILI9341TimingApply_t apply, ILI9341Timing_s *result);
+/**
+ * @brief Get the timing stored by the last calibration
+ * @return stored timing, or NULL before any calibration
+ */
+const ILI9341Timing_s *ILI9341GetTiming(void);
+/**
+ * @brief Define the rows moved by hardware vertical scrolling (VSCRDEF), the
+ * rows above and below stay fixed. Only the portrait orientations scroll
+ * along screen rows
+ * @param top first row of the scroll area
+ * @param height number of rows of the scroll area
+ * @return 1 if the area was set, 0 in landscape or for an invalid area
+ */
+uint8_t ILI9341SetScrollArea(uint16_t top, uint16_t height);
+/**
+ * @brief Scroll the area set by ILI9341SetScrollArea (VSCRSADD), GRAM row
+ * top + offset is shown on the first row of the area and rows above it wrap
+ * around to the bottom. Drawing keeps using GRAM coordinates
+ * @param offset scroll offset in rows
+ * @return None
+ */
+void ILI9341SetScrollOffset(uint16_t offset);
 /**
  * @brief Control inverting color of whole screen
  * @param invert invert or not
@@ -162,7 +1069,33 @@ void ILI9341DrawImage(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
 void ILI9341ColorInvert(uint8_t invert);
 
 #if ILI9341_DRIVER_LIBRARY_ENABLE_TEST == 1
+/**
+ * @brief Draw the test scene once, also used by the host harness in Host/
+ * @return None
+ */
+void ILI9341TestScene(void);
+/**
+ * @brief Draw the test scene and never return
+ * @return None
+ */
 void ILI9341TestFunction(void);
+/**
+ * @brief One benchmark measurement
+ */
+typedef struct {
+  const char *name;
+  uint32_t cycles;
+  uint32_t pixels;
+  uint32_t bytes;             /* encoded source size of decoders, 0 otherwise */
+} ILI9341BenchmarkResult_s;
+/**
+ * @brief Measure the drawing paths with the DWT cycle counter, the 16-bit
+ * entries are the one-store-per-pixel reference loops
+ * @param results result buffer
+ * @param maxResults result buffer size
+ * @return number of results written
+ */
+uint32_t ILI9341Benchmark(ILI9341BenchmarkResult_s *results, uint32_t maxResults);
 #endif
 
-#endif
\ No newline at end of file
+#endif
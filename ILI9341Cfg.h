@@ -30,9 +30,126 @@
  * horizontal mirror
  */
 #define ILI9341_SCREEN_ORIENTATION 2
+/**
+ * @brief Safety margin added to the data setup time found by
+ * ILI9341CalibrateTiming, in percent of the whole access
+ */
+#define ILI9341_TIMING_MARGIN_PERCENT 25
+/**
+ * @brief SRAM budget of the expanded glyph cache in bytes, 0 disables it
+ * @details Monospace glyphs are kept as RGB565 bitmaps keyed by font,
+ * character and colors, redrawing one is a single bulk write. A 16x26 glyph
+ * takes 832 bytes, a 7x10 one 140 bytes
+ */
+#ifndef ILI9341_GLYPH_CACHE_SIZE
+#define ILI9341_GLYPH_CACHE_SIZE 0
+#endif
+/**
+ * @brief Maximum number of glyphs in the expanded glyph cache
+ */
+#ifndef ILI9341_GLYPH_CACHE_ENTRIES
+#define ILI9341_GLYPH_CACHE_ENTRIES 32
+#endif
+/**
+ * @brief Shortest pixel run handed to the bulk writer or filler, shorter
+ * runs stay on the CPU where the DMA setup would cost more than it saves
+ */
+#ifndef ILI9341_BULK_MIN_PIXELS
+#define ILI9341_BULK_MIN_PIXELS 128
+#endif
+/**
+ * @brief Maximum number of lines of a text layout, lines past it are dropped
+ */
+#ifndef ILI9341_TEXT_MAX_LINES
+#define ILI9341_TEXT_MAX_LINES 8
+#endif
+/**
+ * @brief Number of layouts ILI9341DrawTextBox keeps, so static labels drawn
+ * every frame skip measuring and wrapping
+ */
+#ifndef ILI9341_TEXT_LAYOUT_CACHE
+#define ILI9341_TEXT_LAYOUT_CACHE 4
+#endif
+/**
+ * @brief Cell grid size of ILI9341Terminal_s, every terminal reserves about
+ * 3 bytes per cell. At most 64 columns
+ */
+#ifndef ILI9341_TERMINAL_MAX_ROWS
+#define ILI9341_TERMINAL_MAX_ROWS 32
+#endif
+#ifndef ILI9341_TERMINAL_MAX_COLUMNS
+#define ILI9341_TERMINAL_MAX_COLUMNS 48
+#endif
+/**
+ * @brief Maximum number of character cells of a readout field
+ */
+#ifndef ILI9341_READOUT_MAX_CHARS
+#define ILI9341_READOUT_MAX_CHARS 12
+#endif
+/**
+ * @brief Pixel buffer of a QOI decoder, filled pixels go out in one write
+ */
+#ifndef ILI9341_QOI_BUFFER_PIXELS
+#define ILI9341_QOI_BUFFER_PIXELS 320
+#endif
+/**
+ * @brief Strip buffer of the JPEG decoder, one MCU row of a 240-pixel wide
+ * 4:2:0 image by default. At least 256 pixels, a row wider than the strip is
+ * written in pieces
+ */
+#ifndef ILI9341_JPEG_STRIP_PIXELS
+#define ILI9341_JPEG_STRIP_PIXELS 3840
+#endif
+/**
+ * @brief Input buffer of the JPEG decoder, only used with a read callback
+ */
+#ifndef ILI9341_JPEG_INPUT_BYTES
+#define ILI9341_JPEG_INPUT_BYTES 512
+#endif
+/**
+ * @brief Inflate window of the PNG decoder, a power of two. PNG encoders
+ * declare 32 KB; a smaller one decodes images whose encoder declared at most
+ * this much (Tools/ImagePack.py --window) or whose data fits into it
+ */
+#ifndef ILI9341_PNG_WINDOW_BYTES
+#define ILI9341_PNG_WINDOW_BYTES 32768
+#endif
+/**
+ * @brief Widest PNG image, sizes the two row buffers of the decoder
+ */
+#ifndef ILI9341_PNG_MAX_WIDTH
+#define ILI9341_PNG_MAX_WIDTH 320
+#endif
+/**
+ * @brief Input buffer of the PNG decoder, only used with a read callback
+ */
+#ifndef ILI9341_PNG_INPUT_BYTES
+#define ILI9341_PNG_INPUT_BYTES 512
+#endif
+/**
+ * @brief Widest sprite, sizes the line buffer of restores from a background callback
+ */
+#ifndef ILI9341_SPRITE_MAX_WIDTH
+#define ILI9341_SPRITE_MAX_WIDTH 64
+#endif
 /**
  * @brief Run the test function or not
  */
 #define ILI9341_DRIVER_LIBRARY_ENABLE_TEST 1
+/**
+ * @brief Route bus accesses into the host-side simulated controller
+ * @details Only the host test harness in Host/ sets this to 1, keep it 0 on
+ * the target
+ */
+#ifndef ILI9341_BUS_SIMULATION
+#define ILI9341_BUS_SIMULATION 0
+#endif
+/**
+ * @brief Compile in the bus trace recorder of ILI9341Trace.h
+ * @details Costs one branch per bus cycle while no trace is running
+ */
+#ifndef ILI9341_ENABLE_BUS_TRACE
+#define ILI9341_ENABLE_BUS_TRACE 0
+#endif
 
 #endif
@@ -0,0 +1,813 @@
+/********************************************************************************************************
+ * @Filename: ILI9341Font.c
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: Text rendering of ILI9341 Driver Library
+ *********************************************************************************************************/
+#include "ILI9341Private.h"
+#include <string.h>
+
+/**
+ * @brief Row cursor over one glyph, fed straight into the glyph window
+ */
+typedef struct {
+  const uint8_t *bytes;
+  uint32_t bit;
+  const uint16_t *rows;
+  uint8_t encoding;
+  uint8_t color;      /* RLE: color of the current run */
+  uint32_t run;       /* RLE: pixels left in the current run */
+  uint32_t previous;  /* ROW_DELTA: last decoded row */
+} GlyphReader_s;
+/**
+ * @brief Decode the next UTF-8 character
+ * @param string cursor into a non-empty string, moved past the character
+ * @return codepoint, U+FFFD for malformed sequences
+ */
+uint32_t utf8Next(const char **string) {
+  const uint8_t *bytes = (const uint8_t *)*string;
+  uint32_t codepoint, length, i;
+  if (bytes[0] < 0x80) {
+    *string += 1;
+    return bytes[0];
+  }
+  if ((bytes[0] & 0xE0) == 0xC0) {
+    codepoint = bytes[0] & 0x1F;
+    length = 2;
+  } else if ((bytes[0] & 0xF0) == 0xE0) {
+    codepoint = bytes[0] & 0x0F;
+    length = 3;
+  } else if ((bytes[0] & 0xF8) == 0xF0) {
+    codepoint = bytes[0] & 0x07;
+    length = 4;
+  } else {
+    *string += 1;
+    return 0xFFFD;
+  }
+  for (i = 1; i < length; i++) {
+    /* Also stops at the terminator, it is no continuation byte */
+    if ((bytes[i] & 0xC0) != 0x80) {
+      *string += i;
+      return 0xFFFD;
+    }
+    codepoint = codepoint << 6 | (bytes[i] & 0x3F);
+  }
+  *string += length;
+  if ((length == 2 && codepoint < 0x80) || (length == 3 && codepoint < 0x800) ||
+      (length == 4 && codepoint < 0x10000) || codepoint > 0x10FFFF ||
+      (codepoint >= 0xD800 && codepoint <= 0xDFFF))
+    return 0xFFFD;
+  return codepoint;
+}
+/**
+ * @brief Codepoint of the next UTF-8 character without consuming it
+ * @param string string cursor
+ * @return codepoint, 0 at the end of the string
+ */
+static uint32_t utf8Peek(const char *string) {
+  return *string ? utf8Next(&string) : 0;
+}
+/**
+ * @brief Glyph number of a codepoint
+ * @details Fonts with a codepoint index are binary searched, at most 16 steps
+ * for 65535 glyphs. Missing codepoints use glyph 0, which is the first
+ * character of every font
+ * @param font font to look in
+ * @param codepoint Unicode codepoint
+ * @return glyph number
+ */
+static uint32_t glyphIndex(const FontDef_s *font, uint32_t codepoint) {
+  if (font->codepoints != 0) {
+    uint32_t low = 0, high = font->glyphNum;
+    if (codepoint > 0xFFFF)
+      return 0;
+    while (low < high) {
+      uint32_t middle = (low + high) >> 1;
+      if (font->codepoints[middle] == codepoint)
+        return middle;
+      if (font->codepoints[middle] < codepoint)
+        low = middle + 1;
+      else
+        high = middle;
+    }
+    return 0;
+  }
+  if (font->bitmap == 0)
+    return codepoint < 32 || codepoint > 126 ? 0 : codepoint - 32;
+  if (codepoint < font->firstChar || codepoint > font->lastChar)
+    return 0;
+  return codepoint - font->firstChar;
+}
+/**
+ * @brief Position a reader on the first row of a glyph
+ * @param reader reader to initialize
+ * @param font font of the glyph
+ * @param index glyph number from glyphIndex
+ * @return None
+ */
+static void glyphBegin(GlyphReader_s *reader, const FontDef_s *font, uint32_t index) {
+  reader->bytes = 0;
+  reader->bit = 0;
+  reader->encoding = font->encoding;
+  reader->color = 1;
+  reader->run = 0;
+  reader->previous = 0;
+  if (font->bitmap == 0) {
+    reader->rows = font->fontData + index * font->height;
+    return;
+  }
+  reader->rows = 0;
+  if (font->glyphOffset32 != 0) {
+    reader->bytes = font->bitmap + font->glyphOffset32[index];
+  } else if (font->glyphOffset != 0) {
+    reader->bytes = font->bitmap + font->glyphOffset[index];
+  } else {
+    /* Fixed size glyphs, every one fills the whole cell */
+    uint32_t bits = (uint32_t)font->width * font->height * (font->bpp > 1 ? font->bpp : 1);
+    reader->bytes = font->bitmap + index * ((bits + 7) >> 3);
+  }
+}
+/**
+ * @brief Read bits from an MSB-first bitstream
+ * @param bytes start of the bitstream
+ * @param bit bit position
+ * @param width number of bits, 1 to 32
+ * @return bits, bit 31 is the first one
+ */
+static uint32_t readBits(const uint8_t *bytes, uint32_t bit, uint8_t width) {
+  uint32_t window, shift = bit & 7;
+  bytes += bit >> 3;
+  if (width <= 16) {
+    window = (uint32_t)bytes[0] << 16 | (uint32_t)bytes[1] << 8 | bytes[2];
+    return (window << (shift + 8)) & (0xFFFFFFFFU << (32 - width));
+  }
+  window = (uint32_t)bytes[0] << 24 | (uint32_t)bytes[1] << 16 | (uint32_t)bytes[2] << 8 | bytes[3];
+  if (shift != 0)
+    window = window << shift | (shift + width > 32 ? bytes[4] >> (8 - shift) : 0);
+  return window & (0xFFFFFFFFU << (32 - width));
+}
+/**
+ * @brief Decode the next row of an RLE glyph, runs carry over between rows
+ * @param reader glyph reader
+ * @param width glyph width, at most 32
+ * @return row bits, bit 31 is the leftmost pixel
+ */
+static uint32_t rleNextRow(GlyphReader_s *reader, uint8_t width) {
+  uint32_t row = 0, column = 0;
+  while (column < width) {
+    uint32_t count;
+    while (reader->run == 0) {
+      uint32_t nibble;
+      reader->color ^= 1;
+      do {
+        nibble = (reader->bytes[reader->bit >> 3] >> (4 - (reader->bit & 4))) & 0x0F;
+        reader->bit += 4;
+        reader->run += nibble;
+      } while (nibble == 15);
+    }
+    count = reader->run < width - column ? reader->run : width - column;
+    if (reader->color) {
+      uint32_t mask = 0xFFFFFFFFU >> column;
+      if (column + count < 32)
+        mask &= ~(0xFFFFFFFFU >> (column + count));
+      row |= mask;
+    }
+    column += count;
+    reader->run -= count;
+  }
+  return row;
+}
+/**
+ * @brief Decode the next glyph row
+ * @param reader glyph reader
+ * @param width glyph width, at most 32
+ * @return row bits, bit 31 is the leftmost pixel
+ */
+static uint32_t glyphNextRow(GlyphReader_s *reader, uint8_t width) {
+  uint32_t row;
+  if (reader->rows != 0)
+    return (uint32_t)*reader->rows++ << 16;
+  switch (reader->encoding) {
+  case FONT_ENCODING_RLE:
+    return rleNextRow(reader, width);
+  case FONT_ENCODING_ROW_DELTA:
+    if (readBits(reader->bytes, reader->bit++, 1) != 0) {
+      reader->previous = readBits(reader->bytes, reader->bit, width);
+      reader->bit += width;
+    }
+    return reader->previous;
+  default:
+    row = readBits(reader->bytes, reader->bit, width);
+    reader->bit += width;
+    return row;
+  }
+}
+/**
+ * @brief Blended colors of every coverage level for the last color pair
+ */
+static uint16_t blendRamp[16];
+static uint32_t blendRampKey;
+static uint8_t blendRampBpp;
+/**
+ * @brief Blend ramp of anti-aliased glyphs, recomputed only when the colors change
+ * @param color font color, the top level
+ * @param bgcolor background color, level 0
+ * @param bpp bits per pixel of the font, 2 or 4
+ * @return RGB565 color of every coverage level
+ */
+static const uint16_t *blendRampFor(uint16_t color, uint16_t bgcolor, uint8_t bpp) {
+  uint32_t key = (uint32_t)color << 16 | bgcolor, top, level;
+  int32_t r, g, b;
+  if (blendRampBpp == bpp && blendRampKey == key)
+    return blendRamp;
+  top = (1U << bpp) - 1;
+  r = (int32_t)(color >> 11) - (bgcolor >> 11);
+  g = (int32_t)((color >> 5) & 0x3F) - ((bgcolor >> 5) & 0x3F);
+  b = (int32_t)(color & 0x1F) - (bgcolor & 0x1F);
+  for (level = 0; level <= top; level++) {
+    /* Round half away from zero so both ends land exactly on the colors */
+    int32_t dr = (r * (int32_t)level * 2 + (r < 0 ? -(int32_t)top : (int32_t)top)) / (int32_t)(2 * top);
+    int32_t dg = (g * (int32_t)level * 2 + (g < 0 ? -(int32_t)top : (int32_t)top)) / (int32_t)(2 * top);
+    int32_t db = (b * (int32_t)level * 2 + (b < 0 ? -(int32_t)top : (int32_t)top)) / (int32_t)(2 * top);
+    blendRamp[level] = (uint16_t)((((bgcolor >> 11) + dr) << 11) |
+                                  ((((bgcolor >> 5) & 0x3F) + dg) << 5) |
+                                  ((bgcolor & 0x1F) + db));
+  }
+  blendRampKey = key;
+  blendRampBpp = bpp;
+  return blendRamp;
+}
+/**
+ * @brief Four pixels of every nibble for the last color pair of 1-bit expansion
+ */
+static uint16_t monoTable[16][4];
+static uint32_t monoTableKey;
+static uint8_t monoTableValid;
+/**
+ * @brief Expand MSB-first 1-bit pixels into RGB565 through the nibble table
+ * @details The table is rebuilt only when the colors change, then every byte
+ * is two lookups of four pixels instead of eight bit tests
+ * @param bits pixel bits, bit 31 is the leftmost pixel
+ * @param count number of pixels, at most 32
+ * @param pixels destination of count pixels
+ * @param color color of set bits
+ * @param bgcolor color of clear bits
+ * @return None
+ */
+void expandBits(uint32_t bits, uint32_t count, uint16_t *pixels, uint16_t color, uint16_t bgcolor) {
+  uint32_t key = (uint32_t)color << 16 | bgcolor, i;
+  if (!monoTableValid || monoTableKey != key) {
+    for (i = 0; i < 16; i++) {
+      monoTable[i][0] = (i & 8) ? color : bgcolor;
+      monoTable[i][1] = (i & 4) ? color : bgcolor;
+      monoTable[i][2] = (i & 2) ? color : bgcolor;
+      monoTable[i][3] = (i & 1) ? color : bgcolor;
+    }
+    monoTableKey = key;
+    monoTableValid = 1;
+  }
+  for (; count >= 4; count -= 4, bits <<= 4, pixels += 4)
+    memcpy(pixels, monoTable[bits >> 28], sizeof(monoTable[0]));
+  for (; count > 0; count--, bits <<= 1)
+    *pixels++ = (bits & 0x80000000U) ? color : bgcolor;
+}
+/**
+ * @brief Expand the next glyph row into RGB565 pixels
+ * @param reader glyph reader
+ * @param font font of the glyph
+ * @param ramp blend ramp of anti-aliased fonts, unused for 1-bit fonts
+ * @param row destination of font.width pixels
+ * @param color color of character
+ * @param bgcolor background color of character
+ * @return None
+ */
+static void expandGlyphRow(GlyphReader_s *reader, const FontDef_s *font, const uint16_t *ramp,
+                           uint16_t *row, uint16_t color, uint16_t bgcolor) {
+  uint32_t j;
+  if (font->bpp > 1) {
+    uint32_t mask = (1U << font->bpp) - 1, shift = 8 - font->bpp;
+    /* Levels never straddle a byte, bpp divides 8 */
+    for (j = 0; j < font->width; j++, reader->bit += font->bpp)
+      row[j] = ramp[(reader->bytes[reader->bit >> 3] >> (shift - (reader->bit & 7))) & mask];
+    return;
+  }
+  expandBits(glyphNextRow(reader, font->width), font->width, row, color, bgcolor);
+}
+#if ILI9341_GLYPH_CACHE_SIZE > 0
+/**
+ * @brief One expanded glyph in the cache arena
+ */
+typedef struct {
+  const void *font;
+  uint32_t offset;
+  uint32_t lastUse;
+  uint16_t pixelNum;
+  uint16_t color;
+  uint16_t bgcolor;
+  uint16_t index;
+} GlyphCacheEntry_s;
+/**
+ * @brief Expanded glyph cache, entries are packed in the arena in offset order
+ */
+static uint32_t glyphCacheArena[ILI9341_GLYPH_CACHE_SIZE / 4];
+static GlyphCacheEntry_s glyphCacheEntries[ILI9341_GLYPH_CACHE_ENTRIES];
+static uint32_t glyphCacheEntryNum;
+static uint32_t glyphCacheClock;
+static ILI9341GlyphCacheStats_s glyphCacheStats;
+#define GLYPH_CACHE_PIXELS ((uint16_t *)glyphCacheArena)
+#define GLYPH_CACHE_CAPACITY (ILI9341_GLYPH_CACHE_SIZE / 4 * 2)
+/**
+ * @brief Identity of a font, the data it draws from
+ */
+static const void *glyphCacheFont(const FontDef_s *font) {
+  return font->bitmap != 0 ? (const void *)font->bitmap : (const void *)font->fontData;
+}
+/**
+ * @brief Look an expanded glyph up
+ * @return expanded pixels, 0 on a miss
+ */
+static const uint16_t *glyphCacheFind(const FontDef_s *font, uint32_t index,
+                                      uint16_t color, uint16_t bgcolor) {
+  const void *key = glyphCacheFont(font);
+  uint32_t i;
+  for (i = 0; i < glyphCacheEntryNum; i++) {
+    GlyphCacheEntry_s *entry = &glyphCacheEntries[i];
+    if (entry->index == index && entry->font == key && entry->color == color && entry->bgcolor == bgcolor) {
+      entry->lastUse = ++glyphCacheClock;
+      glyphCacheStats.hits++;
+      return GLYPH_CACHE_PIXELS + entry->offset;
+    }
+  }
+  glyphCacheStats.misses++;
+  return 0;
+}
+/**
+ * @brief Drop the least recently used glyph and close the gap it leaves
+ * @details Compaction costs a memmove of the glyphs behind it, it only runs on
+ * misses, which expand a glyph anyway
+ */
+static void glyphCacheEvict(void) {
+  uint32_t victim = 0, i, used;
+  GlyphCacheEntry_s *last = &glyphCacheEntries[glyphCacheEntryNum - 1];
+  uint16_t pixelNum;
+  for (i = 1; i < glyphCacheEntryNum; i++)
+    if (glyphCacheEntries[i].lastUse < glyphCacheEntries[victim].lastUse)
+      victim = i;
+  pixelNum = glyphCacheEntries[victim].pixelNum;
+  used = last->offset + last->pixelNum;
+  memmove(GLYPH_CACHE_PIXELS + glyphCacheEntries[victim].offset,
+          GLYPH_CACHE_PIXELS + glyphCacheEntries[victim].offset + pixelNum,
+          (used - glyphCacheEntries[victim].offset - pixelNum) * sizeof(uint16_t));
+  for (i = victim; i + 1 < glyphCacheEntryNum; i++) {
+    glyphCacheEntries[i] = glyphCacheEntries[i + 1];
+    glyphCacheEntries[i].offset -= pixelNum;
+  }
+  glyphCacheEntryNum--;
+  glyphCacheStats.evictions++;
+}
+/**
+ * @brief Reserve room for a glyph, evicting the least recently used ones
+ * @return pixels to expand the glyph into, 0 if it is larger than the cache
+ */
+static uint16_t *glyphCacheInsert(const FontDef_s *font, uint32_t index,
+                                  uint16_t color, uint16_t bgcolor) {
+  uint32_t pixelNum = (uint32_t)font->width * font->height, used;
+  GlyphCacheEntry_s *entry;
+  if (pixelNum > GLYPH_CACHE_CAPACITY)
+    return 0;
+  for (;;) {
+    used = 0;
+    if (glyphCacheEntryNum != 0) {
+      entry = &glyphCacheEntries[glyphCacheEntryNum - 1];
+      used = entry->offset + entry->pixelNum;
+    }
+    if (glyphCacheEntryNum < ILI9341_GLYPH_CACHE_ENTRIES && used + pixelNum <= GLYPH_CACHE_CAPACITY)
+      break;
+    glyphCacheEvict();
+  }
+  entry = &glyphCacheEntries[glyphCacheEntryNum++];
+  entry->font = glyphCacheFont(font);
+  entry->offset = used;
+  entry->lastUse = ++glyphCacheClock;
+  entry->pixelNum = (uint16_t)pixelNum;
+  entry->color = color;
+  entry->bgcolor = bgcolor;
+  entry->index = (uint16_t)index;
+  return GLYPH_CACHE_PIXELS + used;
+}
+#endif
+/**
+ * @brief Draw char on screen
+ * @details With the glyph cache enabled, the expanded glyph is kept and later
+ * draws in the same colors go out in one bulk write
+ * @param x left coordinate of character
+ * @param y top coordinate of character
+ * @param codepoint character to draw
+ * @param font font of character
+ * @param color color of character
+ * @param bgcolor background color of character
+ * @return * void 
+ */
+void drawChar(uint16_t x, uint16_t y, uint32_t codepoint, FontDef_s font,
+              uint16_t color, uint16_t bgcolor){
+  uint32_t i, index = glyphIndex(&font, codepoint);
+  uint16_t row[32];
+  const uint16_t *ramp = 0;
+  GlyphReader_s reader;
+  setAddressWindow(x, y, font.width+x-1, font.height+y-1);
+#if ILI9341_GLYPH_CACHE_SIZE > 0
+  {
+    const uint16_t *cached = glyphCacheFind(&font, index, color, bgcolor);
+    uint16_t *pixels;
+    if(cached != 0) {
+      bulkWritePixelsIntoGraphicsRAM(cached, (uint32_t)font.width * font.height);
+      return;
+    }
+    pixels = glyphCacheInsert(&font, index, color, bgcolor);
+    if(pixels != 0) {
+      glyphBegin(&reader, &font, index);
+      if(font.bpp > 1)
+        ramp = blendRampFor(color, bgcolor, font.bpp);
+      for(i=0; i<font.height; i++)
+        expandGlyphRow(&reader, &font, ramp, pixels + i * font.width, color, bgcolor);
+      bulkWritePixelsIntoGraphicsRAM(pixels, (uint32_t)font.width * font.height);
+      return;
+    }
+  }
+#endif
+  glyphBegin(&reader, &font, index);
+  if(font.bpp > 1)
+    ramp = blendRampFor(color, bgcolor, font.bpp);
+  for(i=0; i<font.height; i++){
+    expandGlyphRow(&reader, &font, ramp, row, color, bgcolor);
+    writePixelsIntoGraphicsRAM(row, font.width);
+  }
+}
+
+void ILI9341GlyphCacheGetStats(ILI9341GlyphCacheStats_s *stats) {
+#if ILI9341_GLYPH_CACHE_SIZE > 0
+  *stats = glyphCacheStats;
+  stats->entries = glyphCacheEntryNum;
+  stats->bytesUsed = 0;
+  if (glyphCacheEntryNum != 0) {
+    GlyphCacheEntry_s *last = &glyphCacheEntries[glyphCacheEntryNum - 1];
+    stats->bytesUsed = (last->offset + last->pixelNum) * sizeof(uint16_t);
+  }
+#else
+  memset(stats, 0, sizeof(*stats));
+#endif
+}
+
+void ILI9341GlyphCacheReset(void) {
+#if ILI9341_GLYPH_CACHE_SIZE > 0
+  glyphCacheEntryNum = 0;
+  glyphCacheClock = 0;
+  memset(&glyphCacheStats, 0, sizeof(glyphCacheStats));
+#endif
+}
+
+/**
+ * @brief Metrics of a proportional glyph
+ * @param font proportional font
+ * @param index glyph number from glyphIndex
+ * @return glyph metrics
+ */
+static const FontGlyph_s *glyphMetrics(const FontDef_s *font, uint32_t index) {
+  return &font->glyphs[index];
+}
+/**
+ * @brief Kerning adjustment of a character pair, binary search in the sorted pairs
+ * @param font proportional font
+ * @param left first character
+ * @param right following character
+ * @return adjustment added to the advance of left
+ */
+static int8_t glyphKerning(const FontDef_s *font, uint32_t left, uint32_t right) {
+  uint32_t low = 0, high = font->kerningNum;
+  uint16_t key = (uint16_t)(left << 8 | right);
+  if (left > 0xFF || right > 0xFF)
+    return 0;
+  while (low < high) {
+    uint32_t middle = (low + high) >> 1;
+    const FontKerning_s *pair = &font->kerning[middle];
+    uint16_t pairKey = (uint16_t)(pair->left << 8 | pair->right);
+    if (pairKey == key)
+      return pair->adjust;
+    if (pairKey < key)
+      low = middle + 1;
+    else
+      high = middle;
+  }
+  return 0;
+}
+/**
+ * @brief Pen movement after a character
+ * @param font font of the character
+ * @param codepoint character
+ * @param next following character, 0 at the end of the string
+ * @return advance in pixels, kerning included
+ */
+int32_t glyphAdvance(const FontDef_s *font, uint32_t codepoint, uint32_t next) {
+  if (font->glyphs == 0)
+    return font->width;
+  return glyphMetrics(font, glyphIndex(font, codepoint))->advance +
+         (next ? glyphKerning(font, codepoint, next) : 0);
+}
+/**
+ * @brief Right edge of the ink of a character, relative to the pen position
+ * @param font font of the character
+ * @param codepoint character
+ * @return rightmost inked column plus one, the cell width for monospace fonts
+ */
+int32_t glyphInkRight(const FontDef_s *font, uint32_t codepoint) {
+  const FontGlyph_s *glyph;
+  if (font->glyphs == 0)
+    return font->width;
+  glyph = glyphMetrics(font, glyphIndex(font, codepoint));
+  return glyph->offsetX + glyph->boxWidth;
+}
+/**
+ * @brief Intersect a rectangle with the clip rectangle, 0 means the screen
+ * @return 1 if something is left
+ */
+static uint8_t clipRectangle(const TextClip_s *clip, TextClip_s *rectangle) {
+  static const TextClip_s screen = {0, 0, ILI9341_WIDTH, ILI9341_HEIGHT};
+  if (clip == 0)
+    clip = &screen;
+  if (rectangle->x0 < clip->x0) rectangle->x0 = clip->x0;
+  if (rectangle->y0 < clip->y0) rectangle->y0 = clip->y0;
+  if (rectangle->x1 > clip->x1) rectangle->x1 = clip->x1;
+  if (rectangle->y1 > clip->y1) rectangle->y1 = clip->y1;
+  return rectangle->x0 < rectangle->x1 && rectangle->y0 < rectangle->y1;
+}
+/**
+ * @brief Compose the ink of one scanline of a proportional line
+ * @param line line buffer, already filled with the background
+ * @param lineWidth width of the line buffer
+ * @param pen position of the first glyph's origin in the line buffer
+ * @param row scanline inside the font height
+ * @param string first character of the line
+ * @param end end of the line in the string
+ * @param font font of the line
+ * @param color color of the characters
+ * @return None
+ */
+static void composeProportionalRow(uint16_t *line, uint32_t lineWidth, int32_t pen, uint32_t row,
+                                   const char *string, const char *end, const FontDef_s *font,
+                                   uint16_t color) {
+  uint32_t j;
+  while (string < end) {
+    uint32_t codepoint = utf8Next(&string), index = glyphIndex(font, codepoint);
+    const FontGlyph_s *glyph = glyphMetrics(font, index);
+    if (row >= glyph->offsetY && row < glyph->offsetY + glyph->boxHeight) {
+      GlyphReader_s reader;
+      int32_t left = pen + glyph->offsetX;
+      uint32_t bits;
+      glyphBegin(&reader, font, index);
+      reader.bit = (row - glyph->offsetY) * glyph->boxWidth;
+      bits = glyphNextRow(&reader, glyph->boxWidth);
+      while (bits != 0) {
+        uint32_t length, start = bitRun(&bits, &length);
+        for (j = start; j < start + length; j++)
+          if (left + (int32_t)j >= 0 && left + j < lineWidth)
+            line[left + j] = color;
+      }
+    }
+    pen += glyphAdvance(font, codepoint, string < end ? utf8Peek(string) : 0);
+  }
+}
+/**
+ * @brief Draw one line of a proportional font
+ * @details Every scanline of the line is composed in a line buffer, so kerned
+ * glyphs can overlap without erasing each other, and the whole line goes out
+ * through a single address window
+ * @param x left coordinate of the line
+ * @param y top coordinate of the line
+ * @param string first character of the line
+ * @param end end of the line in the string
+ * @param width width of the line in pixels
+ * @param font font of the line
+ * @param color color of the characters
+ * @param bgcolor background color of the line
+ * @param clip clip rectangle, 0 for the screen
+ * @return None
+ */
+static void drawProportionalLine(int32_t x, int32_t y, const char *string, const char *end,
+                                 uint32_t width, const FontDef_s *font,
+                                 uint16_t color, uint16_t bgcolor, const TextClip_s *clip) {
+  static uint16_t line[ILI9341_WIDTH];
+  TextClip_s window = {x, y, x + (int32_t)width, y + font->height};
+  uint32_t row, j, windowWidth;
+  if (!clipRectangle(clip, &window))
+    return;
+  windowWidth = (uint32_t)(window.x1 - window.x0);
+  setAddressWindow(window.x0, window.y0, window.x1 - 1, window.y1 - 1);
+  for (row = (uint32_t)(window.y0 - y); row < (uint32_t)(window.y1 - y); row++) {
+    for (j = 0; j < windowWidth; j++)
+      line[j] = bgcolor;
+    composeProportionalRow(line, windowWidth, x - window.x0, row, string, end, font, color);
+    writePixelsIntoGraphicsRAM(line, windowWidth);
+  }
+}
+/**
+ * @brief Draw a monospace character cut by a clip rectangle
+ * @details Rows are still decoded in order, compressed glyphs cannot seek, only
+ * the visible part reaches the bus. Fully visible characters use drawChar
+ * @param x left coordinate of character
+ * @param y top coordinate of character
+ * @param codepoint character to draw
+ * @param font font of character
+ * @param color color of character
+ * @param bgcolor background color of character
+ * @param clip clip rectangle
+ * @return None
+ */
+static void drawCharClipped(int32_t x, int32_t y, uint32_t codepoint, const FontDef_s *font,
+                            uint16_t color, uint16_t bgcolor, const TextClip_s *clip) {
+  TextClip_s window = {x, y, x + font->width, y + font->height};
+  uint16_t row[32];
+  const uint16_t *ramp = 0;
+  GlyphReader_s reader;
+  int32_t i;
+  if (!clipRectangle(clip, &window))
+    return;
+  if (window.x0 == x && window.y0 == y && window.x1 == x + font->width && window.y1 == y + font->height) {
+    drawChar((uint16_t)x, (uint16_t)y, codepoint, *font, color, bgcolor);
+    return;
+  }
+  setAddressWindow(window.x0, window.y0, window.x1 - 1, window.y1 - 1);
+  glyphBegin(&reader, font, glyphIndex(font, codepoint));
+  if (font->bpp > 1)
+    ramp = blendRampFor(color, bgcolor, font->bpp);
+  for (i = y; i < window.y1; i++) {
+    expandGlyphRow(&reader, font, ramp, row, color, bgcolor);
+    if (i >= window.y0)
+      writePixelsIntoGraphicsRAM(row + (window.x0 - x), (uint32_t)(window.x1 - window.x0));
+  }
+}
+/**
+ * @brief Draw a line of text, clipped to a rectangle
+ * @param x left coordinate of the line
+ * @param y top coordinate of the line
+ * @param string first character of the line
+ * @param end end of the line in the string
+ * @param width width of the line in pixels, used by proportional fonts
+ * @param font font of the line
+ * @param color color of the characters
+ * @param bgcolor background color of the line
+ * @param clip clip rectangle, 0 for the screen
+ * @return None
+ */
+void drawTextRun(int32_t x, int32_t y, const char *string, const char *end, uint32_t width,
+                 const FontDef_s *font, uint16_t color, uint16_t bgcolor, const TextClip_s *clip) {
+  if (font->glyphs != 0) {
+    drawProportionalLine(x, y, string, end, width, font, color, bgcolor, clip);
+    return;
+  }
+  while (string < end && (clip == 0 || x < clip->x1)) {
+    drawCharClipped(x, y, utf8Next(&string), font, color, bgcolor, clip);
+    x += font->width;
+  }
+}
+
+void ILI9341DrawString(uint16_t x, uint16_t y, const char *string,
+                        FontDef_s font, uint16_t color, uint16_t bgColor){
+  if(font.glyphs != 0) {
+    /* Proportional fonts are drawn a line at a time, wrapping at the first
+       character that does not fit, as the monospace path does */
+    while(*string) {
+      const char *end = string;
+      uint32_t previous = 0;
+      int32_t width = 0;
+      while(*end) {
+        const char *next = end;
+        uint32_t codepoint = utf8Next(&next);
+        const FontGlyph_s *glyph = glyphMetrics(&font, glyphIndex(&font, codepoint));
+        int32_t kerning = previous ? glyphKerning(&font, previous, codepoint) : 0;
+        if(end != string && x + width + kerning + glyph->offsetX + glyph->boxWidth > ILI9341_WIDTH)
+          break;
+        width += kerning + glyph->advance;
+        previous = codepoint;
+        end = next;
+      }
+      if(x >= ILI9341_WIDTH)
+        width = 0;
+      else if(x + width > ILI9341_WIDTH)
+        width = ILI9341_WIDTH - x;
+      drawProportionalLine(x, y, string, end, (uint32_t)width, &font, color, bgColor, 0);
+      string = end;
+      x = 0;
+      y += font.height;
+      if(y + font.height >= ILI9341_HEIGHT)
+        break;
+      if(*string == ' ')
+        string++;
+    }
+    return;
+  }
+  while(*string) {
+    if(x + font.width >= ILI9341_WIDTH) {
+      x = 0;
+      y += font.height;
+      if(y + font.height >= ILI9341_HEIGHT)
+        break;
+      if(*string == ' ') {
+        string++;
+        continue;
+      }
+    }
+    drawChar(x, y, utf8Next(&string), font, color, bgColor);
+    x += font.width;
+  }
+}
+
+ILI9341Extent_s ILI9341MeasureString(const char *string, FontDef_s font) {
+  ILI9341Extent_s extent = {0, font.height};
+  int32_t width = 0;
+  while (*string) {
+    uint32_t codepoint = utf8Next(&string);
+    width += glyphAdvance(&font, codepoint, utf8Peek(string));
+  }
+  extent.width = width > 0 ? (uint16_t)width : 0;
+  return extent;
+}
+/**
+ * @brief Replicate every pixel of a row scale times
+ */
+static void scaleRow(const uint16_t *source, uint16_t *scaled, uint32_t scaledWidth, uint8_t scale) {
+  uint32_t j = 0;
+  while (j < scaledWidth) {
+    uint16_t pixel = *source++;
+    uint8_t k;
+    for (k = 0; k < scale && j < scaledWidth; k++)
+      scaled[j++] = pixel;
+  }
+}
+/**
+ * @brief Draw a monospace character scaled up through a single window, every
+ * decoded row is widened once and sent scale times
+ * @param height number of screen rows to draw, less than the scaled height at
+ * the bottom of the screen
+ */
+static void drawCharScaled(uint16_t x, uint16_t y, uint32_t codepoint, const FontDef_s *font,
+                           uint8_t scale, uint16_t height, uint16_t color, uint16_t bgcolor) {
+  static uint16_t scaled[32 * ILI9341_TEXT_SCALE_MAX];
+  uint16_t row[32], width = (uint16_t)(font->width * scale);
+  const uint16_t *ramp = 0;
+  GlyphReader_s reader;
+  uint32_t r;
+  uint8_t k;
+  setAddressWindow(x, y, x + width - 1, y + height - 1);
+  glyphBegin(&reader, font, glyphIndex(font, codepoint));
+  if (font->bpp > 1)
+    ramp = blendRampFor(color, bgcolor, font->bpp);
+  for (r = 0; r < height; r += scale) {
+    expandGlyphRow(&reader, font, ramp, row, color, bgcolor);
+    scaleRow(row, scaled, width, scale);
+    for (k = 0; k < scale && r + k < height; k++)
+      writePixelsIntoGraphicsRAM(scaled, width);
+  }
+}
+
+void ILI9341DrawStringScaled(uint16_t x, uint16_t y, const char *string, FontDef_s font,
+                             uint8_t scale, uint16_t color, uint16_t bgColor) {
+  uint32_t height;
+  if (scale <= 1) {
+    ILI9341DrawString(x, y, string, font, color, bgColor);
+    return;
+  }
+  if (scale > ILI9341_TEXT_SCALE_MAX)
+    scale = ILI9341_TEXT_SCALE_MAX;
+  if (x >= ILI9341_WIDTH || y >= ILI9341_HEIGHT)
+    return;
+  height = (uint32_t)font.height * scale;
+  if (y + height > ILI9341_HEIGHT)
+    height = ILI9341_HEIGHT - y;
+  if (font.glyphs != 0) {
+    /* Composed a source scanline at a time and widened, one window for the line */
+    static uint16_t line[ILI9341_WIDTH], scaled[ILI9341_WIDTH];
+    const char *end = string + strlen(string);
+    uint32_t width = ILI9341MeasureString(string, font).width * scale, sourceWidth, row, j;
+    uint8_t k;
+    if (x + width > ILI9341_WIDTH)
+      width = ILI9341_WIDTH - x;
+    if (width == 0)
+      return;
+    sourceWidth = (width + scale - 1) / scale;
+    setAddressWindow(x, y, x + width - 1, y + height - 1);
+    for (row = 0; row * scale < height; row++) {
+      for (j = 0; j < sourceWidth; j++)
+        line[j] = bgColor;
+      composeProportionalRow(line, sourceWidth, 0, row, string, end, &font, color);
+      scaleRow(line, scaled, width, scale);
+      for (k = 0; k < scale && row * scale + k < height; k++)
+        writePixelsIntoGraphicsRAM(scaled, width);
+    }
+    return;
+  }
+  while (*string && x + font.width * scale <= ILI9341_WIDTH) {
+    drawCharScaled(x, y, utf8Next(&string), &font, scale, (uint16_t)height, color, bgColor);
+    x += font.width * scale;
+  }
+}
@@ -0,0 +1,368 @@
+/********************************************************************************************************
+ * @Filename: ILI9341Image.c
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: Image formats of ILI9341 Driver Library, 1-bpp bitmaps, RLE and palette images,
+ *               scaled and rotated images
+ *********************************************************************************************************/
+#include "ILI9341Private.h"
+
+/**
+ * @brief Load up to 32 pixels of a bitmap row
+ * @param row first byte of the pixels
+ * @param count number of pixels, 1 to 32
+ * @return pixel bits, bit 31 is the leftmost pixel
+ */
+static uint32_t loadBitmapBits(const uint8_t *row, uint32_t count) {
+  uint32_t bits = (uint32_t)row[0] << 24, byteNum = (count + 7) >> 3;
+  /* Never read past the row, its last byte may be the last of the bitmap */
+  if (byteNum > 1) bits |= (uint32_t)row[1] << 16;
+  if (byteNum > 2) bits |= (uint32_t)row[2] << 8;
+  if (byteNum > 3) bits |= row[3];
+  return bits;
+}
+/**
+ * @brief Spread an RGB565 pixel into 0b00000gggggg00000rrrrr000000bbbbb,
+ * five free bits above every channel take a weight of up to 32
+ */
+#define SCALE_SPREAD(color) (((uint32_t)(color) | (uint32_t)(color) << 16) & 0x07E0F81FU)
+#define SCALE_PACK(spread) ((uint16_t)(((spread) & 0xF81FU) | ((spread) >> 16 & 0x07E0U)))
+
+/* sin of 0 to 90 degrees in 1/32768 */
+static const uint16_t rotateSine[91] = {
+  0, 572, 1144, 1715, 2286, 2856, 3425, 3993, 4560, 5126, 5690, 6252,
+  6813, 7371, 7927, 8481, 9032, 9580, 10126, 10668, 11207, 11743, 12275, 12803,
+  13328, 13848, 14365, 14876, 15384, 15886, 16384, 16877, 17364, 17847, 18324, 18795,
+  19261, 19720, 20174, 20622, 21063, 21498, 21926, 22348, 22763, 23170, 23571, 23965,
+  24351, 24730, 25102, 25466, 25822, 26170, 26510, 26842, 27166, 27482, 27789, 28088,
+  28378, 28660, 28932, 29197, 29452, 29698, 29935, 30163, 30382, 30592, 30792, 30983,
+  31164, 31336, 31499, 31651, 31795, 31928, 32052, 32166, 32270, 32365, 32449, 32524,
+  32588, 32643, 32688, 32723, 32748, 32763, 32768
+};
+
+/* Output row of ILI9341DrawImageScaled and ILI9341DrawImageRotated */
+static uint16_t scaleLine[ILI9341_WIDTH];
+
+/**
+ * @brief Clip a bitmap to the screen
+ * @return 0 when nothing of it is visible
+ */
+static uint8_t clipBitmap(uint16_t x, uint16_t y, uint16_t *width, uint16_t *height) {
+  if (x >= ILI9341_WIDTH || y >= ILI9341_HEIGHT || *width == 0 || *height == 0)
+    return 0;
+  if (x + (uint32_t)*width > ILI9341_WIDTH)
+    *width = (uint16_t)(ILI9341_WIDTH - x);
+  if (y + (uint32_t)*height > ILI9341_HEIGHT)
+    *height = (uint16_t)(ILI9341_HEIGHT - y);
+  return 1;
+}
+
+void ILI9341DrawBitmap(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                       const uint8_t *bitmap, uint16_t color, uint16_t bgColor) {
+  uint32_t stride = ((uint32_t)width + 7) >> 3, row, column, count;
+  uint16_t pixels[32];
+  if (!clipBitmap(x, y, &width, &height))
+    return;
+  setAddressWindow(x, y, x + width - 1, y + height - 1);
+  for (row = 0; row < height; row++, bitmap += stride) {
+    for (column = 0; column < width; column += count) {
+      count = width - column < 32 ? width - column : 32;
+      expandBits(loadBitmapBits(bitmap + (column >> 3), count), count, pixels, color, bgColor);
+      writePixelsIntoGraphicsRAM(pixels, count);
+    }
+  }
+}
+
+void ILI9341DrawBitmapTransparent(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                                  const uint8_t *bitmap, uint16_t color) {
+  uint32_t stride = ((uint32_t)width + 7) >> 3, row, column, count;
+  if (!clipBitmap(x, y, &width, &height))
+    return;
+  for (row = 0; row < height; row++, bitmap += stride) {
+    /* A run may go on in the next 32 pixels, it is written once it ends */
+    uint32_t spanStart = 0, spanLength = 0;
+    for (column = 0; column < width; column += count) {
+      uint32_t bits;
+      count = width - column < 32 ? width - column : 32;
+      bits = loadBitmapBits(bitmap + (column >> 3), count) & (0xFFFFFFFFU << (32 - count));
+      while (bits != 0) {
+        uint32_t length, start = column + bitRun(&bits, &length);
+        if (spanLength != 0 && spanStart + spanLength == start) {
+          spanLength += length;
+          continue;
+        }
+        if (spanLength != 0) {
+          setAddressWindow(x + spanStart, y + row, x + spanStart + spanLength - 1, y + row);
+          fillGraphicsRAM(color, spanLength);
+        }
+        spanStart = start;
+        spanLength = length;
+      }
+    }
+    if (spanLength != 0) {
+      setAddressWindow(x + spanStart, y + row, x + spanStart + spanLength - 1, y + row);
+      fillGraphicsRAM(color, spanLength);
+    }
+  }
+}
+
+uint8_t ILI9341RleBegin(ILI9341RleStream_s *stream, uint16_t x, uint16_t y,
+                        uint16_t width, uint16_t height) {
+  stream->pixelsLeft = 0;
+  stream->packetLeft = 0;
+  if (width == 0 || height == 0 || x + (uint32_t)width > ILI9341_WIDTH ||
+      y + (uint32_t)height > ILI9341_HEIGHT)
+    return 0;
+  stream->pixelsLeft = (uint32_t)width * height;
+  setAddressWindow(x, y, x + width - 1, y + height - 1);
+  return 1;
+}
+
+uint32_t ILI9341RleFeed(ILI9341RleStream_s *stream, const uint16_t *words, uint32_t wordNum) {
+  const uint16_t *end = words + wordNum;
+  while (words < end && stream->pixelsLeft > 0) {
+    uint32_t count;
+    if (stream->packetLeft == 0) {
+      uint16_t header = *words++;
+      stream->run = (header & ILI9341_RLE_RUN) != 0;
+      stream->haveColor = 0;
+      count = (uint32_t)(header & ILI9341_RLE_COUNT_MASK) + 1;
+      /* A corrupt stream must not write past the window into the next draw */
+      stream->packetLeft = (uint16_t)(count < stream->pixelsLeft ? count : stream->pixelsLeft);
+      continue;
+    }
+    if (stream->run) {
+      if (!stream->haveColor) {
+        stream->color = *words++;
+        stream->haveColor = 1;
+      }
+      count = stream->packetLeft;
+      bulkFillGraphicsRAM(stream->color, count);
+    } else {
+      count = (uint32_t)(end - words) < stream->packetLeft ? (uint32_t)(end - words) : stream->packetLeft;
+      if (count >= ILI9341_BULK_MIN_PIXELS)
+        bulkWritePixelsIntoGraphicsRAM(words, count);
+      else
+        writePixelsIntoGraphicsRAM(words, count);
+      words += count;
+    }
+    stream->packetLeft = (uint16_t)(stream->packetLeft - count);
+    stream->pixelsLeft -= count;
+  }
+  return stream->pixelsLeft;
+}
+
+void ILI9341DrawRleImage(uint16_t x, uint16_t y, const ILI9341RleImage_s *image) {
+  ILI9341RleStream_s stream;
+  if (ILI9341RleBegin(&stream, x, y, image->width, image->height))
+    ILI9341RleFeed(&stream, image->data, image->length);
+}
+
+/**
+ * @brief Write the looked up pixels of a palette image
+ */
+static void writeIndexedPixels(const uint16_t *pixels, uint32_t pixelNum) {
+  if (pixelNum >= ILI9341_BULK_MIN_PIXELS)
+    bulkWritePixelsIntoGraphicsRAM(pixels, pixelNum);
+  else
+    writePixelsIntoGraphicsRAM(pixels, pixelNum);
+}
+
+void ILI9341DrawIndexedImage(uint16_t x, uint16_t y, const ILI9341IndexedImage_s *image) {
+  uint16_t pixels[128], width = image->width, height = image->height;
+  uint32_t bits = image->bits, stride = ((uint32_t)image->width * bits + 7) >> 3;
+  uint32_t mask = (1U << bits) - 1, pixelNum = 0, row, column;
+  const uint8_t *data = image->data;
+  if ((bits != 1 && bits != 2 && bits != 4 && bits != 8) || !clipBitmap(x, y, &width, &height))
+    return;
+  setAddressWindow(x, y, x + width - 1, y + height - 1);
+  for (row = 0; row < height; row++, data += stride) {
+    if (bits == 8) {
+      for (column = 0; column < width; column++) {
+        pixels[pixelNum++] = image->palette[data[column]];
+        if (pixelNum == sizeof(pixels) / sizeof(pixels[0])) {
+          writeIndexedPixels(pixels, pixelNum);
+          pixelNum = 0;
+        }
+      }
+      continue;
+    }
+    for (column = 0; column < width; column++) {
+      uint32_t bit = column * bits;
+      pixels[pixelNum++] = image->palette[(data[bit >> 3] >> (8 - bits - (bit & 7))) & mask];
+      if (pixelNum == sizeof(pixels) / sizeof(pixels[0])) {
+        writeIndexedPixels(pixels, pixelNum);
+        pixelNum = 0;
+      }
+    }
+  }
+  writeIndexedPixels(pixels, pixelNum);
+}
+
+/**
+ * @brief Blend two spread pixels, weight 0 gives a, 32 gives b
+ */
+static inline uint32_t scaleBlend(uint32_t a, uint32_t b, uint32_t weight) {
+  return ((a * (32 - weight) + b * weight) >> 5) & 0x07E0F81FU;
+}
+/**
+ * @brief Sample a row of nearest pixels
+ */
+static void scaleRowNearest(const uint16_t *row, uint32_t u, uint32_t step, uint32_t count) {
+  uint32_t column;
+  for (column = 0; column < count; column++, u += step)
+    scaleLine[column] = row[u >> 16];
+}
+/**
+ * @brief Blend a row between two source rows
+ * @param top upper source row
+ * @param bottom lower source row, top again on the last one
+ * @param u first source position, 16.16 and may be negative on the left edge
+ * @param maxU source position of the last pixel of a row
+ * @param fy vertical weight, 0 to 31
+ */
+static void scaleRowBilinear(const uint16_t *top, const uint16_t *bottom, int32_t u, int32_t maxU, uint32_t step,
+                             uint32_t fy, uint32_t count) {
+  uint32_t column;
+  for (column = 0; column < count; column++, u += (int32_t)step) {
+    int32_t clamped = u < 0 ? 0 : u > maxU ? maxU : u;
+    uint32_t index = (uint32_t)clamped >> 16, fx = ((uint32_t)clamped >> 11) & 31;
+    uint32_t next = clamped < maxU ? index + 1 : index, upper, lower;
+    upper = scaleBlend(SCALE_SPREAD(top[index]), SCALE_SPREAD(top[next]), fx);
+    if (fy != 0) {
+      lower = scaleBlend(SCALE_SPREAD(bottom[index]), SCALE_SPREAD(bottom[next]), fx);
+      upper = scaleBlend(upper, lower, fy);
+    }
+    scaleLine[column] = SCALE_PACK(upper);
+  }
+}
+
+void ILI9341DrawImageScaled(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t *image,
+                            uint16_t scaledWidth, uint16_t scaledHeight, uint8_t filter) {
+  uint32_t stepX, stepY, row, previous = 0xFFFFFFFFU;
+  int32_t v, maxU, maxV;
+  uint16_t visibleWidth = scaledWidth, visibleHeight = scaledHeight;
+  if (width == 0 || height == 0 || !clipBitmap(x, y, &visibleWidth, &visibleHeight))
+    return;
+  stepX = ((uint32_t)width << 16) / scaledWidth;
+  stepY = ((uint32_t)height << 16) / scaledHeight;
+  maxU = (int32_t)(width - 1) << 16;
+  maxV = (int32_t)(height - 1) << 16;
+  setAddressWindow(x, y, x + visibleWidth - 1, y + visibleHeight - 1);
+  /* Pixel centers map to pixel centers, bilinear starts half a pixel left of nearest */
+  v = (int32_t)(stepY >> 1) - (filter == ILI9341_SCALE_BILINEAR ? 0x8000 : 0);
+  for (row = 0; row < visibleHeight; row++, v += (int32_t)stepY) {
+    if (filter == ILI9341_SCALE_BILINEAR) {
+      int32_t clamped = v < 0 ? 0 : v > maxV ? maxV : v;
+      const uint16_t *top = image + ((uint32_t)clamped >> 16) * width;
+      scaleRowBilinear(top, clamped < maxV ? top + width : top, (int32_t)(stepX >> 1) - 0x8000, maxU, stepX,
+                       ((uint32_t)clamped >> 11) & 31, visibleWidth);
+    } else if ((uint32_t)v >> 16 != previous) {
+      previous = (uint32_t)v >> 16;
+      scaleRowNearest(image + previous * width, stepX >> 1, stepX, visibleWidth);
+    }
+    if (visibleWidth >= ILI9341_BULK_MIN_PIXELS)
+      bulkWritePixelsIntoGraphicsRAM(scaleLine, visibleWidth);
+    else
+      writePixelsIntoGraphicsRAM(scaleLine, visibleWidth);
+  }
+}
+
+/**
+ * @brief sin of an angle in tenths of a degree, 16.16, whole degrees from the
+ * table and tenths in between interpolated
+ */
+static int32_t rotateSin(int32_t angle) {
+  int32_t quarter, rest, value;
+  angle %= 3600;
+  if (angle < 0)
+    angle += 3600;
+  quarter = angle / 900;
+  rest = quarter & 1 ? 900 - angle % 900 : angle % 900;
+  value = rotateSine[rest / 10] * 2;
+  if (rest % 10 != 0)
+    value += (rotateSine[rest / 10 + 1] - rotateSine[rest / 10]) * 2 * (rest % 10) / 10;
+  return quarter >= 2 ? -value : value;
+}
+/**
+ * @brief Floor of a / b for any signs
+ */
+static inline int64_t rotateFloorDiv(int64_t a, int64_t b) {
+  int64_t quotient = a / b;
+  return quotient - (a % b != 0 && (a < 0) != (b < 0));
+}
+/**
+ * @brief Narrow [first, last] to the columns where start + column * step lies in [0, limit]
+ */
+static void rotateSpan(int64_t start, int32_t step, int64_t limit, int32_t *first, int32_t *last) {
+  int64_t low, high;
+  if (step == 0) {
+    if (start < 0 || start > limit)
+      *last = *first - 1;
+    return;
+  }
+  low = step > 0 ? -rotateFloorDiv(start, step) : -rotateFloorDiv(start - limit, step);
+  high = step > 0 ? rotateFloorDiv(limit - start, step) : rotateFloorDiv(-start, step);
+  if (low > *first)
+    *first = low > *last ? *last + 1 : (int32_t)low;
+  if (high < *last)
+    *last = high < *first ? *first - 1 : (int32_t)high;
+}
+/**
+ * @brief Write a generated span of a rotated image, from column on
+ */
+static void rotateWrite(int32_t column, int32_t row, uint32_t count) {
+  setAddressWindow((uint16_t)column, (uint16_t)row, (uint16_t)(column + count - 1), (uint16_t)row);
+  if (count >= ILI9341_BULK_MIN_PIXELS)
+    bulkWritePixelsIntoGraphicsRAM(scaleLine, count);
+  else
+    writePixelsIntoGraphicsRAM(scaleLine, count);
+}
+
+void ILI9341DrawImageRotated(int16_t x, int16_t y, uint16_t width, uint16_t height, const uint16_t *image,
+                             int16_t pivotX, int16_t pivotY, int32_t angle, uint16_t zoom, uint32_t key) {
+  int32_t sine = rotateSin(angle), cosine = rotateSin(angle + 900), corner, top = 0x7FFFFFFF, bottom = -top;
+  int32_t row, dudx, dvdx, dudy, dvdy;
+  int64_t limitU = ((int64_t)width << 16) - 1, limitV = ((int64_t)height << 16) - 1;
+  if (width == 0 || height == 0 || width >= 16384 || height >= 16384 || zoom == 0)
+    return;
+  /* Screen steps through the image, the inverse rotation shrunk by the zoom */
+  dudx = cosine * 256 / zoom;
+  dvdx = -sine * 256 / zoom;
+  dudy = sine * 256 / zoom;
+  dvdy = cosine * 256 / zoom;
+  /* Rows of the bounding box of the four image corners, spans do the rest */
+  for (corner = 0; corner < 4; corner++) {
+    int64_t u = (corner & 1 ? (int64_t)(width - pivotX) << 16 : -((int64_t)pivotX << 16)) - 0x8000;
+    int64_t v = (corner & 2 ? (int64_t)(height - pivotY) << 16 : -((int64_t)pivotY << 16)) - 0x8000;
+    int64_t screenY = y + (((u * sine + v * cosine) >> 16) * zoom >> 24);
+    if (screenY - 1 < top)
+      top = (int32_t)(screenY - 1 < -1 ? -1 : screenY - 1);
+    if (screenY + 1 > bottom)
+      bottom = (int32_t)(screenY + 1 > ILI9341_HEIGHT ? ILI9341_HEIGHT : screenY + 1);
+  }
+  for (row = top < 0 ? 0 : top; row <= bottom && row < ILI9341_HEIGHT; row++) {
+    /* Image position of column 0, pixel centers map to pixel centers */
+    int64_t rowU = ((int64_t)pivotX << 16) + 0x8000 - (int64_t)x * dudx + (int64_t)(row - y) * dudy;
+    int64_t rowV = ((int64_t)pivotY << 16) + 0x8000 - (int64_t)x * dvdx + (int64_t)(row - y) * dvdy;
+    int32_t first = 0, last = ILI9341_WIDTH - 1, column, u, v;
+    uint32_t count = 0;
+    rotateSpan(rowU, dudx, limitU, &first, &last);
+    rotateSpan(rowV, dvdx, limitV, &first, &last);
+    u = (int32_t)(rowU + (int64_t)first * dudx);
+    v = (int32_t)(rowV + (int64_t)first * dvdx);
+    for (column = first; column <= last; column++, u += dudx, v += dvdx) {
+      uint16_t color = image[(uint32_t)(v >> 16) * width + (uint32_t)(u >> 16)];
+      if (color == key) {
+        if (count != 0)
+          rotateWrite(column - (int32_t)count, row, count);
+        count = 0;
+        continue;
+      }
+      scaleLine[count++] = color;
+    }
+    if (count != 0)
+      rotateWrite(column - (int32_t)count, row, count);
+  }
+}
@@ -0,0 +1,707 @@
+/********************************************************************************************************
+ * @Filename: ILI9341Jpeg.c
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: Baseline JPEG decoder of ILI9341 Driver Library, MCU rows streamed into strips
+ *********************************************************************************************************/
+#include "ILI9341Private.h"
+#include <string.h>
+
+#if ILI9341_JPEG_STRIP_PIXELS < 256
+#error "ILI9341_JPEG_STRIP_PIXELS must hold one 16x16 MCU"
+#endif
+
+#define JPEG_SOF0 0xC0
+#define JPEG_SOF1 0xC1
+#define JPEG_DHT  0xC4
+#define JPEG_RST0 0xD0
+#define JPEG_RST7 0xD7
+#define JPEG_SOI  0xD8
+#define JPEG_EOI  0xD9
+#define JPEG_SOS  0xDA
+#define JPEG_DQT  0xDB
+#define JPEG_DRI  0xDD
+/* Fixed-point constants of the IDCT, 13 fraction bits */
+#define IDCT_CONST_BITS 13
+#define IDCT_PASS1_BITS 2
+/* Arithmetic shift of a wrapped IDCT sum, with rounding */
+#define IDCT_DESCALE(v, bits) ((int32_t)((v) + (1U << ((bits) - 1))) >> (bits))
+#define FIX_0_298631336 2446
+#define FIX_0_390180644 3196
+#define FIX_0_541196100 4433
+#define FIX_0_765366865 6270
+#define FIX_0_899976223 7373
+#define FIX_1_175875602 9633
+#define FIX_1_501321110 12299
+#define FIX_1_847759065 15137
+#define FIX_1_961570560 16069
+#define FIX_2_053119869 16819
+#define FIX_2_562915447 20995
+#define FIX_3_072711026 25172
+
+static ILI9341JpegDecoder_s jpegDecoder;
+
+/* Natural order position of each coefficient of the zigzag order */
+static const uint8_t jpegZigzag[64] = {
+   0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+  12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+  35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+  58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63
+};
+/*
+ * Basis of the reduced IDCTs, round(8192 * c(u) / 2 * cos((2x + 1) * u * pi / (2 * N)))
+ * at [x][u]. The low N x N coefficients of an 8x8 block through an N-point
+ * IDCT give the block scaled by N/8
+ */
+static const int16_t jpegIdct4[4][4] = {
+  {2896,  3784,  2896,  1567},
+  {2896,  1567, -2896, -3784},
+  {2896, -1567, -2896,  3784},
+  {2896, -3784,  2896, -1567}
+};
+static const int16_t jpegIdct2[2][2] = {
+  {2896,  2896},
+  {2896, -2896}
+};
+
+static inline uint8_t jpegClamp(int32_t value) {
+  if ((uint32_t)value > 255)
+    return value < 0 ? 0 : 255;
+  return (uint8_t)value;
+}
+/**
+ * @brief Dequantized coefficient, limited to the int16_t block
+ */
+static inline int16_t jpegDequantize(int32_t value, uint32_t quant) {
+  value *= (int32_t)quant;
+  if (value > 32767)
+    return 32767;
+  return (int16_t)(value < -32767 ? -32767 : value);
+}
+/**
+ * @brief Refill the input from the read callback
+ * @return 0 at the end of the file
+ */
+static uint8_t jpegRefill(ILI9341JpegDecoder_s *decoder) {
+  uint32_t size;
+  if (decoder->read == NULL)
+    return 0;
+  size = decoder->read(decoder->context, decoder->input, sizeof(decoder->input));
+  if (size > sizeof(decoder->input))
+    size = 0;
+  decoder->next = decoder->input;
+  decoder->end = decoder->input + size;
+  return size != 0;
+}
+/**
+ * @brief Next byte of the file, -1 at its end
+ */
+static inline int32_t jpegByte(ILI9341JpegDecoder_s *decoder) {
+  if (decoder->next == decoder->end && !jpegRefill(decoder))
+    return -1;
+  return *decoder->next++;
+}
+
+static int32_t jpegWord(ILI9341JpegDecoder_s *decoder) {
+  int32_t high = jpegByte(decoder), low = jpegByte(decoder);
+  return high < 0 || low < 0 ? -1 : high << 8 | low;
+}
+/**
+ * @brief Top up the bit buffer to at least 25 bits
+ * @details Stuffed 0xFF 0x00 pairs become 0xFF. A marker ends the entropy
+ * coded data, it is kept in decoder->marker and zeros are fed after it
+ */
+static void jpegFill(ILI9341JpegDecoder_s *decoder) {
+  while (decoder->bitCount <= 24) {
+    int32_t byte = 0;
+    if (decoder->marker == 0) {
+      byte = jpegByte(decoder);
+      if (byte == 0xFF) {
+        do
+          byte = jpegByte(decoder);
+        while (byte == 0xFF);
+        if (byte == 0) {
+          byte = 0xFF;
+        } else if (byte > 0) {
+          decoder->marker = (uint8_t)byte;
+          byte = 0;
+        }
+      }
+      if (byte < 0) {
+        decoder->marker = JPEG_EOI;
+        if (decoder->status == ILI9341_JPEG_OK)
+          decoder->status = ILI9341_JPEG_TRUNCATED;
+        byte = 0;
+      }
+    }
+    decoder->bits |= (uint32_t)byte << (24 - decoder->bitCount);
+    decoder->bitCount += 8;
+  }
+}
+
+static inline uint32_t jpegBits(ILI9341JpegDecoder_s *decoder, uint32_t count) {
+  uint32_t value;
+  if (decoder->bitCount < count)
+    jpegFill(decoder);
+  value = decoder->bits >> (32 - count);
+  decoder->bits <<= count;
+  decoder->bitCount -= count;
+  return value;
+}
+/**
+ * @brief Value of a coefficient from its magnitude category and extra bits
+ */
+static inline int32_t jpegExtend(uint32_t value, uint32_t size) {
+  return value < (1U << (size - 1)) ? (int32_t)value - (1 << size) + 1 : (int32_t)value;
+}
+/**
+ * @brief Decode one Huffman symbol
+ * @details Codes up to 8 bits take one lookup, longer ones search maxCode
+ */
+static uint32_t jpegHuffman(ILI9341JpegDecoder_s *decoder, const ILI9341JpegHuffman_s *table) {
+  uint32_t entry, length;
+  if (decoder->bitCount < 16)
+    jpegFill(decoder);
+  entry = table->lookup[decoder->bits >> 24];
+  if (entry != 0) {
+    length = entry >> 8;
+    decoder->bits <<= length;
+    decoder->bitCount -= length;
+    return entry & 0xFF;
+  }
+  for (length = 9; length <= 16; length++) {
+    int32_t code = (int32_t)(decoder->bits >> (32 - length));
+    if (code <= table->maxCode[length]) {
+      decoder->bits <<= length;
+      decoder->bitCount -= length;
+      return table->values[(code + table->valueOffset[length]) & 0xFF];
+    }
+  }
+  decoder->status = ILI9341_JPEG_ERROR;
+  decoder->bits <<= 16;
+  decoder->bitCount -= 16;
+  return 0;
+}
+/**
+ * @brief Decode the coefficients of one block into decoder->block, dequantized
+ */
+static void jpegDecodeBlock(ILI9341JpegDecoder_s *decoder, ILI9341JpegComponent_s *component) {
+  const ILI9341JpegHuffman_s *ac = &decoder->huffman[2 + component->ac];
+  const uint16_t *quant = decoder->quant[component->quant];
+  int16_t *block = decoder->block;
+  uint32_t size, k;
+  memset(block, 0, sizeof(decoder->block));
+  size = jpegHuffman(decoder, &decoder->huffman[component->dc]);
+  if (size > 11)
+    size = 0;
+  if (size != 0)
+    component->prediction = (int16_t)(component->prediction + jpegExtend(jpegBits(decoder, size), size));
+  block[0] = jpegDequantize(component->prediction, quant[0]);
+  for (k = 1; k < 64; k++) {
+    uint32_t symbol = jpegHuffman(decoder, ac);
+    size = symbol & 0x0F;
+    if (size == 0) {
+      if (symbol != 0xF0)
+        break;
+      k += 15;
+      continue;
+    }
+    k += symbol >> 4;
+    if (k > 63)
+      break;
+    block[jpegZigzag[k]] = jpegDequantize(jpegExtend(jpegBits(decoder, size), size), quant[k]);
+  }
+}
+/**
+ * @brief Integer 8x8 IDCT, the Loeffler-Ligtenberg-Moschytz factorization
+ * with 12 multiplications per pass
+ * @details Valid coefficients never leave 32 bits, corrupt ones may, so the
+ * sums wrap as unsigned values and only the descaled results are signed
+ */
+static void jpegIdct8(const int16_t *block, uint8_t *out, uint32_t stride) {
+  int32_t work[64], *row;
+  uint32_t tmp0, tmp1, tmp2, tmp3, tmp10, tmp11, tmp12, tmp13, z1, z2, z3, z4, z5;
+  uint32_t i;
+  /* Columns into work, scaled up by PASS1_BITS */
+  for (i = 0; i < 8; i++) {
+    const int16_t *in = block + i;
+    int32_t *column = work + i;
+    if ((in[8] | in[16] | in[24] | in[32] | in[40] | in[48] | in[56]) == 0) {
+      int32_t dc = (int32_t)in[0] * (1 << IDCT_PASS1_BITS);
+      column[0] = column[8] = column[16] = column[24] = dc;
+      column[32] = column[40] = column[48] = column[56] = dc;
+      continue;
+    }
+    z2 = (uint32_t)in[16];
+    z3 = (uint32_t)in[48];
+    z1 = (z2 + z3) * FIX_0_541196100;
+    tmp2 = z1 - z3 * FIX_1_847759065;
+    tmp3 = z1 + z2 * FIX_0_765366865;
+    tmp0 = (uint32_t)(in[0] + in[32]) << IDCT_CONST_BITS;
+    tmp1 = (uint32_t)(in[0] - in[32]) << IDCT_CONST_BITS;
+    tmp10 = tmp0 + tmp3;
+    tmp13 = tmp0 - tmp3;
+    tmp11 = tmp1 + tmp2;
+    tmp12 = tmp1 - tmp2;
+    tmp0 = (uint32_t)in[56];
+    tmp1 = (uint32_t)in[40];
+    tmp2 = (uint32_t)in[24];
+    tmp3 = (uint32_t)in[8];
+    z1 = tmp0 + tmp3;
+    z2 = tmp1 + tmp2;
+    z3 = tmp0 + tmp2;
+    z4 = tmp1 + tmp3;
+    z5 = (z3 + z4) * FIX_1_175875602;
+    tmp0 *= FIX_0_298631336;
+    tmp1 *= FIX_2_053119869;
+    tmp2 *= FIX_3_072711026;
+    tmp3 *= FIX_1_501321110;
+    z1 *= 0U - FIX_0_899976223;
+    z2 *= 0U - FIX_2_562915447;
+    z3 = z3 * (0U - FIX_1_961570560) + z5;
+    z4 = z4 * (0U - FIX_0_390180644) + z5;
+    tmp0 += z1 + z3;
+    tmp1 += z2 + z4;
+    tmp2 += z2 + z3;
+    tmp3 += z1 + z4;
+#define IDCT_PASS1(v) IDCT_DESCALE(v, IDCT_CONST_BITS - IDCT_PASS1_BITS)
+    column[0] = IDCT_PASS1(tmp10 + tmp3);
+    column[56] = IDCT_PASS1(tmp10 - tmp3);
+    column[8] = IDCT_PASS1(tmp11 + tmp2);
+    column[48] = IDCT_PASS1(tmp11 - tmp2);
+    column[16] = IDCT_PASS1(tmp12 + tmp1);
+    column[40] = IDCT_PASS1(tmp12 - tmp1);
+    column[24] = IDCT_PASS1(tmp13 + tmp0);
+    column[32] = IDCT_PASS1(tmp13 - tmp0);
+#undef IDCT_PASS1
+  }
+  /* Rows into samples, the 8 of the 2-D IDCT and the level shift of 128 applied */
+  for (i = 0, row = work; i < 8; i++, row += 8, out += stride) {
+    z2 = (uint32_t)row[2];
+    z3 = (uint32_t)row[6];
+    z1 = (z2 + z3) * FIX_0_541196100;
+    tmp2 = z1 - z3 * FIX_1_847759065;
+    tmp3 = z1 + z2 * FIX_0_765366865;
+    tmp0 = ((uint32_t)row[0] + (uint32_t)row[4]) << IDCT_CONST_BITS;
+    tmp1 = ((uint32_t)row[0] - (uint32_t)row[4]) << IDCT_CONST_BITS;
+    tmp10 = tmp0 + tmp3;
+    tmp13 = tmp0 - tmp3;
+    tmp11 = tmp1 + tmp2;
+    tmp12 = tmp1 - tmp2;
+    tmp0 = (uint32_t)row[7];
+    tmp1 = (uint32_t)row[5];
+    tmp2 = (uint32_t)row[3];
+    tmp3 = (uint32_t)row[1];
+    z1 = tmp0 + tmp3;
+    z2 = tmp1 + tmp2;
+    z3 = tmp0 + tmp2;
+    z4 = tmp1 + tmp3;
+    z5 = (z3 + z4) * FIX_1_175875602;
+    tmp0 *= FIX_0_298631336;
+    tmp1 *= FIX_2_053119869;
+    tmp2 *= FIX_3_072711026;
+    tmp3 *= FIX_1_501321110;
+    z1 *= 0U - FIX_0_899976223;
+    z2 *= 0U - FIX_2_562915447;
+    z3 = z3 * (0U - FIX_1_961570560) + z5;
+    z4 = z4 * (0U - FIX_0_390180644) + z5;
+    tmp0 += z1 + z3;
+    tmp1 += z2 + z4;
+    tmp2 += z2 + z3;
+    tmp3 += z1 + z4;
+#define IDCT_PASS2(v) jpegClamp(IDCT_DESCALE(v, IDCT_CONST_BITS + IDCT_PASS1_BITS + 3) + 128)
+    out[0] = IDCT_PASS2(tmp10 + tmp3);
+    out[7] = IDCT_PASS2(tmp10 - tmp3);
+    out[1] = IDCT_PASS2(tmp11 + tmp2);
+    out[6] = IDCT_PASS2(tmp11 - tmp2);
+    out[2] = IDCT_PASS2(tmp12 + tmp1);
+    out[5] = IDCT_PASS2(tmp12 - tmp1);
+    out[3] = IDCT_PASS2(tmp13 + tmp0);
+    out[4] = IDCT_PASS2(tmp13 - tmp0);
+#undef IDCT_PASS2
+  }
+}
+/**
+ * @brief N-point IDCT of the low N x N coefficients, N = 4 or 2, an N x N
+ * block of samples
+ */
+static void jpegIdctReduced(const int16_t *block, const int16_t *basis, uint32_t n,
+                            uint8_t *out, uint32_t stride) {
+  int32_t work[16];
+  uint32_t x, y, u;
+  for (y = 0; y < n; y++) {
+    for (u = 0; u < n; u++) {
+      uint32_t sum = 0;
+      for (x = 0; x < n; x++)
+        sum += (uint32_t)(block[x * 8 + u] * basis[y * n + x]);
+      work[y * n + u] = IDCT_DESCALE(sum, IDCT_CONST_BITS - IDCT_PASS1_BITS);
+    }
+  }
+  for (y = 0; y < n; y++, out += stride) {
+    for (x = 0; x < n; x++) {
+      uint32_t sum = 0;
+      for (u = 0; u < n; u++)
+        sum += (uint32_t)work[y * n + u] * (uint32_t)basis[x * n + u];
+      out[x] = jpegClamp(IDCT_DESCALE(sum, IDCT_CONST_BITS + IDCT_PASS1_BITS) + 128);
+    }
+  }
+}
+/**
+ * @brief Samples of the block in decoder->block at the output scale
+ */
+static void jpegIdct(const ILI9341JpegDecoder_s *decoder, uint32_t scale, uint8_t *out, uint32_t stride) {
+  if (scale == ILI9341_JPEG_SCALE_1)
+    jpegIdct8(decoder->block, out, stride);
+  else if (scale == ILI9341_JPEG_SCALE_2)
+    jpegIdctReduced(decoder->block, &jpegIdct4[0][0], 4, out, stride);
+  else if (scale == ILI9341_JPEG_SCALE_4)
+    jpegIdctReduced(decoder->block, &jpegIdct2[0][0], 2, out, stride);
+  else
+    out[0] = jpegClamp(((decoder->block[0] + 4) >> 3) + 128);
+}
+/**
+ * @brief Convert the samples of one MCU to RGB565 in the strip
+ * @param decoder decoder state
+ * @param n block size at the output scale
+ * @param strip first pixel of the MCU in the strip
+ * @param stride pixels per strip row
+ * @param width visible columns of the MCU
+ * @param height visible rows of the MCU
+ */
+static void jpegConvert(const ILI9341JpegDecoder_s *decoder, uint32_t n, uint16_t *strip, uint32_t stride,
+                        uint32_t width, uint32_t height) {
+  uint32_t lumaStride = decoder->hMax * n, hShift = decoder->hMax - 1, vShift = decoder->vMax - 1;
+  uint32_t row, column;
+  for (row = 0; row < height; row++, strip += stride) {
+    const uint8_t *luma = decoder->luma + row * lumaStride;
+    if (decoder->componentNum == 1) {
+      for (column = 0; column < width; column++)
+        strip[column] = (uint16_t)((luma[column] & 0xF8) << 8 | (luma[column] & 0xFC) << 3 | luma[column] >> 3);
+      continue;
+    }
+    const uint8_t *cb = decoder->chroma[0] + (row >> vShift) * n;
+    const uint8_t *cr = decoder->chroma[1] + (row >> vShift) * n;
+    /* One chroma sample serves 1 << hShift pixels of the row */
+    for (column = 0; column < width; column += 1U << hShift) {
+      int32_t blue = cb[column >> hShift] - 128, red = cr[column >> hShift] - 128;
+      int32_t redAdd = (91881 * red + 32768) >> 16;
+      int32_t greenAdd = (-22554 * blue - 46802 * red + 32768) >> 16;
+      int32_t blueAdd = (116130 * blue + 32768) >> 16;
+      uint32_t pixel, last = column + (1U << hShift) < width ? column + (1U << hShift) : width;
+      for (pixel = column; pixel < last; pixel++) {
+        int32_t y = luma[pixel];
+        strip[pixel] = (uint16_t)((jpegClamp(y + redAdd) & 0xF8) << 8 | (jpegClamp(y + greenAdd) & 0xFC) << 3 |
+                                  jpegClamp(y + blueAdd) >> 3);
+      }
+    }
+  }
+}
+/**
+ * @brief Skip to a restart marker and reset the DC predictions
+ */
+static void jpegRestart(ILI9341JpegDecoder_s *decoder) {
+  uint32_t i;
+  decoder->bits = 0;
+  decoder->bitCount = 0;
+  while (decoder->marker == 0) {
+    int32_t byte = jpegByte(decoder);
+    if (byte < 0) {
+      decoder->marker = JPEG_EOI;
+    } else if (byte == 0xFF) {
+      do
+        byte = jpegByte(decoder);
+      while (byte == 0xFF);
+      if (byte != 0)
+        decoder->marker = byte < 0 ? JPEG_EOI : (uint8_t)byte;
+    }
+  }
+  /* A missing restart marker leaves the rest of the image as it decodes */
+  if (decoder->marker >= JPEG_RST0 && decoder->marker <= JPEG_RST7)
+    decoder->marker = 0;
+  for (i = 0; i < decoder->componentNum; i++)
+    decoder->component[i].prediction = 0;
+}
+
+static uint8_t jpegReadDqt(ILI9341JpegDecoder_s *decoder, int32_t length) {
+  while (length > 0) {
+    int32_t info = jpegByte(decoder), k;
+    uint16_t *quant;
+    if (info < 0)
+      return ILI9341_JPEG_TRUNCATED;
+    if ((info >> 4) > 1)
+      return ILI9341_JPEG_ERROR;
+    quant = decoder->quant[info & 3];
+    for (k = 0; k < 64; k++) {
+      int32_t value = info >> 4 ? jpegWord(decoder) : jpegByte(decoder);
+      if (value < 0)
+        return ILI9341_JPEG_TRUNCATED;
+      quant[k] = (uint16_t)value;
+    }
+    length -= info >> 4 ? 129 : 65;
+  }
+  return ILI9341_JPEG_OK;
+}
+
+static uint8_t jpegReadDht(ILI9341JpegDecoder_s *decoder, int32_t length) {
+  while (length > 0) {
+    int32_t info = jpegByte(decoder), total = 0, code = 0, k = 0;
+    uint8_t counts[17];
+    uint32_t bits, i;
+    ILI9341JpegHuffman_s *table;
+    if (info < 0)
+      return ILI9341_JPEG_TRUNCATED;
+    if ((info >> 4) > 1 || (info & 0x0F) > 1)
+      return ILI9341_JPEG_UNSUPPORTED;
+    table = &decoder->huffman[(info >> 4) * 2 + (info & 1)];
+    for (bits = 1; bits <= 16; bits++) {
+      int32_t count = jpegByte(decoder);
+      if (count < 0)
+        return ILI9341_JPEG_TRUNCATED;
+      counts[bits] = (uint8_t)count;
+      total += count;
+    }
+    if (total > 256)
+      return ILI9341_JPEG_ERROR;
+    for (i = 0; i < (uint32_t)total; i++) {
+      int32_t value = jpegByte(decoder);
+      if (value < 0)
+        return ILI9341_JPEG_TRUNCATED;
+      table->values[i] = (uint8_t)value;
+    }
+    /* Canonical codes, the short ones also fill every lookup entry they prefix */
+    memset(table->lookup, 0, sizeof(table->lookup));
+    for (bits = 1; bits <= 16; bits++) {
+      table->valueOffset[bits] = (int16_t)(k - code);
+      if (code + counts[bits] > 1 << bits)
+        return ILI9341_JPEG_ERROR;
+      for (i = 0; i < counts[bits]; i++, code++, k++) {
+        if (bits <= 8) {
+          uint32_t fill;
+          for (fill = 0; fill < 1U << (8 - bits); fill++)
+            table->lookup[(uint32_t)code << (8 - bits) | fill] = (uint16_t)(bits << 8 | table->values[k]);
+        }
+      }
+      table->maxCode[bits] = counts[bits] ? code - 1 : -1;
+      code <<= 1;
+    }
+    length -= 17 + total;
+  }
+  return ILI9341_JPEG_OK;
+}
+
+static uint8_t jpegReadSof(ILI9341JpegDecoder_s *decoder) {
+  int32_t precision = jpegByte(decoder), height = jpegWord(decoder), width = jpegWord(decoder);
+  int32_t count = jpegByte(decoder);
+  uint32_t i;
+  if (count < 0)
+    return ILI9341_JPEG_TRUNCATED;
+  if (precision != 8 || (count != 1 && count != 3))
+    return ILI9341_JPEG_UNSUPPORTED;
+  if (width == 0 || height == 0)
+    return ILI9341_JPEG_ERROR;
+  decoder->width = (uint16_t)width;
+  decoder->height = (uint16_t)height;
+  decoder->componentNum = (uint8_t)count;
+  decoder->hMax = 1;
+  decoder->vMax = 1;
+  for (i = 0; i < (uint32_t)count; i++) {
+    ILI9341JpegComponent_s *component = &decoder->component[i];
+    int32_t id = jpegByte(decoder), sampling = jpegByte(decoder), quant = jpegByte(decoder);
+    if (quant < 0)
+      return ILI9341_JPEG_TRUNCATED;
+    component->id = (uint8_t)id;
+    component->h = (uint8_t)(sampling >> 4);
+    component->v = (uint8_t)(sampling & 0x0F);
+    component->quant = (uint8_t)(quant & 3);
+    /* A single component is one block per MCU whatever its sampling */
+    if (count == 1)
+      component->h = component->v = 1;
+    /* Luma at 1x1, 2x1, 1x2 or 2x2, chroma at 1x1 */
+    if (component->h < 1 || component->h > 2 || component->v < 1 || component->v > 2 ||
+        (i > 0 && (component->h != 1 || component->v != 1)))
+      return ILI9341_JPEG_UNSUPPORTED;
+  }
+  decoder->hMax = decoder->component[0].h;
+  decoder->vMax = decoder->component[0].v;
+  return ILI9341_JPEG_OK;
+}
+
+static uint8_t jpegReadSos(ILI9341JpegDecoder_s *decoder) {
+  int32_t count = jpegByte(decoder);
+  uint32_t i, j;
+  if (count < 0)
+    return ILI9341_JPEG_TRUNCATED;
+  if (decoder->componentNum == 0)
+    return ILI9341_JPEG_ERROR;
+  /* Only one interleaved scan of every component */
+  if (count != decoder->componentNum)
+    return ILI9341_JPEG_UNSUPPORTED;
+  for (i = 0; i < (uint32_t)count; i++) {
+    int32_t id = jpegByte(decoder), tables = jpegByte(decoder);
+    if (tables < 0)
+      return ILI9341_JPEG_TRUNCATED;
+    for (j = 0; j < decoder->componentNum && decoder->component[j].id != id; j++)
+      ;
+    if (j != i)
+      return ILI9341_JPEG_UNSUPPORTED;
+    decoder->component[i].dc = (uint8_t)((tables >> 4) & 1);
+    decoder->component[i].ac = (uint8_t)(tables & 1);
+    decoder->component[i].prediction = 0;
+  }
+  /* Spectral selection and successive approximation, fixed in baseline */
+  jpegByte(decoder);
+  jpegByte(decoder);
+  return jpegByte(decoder) < 0 ? ILI9341_JPEG_TRUNCATED : ILI9341_JPEG_OK;
+}
+
+/**
+ * @brief Read the markers up to the start of the scan
+ */
+static uint8_t jpegReadHeaders(ILI9341JpegDecoder_s *decoder) {
+  uint8_t haveFrame = 0;
+  if (jpegByte(decoder) != 0xFF || jpegByte(decoder) != JPEG_SOI)
+    return ILI9341_JPEG_ERROR;
+  for (;;) {
+    int32_t marker = jpegByte(decoder), length;
+    uint8_t result = ILI9341_JPEG_OK;
+    if (marker < 0)
+      return ILI9341_JPEG_TRUNCATED;
+    if (marker != 0xFF)
+      return ILI9341_JPEG_ERROR;
+    do
+      marker = jpegByte(decoder);
+    while (marker == 0xFF);
+    if (marker == JPEG_SOS) {
+      if (jpegWord(decoder) < 0)
+        return ILI9341_JPEG_TRUNCATED;
+      result = haveFrame ? jpegReadSos(decoder) : ILI9341_JPEG_ERROR;
+      decoder->bits = 0;
+      decoder->bitCount = 0;
+      decoder->marker = 0;
+      return result;
+    }
+    length = jpegWord(decoder);
+    if (marker < 0 || length < 0)
+      return ILI9341_JPEG_TRUNCATED;
+    if (length < 2)
+      return ILI9341_JPEG_ERROR;
+    length -= 2;
+    if (marker == JPEG_SOF0 || marker == JPEG_SOF1) {
+      result = jpegReadSof(decoder);
+      haveFrame = 1;
+    } else if ((marker & 0xF0) == 0xC0 && marker != JPEG_DHT && marker != 0xC8 && marker != 0xCC) {
+      /* Progressive, lossless, hierarchical and arithmetic coded frames */
+      return ILI9341_JPEG_UNSUPPORTED;
+    } else if (marker == JPEG_DHT) {
+      result = jpegReadDht(decoder, length);
+    } else if (marker == JPEG_DQT) {
+      result = jpegReadDqt(decoder, length);
+    } else if (marker == JPEG_DRI) {
+      int32_t interval = jpegWord(decoder);
+      if (interval < 0)
+        return ILI9341_JPEG_TRUNCATED;
+      decoder->restartInterval = (uint16_t)interval;
+    } else if (marker == JPEG_EOI) {
+      return ILI9341_JPEG_ERROR;
+    } else {
+      /* APPn, comments and the like */
+      while (length-- > 0)
+        if (jpegByte(decoder) < 0)
+          return ILI9341_JPEG_TRUNCATED;
+    }
+    if (result != ILI9341_JPEG_OK)
+      return result;
+  }
+}
+
+uint8_t ILI9341JpegBegin(ILI9341JpegDecoder_s *decoder, const uint8_t *data, uint32_t size,
+                         ILI9341JpegRead_t read, void *context) {
+  uint8_t result;
+  decoder->next = data;
+  decoder->end = data + size;
+  decoder->read = read;
+  decoder->context = context;
+  decoder->width = 0;
+  decoder->height = 0;
+  decoder->componentNum = 0;
+  decoder->restartInterval = 0;
+  decoder->status = ILI9341_JPEG_OK;
+  result = jpegReadHeaders(decoder);
+  /* ILI9341JpegDraw refuses a decoder without components */
+  if (result != ILI9341_JPEG_OK)
+    decoder->componentNum = 0;
+  return result;
+}
+
+uint8_t ILI9341JpegDraw(ILI9341JpegDecoder_s *decoder, uint16_t x, uint16_t y, uint8_t scale) {
+  uint32_t n = 8U >> scale, mcuWidth = decoder->hMax * 8U, mcuHeight = decoder->vMax * 8U;
+  uint32_t outWidth, outHeight, outMcuWidth = decoder->hMax * n, outMcuHeight = decoder->vMax * n;
+  uint32_t mcuColumns, mcuRows, groupMcus, mcuX, mcuY, mcuCount = 0, i;
+  if (decoder->componentNum == 0 || scale > ILI9341_JPEG_SCALE_8)
+    return ILI9341_JPEG_ERROR;
+  if (x >= ILI9341_WIDTH || y >= ILI9341_HEIGHT)
+    return ILI9341_JPEG_OK;
+  mcuColumns = (decoder->width + mcuWidth - 1) / mcuWidth;
+  mcuRows = (decoder->height + mcuHeight - 1) / mcuHeight;
+  outWidth = (decoder->width + (1U << scale) - 1) >> scale;
+  outHeight = (decoder->height + (1U << scale) - 1) >> scale;
+  if (outWidth > (uint32_t)ILI9341_WIDTH - x)
+    outWidth = ILI9341_WIDTH - x;
+  if (outHeight > (uint32_t)ILI9341_HEIGHT - y)
+    outHeight = ILI9341_HEIGHT - y;
+  groupMcus = ILI9341_JPEG_STRIP_PIXELS / (outMcuWidth * outMcuHeight);
+  for (mcuY = 0; mcuY < mcuRows; mcuY++) {
+    uint32_t top = mcuY * outMcuHeight, rows, groupLeft = 0, groupWidth;
+    /* Nothing below the screen is drawn, so nothing below it is decoded */
+    if (top >= outHeight)
+      break;
+    rows = outHeight - top < outMcuHeight ? outHeight - top : outMcuHeight;
+    groupWidth = outWidth < groupMcus * outMcuWidth ? outWidth : groupMcus * outMcuWidth;
+    for (mcuX = 0; mcuX < mcuColumns; mcuX++, mcuCount++) {
+      uint32_t left = mcuX * outMcuWidth, visible = left < outWidth;
+      if (decoder->restartInterval != 0 && mcuCount != 0 && mcuCount % decoder->restartInterval == 0)
+        jpegRestart(decoder);
+      for (i = 0; i < decoder->componentNum; i++) {
+        ILI9341JpegComponent_s *component = &decoder->component[i];
+        uint32_t blockX, blockY;
+        for (blockY = 0; blockY < component->v; blockY++) {
+          for (blockX = 0; blockX < component->h; blockX++) {
+            jpegDecodeBlock(decoder, component);
+            /* The Huffman data must be walked, the IDCT only pays off on the screen */
+            if (!visible)
+              continue;
+            if (i == 0)
+              jpegIdct(decoder, scale, decoder->luma + blockY * n * outMcuWidth + blockX * n, outMcuWidth);
+            else
+              jpegIdct(decoder, scale, decoder->chroma[i - 1], n);
+          }
+        }
+      }
+      if (!visible)
+        continue;
+      jpegConvert(decoder, n, decoder->strip + (left - groupLeft), groupWidth,
+                  outWidth - left < outMcuWidth ? outWidth - left : outMcuWidth, rows);
+      if (left + outMcuWidth >= groupLeft + groupWidth) {
+        uint32_t pixels = groupWidth * rows;
+        setAddressWindow((uint16_t)(x + groupLeft), (uint16_t)(y + top),
+                         (uint16_t)(x + groupLeft + groupWidth - 1), (uint16_t)(y + top + rows - 1));
+        if (pixels >= ILI9341_BULK_MIN_PIXELS)
+          bulkWritePixelsIntoGraphicsRAM(decoder->strip, pixels);
+        else
+          writePixelsIntoGraphicsRAM(decoder->strip, pixels);
+        groupLeft += groupWidth;
+        groupWidth = outWidth - groupLeft < groupMcus * outMcuWidth ? outWidth - groupLeft
+                                                                    : groupMcus * outMcuWidth;
+      }
+    }
+  }
+  return decoder->status;
+}
+
+uint8_t ILI9341DrawJpeg(uint16_t x, uint16_t y, const uint8_t *data, uint32_t size, uint8_t scale) {
+  uint8_t result = ILI9341JpegBegin(&jpegDecoder, data, size, NULL, NULL);
+  if (result != ILI9341_JPEG_OK)
+    return result;
+  return ILI9341JpegDraw(&jpegDecoder, x, y, scale);
+}
@@ -0,0 +1,630 @@
+/********************************************************************************************************
+ * @Filename: ILI9341Png.c
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: PNG decoder of ILI9341 Driver Library, streaming inflate into two row buffers
+ *********************************************************************************************************/
+#include "ILI9341Private.h"
+#include <string.h>
+
+#if (ILI9341_PNG_WINDOW_BYTES & (ILI9341_PNG_WINDOW_BYTES - 1)) != 0 || ILI9341_PNG_WINDOW_BYTES < 256
+#error "ILI9341_PNG_WINDOW_BYTES must be a power of two of at least 256"
+#endif
+
+#define PNG_IHDR 0x49484452U
+#define PNG_PLTE 0x504C5445U
+#define PNG_TRNS 0x74524E53U
+#define PNG_IDAT 0x49444154U
+#define PNG_IEND 0x49454E44U
+#define PNG_GRAY       0
+#define PNG_RGB        2
+#define PNG_PALETTE    3
+#define PNG_GRAY_ALPHA 4
+#define PNG_RGBA       6
+#define PNG_END_OF_BLOCK 256
+#define PNG_WINDOW_MASK (ILI9341_PNG_WINDOW_BYTES - 1)
+
+static ILI9341PngDecoder_s pngDecoder;
+
+static const uint8_t pngSignature[8] = {0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A};
+/* Base and extra bits of the length symbols 257 to 285 and of the distance symbols */
+static const uint16_t pngLengthBase[29] = {
+  3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115,
+  131, 163, 195, 227, 258
+};
+static const uint8_t pngLengthExtra[29] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+static const uint16_t pngDistanceBase[30] = {
+  1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537,
+  2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+static const uint8_t pngDistanceExtra[30] = {
+  0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+/* Order of the code length code lengths in a dynamic block header */
+static const uint8_t pngLengthOrder[19] = {
+  16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
+};
+
+/**
+ * @brief Refill the input from the read callback
+ * @return 0 at the end of the file
+ */
+static uint8_t pngRefill(ILI9341PngDecoder_s *decoder) {
+  uint32_t size;
+  if (decoder->read == NULL)
+    return 0;
+  size = decoder->read(decoder->context, decoder->input, sizeof(decoder->input));
+  if (size > sizeof(decoder->input))
+    size = 0;
+  decoder->next = decoder->input;
+  decoder->end = decoder->input + size;
+  return size != 0;
+}
+/**
+ * @brief Next byte of the file, -1 at its end
+ */
+static inline int32_t pngByte(ILI9341PngDecoder_s *decoder) {
+  if (decoder->next == decoder->end && !pngRefill(decoder))
+    return -1;
+  return *decoder->next++;
+}
+/**
+ * @brief Big-endian word of the file
+ * @return 0 when the file ended, *ok is cleared then
+ */
+static uint32_t pngWord(ILI9341PngDecoder_s *decoder, uint8_t *ok) {
+  uint32_t word = 0, i;
+  for (i = 0; i < 4; i++) {
+    int32_t byte = pngByte(decoder);
+    if (byte < 0)
+      *ok = 0;
+    word = word << 8 | (uint8_t)byte;
+  }
+  return *ok ? word : 0;
+}
+
+static uint8_t pngSkip(ILI9341PngDecoder_s *decoder, uint32_t count) {
+  while (count-- > 0)
+    if (pngByte(decoder) < 0)
+      return 0;
+  return 1;
+}
+/**
+ * @brief Next byte of the zlib stream, which runs through consecutive IDAT chunks
+ * @return -1 after the last IDAT chunk
+ */
+static int32_t pngDataByte(ILI9341PngDecoder_s *decoder) {
+  while (decoder->chunkLeft == 0) {
+    uint8_t ok = 1;
+    uint32_t length;
+    if (decoder->lastChunk)
+      return -1;
+    /* CRC of the previous chunk, then the next one */
+    pngSkip(decoder, 4);
+    length = pngWord(decoder, &ok);
+    if (!ok || pngWord(decoder, &ok) != PNG_IDAT) {
+      decoder->lastChunk = 1;
+      return -1;
+    }
+    decoder->chunkLeft = length;
+  }
+  decoder->chunkLeft--;
+  return pngByte(decoder);
+}
+/**
+ * @brief Top up the bit buffer to at least 25 bits, zeros after the data
+ */
+static void pngFill(ILI9341PngDecoder_s *decoder) {
+  while (decoder->bitCount <= 24) {
+    int32_t byte = pngDataByte(decoder);
+    if (byte < 0) {
+      byte = 0;
+      if (decoder->padding < 32)
+        decoder->padding += 8;
+    }
+    decoder->bits |= (uint32_t)byte << decoder->bitCount;
+    decoder->bitCount += 8;
+  }
+}
+
+static inline uint32_t pngBits(ILI9341PngDecoder_s *decoder, uint32_t count) {
+  uint32_t value;
+  if (decoder->bitCount < count)
+    pngFill(decoder);
+  value = decoder->bits & ((1U << count) - 1);
+  decoder->bits >>= count;
+  decoder->bitCount -= count;
+  return value;
+}
+/**
+ * @brief Build a canonical Huffman table from code lengths
+ * @return 0 when the lengths are over-subscribed
+ */
+static uint8_t pngBuild(ILI9341PngHuffman_s *table, const uint8_t *lengths, uint32_t symbolNum) {
+  uint16_t offsets[16];
+  int32_t left = 1;
+  uint32_t length, symbol, code = 0, index = 0;
+  memset(table->count, 0, sizeof(table->count));
+  for (symbol = 0; symbol < symbolNum; symbol++)
+    table->count[lengths[symbol]]++;
+  table->count[0] = 0;
+  for (length = 1; length < 16; length++) {
+    left = (left << 1) - table->count[length];
+    if (left < 0)
+      return 0;
+  }
+  offsets[1] = 0;
+  for (length = 1; length < 15; length++)
+    offsets[length + 1] = (uint16_t)(offsets[length] + table->count[length]);
+  for (symbol = 0; symbol < symbolNum; symbol++)
+    if (lengths[symbol] != 0)
+      table->symbol[offsets[lengths[symbol]]++] = (uint16_t)symbol;
+  /* Codes up to 9 bits fill every lookup entry they start, bit-reversed as they arrive LSB first */
+  memset(table->lookup, 0, sizeof(table->lookup));
+  for (length = 1; length <= 9; length++, code <<= 1) {
+    uint32_t i;
+    for (i = 0; i < table->count[length]; i++, code++, index++) {
+      uint32_t reversed = 0, bit, fill;
+      for (bit = 0; bit < length; bit++)
+        reversed |= ((code >> bit) & 1) << (length - 1 - bit);
+      for (fill = reversed; fill < 512; fill += 1U << length)
+        table->lookup[fill] = (uint16_t)(length << 9 | table->symbol[index]);
+    }
+  }
+  return 1;
+}
+/**
+ * @brief Decode one symbol, codes longer than 9 bits walk the code counts
+ */
+static uint32_t pngDecode(ILI9341PngDecoder_s *decoder, const ILI9341PngHuffman_s *table) {
+  uint32_t entry, length, code = 0, first = 0, index = 0;
+  if (decoder->bitCount < 15)
+    pngFill(decoder);
+  entry = table->lookup[decoder->bits & 511];
+  if (entry != 0) {
+    length = entry >> 9;
+    decoder->bits >>= length;
+    decoder->bitCount -= length;
+    return entry & 511;
+  }
+  for (length = 1; length < 16; length++) {
+    uint32_t count = table->count[length];
+    code |= (decoder->bits >> (length - 1)) & 1;
+    if (code - first < count) {
+      decoder->bits >>= length;
+      decoder->bitCount -= length;
+      return table->symbol[index + code - first];
+    }
+    index += count;
+    first = (first + count) << 1;
+    code <<= 1;
+  }
+  decoder->status = ILI9341_PNG_ERROR;
+  return PNG_END_OF_BLOCK;
+}
+
+static inline uint8_t pngPaeth(uint8_t left, uint8_t up, uint8_t upLeft) {
+  int32_t estimate = left + up - upLeft;
+  int32_t toLeft = estimate > left ? estimate - left : left - estimate;
+  int32_t toUp = estimate > up ? estimate - up : up - estimate;
+  int32_t toUpLeft = estimate > upLeft ? estimate - upLeft : upLeft - estimate;
+  if (toLeft <= toUp && toLeft <= toUpLeft)
+    return left;
+  return toUp <= toUpLeft ? up : upLeft;
+}
+/**
+ * @brief Undo the filter of the current row against the previous one
+ */
+static void pngUnfilter(ILI9341PngDecoder_s *decoder) {
+  uint8_t *row = decoder->rows[decoder->current] + 1;
+  const uint8_t *previous = decoder->rows[decoder->current ^ 1] + 1;
+  uint32_t i, step = decoder->pixelBytes, count = decoder->rowBytes;
+  switch (row[-1]) {
+  case 0:
+    break;
+  case 1:
+    for (i = step; i < count; i++)
+      row[i] = (uint8_t)(row[i] + row[i - step]);
+    break;
+  case 2:
+    for (i = 0; i < count; i++)
+      row[i] = (uint8_t)(row[i] + previous[i]);
+    break;
+  case 3:
+    for (i = 0; i < step; i++)
+      row[i] = (uint8_t)(row[i] + (previous[i] >> 1));
+    for (; i < count; i++)
+      row[i] = (uint8_t)(row[i] + ((row[i - step] + previous[i]) >> 1));
+    break;
+  case 4:
+    for (i = 0; i < step; i++)
+      row[i] = (uint8_t)(row[i] + previous[i]);
+    for (; i < count; i++)
+      row[i] = (uint8_t)(row[i] + pngPaeth(row[i - step], previous[i], previous[i - step]));
+    break;
+  default:
+    decoder->status = ILI9341_PNG_ERROR;
+    break;
+  }
+}
+/**
+ * @brief RGB565 of a pixel with alpha over the background, x / 255 rounded
+ * as (x + 128 + ((x + 128) >> 8)) >> 8
+ */
+static inline uint16_t pngBlend(const ILI9341PngDecoder_s *decoder, uint32_t red, uint32_t green,
+                                uint32_t blue, uint32_t alpha) {
+  uint32_t background = decoder->background, inverse = 255 - alpha;
+  if (alpha == 255)
+    return (uint16_t)((red & 0xF8) << 8 | (green & 0xFC) << 3 | blue >> 3);
+  if (alpha == 0)
+    return decoder->background;
+  red = red * alpha + ((background >> 8 & 0xF8) | background >> 13) * inverse + 128;
+  green = green * alpha + ((background >> 3 & 0xFC) | (background >> 9 & 0x03)) * inverse + 128;
+  blue = blue * alpha + ((background << 3 & 0xF8) | (background >> 2 & 0x07)) * inverse + 128;
+  red = (red + (red >> 8)) >> 8;
+  green = (green + (green >> 8)) >> 8;
+  blue = (blue + (blue >> 8)) >> 8;
+  return (uint16_t)((red & 0xF8) << 8 | (green & 0xFC) << 3 | blue >> 3);
+}
+/**
+ * @brief Convert the visible pixels of the current row into the line
+ */
+static void pngConvert(ILI9341PngDecoder_s *decoder) {
+  const uint8_t *row = decoder->rows[decoder->current] + 1;
+  uint16_t *line = decoder->line;
+  uint32_t i, width = decoder->visibleWidth, depth = decoder->bitDepth;
+  switch (decoder->colorType) {
+  case PNG_PALETTE:
+    if (depth == 8) {
+      for (i = 0; i < width; i++)
+        line[i] = decoder->colors[row[i]];
+    } else {
+      uint32_t mask = (1U << depth) - 1, perByte = 8 / depth;
+      for (i = 0; i < width; i++)
+        line[i] = decoder->colors[(row[i / perByte] >> (8 - depth * (i % perByte + 1))) & mask];
+    }
+    break;
+  case PNG_GRAY: {
+    uint32_t mask = (1U << depth) - 1, perByte = 8 / depth, scale = 255 / mask;
+    for (i = 0; i < width; i++) {
+      uint32_t value = (row[i / perByte] >> (8 - depth * (i % perByte + 1))) & mask;
+      uint32_t gray = value * scale;
+      line[i] = decoder->hasKey && value == decoder->key[0]
+                  ? decoder->background
+                  : (uint16_t)((gray & 0xF8) << 8 | (gray & 0xFC) << 3 | gray >> 3);
+    }
+    break;
+  }
+  case PNG_RGB:
+    for (i = 0; i < width; i++, row += 3) {
+      if (decoder->hasKey && row[0] == decoder->key[0] && row[1] == decoder->key[1] && row[2] == decoder->key[2])
+        line[i] = decoder->background;
+      else
+        line[i] = (uint16_t)((row[0] & 0xF8) << 8 | (row[1] & 0xFC) << 3 | row[2] >> 3);
+    }
+    break;
+  case PNG_GRAY_ALPHA:
+    for (i = 0; i < width; i++, row += 2)
+      line[i] = pngBlend(decoder, row[0], row[0], row[0], row[1]);
+    break;
+  default:
+    for (i = 0; i < width; i++, row += 4)
+      line[i] = pngBlend(decoder, row[0], row[1], row[2], row[3]);
+    break;
+  }
+}
+/**
+ * @brief A row is complete: unfilter, convert, write and swap the rows
+ */
+static void pngRow(ILI9341PngDecoder_s *decoder) {
+  pngUnfilter(decoder);
+  pngConvert(decoder);
+  if (decoder->visibleWidth >= ILI9341_BULK_MIN_PIXELS)
+    bulkWritePixelsIntoGraphicsRAM(decoder->line, decoder->visibleWidth);
+  else
+    writePixelsIntoGraphicsRAM(decoder->line, decoder->visibleWidth);
+  decoder->row++;
+  decoder->current ^= 1;
+  decoder->rowFill = 0;
+}
+/**
+ * @brief Append an inflated byte to the window and the current row
+ * @return 0 once every visible row is drawn
+ */
+static inline uint8_t pngOutput(ILI9341PngDecoder_s *decoder, uint8_t byte) {
+  decoder->window[decoder->output++ & PNG_WINDOW_MASK] = byte;
+  decoder->rows[decoder->current][decoder->rowFill++] = byte;
+  if (decoder->rowFill > decoder->rowBytes) {
+    pngRow(decoder);
+    return decoder->row < decoder->visibleHeight;
+  }
+  return 1;
+}
+/**
+ * @brief Inflate the symbols of one Huffman coded block
+ * @return 0 once every visible row is drawn or on a problem
+ */
+static uint8_t pngCodes(ILI9341PngDecoder_s *decoder) {
+  for (;;) {
+    uint32_t symbol = pngDecode(decoder, &decoder->literal), length, distance;
+    if (decoder->bitCount < decoder->padding) {
+      decoder->status = ILI9341_PNG_TRUNCATED;
+      return 0;
+    }
+    if (symbol < 256) {
+      if (!pngOutput(decoder, (uint8_t)symbol))
+        return 0;
+      continue;
+    }
+    if (symbol == PNG_END_OF_BLOCK)
+      return decoder->status == ILI9341_PNG_OK;
+    symbol -= 257;
+    if (symbol >= 29)
+      break;
+    length = pngLengthBase[symbol] + pngBits(decoder, pngLengthExtra[symbol]);
+    symbol = pngDecode(decoder, &decoder->distance);
+    if (symbol >= 30)
+      break;
+    distance = pngDistanceBase[symbol] + pngBits(decoder, pngDistanceExtra[symbol]);
+    if (distance > ILI9341_PNG_WINDOW_BYTES || distance > decoder->output)
+      break;
+    while (length-- > 0)
+      if (!pngOutput(decoder, decoder->window[(decoder->output - distance) & PNG_WINDOW_MASK]))
+        return 0;
+  }
+  decoder->status = ILI9341_PNG_ERROR;
+  return 0;
+}
+/**
+ * @brief The fixed literal and distance codes of block type 1
+ */
+static void pngFixed(ILI9341PngDecoder_s *decoder) {
+  uint8_t lengths[288];
+  memset(lengths, 8, 144);
+  memset(lengths + 144, 9, 112);
+  memset(lengths + 256, 7, 24);
+  memset(lengths + 280, 8, 8);
+  pngBuild(&decoder->literal, lengths, 288);
+  memset(lengths, 5, 30);
+  pngBuild(&decoder->distance, lengths, 30);
+}
+/**
+ * @brief Read the code lengths of a dynamic block, type 2
+ * @return 0 for a corrupt header
+ */
+static uint8_t pngDynamic(ILI9341PngDecoder_s *decoder) {
+  uint8_t lengths[320];
+  uint32_t literalNum = pngBits(decoder, 5) + 257, distanceNum = pngBits(decoder, 5) + 1;
+  uint32_t codeNum = pngBits(decoder, 4) + 4, i = 0;
+  if (literalNum > 286 || distanceNum > 30)
+    return 0;
+  memset(lengths, 0, 19);
+  for (i = 0; i < codeNum; i++)
+    lengths[pngLengthOrder[i]] = (uint8_t)pngBits(decoder, 3);
+  /* The code length codes borrow the distance table */
+  if (!pngBuild(&decoder->distance, lengths, 19))
+    return 0;
+  for (i = 0; i < literalNum + distanceNum;) {
+    uint32_t symbol = pngDecode(decoder, &decoder->distance), repeat;
+    uint8_t value = 0;
+    if (symbol < 16) {
+      lengths[i++] = (uint8_t)symbol;
+      continue;
+    }
+    if (symbol == 16) {
+      if (i == 0)
+        return 0;
+      value = lengths[i - 1];
+      repeat = 3 + pngBits(decoder, 2);
+    } else if (symbol == 17) {
+      repeat = 3 + pngBits(decoder, 3);
+    } else {
+      repeat = 11 + pngBits(decoder, 7);
+    }
+    if (i + repeat > literalNum + distanceNum)
+      return 0;
+    while (repeat-- > 0)
+      lengths[i++] = value;
+  }
+  if (lengths[PNG_END_OF_BLOCK] == 0)
+    return 0;
+  return pngBuild(&decoder->literal, lengths, literalNum) &&
+         pngBuild(&decoder->distance, lengths + literalNum, distanceNum);
+}
+/**
+ * @brief Inflate the zlib stream until every visible row is drawn
+ */
+static void pngInflate(ILI9341PngDecoder_s *decoder) {
+  uint32_t header = pngBits(decoder, 16), last = 0;
+  uint32_t method = header & 0xFF, flags = header >> 8;
+  /* The bytes arrive LSB first, CMF is the low byte */
+  if ((method & 0x0F) != 8 || ((method << 8) | flags) % 31 != 0 || (flags & 0x20) != 0) {
+    decoder->status = ILI9341_PNG_ERROR;
+    return;
+  }
+  if ((1U << ((method >> 4) + 8)) > ILI9341_PNG_WINDOW_BYTES &&
+      (decoder->rowBytes + 1) * decoder->height > ILI9341_PNG_WINDOW_BYTES) {
+    decoder->status = ILI9341_PNG_UNSUPPORTED;
+    return;
+  }
+  while (!last && decoder->status == ILI9341_PNG_OK) {
+    uint32_t type;
+    last = pngBits(decoder, 1);
+    type = pngBits(decoder, 2);
+    if (type == 0) {
+      uint32_t length, check;
+      pngBits(decoder, decoder->bitCount & 7);
+      length = pngBits(decoder, 16);
+      check = pngBits(decoder, 16);
+      if ((length ^ 0xFFFF) != check) {
+        decoder->status = ILI9341_PNG_ERROR;
+        return;
+      }
+      while (length-- > 0) {
+        uint8_t byte = (uint8_t)pngBits(decoder, 8);
+        if (decoder->bitCount < decoder->padding) {
+          decoder->status = ILI9341_PNG_TRUNCATED;
+          return;
+        }
+        if (!pngOutput(decoder, byte))
+          return;
+      }
+      continue;
+    }
+    if (type == 1) {
+      pngFixed(decoder);
+    } else if (type != 2 || !pngDynamic(decoder)) {
+      decoder->status = ILI9341_PNG_ERROR;
+      return;
+    }
+    if (!pngCodes(decoder))
+      return;
+  }
+}
+/**
+ * @brief Read the chunks up to the first IDAT
+ */
+static uint8_t pngReadChunks(ILI9341PngDecoder_s *decoder) {
+  uint8_t signature[8], ok = 1, haveHeader = 0;
+  uint32_t i;
+  for (i = 0; i < sizeof(signature); i++) {
+    int32_t byte = pngByte(decoder);
+    if (byte < 0)
+      return ILI9341_PNG_TRUNCATED;
+    signature[i] = (uint8_t)byte;
+  }
+  if (memcmp(signature, pngSignature, sizeof(signature)) != 0)
+    return ILI9341_PNG_ERROR;
+  for (;;) {
+    uint32_t length = pngWord(decoder, &ok), type = pngWord(decoder, &ok);
+    if (!ok)
+      return ILI9341_PNG_TRUNCATED;
+    if (type == PNG_IDAT) {
+      if (!haveHeader)
+        return ILI9341_PNG_ERROR;
+      decoder->chunkLeft = length;
+      return ILI9341_PNG_OK;
+    }
+    if (type == PNG_IEND)
+      return ILI9341_PNG_ERROR;
+    if (type == PNG_IHDR) {
+      uint32_t width = pngWord(decoder, &ok), height = pngWord(decoder, &ok), depth, color;
+      int32_t compression, filter, interlace;
+      depth = (uint32_t)pngByte(decoder);
+      color = (uint32_t)pngByte(decoder);
+      compression = pngByte(decoder);
+      filter = pngByte(decoder);
+      interlace = pngByte(decoder);
+      if (!ok || interlace < 0)
+        return ILI9341_PNG_TRUNCATED;
+      if (length != 13 || width == 0 || height == 0 || height > 0xFFFF || compression != 0 || filter != 0)
+        return ILI9341_PNG_ERROR;
+      if (interlace != 0 || width > ILI9341_PNG_MAX_WIDTH || depth > 8 ||
+          (color != PNG_GRAY && color != PNG_PALETTE && depth != 8) ||
+          (color != PNG_GRAY && color != PNG_RGB && color != PNG_PALETTE && color != PNG_GRAY_ALPHA &&
+           color != PNG_RGBA) ||
+          (depth != 1 && depth != 2 && depth != 4 && depth != 8))
+        return ILI9341_PNG_UNSUPPORTED;
+      decoder->width = (uint16_t)width;
+      decoder->height = (uint16_t)height;
+      decoder->bitDepth = (uint8_t)depth;
+      decoder->colorType = (uint8_t)color;
+      decoder->pixelBytes = color == PNG_RGB ? 3 : color == PNG_GRAY_ALPHA ? 2 : color == PNG_RGBA ? 4 : 1;
+      decoder->rowBytes = (width * decoder->pixelBytes * depth + 7) / 8;
+      haveHeader = 1;
+      length = 0;
+    } else if (type == PNG_PLTE && length <= 768 && length % 3 == 0) {
+      for (i = 0; i < length / 3; i++) {
+        decoder->palette[i][0] = (uint8_t)pngByte(decoder);
+        decoder->palette[i][1] = (uint8_t)pngByte(decoder);
+        decoder->palette[i][2] = (uint8_t)pngByte(decoder);
+      }
+      length = 0;
+    } else if (type == PNG_TRNS && haveHeader) {
+      if (decoder->colorType == PNG_PALETTE && length <= 256) {
+        for (i = 0; i < length; i++)
+          decoder->palette[i][3] = (uint8_t)pngByte(decoder);
+        length = 0;
+      } else if ((decoder->colorType == PNG_GRAY && length == 2) ||
+                 (decoder->colorType == PNG_RGB && length == 6)) {
+        for (i = 0; i < length / 2; i++) {
+          decoder->key[i] = (uint16_t)(pngByte(decoder) << 8);
+          decoder->key[i] |= (uint16_t)pngByte(decoder);
+        }
+        decoder->hasKey = 1;
+        length = 0;
+      }
+    }
+    /* The rest of the chunk, ancillary chunks entirely, and its CRC */
+    if (!pngSkip(decoder, length + 4))
+      return ILI9341_PNG_TRUNCATED;
+  }
+}
+
+uint8_t ILI9341PngBegin(ILI9341PngDecoder_s *decoder, const uint8_t *data, uint32_t size,
+                        ILI9341PngRead_t read, void *context) {
+  uint8_t result;
+  uint32_t i;
+  decoder->next = data;
+  decoder->end = data + size;
+  decoder->read = read;
+  decoder->context = context;
+  decoder->width = 0;
+  decoder->height = 0;
+  decoder->hasKey = 0;
+  for (i = 0; i < 256; i++) {
+    decoder->palette[i][0] = 0;
+    decoder->palette[i][1] = 0;
+    decoder->palette[i][2] = 0;
+    decoder->palette[i][3] = 255;
+  }
+  result = pngReadChunks(decoder);
+  /* ILI9341PngDraw refuses a decoder without an image */
+  if (result != ILI9341_PNG_OK)
+    decoder->width = 0;
+  return result;
+}
+
+uint8_t ILI9341PngDraw(ILI9341PngDecoder_s *decoder, uint16_t x, uint16_t y, uint16_t background) {
+  uint32_t i;
+  if (decoder->width == 0)
+    return ILI9341_PNG_ERROR;
+  if (x >= ILI9341_WIDTH || y >= ILI9341_HEIGHT)
+    return ILI9341_PNG_OK;
+  decoder->visibleWidth = (uint16_t)(decoder->width < ILI9341_WIDTH - x ? decoder->width : ILI9341_WIDTH - x);
+  decoder->visibleHeight = (uint16_t)(decoder->height < ILI9341_HEIGHT - y ? decoder->height : ILI9341_HEIGHT - y);
+  decoder->background = background;
+  if (decoder->colorType == PNG_PALETTE)
+    for (i = 0; i < 256; i++)
+      decoder->colors[i] = pngBlend(decoder, decoder->palette[i][0], decoder->palette[i][1],
+                                    decoder->palette[i][2], decoder->palette[i][3]);
+  /* Gray keys compare against the raw sample, tRNS keeps the low bits */
+  if (decoder->colorType == PNG_GRAY)
+    decoder->key[0] &= (uint16_t)((1U << decoder->bitDepth) - 1);
+  memset(decoder->rows[1], 0, sizeof(decoder->rows[1]));
+  decoder->current = 0;
+  decoder->row = 0;
+  decoder->rowFill = 0;
+  decoder->output = 0;
+  decoder->bits = 0;
+  decoder->bitCount = 0;
+  decoder->padding = 0;
+  decoder->lastChunk = 0;
+  decoder->status = ILI9341_PNG_OK;
+  setAddressWindow(x, y, (uint16_t)(x + decoder->visibleWidth - 1), (uint16_t)(y + decoder->visibleHeight - 1));
+  pngInflate(decoder);
+  if (decoder->status == ILI9341_PNG_OK && decoder->row < decoder->visibleHeight)
+    decoder->status = ILI9341_PNG_TRUNCATED;
+  decoder->width = 0;
+  return decoder->status;
+}
+
+uint8_t ILI9341DrawPng(uint16_t x, uint16_t y, const uint8_t *data, uint32_t size, uint16_t background) {
+  uint8_t result = ILI9341PngBegin(&pngDecoder, data, size, NULL, NULL);
+  if (result != ILI9341_PNG_OK)
+    return result;
+  return ILI9341PngDraw(&pngDecoder, x, y, background);
+}
@@ -0,0 +1,101 @@
+/********************************************************************************************************
+ * @Filename: ILI9341Private.h
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: Private definitions shared by the source files of ILI9341 Driver Library, do not
+ *               include it from application code
+ *********************************************************************************************************/
+#ifndef __STM32_ILI9341_LIB_PRIVATE_HEADER__
+#define __STM32_ILI9341_LIB_PRIVATE_HEADER__
+
+#include "ILI9341.h"
+
+/**
+ * @brief MADCTL Values
+ */
+#define ILI9341_MADCTL_MY   0x80
+#define ILI9341_MADCTL_MX   0x40
+#define ILI9341_MADCTL_MV   0x20
+#define ILI9341_MADCTL_ML   0x10
+#define ILI9341_MADCTL_BGR  0x08
+#define ILI9341_MADCTL_MH   0x04
+#define ILI9341_MADCTL_RGB  0x00
+/**
+ * @brief Rotation handling
+ */
+#if ILI9341_SCREEN_ORIENTATION == 0
+  #define ILI9341_WIDTH   240
+  #define ILI9341_HEIGHT  320
+  #define ILI9341_ROTATION (ILI9341_MADCTL_MX | ILI9341_MADCTL_BGR)
+#elif ILI9341_SCREEN_ORIENTATIONS == 1
+  #define ILI9341_WIDTH   320
+  #define ILI9341_HEIGHT  240
+  #define ILI9341_ROTATION (ILI9341_MADCTL_MY | ILI9341_MADCTL_BGR | ILI9341_MADCTL_MX | ILI9341_MADCTL_MV)
+#elif ILI9341_SCREEN_ORIENTATION == 2
+  #define ILI9341_WIDTH   240
+  #define ILI9341_HEIGHT  320
+  #define ILI9341_ROTATION (ILI9341_MADCTL_MY | ILI9341_MADCTL_BGR)
+#elif ILI9341_SCREEN_ORIENTATION == 3
+  #define ILI9341_WIDTH   320
+  #define ILI9341_HEIGHT  240
+  #define ILI9341_ROTATION (ILI9341_MADCTL_MV|  ILI9341_MADCTL_BGR)
+#endif
+/**
+ * @brief Bus primitives implemented in ILI9341.c
+ */
+void writeRegister(uint16_t regValue);
+void writeGraphicsRAM(uint16_t Data);
+void writeArrayIntoGraphicsRAM(uint16_t *arrayPtr, uint32_t arraySize);
+void writePixelsIntoGraphicsRAM(const uint16_t *pixels, uint32_t pixelNum);
+void bulkWritePixelsIntoGraphicsRAM(const uint16_t *pixels, uint32_t pixelNum);
+void fillGraphicsRAM(uint16_t color, uint32_t pixelNum);
+void bulkFillGraphicsRAM(uint16_t color, uint32_t pixelNum);
+void readArrayFromGraphicsRAM(uint16_t *arrayPtr, uint32_t arraySize);
+void readPixelsFromGraphicsRAM(uint16_t *pixels, uint32_t pixelNum);
+void setAddressWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+/**
+ * @brief Clip rectangle of text drawing, x1 and y1 are exclusive
+ */
+typedef struct {
+  int32_t x0;
+  int32_t y0;
+  int32_t x1;
+  int32_t y1;
+} TextClip_s;
+/**
+ * @brief Text primitives implemented in ILI9341Font.c
+ */
+uint32_t utf8Next(const char **string);
+int32_t glyphAdvance(const FontDef_s *font, uint32_t codepoint, uint32_t next);
+int32_t glyphInkRight(const FontDef_s *font, uint32_t codepoint);
+void drawChar(uint16_t x, uint16_t y, uint32_t codepoint, FontDef_s font,
+              uint16_t color, uint16_t bgcolor);
+void drawTextRun(int32_t x, int32_t y, const char *string, const char *end, uint32_t width,
+                 const FontDef_s *font, uint16_t color, uint16_t bgcolor, const TextClip_s *clip);
+/**
+ * @brief 1-bit pixel kernels shared by glyphs and bitmaps, implemented in ILI9341Font.c
+ */
+void expandBits(uint32_t bits, uint32_t count, uint16_t *pixels, uint16_t color, uint16_t bgcolor);
+/**
+ * @brief Take the first run of set bits off MSB-first pixel bits
+ * @param bits pixel bits, not 0, the run and everything left of it is cleared
+ * @param length set to the length of the run
+ * @return pixel position of the run, counted from bit 31
+ */
+static inline uint32_t bitRun(uint32_t *bits, uint32_t *length) {
+  uint32_t start = (uint32_t)__builtin_clz(*bits), rest = ~(*bits << start);
+  *length = rest == 0 ? 32 - start : (uint32_t)__builtin_clz(rest);
+  if (start + *length >= 32)
+    *bits = 0;
+  else
+    *bits &= 0xFFFFFFFFU >> (start + *length);
+  return start;
+}
+/**
+ * @brief Write the decimal digits of a value backwards, ending before end
+ * @return first digit, at most 10 characters before end
+ */
+char *formatUnsigned(char *end, uint32_t value);
+
+#endif
@@ -0,0 +1,208 @@
+/********************************************************************************************************
+ * @Filename: ILI9341Qoi.c
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: QOI image decoder of ILI9341 Driver Library, streamed into the address window
+ *********************************************************************************************************/
+#include "ILI9341Private.h"
+#include <string.h>
+
+#define QOI_HEADER_SIZE 14
+#define QOI_OP_INDEX 0x00
+#define QOI_OP_DIFF  0x40
+#define QOI_OP_LUMA  0x80
+#define QOI_OP_RUN   0xC0
+#define QOI_OP_RGB   0xFE
+#define QOI_OP_RGBA  0xFF
+#define QOI_OP_MASK  0xC0
+#define QOI_RGB565(r, g, b) ((uint16_t)(((r) & 0xF8) << 8 | ((g) & 0xFC) << 3 | (b) >> 3))
+
+static ILI9341QoiDecoder_s qoiDecoder;
+
+/**
+ * @brief Size of an op in bytes from its first byte
+ */
+static uint32_t qoiOpSize(uint8_t op) {
+  if (op == QOI_OP_RGBA)
+    return 5;
+  if (op == QOI_OP_RGB)
+    return 4;
+  return (op & QOI_OP_MASK) == QOI_OP_LUMA ? 2 : 1;
+}
+/**
+ * @brief Write the buffered pixels
+ */
+static void qoiFlush(ILI9341QoiDecoder_s *decoder, uint32_t bufferNum) {
+  if (bufferNum >= ILI9341_BULK_MIN_PIXELS)
+    bulkWritePixelsIntoGraphicsRAM(decoder->buffer, bufferNum);
+  else
+    writePixelsIntoGraphicsRAM(decoder->buffer, bufferNum);
+}
+/**
+ * @brief Emit a run of the previous pixel
+ * @details QOI runs are at most 62 pixels, consecutive run ops are summed
+ * before they get here so a flat area becomes one fill
+ * @return pixels in the buffer afterwards
+ */
+static uint32_t qoiEmitRun(ILI9341QoiDecoder_s *decoder, uint16_t color, uint32_t run,
+                           uint32_t bufferNum) {
+  if (run >= ILI9341_BULK_MIN_PIXELS) {
+    qoiFlush(decoder, bufferNum);
+    bulkFillGraphicsRAM(color, run);
+    return 0;
+  }
+  while (run-- > 0) {
+    decoder->buffer[bufferNum++] = color;
+    if (bufferNum == ILI9341_QOI_BUFFER_PIXELS) {
+      qoiFlush(decoder, bufferNum);
+      bufferNum = 0;
+    }
+  }
+  return bufferNum;
+}
+/**
+ * @brief Parse the header and open the address window
+ */
+static uint8_t qoiHeader(ILI9341QoiDecoder_s *decoder, const uint8_t *header) {
+  uint32_t width = (uint32_t)header[4] << 24 | (uint32_t)header[5] << 16 | header[6] << 8 | header[7];
+  uint32_t height = (uint32_t)header[8] << 24 | (uint32_t)header[9] << 16 | header[10] << 8 | header[11];
+  if (memcmp(header, "qoif", 4) != 0 || (header[12] != 3 && header[12] != 4) ||
+      width == 0 || height == 0 || decoder->x >= ILI9341_WIDTH || decoder->y >= ILI9341_HEIGHT ||
+      width > (uint32_t)(ILI9341_WIDTH - decoder->x) || height > (uint32_t)(ILI9341_HEIGHT - decoder->y))
+    return ILI9341_QOI_ERROR;
+  decoder->width = (uint16_t)width;
+  decoder->height = (uint16_t)height;
+  decoder->pixelsLeft = width * height;
+  setAddressWindow(decoder->x, decoder->y, (uint16_t)(decoder->x + width - 1),
+                   (uint16_t)(decoder->y + height - 1));
+  return ILI9341_QOI_MORE;
+}
+/**
+ * @brief Decode every complete op of a chunk
+ * @param decoder decoder state
+ * @param bytes first op
+ * @param end end of the chunk
+ * @return first byte not decoded, an op split by the end of the chunk
+ */
+static const uint8_t *qoiDecode(ILI9341QoiDecoder_s *decoder, const uint8_t *bytes,
+                                const uint8_t *end) {
+  uint8_t r = decoder->r, g = decoder->g, b = decoder->b, a = decoder->a;
+  uint32_t left = decoder->pixelsLeft, run = decoder->run, bufferNum = decoder->bufferNum;
+  uint16_t color = QOI_RGB565(r, g, b);
+  while (left > 0 && bytes < end) {
+    uint8_t op = *bytes;
+    if ((op & QOI_OP_MASK) == QOI_OP_RUN && op < QOI_OP_RGB) {
+      uint32_t count = (uint32_t)(op & 0x3F) + 1;
+      if (count > left)
+        count = left;
+      run += count;
+      left -= count;
+      bytes++;
+      continue;
+    }
+    if ((uint32_t)(end - bytes) < qoiOpSize(op))
+      break;
+    if (op == QOI_OP_RGB || op == QOI_OP_RGBA) {
+      r = bytes[1];
+      g = bytes[2];
+      b = bytes[3];
+      if (op == QOI_OP_RGBA)
+        a = bytes[4];
+      bytes += op == QOI_OP_RGBA ? 5 : 4;
+    } else if ((op & QOI_OP_MASK) == QOI_OP_INDEX) {
+      uint32_t pixel = decoder->index[op];
+      r = (uint8_t)pixel;
+      g = (uint8_t)(pixel >> 8);
+      b = (uint8_t)(pixel >> 16);
+      a = (uint8_t)(pixel >> 24);
+      bytes++;
+    } else if ((op & QOI_OP_MASK) == QOI_OP_DIFF) {
+      r = (uint8_t)(r + ((op >> 4) & 0x03) - 2);
+      g = (uint8_t)(g + ((op >> 2) & 0x03) - 2);
+      b = (uint8_t)(b + (op & 0x03) - 2);
+      bytes++;
+    } else {
+      int32_t dg = (op & 0x3F) - 32;
+      r = (uint8_t)(r + dg - 8 + (bytes[1] >> 4));
+      g = (uint8_t)(g + dg);
+      b = (uint8_t)(b + dg - 8 + (bytes[1] & 0x0F));
+      bytes += 2;
+    }
+    decoder->index[(r * 3 + g * 5 + b * 7 + a * 11) & 63] =
+      r | (uint32_t)g << 8 | (uint32_t)b << 16 | (uint32_t)a << 24;
+    if (run > 0) {
+      bufferNum = qoiEmitRun(decoder, color, run, bufferNum);
+      run = 0;
+    }
+    color = QOI_RGB565(r, g, b);
+    decoder->buffer[bufferNum++] = color;
+    left--;
+    if (bufferNum == ILI9341_QOI_BUFFER_PIXELS) {
+      qoiFlush(decoder, bufferNum);
+      bufferNum = 0;
+    }
+  }
+  if (left == 0) {
+    bufferNum = qoiEmitRun(decoder, color, run, bufferNum);
+    qoiFlush(decoder, bufferNum);
+    run = 0;
+    bufferNum = 0;
+    decoder->state = ILI9341_QOI_DONE;
+  }
+  decoder->r = r;
+  decoder->g = g;
+  decoder->b = b;
+  decoder->a = a;
+  decoder->pixelsLeft = left;
+  decoder->run = run;
+  decoder->bufferNum = (uint16_t)bufferNum;
+  return bytes;
+}
+
+void ILI9341QoiBegin(ILI9341QoiDecoder_s *decoder, uint16_t x, uint16_t y) {
+  memset(decoder->index, 0, sizeof(decoder->index));
+  decoder->x = x;
+  decoder->y = y;
+  decoder->width = 0;
+  decoder->height = 0;
+  decoder->pixelsLeft = 0;
+  decoder->run = 0;
+  decoder->r = 0;
+  decoder->g = 0;
+  decoder->b = 0;
+  decoder->a = 255;
+  decoder->state = ILI9341_QOI_MORE;
+  decoder->pendingNum = 0;
+  decoder->bufferNum = 0;
+}
+
+uint8_t ILI9341QoiFeed(ILI9341QoiDecoder_s *decoder, const uint8_t *bytes, uint32_t byteNum) {
+  const uint8_t *end = bytes + byteNum;
+  /* The header and ops split between two chunks are completed in pending */
+  while (decoder->state == ILI9341_QOI_MORE && (decoder->width == 0 || decoder->pendingNum > 0)) {
+    uint32_t size = decoder->width == 0 ? QOI_HEADER_SIZE : qoiOpSize(decoder->pending[0]);
+    while (decoder->pendingNum < size && bytes < end)
+      decoder->pending[decoder->pendingNum++] = *bytes++;
+    if (decoder->pendingNum < size)
+      return decoder->state;
+    decoder->pendingNum = 0;
+    if (decoder->width == 0)
+      decoder->state = qoiHeader(decoder, decoder->pending);
+    else
+      qoiDecode(decoder, decoder->pending, decoder->pending + size);
+  }
+  if (decoder->state != ILI9341_QOI_MORE)
+    return decoder->state;
+  bytes = qoiDecode(decoder, bytes, end);
+  if (decoder->state == ILI9341_QOI_MORE) {
+    while (bytes < end)
+      decoder->pending[decoder->pendingNum++] = *bytes++;
+  }
+  return decoder->state;
+}
+
+uint8_t ILI9341DrawQoi(uint16_t x, uint16_t y, const uint8_t *data, uint32_t size) {
+  ILI9341QoiBegin(&qoiDecoder, x, y);
+  return ILI9341QoiFeed(&qoiDecoder, data, size);
+}
@@ -0,0 +1,178 @@
+/********************************************************************************************************
+ * @Filename: ILI9341Readout.c
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: Numeric formatting and diff-based readout fields of ILI9341 Driver Library
+ *********************************************************************************************************/
+#include "ILI9341Private.h"
+#include <string.h>
+
+#define FORMAT_MAX_DECIMALS 9
+#define READOUT_OVERFLOW '#'
+
+/**
+ * @brief "00" to "99", two digits per division by 100
+ */
+static const char digitPairs[201] =
+  "0001020304050607080910111213141516171819"
+  "2021222324252627282930313233343536373839"
+  "4041424344454647484950515253545556575859"
+  "6061626364656667686970717273747576777879"
+  "8081828384858687888990919293949596979899";
+
+static const uint32_t powersOfTen[FORMAT_MAX_DECIMALS + 1] = {
+  1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+char *formatUnsigned(char *end, uint32_t value) {
+  while (value >= 100) {
+    const char *pair = &digitPairs[(value % 100) * 2];
+    value /= 100;
+    *--end = pair[1];
+    *--end = pair[0];
+  }
+  if (value >= 10) {
+    *--end = digitPairs[value * 2 + 1];
+    *--end = digitPairs[value * 2];
+  } else {
+    *--end = (char)('0' + value);
+  }
+  return end;
+}
+/**
+ * @brief Write integer and fraction digits with a point
+ * @param buffer destination
+ * @param integer integer part
+ * @param fraction fraction part, below 10^decimals
+ * @param negative write a minus sign unless the value is zero
+ * @param decimals digits after the point
+ * @return length of the string
+ */
+static uint8_t formatDecimal(char *buffer, uint32_t integer, uint32_t fraction, uint8_t negative,
+                             uint8_t decimals) {
+  char digits[10], *end = digits + sizeof(digits), *start;
+  char *out = buffer;
+  if (negative && (integer != 0 || fraction != 0))
+    *out++ = '-';
+  start = formatUnsigned(end, integer);
+  memcpy(out, start, (size_t)(end - start));
+  out += end - start;
+  if (decimals > 0) {
+    *out++ = '.';
+    start = formatUnsigned(end, fraction);
+    /* 5 with 3 decimals is 0.005 */
+    while (end - start < decimals)
+      *--start = '0';
+    memcpy(out, start, decimals);
+    out += decimals;
+  }
+  *out = '\0';
+  return (uint8_t)(out - buffer);
+}
+
+uint8_t ILI9341FormatInteger(char *buffer, int32_t value, uint8_t decimals) {
+  uint32_t magnitude = value < 0 ? 0U - (uint32_t)value : (uint32_t)value;
+  if (decimals > FORMAT_MAX_DECIMALS)
+    decimals = FORMAT_MAX_DECIMALS;
+  return formatDecimal(buffer, magnitude / powersOfTen[decimals], magnitude % powersOfTen[decimals],
+                       value < 0, decimals);
+}
+
+uint8_t ILI9341FormatFixed(char *buffer, int32_t value, uint8_t fractionBits, uint8_t decimals) {
+  uint32_t magnitude = value < 0 ? 0U - (uint32_t)value : (uint32_t)value, integer, fraction;
+  if (decimals > FORMAT_MAX_DECIMALS)
+    decimals = FORMAT_MAX_DECIMALS;
+  if (fractionBits > 31)
+    fractionBits = 31;
+  integer = fractionBits > 0 ? magnitude >> fractionBits : magnitude;
+  fraction = magnitude & (((uint32_t)1 << fractionBits) - 1);
+  /* Round half away from zero, only a multiply and a shift, no 64-bit division */
+  if (fractionBits > 0)
+    fraction = (uint32_t)(((uint64_t)fraction * powersOfTen[decimals] +
+                           ((uint64_t)1 << (fractionBits - 1))) >> fractionBits);
+  if (fraction >= powersOfTen[decimals]) {
+    integer++;
+    fraction = 0;
+  }
+  return formatDecimal(buffer, integer, fraction, value < 0, decimals);
+}
+
+void ILI9341ReadoutInit(ILI9341Readout_s *readout, uint16_t x, uint16_t y, FontDef_s font,
+                        uint8_t length, uint8_t decimals, uint16_t color, uint16_t bgColor) {
+  readout->font = font;
+  readout->x = x;
+  readout->y = y;
+  readout->length = length > ILI9341_READOUT_MAX_CHARS ? ILI9341_READOUT_MAX_CHARS : length;
+  readout->decimals = decimals;
+  readout->color = color;
+  readout->bgColor = bgColor;
+  readout->drawn = 0;
+}
+
+void ILI9341ReadoutInvalidate(ILI9341Readout_s *readout) {
+  readout->drawn = 0;
+}
+
+void ILI9341ReadoutSetColors(ILI9341Readout_s *readout, uint16_t color, uint16_t bgColor) {
+  if (readout->color == color && readout->bgColor == bgColor)
+    return;
+  readout->color = color;
+  readout->bgColor = bgColor;
+  readout->drawn = 0;
+}
+/**
+ * @brief Draw one character cell of a readout
+ * @details Proportional glyphs are centered in a cell of the nominal font
+ * width, so digits keep their places like tabular figures
+ */
+static void drawReadoutCell(const ILI9341Readout_s *readout, uint8_t cell, char character) {
+  const FontDef_s *font = &readout->font;
+  int32_t x = readout->x + cell * font->width, advance, pad;
+  TextClip_s clip = {x, readout->y, x + font->width, readout->y + font->height};
+  if (font->glyphs == 0) {
+    drawChar((uint16_t)x, readout->y, (uint8_t)character, *font, readout->color, readout->bgColor);
+    return;
+  }
+  advance = glyphAdvance(font, (uint8_t)character, 0);
+  pad = advance < font->width ? (font->width - advance) / 2 : 0;
+  if (pad > 0)
+    ILI9341FillRectangle((uint16_t)x, readout->y, (uint16_t)pad, font->height, readout->bgColor);
+  drawTextRun(x + pad, readout->y, &character, &character + 1, (uint32_t)(font->width - pad), font,
+              readout->color, readout->bgColor, &clip);
+}
+
+uint8_t ILI9341ReadoutSetText(ILI9341Readout_s *readout, const char *text) {
+  char field[ILI9341_READOUT_MAX_CHARS];
+  uint8_t length = 0, i, drawn = 0;
+  while (length <= readout->length && text[length] != '\0')
+    length++;
+  /* Right aligned, a value that does not fit shows as ### instead of a wrong number */
+  if (length > readout->length) {
+    memset(field, READOUT_OVERFLOW, readout->length);
+  } else {
+    memset(field, ' ', readout->length - length);
+    memcpy(field + readout->length - length, text, length);
+  }
+  for (i = 0; i < readout->length; i++) {
+    if (readout->drawn && readout->shown[i] == field[i])
+      continue;
+    drawReadoutCell(readout, i, field[i]);
+    readout->shown[i] = field[i];
+    drawn++;
+  }
+  readout->drawn = 1;
+  return drawn;
+}
+
+uint8_t ILI9341ReadoutSetInteger(ILI9341Readout_s *readout, int32_t value) {
+  char text[ILI9341_FORMAT_BUFFER_SIZE];
+  ILI9341FormatInteger(text, value, readout->decimals);
+  return ILI9341ReadoutSetText(readout, text);
+}
+
+uint8_t ILI9341ReadoutSetFixed(ILI9341Readout_s *readout, int32_t value, uint8_t fractionBits) {
+  char text[ILI9341_FORMAT_BUFFER_SIZE];
+  ILI9341FormatFixed(text, value, fractionBits, readout->decimals);
+  return ILI9341ReadoutSetText(readout, text);
+}
@@ -0,0 +1,194 @@
+/********************************************************************************************************
+ * @Filename: ILI9341Sprite.c
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: Color-keyed sprites of ILI9341 Driver Library, restoring the background they cover
+ *********************************************************************************************************/
+#include "ILI9341Private.h"
+#include <string.h>
+
+/**
+ * @brief Part of a sprite on the screen, x1 and y1 are exclusive
+ */
+typedef struct {
+  int32_t x0;
+  int32_t y0;
+  int32_t x1;
+  int32_t y1;
+} SpriteRect_s;
+
+/**
+ * @brief Clip a sprite at a position to the screen
+ * @return 0 when nothing of it is visible
+ */
+static uint8_t spriteVisible(const ILI9341Sprite_s *sprite, int32_t x, int32_t y, SpriteRect_s *rect) {
+  rect->x0 = x < 0 ? 0 : x;
+  rect->y0 = y < 0 ? 0 : y;
+  rect->x1 = x + sprite->width > ILI9341_WIDTH ? ILI9341_WIDTH : x + sprite->width;
+  rect->y1 = y + sprite->height > ILI9341_HEIGHT ? ILI9341_HEIGHT : y + sprite->height;
+  return rect->x0 < rect->x1 && rect->y0 < rect->y1;
+}
+/**
+ * @brief Whether a sprite at x, y has an opaque pixel at a screen position
+ */
+static inline uint8_t spriteOpaque(const ILI9341Sprite_s *sprite, int32_t x, int32_t y,
+                                   int32_t screenX, int32_t screenY) {
+  uint32_t column = (uint32_t)(screenX - x), row = (uint32_t)(screenY - y);
+  return column < sprite->width && row < sprite->height &&
+         sprite->image[row * sprite->width + column] != sprite->key;
+}
+/**
+ * @brief Write the background of a row piece at the current position back
+ */
+static void spriteRestore(const ILI9341Sprite_s *sprite, int32_t x, int32_t y, uint32_t count) {
+  uint16_t line[ILI9341_SPRITE_MAX_WIDTH];
+  const uint16_t *pixels = line;
+  if (sprite->saved != NULL)
+    pixels = sprite->saved + (uint32_t)(y - sprite->y) * sprite->width + (uint32_t)(x - sprite->x);
+  else
+    sprite->background(sprite->context, (uint16_t)x, (uint16_t)y, line, (uint16_t)count);
+  setAddressWindow((uint16_t)x, (uint16_t)y, (uint16_t)(x + count - 1), (uint16_t)y);
+  writePixelsIntoGraphicsRAM(pixels, count);
+}
+/**
+ * @brief Restore the opaque pixels of the current position
+ * @param covered the sprite is drawn at x, y next, its opaque pixels are not restored
+ */
+static void spriteUncover(const ILI9341Sprite_s *sprite, int32_t x, int32_t y, uint8_t covered) {
+  SpriteRect_s old;
+  int32_t screenX, screenY;
+  if (!spriteVisible(sprite, sprite->x, sprite->y, &old))
+    return;
+  for (screenY = old.y0; screenY < old.y1; screenY++) {
+    int32_t start = -1;
+    for (screenX = old.x0; screenX <= old.x1; screenX++) {
+      uint8_t restore = screenX < old.x1 && spriteOpaque(sprite, sprite->x, sprite->y, screenX, screenY) &&
+                        !(covered && spriteOpaque(sprite, x, y, screenX, screenY));
+      if (restore && start < 0) {
+        start = screenX;
+      } else if (!restore && start >= 0) {
+        spriteRestore(sprite, start, screenY, (uint32_t)(screenX - start));
+        start = -1;
+      }
+    }
+  }
+}
+/**
+ * @brief Read a screen rectangle back into the saved pixels of a sprite at x, y
+ */
+static void spriteReadBack(ILI9341Sprite_s *sprite, int32_t x, int32_t y,
+                           int32_t x0, int32_t y0, int32_t x1, int32_t y1) {
+  uint16_t *row;
+  if (x1 <= x0 || y1 <= y0)
+    return;
+  row = sprite->saved + (uint32_t)(y0 - y) * sprite->width + (uint32_t)(x0 - x);
+  /* Whole sprite rows follow each other in saved, one window reads them all */
+  if (x1 - x0 == sprite->width) {
+    setAddressWindow((uint16_t)x0, (uint16_t)y0, (uint16_t)(x1 - 1), (uint16_t)(y1 - 1));
+    readPixelsFromGraphicsRAM(row, (uint32_t)((x1 - x0) * (y1 - y0)));
+    return;
+  }
+  for (; y0 < y1; y0++, row += sprite->width) {
+    setAddressWindow((uint16_t)x0, (uint16_t)y0, (uint16_t)(x1 - 1), (uint16_t)y0);
+    readPixelsFromGraphicsRAM(row, (uint32_t)(x1 - x0));
+  }
+}
+/**
+ * @brief Save the background under the sprite at its next position
+ * @details What the current and the next position share is already saved and
+ * only moves inside the buffer, the rest is read back from GRAM
+ */
+static void spriteSave(ILI9341Sprite_s *sprite, int32_t x, int32_t y) {
+  SpriteRect_s next, old;
+  int32_t x0, y0, x1, y1, row, shift;
+  if (!spriteVisible(sprite, x, y, &next))
+    return;
+  if (!sprite->shown || !spriteVisible(sprite, sprite->x, sprite->y, &old)) {
+    spriteReadBack(sprite, x, y, next.x0, next.y0, next.x1, next.y1);
+    return;
+  }
+  x0 = next.x0 > old.x0 ? next.x0 : old.x0;
+  y0 = next.y0 > old.y0 ? next.y0 : old.y0;
+  x1 = next.x1 < old.x1 ? next.x1 : old.x1;
+  y1 = next.y1 < old.y1 ? next.y1 : old.y1;
+  if (x0 >= x1 || y0 >= y1) {
+    spriteReadBack(sprite, x, y, next.x0, next.y0, next.x1, next.y1);
+    return;
+  }
+  /* A pixel moves by shift in the buffer, rows go in memmove order */
+  shift = (y - sprite->y) * sprite->width + (x - sprite->x);
+  for (row = 0; row < y1 - y0 && shift != 0; row++) {
+    int32_t screenY = shift > 0 ? y0 + row : y1 - 1 - row;
+    memmove(sprite->saved + (screenY - y) * sprite->width + (x0 - x),
+            sprite->saved + (screenY - sprite->y) * sprite->width + (x0 - sprite->x),
+            (size_t)(x1 - x0) * sizeof(uint16_t));
+  }
+  spriteReadBack(sprite, x, y, next.x0, next.y0, next.x1, y0);
+  spriteReadBack(sprite, x, y, next.x0, y1, next.x1, next.y1);
+  spriteReadBack(sprite, x, y, next.x0, y0, x0, y1);
+  spriteReadBack(sprite, x, y, x1, y0, next.x1, y1);
+}
+/**
+ * @brief Write the opaque row spans of the sprite at x, y
+ */
+static void spriteDraw(const ILI9341Sprite_s *sprite, int32_t x, int32_t y) {
+  SpriteRect_s rect;
+  int32_t screenY;
+  if (!spriteVisible(sprite, x, y, &rect))
+    return;
+  for (screenY = rect.y0; screenY < rect.y1; screenY++) {
+    const uint16_t *row = sprite->image + (uint32_t)(screenY - y) * sprite->width;
+    int32_t column = rect.x0 - x, end = rect.x1 - x;
+    while (column < end) {
+      int32_t start;
+      while (column < end && row[column] == sprite->key)
+        column++;
+      for (start = column; column < end && row[column] != sprite->key; column++)
+        ;
+      if (column > start) {
+        setAddressWindow((uint16_t)(x + start), (uint16_t)screenY, (uint16_t)(x + column - 1),
+                         (uint16_t)screenY);
+        writePixelsIntoGraphicsRAM(row + start, (uint32_t)(column - start));
+      }
+    }
+  }
+}
+
+uint8_t ILI9341SpriteInit(ILI9341Sprite_s *sprite, const uint16_t *image, uint16_t width, uint16_t height,
+                          uint16_t key, uint16_t *saved, ILI9341SpriteBackground_t background,
+                          void *context) {
+  sprite->image = image;
+  sprite->saved = saved;
+  sprite->background = background;
+  sprite->context = context;
+  sprite->width = width;
+  sprite->height = height;
+  sprite->key = key;
+  sprite->x = 0;
+  sprite->y = 0;
+  sprite->shown = 0;
+  return saved != NULL || (background != NULL && width <= ILI9341_SPRITE_MAX_WIDTH);
+}
+
+void ILI9341SpriteMove(ILI9341Sprite_s *sprite, int16_t x, int16_t y) {
+  if (sprite->saved == NULL && (sprite->background == NULL || sprite->width > ILI9341_SPRITE_MAX_WIDTH))
+    return;
+  if (sprite->shown && sprite->x == x && sprite->y == y)
+    return;
+  if (sprite->shown)
+    spriteUncover(sprite, x, y, 1);
+  if (sprite->saved != NULL)
+    spriteSave(sprite, x, y);
+  spriteDraw(sprite, x, y);
+  sprite->x = x;
+  sprite->y = y;
+  sprite->shown = 1;
+}
+
+void ILI9341SpriteHide(ILI9341Sprite_s *sprite) {
+  if (!sprite->shown)
+    return;
+  spriteUncover(sprite, 0, 0, 0);
+  sprite->shown = 0;
+}
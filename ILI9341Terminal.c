@@ -0,0 +1,292 @@
+/********************************************************************************************************
+ * @Filename: ILI9341Terminal.c
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: Character-cell terminal of ILI9341 Driver Library, dirty cells and hardware scrolling
+ *********************************************************************************************************/
+#include "ILI9341Private.h"
+#include <stdarg.h>
+#include <string.h>
+
+#define TERMINAL_DEFAULT_ATTRIBUTE ILI9341_TERMINAL_ATTRIBUTE(7, 0)
+#define TERMINAL_TAB_SIZE 8
+
+/**
+ * @brief CGA palette, the default colors of a terminal
+ */
+static const uint16_t terminalPalette[16] = {
+  0x0000, 0x0015, 0x0540, 0x0555, 0xA800, 0xA815, 0xAAA0, 0xAD55,
+  0x52AA, 0x52BF, 0x57EA, 0x57FF, 0xFAAA, 0xFABF, 0xFFEA, 0xFFFF
+};
+/**
+ * @brief Ring row holding a screen row
+ */
+static uint8_t ringRow(const ILI9341Terminal_s *terminal, uint8_t row) {
+  return (uint8_t)((terminal->top + row) % terminal->rows);
+}
+/**
+ * @brief Store a cell, only a changed cell becomes dirty
+ */
+static void setCell(ILI9341Terminal_s *terminal, uint8_t ring, uint8_t column,
+                    uint16_t codepoint, uint8_t attribute) {
+  if (terminal->cells[ring][column] == codepoint && terminal->attributes[ring][column] == attribute)
+    return;
+  terminal->cells[ring][column] = codepoint;
+  terminal->attributes[ring][column] = attribute;
+  terminal->dirty[ring] |= (uint64_t)1 << column;
+}
+/**
+ * @brief Blank a ring row with the current attribute
+ */
+static void clearRow(ILI9341Terminal_s *terminal, uint8_t ring) {
+  uint8_t column;
+  for (column = 0; column < terminal->columns; column++)
+    setCell(terminal, ring, column, ' ', terminal->attribute);
+}
+/**
+ * @brief Move the cursor to the next line, scrolling at the bottom
+ * @details The top ring row becomes the new bottom row. With hardware
+ * scrolling it stays in the same GRAM rows, so only its cells that differ
+ * from a blank are redrawn; without, every screen row shows another ring row
+ * and the whole grid is redrawn
+ */
+static void newLine(ILI9341Terminal_s *terminal) {
+  terminal->cursorColumn = 0;
+  if (terminal->cursorRow + 1 < terminal->rows) {
+    terminal->cursorRow++;
+    return;
+  }
+  terminal->top = ringRow(terminal, 1);
+  terminal->scrolled = 1;
+  clearRow(terminal, ringRow(terminal, terminal->rows - 1));
+  if (!terminal->hardwareScroll) {
+    uint8_t ring;
+    for (ring = 0; ring < terminal->rows; ring++)
+      terminal->dirty[ring] = terminal->columns == 64 ? ~(uint64_t)0 :
+                              ((uint64_t)1 << terminal->columns) - 1;
+  }
+}
+
+uint8_t ILI9341TerminalInit(ILI9341Terminal_s *terminal, uint16_t y, uint8_t rows, FontDef_s font) {
+  uint32_t fit = 0;
+  uint8_t ring;
+  terminal->font = font;
+  if (y < ILI9341_HEIGHT && font.height != 0)
+    fit = ((uint32_t)ILI9341_HEIGHT - y) / font.height;
+  if (rows > ILI9341_TERMINAL_MAX_ROWS)
+    rows = ILI9341_TERMINAL_MAX_ROWS;
+  if (rows > fit)
+    rows = (uint8_t)fit;
+  terminal->y = y;
+  terminal->rows = rows;
+  terminal->columns = font.width == 0 ? 0 : (uint8_t)(ILI9341_WIDTH / font.width);
+  if (terminal->columns > ILI9341_TERMINAL_MAX_COLUMNS)
+    terminal->columns = ILI9341_TERMINAL_MAX_COLUMNS;
+  if (terminal->columns > 64)
+    terminal->columns = 64;
+  terminal->top = 0;
+  terminal->cursorRow = 0;
+  terminal->cursorColumn = 0;
+  terminal->attribute = TERMINAL_DEFAULT_ATTRIBUTE;
+  terminal->scrolled = 0;
+  memcpy(terminal->palette, terminalPalette, sizeof(terminalPalette));
+  /* Left without rows, every later call on the terminal does nothing */
+  if (rows == 0 || terminal->columns == 0) {
+    terminal->rows = 0;
+    return 0;
+  }
+  for (ring = 0; ring < rows; ring++) {
+    memset(terminal->cells[ring], 0, sizeof(terminal->cells[ring]));
+    clearRow(terminal, ring);
+  }
+  terminal->hardwareScroll = ILI9341SetScrollArea(y, (uint16_t)(rows * font.height));
+  /* Cells are drawn on flush, this covers the rest of the rows right of the grid too */
+  ILI9341FillRectangle(0, y, ILI9341_WIDTH, (uint16_t)(rows * font.height),
+                       terminal->palette[TERMINAL_DEFAULT_ATTRIBUTE >> 4]);
+  for (ring = 0; ring < rows; ring++)
+    terminal->dirty[ring] = 0;
+  return 1;
+}
+
+void ILI9341TerminalSetAttribute(ILI9341Terminal_s *terminal, uint8_t attribute) {
+  terminal->attribute = attribute;
+}
+
+void ILI9341TerminalPutChar(ILI9341Terminal_s *terminal, uint32_t codepoint) {
+  if (terminal->rows == 0)
+    return;
+  switch (codepoint) {
+  case '\n':
+    newLine(terminal);
+    return;
+  case '\r':
+    terminal->cursorColumn = 0;
+    return;
+  case '\b':
+    if (terminal->cursorColumn > 0)
+      terminal->cursorColumn--;
+    return;
+  case '\t':
+    do {
+      ILI9341TerminalPutChar(terminal, ' ');
+    } while (terminal->cursorColumn % TERMINAL_TAB_SIZE != 0 &&
+             terminal->cursorColumn < terminal->columns);
+    return;
+  case '\f':
+    ILI9341TerminalClear(terminal);
+    return;
+  default:
+    break;
+  }
+  if (terminal->cursorColumn >= terminal->columns)
+    newLine(terminal);
+  setCell(terminal, ringRow(terminal, terminal->cursorRow), terminal->cursorColumn,
+          codepoint > 0xFFFF ? 0xFFFD : (uint16_t)codepoint, terminal->attribute);
+  terminal->cursorColumn++;
+}
+
+void ILI9341TerminalWrite(ILI9341Terminal_s *terminal, const char *string) {
+  while (*string != '\0')
+    ILI9341TerminalPutChar(terminal, utf8Next(&string));
+}
+/**
+ * @brief Write an integer in a field
+ * @param terminal terminal
+ * @param value magnitude
+ * @param negative write a minus sign
+ * @param base 10 or 16
+ * @param upper upper case hex digits
+ * @param width minimum field width
+ * @param flags '-' for left alignment, '0' for zero padding, 0 otherwise
+ * @return None
+ */
+static void putInteger(ILI9341Terminal_s *terminal, uint32_t value, uint8_t negative,
+                       uint8_t base, uint8_t upper, uint8_t width, char flags) {
+  const char *digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+  char buffer[10], *end = buffer + sizeof(buffer), *start = end;
+  uint8_t size;
+  if (base == 10) {
+    start = formatUnsigned(end, value);
+  } else {
+    do {
+      *--start = digits[value & 0x0F];
+      value >>= 4;
+    } while (value != 0);
+  }
+  size = (uint8_t)(end - start) + negative;
+  if (negative && flags == '0')
+    ILI9341TerminalPutChar(terminal, '-');
+  for (; flags != '-' && size < width; width--)
+    ILI9341TerminalPutChar(terminal, flags == '0' ? '0' : ' ');
+  if (negative && flags != '0')
+    ILI9341TerminalPutChar(terminal, '-');
+  while (start < end)
+    ILI9341TerminalPutChar(terminal, *start++);
+  for (; size < width; width--)
+    ILI9341TerminalPutChar(terminal, ' ');
+}
+
+void ILI9341TerminalPrintf(ILI9341Terminal_s *terminal, const char *format, ...) {
+  va_list arguments;
+  va_start(arguments, format);
+  while (*format != '\0') {
+    char flags = 0;
+    uint8_t width = 0, isLong = 0;
+    if (*format != '%') {
+      ILI9341TerminalPutChar(terminal, utf8Next(&format));
+      continue;
+    }
+    format++;
+    while (*format == '-' || *format == '0') {
+      if (flags != '-')
+        flags = *format;
+      format++;
+    }
+    while (*format >= '0' && *format <= '9')
+      width = (uint8_t)(width * 10 + (*format++ - '0'));
+    if (*format == 'l') {
+      isLong = 1;
+      format++;
+    }
+    switch (*format) {
+    case 'd':
+    case 'i': {
+      long value = isLong ? va_arg(arguments, long) : va_arg(arguments, int);
+      putInteger(terminal, value < 0 ? 0U - (uint32_t)value : (uint32_t)value, value < 0, 10, 0,
+                 width, flags);
+      break;
+    }
+    case 'u':
+      putInteger(terminal, isLong ? va_arg(arguments, unsigned long) : va_arg(arguments, unsigned),
+                 0, 10, 0, width, flags);
+      break;
+    case 'x':
+    case 'X':
+      putInteger(terminal, isLong ? va_arg(arguments, unsigned long) : va_arg(arguments, unsigned),
+                 0, 16, *format == 'X', width, flags);
+      break;
+    case 'c':
+      ILI9341TerminalPutChar(terminal, (uint32_t)va_arg(arguments, int));
+      break;
+    case 's': {
+      const char *string = va_arg(arguments, const char *);
+      uint8_t length = 0;
+      const char *end = string;
+      while (*end != '\0') {
+        utf8Next(&end);
+        length++;
+      }
+      for (; flags != '-' && length < width; width--)
+        ILI9341TerminalPutChar(terminal, ' ');
+      ILI9341TerminalWrite(terminal, string);
+      for (; length < width; width--)
+        ILI9341TerminalPutChar(terminal, ' ');
+      break;
+    }
+    case '%':
+      ILI9341TerminalPutChar(terminal, '%');
+      break;
+    default:
+      va_end(arguments);
+      return;
+    }
+    format++;
+  }
+  va_end(arguments);
+}
+
+void ILI9341TerminalClear(ILI9341Terminal_s *terminal) {
+  uint8_t ring;
+  for (ring = 0; ring < terminal->rows; ring++)
+    clearRow(terminal, ring);
+  terminal->cursorRow = 0;
+  terminal->cursorColumn = 0;
+}
+
+uint32_t ILI9341TerminalFlush(ILI9341Terminal_s *terminal) {
+  uint32_t drawn = 0;
+  uint8_t row;
+  if (terminal->scrolled && terminal->hardwareScroll)
+    ILI9341SetScrollOffset((uint16_t)(terminal->top * terminal->font.height));
+  terminal->scrolled = 0;
+  for (row = 0; row < terminal->rows; row++) {
+    uint8_t ring = ringRow(terminal, row);
+    /* Hardware scrolling keeps every ring row in its own GRAM rows */
+    uint8_t band = terminal->hardwareScroll ? ring : row;
+    uint16_t y = (uint16_t)(terminal->y + band * terminal->font.height);
+    uint64_t dirty = terminal->dirty[ring];
+    uint8_t column = 0;
+    terminal->dirty[ring] = 0;
+    for (; dirty != 0; dirty >>= 1, column++) {
+      uint8_t attribute;
+      if (!(dirty & 1))
+        continue;
+      attribute = terminal->attributes[ring][column];
+      drawChar((uint16_t)(column * terminal->font.width), y, terminal->cells[ring][column],
+               terminal->font, terminal->palette[attribute & 0x0F], terminal->palette[attribute >> 4]);
+      drawn++;
+    }
+  }
+  return drawn;
+}
@@ -1,6 +1,8 @@
 #include "ILI9341.h"
+#include "ILI9341Private.h"
+#include <string.h>
 
-void ILI9341TestFunction(void){
+void ILI9341TestScene(void){
     ILI9341Initialize();
     ILI9341BacklightControl(1);
     ILI9341FillScreen(RGB565_CYAN);
@@ -11,7 +13,184 @@ void ILI9341TestFunction(void){
     ILI9341DrawTriangle(200, 200, 0, 200, 0, 319, RGB565_WHITE); // Verified
     ILI9341DrawString(100, 300, "Hello,ILI9341!", Font_07x10, RGB565_BLUE, RGB565_CYAN); // Verified
     ILI9341DrawLine(0, 0, 240, 320, RGB565_RED); // Verified
+}
+
+void ILI9341TestFunction(void){
+    ILI9341TestScene();
     while(1) {
         
     }
-}
\ No newline at end of file
+}
+
+/**
+ * @brief DWT cycle counter of the Cortex-M4
+ */
+static void startCycleCounter(void){
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static uint32_t benchmarkNum;
+
+static void addResult(ILI9341BenchmarkResult_s *results, uint32_t maxResults,
+                        const char *name, uint32_t cycles, uint32_t pixels){
+    if(benchmarkNum >= maxResults)
+        return;
+    results[benchmarkNum].name = name;
+    results[benchmarkNum].cycles = cycles;
+    results[benchmarkNum].pixels = pixels;
+    results[benchmarkNum].bytes = 0;
+    benchmarkNum++;
+}
+
+static void addDecoderResult(ILI9341BenchmarkResult_s *results, uint32_t maxResults,
+                        const char *name, uint32_t cycles, uint32_t pixels, uint32_t bytes){
+    uint32_t index = benchmarkNum;
+    addResult(results, maxResults, name, cycles, pixels);
+    if(benchmarkNum > index)
+        results[index].bytes = bytes;
+}
+
+uint32_t ILI9341Benchmark(ILI9341BenchmarkResult_s *results, uint32_t maxResults){
+    static uint16_t line[ILI9341_WIDTH];
+    static uint8_t bits[ILI9341_WIDTH / 8];
+    // One row of UI art: a flat run, a 40-pixel gradient and another run
+    static uint16_t rleRow[2 + 41 + 2];
+    ILI9341RleImage_s rleImage = {ILI9341_WIDTH, 1, rleRow, sizeof(rleRow) / sizeof(rleRow[0])};
+    // One QOI row of a smooth gradient: a full color every fourth pixel, small steps between
+    static uint8_t qoiRow[14 + ILI9341_WIDTH / 4 * 4 + ILI9341_WIDTH / 4 * 3 + 8];
+    uint32_t qoiSize = 0;
+    ILI9341Readout_s readout;
+    char text[ILI9341_FORMAT_BUFFER_SIZE];
+    uint32_t cycles, i, row, cells;
+    benchmarkNum = 0;
+    for(i = 0; i < ILI9341_WIDTH; i++)
+        line[i] = RGB888ToRGB565(i, (255 - i), (i * 3));
+    for(i = 0; i < ILI9341_WIDTH / 8; i++)
+        bits[i] = 0xF0;
+    rleRow[0] = ILI9341_RLE_RUN | (100 - 1);
+    rleRow[1] = RGB565_DARKCYAN;
+    rleRow[2] = 40 - 1;
+    for(i = 0; i < 40; i++)
+        rleRow[3 + i] = line[i];
+    rleRow[43] = ILI9341_RLE_RUN | (ILI9341_WIDTH - 140 - 1);
+    rleRow[44] = RGB565_ORANGE;
+    memcpy(qoiRow, "qoif", 4);
+    qoiRow[4] = 0; qoiRow[5] = 0; qoiRow[6] = ILI9341_WIDTH >> 8; qoiRow[7] = ILI9341_WIDTH & 0xFF;
+    qoiRow[8] = 0; qoiRow[9] = 0; qoiRow[10] = 0; qoiRow[11] = 1;
+    qoiRow[12] = 3; qoiRow[13] = 0;
+    qoiSize = 14;
+    for(i = 0; i < ILI9341_WIDTH; i++){
+        if(i % 4 == 0){
+            qoiRow[qoiSize++] = 0xFE;
+            qoiRow[qoiSize++] = (uint8_t)i;
+            qoiRow[qoiSize++] = (uint8_t)(255 - i);
+            qoiRow[qoiSize++] = (uint8_t)(i * 3);
+        } else {
+            qoiRow[qoiSize++] = 0x40 | 3 << 4 | 2 << 2 | 3;
+        }
+    }
+    memset(qoiRow + qoiSize, 0, 7);
+    qoiRow[qoiSize + 7] = 1;
+    qoiSize += 8;
+    startCycleCounter();
+
+    // Reference: one 16-bit store per pixel, the loop the pump replaced
+    cycles = DWT->CYCCNT;
+    setAddressWindow(0, 0, ILI9341_WIDTH - 1, ILI9341_HEIGHT - 1);
+    for(i = ILI9341_WIDTH * ILI9341_HEIGHT; i > 0; i--)
+        writeGraphicsRAM(RGB565_RED);
+    addResult(results, maxResults, "fill 16-bit", DWT->CYCCNT - cycles,
+                ILI9341_WIDTH * ILI9341_HEIGHT);
+
+    cycles = DWT->CYCCNT;
+    ILI9341FillScreen(RGB565_BLUE);
+    addResult(results, maxResults, "fill pump", DWT->CYCCNT - cycles,
+                ILI9341_WIDTH * ILI9341_HEIGHT);
+
+    cycles = DWT->CYCCNT;
+    setAddressWindow(0, 0, ILI9341_WIDTH - 1, ILI9341_HEIGHT - 1);
+    for(row = 0; row < ILI9341_HEIGHT; row++)
+        for(i = 0; i < ILI9341_WIDTH; i++)
+            writeGraphicsRAM(line[i]);
+    addResult(results, maxResults, "image 16-bit", DWT->CYCCNT - cycles,
+                ILI9341_WIDTH * ILI9341_HEIGHT);
+
+    cycles = DWT->CYCCNT;
+    for(row = 0; row < ILI9341_HEIGHT; row++)
+        ILI9341DrawImage(0, row, ILI9341_WIDTH, 1, line);
+    addResult(results, maxResults, "image pump", DWT->CYCCNT - cycles,
+                ILI9341_WIDTH * ILI9341_HEIGHT);
+
+    cycles = DWT->CYCCNT;
+    for(row = 0; row < 12; row++)
+        ILI9341DrawString(0, row * 26, "0123456789ABCDE", Font_16x26,
+                            RGB565_WHITE, RGB565_BLACK);
+    addResult(results, maxResults, "glyph 16x26", DWT->CYCCNT - cycles,
+                12 * 15 * 16 * 26);
+
+    cycles = DWT->CYCCNT;
+    for(row = 0; row < 12; row++)
+        ILI9341DrawString(0, row * 26, "0123456789ABCDE", Font_16x26A2,
+                            RGB565_WHITE, RGB565_BLACK);
+    addResult(results, maxResults, "glyph 16x26 2bpp", DWT->CYCCNT - cycles,
+                12 * 15 * 16 * 26);
+
+    cycles = DWT->CYCCNT;
+    for(row = 0; row < 12; row++)
+        ILI9341DrawString(0, row * 26, "0123456789ABCDE", Font_16x26A4,
+                            RGB565_WHITE, RGB565_BLACK);
+    addResult(results, maxResults, "glyph 16x26 4bpp", DWT->CYCCNT - cycles,
+                12 * 15 * 16 * 26);
+
+    // 100 updates of a drifting 8-digit readout, whole string against changed cells
+    cycles = DWT->CYCCNT;
+    for(i = 0; i < 100; i++){
+        ILI9341FormatInteger(text, 229870 + i * 7, 3);
+        ILI9341DrawString(0, 0, text, Font_16x26, RGB565_WHITE, RGB565_BLACK);
+    }
+    addResult(results, maxResults, "readout string", DWT->CYCCNT - cycles,
+                100 * 7 * 16 * 26);
+
+    // Only changed cells are written, the pixels are what the field really drew
+    ILI9341ReadoutInit(&readout, 0, 0, Font_16x26, 7, 3, RGB565_WHITE, RGB565_BLACK);
+    cells = 0;
+    cycles = DWT->CYCCNT;
+    for(i = 0; i < 100; i++)
+        cells += ILI9341ReadoutSetInteger(&readout, 229870 + i * 7);
+    addResult(results, maxResults, "readout field", DWT->CYCCNT - cycles,
+                cells * 16 * 26);
+
+    // Screen of 4-pixel stripes, opaque through the nibble table and as set-bit spans
+    cycles = DWT->CYCCNT;
+    for(row = 0; row < ILI9341_HEIGHT; row++)
+        ILI9341DrawBitmap(0, row, ILI9341_WIDTH, 1, bits, RGB565_WHITE, RGB565_BLACK);
+    addResult(results, maxResults, "bitmap 1bpp", DWT->CYCCNT - cycles,
+                ILI9341_WIDTH * ILI9341_HEIGHT);
+
+    cycles = DWT->CYCCNT;
+    for(row = 0; row < ILI9341_HEIGHT; row++)
+        ILI9341DrawBitmapTransparent(0, row, ILI9341_WIDTH, 1, bits, RGB565_WHITE);
+    addResult(results, maxResults, "bitmap spans", DWT->CYCCNT - cycles,
+                ILI9341_WIDTH * ILI9341_HEIGHT / 2);
+
+    cycles = DWT->CYCCNT;
+    for(row = 0; row < ILI9341_HEIGHT; row++)
+        ILI9341DrawRleImage(0, row, &rleImage);
+    addDecoderResult(results, maxResults, "rle image", DWT->CYCCNT - cycles,
+                ILI9341_WIDTH * ILI9341_HEIGHT, sizeof(rleRow) * ILI9341_HEIGHT);
+
+    cycles = DWT->CYCCNT;
+    for(row = 0; row < ILI9341_HEIGHT; row++)
+        ILI9341DrawQoi(0, row, qoiRow, qoiSize);
+    addDecoderResult(results, maxResults, "qoi image", DWT->CYCCNT - cycles,
+                ILI9341_WIDTH * ILI9341_HEIGHT, qoiSize * ILI9341_HEIGHT);
+
+    cycles = DWT->CYCCNT;
+    for(row = 0; row < ILI9341_HEIGHT; row++)
+        ILI9341DrawLine(0, row, ILI9341_WIDTH - 1, row, RGB565_GREEN);
+    addResult(results, maxResults, "span", DWT->CYCCNT - cycles,
+                ILI9341_WIDTH * ILI9341_HEIGHT);
+    return benchmarkNum;
+}
@@ -0,0 +1,195 @@
+/********************************************************************************************************
+ * @Filename: ILI9341Text.c
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: Text layout of ILI9341 Driver Library, boxes, alignment, word wrap and cached layouts
+ *********************************************************************************************************/
+#include "ILI9341Private.h"
+
+#if ILI9341_TEXT_LAYOUT_CACHE > 0
+static ILI9341TextLayout_s textLayouts[ILI9341_TEXT_LAYOUT_CACHE];
+static uint32_t textLayoutLastUse[ILI9341_TEXT_LAYOUT_CACHE];
+static uint32_t textLayoutClock;
+#endif
+/**
+ * @brief FNV-1a hash of a string, tells a reused buffer with new content apart
+ * @param string string to hash
+ * @return hash of the string
+ */
+static uint32_t textHash(const char *string) {
+  uint32_t hash = 2166136261U;
+  while (*string != '\0')
+    hash = (hash ^ (uint8_t)*string++) * 16777619U;
+  return hash;
+}
+/**
+ * @brief Whether two font descriptions draw the same glyphs
+ */
+static uint8_t sameFont(const FontDef_s *a, const FontDef_s *b) {
+  return a->fontData == b->fontData && a->bitmap == b->bitmap && a->glyphs == b->glyphs &&
+         a->width == b->width && a->height == b->height;
+}
+/**
+ * @brief Whether a layout was made from this string, font and box
+ */
+static uint8_t layoutMatches(const ILI9341TextLayout_s *layout, const char *string,
+                             const FontDef_s *font, uint16_t width, uint16_t height,
+                             uint8_t flags, uint8_t lineSpacing) {
+  return layout->string == string && layout->width == width && layout->height == height &&
+         layout->flags == flags && layout->lineSpacing == lineSpacing &&
+         sameFont(&layout->font, font);
+}
+/**
+ * @brief Find the end of one line
+ * @details Pen and ink are tracked separately, so trailing spaces never count
+ * in the line width and the line breaks before the first glyph whose ink
+ * leaves the box
+ * @param font font of the string
+ * @param string first character of the line, set to the first character of
+ * the next line on return
+ * @param width width of the box
+ * @param wrap break at the box width or only at '\n'
+ * @param base string of the layout, line offsets are relative to it
+ * @param line line to fill, start is left to the caller
+ * @return None
+ */
+static void layoutLine(const FontDef_s *font, const char **string, int32_t width, uint8_t wrap,
+                       const char *base, ILI9341TextLine_s *line) {
+  const char *cursor = *string, *inkEnd = *string, *breakAt = 0, *breakInkEnd = 0;
+  int32_t pen = 0, ink = 0, breakInk = 0;
+  uint8_t softBreak = 0;
+  while (*cursor != '\0' && *cursor != '\n') {
+    const char *character = cursor, *peek;
+    uint32_t codepoint = utf8Next(&cursor), next;
+    if (codepoint == ' ') {
+      if (inkEnd > *string) {
+        breakAt = character;
+        breakInkEnd = inkEnd;
+        breakInk = ink;
+      }
+    } else {
+      int32_t right = pen + glyphInkRight(font, codepoint);
+      if (wrap && right > width && character > *string) {
+        if (breakAt != 0) {
+          inkEnd = breakInkEnd;
+          ink = breakInk;
+          cursor = breakAt;
+        } else {
+          cursor = character;
+        }
+        softBreak = 1;
+        break;
+      }
+      inkEnd = cursor;
+      ink = right;
+    }
+    peek = cursor;
+    next = (*peek != '\0' && *peek != '\n') ? utf8Next(&peek) : 0;
+    pen += glyphAdvance(font, codepoint, next);
+  }
+  line->length = (uint16_t)(inkEnd - (base + line->start));
+  line->width = (uint16_t)(ink > 0 ? ink : 0);
+  if (softBreak) {
+    while (*cursor == ' ')
+      cursor++;
+  }
+  if (*cursor == '\n')
+    cursor++;
+  *string = cursor;
+}
+
+uint8_t ILI9341LayoutText(ILI9341TextLayout_s *layout, const char *string, FontDef_s font,
+                          uint16_t width, uint16_t height, uint8_t flags, uint8_t lineSpacing) {
+  uint32_t hash = textHash(string), lineHeight = font.height + lineSpacing, maxLines;
+  const char *cursor = string;
+  if (layoutMatches(layout, string, &font, width, height, flags, lineSpacing) &&
+      layout->hash == hash)
+    return 0;
+  layout->string = string;
+  layout->hash = hash;
+  layout->font = font;
+  layout->width = width;
+  layout->height = height;
+  layout->flags = flags;
+  layout->lineSpacing = lineSpacing;
+  layout->lineNum = 0;
+  layout->extent.width = 0;
+  maxLines = (height + lineHeight - 1) / lineHeight;
+  if (maxLines > ILI9341_TEXT_MAX_LINES)
+    maxLines = ILI9341_TEXT_MAX_LINES;
+  while (*cursor != '\0' && layout->lineNum < maxLines) {
+    ILI9341TextLine_s *line = &layout->lines[layout->lineNum++];
+    line->start = (uint16_t)(cursor - string);
+    layoutLine(&font, &cursor, width, flags & ILI9341_TEXT_WRAP, string, line);
+    if (line->width > layout->extent.width)
+      layout->extent.width = line->width;
+  }
+  layout->extent.height = layout->lineNum == 0 ? 0 :
+                          (uint16_t)(layout->lineNum * lineHeight - lineSpacing);
+  return 1;
+}
+/**
+ * @brief Fill the part of a rectangle inside the box, x1 and y1 exclusive
+ */
+static void fillClipped(const TextClip_s *box, int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                        uint16_t color) {
+  if (x0 < box->x0) x0 = box->x0;
+  if (y0 < box->y0) y0 = box->y0;
+  if (x1 > box->x1) x1 = box->x1;
+  if (y1 > box->y1) y1 = box->y1;
+  if (x0 < x1 && y0 < y1)
+    ILI9341FillRectangle((uint16_t)x0, (uint16_t)y0, (uint16_t)(x1 - x0), (uint16_t)(y1 - y0), color);
+}
+
+void ILI9341DrawLayout(const ILI9341TextLayout_s *layout, uint16_t x, uint16_t y,
+                       uint16_t color, uint16_t bgColor) {
+  TextClip_s box = {x, y, x + layout->width, y + layout->height};
+  int32_t top = y, lineHeight = layout->font.height + layout->lineSpacing;
+  uint8_t align = layout->flags & ILI9341_TEXT_ALIGN_MASK, fill = layout->flags & ILI9341_TEXT_FILL;
+  uint32_t i;
+  if (box.x1 > ILI9341_WIDTH) box.x1 = ILI9341_WIDTH;
+  if (box.y1 > ILI9341_HEIGHT) box.y1 = ILI9341_HEIGHT;
+  for (i = 0; i < layout->lineNum; i++, top += lineHeight) {
+    const ILI9341TextLine_s *line = &layout->lines[i];
+    const char *start = layout->string + line->start;
+    int32_t left = x;
+    if (align == ILI9341_TEXT_ALIGN_CENTER)
+      left += ((int32_t)layout->width - line->width) / 2;
+    else if (align == ILI9341_TEXT_ALIGN_RIGHT)
+      left += (int32_t)layout->width - line->width;
+    drawTextRun(left, top, start, start + line->length, line->width, &layout->font,
+                color, bgColor, &box);
+    if (fill) {
+      fillClipped(&box, box.x0, top, left, top + layout->font.height, bgColor);
+      fillClipped(&box, left + line->width, top, box.x1, top + layout->font.height, bgColor);
+      fillClipped(&box, box.x0, top + layout->font.height, box.x1, top + lineHeight, bgColor);
+    }
+  }
+  if (fill)
+    fillClipped(&box, box.x0, top, box.x1, box.y1, bgColor);
+}
+
+void ILI9341DrawTextBox(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                        const char *string, FontDef_s font, uint8_t flags, uint8_t lineSpacing,
+                        uint16_t color, uint16_t bgColor) {
+#if ILI9341_TEXT_LAYOUT_CACHE > 0
+  uint32_t i, slot = 0;
+  for (i = 0; i < ILI9341_TEXT_LAYOUT_CACHE; i++) {
+    if (layoutMatches(&textLayouts[i], string, &font, width, height, flags, lineSpacing)) {
+      slot = i;
+      break;
+    }
+    if (textLayoutLastUse[i] < textLayoutLastUse[slot])
+      slot = i;
+  }
+  textLayoutLastUse[slot] = ++textLayoutClock;
+  ILI9341LayoutText(&textLayouts[slot], string, font, width, height, flags, lineSpacing);
+  ILI9341DrawLayout(&textLayouts[slot], x, y, color, bgColor);
+#else
+  ILI9341TextLayout_s layout;
+  layout.string = 0;
+  ILI9341LayoutText(&layout, string, font, width, height, flags, lineSpacing);
+  ILI9341DrawLayout(&layout, x, y, color, bgColor);
+#endif
+}
@@ -0,0 +1,158 @@
+/********************************************************************************************************
+ * @Filename: ILI9341Timing.c
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: FSMC timing calibration of ILI9341 Driver Library
+ *********************************************************************************************************/
+#include "ILI9341Private.h"
+
+/**
+ * @brief Limits of the FSMC timing fields (ADDSET, DATAST)
+ */
+#define TIMING_ADDRESS_SETUP_MAX 15
+#define TIMING_DATA_SETUP_MIN 1
+#define TIMING_DATA_SETUP_MAX 255
+/**
+ * @brief Test area, the top-left corner of the panel
+ */
+#define TIMING_TEST_WIDTH 16
+#define TIMING_TEST_HEIGHT 2
+#define TIMING_TEST_PIXELS (TIMING_TEST_WIDTH * TIMING_TEST_HEIGHT)
+#define TIMING_PATTERN_NUM 4
+
+static const ILI9341Timing_s slowestTiming = {
+  TIMING_ADDRESS_SETUP_MAX, TIMING_DATA_SETUP_MAX,
+  TIMING_ADDRESS_SETUP_MAX, TIMING_DATA_SETUP_MAX
+};
+static ILI9341Timing_s storedTiming;
+static uint8_t timingStored;
+/**
+ * @brief Test patterns, toggling every data line between neighbouring pixels
+ * @param pattern pattern number
+ * @param index pixel index
+ * @return pixel value
+ */
+static uint16_t patternPixel(uint8_t pattern, uint32_t index) {
+  switch (pattern) {
+  case 0:
+    return (index & 1) ? 0xFFFF : 0x0000;
+  case 1:
+    return (index & 1) ? 0x5555 : 0xAAAA;
+  case 2:
+    return (uint16_t)(1 << (index & 15)) ^ ((index & 16) ? 0xFFFF : 0x0000);
+  default:
+    return (uint16_t)(index * 0x9E37 + 0x7F4A);
+  }
+}
+/**
+ * @brief Write all patterns with the write timing under test and read them
+ * back with the read timing under test
+ * @param windowTiming timing used to set the address window and commands
+ * @param writeTiming timing used for the pixel writes
+ * @param readTiming timing used for the pixel reads
+ * @return 1 when every pixel reads back unchanged
+ */
+static uint8_t patternsPass(ILI9341TimingApply_t apply, const ILI9341Timing_s *windowTiming,
+                            const ILI9341Timing_s *writeTiming,
+                            const ILI9341Timing_s *readTiming) {
+  uint16_t readBack[TIMING_TEST_PIXELS];
+  for (uint8_t pattern = 0; pattern < TIMING_PATTERN_NUM; pattern++) {
+    apply(windowTiming);
+    setAddressWindow(0, 0, TIMING_TEST_WIDTH - 1, TIMING_TEST_HEIGHT - 1);
+    apply(writeTiming);
+    for (uint32_t i = 0; i < TIMING_TEST_PIXELS; i++)
+      writeGraphicsRAM(patternPixel(pattern, i));
+    apply(windowTiming);
+    setAddressWindow(0, 0, TIMING_TEST_WIDTH - 1, TIMING_TEST_HEIGHT - 1);
+    apply(readTiming);
+    readPixelsFromGraphicsRAM(readBack, TIMING_TEST_PIXELS);
+    for (uint32_t i = 0; i < TIMING_TEST_PIXELS; i++)
+      if (readBack[i] != patternPixel(pattern, i))
+        return 0;
+  }
+  return 1;
+}
+/**
+ * @brief Search the cheapest passing (address setup, data setup) pair of one
+ * direction, the other direction stays at the slowest timing
+ * @param write 1 to calibrate writes, 0 to calibrate reads
+ * @param base timing used for everything that is not under test
+ * @param addressSetup receives the address setup
+ * @param dataSetup receives the data setup
+ */
+static void searchTiming(ILI9341TimingApply_t apply, uint8_t write,
+                         const ILI9341Timing_s *base,
+                         uint8_t *addressSetup, uint8_t *dataSetup) {
+  ILI9341Timing_s candidate = *base;
+  uint16_t bestCost = TIMING_ADDRESS_SETUP_MAX + TIMING_DATA_SETUP_MAX;
+  *addressSetup = TIMING_ADDRESS_SETUP_MAX;
+  *dataSetup = TIMING_DATA_SETUP_MAX;
+  for (uint8_t setup = 0; setup <= TIMING_ADDRESS_SETUP_MAX && setup < bestCost; setup++) {
+    uint16_t low = TIMING_DATA_SETUP_MIN, high = TIMING_DATA_SETUP_MAX + 1;
+    /* Passing is monotonic in the data setup, bisect its lowest passing value,
+     * ending at TIMING_DATA_SETUP_MAX + 1 when nothing passes */
+    while (low < high) {
+      uint16_t middle = (low + high) / 2;
+      if (write) {
+        candidate.writeAddressSetup = setup;
+        candidate.writeDataSetup = (uint8_t)middle;
+      } else {
+        candidate.readAddressSetup = setup;
+        candidate.readDataSetup = (uint8_t)middle;
+      }
+      if (write ? patternsPass(apply, base, &candidate, base)
+                : patternsPass(apply, base, base, &candidate))
+        high = middle;
+      else
+        low = middle + 1;
+    }
+    if (low <= TIMING_DATA_SETUP_MAX && setup + low < bestCost) {
+      bestCost = setup + low;
+      *addressSetup = setup;
+      *dataSetup = (uint8_t)low;
+    }
+  }
+}
+/**
+ * @brief Add the safety margin to the data setup time
+ */
+static uint8_t addMargin(uint8_t addressSetup, uint8_t dataSetup) {
+  uint32_t margin = ((uint32_t)addressSetup + dataSetup + 1) * ILI9341_TIMING_MARGIN_PERCENT;
+  uint32_t withMargin = dataSetup + (margin + 99) / 100;
+  return withMargin > TIMING_DATA_SETUP_MAX ? TIMING_DATA_SETUP_MAX : (uint8_t)withMargin;
+}
+
+uint8_t ILI9341CalibrateTiming(ILI9341TimingApply_t apply, ILI9341Timing_s *result) {
+  ILI9341Timing_s timing = slowestTiming, writesDone;
+  uint8_t failed = 0;
+  if (!patternsPass(apply, &slowestTiming, &slowestTiming, &slowestTiming)) {
+    apply(&slowestTiming);
+    return 1;
+  }
+  searchTiming(apply, 1, &slowestTiming, &timing.writeAddressSetup, &timing.writeDataSetup);
+  timing.writeDataSetup = addMargin(timing.writeAddressSetup, timing.writeDataSetup);
+  writesDone = slowestTiming;
+  writesDone.writeAddressSetup = timing.writeAddressSetup;
+  writesDone.writeDataSetup = timing.writeDataSetup;
+  searchTiming(apply, 0, &writesDone, &timing.readAddressSetup, &timing.readDataSetup);
+  timing.readDataSetup = addMargin(timing.readAddressSetup, timing.readDataSetup);
+  /* Final check with every access at the calibrated timing */
+  if (!patternsPass(apply, &timing, &timing, &timing)) {
+    timing = slowestTiming;
+    failed = 1;
+  }
+  apply(&timing);
+  setAddressWindow(0, 0, TIMING_TEST_WIDTH - 1, TIMING_TEST_HEIGHT - 1);
+  for (uint32_t i = 0; i < TIMING_TEST_PIXELS; i++)
+    writeGraphicsRAM(RGB565_BLACK);
+  storedTiming = timing;
+  timingStored = 1;
+  if (result != 0)
+    *result = timing;
+  return failed;
+}
+
+const ILI9341Timing_s *ILI9341GetTiming(void) {
+  return timingStored ? &storedTiming : 0;
+}
@@ -0,0 +1,204 @@
+/********************************************************************************************************
+ * @Filename: ILI9341Trace.c
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: Bus trace recorder of ILI9341 Driver Library, see ILI9341Trace.h for the format
+ *********************************************************************************************************/
+#include "ILI9341Trace.h"
+
+#define TRACE_CHUNK_SIZE 32
+#define TRACE_RECORD_MAX 12
+
+static struct {
+  uint8_t active;
+  uint8_t *ring;
+  uint32_t size;
+  volatile uint32_t head;
+  volatile uint32_t tail;
+  uint32_t dropped;
+  uint32_t droppedPending;
+  ILI9341TraceCallback_t callback;
+  uint8_t chunk[TRACE_CHUNK_SIZE];
+  uint32_t chunkLength;
+  uint16_t runValue;
+  uint32_t runLength;
+  uint32_t readLength;
+} trace;
+/**
+ * @brief Append an unsigned LEB128 varint
+ * @return record length after appending
+ */
+static uint32_t putVarint(uint8_t *record, uint32_t length, uint32_t value) {
+  while (value >= 0x80) {
+    record[length++] = (uint8_t)(value | 0x80);
+    value >>= 7;
+  }
+  record[length++] = (uint8_t)value;
+  return length;
+}
+
+static uint32_t ringFree(void) {
+  return (trace.tail + trace.size - trace.head - 1) % trace.size;
+}
+/**
+ * @brief Emit one whole record, the ring drops whole records only so the
+ * stream always stays parseable
+ */
+static void emitRecord(const uint8_t *record, uint32_t length) {
+  if (trace.callback != 0) {
+    for (uint32_t i = 0; i < length; i++) {
+      trace.chunk[trace.chunkLength++] = record[i];
+      if (trace.chunkLength == TRACE_CHUNK_SIZE) {
+        trace.callback(trace.chunk, trace.chunkLength);
+        trace.chunkLength = 0;
+      }
+    }
+    return;
+  }
+  if (trace.droppedPending != 0) {
+    uint8_t note[TRACE_RECORD_MAX];
+    uint32_t noteLength;
+    note[0] = ILI9341_TRACE_TAG_DROPPED;
+    noteLength = putVarint(note, 1, trace.droppedPending);
+    if (ringFree() < noteLength + length) {
+      trace.droppedPending++;
+      trace.dropped++;
+      return;
+    }
+    trace.droppedPending = 0;
+    emitRecord(note, noteLength);
+  }
+  if (ringFree() < length) {
+    trace.droppedPending++;
+    trace.dropped++;
+    return;
+  }
+  for (uint32_t i = 0; i < length; i++) {
+    trace.ring[trace.head] = record[i];
+    trace.head = (trace.head + 1) % trace.size;
+  }
+}
+/**
+ * @brief Emit the pending run of identical data writes or reads
+ */
+static void flushRuns(void) {
+  uint8_t record[TRACE_RECORD_MAX];
+  uint32_t length;
+  if (trace.runLength == 1) {
+    record[0] = ILI9341_TRACE_TAG_DATA;
+    record[1] = (uint8_t)trace.runValue;
+    record[2] = (uint8_t)(trace.runValue >> 8);
+    emitRecord(record, 3);
+  } else if (trace.runLength > 1) {
+    record[0] = ILI9341_TRACE_TAG_DATA_RUN;
+    length = putVarint(record, 1, trace.runLength);
+    record[length++] = (uint8_t)trace.runValue;
+    record[length++] = (uint8_t)(trace.runValue >> 8);
+    emitRecord(record, length);
+  }
+  trace.runLength = 0;
+  if (trace.readLength != 0) {
+    record[0] = ILI9341_TRACE_TAG_READ;
+    emitRecord(record, putVarint(record, 1, trace.readLength));
+    trace.readLength = 0;
+  }
+}
+
+static void start(void) {
+  const uint8_t header[] = {'I', 'L', 'T', ILI9341_TRACE_VERSION};
+  trace.dropped = 0;
+  trace.droppedPending = 0;
+  trace.chunkLength = 0;
+  trace.runLength = 0;
+  trace.readLength = 0;
+  emitRecord(header, sizeof(header));
+  trace.active = 1;
+}
+
+uint8_t ILI9341TraceStartRing(uint8_t *buffer, uint32_t size) {
+  trace.active = 0;
+  trace.callback = 0;
+  trace.ring = 0;
+  /* The ring keeps one byte free, the header needs four */
+  if (buffer == 0 || size < ILI9341_TRACE_RING_MIN_SIZE)
+    return 0;
+  trace.ring = buffer;
+  trace.size = size;
+  trace.head = 0;
+  trace.tail = 0;
+  start();
+  return 1;
+}
+
+void ILI9341TraceStartCallback(ILI9341TraceCallback_t callback) {
+  trace.active = 0;
+  trace.callback = callback;
+  start();
+}
+
+void ILI9341TraceFlush(void) {
+  if (!trace.active)
+    return;
+  flushRuns();
+  if (trace.callback != 0 && trace.chunkLength != 0) {
+    trace.callback(trace.chunk, trace.chunkLength);
+    trace.chunkLength = 0;
+  }
+}
+
+void ILI9341TraceStop(void) {
+  ILI9341TraceFlush();
+  trace.active = 0;
+}
+
+void ILI9341TraceMark(uint32_t id) {
+  uint8_t record[TRACE_RECORD_MAX];
+  if (!trace.active)
+    return;
+  flushRuns();
+  record[0] = ILI9341_TRACE_TAG_MARK;
+  emitRecord(record, putVarint(record, 1, id));
+}
+
+uint32_t ILI9341TraceRead(uint8_t *buffer, uint32_t size) {
+  uint32_t length = 0;
+  if (trace.ring == 0)
+    return 0;
+  while (length < size && trace.tail != trace.head) {
+    buffer[length++] = trace.ring[trace.tail];
+    trace.tail = (trace.tail + 1) % trace.size;
+  }
+  return length;
+}
+
+uint32_t ILI9341TraceDropped(void) { return trace.dropped; }
+
+uint8_t ILI9341TraceActive(void) { return trace.active; }
+
+void ILI9341TraceCommand(uint16_t value) {
+  uint8_t record[2];
+  if (!trace.active)
+    return;
+  flushRuns();
+  record[0] = ILI9341_TRACE_TAG_COMMAND;
+  record[1] = (uint8_t)value;
+  emitRecord(record, 2);
+}
+
+void ILI9341TraceData(uint16_t value) {
+  if (!trace.active)
+    return;
+  if (trace.readLength != 0 || (trace.runLength != 0 && value != trace.runValue))
+    flushRuns();
+  trace.runValue = value;
+  trace.runLength++;
+}
+
+void ILI9341TraceReadData(void) {
+  if (!trace.active)
+    return;
+  if (trace.runLength != 0)
+    flushRuns();
+  trace.readLength++;
+}
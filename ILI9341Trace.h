@@ -0,0 +1,107 @@
+/********************************************************************************************************
+ * @Filename: ILI9341Trace.h
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: Bus trace recorder of ILI9341 Driver Library
+ * @details The trace starts with the bytes 'I' 'L' 'T' and the format version, followed by records.
+ * Every record is one tag byte and its payload, counts are unsigned LEB128 varints and pixels are
+ * little endian:
+ *   0x01 command       u8 command
+ *   0x02 data          u16 value
+ *   0x03 data run      varint count, u16 value (count identical data writes)
+ *   0x04 read          varint count of data reads
+ *   0x05 mark          varint id passed to ILI9341TraceMark
+ *   0x06 dropped       varint count of records lost because the ring was full
+ *********************************************************************************************************/
+#ifndef __STM32_ILI9341_LIB_TRACE_HEADER__
+#define __STM32_ILI9341_LIB_TRACE_HEADER__
+
+#include <stdint.h>
+#include "ILI9341Cfg.h"
+
+#define ILI9341_TRACE_VERSION 1
+/**
+ * @brief Smallest ring, it holds size - 1 bytes and the stream header takes four
+ */
+#define ILI9341_TRACE_RING_MIN_SIZE 5
+
+#define ILI9341_TRACE_TAG_COMMAND 0x01
+#define ILI9341_TRACE_TAG_DATA 0x02
+#define ILI9341_TRACE_TAG_DATA_RUN 0x03
+#define ILI9341_TRACE_TAG_READ 0x04
+#define ILI9341_TRACE_TAG_MARK 0x05
+#define ILI9341_TRACE_TAG_DROPPED 0x06
+
+/**
+ * @brief Trace sink called with every completed chunk of the byte stream
+ */
+typedef void (*ILI9341TraceCallback_t)(const uint8_t *bytes, uint32_t length);
+
+/**
+ * @brief Start recording into a RAM ring, drain it with ILI9341TraceRead
+ * @param buffer ring storage
+ * @param size ring size in bytes, at least ILI9341_TRACE_RING_MIN_SIZE
+ * @return 0 when buffer is NULL or too small, tracing stays stopped then
+ */
+uint8_t ILI9341TraceStartRing(uint8_t *buffer, uint32_t size);
+/**
+ * @brief Start recording into a callback, e.g. a UART or a file on the host
+ * @param callback sink receiving chunks of at most 32 bytes
+ * @return None
+ */
+void ILI9341TraceStartCallback(ILI9341TraceCallback_t callback);
+/**
+ * @brief Flush pending runs and stop recording
+ * @return None
+ */
+void ILI9341TraceStop(void);
+/**
+ * @brief Flush pending runs, so everything recorded so far can be read
+ * @return None
+ */
+void ILI9341TraceFlush(void);
+/**
+ * @brief Insert a mark, e.g. at the start of every frame
+ * @param id user defined number
+ * @return None
+ */
+void ILI9341TraceMark(uint32_t id);
+/**
+ * @brief Drain bytes from the RAM ring
+ * @param buffer destination
+ * @param size destination size
+ * @return number of bytes copied
+ */
+uint32_t ILI9341TraceRead(uint8_t *buffer, uint32_t size);
+/**
+ * @brief Number of records dropped since the trace started
+ * @return dropped records
+ */
+uint32_t ILI9341TraceDropped(void);
+/**
+ * @brief Whether a trace is recording
+ * @return 1 while recording, 0 otherwise
+ */
+uint8_t ILI9341TraceActive(void);
+
+/**
+ * @brief Hooks called by the bus accessors of the driver
+ */
+void ILI9341TraceCommand(uint16_t value);
+void ILI9341TraceData(uint16_t value);
+void ILI9341TraceReadData(void);
+
+#if ILI9341_ENABLE_BUS_TRACE == 1
+  #define ILI9341_TRACE_COMMAND(value) ILI9341TraceCommand(value)
+  #define ILI9341_TRACE_DATA(value) ILI9341TraceData(value)
+  #define ILI9341_TRACE_READ() ILI9341TraceReadData()
+  #define ILI9341_TRACE_ACTIVE() ILI9341TraceActive()
+#else
+  #define ILI9341_TRACE_COMMAND(value) ((void)0)
+  #define ILI9341_TRACE_DATA(value) ((void)0)
+  #define ILI9341_TRACE_READ() ((void)0)
+  #define ILI9341_TRACE_ACTIVE() 0
+#endif
+
+#endif
@@ -0,0 +1,579 @@
+/********************************************************************************************************
+ * @Filename: FontCompiler.cpp
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: Host-side font compiler of ILI9341 Driver Library. Rasterizes a character subset of a
+ *               TrueType/OpenType font with FreeType into a Unicode FontDef_s (see Fonts/fonts.h)
+ *
+ * ILI9341FontCompiler -f font.ttf -s 16 -n Font_Name [-c text] [-C text.txt] [-r 0x4E00-0x4E0F]
+ *                     [--cell [width]] [-b 1|2|4] [-z raw|rle|delta] [-v] [-o font.c]
+ *
+ * The subset is every character of -c strings and -C UTF-8 files plus -r ranges, U+0020 is always
+ * included and becomes glyph 0, drawn for characters missing in the subset. Without --cell the font is
+ * proportional: glyphs are cropped to their ink box and indexed by an offset table, which limits the
+ * bitmap to 64 KiB. --cell draws every glyph into a fixed cell instead, glyphs then follow each other
+ * at a fixed size with no offset table, which suits thousands of CJK glyphs. Anti-aliased glyphs
+ * (-b 2 or 4) need --cell. A character missing in the font file fails the compilation.
+ *
+ * -z compresses the glyphs of a 1 bit per pixel --cell font with the RLE or row-delta encoding of
+ * Fonts/fonts.h, the glyphs are then indexed by an offset table again. Every compilation of such a font
+ * reports size and decode steps (decoder loop iterations per glyph) of all three encodings to choose
+ * from, -v lists them per glyph.
+ *********************************************************************************************************/
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+
+/* The renderer decodes rows of up to 32 pixels */
+constexpr int MaxGlyphWidth = 32;
+/* The row decoder reads up to four bytes past the row start */
+constexpr int BitmapTailPadding = 4;
+
+/* Values of FONT_ENCODING_* in Fonts/fonts.h */
+enum Encoding { EncodingRaw = 0, EncodingRle = 1, EncodingRowDelta = 2 };
+const char *const EncodingNames[] = {"raw", "rle", "delta"};
+
+struct Options {
+  std::string fontFile;
+  std::string name;
+  std::string output;
+  int pixelSize = 0;
+  int bpp = 1;
+  bool cell = false;
+  int cellWidth = 0;
+  Encoding encoding = EncodingRaw;
+  bool verbose = false;
+  std::set<uint32_t> codepoints;
+};
+
+struct Glyph {
+  uint32_t codepoint = 0;
+  int advance = 0;
+  int offsetX = 0;
+  int offsetY = 0;
+  int boxWidth = 0;
+  int boxHeight = 0;
+  std::vector<uint8_t> levels; /* boxWidth * boxHeight coverage levels */
+  std::vector<uint8_t> packed;
+  int decodeSteps = 0;
+};
+
+[[noreturn]] void fail(const std::string &message) {
+  std::fprintf(stderr, "ILI9341FontCompiler: %s\n", message.c_str());
+  std::exit(1);
+}
+
+std::string codepointName(uint32_t codepoint) {
+  char text[16];
+  std::snprintf(text, sizeof(text), "U+%04X", codepoint);
+  return text;
+}
+
+/**
+ * @brief Decode UTF-8 text into codepoints, malformed bytes fail the compilation
+ */
+void decodeUtf8(const std::string &text, std::set<uint32_t> &codepoints) {
+  for (size_t i = 0; i < text.size();) {
+    uint8_t lead = static_cast<uint8_t>(text[i]);
+    uint32_t codepoint;
+    size_t length;
+    if (lead < 0x80) {
+      codepoint = lead;
+      length = 1;
+    } else if ((lead & 0xE0) == 0xC0) {
+      codepoint = lead & 0x1F;
+      length = 2;
+    } else if ((lead & 0xF0) == 0xE0) {
+      codepoint = lead & 0x0F;
+      length = 3;
+    } else if ((lead & 0xF8) == 0xF0) {
+      codepoint = lead & 0x07;
+      length = 4;
+    } else {
+      fail("malformed UTF-8 at byte " + std::to_string(i));
+    }
+    if (i + length > text.size())
+      fail("truncated UTF-8 at byte " + std::to_string(i));
+    for (size_t j = 1; j < length; j++) {
+      uint8_t byte = static_cast<uint8_t>(text[i + j]);
+      if ((byte & 0xC0) != 0x80)
+        fail("malformed UTF-8 at byte " + std::to_string(i + j));
+      codepoint = codepoint << 6 | (byte & 0x3F);
+    }
+    i += length;
+    if (codepoint >= 0x20 && codepoint != 0x7F)
+      codepoints.insert(codepoint);
+  }
+}
+
+uint32_t parseNumber(const std::string &text) {
+  char *end = nullptr;
+  unsigned long value = std::strtoul(text.c_str(), &end, 0);
+  if (text.empty() || *end != '\0')
+    fail("bad number '" + text + "'");
+  return static_cast<uint32_t>(value);
+}
+
+void usage() {
+  std::fprintf(stderr,
+               "usage: ILI9341FontCompiler -f font.ttf -s pixels -n Font_Name [-c text] [-C text.txt]\n"
+               "                           [-r first-last] [--cell [width]] [-b 1|2|4] [-z raw|rle|delta]\n"
+               "                           [-v] [-o font.c]\n");
+  std::exit(2);
+}
+
+Options parseOptions(int argc, char **argv) {
+  Options options;
+  for (int i = 1; i < argc; i++) {
+    std::string argument = argv[i];
+    auto value = [&]() -> std::string {
+      if (i + 1 >= argc)
+        usage();
+      return argv[++i];
+    };
+    if (argument == "-f") {
+      options.fontFile = value();
+    } else if (argument == "-s") {
+      options.pixelSize = static_cast<int>(parseNumber(value()));
+    } else if (argument == "-n") {
+      options.name = value();
+    } else if (argument == "-o") {
+      options.output = value();
+    } else if (argument == "-b") {
+      options.bpp = static_cast<int>(parseNumber(value()));
+    } else if (argument == "-c") {
+      decodeUtf8(value(), options.codepoints);
+    } else if (argument == "-C") {
+      std::string file = value();
+      std::ifstream input(file, std::ios::binary);
+      if (!input)
+        fail("cannot read " + file);
+      decodeUtf8(std::string(std::istreambuf_iterator<char>(input), {}), options.codepoints);
+    } else if (argument == "-r") {
+      std::string range = value();
+      size_t dash = range.find('-');
+      uint32_t first = parseNumber(range.substr(0, dash));
+      uint32_t last = dash == std::string::npos ? first : parseNumber(range.substr(dash + 1));
+      for (uint32_t codepoint = first; codepoint <= last; codepoint++)
+        options.codepoints.insert(codepoint);
+    } else if (argument == "-z") {
+      std::string name = value();
+      auto found = std::find(std::begin(EncodingNames), std::end(EncodingNames), name);
+      if (found == std::end(EncodingNames))
+        fail("unknown encoding '" + name + "'");
+      options.encoding = static_cast<Encoding>(found - std::begin(EncodingNames));
+    } else if (argument == "-v") {
+      options.verbose = true;
+    } else if (argument == "--cell") {
+      options.cell = true;
+      if (i + 1 < argc && std::isdigit(static_cast<unsigned char>(argv[i + 1][0])))
+        options.cellWidth = static_cast<int>(parseNumber(value()));
+    } else {
+      usage();
+    }
+  }
+  if (options.fontFile.empty() || options.name.empty() || options.pixelSize <= 0)
+    usage();
+  if (options.bpp != 1 && options.bpp != 2 && options.bpp != 4)
+    fail("bits per pixel must be 1, 2 or 4");
+  if (options.bpp != 1 && !options.cell)
+    fail("anti-aliased glyphs need --cell");
+  if (options.encoding != EncodingRaw && (options.bpp != 1 || !options.cell))
+    fail("compressed glyphs need --cell and 1 bit per pixel");
+  options.codepoints.insert(0x20);
+  for (uint32_t codepoint : options.codepoints)
+    if (codepoint > 0xFFFF)
+      fail(codepointName(codepoint) + " is outside the Basic Multilingual Plane");
+  if (options.codepoints.size() > 0xFFFF)
+    fail("more than 65535 glyphs");
+  return options;
+}
+
+/**
+ * @brief Render one glyph into coverage levels of the whole FreeType bitmap
+ */
+Glyph renderGlyph(FT_Face face, uint32_t codepoint, int bpp, int ascender) {
+  FT_UInt index = FT_Get_Char_Index(face, codepoint);
+  if (index == 0 && codepoint != 0x20)
+    return Glyph();
+  FT_Int32 flags = FT_LOAD_RENDER | (bpp == 1 ? FT_LOAD_TARGET_MONO : FT_LOAD_TARGET_NORMAL);
+  if (FT_Load_Glyph(face, index, flags) != 0)
+    fail("FreeType cannot render " + codepointName(codepoint));
+  const FT_GlyphSlot slot = face->glyph;
+  const FT_Bitmap &bitmap = slot->bitmap;
+  const int top = (1 << bpp) - 1;
+  Glyph glyph;
+  glyph.codepoint = codepoint;
+  glyph.advance = static_cast<int>((slot->advance.x + 32) >> 6);
+  glyph.offsetX = slot->bitmap_left;
+  glyph.offsetY = ascender - slot->bitmap_top;
+  glyph.boxWidth = static_cast<int>(bitmap.width);
+  glyph.boxHeight = static_cast<int>(bitmap.rows);
+  glyph.levels.resize(static_cast<size_t>(glyph.boxWidth) * glyph.boxHeight);
+  for (int y = 0; y < glyph.boxHeight; y++) {
+    const uint8_t *row = bitmap.buffer + y * bitmap.pitch;
+    for (int x = 0; x < glyph.boxWidth; x++) {
+      int level;
+      if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+        level = (row[x >> 3] >> (7 - (x & 7))) & 1 ? top : 0;
+      else
+        level = (row[x] * top + 127) / 255;
+      glyph.levels[static_cast<size_t>(y) * glyph.boxWidth + x] = static_cast<uint8_t>(level);
+    }
+  }
+  return glyph;
+}
+
+/**
+ * @brief Move the levels of a glyph into a box, clipping what falls outside
+ * @return number of inked pixels clipped away
+ */
+int placeGlyph(Glyph &glyph, int left, int top, int width, int height) {
+  std::vector<uint8_t> levels(static_cast<size_t>(width) * height, 0);
+  int clipped = 0;
+  for (int y = 0; y < glyph.boxHeight; y++)
+    for (int x = 0; x < glyph.boxWidth; x++) {
+      uint8_t level = glyph.levels[static_cast<size_t>(y) * glyph.boxWidth + x];
+      int targetX = glyph.offsetX + x - left, targetY = glyph.offsetY + y - top;
+      if (targetX < 0 || targetY < 0 || targetX >= width || targetY >= height)
+        clipped += level != 0;
+      else
+        levels[static_cast<size_t>(targetY) * width + targetX] = level;
+    }
+  glyph.levels = levels;
+  glyph.offsetX = left;
+  glyph.offsetY = top;
+  glyph.boxWidth = width;
+  glyph.boxHeight = height;
+  return clipped;
+}
+
+/**
+ * @brief Crop a proportional glyph to its ink box inside the line height
+ */
+int cropGlyph(Glyph &glyph, int height) {
+  int left = MaxGlyphWidth * 4, right = -MaxGlyphWidth * 4, top = height, bottom = -1;
+  for (int y = 0; y < glyph.boxHeight; y++)
+    for (int x = 0; x < glyph.boxWidth; x++)
+      if (glyph.levels[static_cast<size_t>(y) * glyph.boxWidth + x] != 0) {
+        left = std::min(left, glyph.offsetX + x);
+        right = std::max(right, glyph.offsetX + x);
+        top = std::min(top, glyph.offsetY + y);
+        bottom = std::max(bottom, glyph.offsetY + y);
+      }
+  top = std::max(top, 0);
+  bottom = std::min(bottom, height - 1);
+  if (right < left || bottom < top)
+    return placeGlyph(glyph, 0, 0, 0, 0);
+  return placeGlyph(glyph, left, top, right - left + 1, bottom - top + 1);
+}
+
+/**
+ * @brief MSB-first bitstream writer
+ */
+struct BitWriter {
+  std::vector<uint8_t> bytes;
+  uint32_t bit = 0;
+  void put(uint32_t value, int bits) {
+    for (int i = bits - 1; i >= 0; i--, bit++) {
+      if ((bit & 7) == 0)
+        bytes.push_back(0);
+      if ((value >> i) & 1)
+        bytes.back() |= static_cast<uint8_t>(0x80 >> (bit & 7));
+    }
+  }
+};
+
+/**
+ * @brief Plain bitstream, the decoder reads one window per row
+ */
+void packRaw(Glyph &glyph, int bpp) {
+  BitWriter writer;
+  for (uint8_t level : glyph.levels)
+    writer.put(level, bpp);
+  glyph.packed = writer.bytes;
+  glyph.decodeSteps = glyph.boxHeight;
+}
+
+/**
+ * @brief Nibble run lengths, the decoder steps once per nibble and once per run piece in a row
+ */
+void packRle(Glyph &glyph) {
+  BitWriter writer;
+  int steps = 0;
+  uint8_t color = 0;
+  size_t position = 0;
+  while (position < glyph.levels.size()) {
+    size_t run = 0;
+    while (position + run < glyph.levels.size() && (glyph.levels[position + run] != 0) == color)
+      run++;
+    /* Pieces of the run, one per row it touches */
+    if (run != 0 && glyph.boxWidth != 0)
+      steps += static_cast<int>((position + run - 1) / glyph.boxWidth - position / glyph.boxWidth + 1);
+    position += run;
+    for (; run >= 15; run -= 15, steps++)
+      writer.put(15, 4);
+    writer.put(static_cast<uint32_t>(run), 4);
+    steps++;
+    color ^= 1;
+  }
+  glyph.packed = writer.bytes;
+  glyph.decodeSteps = steps;
+}
+
+/**
+ * @brief Row flags, the decoder steps once per row and once more per new row
+ */
+void packRowDelta(Glyph &glyph) {
+  BitWriter writer;
+  std::vector<uint8_t> previous(glyph.boxWidth, 0);
+  int steps = 0;
+  for (int y = 0; y < glyph.boxHeight; y++) {
+    std::vector<uint8_t> row(glyph.levels.begin() + static_cast<size_t>(y) * glyph.boxWidth,
+                             glyph.levels.begin() + static_cast<size_t>(y + 1) * glyph.boxWidth);
+    steps++;
+    if (row == previous) {
+      writer.put(0, 1);
+      continue;
+    }
+    writer.put(1, 1);
+    for (uint8_t level : row)
+      writer.put(level != 0, 1);
+    previous = row;
+    steps++;
+  }
+  glyph.packed = writer.bytes;
+  glyph.decodeSteps = steps;
+}
+
+void packGlyph(Glyph &glyph, int bpp, Encoding encoding) {
+  if (encoding == EncodingRle)
+    packRle(glyph);
+  else if (encoding == EncodingRowDelta)
+    packRowDelta(glyph);
+  else
+    packRaw(glyph, bpp);
+}
+
+/**
+ * @brief Print size and decode steps of every encoding of a 1 bit per pixel cell font
+ */
+void reportEncodings(const Options &options, std::vector<Glyph> glyphs) {
+  size_t rawBytes = 0;
+  for (Glyph &glyph : glyphs) {
+    packRaw(glyph, 1);
+    rawBytes += glyph.packed.size();
+  }
+  std::vector<std::vector<Glyph>> encoded(3, glyphs);
+  for (int encoding = EncodingRaw; encoding <= EncodingRowDelta; encoding++) {
+    size_t bytes = 0;
+    int steps = 0, maxSteps = 0;
+    for (Glyph &glyph : encoded[encoding]) {
+      packGlyph(glyph, 1, static_cast<Encoding>(encoding));
+      bytes += glyph.packed.size();
+      steps += glyph.decodeSteps;
+      maxSteps = std::max(maxSteps, glyph.decodeSteps);
+    }
+    /* Compressed glyphs pay for their offset table */
+    if (encoding != EncodingRaw)
+      bytes += glyphs.size() * (bytes > 0xFFFF ? 4 : 2);
+    std::fprintf(stderr, "  %-5s %8zu bytes  ratio %5.2f  decode steps per glyph %6.1f avg %4d max%s\n",
+                 EncodingNames[encoding], bytes, static_cast<double>(rawBytes) / std::max<size_t>(bytes, 1),
+                 static_cast<double>(steps) / std::max<size_t>(glyphs.size(), 1), maxSteps,
+                 encoding == options.encoding ? "  <- selected" : "");
+  }
+  if (!options.verbose)
+    return;
+  std::fprintf(stderr, "  glyph     raw bytes/steps  rle bytes/steps  delta bytes/steps\n");
+  for (size_t i = 0; i < glyphs.size(); i++)
+    std::fprintf(stderr, "  %-8s  %9zu/%-5d  %9zu/%-5d  %11zu/%-5d\n",
+                 codepointName(glyphs[i].codepoint).c_str(),
+                 encoded[EncodingRaw][i].packed.size(), encoded[EncodingRaw][i].decodeSteps,
+                 encoded[EncodingRle][i].packed.size(), encoded[EncodingRle][i].decodeSteps,
+                 encoded[EncodingRowDelta][i].packed.size(), encoded[EncodingRowDelta][i].decodeSteps);
+}
+
+std::string glyphComment(uint32_t codepoint) {
+  std::string comment = "// " + codepointName(codepoint);
+  /* A trailing backslash would continue the line comment */
+  if (codepoint == '\\')
+    return comment;
+  comment += ' ';
+  if (codepoint < 0x80) {
+    comment += static_cast<char>(codepoint);
+  } else if (codepoint < 0x800) {
+    comment += static_cast<char>(0xC0 | codepoint >> 6);
+    comment += static_cast<char>(0x80 | (codepoint & 0x3F));
+  } else {
+    comment += static_cast<char>(0xE0 | codepoint >> 12);
+    comment += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+    comment += static_cast<char>(0x80 | (codepoint & 0x3F));
+  }
+  return comment;
+}
+
+std::string suffixOf(const std::string &name) {
+  return name.compare(0, 5, "Font_") == 0 ? name.substr(5) : name;
+}
+
+void emitFont(FILE *out, const Options &options, const std::vector<Glyph> &glyphs, int height, int width) {
+  const std::string suffix = suffixOf(options.name);
+  const char *file = std::strrchr(options.fontFile.c_str(), '/');
+  std::fprintf(out, "/* Generated by ILI9341FontCompiler from %s at %d px, do not edit */\n",
+               file ? file + 1 : options.fontFile.c_str(), options.pixelSize);
+  std::fprintf(out, "#include \"fonts.h\"\n\n");
+
+  std::vector<uint32_t> offsets;
+  uint32_t offset = 0;
+  std::fprintf(out, "static const uint8_t FontBitmap_%s[] = {\n", suffix.c_str());
+  for (const Glyph &glyph : glyphs) {
+    offsets.push_back(offset);
+    offset += static_cast<uint32_t>(glyph.packed.size());
+    if (glyph.packed.empty())
+      std::fprintf(out, "    %s\n", glyphComment(glyph.codepoint).c_str());
+    for (size_t start = 0; start < glyph.packed.size(); start += 12) {
+      std::fprintf(out, "    ");
+      for (size_t i = start; i < std::min(start + 12, glyph.packed.size()); i++)
+        std::fprintf(out, "0x%02X,%s", glyph.packed[i], i + 1 < std::min(start + 12, glyph.packed.size()) ? " " : "");
+      if (start + 12 >= glyph.packed.size())
+        std::fprintf(out, " %s", glyphComment(glyph.codepoint).c_str());
+      std::fprintf(out, "\n");
+    }
+  }
+  std::fprintf(out, "    0x00, 0x00, 0x00, 0x00\n};\n\n");
+  static_assert(BitmapTailPadding == 4, "update the padding line above");
+
+  /* Fixed size glyphs need no offset table, compressed ones do */
+  const bool indexed = !options.cell || options.encoding != EncodingRaw;
+  const bool longOffsets = indexed && offsets.back() > 0xFFFF;
+  if (longOffsets && !options.cell)
+    fail("bitmap exceeds the 64 KiB reach of the offset table, use --cell");
+  if (indexed) {
+    std::fprintf(out, "static const %s FontOffset_%s[] = {\n", longOffsets ? "uint32_t" : "uint16_t",
+                 suffix.c_str());
+    for (size_t start = 0; start < offsets.size(); start += 12) {
+      std::fprintf(out, "    ");
+      for (size_t i = start; i < std::min(start + 12, offsets.size()); i++)
+        std::fprintf(out, "%u,%s", offsets[i], i + 1 < std::min(start + 12, offsets.size()) ? " " : "");
+      std::fprintf(out, "\n");
+    }
+    std::fprintf(out, "};\n\n");
+  }
+
+  if (!options.cell) {
+    std::fprintf(out, "static const FontGlyph_s FontGlyphs_%s[] = {\n", suffix.c_str());
+    for (const Glyph &glyph : glyphs)
+      std::fprintf(out, "    {%d, %d, %d, %d, %d}, %s\n", glyph.advance, glyph.offsetX, glyph.offsetY,
+                   glyph.boxWidth, glyph.boxHeight, glyphComment(glyph.codepoint).c_str());
+    std::fprintf(out, "};\n\n");
+  }
+
+  std::fprintf(out, "static const uint16_t FontCodepoints_%s[] = {\n", suffix.c_str());
+  for (size_t start = 0; start < glyphs.size(); start += 8) {
+    std::fprintf(out, "    ");
+    for (size_t i = start; i < std::min(start + 8, glyphs.size()); i++)
+      std::fprintf(out, "0x%04X,%s", glyphs[i].codepoint, i + 1 < std::min(start + 8, glyphs.size()) ? " " : "");
+    std::fprintf(out, "\n");
+  }
+  std::fprintf(out, "};\n\n");
+
+  const std::string offsetTable = "FontOffset_" + suffix;
+  if (options.cell)
+    std::fprintf(out, "FontDef_s %s = {%d, %d, 0, FontBitmap_%s, %s, 0, 0,\n"
+                      "                      0, 0, 0, %d, FontCodepoints_%s, %zu, %d, %s};\n",
+                 options.name.c_str(), height, width, suffix.c_str(),
+                 indexed && !longOffsets ? offsetTable.c_str() : "0", options.bpp, suffix.c_str(),
+                 glyphs.size(), static_cast<int>(options.encoding),
+                 longOffsets ? offsetTable.c_str() : "0");
+  else
+    std::fprintf(out, "FontDef_s %s = {%d, %d, 0, FontBitmap_%s, FontOffset_%s, 0, 0,\n"
+                      "                      FontGlyphs_%s, 0, 0, 1, FontCodepoints_%s, %zu};\n",
+                 options.name.c_str(), height, width, suffix.c_str(), suffix.c_str(), suffix.c_str(),
+                 suffix.c_str(), glyphs.size());
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const Options options = parseOptions(argc, argv);
+  FT_Library library;
+  FT_Face face;
+  if (FT_Init_FreeType(&library) != 0)
+    fail("cannot initialize FreeType");
+  if (FT_New_Face(library, options.fontFile.c_str(), 0, &face) != 0)
+    fail("cannot open " + options.fontFile);
+  if (FT_Set_Pixel_Sizes(face, 0, static_cast<FT_UInt>(options.pixelSize)) != 0)
+    fail("cannot set the pixel size");
+
+  const int ascender = static_cast<int>((face->size->metrics.ascender + 63) >> 6);
+  const int descender = static_cast<int>((-face->size->metrics.descender + 63) >> 6);
+  const int height = ascender + descender;
+  if (height > 255)
+    fail("line height above 255 pixels");
+
+  std::vector<Glyph> glyphs;
+  std::string missing;
+  for (uint32_t codepoint : options.codepoints) {
+    Glyph glyph = renderGlyph(face, codepoint, options.bpp, ascender);
+    if (glyph.codepoint != codepoint) {
+      missing += glyphComment(codepoint).substr(3) + "\n";
+      continue;
+    }
+    glyphs.push_back(glyph);
+  }
+  if (!missing.empty())
+    fail("characters missing in " + options.fontFile + ":\n" + missing);
+
+  int width = options.cellWidth;
+  for (const Glyph &glyph : glyphs)
+    if (options.cellWidth == 0)
+      width = std::max(width, glyph.advance);
+  if (width > MaxGlyphWidth)
+    fail("glyphs wider than " + std::to_string(MaxGlyphWidth) + " pixels");
+
+  int clipped = 0;
+  for (Glyph &glyph : glyphs) {
+    if (options.cell) {
+      /* Center narrower glyphs in the cell */
+      glyph.offsetX += (width - glyph.advance) / 2;
+      clipped += placeGlyph(glyph, 0, 0, width, height);
+    } else {
+      clipped += cropGlyph(glyph, height);
+      if (glyph.boxWidth > MaxGlyphWidth || glyph.offsetX < -128 || glyph.offsetX > 127 || glyph.advance > 255)
+        fail(codepointName(glyph.codepoint) + " does not fit FontGlyph_s");
+    }
+    packGlyph(glyph, options.bpp, options.encoding);
+  }
+
+  FILE *out = options.output.empty() ? stdout : std::fopen(options.output.c_str(), "w");
+  if (out == nullptr)
+    fail("cannot write " + options.output);
+  emitFont(out, options, glyphs, height, width);
+  if (out != stdout)
+    std::fclose(out);
+
+  size_t bytes = 0;
+  for (const Glyph &glyph : glyphs)
+    bytes += glyph.packed.size();
+  std::fprintf(stderr, "%s: %zu glyphs, %dx%d cell, %zu bitmap bytes, %d clipped pixels\n",
+               options.name.c_str(), glyphs.size(), width, height, bytes + BitmapTailPadding, clipped);
+  if (options.cell && options.bpp == 1)
+    reportEncodings(options, glyphs);
+  FT_Done_Face(face);
+  FT_Done_FreeType(library);
+  return 0;
+}
@@ -0,0 +1,331 @@
+#!/usr/bin/env python3
+"""Pack fonts into the format of Fonts/fonts.h.
+
+Every glyph becomes a contiguous MSB-first bitstream, row after row, padded to
+a whole byte, and an offset table gives the first byte of each glyph.
+
+Usage: FontPack.py [-p Font_11x18]... [-a Font_11x18:4]... input.c > Fonts/fonts.c
+
+The input holds monospace fonts, either in the row table format (one uint16_t
+per glyph row, MSB is the leftmost pixel, `FontDef_s Font = {height, width,
+Name};`) or already packed by this tool, so Fonts/fonts.c itself is a valid
+input. Glyphs cover the printable ASCII range 32..126.
+
+-p NAME also emits NAMEP, a proportional variant of NAME: every glyph is
+cropped to its ink box, gets an advance width, and pairs whose silhouettes
+leave room get a kerning adjustment.
+
+-a NAME:BPP also emits NAMEA<BPP>, an anti-aliased 2 or 4 bits per pixel
+variant of NAME. The glyph is magnified 4x with Scale2x applied twice, which
+rounds off the diagonal steps and keeps straight strokes sharp, and every
+4x4 block is averaged back into a coverage level.
+
+Proportional and anti-aliased fonts in the input are skipped, they are
+regenerated from their monospace base.
+"""
+import argparse
+import re
+
+FIRST_CHAR = 32
+LAST_CHAR = 126
+GLYPH_NUM = LAST_CHAR - FIRST_CHAR + 1
+# The row decoder reads three bytes at a time, keep it inside the array
+BITMAP_TAIL_PADDING = 2
+# Kerning is only generated between these characters
+KERNING_CHARS = 'ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz.,'
+
+
+def strip_comments(text):
+    return re.sub(r'/\*.*?\*/|//[^\n]*', '', text, flags=re.S)
+
+
+def parse_arrays(source, element):
+    arrays = {}
+    pattern = r'static\s+const\s+%s\s+(\w+)\s*\[\s*\]\s*=\s*\{(.*?)\};' % element
+    for match in re.finditer(pattern, source, re.S):
+        body = strip_comments(match.group(2))
+        arrays[match.group(1)] = [int(value, 0) for value in re.findall(r'0x[0-9A-Fa-f]+|\d+', body)]
+    return arrays
+
+
+def unpack_glyph(bitmap, offset, height, width):
+    rows = []
+    for row in range(height):
+        value = 0
+        for column in range(width):
+            bit = row * width + column
+            if bitmap[offset + bit // 8] & (0x80 >> (bit % 8)):
+                value |= 0x8000 >> column
+        rows.append(value)
+    return rows
+
+
+def parse_fonts(source):
+    """Return [(name, height, width, [rows of every glyph])] of the monospace fonts."""
+    row_tables = parse_arrays(source, 'uint16_t')
+    bitmaps = parse_arrays(source, 'uint8_t')
+    fonts = []
+    for match in re.finditer(r'FontDef_s\s+(\w+)\s*=\s*\{\s*(\d+)\s*,\s*(\d+)\s*,\s*(\w+)\s*\}\s*;', source):
+        name, height, width, table = match.group(1), int(match.group(2)), int(match.group(3)), match.group(4)
+        rows = row_tables[table]
+        if len(rows) < GLYPH_NUM * height:
+            raise SystemExit('%s: expected %d rows, found %d' % (name, GLYPH_NUM * height, len(rows)))
+        fonts.append((name, height, width, [rows[g * height:(g + 1) * height] for g in range(GLYPH_NUM)]))
+    packed = r'FontDef_s\s+(\w+)\s*=\s*\{\s*(\d+)\s*,\s*(\d+)\s*,\s*0\s*,\s*(\w+)\s*,\s*(\w+)\s*,\s*(\d+)\s*,\s*(\d+)\s*\}\s*;'
+    for match in re.finditer(packed, source):
+        name, height, width = match.group(1), int(match.group(2)), int(match.group(3))
+        bitmap, offsets = bitmaps[match.group(4)], row_tables[match.group(5)]
+        if int(match.group(6)) != FIRST_CHAR or int(match.group(7)) != LAST_CHAR:
+            raise SystemExit('%s: only the range %d..%d is supported' % (name, FIRST_CHAR, LAST_CHAR))
+        fonts.append((name, height, width,
+                      [unpack_glyph(bitmap, offsets[g], height, width) for g in range(GLYPH_NUM)]))
+    return fonts
+
+
+def pack_bits(bits):
+    bits = bits + [0] * (-len(bits) % 8)
+    return [int(''.join(map(str, bits[i:i + 8])), 2) for i in range(0, len(bits), 8)]
+
+
+def pack_glyph(rows, left, width):
+    bits = []
+    for row in rows:
+        bits.extend((row >> (15 - left - column)) & 1 for column in range(width))
+    return pack_bits(bits)
+
+
+def char_comment(code):
+    if code == ord('\\'):
+        # A trailing backslash would continue a line comment
+        return '/* \\ */'
+    return '// ' + ('sp' if code == 32 else chr(code))
+
+
+def char_literal(code):
+    return "'\\%s'" % chr(code) if chr(code) in '\\\'' else "'%s'" % chr(code)
+
+
+def emit_bitmap(suffix, packed_glyphs, codes=None, offsets=True):
+    """Emit the bitmap and, unless every glyph has the same size, the offset table."""
+    codes = codes or [FIRST_CHAR + glyph for glyph in range(len(packed_glyphs))]
+    lines = ['static const uint8_t FontBitmap_%s[] = {' % suffix]
+    table = []
+    offset = 0
+    for code, packed in zip(codes, packed_glyphs):
+        table.append(offset)
+        offset += len(packed)
+        if not packed:
+            lines.append('    %s' % char_comment(code))
+        for start in range(0, len(packed), 12):
+            chunk = ', '.join('0x%02X' % byte for byte in packed[start:start + 12])
+            last = start + 12 >= len(packed)
+            lines.append('    %s,%s' % (chunk, ' ' + char_comment(code) if last else ''))
+    lines.append('    %s' % ', '.join(['0x00'] * BITMAP_TAIL_PADDING))
+    lines.append('};')
+    lines.append('')
+    if not offsets:
+        return lines
+    lines.append('static const uint16_t FontOffset_%s[] = {' % suffix)
+    for start in range(0, len(table), 12):
+        lines.append('    %s,' % ', '.join('%d' % value for value in table[start:start + 12]))
+    lines.append('};')
+    lines.append('')
+    return lines
+
+
+def suffix_of(name):
+    return name[len('Font_'):] if name.startswith('Font_') else name
+
+
+def emit_font(name, height, width, glyphs):
+    suffix = suffix_of(name)
+    lines = emit_bitmap(suffix, [pack_glyph(rows, 0, width) for rows in glyphs])
+    definition = 'FontDef_s %s = {%d, %d, 0, FontBitmap_%s, FontOffset_%s, %d, %d};' % (
+        name, height, width, suffix, suffix, FIRST_CHAR, LAST_CHAR)
+    return '\n'.join(lines), definition
+
+
+def ink_box(rows, width):
+    """Return (left, top, box width, box height) of the ink, or None for an empty glyph."""
+    mask = 0
+    for row in rows:
+        mask |= row
+    ink_rows = [index for index, row in enumerate(rows) if row]
+    if not ink_rows:
+        return None
+    columns = [column for column in range(width) if mask & (0x8000 >> column)]
+    return columns[0], ink_rows[0], columns[-1] - columns[0] + 1, ink_rows[-1] - ink_rows[0] + 1
+
+
+def row_extents(rows, left, width):
+    """Leftmost and rightmost ink column of every row, relative to the ink box."""
+    extents = []
+    for row in rows:
+        columns = [column - left for column in range(width) if row & (0x8000 >> column)]
+        extents.append((columns[0], columns[-1]) if columns else None)
+    return extents
+
+
+def scale2x(pixels):
+    """Scale2x (EPX) magnification of a 2D list of 0/1 pixels."""
+    height, width = len(pixels), len(pixels[0])
+
+    def at(y, x):
+        return pixels[y][x] if 0 <= y < height and 0 <= x < width else 0
+
+    result = [[0] * (width * 2) for _ in range(height * 2)]
+    for y in range(height):
+        for x in range(width):
+            p, a, b, c, d = at(y, x), at(y - 1, x), at(y, x + 1), at(y, x - 1), at(y + 1, x)
+            result[2 * y][2 * x] = a if c == a and c != d and a != b else p
+            result[2 * y][2 * x + 1] = b if a == b and a != c and b != d else p
+            result[2 * y + 1][2 * x] = c if d == c and d != b and c != a else p
+            result[2 * y + 1][2 * x + 1] = d if b == d and b != a and d != c else p
+    return result
+
+
+def antialias_glyph(rows, width, bpp):
+    """Return the coverage levels of a glyph, row after row."""
+    pixels = [[(row >> (15 - column)) & 1 for column in range(width)] for row in rows]
+    big = scale2x(scale2x(pixels))
+    top = (1 << bpp) - 1
+    levels = []
+    for y in range(len(rows)):
+        for x in range(width):
+            coverage = sum(big[4 * y + dy][4 * x + dx] for dy in range(4) for dx in range(4))
+            levels.append((coverage * top + 8) // 16)
+    return levels
+
+
+def pack_levels(levels, bpp):
+    bits = []
+    for level in levels:
+        bits.extend((level >> (bpp - 1 - bit)) & 1 for bit in range(bpp))
+    return pack_bits(bits)
+
+
+def emit_antialiased(name, height, width, glyphs, bpp):
+    suffix = suffix_of(name) + 'A%d' % bpp
+    lines = emit_bitmap(suffix, [pack_levels(antialias_glyph(rows, width, bpp), bpp) for rows in glyphs])
+    definition = 'FontDef_s %sA%d = {%d, %d, 0, FontBitmap_%s, FontOffset_%s, %d, %d, 0, 0, 0, %d};' % (
+        name, bpp, height, width, suffix, suffix, FIRST_CHAR, LAST_CHAR, bpp)
+    return '\n'.join(lines), definition
+
+
+def proportional_glyphs(height, width, glyphs):
+    """Return the metrics, packed ink boxes and sorted kerning pairs of a proportional variant."""
+    spacing = max(1, width // 8)
+    metrics, packed_glyphs, extents = [], [], []
+    for rows in glyphs:
+        box = ink_box(rows, width)
+        if box is None:
+            metrics.append((width // 2, 0, 0, 0, 0))
+            packed_glyphs.append([])
+            extents.append([None] * height)
+            continue
+        left, top, box_width, box_height = box
+        metrics.append((box_width + spacing, 0, top, box_width, box_height))
+        packed_glyphs.append(pack_glyph(rows[top:top + box_height], left, box_width))
+        extents.append(row_extents(rows, left, width))
+
+    kerning = []
+    limit = max(1, width // 4)
+    threshold = max(2, width // 6)
+    for first in KERNING_CHARS:
+        for second in KERNING_CHARS:
+            a, b = ord(first) - FIRST_CHAR, ord(second) - FIRST_CHAR
+            advance = metrics[a][0]
+            gap = None
+            for row in range(height):
+                if extents[a][row] is None:
+                    continue
+                for neighbour in (row - 1, row, row + 1):
+                    if 0 <= neighbour < height and extents[b][neighbour] is not None:
+                        current = advance + extents[b][neighbour][0] - extents[a][row][1] - 1
+                        gap = current if gap is None else min(gap, current)
+            if gap is None:
+                continue
+            # Only pairs with a clearly visible hole, kerning every pair by a
+            # pixel just makes the font narrower and the table bigger
+            room = min(limit, gap - spacing)
+            if room >= threshold:
+                kerning.append((ord(first), ord(second), -room))
+
+    # The renderer binary searches the pairs
+    kerning.sort()
+    return metrics, packed_glyphs, kerning
+
+
+def emit_metrics(suffix, metrics, kerning, codes=None):
+    """Emit the glyph metrics and kerning tables, return the lines and the kerning table name."""
+    codes = codes or [FIRST_CHAR + glyph for glyph in range(len(metrics))]
+    lines = ['static const FontGlyph_s FontGlyphs_%s[] = {' % suffix]
+    for code, metric in zip(codes, metrics):
+        lines.append('    {%d, %d, %d, %d, %d}, %s' % (metric + (char_comment(code),)))
+    lines.append('};')
+    lines.append('')
+    kerning_table = '0'
+    if kerning:
+        kerning_table = 'FontKerning_%s' % suffix
+        lines.append('static const FontKerning_s %s[] = {' % kerning_table)
+        for first, second, adjust in kerning:
+            lines.append('    {%s, %s, %d},' % (char_literal(first), char_literal(second), adjust))
+        lines.append('};')
+        lines.append('')
+    return lines, kerning_table
+
+
+def emit_proportional(name, height, width, glyphs):
+    suffix = suffix_of(name) + 'P'
+    metrics, packed_glyphs, kerning = proportional_glyphs(height, width, glyphs)
+    lines = emit_bitmap(suffix, packed_glyphs)
+    metric_lines, kerning_table = emit_metrics(suffix, metrics, kerning)
+    lines.extend(metric_lines)
+    definition = ('FontDef_s %sP = {%d, %d, 0, FontBitmap_%s, FontOffset_%s, %d, %d,\n'
+                  '                      FontGlyphs_%s, %s, %d};') % (
+        name, height, width, suffix, suffix, FIRST_CHAR, LAST_CHAR, suffix, kerning_table, len(kerning))
+    return '\n'.join(lines), definition
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('-p', '--proportional', action='append', default=[],
+                        help='also emit a proportional variant of this font')
+    parser.add_argument('-a', '--antialiased', action='append', default=[], metavar='NAME:BPP',
+                        help='also emit a 2 or 4 bits per pixel anti-aliased variant of this font')
+    parser.add_argument('input')
+    arguments = parser.parse_args()
+    with open(arguments.input) as source:
+        fonts = parse_fonts(source.read())
+    names = [font[0] for font in fonts]
+    antialiased = []
+    for option in arguments.antialiased:
+        name, _, bpp = option.partition(':')
+        if bpp not in ('2', '4'):
+            raise SystemExit('%s: bits per pixel must be 2 or 4' % option)
+        antialiased.append((name, int(bpp)))
+    for name in arguments.proportional + [name for name, _ in antialiased]:
+        if name not in names:
+            raise SystemExit('%s: no such monospace font' % name)
+    definitions = []
+    print('#include "fonts.h"')
+    print('')
+    for font in fonts:
+        body, definition = emit_font(*font)
+        print(body)
+        definitions.append(definition)
+    for font in fonts:
+        if font[0] in arguments.proportional:
+            body, definition = emit_proportional(*font)
+            print(body)
+            definitions.append(definition)
+    for name, bpp in antialiased:
+        font = fonts[names.index(name)]
+        body, definition = emit_antialiased(*font, bpp=bpp)
+        print(body)
+        definitions.append(definition)
+    print('\n'.join(definitions))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+"""Subset the fonts of Fonts/fonts.c to the characters an application draws.
+
+Usage: FontSubset.py -f Font_16x26 [-f Font_16x26A4]... [-S main.c]... [-m manifest.txt]...
+                     [--suffix S] Fonts/fonts.c > fontsSubset.c
+
+The characters are every character of the string literals in the -S sources
+(C escapes and UTF-8 decoded, control characters and #include names
+skipped) and of the -m manifests, UTF-8 text files whose lines starting with
+'#' are comments.
+Characters only produced at run time, like the digits of formatted numbers,
+belong in a manifest. U+0020 is always kept, it is also what a character
+missing from a subset font draws.
+
+Every -f font is emitted with only those glyphs and a sorted codepoint index,
+the glyph lookup becomes a binary search over the kept glyphs. A -f name is a
+monospace font of the input or a variant FontPack.py derives from one, NAMEP
+for proportional and NAMEA2/NAMEA4 for anti-aliased. Names keep their value so
+the output replaces Fonts/fonts.c in a build, --suffix appends to every name
+to link both.
+
+A character the fonts do not have fails with its source location, so the
+build stops instead of the panel drawing a blank.
+"""
+import argparse
+import os
+import re
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import FontPack  # noqa: E402
+
+ESCAPES = {'n': 10, 't': 9, 'r': 13, 'a': 7, 'b': 8, 'f': 12, 'v': 11, '\\': 92, "'": 39, '"': 34, '?': 63}
+TOKEN = re.compile(r'^[ \t]*#[ \t]*include[^\n]*|/\*.*?\*/|//[^\n]*|\'(?:\\.|[^\\\'\n])*\'|"((?:\\.|[^\\"\n])*)"', re.S | re.M)
+ESCAPE = re.compile(r'\\(x[0-9A-Fa-f]+|[0-7]{1,3}|u[0-9A-Fa-f]{4}|U[0-9A-Fa-f]{8}|.)', re.S)
+
+
+def decode_literal(body):
+    """Bytes of a C string literal body, \\u escapes become UTF-8."""
+    result = bytearray()
+    position = 0
+    for match in ESCAPE.finditer(body):
+        result += body[position:match.start()].encode('utf-8')
+        escape = match.group(1)
+        if escape[0] == 'x':
+            result.append(int(escape[1:], 16) & 0xFF)
+        elif escape[0] in 'uU':
+            result += chr(int(escape[1:], 16)).encode('utf-8')
+        elif escape[0] in '01234567':
+            result.append(int(escape, 8) & 0xFF)
+        else:
+            result.append(ESCAPES.get(escape, ord(escape)))
+        position = match.end()
+    result += body[position:].encode('utf-8')
+    return bytes(result)
+
+
+def scan_source(path, used):
+    """Add the characters of the string literals of a C source, adjacent literals are joined."""
+    with open(path, encoding='utf-8') as source:
+        text = source.read()
+    pending, line, previous_end = None, 0, 0
+    for match in TOKEN.finditer(text):
+        if match.group(1) is None:
+            continue
+        if pending is not None and text[previous_end:match.start()].strip():
+            add_string(pending, path, line, used)
+            pending = None
+        if pending is None:
+            pending, line = b'', text.count('\n', 0, match.start()) + 1
+        pending += decode_literal(match.group(1))
+        previous_end = match.end()
+    if pending is not None:
+        add_string(pending, path, line, used)
+
+
+def add_string(data, path, line, used):
+    for character in data.decode('utf-8', errors='replace'):
+        if ord(character) >= 32:
+            used.setdefault(ord(character), '%s:%d' % (path, line))
+
+
+def scan_manifest(path, used):
+    with open(path, encoding='utf-8') as manifest:
+        for number, text in enumerate(manifest, 1):
+            if text.startswith('#'):
+                continue
+            for character in text.rstrip('\n'):
+                if ord(character) >= 32:
+                    used.setdefault(ord(character), '%s:%d' % (path, number))
+
+
+def split_variant(name):
+    """Return (base name, variant) with variant '', 'P', 'A2' or 'A4'."""
+    match = re.match(r'(.*?)(P|A2|A4)?$', name)
+    return match.group(1), match.group(2) or ''
+
+
+def emit_subset(name, height, width, glyphs, variant, codes, suffix):
+    """Emit the kept glyphs of one font, return its body, definition and sizes."""
+    full = FontPack.suffix_of(name) + variant
+    array = full + suffix
+    indices = [code - FontPack.FIRST_CHAR for code in codes]
+    bpp, glyph_table, kerning_table, kerning_num, offsets = 0, '0', '0', 0, '0'
+    if variant == 'P':
+        metrics, packed, kerning = FontPack.proportional_glyphs(height, width, glyphs)
+        kept_kerning = [pair for pair in kerning if pair[0] in codes and pair[1] in codes]
+        # Bitmap, 2-byte offset and 5-byte metrics per glyph, 3 bytes per kerning pair
+        full_size = sum(map(len, packed)) + 7 * len(packed) + 3 * len(kerning)
+        packed = [packed[index] for index in indices]
+        lines = FontPack.emit_bitmap(array, packed, codes)
+        metric_lines, kerning_table = FontPack.emit_metrics(array, [metrics[index] for index in indices],
+                                                            kept_kerning, codes)
+        lines.extend(metric_lines)
+        glyph_table, kerning_num, offsets = 'FontGlyphs_%s' % array, len(kept_kerning), 'FontOffset_%s' % array
+        size = sum(map(len, packed)) + 7 * len(packed) + 3 * len(kept_kerning)
+    else:
+        if variant:
+            bpp = int(variant[1])
+            packed = [FontPack.pack_levels(FontPack.antialias_glyph(rows, width, bpp), bpp) for rows in glyphs]
+        else:
+            packed = [FontPack.pack_glyph(rows, 0, width) for rows in glyphs]
+        # Every glyph has the same size, the renderer computes offsets from the index
+        full_size = sum(map(len, packed)) + 2 * len(packed)
+        packed = [packed[index] for index in indices]
+        lines = FontPack.emit_bitmap(array, packed, codes, offsets=False)
+        size = sum(map(len, packed))
+    lines.append('static const uint16_t FontCodepoints_%s[] = {' % array)
+    for start in range(0, len(codes), 8):
+        lines.append('    %s,' % ', '.join('0x%04X' % code for code in codes[start:start + 8]))
+    lines.append('};')
+    lines.append('')
+    size += 2 * len(codes)
+    definition = ('FontDef_s %s%s%s = {%d, %d, 0, FontBitmap_%s, %s, 0, 0,\n'
+                  '                      %s, %s, %d, %d, FontCodepoints_%s, %d, 0, 0};') % (
+        name, variant, suffix, height, width, array, offsets, glyph_table, kerning_table, kerning_num,
+        bpp, array, len(codes))
+    return '\n'.join(lines), definition, full_size, size
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('-f', '--font', action='append', required=True,
+                        help='font to subset, a monospace font or its P, A2 or A4 variant')
+    parser.add_argument('-S', '--source', action='append', default=[],
+                        help='C source whose string literals are drawn')
+    parser.add_argument('-m', '--manifest', action='append', default=[],
+                        help='UTF-8 file of further characters, # starts a comment line')
+    parser.add_argument('--suffix', default='', help='append to every emitted name')
+    parser.add_argument('input')
+    arguments = parser.parse_args()
+    with open(arguments.input) as source:
+        fonts = {font[0]: font for font in FontPack.parse_fonts(source.read())}
+    used = {32: 'always'}
+    for path in arguments.source:
+        scan_source(path, used)
+    for path in arguments.manifest:
+        scan_manifest(path, used)
+    missing = sorted(code for code in used if not FontPack.FIRST_CHAR <= code <= FontPack.LAST_CHAR)
+    for code in missing:
+        sys.stderr.write('%s: U+%04X %s is not in the fonts\n' % (used[code], code, chr(code)))
+    if missing:
+        raise SystemExit(1)
+    codes = sorted(used)
+    bodies, definitions = [], []
+    for requested in arguments.font:
+        base, variant = split_variant(requested)
+        if base not in fonts:
+            base, variant = requested, ''
+        if base not in fonts:
+            raise SystemExit('%s: no such monospace font' % requested)
+        body, definition, full_size, size = emit_subset(*fonts[base], variant=variant, codes=codes,
+                                                        suffix=arguments.suffix)
+        bodies.append(body)
+        definitions.append(definition)
+        sys.stderr.write('%s: %d of %d glyphs, %d of %d bytes\n' % (
+            requested + arguments.suffix, len(codes), FontPack.GLYPH_NUM, size, full_size))
+    print('#include "Fonts/fonts.h"')
+    print('')
+    print('\n'.join(bodies))
+    print('\n'.join(definitions))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,716 @@
+/********************************************************************************************************
+ * @Filename: ImageCompiler.cpp
+ * @Author: Jinyi
+ * @Version: 1.0
+ * @Date: 2023-03-24
+ * @Description: Host-side image compiler of ILI9341 Driver Library. Converts PNG, BMP and PPM files into
+ *               C arrays of the image formats the driver draws, choosing the format per image
+ *
+ * ILI9341ImageCompiler [-p size|speed] [-b RRGGBB] [-o images.c] [-H images.h]
+ *                      Image_Name=file[:raw|rle|qoi|indexed] ...
+ *
+ * Every image is encoded in all four formats:
+ *   raw      uint16_t RGB565 array for ILI9341DrawImage
+ *   rle      ILI9341RleImage_s for ILI9341DrawRleImage, runs become fills
+ *   qoi      QOI file for ILI9341DrawQoi
+ *   indexed  ILI9341IndexedImage_s for ILI9341DrawIndexedImage, at most 256 RGB565 colors
+ * and the smallest one (-p size, the default) or the one with the fewest decode cycles (-p speed) is kept,
+ * unless the argument names a format. The other policy breaks ties. Colors are truncated to RGB565 like
+ * RGB888ToRGB565 before encoding, which costs nothing on the screen and lets more pixels match. Alpha is
+ * blended over the -b background, black by default.
+ *
+ * The header defines Image_Name_WIDTH, Image_Name_HEIGHT, Image_Name_BYTES and Image_Name_DRAW(x, y),
+ * which draws the image with the function of its format, so a format change needs no code change.
+ *
+ * The report on stderr lists per image the bus words of the draw (window setup plus one word per pixel,
+ * the same for every format as each streams the image through one window) and per format the flash
+ * bytes (data plus descriptor) and the decode cycles, an estimate of the CPU work between the bus writes:
+ *   raw      one flash word read and one 32-bit store per two pixels
+ *   rle      a packet header each, run pixels stored two per register pair without flash reads, literal
+ *            pixels like raw
+ *   qoi      the op decode and index update per op, the RGB565 conversion and the line buffer per pixel
+ *   indexed  the bit field, palette read and line buffer per pixel
+ *
+ * PNG input goes through libpng. BMP input may be 1, 4, 8, 24 or 32 bits per pixel uncompressed, or
+ * 16 or 32 bits with bit fields, bottom-up or top-down. PPM input is binary (P6) or plain (P3).
+ *********************************************************************************************************/
+#include <png.h>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace {
+
+enum Format { FormatRaw = 0, FormatRle = 1, FormatQoi = 2, FormatIndexed = 3, FormatNum = 4, FormatAuto = 4 };
+const char *const FormatNames[] = {"raw", "rle", "qoi", "indexed"};
+
+/* CASET and PASET with four parameters each, then RAMWR */
+constexpr uint32_t WindowSetupWords = 11;
+/* sizeof of the descriptors on a 32-bit MCU */
+constexpr uint32_t RleDescriptorBytes = 12;
+constexpr uint32_t QoiSizeBytes = 4;
+constexpr uint32_t IndexedDescriptorBytes = 16;
+
+constexpr uint32_t RleRun = 0x8000;
+constexpr uint32_t RleMaxCount = 0x8000;
+/* A run packet costs two words, a literal pixel one, so shorter runs stay literal */
+constexpr uint32_t RleMinRun = 3;
+
+/* Decode cycle estimates on a Cortex-M4 running from flash with the ART accelerator */
+constexpr uint32_t CallCycles = 12;         /* a draw or a packet: decode, branch and the write call */
+constexpr uint32_t LiteralPairCycles = 3;   /* flash word read, its wait states partly hidden, and the store */
+constexpr uint32_t FillPairCycles = 1;      /* store of a register pair */
+constexpr uint32_t QoiOpCycles = 12;        /* byte reads, tag dispatch, index hash and update */
+constexpr uint32_t QoiPixelCycles = 4;      /* RGB888 to RGB565 and the line buffer store */
+constexpr uint32_t IndexedPixelCycles = 5;  /* bit field, palette read and line buffer store */
+
+uint32_t pairs(size_t pixelNum) { return static_cast<uint32_t>((pixelNum + 1) / 2); }
+
+struct Asset {
+  std::string name;
+  std::string file;
+  Format format = FormatAuto;
+};
+
+struct Options {
+  bool speed = false;
+  uint32_t background = 0;
+  std::string output;
+  std::string header;
+  std::vector<Asset> assets;
+};
+
+struct Image {
+  uint32_t width = 0;
+  uint32_t height = 0;
+  std::vector<uint8_t> rgba; /* 4 bytes per pixel, straight alpha */
+};
+
+struct Encoding {
+  bool possible = false;
+  std::vector<uint8_t> bytes;     /* qoi file, indexed rows */
+  std::vector<uint16_t> words;    /* raw pixels, rle packets, indexed palette */
+  uint32_t bits = 0;              /* indexed bits per pixel */
+  uint32_t flashBytes = 0;
+  uint32_t cycles = 0;            /* decode cycle estimate, bus words excluded */
+};
+
+[[noreturn]] void fail(const std::string &message) {
+  std::fprintf(stderr, "ILI9341ImageCompiler: %s\n", message.c_str());
+  std::exit(1);
+}
+
+uint32_t parseNumber(const std::string &text, int base) {
+  char *end = nullptr;
+  unsigned long value = std::strtoul(text.c_str(), &end, base);
+  if (text.empty() || *end != '\0')
+    fail("bad number '" + text + "'");
+  return static_cast<uint32_t>(value);
+}
+
+void usage() {
+  std::fprintf(stderr,
+               "usage: ILI9341ImageCompiler [-p size|speed] [-b RRGGBB] [-o images.c] [-H images.h]\n"
+               "                            Image_Name=file[:raw|rle|qoi|indexed] ...\n");
+  std::exit(2);
+}
+
+bool isIdentifier(const std::string &name) {
+  if (name.empty() || std::isdigit(static_cast<unsigned char>(name[0])))
+    return false;
+  return std::all_of(name.begin(), name.end(),
+                     [](char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_'; });
+}
+
+Asset parseAsset(const std::string &argument) {
+  Asset asset;
+  size_t equals = argument.find('=');
+  if (equals == std::string::npos)
+    usage();
+  asset.name = argument.substr(0, equals);
+  asset.file = argument.substr(equals + 1);
+  if (!isIdentifier(asset.name))
+    fail("'" + asset.name + "' is not a C identifier");
+  /* A trailing :format, a colon followed by anything else stays part of the file name */
+  size_t colon = asset.file.rfind(':');
+  if (colon != std::string::npos) {
+    auto found = std::find(std::begin(FormatNames), std::end(FormatNames), asset.file.substr(colon + 1));
+    if (found != std::end(FormatNames)) {
+      asset.format = static_cast<Format>(found - std::begin(FormatNames));
+      asset.file.erase(colon);
+    }
+  }
+  return asset;
+}
+
+Options parseOptions(int argc, char **argv) {
+  Options options;
+  for (int i = 1; i < argc; i++) {
+    std::string argument = argv[i];
+    auto value = [&]() -> std::string {
+      if (i + 1 >= argc)
+        usage();
+      return argv[++i];
+    };
+    if (argument == "-p") {
+      std::string policy = value();
+      if (policy != "size" && policy != "speed")
+        fail("unknown policy '" + policy + "'");
+      options.speed = policy == "speed";
+    } else if (argument == "-b") {
+      std::string color = value();
+      if (color.size() != 6)
+        fail("background must be RRGGBB");
+      options.background = parseNumber(color, 16);
+    } else if (argument == "-o") {
+      options.output = value();
+    } else if (argument == "-H") {
+      options.header = value();
+    } else if (argument.compare(0, 1, "-") == 0) {
+      usage();
+    } else {
+      options.assets.push_back(parseAsset(argument));
+    }
+  }
+  if (options.assets.empty())
+    usage();
+  for (size_t i = 0; i < options.assets.size(); i++)
+    for (size_t j = 0; j < i; j++)
+      if (options.assets[i].name == options.assets[j].name)
+        fail("image " + options.assets[i].name + " given twice");
+  return options;
+}
+
+std::vector<uint8_t> readFile(const std::string &file) {
+  std::ifstream input(file, std::ios::binary);
+  if (!input)
+    fail("cannot read " + file);
+  return std::vector<uint8_t>(std::istreambuf_iterator<char>(input), {});
+}
+
+Image readPng(const std::string &file) {
+  png_image png;
+  std::memset(&png, 0, sizeof(png));
+  png.version = PNG_IMAGE_VERSION;
+  if (!png_image_begin_read_from_file(&png, file.c_str()))
+    fail(file + ": " + png.message);
+  png.format = PNG_FORMAT_RGBA;
+  Image image;
+  image.width = png.width;
+  image.height = png.height;
+  image.rgba.resize(PNG_IMAGE_SIZE(png));
+  if (!png_image_finish_read(&png, nullptr, image.rgba.data(), 0, nullptr))
+    fail(file + ": " + png.message);
+  return image;
+}
+
+/**
+ * @brief Plain number of a PPM header, comments run to the end of the line
+ */
+uint32_t ppmNumber(const std::vector<uint8_t> &data, size_t &position, const std::string &file) {
+  for (;;) {
+    while (position < data.size() && std::isspace(data[position]))
+      position++;
+    if (position >= data.size() || data[position] != '#')
+      break;
+    while (position < data.size() && data[position] != '\n')
+      position++;
+  }
+  size_t start = position;
+  uint32_t value = 0;
+  while (position < data.size() && std::isdigit(data[position]) && position - start < 9)
+    value = value * 10 + (data[position++] - '0');
+  if (position == start)
+    fail(file + ": malformed PPM");
+  return value;
+}
+
+Image readPpm(const std::vector<uint8_t> &data, const std::string &file) {
+  const bool binary = data[1] == '6';
+  size_t position = 2;
+  Image image;
+  image.width = ppmNumber(data, position, file);
+  image.height = ppmNumber(data, position, file);
+  const uint32_t maxval = ppmNumber(data, position, file);
+  if (maxval == 0 || maxval > 255)
+    fail(file + ": only PPMs of 8 bits per channel are supported");
+  const size_t samples = static_cast<size_t>(image.width) * image.height * 3;
+  /* One whitespace byte separates the header from binary samples */
+  position++;
+  if (binary && data.size() < position + samples)
+    fail(file + ": truncated PPM");
+  image.rgba.resize(static_cast<size_t>(image.width) * image.height * 4, 255);
+  for (size_t i = 0; i < samples; i++) {
+    uint32_t sample = binary ? data[position + i] : ppmNumber(data, position, file);
+    image.rgba[i / 3 * 4 + i % 3] = static_cast<uint8_t>((std::min(sample, maxval) * 255 + maxval / 2) / maxval);
+  }
+  return image;
+}
+
+uint32_t littleEndian(const std::vector<uint8_t> &data, size_t offset, int bytes) {
+  uint32_t value = 0;
+  for (int i = bytes - 1; i >= 0; i--)
+    value = value << 8 | data[offset + i];
+  return value;
+}
+
+/**
+ * @brief Channel of a bit fields pixel scaled to 8 bits, 255 for a missing alpha mask
+ */
+uint8_t bmpChannel(uint32_t pixel, uint32_t mask, uint8_t missing) {
+  if (mask == 0)
+    return missing;
+  int shift = 0;
+  while (((mask >> shift) & 1) == 0)
+    shift++;
+  const uint32_t top = mask >> shift;
+  return static_cast<uint8_t>((((pixel & mask) >> shift) * 255 + top / 2) / top);
+}
+
+Image readBmp(const std::vector<uint8_t> &data, const std::string &file) {
+  if (data.size() < 54)
+    fail(file + ": truncated BMP");
+  const uint32_t pixelOffset = littleEndian(data, 10, 4), headerSize = littleEndian(data, 14, 4);
+  const int32_t width = static_cast<int32_t>(littleEndian(data, 18, 4));
+  const int32_t height = static_cast<int32_t>(littleEndian(data, 22, 4));
+  const uint32_t bits = littleEndian(data, 28, 2), compression = littleEndian(data, 30, 4);
+  uint32_t colorNum = littleEndian(data, 46, 4);
+  if (headerSize < 40 || width <= 0 || height == 0)
+    fail(file + ": unsupported BMP header");
+  /* BI_RGB or BI_BITFIELDS, the masks follow a 40-byte header and are part of the longer ones */
+  std::array<uint32_t, 4> masks = {0x00FF0000, 0x0000FF00, 0x000000FF, 0};
+  if (bits == 16)
+    masks = {0x7C00, 0x03E0, 0x001F, 0};
+  if (compression == 3 && (bits == 16 || bits == 32)) {
+    for (int i = 0; i < 3; i++)
+      masks[i] = littleEndian(data, 54 + 4 * i, 4);
+    masks[3] = headerSize >= 56 ? littleEndian(data, 54 + 12, 4) : 0;
+  } else if (compression != 0 || (bits != 1 && bits != 4 && bits != 8 && bits != 16 && bits != 24 && bits != 32)) {
+    fail(file + ": only uncompressed and bit field BMPs are supported");
+  }
+  std::vector<std::array<uint8_t, 3>> palette;
+  if (bits <= 8) {
+    if (colorNum == 0)
+      colorNum = 1U << bits;
+    const size_t paletteOffset = 14 + headerSize;
+    if (colorNum > 256 || data.size() < paletteOffset + colorNum * 4)
+      fail(file + ": truncated BMP palette");
+    for (uint32_t i = 0; i < colorNum; i++)
+      palette.push_back({data[paletteOffset + i * 4 + 2], data[paletteOffset + i * 4 + 1],
+                         data[paletteOffset + i * 4]});
+  }
+  Image image;
+  image.width = static_cast<uint32_t>(width);
+  image.height = static_cast<uint32_t>(height < 0 ? -height : height);
+  const size_t stride = (static_cast<size_t>(image.width) * bits + 31) / 32 * 4;
+  if (data.size() < pixelOffset + stride * image.height)
+    fail(file + ": truncated BMP");
+  image.rgba.resize(static_cast<size_t>(image.width) * image.height * 4);
+  for (uint32_t y = 0; y < image.height; y++) {
+    /* Rows are stored bottom-up unless the height is negative */
+    const size_t row = pixelOffset + stride * (height < 0 ? y : image.height - 1 - y);
+    for (uint32_t x = 0; x < image.width; x++) {
+      uint8_t *pixel = &image.rgba[(static_cast<size_t>(y) * image.width + x) * 4];
+      if (bits <= 8) {
+        const size_t bit = static_cast<size_t>(x) * bits;
+        const uint32_t index = (data[row + bit / 8] >> (8 - bits - bit % 8)) & ((1U << bits) - 1);
+        if (index >= palette.size())
+          fail(file + ": BMP pixel outside the palette");
+        std::copy(palette[index].begin(), palette[index].end(), pixel);
+        pixel[3] = 255;
+      } else if (bits == 24) {
+        pixel[0] = data[row + x * 3 + 2];
+        pixel[1] = data[row + x * 3 + 1];
+        pixel[2] = data[row + x * 3];
+        pixel[3] = 255;
+      } else {
+        const uint32_t value = littleEndian(data, row + x * (bits / 8), static_cast<int>(bits / 8));
+        for (int i = 0; i < 4; i++)
+          pixel[i] = bmpChannel(value, masks[i], 255);
+      }
+    }
+  }
+  return image;
+}
+
+Image readImage(const std::string &file) {
+  std::vector<uint8_t> data = readFile(file);
+  Image image;
+  if (data.size() >= 8 && png_sig_cmp(data.data(), 0, 8) == 0)
+    image = readPng(file);
+  else if (data.size() >= 2 && data[0] == 'B' && data[1] == 'M')
+    image = readBmp(data, file);
+  else if (data.size() >= 2 && data[0] == 'P' && (data[1] == '6' || data[1] == '3'))
+    image = readPpm(data, file);
+  else
+    fail(file + ": not a PNG, BMP or PPM file");
+  if (image.width == 0 || image.height == 0 || image.width > 320 || image.height > 320)
+    fail(file + ": " + std::to_string(image.width) + "x" + std::to_string(image.height) +
+         " does not fit the screen");
+  return image;
+}
+
+/**
+ * @brief Blend alpha over the background and truncate to RGB565, kept as 8-bit channels for QOI
+ */
+std::vector<uint8_t> flatten(const Image &image, uint32_t background) {
+  std::vector<uint8_t> rgb(static_cast<size_t>(image.width) * image.height * 3);
+  const uint8_t masks[3] = {0xF8, 0xFC, 0xF8};
+  for (size_t i = 0; i < rgb.size() / 3; i++) {
+    const uint32_t alpha = image.rgba[i * 4 + 3];
+    for (int channel = 0; channel < 3; channel++) {
+      const uint32_t back = (background >> (16 - 8 * channel)) & 0xFF;
+      const uint32_t value = (image.rgba[i * 4 + channel] * alpha + back * (255 - alpha) + 127) / 255;
+      rgb[i * 3 + channel] = static_cast<uint8_t>(value & masks[channel]);
+    }
+  }
+  return rgb;
+}
+
+std::vector<uint16_t> toRgb565(const std::vector<uint8_t> &rgb) {
+  std::vector<uint16_t> pixels(rgb.size() / 3);
+  for (size_t i = 0; i < pixels.size(); i++)
+    pixels[i] = static_cast<uint16_t>(rgb[i * 3] << 8 | rgb[i * 3 + 1] << 3 | rgb[i * 3 + 2] >> 3);
+  return pixels;
+}
+
+Encoding encodeRaw(const std::vector<uint16_t> &pixels) {
+  Encoding encoding;
+  encoding.possible = true;
+  encoding.words = pixels;
+  encoding.flashBytes = static_cast<uint32_t>(pixels.size() * 2);
+  encoding.cycles = CallCycles + pairs(pixels.size()) * LiteralPairCycles;
+  return encoding;
+}
+
+/**
+ * @brief Packet stream of ILI9341RleImage_s, runs cross row ends like the window does
+ */
+Encoding encodeRle(const std::vector<uint16_t> &pixels) {
+  Encoding encoding;
+  std::vector<uint16_t> literal;
+  auto flush = [&]() {
+    for (size_t start = 0; start < literal.size(); start += RleMaxCount) {
+      const size_t count = std::min<size_t>(RleMaxCount, literal.size() - start);
+      encoding.words.push_back(static_cast<uint16_t>(count - 1));
+      encoding.words.insert(encoding.words.end(), literal.begin() + start, literal.begin() + start + count);
+      encoding.cycles += CallCycles + pairs(count) * LiteralPairCycles;
+    }
+    literal.clear();
+  };
+  for (size_t position = 0; position < pixels.size();) {
+    size_t end = position + 1;
+    while (end < pixels.size() && pixels[end] == pixels[position] && end - position < RleMaxCount)
+      end++;
+    if (end - position >= RleMinRun) {
+      flush();
+      encoding.words.push_back(static_cast<uint16_t>(RleRun | (end - position - 1)));
+      encoding.words.push_back(pixels[position]);
+      encoding.cycles += CallCycles + pairs(end - position) * FillPairCycles;
+    } else {
+      literal.insert(literal.end(), pixels.begin() + position, pixels.begin() + end);
+    }
+    position = end;
+  }
+  flush();
+  encoding.possible = true;
+  encoding.flashBytes = static_cast<uint32_t>(encoding.words.size() * 2) + RleDescriptorBytes;
+  return encoding;
+}
+
+/**
+ * @brief QOI file without alpha, the reference encoder
+ */
+Encoding encodeQoi(const std::vector<uint8_t> &rgb, uint32_t width, uint32_t height) {
+  Encoding encoding;
+  std::vector<uint8_t> &data = encoding.bytes;
+  data = {'q', 'o', 'i', 'f'};
+  for (uint32_t value : {width, height})
+    for (int shift = 24; shift >= 0; shift -= 8)
+      data.push_back(static_cast<uint8_t>(value >> shift));
+  data.push_back(3);
+  data.push_back(0);
+  std::array<uint32_t, 64> index{};
+  std::array<bool, 64> used{};
+  uint32_t previous = 0, run = 0;
+  const size_t pixelNum = rgb.size() / 3;
+  for (size_t i = 0; i < pixelNum; i++) {
+    const uint8_t r = rgb[i * 3], g = rgb[i * 3 + 1], b = rgb[i * 3 + 2];
+    const uint32_t pixel = static_cast<uint32_t>(r) << 16 | g << 8 | b;
+    if (pixel == previous) {
+      if (++run == 62 || i + 1 == pixelNum) {
+        data.push_back(static_cast<uint8_t>(0xC0 | (run - 1)));
+        encoding.cycles += QoiOpCycles;
+        run = 0;
+      }
+      continue;
+    }
+    if (run > 0) {
+      data.push_back(static_cast<uint8_t>(0xC0 | (run - 1)));
+      encoding.cycles += QoiOpCycles;
+      run = 0;
+    }
+    encoding.cycles += QoiOpCycles;
+    const uint32_t slot = (r * 3 + g * 5 + b * 7 + 255 * 11) & 63;
+    const int dr = r - static_cast<int>(previous >> 16 & 0xFF), dg = g - static_cast<int>(previous >> 8 & 0xFF),
+              db = b - static_cast<int>(previous & 0xFF);
+    const int8_t wr = static_cast<int8_t>(dr), wg = static_cast<int8_t>(dg), wb = static_cast<int8_t>(db);
+    previous = pixel;
+    if (used[slot] && index[slot] == pixel) {
+      data.push_back(static_cast<uint8_t>(slot));
+      continue;
+    }
+    used[slot] = true;
+    index[slot] = pixel;
+    if (wr >= -2 && wr <= 1 && wg >= -2 && wg <= 1 && wb >= -2 && wb <= 1) {
+      data.push_back(static_cast<uint8_t>(0x40 | (wr + 2) << 4 | (wg + 2) << 2 | (wb + 2)));
+    } else if (wg >= -32 && wg <= 31 && wr - wg >= -8 && wr - wg <= 7 && wb - wg >= -8 && wb - wg <= 7) {
+      data.push_back(static_cast<uint8_t>(0x80 | (wg + 32)));
+      data.push_back(static_cast<uint8_t>((wr - wg + 8) << 4 | (wb - wg + 8)));
+    } else {
+      data.insert(data.end(), {0xFE, r, g, b});
+    }
+  }
+  data.insert(data.end(), {0, 0, 0, 0, 0, 0, 0, 1});
+  /* The line buffer goes out like raw pixels */
+  encoding.cycles += CallCycles + static_cast<uint32_t>(pixelNum) * QoiPixelCycles +
+                     pairs(pixelNum) * LiteralPairCycles;
+  encoding.possible = true;
+  encoding.flashBytes = static_cast<uint32_t>(data.size()) + QoiSizeBytes;
+  return encoding;
+}
+
+/**
+ * @brief Palette image at the fewest bits per pixel, impossible above 256 colors
+ */
+Encoding encodeIndexed(const std::vector<uint16_t> &pixels, uint32_t width, uint32_t height) {
+  Encoding encoding;
+  std::map<uint16_t, uint32_t> colors;
+  for (uint16_t pixel : pixels) {
+    colors.emplace(pixel, 0);
+    if (colors.size() > 256)
+      return encoding;
+  }
+  /* Colors in order of first use, so the palette reads like the image */
+  for (uint16_t pixel : pixels) {
+    auto found = colors.find(pixel);
+    if (found->second == 0) {
+      encoding.words.push_back(pixel);
+      found->second = static_cast<uint32_t>(encoding.words.size());
+    }
+  }
+  encoding.bits = 1;
+  while ((1U << encoding.bits) < colors.size())
+    encoding.bits *= 2;
+  const size_t stride = (static_cast<size_t>(width) * encoding.bits + 7) / 8;
+  encoding.bytes.assign(stride * height, 0);
+  for (uint32_t y = 0; y < height; y++)
+    for (uint32_t x = 0; x < width; x++) {
+      const uint32_t value = colors[pixels[static_cast<size_t>(y) * width + x]] - 1;
+      const size_t bit = static_cast<size_t>(x) * encoding.bits;
+      encoding.bytes[y * stride + bit / 8] |= static_cast<uint8_t>(value << (8 - encoding.bits - bit % 8));
+    }
+  encoding.possible = true;
+  encoding.flashBytes = static_cast<uint32_t>(encoding.bytes.size() + encoding.words.size() * 2) +
+                        IndexedDescriptorBytes;
+  encoding.cycles = CallCycles + width * height * IndexedPixelCycles + pairs(pixels.size()) * LiteralPairCycles;
+  return encoding;
+}
+
+/**
+ * @brief Policy of -p, the other measure breaks ties
+ */
+Format chooseFormat(const std::array<Encoding, FormatNum> &encodings, bool speed) {
+  Format best = FormatRaw;
+  for (int format = FormatRle; format < FormatNum; format++) {
+    const Encoding &candidate = encodings[format], &current = encodings[best];
+    if (!candidate.possible)
+      continue;
+    const uint32_t first = speed ? candidate.cycles : candidate.flashBytes;
+    const uint32_t firstBest = speed ? current.cycles : current.flashBytes;
+    const uint32_t second = speed ? candidate.flashBytes : candidate.cycles;
+    const uint32_t secondBest = speed ? current.flashBytes : current.cycles;
+    if (first < firstBest || (first == firstBest && second < secondBest))
+      best = static_cast<Format>(format);
+  }
+  return best;
+}
+
+struct Compiled {
+  Asset asset;
+  uint32_t width = 0;
+  uint32_t height = 0;
+  Format format = FormatRaw;
+  std::array<Encoding, FormatNum> encodings;
+};
+
+Compiled compileAsset(const Asset &asset, const Options &options) {
+  const Image image = readImage(asset.file);
+  const std::vector<uint8_t> rgb = flatten(image, options.background);
+  const std::vector<uint16_t> pixels = toRgb565(rgb);
+  Compiled compiled;
+  compiled.asset = asset;
+  compiled.width = image.width;
+  compiled.height = image.height;
+  compiled.encodings[FormatRaw] = encodeRaw(pixels);
+  compiled.encodings[FormatRle] = encodeRle(pixels);
+  compiled.encodings[FormatQoi] = encodeQoi(rgb, image.width, image.height);
+  compiled.encodings[FormatIndexed] = encodeIndexed(pixels, image.width, image.height);
+  if (asset.format == FormatAuto)
+    compiled.format = chooseFormat(compiled.encodings, options.speed);
+  else if (!compiled.encodings[asset.format].possible)
+    fail(asset.file + " has more than 256 colors, it cannot be indexed");
+  else
+    compiled.format = asset.format;
+  return compiled;
+}
+
+void reportAsset(const Compiled &compiled) {
+  const char *file = std::strrchr(compiled.asset.file.c_str(), '/');
+  const uint32_t rawBytes = compiled.encodings[FormatRaw].flashBytes;
+  std::fprintf(stderr, "%s: %s %ux%u, %u bus words\n", compiled.asset.name.c_str(),
+               file ? file + 1 : compiled.asset.file.c_str(), compiled.width, compiled.height,
+               compiled.width * compiled.height + WindowSetupWords);
+  for (int format = FormatRaw; format < FormatNum; format++) {
+    const Encoding &encoding = compiled.encodings[format];
+    if (!encoding.possible) {
+      std::fprintf(stderr, "  %-7s  more than 256 colors\n", FormatNames[format]);
+      continue;
+    }
+    std::fprintf(stderr, "  %-7s %8u bytes  ratio %5.2f  decode cycles %7u%s\n", FormatNames[format],
+                 encoding.flashBytes, static_cast<double>(rawBytes) / encoding.flashBytes, encoding.cycles,
+                 format == compiled.format ? "  <- selected" : "");
+  }
+}
+
+template <typename T>
+void emitValues(FILE *out, const std::vector<T> &values, const char *format, size_t perLine) {
+  for (size_t start = 0; start < values.size(); start += perLine) {
+    std::fprintf(out, "    ");
+    const size_t end = std::min(start + perLine, values.size());
+    for (size_t i = start; i < end; i++) {
+      std::fprintf(out, format, static_cast<unsigned>(values[i]));
+      std::fprintf(out, "%s", i + 1 < values.size() ? (i + 1 < end ? ", " : ",") : "");
+    }
+    std::fprintf(out, "\n");
+  }
+}
+
+void emitSource(FILE *out, const std::vector<Compiled> &images, const std::string &header) {
+  std::fprintf(out, "/* Generated by ILI9341ImageCompiler, do not edit */\n");
+  const char *file = std::strrchr(header.c_str(), '/');
+  std::fprintf(out, "#include \"%s\"\n", header.empty() ? "ILI9341.h" : file ? file + 1 : header.c_str());
+  for (const Compiled &image : images) {
+    const Encoding &encoding = image.encodings[image.format];
+    const char *name = image.asset.name.c_str();
+    std::fprintf(out, "\n");
+    switch (image.format) {
+    case FormatRaw:
+      std::fprintf(out, "const uint16_t %s[%u] = {\n", name, image.width * image.height);
+      emitValues(out, encoding.words, "0x%04X", 12);
+      std::fprintf(out, "};\n");
+      break;
+    case FormatRle:
+      std::fprintf(out, "static const uint16_t %sData[] = {\n", name);
+      emitValues(out, encoding.words, "0x%04X", 12);
+      std::fprintf(out, "};\n\nconst ILI9341RleImage_s %s = {%u, %u, %sData, %zu};\n", name, image.width,
+                   image.height, name, encoding.words.size());
+      break;
+    case FormatQoi:
+      std::fprintf(out, "const uint8_t %s[] = {\n", name);
+      emitValues(out, encoding.bytes, "0x%02X", 16);
+      std::fprintf(out, "};\n\nconst uint32_t %sSize = sizeof(%s);\n", name, name);
+      break;
+    default:
+      std::fprintf(out, "static const uint16_t %sPalette[] = {\n", name);
+      emitValues(out, encoding.words, "0x%04X", 12);
+      std::fprintf(out, "};\n\nstatic const uint8_t %sData[] = {\n", name);
+      emitValues(out, encoding.bytes, "0x%02X", 16);
+      std::fprintf(out, "};\n\nconst ILI9341IndexedImage_s %s = {%u, %u, %u, %sPalette, %sData};\n", name,
+                   image.width, image.height, encoding.bits, name, name);
+      break;
+    }
+  }
+}
+
+void emitHeader(FILE *out, const std::vector<Compiled> &images, const std::string &header) {
+  const char *file = std::strrchr(header.c_str(), '/');
+  std::string guard = "__ILI9341_IMAGES_";
+  for (const char *c = file ? file + 1 : header.c_str(); *c != '\0'; c++)
+    guard += std::isalnum(static_cast<unsigned char>(*c)) ? static_cast<char>(std::toupper(*c)) : '_';
+  guard += "__";
+  std::fprintf(out, "/* Generated by ILI9341ImageCompiler, do not edit */\n");
+  std::fprintf(out, "#ifndef %s\n#define %s\n\n#include \"ILI9341.h\"\n", guard.c_str(), guard.c_str());
+  for (const Compiled &image : images) {
+    const Encoding &encoding = image.encodings[image.format];
+    const char *name = image.asset.name.c_str();
+    const char *source = std::strrchr(image.asset.file.c_str(), '/');
+    std::fprintf(out, "\n/* %s %ux%u, %s", source ? source + 1 : image.asset.file.c_str(), image.width,
+                 image.height, FormatNames[image.format]);
+    if (image.format == FormatIndexed)
+      std::fprintf(out, " at %u bits per pixel", encoding.bits);
+    std::fprintf(out, ", %u decode cycles */\n", encoding.cycles);
+    std::fprintf(out, "#define %s_WIDTH %u\n#define %s_HEIGHT %u\n#define %s_BYTES %u\n", name, image.width,
+                 name, image.height, name, encoding.flashBytes);
+    switch (image.format) {
+    case FormatRaw:
+      std::fprintf(out, "extern const uint16_t %s[%u];\n", name, image.width * image.height);
+      std::fprintf(out, "#define %s_DRAW(x, y) ILI9341DrawImage((x), (y), %u, %u, %s)\n", name, image.width,
+                   image.height, name);
+      break;
+    case FormatRle:
+      std::fprintf(out, "extern const ILI9341RleImage_s %s;\n", name);
+      std::fprintf(out, "#define %s_DRAW(x, y) ILI9341DrawRleImage((x), (y), &%s)\n", name, name);
+      break;
+    case FormatQoi:
+      std::fprintf(out, "extern const uint8_t %s[];\nextern const uint32_t %sSize;\n", name, name);
+      std::fprintf(out, "#define %s_DRAW(x, y) ILI9341DrawQoi((x), (y), %s, %sSize)\n", name, name, name);
+      break;
+    default:
+      std::fprintf(out, "extern const ILI9341IndexedImage_s %s;\n", name);
+      std::fprintf(out, "#define %s_DRAW(x, y) ILI9341DrawIndexedImage((x), (y), &%s)\n", name, name);
+      break;
+    }
+  }
+  std::fprintf(out, "\n#endif\n");
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const Options options = parseOptions(argc, argv);
+  std::vector<Compiled> images;
+  uint32_t flashBytes = 0, rawBytes = 0;
+  for (const Asset &asset : options.assets) {
+    images.push_back(compileAsset(asset, options));
+    reportAsset(images.back());
+    flashBytes += images.back().encodings[images.back().format].flashBytes;
+    rawBytes += images.back().encodings[FormatRaw].flashBytes;
+  }
+  std::fprintf(stderr, "%zu images, %u flash bytes, %u raw\n", images.size(), flashBytes, rawBytes);
+
+  FILE *out = options.output.empty() ? stdout : std::fopen(options.output.c_str(), "w");
+  if (out == nullptr)
+    fail("cannot write " + options.output);
+  emitSource(out, images, options.header);
+  if (out != stdout)
+    std::fclose(out);
+  if (options.header.empty())
+    return 0;
+  out = std::fopen(options.header.c_str(), "w");
+  if (out == nullptr)
+    fail("cannot write " + options.header);
+  emitHeader(out, images, options.header);
+  std::fclose(out);
+  return 0;
+}
@@ -0,0 +1,497 @@
+#!/usr/bin/env python3
+"""Convert a PPM image into a C array for the ILI9341 driver.
+
+Usage: ImagePack.py [-f rle|raw|qoi|jpeg|png] [-q 85] [-s 420|444] [--restart N] [-a alpha.ppm]
+                    [--window 32768] -n Image_Splash splash.ppm > imageSplash.c
+
+-f rle (the default) makes an ILI9341RleImage_s (see ILI9341.h): a stream of
+packets, a header word with bit 15 set followed by one color repeated
+(header & 0x7FFF) + 1 times, or a header word without it followed by
+header + 1 literal pixels. Runs of three or more pixels are worth a packet,
+shorter ones go into the surrounding literal. Flat-color UI art shrinks to a
+small fraction of the raw size.
+
+-f qoi makes a QOI file (https://qoiformat.org) as a uint8_t array plus NAMESize
+for ILI9341DrawQoi, good for photos too.
+-f jpeg makes a baseline JPEG as a uint8_t array plus NAMESize for
+ILI9341DrawJpeg, at quality -q with 4:2:0 or 4:4:4 chroma (-s) and a restart
+marker every --restart MCUs. The Huffman tables are optimized for the image.
+A JPEG input file is embedded unchanged, to test files of other encoders.
+-f png makes a PNG for ILI9341DrawPng, indexed at 1 to 8 bits per pixel when
+the image has at most 256 colors, RGB or RGBA otherwise. -a takes the alpha
+channel from the red channel of a PPM of the same size. --window limits the
+deflate window for decoders built with a smaller ILI9341_PNG_WINDOW_BYTES.
+-f raw makes a uint16_t array for ILI9341DrawImage.
+
+Colors are truncated to RGB565 like RGB888ToRGB565, for QOI before encoding,
+so rle and qoi output is byte for byte that of Tools/ImageCompiler.cpp. The
+input is a binary (P6) or plain (P3) PPM with a maxval of 255; convert other
+formats with e.g. `convert splash.png splash.ppm`. The size of the output and
+its ratio to the raw image go to stderr.
+"""
+import argparse
+import heapq
+import math
+import struct
+import sys
+import zlib
+
+RLE_RUN = 0x8000
+RLE_MAX_COUNT = 0x8000
+# A run packet costs two words, a literal pixel one, so shorter runs stay literal
+RLE_MIN_RUN = 3
+
+JPEG_ZIGZAG = [
+    0, 1, 8, 16, 9, 2, 3, 10, 17, 24, 32, 25, 18, 11, 4, 5,
+    12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13, 6, 7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63]
+# Example quantization tables of ITU T.81 Annex K, natural order
+JPEG_LUMA_QUANT = [
+    16, 11, 10, 16, 24, 40, 51, 61, 12, 12, 14, 19, 26, 58, 60, 55,
+    14, 13, 16, 24, 40, 57, 69, 56, 14, 17, 22, 29, 51, 87, 80, 62,
+    18, 22, 37, 56, 68, 109, 103, 77, 24, 35, 55, 64, 81, 104, 113, 92,
+    49, 64, 78, 87, 103, 121, 120, 101, 72, 92, 95, 98, 112, 100, 103, 99]
+JPEG_CHROMA_QUANT = [
+    17, 18, 24, 47, 99, 99, 99, 99, 18, 21, 26, 66, 99, 99, 99, 99,
+    24, 26, 56, 99, 99, 99, 99, 99, 47, 66, 99, 99, 99, 99, 99, 99] + [99] * 32
+JPEG_BASIS = [[(math.sqrt(0.5) if u == 0 else 1.0) / 2 * math.cos((2 * x + 1) * u * math.pi / 16)
+               for x in range(8)] for u in range(8)]
+
+
+def read_ppm(path):
+    """Return (width, height, RGB triples) of a P6 or P3 PPM."""
+    with open(path, 'rb') as image:
+        data = image.read()
+    tokens, position = [], 0
+    while len(tokens) < 4:
+        while data[position:position + 1].isspace():
+            position += 1
+        if data[position:position + 1] == b'#':
+            position = data.index(b'\n', position)
+            continue
+        end = position
+        while not data[end:end + 1].isspace():
+            end += 1
+        tokens.append(data[position:end])
+        position = end
+    magic, width, height, maxval = tokens[0], int(tokens[1]), int(tokens[2]), int(tokens[3])
+    if magic not in (b'P6', b'P3') or maxval != 255:
+        raise SystemExit('%s: not an 8-bit P6 or P3 PPM' % path)
+    if magic == b'P6':
+        values = data[position + 1:position + 1 + width * height * 3]
+    else:
+        values = [int(value) for value in data[position:].split()]
+    if len(values) < width * height * 3:
+        raise SystemExit('%s: truncated pixel data' % path)
+    return width, height, [tuple(values[i:i + 3]) for i in range(0, width * height * 3, 3)]
+
+
+def read_jpeg_size(data, path):
+    """Return (width, height) from the frame header of a JPEG file."""
+    position = 2
+    while position + 9 <= len(data) and data[position] == 0xFF:
+        marker = data[position + 1]
+        if 0xC0 <= marker <= 0xC2:
+            height, width = struct.unpack('>HH', data[position + 5:position + 9])
+            return width, height
+        position += 2 + struct.unpack('>H', data[position + 2:position + 4])[0]
+    raise SystemExit('%s: no JPEG frame header' % path)
+
+
+def to_rgb565(rgb):
+    return [(r & 0xF8) << 8 | (g & 0xFC) << 3 | b >> 3 for r, g, b in rgb]
+
+
+def truncate_rgb565(rgb):
+    """RGB triples with the bits RGB565 drops cleared, the screen shows the same colors."""
+    return [(r & 0xF8, g & 0xFC, b & 0xF8) for r, g, b in rgb]
+
+
+def encode_rle(pixels):
+    """Packet stream of a pixel list, runs cross row ends."""
+    words, literal = [], []
+
+    def flush():
+        for start in range(0, len(literal), RLE_MAX_COUNT):
+            chunk = literal[start:start + RLE_MAX_COUNT]
+            words.append(len(chunk) - 1)
+            words.extend(chunk)
+        del literal[:]
+
+    position = 0
+    while position < len(pixels):
+        end = position + 1
+        while end < len(pixels) and pixels[end] == pixels[position] and end - position < RLE_MAX_COUNT:
+            end += 1
+        if end - position >= RLE_MIN_RUN:
+            flush()
+            words.extend((RLE_RUN | (end - position - 1), pixels[position]))
+        else:
+            literal.extend(pixels[position:end])
+        position = end
+    flush()
+    return words
+
+
+def encode_qoi(width, height, rgb):
+    """QOI file of RGB triples, the reference encoder without alpha."""
+    data = bytearray(b'qoif' + width.to_bytes(4, 'big') + height.to_bytes(4, 'big') + bytes((3, 0)))
+    index = [None] * 64
+    previous, run = (0, 0, 0), 0
+    for position, pixel in enumerate(rgb):
+        if pixel == previous:
+            run += 1
+            if run == 62 or position == len(rgb) - 1:
+                data.append(0xC0 | (run - 1))
+                run = 0
+            continue
+        if run > 0:
+            data.append(0xC0 | (run - 1))
+            run = 0
+        slot = (pixel[0] * 3 + pixel[1] * 5 + pixel[2] * 7 + 255 * 11) % 64
+        if index[slot] == pixel:
+            data.append(slot)
+        else:
+            index[slot] = pixel
+            dr, dg, db = [((pixel[i] - previous[i] + 128) & 0xFF) - 128 for i in range(3)]
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                data.append(0x40 | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2))
+            elif -32 <= dg <= 31 and -8 <= dr - dg <= 7 and -8 <= db - dg <= 7:
+                data.extend((0x80 | (dg + 32), (dr - dg + 8) << 4 | (db - dg + 8)))
+            else:
+                data.extend((0xFE,) + pixel)
+        previous = pixel
+    data.extend(bytes(7) + b'\x01')
+    return bytes(data)
+
+
+def jpeg_quant(base, quality):
+    """Annex K table scaled to a quality like the IJG library, natural order."""
+    scale = 5000 // quality if quality < 50 else 200 - 2 * quality
+    return [min(255, max(1, (value * scale + 50) // 100)) for value in base]
+
+
+def jpeg_block(samples, quant):
+    """Quantized coefficients of 64 samples in zigzag order."""
+    rows = [[sum(JPEG_BASIS[u][x] * (samples[y * 8 + x] - 128) for x in range(8)) for u in range(8)]
+            for y in range(8)]
+    coefficients = [sum(JPEG_BASIS[v][y] * rows[y][u] for y in range(8)) for v in range(8) for u in range(8)]
+    return [int(round(coefficients[n] / quant[n])) for n in JPEG_ZIGZAG]
+
+
+def jpeg_category(value):
+    """Magnitude category and extra bits of a coefficient."""
+    size = abs(value).bit_length()
+    return size, value if value >= 0 else value + (1 << size) - 1
+
+
+def jpeg_huffman(counts):
+    """Code lengths at most 16 bits long for symbol counts, as (bits[16], values)."""
+    # A reserved symbol keeps the all-ones code out of use, Annex K.2
+    counts = dict(counts, **{'reserved': 1})
+    heap = [(count, order, [symbol]) for order, (symbol, count) in enumerate(counts.items())]
+    heapq.heapify(heap)
+    sizes = dict.fromkeys(counts, 0)
+    order = len(heap)
+    while len(heap) > 1:
+        count1, _, symbols1 = heapq.heappop(heap)
+        count2, _, symbols2 = heapq.heappop(heap)
+        for symbol in symbols1 + symbols2:
+            sizes[symbol] += 1
+        heapq.heappush(heap, (count1 + count2, order, symbols1 + symbols2))
+        order += 1
+    bits = [0] * 33
+    for size in sizes.values():
+        bits[max(size, 1)] += 1
+    for size in range(32, 16, -1):
+        while bits[size] > 0:
+            shorter = size - 2
+            while bits[shorter] == 0:
+                shorter -= 1
+            bits[size] -= 2
+            bits[size - 1] += 1
+            bits[shorter + 1] += 2
+            bits[shorter] -= 1
+    longest = 16
+    while bits[longest] == 0:
+        longest -= 1
+    bits[longest] -= 1
+    values = sorted((symbol for symbol in counts if symbol != 'reserved'), key=lambda symbol: -counts[symbol])
+    return bits[1:17], values
+
+
+def jpeg_codes(bits, values):
+    """Canonical code of every symbol as (code, length)."""
+    codes, code, position = {}, 0, 0
+    for length in range(1, 17):
+        for _ in range(bits[length - 1]):
+            codes[values[position]] = (code, length)
+            code += 1
+            position += 1
+        code <<= 1
+    return codes
+
+
+def encode_jpeg(width, height, rgb, quality, subsample, restart):
+    """Baseline JPEG of RGB triples with Huffman tables optimized for it."""
+    planes = [[], [], []]
+    for r, g, b in rgb:
+        planes[0].append(0.299 * r + 0.587 * g + 0.114 * b)
+        planes[1].append(-0.168736 * r - 0.331264 * g + 0.5 * b + 128)
+        planes[2].append(0.5 * r - 0.418688 * g - 0.081312 * b + 128)
+    factor = 2 if subsample == '420' else 1
+    mcu = 8 * factor
+    columns, rows = (width + mcu - 1) // mcu, (height + mcu - 1) // mcu
+
+    def sample(plane, x, y):
+        return plane[min(y, height - 1) * width + min(x, width - 1)]
+
+    def block(plane, left, top, step):
+        """8x8 samples from (left, top), averaging step x step pixels, the edges repeated."""
+        return [sum(sample(plane, left + x * step + dx, top + y * step + dy)
+                    for dy in range(step) for dx in range(step)) / (step * step)
+                for y in range(8) for x in range(8)]
+
+    quants = [jpeg_quant(JPEG_LUMA_QUANT, quality), jpeg_quant(JPEG_CHROMA_QUANT, quality)]
+    mcus = []
+    for row in range(rows):
+        for column in range(columns):
+            blocks = [(0, jpeg_block(block(planes[0], column * mcu + 8 * dx, row * mcu + 8 * dy, 1), quants[0]))
+                      for dy in range(factor) for dx in range(factor)]
+            blocks += [(component, jpeg_block(block(planes[component], column * mcu, row * mcu, factor), quants[1]))
+                       for component in (1, 2)]
+            mcus.append(blocks)
+    # Symbols of every block, then the tables from their counts
+    symbols = []
+    predictions = [0, 0, 0]
+    for number, blocks in enumerate(mcus):
+        if restart and number and number % restart == 0:
+            symbols.append(None)
+            predictions = [0, 0, 0]
+        for component, coefficients in blocks:
+            table = 0 if component == 0 else 1
+            size, extra = jpeg_category(coefficients[0] - predictions[component])
+            predictions[component] = coefficients[0]
+            symbols.append((table, size, size, extra))
+            run = 0
+            for k in range(1, 64):
+                if coefficients[k] == 0:
+                    run += 1
+                    continue
+                while run > 15:
+                    symbols.append((2 + table, 0xF0, 0, 0))
+                    run -= 16
+                size, extra = jpeg_category(coefficients[k])
+                symbols.append((2 + table, run << 4 | size, size, extra))
+                run = 0
+            if run:
+                symbols.append((2 + table, 0x00, 0, 0))
+    counts = [{}, {}, {}, {}]
+    for symbol in symbols:
+        if symbol is not None:
+            counts[symbol[0]][symbol[1]] = counts[symbol[0]].get(symbol[1], 0) + 1
+    tables = [jpeg_huffman(count) for count in counts]
+    codes = [jpeg_codes(*table) for table in tables]
+
+    def segment(marker, payload):
+        return bytes((0xFF, marker)) + (len(payload) + 2).to_bytes(2, 'big') + bytes(payload)
+
+    data = bytearray(b'\xff\xd8')
+    data += segment(0xE0, b'JFIF\x00\x01\x01\x00\x00\x01\x00\x01\x00\x00')
+    for number, quant in enumerate(quants):
+        data += segment(0xDB, [number] + [quant[n] for n in JPEG_ZIGZAG])
+    data += segment(0xC0, [8] + list(height.to_bytes(2, 'big')) + list(width.to_bytes(2, 'big')) +
+                    [3, 1, factor << 4 | factor, 0, 2, 0x11, 1, 3, 0x11, 1])
+    for number, (bits, values) in enumerate(tables):
+        data += segment(0xC4, [(number >> 1) << 4 | (number & 1)] + bits + values)
+    if restart:
+        data += segment(0xDD, list(restart.to_bytes(2, 'big')))
+    data += segment(0xDA, [3, 1, 0x00, 2, 0x11, 3, 0x11, 0, 63, 0])
+    accumulator, count, marker = 0, 0, 0
+
+    def flush_byte(byte):
+        data.append(byte)
+        if byte == 0xFF:
+            data.append(0)
+
+    for symbol in symbols:
+        if symbol is None:
+            if count:
+                flush_byte((accumulator << (8 - count) | (1 << (8 - count)) - 1) & 0xFF)
+            accumulator, count = 0, 0
+            data.extend((0xFF, 0xD0 + marker))
+            marker = (marker + 1) % 8
+            continue
+        table, value, size, extra = symbol
+        code, length = codes[table][value]
+        accumulator = accumulator << length | code
+        count += length
+        if size:
+            accumulator = accumulator << size | extra
+            count += size
+        while count >= 8:
+            count -= 8
+            flush_byte(accumulator >> count & 0xFF)
+        accumulator &= (1 << count) - 1
+    if count:
+        flush_byte((accumulator << (8 - count) | (1 << (8 - count)) - 1) & 0xFF)
+    data += b'\xff\xd9'
+    return bytes(data)
+
+
+def png_filter(row, previous, step):
+    """Filtered row with the filter of the smallest sum of magnitudes, like libpng."""
+    best = None
+    for kind in range(5):
+        filtered = bytearray([kind])
+        for i, value in enumerate(row):
+            left = row[i - step] if i >= step else 0
+            up = previous[i]
+            up_left = previous[i - step] if i >= step else 0
+            if kind == 1:
+                value -= left
+            elif kind == 2:
+                value -= up
+            elif kind == 3:
+                value -= (left + up) >> 1
+            elif kind == 4:
+                estimate = left + up - up_left
+                distances = (abs(estimate - left), abs(estimate - up), abs(estimate - up_left))
+                value -= left if distances[0] <= min(distances[1:]) else up if distances[1] <= distances[2] else up_left
+            filtered.append(value & 0xFF)
+        cost = sum(value if value < 128 else 256 - value for value in filtered[1:])
+        if best is None or cost < best[0]:
+            best = (cost, filtered)
+    return best[1]
+
+
+def encode_png(width, height, rgba, window):
+    """PNG of RGBA quadruples, indexed when there are at most 256 colors."""
+    # Translucent colors first so tRNS stops at the last of them
+    colors = sorted(dict.fromkeys(rgba), key=lambda color: color[3] == 255)
+    alpha = any(pixel[3] != 255 for pixel in rgba)
+    chunks = []
+    if len(colors) <= 256:
+        depth = next(bits for bits in (1, 2, 4, 8) if len(colors) <= 1 << bits)
+        index = {color: number for number, color in enumerate(colors)}
+        rows, step = [], 1
+        for y in range(height):
+            row, value, count = bytearray(), 0, 0
+            for pixel in rgba[y * width:(y + 1) * width]:
+                value = value << depth | index[pixel]
+                count += depth
+                if count == 8:
+                    row.append(value)
+                    value, count = 0, 0
+            if count:
+                row.append(value << (8 - count))
+            rows.append(row)
+        header = struct.pack('>IIBBBBB', width, height, depth, 3, 0, 0, 0)
+        chunks.append((b'PLTE', bytes(channel for color in colors for channel in color[:3])))
+        if alpha:
+            opaque = len(colors)
+            while opaque > 0 and colors[opaque - 1][3] == 255:
+                opaque -= 1
+            chunks.append((b'tRNS', bytes(color[3] for color in colors[:opaque])))
+    else:
+        step = 4 if alpha else 3
+        rows = [bytes(channel for pixel in rgba[y * width:(y + 1) * width] for channel in pixel[:step])
+                for y in range(height)]
+        header = struct.pack('>IIBBBBB', width, height, 8, 6 if alpha else 2, 0, 0, 0)
+    previous, data = bytes(len(rows[0])), bytearray()
+    for row in rows:
+        data += png_filter(row, previous, step)
+        previous = row
+    compressor = zlib.compressobj(9, zlib.DEFLATED, int(math.log2(window)))
+    stream = compressor.compress(bytes(data)) + compressor.flush()
+    # IDAT chunks of 8 KB like libpng, the decoder joins them
+    chunks += [(b'IDAT', stream[start:start + 8192]) for start in range(0, len(stream), 8192)]
+    chunks.append((b'IEND', b''))
+    output = bytearray(b'\x89PNG\r\n\x1a\n')
+    for kind, payload in [(b'IHDR', header)] + chunks:
+        output += struct.pack('>I', len(payload)) + kind + payload
+        output += struct.pack('>I', zlib.crc32(kind + payload) & 0xFFFFFFFF)
+    return bytes(output)
+
+
+def emit_words(name, words):
+    lines = ['static const uint16_t %s[] = {' % name]
+    for start in range(0, len(words), 12):
+        lines.append('    %s,' % ', '.join('0x%04X' % word for word in words[start:start + 12]))
+    lines.append('};')
+    return lines
+
+
+def emit_bytes(name, data):
+    lines = ['const uint8_t %s[] = {' % name]
+    for start in range(0, len(data), 16):
+        lines.append('    %s,' % ', '.join('0x%02X' % byte for byte in data[start:start + 16]))
+    lines.append('};')
+    return lines
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('-n', '--name', required=True, help='name of the emitted image')
+    parser.add_argument('-f', '--format', choices=('rle', 'raw', 'qoi', 'jpeg', 'png'), default='rle',
+                        help='output format, rle by default')
+    parser.add_argument('-q', '--quality', type=int, default=85, choices=range(1, 101), metavar='1-100',
+                        help='JPEG quality, 85 by default')
+    parser.add_argument('-s', '--subsample', choices=('420', '444'), default='420',
+                        help='JPEG chroma subsampling, 420 by default')
+    parser.add_argument('--restart', type=int, default=0, help='MCUs between JPEG restart markers')
+    parser.add_argument('-a', '--alpha', help='PPM whose red channel is the PNG alpha channel')
+    parser.add_argument('--window', type=int, default=32768, choices=[1 << bits for bits in range(8, 16)],
+                        metavar='256-32768', help='PNG deflate window, 32768 by default')
+    parser.add_argument('input')
+    arguments = parser.parse_args()
+    with open(arguments.input, 'rb') as image:
+        jpeg = image.read()
+    if jpeg[:2] == b'\xFF\xD8':
+        if arguments.format != 'jpeg':
+            raise SystemExit('%s: a JPEG input is only embedded with -f jpeg' % arguments.input)
+        width, height = read_jpeg_size(jpeg, arguments.input)
+        rgb = [(0, 0, 0)] * (width * height)
+    else:
+        jpeg = None
+        width, height, rgb = read_ppm(arguments.input)
+    pixels = to_rgb565(rgb)
+    print('#include "ILI9341.h"')
+    print('')
+    if arguments.format == 'raw':
+        lines = emit_words(arguments.name, pixels)
+        lines[0] = lines[0].replace('static ', '', 1)
+        print('\n'.join(lines))
+        size = 2 * len(pixels)
+    elif arguments.format in ('qoi', 'jpeg', 'png'):
+        if arguments.format == 'qoi':
+            data = encode_qoi(width, height, truncate_rgb565(rgb))
+        elif arguments.format == 'png':
+            alpha = [255] * len(rgb)
+            if arguments.alpha:
+                alpha_width, alpha_height, mask = read_ppm(arguments.alpha)
+                if (alpha_width, alpha_height) != (width, height):
+                    raise SystemExit('%s: not %dx%d' % (arguments.alpha, width, height))
+                alpha = [pixel[0] for pixel in mask]
+            data = encode_png(width, height, [pixel + (value,) for pixel, value in zip(rgb, alpha)],
+                              arguments.window)
+        else:
+            data = jpeg or encode_jpeg(width, height, rgb, arguments.quality, arguments.subsample,
+                                       arguments.restart)
+        print('\n'.join(emit_bytes(arguments.name, data)))
+        print('const uint32_t %sSize = %d;' % (arguments.name, len(data)))
+        size = len(data)
+    else:
+        words = encode_rle(pixels)
+        print('\n'.join(emit_words(arguments.name + 'Data', words)))
+        print('')
+        print('const ILI9341RleImage_s %s = {%d, %d, %sData, %d};' % (
+            arguments.name, width, height, arguments.name, len(words)))
+        size = 2 * len(words)
+    sys.stderr.write('%s: %dx%d, %d of %d bytes (%.1f%%)\n' % (
+        arguments.name, width, height, size, 2 * len(pixels), 100.0 * size / (2 * len(pixels))))
+
+
+if __name__ == '__main__':
+    main()